@@ -76,8 +76,12 @@ void _isr_wrapper(void)
 	 */
 	irq_number -= 16;
 
+#ifdef CONFIG_ISR_STATS
+	z_isr_stats_dispatch(irq_number);
+#else
 	const struct _isr_table_entry *entry = &_sw_isr_table[irq_number];
 	(entry->isr)(entry->arg);
+#endif /* CONFIG_ISR_STATS */
 
 #if defined(CONFIG_ARM_CUSTOM_INTERRUPT_CONTROLLER)
 	z_soc_irq_eoi(irq_number);
@@ -0,0 +1,111 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sw_isr_table.h>
+#include <zephyr/sys/math_extras.h>
+
+static struct isr_stats isr_stats[IRQ_TABLE_SIZE];
+
+void z_isr_stats_dispatch(unsigned int irq)
+{
+	const struct _isr_table_entry *entry = &_sw_isr_table[irq];
+	struct isr_stats *stats = &isr_stats[irq];
+	uint32_t start = k_cycle_get_32();
+	uint32_t cycles;
+	unsigned int bucket;
+
+	entry->isr(entry->arg);
+
+	cycles = k_cycle_get_32() - start;
+	bucket = (cycles == 0U) ? 0U : 32U - u32_count_leading_zeros(cycles);
+
+	stats->count++;
+	stats->total_cycles += cycles;
+	stats->max_cycles = MAX(stats->max_cycles, cycles);
+	stats->hist[MIN(bucket, CONFIG_ISR_STATS_HIST_BUCKETS - 1)]++;
+}
+
+int isr_stats_get(unsigned int irq, struct isr_stats *stats)
+{
+	unsigned int key;
+
+	if (irq >= IRQ_TABLE_SIZE) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	*stats = isr_stats[irq];
+	irq_unlock(key);
+
+	return 0;
+}
+
+void isr_stats_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	memset(isr_stats, 0, sizeof(isr_stats));
+	irq_unlock(key);
+}
+
+#ifdef CONFIG_SHELL
+static int cmd_isr_stats_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct isr_stats stats;
+
+	for (unsigned int irq = 0; irq < IRQ_TABLE_SIZE; irq++) {
+		(void)isr_stats_get(irq, &stats);
+		if (stats.count == 0U) {
+			continue;
+		}
+
+		shell_print(sh, "%4u: count %u, avg %u us, max %u us", irq, stats.count,
+			    k_cyc_to_us_floor32(stats.total_cycles / stats.count),
+			    k_cyc_to_us_floor32(stats.max_cycles));
+
+		for (unsigned int i = 0; i < CONFIG_ISR_STATS_HIST_BUCKETS; i++) {
+			if (stats.hist[i] == 0U) {
+				continue;
+			}
+
+			if (i == CONFIG_ISR_STATS_HIST_BUCKETS - 1U) {
+				shell_print(sh, "      >= %llu cycles: %u", BIT64(i) >> 1,
+					    stats.hist[i]);
+			} else {
+				shell_print(sh, "      < %llu cycles: %u", BIT64(i), stats.hist[i]);
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_isr_stats_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	isr_stats_reset();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(isr_stats_cmds,
+			       SHELL_CMD_ARG(show, NULL,
+					     "Show the ISR duration statistics.\n"
+					     "Usage: isr_stats show",
+					     cmd_isr_stats_show, 1, 0),
+			       SHELL_CMD_ARG(reset, NULL,
+					     "Reset the ISR duration statistics.\n"
+					     "Usage: isr_stats reset",
+					     cmd_isr_stats_reset, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_ARG_REGISTER(isr_stats, &isr_stats_cmds, "ISR duration statistics",
+		       NULL, 0, 0);
+#endif /* CONFIG_SHELL */
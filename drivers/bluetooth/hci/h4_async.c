@@ -0,0 +1,643 @@
+/* h4_async.c - H:4 UART based Bluetooth driver using the UART async API */
+
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The UART receives into a ring of CONFIG_BT_H4_ASYNC_RX_BUF_COUNT buffers,
+ * handed to the driver in order as it requests them. The RX thread parses the
+ * H:4 packets out of the received data of the buffers, in order, and gives a
+ * buffer back once it has parsed all its data and the driver has released it.
+ * All the packets received since the previous wakeup are delivered at once, and
+ * the interrupt load only depends on the size of the buffers and on the RX
+ * timeout, not on the number of bytes received.
+ *
+ * If the RX thread falls behind and no buffer is free when the driver requests
+ * one, reception stops at the end of the current buffer, with the hardware flow
+ * control holding off the controller, and is enabled again once a buffer has
+ * been given back.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/arch/cpu.h>
+
+#include <zephyr/init.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/drivers/bluetooth.h>
+
+#define LOG_LEVEL CONFIG_BT_HCI_DRIVER_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bt_driver);
+
+#include "common/bt_str.h"
+
+#include "../util.h"
+
+#define DT_DRV_COMPAT zephyr_bt_hci_uart
+
+#define RX_BUF_COUNT CONFIG_BT_H4_ASYNC_RX_BUF_COUNT
+#define RX_BUF_SIZE  CONFIG_BT_H4_ASYNC_RX_BUF_SIZE
+
+struct h4_rx_buf {
+	uint8_t data[RX_BUF_SIZE];
+	/* Number of bytes received in the buffer */
+	atomic_t len;
+	/* Set once the UART driver is done with the buffer */
+	atomic_t released;
+};
+
+struct h4_data {
+	struct {
+		struct h4_rx_buf bufs[RX_BUF_COUNT];
+		/* Number of buffers handed to the UART driver, and given back */
+		uint32_t        wr;
+		uint32_t        rd;
+		/* Parsing offset in the oldest buffer */
+		uint16_t        pos;
+		atomic_t        enabled;
+
+		struct k_sem    ready;
+
+		struct net_buf *buf;
+
+		uint16_t        remaining;
+		uint16_t        discard;
+
+		bool            have_hdr;
+		bool            discardable;
+
+		uint8_t         hdr_len;
+
+		uint8_t         type;
+		union {
+			struct bt_hci_evt_hdr evt;
+			struct bt_hci_acl_hdr acl;
+			struct bt_hci_iso_hdr iso;
+			uint8_t hdr[4];
+		};
+	} rx;
+
+	struct {
+		struct net_buf *buf;
+		struct k_fifo   fifo;
+		atomic_t        busy;
+	} tx;
+
+	bt_hci_recv_t recv;
+};
+
+struct h4_config {
+	const struct device *uart;
+	k_thread_stack_t *rx_thread_stack;
+	size_t rx_thread_stack_size;
+	struct k_thread *rx_thread;
+};
+
+static void reset_rx(struct h4_data *h4)
+{
+	if (h4->rx.buf) {
+		net_buf_unref(h4->rx.buf);
+		h4->rx.buf = NULL;
+	}
+
+	h4->rx.type = BT_HCI_H4_NONE;
+	h4->rx.remaining = 0U;
+	h4->rx.have_hdr = false;
+	h4->rx.hdr_len = 0U;
+	h4->rx.discardable = false;
+}
+
+static struct net_buf *get_rx(struct h4_data *h4, k_timeout_t timeout)
+{
+	LOG_DBG("type 0x%02x, evt 0x%02x", h4->rx.type, h4->rx.evt.evt);
+
+	switch (h4->rx.type) {
+	case BT_HCI_H4_EVT:
+		return bt_buf_get_evt(h4->rx.evt.evt, h4->rx.discardable, timeout);
+	case BT_HCI_H4_ACL:
+		return bt_buf_get_rx(BT_BUF_ACL_IN, timeout);
+	case BT_HCI_H4_ISO:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			return bt_buf_get_rx(BT_BUF_ISO_IN, timeout);
+		}
+	}
+
+	return NULL;
+}
+
+static void h4_set_type(struct h4_data *h4, uint8_t type)
+{
+	h4->rx.type = type;
+
+	switch (type) {
+	case BT_HCI_H4_EVT:
+		h4->rx.remaining = sizeof(h4->rx.evt);
+		h4->rx.hdr_len = h4->rx.remaining;
+		break;
+	case BT_HCI_H4_ACL:
+		h4->rx.remaining = sizeof(h4->rx.acl);
+		h4->rx.hdr_len = h4->rx.remaining;
+		break;
+	case BT_HCI_H4_ISO:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			h4->rx.remaining = sizeof(h4->rx.iso);
+			h4->rx.hdr_len = h4->rx.remaining;
+			break;
+		}
+		__fallthrough;
+	default:
+		LOG_ERR("Unknown H:4 type 0x%02x", type);
+		h4->rx.type = BT_HCI_H4_NONE;
+	}
+}
+
+static void h4_deliver(const struct device *dev)
+{
+	struct h4_data *h4 = dev->data;
+	struct net_buf *buf;
+
+	buf = h4->rx.buf;
+	h4->rx.buf = NULL;
+
+	reset_rx(h4);
+
+	LOG_DBG("Calling bt_recv(%p)", buf);
+	h4->recv(dev, buf);
+}
+
+/* Allocate the packet buffer once its header has been received */
+static void h4_hdr_done(const struct device *dev)
+{
+	struct h4_data *h4 = dev->data;
+
+	switch (h4->rx.type) {
+	case BT_HCI_H4_EVT:
+		if (h4->rx.evt.evt == BT_HCI_EVT_LE_META_EVENT &&
+		    (h4->rx.hdr[sizeof(h4->rx.evt)] == BT_HCI_EVT_LE_ADVERTISING_REPORT)) {
+			LOG_DBG("Marking adv report as discardable");
+			h4->rx.discardable = true;
+		}
+
+		h4->rx.remaining = h4->rx.evt.len - (h4->rx.hdr_len - sizeof(h4->rx.evt));
+		LOG_DBG("Got event header. Payload %u bytes", h4->rx.evt.len);
+		break;
+	case BT_HCI_H4_ACL:
+		h4->rx.remaining = sys_le16_to_cpu(h4->rx.acl.len);
+		LOG_DBG("Got ACL header. Payload %u bytes", h4->rx.remaining);
+		break;
+	case BT_HCI_H4_ISO:
+		h4->rx.remaining = bt_iso_hdr_len(sys_le16_to_cpu(h4->rx.iso.len));
+		LOG_DBG("Got ISO header. Payload %u bytes", h4->rx.remaining);
+		break;
+	default:
+		CODE_UNREACHABLE;
+		return;
+	}
+
+	h4->rx.have_hdr = true;
+
+	/* Command Complete/Status events must use the original command buffer
+	 * (if available), which is known from the header only.
+	 */
+	h4->rx.buf = get_rx(h4, h4->rx.discardable ? K_NO_WAIT : K_FOREVER);
+	if (!h4->rx.buf) {
+		LOG_WRN("Discarding event 0x%02x", h4->rx.evt.evt);
+		h4->rx.discard = h4->rx.remaining;
+		reset_rx(h4);
+		return;
+	}
+
+	LOG_DBG("Allocated rx.buf %p", h4->rx.buf);
+
+	if (h4->rx.remaining > net_buf_tailroom(h4->rx.buf)) {
+		LOG_ERR("Not enough space in buffer %u/%zu", h4->rx.remaining,
+			net_buf_tailroom(h4->rx.buf));
+		h4->rx.discard = h4->rx.remaining;
+		reset_rx(h4);
+		return;
+	}
+
+	net_buf_add_mem(h4->rx.buf, h4->rx.hdr, h4->rx.hdr_len);
+
+	if (!h4->rx.remaining) {
+		h4_deliver(dev);
+	}
+}
+
+static size_t h4_read_hdr(const struct device *dev, const uint8_t *data, size_t len)
+{
+	struct h4_data *h4 = dev->data;
+	size_t read;
+
+	if (h4->rx.type == BT_HCI_H4_NONE) {
+		h4_set_type(h4, data[0]);
+		return 1;
+	}
+
+	read = MIN(len, h4->rx.remaining);
+	memcpy(&h4->rx.hdr[h4->rx.hdr_len - h4->rx.remaining], data, read);
+	h4->rx.remaining -= read;
+
+	if (h4->rx.remaining) {
+		return read;
+	}
+
+	if (h4->rx.type == BT_HCI_H4_EVT && h4->rx.hdr_len == sizeof(h4->rx.evt)) {
+		switch (h4->rx.evt.evt) {
+		case BT_HCI_EVT_LE_META_EVENT:
+			/* Get the subevent code as well */
+			h4->rx.remaining++;
+			h4->rx.hdr_len++;
+			return read;
+#if defined(CONFIG_BT_CLASSIC)
+		case BT_HCI_EVT_INQUIRY_RESULT_WITH_RSSI:
+		case BT_HCI_EVT_EXTENDED_INQUIRY_RESULT:
+			h4->rx.discardable = true;
+			break;
+#endif
+		}
+	}
+
+	h4_hdr_done(dev);
+
+	return read;
+}
+
+static size_t h4_read_payload(const struct device *dev, const uint8_t *data, size_t len)
+{
+	struct h4_data *h4 = dev->data;
+	size_t read;
+
+	read = MIN(len, h4->rx.remaining);
+	net_buf_add_mem(h4->rx.buf, data, read);
+	h4->rx.remaining -= read;
+
+	LOG_DBG("got %zu bytes, remaining %u", read, h4->rx.remaining);
+
+	if (!h4->rx.remaining) {
+		LOG_DBG("Payload (len %u): %s", h4->rx.buf->len,
+			bt_hex(h4->rx.buf->data, h4->rx.buf->len));
+		h4_deliver(dev);
+	}
+
+	return read;
+}
+
+/* Parse the H:4 packets of received data */
+static void h4_process(const struct device *dev, const uint8_t *data, size_t len)
+{
+	struct h4_data *h4 = dev->data;
+
+	while (len) {
+		size_t read;
+
+		if (h4->rx.discard) {
+			read = MIN(len, h4->rx.discard);
+			h4->rx.discard -= read;
+		} else if (h4->rx.have_hdr) {
+			read = h4_read_payload(dev, data, len);
+		} else {
+			read = h4_read_hdr(dev, data, len);
+		}
+
+		data += read;
+		len -= read;
+	}
+}
+
+static void h4_rx_enable(const struct device *dev)
+{
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	struct h4_rx_buf *buf;
+	int err;
+
+	if (h4->rx.wr - h4->rx.rd >= RX_BUF_COUNT) {
+		return;
+	}
+
+	buf = &h4->rx.bufs[h4->rx.wr % RX_BUF_COUNT];
+	h4->rx.wr++;
+	atomic_set(&h4->rx.enabled, 1);
+
+	err = uart_rx_enable(cfg->uart, buf->data, sizeof(buf->data),
+			     CONFIG_BT_H4_ASYNC_RX_TIMEOUT);
+	if (err) {
+		LOG_ERR("Unable to enable UART RX (err %d)", err);
+		atomic_clear(&h4->rx.enabled);
+		h4->rx.wr--;
+	}
+}
+
+/* Process the oldest buffer, returns false once there is nothing to process */
+static bool h4_rx_process_buf(const struct device *dev)
+{
+	struct h4_data *h4 = dev->data;
+	struct h4_rx_buf *buf = &h4->rx.bufs[h4->rx.rd % RX_BUF_COUNT];
+	/* Released is read first, as the driver reports data before release */
+	bool released = atomic_get(&buf->released);
+	uint16_t len = atomic_get(&buf->len);
+
+	if (h4->rx.pos < len) {
+		h4_process(dev, &buf->data[h4->rx.pos], len - h4->rx.pos);
+		h4->rx.pos = len;
+		return true;
+	}
+
+	if (released && (h4->rx.wr != h4->rx.rd)) {
+		/* Give the buffer back */
+		atomic_clear(&buf->len);
+		atomic_clear(&buf->released);
+		h4->rx.pos = 0U;
+		h4->rx.rd++;
+		return true;
+	}
+
+	/* Restart reception stopped for lack of buffers, or by an error */
+	if (!atomic_get(&h4->rx.enabled)) {
+		h4_rx_enable(dev);
+	}
+
+	return false;
+}
+
+static void rx_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	struct h4_data *h4 = dev->data;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	LOG_DBG("started");
+
+	while (1) {
+		k_sem_take(&h4->rx.ready, K_FOREVER);
+
+		while (h4_rx_process_buf(dev)) {
+			/* Give other threads a chance to run if the UART
+			 * is receiving data so fast that the buffers never
+			 * or very rarely get empty.
+			 */
+			k_yield();
+		}
+	}
+}
+
+static void h4_tx_next(const struct device *dev)
+{
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	int err;
+
+	/* Otherwise the completion of the ongoing transfer starts the next one */
+	while (atomic_cas(&h4->tx.busy, 0, 1)) {
+		h4->tx.buf = k_fifo_get(&h4->tx.fifo, K_NO_WAIT);
+		if (h4->tx.buf) {
+			err = uart_tx(cfg->uart, h4->tx.buf->data, h4->tx.buf->len,
+				      SYS_FOREVER_US);
+			if (!err) {
+				return;
+			}
+
+			LOG_ERR("Unable to write to UART (err %d)", err);
+			net_buf_unref(h4->tx.buf);
+			h4->tx.buf = NULL;
+		}
+
+		atomic_clear(&h4->tx.busy);
+
+		/* Catch buffers queued before clearing the flag */
+		if (k_fifo_is_empty(&h4->tx.fifo)) {
+			return;
+		}
+	}
+}
+
+static void h4_tx_done(const struct device *dev)
+{
+	struct h4_data *h4 = dev->data;
+	struct net_buf *buf;
+
+	buf = h4->tx.buf;
+	h4->tx.buf = NULL;
+	atomic_clear(&h4->tx.busy);
+
+	if (buf) {
+		net_buf_unref(buf);
+	}
+
+	h4_tx_next(dev);
+}
+
+static void bt_uart_callback(const struct device *uart, struct uart_event *evt,
+			     void *user_data)
+{
+	const struct device *dev = user_data;
+	struct h4_data *h4 = dev->data;
+	struct h4_rx_buf *buf;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		h4_tx_done(dev);
+		break;
+	case UART_TX_ABORTED:
+		LOG_WRN("TX aborted");
+		h4_tx_done(dev);
+		break;
+	case UART_RX_RDY:
+		buf = CONTAINER_OF(evt->data.rx.buf, struct h4_rx_buf, data[0]);
+		atomic_set(&buf->len, evt->data.rx.offset + evt->data.rx.len);
+		k_sem_give(&h4->rx.ready);
+		break;
+	case UART_RX_BUF_REQUEST:
+		/* Without a free buffer reception stops at the end of the
+		 * current one, until the RX thread gives one back.
+		 */
+		if (h4->rx.wr - h4->rx.rd < RX_BUF_COUNT) {
+			buf = &h4->rx.bufs[h4->rx.wr % RX_BUF_COUNT];
+			h4->rx.wr++;
+			(void)uart_rx_buf_rsp(uart, buf->data, sizeof(buf->data));
+		}
+		break;
+	case UART_RX_BUF_RELEASED:
+		buf = CONTAINER_OF(evt->data.rx_buf.buf, struct h4_rx_buf, data[0]);
+		atomic_set(&buf->released, 1);
+		k_sem_give(&h4->rx.ready);
+		break;
+	case UART_RX_STOPPED:
+		LOG_ERR("RX stopped (reason %d)", evt->data.rx_stop.reason);
+		break;
+	case UART_RX_DISABLED:
+		atomic_clear(&h4->rx.enabled);
+		k_sem_give(&h4->rx.ready);
+		break;
+	default:
+		break;
+	}
+}
+
+static int h4_send(const struct device *dev, struct net_buf *buf)
+{
+	struct h4_data *h4 = dev->data;
+
+	LOG_DBG("buf %p type %u len %u", buf, buf->data[0], buf->len);
+
+	k_fifo_put(&h4->tx.fifo, buf);
+	h4_tx_next(dev);
+
+	return 0;
+}
+
+/** Setup the HCI transport, which usually means to reset the Bluetooth IC
+  *
+  * @param dev The device structure for the bus connecting to the IC
+  *
+  * @return 0 on success, negative error value on failure
+  */
+int __weak bt_hci_transport_setup(const struct device *uart)
+{
+	uint8_t c;
+
+	for (int i = 0; (i < 32) && (uart_poll_in(uart, &c) == 0); i++) {
+	}
+
+	return 0;
+}
+
+static int h4_open(const struct device *dev, bt_hci_recv_t recv)
+{
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	int ret;
+	k_tid_t tid;
+
+	LOG_DBG("");
+
+	ret = bt_hci_transport_setup(cfg->uart);
+	if (ret < 0) {
+		return -EIO;
+	}
+
+	ret = uart_callback_set(cfg->uart, bt_uart_callback, (void *)dev);
+	if (ret < 0) {
+		LOG_ERR("UART async API not supported (err %d)", ret);
+		return ret;
+	}
+
+	h4->recv = recv;
+
+	reset_rx(h4);
+	h4->rx.discard = 0U;
+	h4->rx.wr = 0U;
+	h4->rx.rd = 0U;
+	h4->rx.pos = 0U;
+	for (size_t i = 0; i < ARRAY_SIZE(h4->rx.bufs); i++) {
+		atomic_clear(&h4->rx.bufs[i].len);
+		atomic_clear(&h4->rx.bufs[i].released);
+	}
+
+	tid = k_thread_create(cfg->rx_thread, cfg->rx_thread_stack,
+			      cfg->rx_thread_stack_size,
+			      rx_thread, (void *)dev, NULL, NULL,
+			      K_PRIO_COOP(CONFIG_BT_RX_PRIO),
+			      0, K_NO_WAIT);
+	k_thread_name_set(tid, "bt_rx_thread");
+
+	/* Let rx_thread enable reception */
+	k_sem_give(&h4->rx.ready);
+
+	return 0;
+}
+
+int __weak bt_hci_transport_teardown(const struct device *dev)
+{
+	return 0;
+}
+
+static int h4_close(const struct device *dev)
+{
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	int err;
+
+	LOG_DBG("");
+
+	/* Abort RX thread first, so that it does not enable reception again */
+	k_thread_abort(cfg->rx_thread);
+
+	(void)uart_rx_disable(cfg->uart);
+	(void)uart_tx_abort(cfg->uart);
+
+	err = bt_hci_transport_teardown(cfg->uart);
+	if (err < 0) {
+		return err;
+	}
+
+	h4->recv = NULL;
+
+	return 0;
+}
+
+#if defined(CONFIG_BT_HCI_SETUP)
+static int h4_setup(const struct device *dev, const struct bt_hci_setup_params *params)
+{
+	const struct h4_config *cfg = dev->config;
+
+	ARG_UNUSED(params);
+
+	/* Extern bt_h4_vnd_setup function.
+	 * This function executes vendor-specific commands sequence to
+	 * initialize BT Controller before BT Host executes Reset sequence.
+	 * bt_h4_vnd_setup function must be implemented in vendor-specific HCI
+	 * extansion module if CONFIG_BT_HCI_SETUP is enabled.
+	 */
+	extern int bt_h4_vnd_setup(const struct device *dev);
+
+	return bt_h4_vnd_setup(cfg->uart);
+}
+#endif
+
+static DEVICE_API(bt_hci, h4_driver_api) = {
+	.open = h4_open,
+	.send = h4_send,
+	.close = h4_close,
+#if defined(CONFIG_BT_HCI_SETUP)
+	.setup = h4_setup,
+#endif
+};
+
+#define BT_UART_DEVICE_INIT(inst) \
+	static K_KERNEL_STACK_DEFINE(rx_thread_stack_##inst, CONFIG_BT_DRV_RX_STACK_SIZE); \
+	static struct k_thread rx_thread_##inst; \
+	static const struct h4_config h4_config_##inst = { \
+		.uart = DEVICE_DT_GET(DT_INST_PARENT(inst)), \
+		.rx_thread_stack = rx_thread_stack_##inst, \
+		.rx_thread_stack_size = K_KERNEL_STACK_SIZEOF(rx_thread_stack_##inst), \
+		.rx_thread = &rx_thread_##inst, \
+	}; \
+	static struct h4_data h4_data_##inst = { \
+		.rx = { \
+			.ready = Z_SEM_INITIALIZER(h4_data_##inst.rx.ready, 0, 1), \
+		}, \
+		.tx = { \
+			.fifo = Z_FIFO_INITIALIZER(h4_data_##inst.tx.fifo), \
+		}, \
+	}; \
+	DEVICE_DT_INST_DEFINE(inst, NULL, NULL, &h4_data_##inst, &h4_config_##inst, \
+			      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &h4_driver_api)
+
+DT_INST_FOREACH_STATUS_OKAY(BT_UART_DEVICE_INIT)
@@ -77,10 +77,294 @@ int z_impl_can_send(const struct device *dev, const struct can_frame *frame,
 	return api->send(dev, frame, timeout, callback, user_data);
 }
 
+#ifdef CONFIG_CAN_SW_FILTER
+/* Serializes the changes of the filters, which may involve several driver calls */
+static K_MUTEX_DEFINE(can_sw_filter_mutex);
+
+static inline struct can_sw_filters *can_sw_filters_get(const struct device *dev)
+{
+	return &((struct can_driver_data *)dev->data)->sw_filters;
+}
+
+static inline int can_sw_filter_ide(const struct can_filter *filter)
+{
+	return (filter->flags & CAN_FILTER_IDE) != 0U ? 1 : 0;
+}
+
+static inline uint16_t can_sw_filter_hash(uint32_t id, int ide)
+{
+	return (id ^ (id >> 11) ^ (id >> 22) ^ (uint32_t)ide) % CONFIG_CAN_SW_FILTER_HASH_SIZE;
+}
+
+static bool can_sw_filter_match(const struct can_sw_filter *entry, const struct can_frame *frame,
+				int ide)
+{
+	return can_sw_filter_ide(&entry->filter) == ide &&
+	       ((frame->id ^ entry->filter.id) & entry->filter.mask) == 0U;
+}
+
+/* Called for the frames received by the accept-all hardware filters */
+static void can_sw_filter_rx(const struct device *dev, struct can_frame *frame, void *user_data)
+{
+	struct can_sw_filters *sw = can_sw_filters_get(dev);
+	int ide = (frame->flags & CAN_FRAME_IDE) != 0U ? 1 : 0;
+	can_rx_callback_t callback = NULL;
+	void *cb_user_data = NULL;
+	const struct can_sw_filter *entry = NULL;
+	k_spinlock_key_t key;
+	uint16_t next;
+
+	ARG_UNUSED(user_data);
+
+	key = k_spin_lock(&sw->lock);
+
+	/* Single CAN ID filters first, then the masked ones in the order they were added */
+	for (next = sw->buckets[can_sw_filter_hash(frame->id, ide)]; next != 0U;
+	     next = entry->next) {
+		entry = &sw->filters[next - 1U];
+		if (can_sw_filter_match(entry, frame, ide)) {
+			break;
+		}
+	}
+
+	if (next == 0U) {
+		for (next = sw->masked; next != 0U; next = entry->next) {
+			entry = &sw->filters[next - 1U];
+			if (can_sw_filter_match(entry, frame, ide)) {
+				break;
+			}
+		}
+	}
+
+	if (next != 0U) {
+		callback = entry->callback;
+		cb_user_data = entry->user_data;
+	}
+
+	k_spin_unlock(&sw->lock, key);
+
+	if (callback != NULL) {
+		callback(dev, frame, cb_user_data);
+	}
+}
+
+static void can_sw_filter_link(struct can_sw_filters *sw, int index)
+{
+	struct can_sw_filter *entry = &sw->filters[index];
+	uint16_t *head;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&sw->lock);
+
+	if (entry->exact) {
+		head = &sw->buckets[can_sw_filter_hash(entry->filter.id,
+						       can_sw_filter_ide(&entry->filter))];
+	} else {
+		head = &sw->masked;
+	}
+
+	/* Appended, so that the first added filter has precedence */
+	while (*head != 0U) {
+		head = &sw->filters[*head - 1U].next;
+	}
+
+	entry->next = 0U;
+	*head = index + 1U;
+
+	k_spin_unlock(&sw->lock, key);
+}
+
+static void can_sw_filter_unlink(struct can_sw_filters *sw, int index)
+{
+	struct can_sw_filter *entry = &sw->filters[index];
+	uint16_t *head;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&sw->lock);
+
+	if (entry->exact) {
+		head = &sw->buckets[can_sw_filter_hash(entry->filter.id,
+						       can_sw_filter_ide(&entry->filter))];
+	} else {
+		head = &sw->masked;
+	}
+
+	while (*head != 0U && *head != index + 1U) {
+		head = &sw->filters[*head - 1U].next;
+	}
+
+	if (*head != 0U) {
+		*head = entry->next;
+	}
+
+	entry->callback = NULL;
+
+	k_spin_unlock(&sw->lock, key);
+}
+
+/*
+ * Make room for the accept-all filter of the given CAN ID type, by moving one of the
+ * filters installed in the CAN controller to software.
+ */
+static int can_sw_filter_catch_all(const struct device *dev, int ide)
+{
+	const struct can_driver_api *api = dev->api;
+	struct can_sw_filters *sw = can_sw_filters_get(dev);
+	const struct can_filter catch_all = {
+		.id = 0U,
+		.mask = 0U,
+		.flags = ide != 0 ? CAN_FILTER_IDE : 0U,
+	};
+	struct can_sw_filter *evicted = NULL;
+	int ret;
+
+	ARRAY_FOR_EACH_PTR(sw->filters, entry) {
+		if (entry->callback != NULL && entry->in_hw &&
+		    can_sw_filter_ide(&entry->filter) == ide) {
+			evicted = entry;
+			break;
+		}
+	}
+
+	if (evicted == NULL) {
+		return -ENOSPC;
+	}
+
+	/* Already matched in software, in case the accept-all filter takes precedence */
+	api->remove_rx_filter(dev, evicted->hw_id);
+	evicted->in_hw = false;
+
+	ret = api->add_rx_filter(dev, can_sw_filter_rx, NULL, &catch_all);
+	if (ret < 0) {
+		ret = api->add_rx_filter(dev, evicted->callback, evicted->user_data,
+					 &evicted->filter);
+		if (ret >= 0) {
+			evicted->hw_id = ret;
+			evicted->in_hw = true;
+		}
+
+		LOG_ERR("failed to add accept-all filter (err %d)", ret);
+		return -ENOSPC;
+	}
+
+	sw->catch_all_id[ide] = ret;
+	sw->catch_all[ide] = true;
+
+	return 0;
+}
+
+static int can_sw_filter_add(const struct device *dev, can_rx_callback_t callback,
+			     void *user_data, const struct can_filter *filter)
+{
+	const struct can_driver_api *api = dev->api;
+	struct can_sw_filters *sw = can_sw_filters_get(dev);
+	int ide = can_sw_filter_ide(filter);
+	struct can_sw_filter *entry = NULL;
+	int index;
+	int ret;
+
+	k_mutex_lock(&can_sw_filter_mutex, K_FOREVER);
+
+	for (index = 0; index < (int)ARRAY_SIZE(sw->filters); index++) {
+		if (sw->filters[index].callback == NULL) {
+			entry = &sw->filters[index];
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		ret = -ENOSPC;
+		goto unlock;
+	}
+
+	ret = api->add_rx_filter(dev, callback, user_data, filter);
+	if (ret == -ENOSPC && (sw->catch_all[ide] || can_sw_filter_catch_all(dev, ide) == 0)) {
+		/* Only matched in software */
+		entry->in_hw = false;
+	} else if (ret < 0) {
+		goto unlock;
+	} else {
+		entry->hw_id = ret;
+		entry->in_hw = true;
+	}
+
+	entry->filter = *filter;
+	entry->user_data = user_data;
+	entry->exact = filter->mask == (ide != 0 ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK);
+	entry->callback = callback;
+	can_sw_filter_link(sw, index);
+	ret = index;
+
+unlock:
+	k_mutex_unlock(&can_sw_filter_mutex);
+
+	return ret;
+}
+
+void z_impl_can_remove_rx_filter(const struct device *dev, int filter_id)
+{
+	const struct can_driver_api *api = dev->api;
+	struct can_sw_filters *sw = can_sw_filters_get(dev);
+	struct can_sw_filter *entry;
+	bool in_sw = false;
+	int ide;
+	int ret;
+
+	if (filter_id < 0 || filter_id >= (int)ARRAY_SIZE(sw->filters)) {
+		return;
+	}
+
+	k_mutex_lock(&can_sw_filter_mutex, K_FOREVER);
+
+	entry = &sw->filters[filter_id];
+	if (entry->callback == NULL) {
+		goto unlock;
+	}
+
+	ide = can_sw_filter_ide(&entry->filter);
+	can_sw_filter_unlink(sw, filter_id);
+
+	if (entry->in_hw) {
+		api->remove_rx_filter(dev, entry->hw_id);
+	}
+
+	if (!sw->catch_all[ide]) {
+		goto unlock;
+	}
+
+	/* Move the filters only matched in software back to the freed hardware filters */
+	ARRAY_FOR_EACH_PTR(sw->filters, other) {
+		if (other->callback == NULL || other->in_hw ||
+		    can_sw_filter_ide(&other->filter) != ide) {
+			continue;
+		}
+
+		ret = api->add_rx_filter(dev, other->callback, other->user_data, &other->filter);
+		if (ret < 0) {
+			in_sw = true;
+			break;
+		}
+
+		other->hw_id = ret;
+		other->in_hw = true;
+	}
+
+	if (!in_sw) {
+		api->remove_rx_filter(dev, sw->catch_all_id[ide]);
+		sw->catch_all[ide] = false;
+	}
+
+unlock:
+	k_mutex_unlock(&can_sw_filter_mutex);
+}
+#endif /* CONFIG_CAN_SW_FILTER */
+
 int can_add_rx_filter(const struct device *dev, can_rx_callback_t callback,
 		      void *user_data, const struct can_filter *filter)
 {
+#ifndef CONFIG_CAN_SW_FILTER
 	const struct can_driver_api *api = (const struct can_driver_api *)dev->api;
+#endif /* !CONFIG_CAN_SW_FILTER */
 	uint32_t id_mask;
 
 	CHECKIF(callback == NULL || filter == NULL) {
@@ -102,7 +386,11 @@ int can_add_rx_filter(const struct device *dev, can_rx_callback_t callback,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_CAN_SW_FILTER
+	return can_sw_filter_add(dev, callback, user_data, filter);
+#else
 	return api->add_rx_filter(dev, callback, user_data, filter);
+#endif /* CONFIG_CAN_SW_FILTER */
 }
 
 static void can_msgq_put(const struct device *dev, struct can_frame *frame, void *user_data)
@@ -123,9 +411,13 @@ static void can_msgq_put(const struct device *dev, struct can_frame *frame, void
 int z_impl_can_add_rx_filter_msgq(const struct device *dev, struct k_msgq *msgq,
 				  const struct can_filter *filter)
 {
+#ifdef CONFIG_CAN_SW_FILTER
+	return can_sw_filter_add(dev, can_msgq_put, msgq, filter);
+#else
 	const struct can_driver_api *api = dev->api;
 
 	return api->add_rx_filter(dev, can_msgq_put, msgq, filter);
+#endif /* CONFIG_CAN_SW_FILTER */
 }
 
 /**
@@ -0,0 +1,76 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/crypto/crypto.h>
+#include <zephyr/crypto/crypto_rtio.h>
+#include <zephyr/rtio/work.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(crypto_rtio, CONFIG_CRYPTO_LOG_LEVEL);
+
+static int crypto_rtio_aead(struct cipher_ctx *ctx, struct cipher_aead_pkt *pkt, uint8_t *nonce)
+{
+	int rc;
+
+	if ((ctx->flags & CAP_SYNC_OPS) == 0U) {
+		/* The driver would complete the operation through its own callback */
+		return -ENOTSUP;
+	}
+
+	switch (ctx->ops.cipher_mode) {
+	case CRYPTO_CIPHER_MODE_CCM:
+		rc = cipher_ccm_op(ctx, pkt, nonce);
+		break;
+	case CRYPTO_CIPHER_MODE_GCM:
+		rc = cipher_gcm_op(ctx, pkt, nonce);
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	return (rc < 0) ? rc : pkt->pkt->out_len;
+}
+
+static void crypto_rtio_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	struct cipher_ctx *ctx = sqe->iodev->data;
+	int rc;
+
+	switch (sqe->op) {
+	case RTIO_OP_CRYPTO_AEAD:
+		rc = crypto_rtio_aead(ctx, sqe->crypto_aead.pkt, sqe->crypto_aead.nonce);
+		break;
+	default:
+		rc = -ENOTSUP;
+		break;
+	}
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, rc);
+	}
+}
+
+static void crypto_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		LOG_ERR("RTIO work item allocation failed. Consider to increase "
+			"CONFIG_RTIO_WORKQ_POOL_ITEMS.");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, crypto_rtio_submit_sync);
+}
+
+const struct rtio_iodev_api crypto_rtio_iodev_api = {
+	.submit = crypto_rtio_submit,
+};
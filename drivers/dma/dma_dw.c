@@ -52,6 +52,7 @@ static DEVICE_API(dma, dw_dma_driver_api) = {
 	.config = dw_dma_config,
 	.start = dw_dma_start,
 	.stop = dw_dma_stop,
+	.get_attribute = dw_dma_get_attribute,
 };
 
 #define DW_DMAC_INIT(inst)						\
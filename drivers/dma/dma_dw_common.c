@@ -851,3 +851,16 @@ int dw_dma_get_status(const struct device *dev, uint32_t channel,
 #endif
 	return 0;
 }
+
+int dw_dma_get_attribute(const struct device *dev, uint32_t type, uint32_t *value)
+{
+	switch (type) {
+	case DMA_ATTR_MAX_BLOCK_COUNT:
+		*value = CONFIG_DMA_DW_LLI_POOL_SIZE;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
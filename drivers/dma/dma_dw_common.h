@@ -289,6 +289,8 @@ void dw_dma_isr(const struct device *dev);
 int dw_dma_get_status(const struct device *dev, uint32_t channel,
 		      struct dma_status *stat);
 
+int dw_dma_get_attribute(const struct device *dev, uint32_t type, uint32_t *value);
+
 #ifdef __cplusplus
 }
 #endif
@@ -827,6 +827,21 @@ static bool dma_mcux_edma_channel_filter(const struct device *dev,
 	return true;
 }
 
+static int dma_mcux_edma_get_attribute(const struct device *dev, uint32_t type,
+				       uint32_t *value)
+{
+	switch (type) {
+	case DMA_ATTR_MAX_BLOCK_COUNT:
+		/* Scatter-gather lists are limited by the TCD pool of a channel */
+		*value = CONFIG_DMA_TCD_QUEUE_SIZE;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 static DEVICE_API(dma, dma_mcux_edma_api) = {
 	.reload = dma_mcux_edma_reload,
 	.config = dma_mcux_edma_configure,
@@ -836,6 +851,7 @@ static DEVICE_API(dma, dma_mcux_edma_api) = {
 	.resume = dma_mcux_edma_resume,
 	.get_status = dma_mcux_edma_get_status,
 	.chan_filter = dma_mcux_edma_channel_filter,
+	.get_attribute = dma_mcux_edma_get_attribute,
 };
 
 static int dma_mcux_edma_init(const struct device *dev)
@@ -100,9 +100,13 @@ struct nxp_enet_mac_data {
 	uint8_t mac_addr[6];
 	enet_handle_t enet_handle;
 	struct k_sem tx_buf_sem;
+#if defined(CONFIG_ETH_NXP_ENET_NAPI)
+	struct net_eth_napi napi;
+#else
 	struct k_work rx_work;
-	const struct device *dev;
 	struct k_sem rx_thread_sem;
+#endif
+	const struct device *dev;
 	struct k_mutex tx_frame_buf_mutex;
 	struct k_mutex rx_frame_buf_mutex;
 #ifdef CONFIG_PTP_CLOCK_NXP_ENET
@@ -112,6 +116,7 @@ struct nxp_enet_mac_data {
 	uint8_t *rx_frame_buf;
 };
 
+#if !defined(CONFIG_ETH_NXP_ENET_NAPI)
 static K_THREAD_STACK_DEFINE(enet_rx_stack, CONFIG_ETH_NXP_ENET_RX_THREAD_STACK_SIZE);
 static struct k_work_q rx_work_queue;
 
@@ -129,6 +134,7 @@ static int rx_queue_init(void)
 }
 
 SYS_INIT(rx_queue_init, POST_KERNEL, 0);
+#endif /* !CONFIG_ETH_NXP_ENET_NAPI */
 
 static inline struct net_if *get_iface(struct nxp_enet_mac_data *data)
 {
@@ -440,6 +446,28 @@ error:
 	return -EIO;
 }
 
+#if defined(CONFIG_ETH_NXP_ENET_NAPI)
+static int eth_nxp_enet_rx_poll(struct net_eth_napi *napi, int budget)
+{
+	struct nxp_enet_mac_data *data =
+		CONTAINER_OF(napi, struct nxp_enet_mac_data, napi);
+	int count = 0;
+
+	while (count < budget && eth_nxp_enet_rx(data->dev) == 1) {
+		count++;
+	}
+
+	return count;
+}
+
+static void eth_nxp_enet_rx_irq_enable(struct net_eth_napi *napi)
+{
+	struct nxp_enet_mac_data *data =
+		CONTAINER_OF(napi, struct nxp_enet_mac_data, napi);
+
+	ENET_EnableInterrupts(data->base, kENET_RxFrameInterrupt);
+}
+#else
 static void eth_nxp_enet_rx_thread(struct k_work *work)
 {
 	struct nxp_enet_mac_data *data =
@@ -457,6 +485,7 @@ static void eth_nxp_enet_rx_thread(struct k_work *work)
 
 	ENET_EnableInterrupts(data->base, kENET_RxFrameInterrupt);
 }
+#endif /* CONFIG_ETH_NXP_ENET_NAPI */
 
 static int nxp_enet_phy_configure(const struct device *phy, uint8_t phy_mode)
 {
@@ -585,7 +614,9 @@ static void eth_callback(ENET_Type *base, enet_handle_t *handle,
 
 	switch (event) {
 	case kENET_RxEvent:
+#if !defined(CONFIG_ETH_NXP_ENET_NAPI)
 		k_sem_give(&data->rx_thread_sem);
+#endif
 		break;
 	case kENET_TxEvent:
 		ts_register_tx_event(dev, frameinfo);
@@ -617,7 +648,11 @@ static void eth_nxp_enet_isr(const struct device *dev)
 	if (eir & (kENET_RxFrameInterrupt)) {
 		ENET_ReceiveIRQHandler(ENET_IRQ_HANDLER_ARGS(data->base, &data->enet_handle));
 		ENET_DisableInterrupts(data->base, kENET_RxFrameInterrupt);
+#if defined(CONFIG_ETH_NXP_ENET_NAPI)
+		net_eth_napi_schedule(&data->napi);
+#else
 		k_work_submit_to_queue(&rx_work_queue, &data->rx_work);
+#endif
 	}
 
 	if (eir & kENET_TxFrameInterrupt) {
@@ -709,13 +744,19 @@ static int eth_nxp_enet_init(const struct device *dev)
 
 	k_mutex_init(&data->rx_frame_buf_mutex);
 	k_mutex_init(&data->tx_frame_buf_mutex);
+#if !defined(CONFIG_ETH_NXP_ENET_NAPI)
 	k_sem_init(&data->rx_thread_sem, 0, CONFIG_ETH_NXP_ENET_RX_BUFFERS);
+#endif
 	k_sem_init(&data->tx_buf_sem,
 		   CONFIG_ETH_NXP_ENET_TX_BUFFERS, CONFIG_ETH_NXP_ENET_TX_BUFFERS);
 #if defined(CONFIG_PTP_CLOCK_NXP_ENET)
 	k_sem_init(&data->ptp.ptp_ts_sem, 0, 1);
 #endif
+#if defined(CONFIG_ETH_NXP_ENET_NAPI)
+	net_eth_napi_init(&data->napi, eth_nxp_enet_rx_poll, eth_nxp_enet_rx_irq_enable);
+#else
 	k_work_init(&data->rx_work, eth_nxp_enet_rx_thread);
+#endif
 
 	switch (config->mac_addr_source) {
 	case MAC_ADDR_SOURCE_LOCAL:
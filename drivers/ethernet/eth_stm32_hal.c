@@ -643,6 +643,43 @@ out:
 	return pkt;
 }
 
+#if defined(CONFIG_ETH_STM32_HAL_NAPI)
+static int eth_stm32_rx_poll(struct net_eth_napi *napi, int budget)
+{
+	struct eth_stm32_hal_dev_data *dev_data =
+		CONTAINER_OF(napi, struct eth_stm32_hal_dev_data, napi);
+	const struct device *dev = net_if_get_device(dev_data->iface);
+	struct net_if *iface;
+	struct net_pkt *pkt;
+	int count = 0;
+	int res;
+
+	while (count < budget && (pkt = eth_rx(dev)) != NULL) {
+		iface = net_pkt_iface(pkt);
+#if defined(CONFIG_NET_DSA_DEPRECATED)
+		iface = dsa_net_recv(iface, &pkt);
+#endif
+		res = net_recv_data(iface, pkt);
+		if (res < 0) {
+			eth_stats_update_errors_rx(net_pkt_iface(pkt));
+			LOG_ERR("Failed to enqueue frame into RX queue: %d", res);
+			net_pkt_unref(pkt);
+		}
+
+		count++;
+	}
+
+	return count;
+}
+
+static void eth_stm32_rx_irq_enable(struct net_eth_napi *napi)
+{
+	struct eth_stm32_hal_dev_data *dev_data =
+		CONTAINER_OF(napi, struct eth_stm32_hal_dev_data, napi);
+
+	__HAL_ETH_DMA_ENABLE_IT(&dev_data->heth, ETH_DMA_RX_IT);
+}
+#else
 static void rx_thread(void *arg1, void *unused1, void *unused2)
 {
 	const struct device *dev = (const struct device *)arg1;
@@ -675,6 +712,7 @@ static void rx_thread(void *arg1, void *unused1, void *unused2)
 		}
 	}
 }
+#endif /* CONFIG_ETH_STM32_HAL_NAPI */
 
 static void eth_isr(const struct device *dev)
 {
@@ -790,7 +828,13 @@ void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth_handle)
 
 	__ASSERT_NO_MSG(dev_data != NULL);
 
+#if defined(CONFIG_ETH_STM32_HAL_NAPI)
+	/* Further frames are polled until the ring is drained */
+	__HAL_ETH_DMA_DISABLE_IT(heth_handle, ETH_DMA_RX_IT);
+	net_eth_napi_schedule(&dev_data->napi);
+#else
 	k_sem_give(&dev_data->rx_int_sem);
+#endif
 }
 
 static void generate_mac(uint8_t *mac_addr)
@@ -1024,7 +1068,11 @@ static int eth_init_api_v2(const struct device *dev)
 
 	/* Initialize semaphores */
 	k_mutex_init(&dev_data->tx_mutex);
+#if defined(CONFIG_ETH_STM32_HAL_NAPI)
+	net_eth_napi_init(&dev_data->napi, eth_stm32_rx_poll, eth_stm32_rx_irq_enable);
+#else
 	k_sem_init(&dev_data->rx_int_sem, 0, K_SEM_MAX_LIMIT);
+#endif
 	k_sem_init(&dev_data->tx_int_sem, 0, K_SEM_MAX_LIMIT);
 
 	/* Tx config init: */
@@ -1190,6 +1238,7 @@ static void eth_iface_init(struct net_if *iface)
 		__ASSERT_NO_MSG(cfg->config_func != NULL);
 		cfg->config_func();
 
+#if !defined(CONFIG_ETH_STM32_HAL_NAPI)
 		/* Start interruption-poll thread */
 		k_thread_create(&dev_data->rx_thread, dev_data->rx_thread_stack,
 				K_KERNEL_STACK_SIZEOF(dev_data->rx_thread_stack),
@@ -1200,6 +1249,7 @@ static void eth_iface_init(struct net_if *iface)
 				0, K_NO_WAIT);
 
 		k_thread_name_set(&dev_data->rx_thread, "stm_eth");
+#endif /* !CONFIG_ETH_STM32_HAL_NAPI */
 	}
 }
 
@@ -47,13 +47,17 @@ struct eth_stm32_hal_dev_data {
 	uint8_t mac_addr[6];
 	ETH_HandleTypeDef heth;
 	struct k_mutex tx_mutex;
-	struct k_sem rx_int_sem;
 #if defined(CONFIG_ETH_STM32_HAL_API_V2)
 	struct k_sem tx_int_sem;
 #endif /* CONFIG_ETH_STM32_HAL_API_V2 */
+#if defined(CONFIG_ETH_STM32_HAL_NAPI)
+	struct net_eth_napi napi;
+#else
+	struct k_sem rx_int_sem;
 	K_KERNEL_STACK_MEMBER(rx_thread_stack,
 		CONFIG_ETH_STM32_HAL_RX_THREAD_STACK_SIZE);
 	struct k_thread rx_thread;
+#endif /* CONFIG_ETH_STM32_HAL_NAPI */
 #if defined(CONFIG_ETH_STM32_MULTICAST_FILTER)
 	uint8_t hash_index_cnt[64];
 #endif /* CONFIG_ETH_STM32_MULTICAST_FILTER */
@@ -104,6 +104,37 @@ static int w5500_spi_write(const struct device *dev, uint32_t addr,
 	return ret;
 }
 
+/* Fragments of a packet written to the chip without copying it */
+#define W5500_TX_IOV_MAX 8
+
+static int w5500_spi_write_iov(const struct device *dev, uint32_t addr,
+			       const struct net_buf_iov *iov, size_t iov_count)
+{
+	const struct w5500_config *cfg = dev->config;
+	uint8_t cmd[3] = {
+		addr >> 8,
+		addr,
+		W5500_SPI_WRITE_CONTROL(addr),
+	};
+	struct spi_buf tx_buf[1 + W5500_TX_IOV_MAX] = {
+		{
+			.buf = cmd,
+			.len = ARRAY_SIZE(cmd),
+		},
+	};
+	const struct spi_buf_set tx = {
+		.buffers = tx_buf,
+		.count = 1 + iov_count,
+	};
+
+	for (size_t i = 0; i < iov_count; i++) {
+		tx_buf[1 + i].buf = iov[i].base;
+		tx_buf[1 + i].len = iov[i].len;
+	}
+
+	return spi_write_dt(&cfg->spi, &tx);
+}
+
 static int w5500_readbuf(const struct device *dev, uint16_t offset, uint8_t *buf,
 			 size_t len)
 {
@@ -154,6 +185,43 @@ static int w5500_writebuf(const struct device *dev, uint16_t offset, uint8_t *bu
 	return w5500_spi_write(dev, mem_start, buf + len, remain);
 }
 
+/* Write the fragments of a packet, -ENOBUFS if it has too many of them */
+static int w5500_writepkt(const struct device *dev, uint16_t offset,
+			  struct net_pkt *pkt, size_t len)
+{
+	struct net_buf_iov iov[W5500_TX_IOV_MAX];
+	uint32_t addr;
+	size_t remain = 0;
+	int ret;
+	const uint32_t mem_start = W5500_Sn_TX_MEM_START;
+	const uint32_t mem_size = W5500_TX_MEM_SIZE;
+
+	offset %= mem_size;
+	addr = mem_start + offset;
+
+	if (offset + len > mem_size) {
+		remain = (offset + len) % mem_size;
+		len = mem_size - offset;
+	}
+
+	ret = net_buf_iov_export(pkt->buffer, 0, len, iov, ARRAY_SIZE(iov));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = w5500_spi_write_iov(dev, addr, iov, ret);
+	if (ret || !remain) {
+		return ret;
+	}
+
+	ret = net_buf_iov_export(pkt->buffer, len, remain, iov, ARRAY_SIZE(iov));
+	if (ret < 0) {
+		return ret;
+	}
+
+	return w5500_spi_write_iov(dev, mem_start, iov, ret);
+}
+
 static int w5500_command(const struct device *dev, uint8_t cmd)
 {
 	uint8_t reg;
@@ -184,11 +252,16 @@ static int w5500_tx(const struct device *dev, struct net_pkt *pkt)
 	w5500_spi_read(dev, W5500_S0_TX_WR, off, 2);
 	offset = sys_get_be16(off);
 
-	if (net_pkt_read(pkt, ctx->buf, len)) {
-		return -EIO;
+	/* The fragments are written as they are, unless there are too many */
+	ret = w5500_writepkt(dev, offset, pkt, len);
+	if (ret == -ENOBUFS) {
+		if (net_pkt_read(pkt, ctx->buf, len)) {
+			return -EIO;
+		}
+
+		ret = w5500_writebuf(dev, offset, ctx->buf, len);
 	}
 
-	ret = w5500_writebuf(dev, offset, ctx->buf, len);
 	if (ret < 0) {
 		return ret;
 	}
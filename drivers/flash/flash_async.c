@@ -0,0 +1,99 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
+
+enum flash_async_type {
+	FLASH_ASYNC_READ,
+	FLASH_ASYNC_WRITE,
+	FLASH_ASYNC_ERASE,
+};
+
+static K_FIFO_DEFINE(flash_async_fifo);
+
+static int flash_async_queue(const struct device *dev, struct flash_async_op *op,
+			     uint8_t type, off_t offset, size_t len,
+			     flash_async_cb_t cb, void *user_data)
+{
+	if (!device_is_ready(dev)) {
+		return -ENODEV;
+	}
+
+	op->dev = dev;
+	op->type = type;
+	op->offset = offset;
+	op->len = len;
+	op->cb = cb;
+	op->user_data = user_data;
+
+	k_fifo_put(&flash_async_fifo, op);
+
+	return 0;
+}
+
+int flash_read_async(const struct device *dev, off_t offset, void *data, size_t len,
+		     struct flash_async_op *op, flash_async_cb_t cb, void *user_data)
+{
+	op->data = data;
+
+	return flash_async_queue(dev, op, FLASH_ASYNC_READ, offset, len, cb, user_data);
+}
+
+int flash_write_async(const struct device *dev, off_t offset, const void *data, size_t len,
+		      struct flash_async_op *op, flash_async_cb_t cb, void *user_data)
+{
+	op->cdata = data;
+
+	return flash_async_queue(dev, op, FLASH_ASYNC_WRITE, offset, len, cb, user_data);
+}
+
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_op *op, flash_async_cb_t cb, void *user_data)
+{
+	op->data = NULL;
+
+	return flash_async_queue(dev, op, FLASH_ASYNC_ERASE, offset, size, cb, user_data);
+}
+
+static void flash_async_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct flash_async_op *op = k_fifo_get(&flash_async_fifo, K_FOREVER);
+		/* Copy what the callback needs, it may reuse the operation. */
+		const struct device *dev = op->dev;
+		flash_async_cb_t cb = op->cb;
+		void *user_data = op->user_data;
+		int ret;
+
+		switch (op->type) {
+		case FLASH_ASYNC_READ:
+			ret = flash_read(dev, op->offset, op->data, op->len);
+			break;
+		case FLASH_ASYNC_WRITE:
+			ret = flash_write(dev, op->offset, op->cdata, op->len);
+			break;
+		case FLASH_ASYNC_ERASE:
+			ret = flash_erase(dev, op->offset, op->len);
+			break;
+		default:
+			ret = -EINVAL;
+			break;
+		}
+
+		if (cb != NULL) {
+			cb(dev, ret, user_data);
+		}
+	}
+}
+
+K_THREAD_DEFINE(flash_async, CONFIG_FLASH_ASYNC_THREAD_STACK_SIZE, flash_async_thread,
+		NULL, NULL, NULL, CONFIG_FLASH_ASYNC_THREAD_PRIORITY, 0, 0);
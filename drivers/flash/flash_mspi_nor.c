@@ -113,26 +113,20 @@ static inline uint16_t dev_page_size(const struct device *dev)
 	return SPI_NOR_PAGE_SIZE;
 }
 
-static int api_read(const struct device *dev, off_t addr, void *dest,
-		    size_t size)
+/* In octal DTR mode data is transferred in 16-bit words. */
+static inline bool is_octal_dtr(const struct device *dev)
 {
 	const struct flash_mspi_nor_config *dev_config = dev->config;
-	struct flash_mspi_nor_data *dev_data = dev->data;
-	const uint32_t flash_size = dev_flash_size(dev);
-	int rc;
-
-	if (size == 0) {
-		return 0;
-	}
 
-	if ((addr < 0) || ((addr + size) > flash_size)) {
-		return -EINVAL;
-	}
+	return (dev_config->mspi_nor_cfg.io_mode == MSPI_IO_MODE_OCTAL) &&
+	       (dev_config->mspi_nor_cfg.data_rate == MSPI_DATA_RATE_DUAL);
+}
 
-	rc = acquire(dev);
-	if (rc < 0) {
-		return rc;
-	}
+static int read_xfer(const struct device *dev, off_t addr, void *dest, size_t size)
+{
+	const struct flash_mspi_nor_config *dev_config = dev->config;
+	struct flash_mspi_nor_data *dev_data = dev->data;
+	int rc;
 
 	if (dev_config->jedec_cmds->read.force_single) {
 		rc = dev_cfg_apply(dev, &dev_config->mspi_nor_init_cfg);
@@ -151,21 +145,168 @@ static int api_read(const struct device *dev, off_t addr, void *dest,
 	dev_data->packet.num_bytes = size;
 	rc = mspi_transceive(dev_config->bus, &dev_config->mspi_id,
 			     &dev_data->xfer);
+	if (rc < 0) {
+		LOG_ERR("Read xfer failed: %d", rc);
+	}
 
-	release(dev);
+	return rc;
+}
+
+static int read_data(const struct device *dev, off_t addr, uint8_t *dest, size_t size)
+{
+	uint8_t word[2];
+	int rc;
+
+	if (!is_octal_dtr(dev)) {
+		return read_xfer(dev, addr, dest, size);
+	}
+
+	/* Read the unaligned first and last bytes as whole words. */
+	if (addr & 1) {
+		rc = read_xfer(dev, addr - 1, word, sizeof(word));
+		if (rc < 0) {
+			return rc;
+		}
+
+		*dest++ = word[1];
+		addr++;
+		size--;
+	}
+
+	if (size >= sizeof(word)) {
+		rc = read_xfer(dev, addr, dest, size & ~1);
+		if (rc < 0) {
+			return rc;
+		}
+
+		dest += size & ~1;
+		addr += size & ~1;
+		size &= 1;
+	}
+
+	if (size) {
+		rc = read_xfer(dev, addr, word, sizeof(word));
+		if (rc < 0) {
+			return rc;
+		}
+
+		*dest = word[0];
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_FLASH_MSPI_NOR_READ_CACHE)
+#define CACHE_LINE_SIZE CONFIG_FLASH_MSPI_NOR_READ_CACHE_LINE_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CACHE_LINE_SIZE) && (CACHE_LINE_SIZE >= 2),
+	     "Cache line size must be a power of two");
+
+static int cache_read(const struct device *dev, off_t addr, uint8_t *dest, size_t size)
+{
+	struct flash_mspi_nor_data *dev_data = dev->data;
+
+	if (size > CACHE_LINE_SIZE) {
+		return read_data(dev, addr, dest, size);
+	}
+
+	while (size > 0) {
+		uint32_t line_addr = ROUND_DOWN(addr, CACHE_LINE_SIZE);
+		size_t offset = addr - line_addr;
+		size_t len = MIN(size, CACHE_LINE_SIZE - offset);
+		struct flash_mspi_nor_cache_line *line = NULL;
+
+		for (size_t i = 0; i < ARRAY_SIZE(dev_data->cache); i++) {
+			if (dev_data->cache[i].valid && dev_data->cache[i].addr == line_addr) {
+				line = &dev_data->cache[i];
+				break;
+			}
+		}
+
+		if (line == NULL) {
+			int rc;
+
+			line = &dev_data->cache[dev_data->cache_victim];
+			dev_data->cache_victim = (dev_data->cache_victim + 1) %
+						 ARRAY_SIZE(dev_data->cache);
+
+			line->valid = false;
+			rc = read_xfer(dev, line_addr, line->buf, CACHE_LINE_SIZE);
+			if (rc < 0) {
+				return rc;
+			}
+
+			line->addr = line_addr;
+			line->valid = true;
+		}
+
+		memcpy(dest, &line->buf[offset], len);
+		dest += len;
+		addr += len;
+		size -= len;
+	}
+
+	return 0;
+}
+
+static void cache_invalidate(const struct device *dev, off_t addr, size_t size)
+{
+	struct flash_mspi_nor_data *dev_data = dev->data;
+
+	for (size_t i = 0; i < ARRAY_SIZE(dev_data->cache); i++) {
+		struct flash_mspi_nor_cache_line *line = &dev_data->cache[i];
+
+		if (line->valid && (line->addr < addr + size) &&
+		    (addr < line->addr + CACHE_LINE_SIZE)) {
+			line->valid = false;
+		}
+	}
+}
+#else
+static inline int cache_read(const struct device *dev, off_t addr, uint8_t *dest, size_t size)
+{
+	return read_data(dev, addr, dest, size);
+}
+
+static inline void cache_invalidate(const struct device *dev, off_t addr, size_t size)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(addr);
+	ARG_UNUSED(size);
+}
+#endif /* CONFIG_FLASH_MSPI_NOR_READ_CACHE */
 
+static int api_read(const struct device *dev, off_t addr, void *dest,
+		    size_t size)
+{
+	const uint32_t flash_size = dev_flash_size(dev);
+	int rc;
+
+	if (size == 0) {
+		return 0;
+	}
+
+	if ((addr < 0) || ((addr + size) > flash_size)) {
+		return -EINVAL;
+	}
+
+	rc = acquire(dev);
 	if (rc < 0) {
-		LOG_ERR("Read xfer failed: %d", rc);
 		return rc;
 	}
 
-	return 0;
+	rc = cache_read(dev, addr, dest, size);
+
+	release(dev);
+
+	return rc < 0 ? rc : 0;
 }
 
 static int status_get(const struct device *dev, uint8_t *status)
 {
 	const struct flash_mspi_nor_config *dev_config = dev->config;
 	struct flash_mspi_nor_data *dev_data = dev->data;
+	uint8_t reg[2];
 	int rc;
 
 	/* Enter command mode */
@@ -181,8 +322,8 @@ static int status_get(const struct device *dev, uint8_t *status)
 	}
 
 	flash_mspi_command_set(dev, &dev_config->jedec_cmds->status);
-	dev_data->packet.data_buf  = status;
-	dev_data->packet.num_bytes = sizeof(uint8_t);
+	dev_data->packet.data_buf  = reg;
+	dev_data->packet.num_bytes = is_octal_dtr(dev) ? sizeof(reg) : sizeof(uint8_t);
 
 	rc = mspi_transceive(dev_config->bus, &dev_config->mspi_id, &dev_data->xfer);
 
@@ -191,6 +332,8 @@ static int status_get(const struct device *dev, uint8_t *status)
 		return rc;
 	}
 
+	*status = reg[0];
+
 	return rc;
 }
 
@@ -254,11 +397,17 @@ static int api_write(const struct device *dev, off_t addr, const void *src,
 		return -EINVAL;
 	}
 
+	if (is_octal_dtr(dev) && ((addr & 1) || (size & 1))) {
+		return -EINVAL;
+	}
+
 	rc = acquire(dev);
 	if (rc < 0) {
 		return rc;
 	}
 
+	cache_invalidate(dev, addr, size);
+
 	while (size > 0) {
 		/* Split write into parts, each within one page only. */
 		uint16_t page_offset = (uint16_t)(addr % page_size);
@@ -330,6 +479,8 @@ static int api_erase(const struct device *dev, off_t addr, size_t size)
 		return rc;
 	}
 
+	cache_invalidate(dev, addr, size);
+
 	while (size > 0) {
 		rc = write_enable(dev);
 		if (rc < 0) {
@@ -390,14 +541,16 @@ static int api_erase(const struct device *dev, off_t addr, size_t size)
 static const
 struct flash_parameters *api_get_parameters(const struct device *dev)
 {
-	ARG_UNUSED(dev);
-
 	static const struct flash_parameters parameters = {
 		.write_block_size = 1,
 		.erase_value = 0xff,
 	};
+	static const struct flash_parameters parameters_dtr = {
+		.write_block_size = 2,
+		.erase_value = 0xff,
+	};
 
-	return &parameters;
+	return is_octal_dtr(dev) ? &parameters_dtr : &parameters;
 }
 
 static int read_jedec_id(const struct device *dev, uint8_t *id)
@@ -693,7 +846,7 @@ static int flash_chip_init(const struct device *dev)
 	/* Reading JEDEC ID for mode that forces single lane would be redundant,
 	 * since it switches back to single lane mode. Use ID from previous read.
 	 */
-	if (!dev_config->jedec_cmds->id.force_single) {
+	if (!dev_config->jedec_cmds->id.force_single && !is_octal_dtr(dev)) {
 		rc = read_jedec_id(dev, id);
 		if (rc < 0) {
 			LOG_ERR("Failed to read JEDEC ID in final line mode: %d", rc);
@@ -860,6 +1013,15 @@ BUILD_ASSERT((FLASH_SIZE_INST(inst) % CONFIG_FLASH_MSPI_NOR_LAYOUT_PAGE_SIZE) ==
 		     (DT_INST_ENUM_IDX(inst, mspi_io_mode) ==			\
 		      MSPI_IO_MODE_OCTAL),					\
 		"Only 1x, 1-4-4 and 8x I/O modes are supported for now");	\
+	BUILD_ASSERT((DT_INST_ENUM_IDX_OR(inst, mspi_data_rate,			\
+					  MSPI_DATA_RATE_SINGLE) ==		\
+		      MSPI_DATA_RATE_SINGLE) ||					\
+		     ((DT_INST_ENUM_IDX_OR(inst, mspi_data_rate,		\
+					   MSPI_DATA_RATE_SINGLE) ==		\
+		       MSPI_DATA_RATE_DUAL) &&					\
+		      (DT_INST_ENUM_IDX(inst, mspi_io_mode) ==			\
+		       MSPI_IO_MODE_OCTAL)),					\
+		"DTR is only supported in 8x I/O mode");			\
 	PM_DEVICE_DT_INST_DEFINE(inst, dev_pm_action_cb);			\
 	static struct flash_mspi_nor_data dev##inst##_data;			\
 	static const struct flash_mspi_nor_config dev##inst##_config = {	\
@@ -44,11 +44,23 @@ struct flash_mspi_nor_config {
 	uint8_t dw15_qer;
 };
 
+#if defined(CONFIG_FLASH_MSPI_NOR_READ_CACHE)
+struct flash_mspi_nor_cache_line {
+	uint32_t addr;
+	bool valid;
+	uint8_t buf[CONFIG_FLASH_MSPI_NOR_READ_CACHE_LINE_SIZE];
+};
+#endif
+
 struct flash_mspi_nor_data {
 	struct k_sem acquired;
 	struct mspi_xfer_packet packet;
 	struct mspi_xfer xfer;
 	struct mspi_dev_cfg *curr_cfg;
+#if defined(CONFIG_FLASH_MSPI_NOR_READ_CACHE)
+	struct flash_mspi_nor_cache_line cache[CONFIG_FLASH_MSPI_NOR_READ_CACHE_LINES];
+	uint8_t cache_victim;
+#endif
 };
 
 struct flash_mspi_nor_cmd {
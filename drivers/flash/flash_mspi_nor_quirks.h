@@ -139,8 +139,10 @@ struct flash_mspi_nor_quirks flash_quirks_mxicy_mx25r = {
 #if DT_HAS_COMPAT_STATUS_OKAY(mxicy_mx25u)
 
 #define MXICY_MX25R_OE_MASK BIT(0)
+#define MXICY_MX25U_DOPI_MASK BIT(1)
 
 static uint8_t mxicy_mx25u_oe_payload = MXICY_MX25R_OE_MASK;
+static uint8_t mxicy_mx25u_dopi_payload = MXICY_MX25U_DOPI_MASK;
 
 static inline int mxicy_mx25u_post_switch_mode(const struct device *dev)
 {
@@ -170,7 +172,10 @@ static inline int mxicy_mx25u_post_switch_mode(const struct device *dev)
 	};
 
 	flash_mspi_command_set(dev, &cmd_status);
-	dev_data->packet.data_buf  = &mxicy_mx25u_oe_payload;
+	/* Select STR or DTR octal mode */
+	dev_data->packet.data_buf  =
+		(dev_config->mspi_nor_cfg.data_rate == MSPI_DATA_RATE_DUAL)
+		? &mxicy_mx25u_dopi_payload : &mxicy_mx25u_oe_payload;
 	dev_data->packet.num_bytes = sizeof(mxicy_mx25u_oe_payload);
 	rc = mspi_transceive(dev_config->bus, &dev_config->mspi_id, &dev_data->xfer);
 	return rc;
@@ -163,6 +163,14 @@ struct spi_nor_config {
  */
 struct spi_nor_data {
 	struct k_sem sem;
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	/* Held by operations other than reads, for their whole duration:
+	 * @sem is released while an erase is in progress.
+	 */
+	struct k_sem excl_sem;
+	bool erase_in_progress;
+	bool erase_suspended;
+#endif
 #if ANY_INST_HAS_DPD
 	/* Low 32-bits of uptime counter at which device last entered
 	 * deep power-down.
@@ -654,6 +662,9 @@ static void acquire_device(const struct device *dev)
 	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
 		struct spi_nor_data *const driver_data = dev->data;
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+		k_sem_take(&driver_data->excl_sem, K_FOREVER);
+#endif
 		k_sem_take(&driver_data->sem, K_FOREVER);
 	}
 
@@ -671,8 +682,103 @@ static void release_device(const struct device *dev)
 		struct spi_nor_data *const driver_data = dev->data;
 
 		k_sem_give(&driver_data->sem);
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+		k_sem_give(&driver_data->excl_sem);
+#endif
+	}
+}
+
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+/* Access for reads, suspending an erase in progress. */
+static int acquire_device_read(const struct device *dev)
+{
+	const struct spi_nor_config *cfg = dev->config;
+	struct spi_nor_data *const driver_data = dev->data;
+	int ret = 0;
+
+	k_sem_take(&driver_data->sem, K_FOREVER);
+	(void)pm_device_runtime_get(cfg->spi.bus);
+
+	if (driver_data->erase_in_progress) {
+		ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_PES);
+		if (ret == 0) {
+			driver_data->erase_suspended = true;
+			ret = spi_nor_wait_until_ready(dev, WAIT_READY_REGISTER);
+		}
+	}
+
+	return ret;
+}
+
+static void release_device_read(const struct device *dev)
+{
+	const struct spi_nor_config *cfg = dev->config;
+	struct spi_nor_data *const driver_data = dev->data;
+
+	if (driver_data->erase_suspended) {
+		if (spi_nor_cmd_write(dev, SPI_NOR_CMD_PER) != 0) {
+			LOG_ERR("Failed to resume erase");
+		}
+		driver_data->erase_suspended = false;
+	}
+
+	(void)pm_device_runtime_put(cfg->spi.bus);
+	k_sem_give(&driver_data->sem);
+}
+
+/* Wait for an erase, letting reads suspend it while waiting. */
+static int spi_nor_wait_erase(const struct device *dev, bool suspendable)
+{
+	struct spi_nor_data *const driver_data = dev->data;
+	uint8_t reg;
+	int ret;
+
+	if (!suspendable) {
+		return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+	}
+
+	driver_data->erase_in_progress = true;
+
+	while (true) {
+		ret = spi_nor_cmd_read(dev, SPI_NOR_CMD_RDSR, &reg, sizeof(reg));
+		if (ret || !(reg & SPI_NOR_WIP_BIT)) {
+			break;
+		}
+
+		k_sem_give(&driver_data->sem);
+		k_sleep(WAIT_READY_ERASE);
+		k_sem_take(&driver_data->sem, K_FOREVER);
+	}
+
+	driver_data->erase_in_progress = false;
+
+	if (ret) {
+		return ret;
 	}
+
+	/* Check the flag status register for errors, if present */
+	return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
 }
+#else
+static int acquire_device_read(const struct device *dev)
+{
+	acquire_device(dev);
+
+	return 0;
+}
+
+static void release_device_read(const struct device *dev)
+{
+	release_device(dev);
+}
+
+static int spi_nor_wait_erase(const struct device *dev, bool suspendable)
+{
+	ARG_UNUSED(suspendable);
+
+	return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
 
 /**
  * @brief Read the status register.
@@ -875,7 +981,10 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 		return -EIO;
 	}
 
-	acquire_device(dev);
+	ret = acquire_device_read(dev);
+	if (ret != 0) {
+		goto out;
+	}
 
 	if (IS_ENABLED(ANY_INST_USE_4B_ADDR_OPCODES) && cfg->use_4b_addr_opcodes) {
 		if (addr > SPI_NOR_3B_ADDR_MAX) {
@@ -904,7 +1013,8 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 		}
 	}
 
-	release_device(dev);
+out:
+	release_device_read(dev);
 
 	/* Release flash power requirement */
 	(void)pm_device_runtime_put_async(dev, K_MSEC(ACTIVE_DWELL_MS));
@@ -1056,6 +1166,8 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 	ret = spi_nor_write_protection_set(dev, false);
 
 	while ((size > 0) && (ret == 0)) {
+		bool suspendable = true;
+
 		ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_WREN);
 		if (ret) {
 			break;
@@ -1065,6 +1177,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 			/* chip erase */
 			ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_CE);
 			size -= flash_size;
+			suspendable = false;
 		} else {
 			const struct jesd216_erase_type *erase_types =
 				dev_erase_types(dev);
@@ -1102,7 +1215,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 			break;
 		}
 
-		ret = spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+		ret = spi_nor_wait_erase(dev, suspendable);
 	}
 
 	int ret2 = spi_nor_write_protection_set(dev, true);
@@ -1713,6 +1826,9 @@ static int spi_nor_init(const struct device *dev)
 		struct spi_nor_data *const driver_data = dev->data;
 
 		k_sem_init(&driver_data->sem, 1, K_SEM_MAX_LIMIT);
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+		k_sem_init(&driver_data->excl_sem, 1, K_SEM_MAX_LIMIT);
+#endif
 	}
 
 #if ANY_INST_HAS_WP_GPIOS
@@ -70,6 +70,8 @@
 #define SPI_NOR_CMD_PP_1_1_4_4B  0x34  /* Quad Page program (1-1-4) 4 Byte Address */
 #define SPI_NOR_CMD_PP_1_4_4_4B  0x3e  /* Quad Page program (1-4-4) 4 Byte Address */
 #define SPI_NOR_CMD_RDFLSR       0x70  /* Read Flag Status Register */
+#define SPI_NOR_CMD_PES          0x75  /* Program/Erase Suspend */
+#define SPI_NOR_CMD_PER          0x7A  /* Program/Erase Resume */
 #define SPI_NOR_CMD_CLRFLSR      0x50  /* Clear Flag Status Register */
 
 /* Flash octal opcodes */
@@ -127,6 +127,13 @@ struct mipi_dbi_lcdic_data {
 #ifdef CONFIG_MIPI_DBI_NXP_LCDIC_DMA
 	struct stream dma_stream;
 #endif
+#ifdef CONFIG_MIPI_DBI_ASYNC
+	/* Completion callback of the asynchronous display write.
+	 * The lock is released by the ISR when this is set.
+	 */
+	mipi_dbi_write_cb_t async_cb;
+	void *async_user_data;
+#endif
 };
 
 #define LCDIC_ALL_INTERRUPTS \
@@ -412,11 +419,12 @@ static void mipi_dbi_lcdic_set_cmd(LCDIC_Type *base,
 	base->TFIFO_WDATA = cmd.u32;
 }
 
-static int mipi_dbi_lcdic_write_display(const struct device *dev,
-					const struct mipi_dbi_config *dbi_config,
-					const uint8_t *framebuf,
-					struct display_buffer_descriptor *desc,
-					enum display_pixel_format pixfmt)
+static int mipi_dbi_lcdic_write_display_common(const struct device *dev,
+					       const struct mipi_dbi_config *dbi_config,
+					       const uint8_t *framebuf,
+					       struct display_buffer_descriptor *desc,
+					       enum display_pixel_format pixfmt,
+					       mipi_dbi_write_cb_t cb, void *user_data)
 {
 	const struct mipi_dbi_lcdic_config *config = dev->config;
 	struct mipi_dbi_lcdic_data *dev_data = dev->data;
@@ -487,6 +495,10 @@ static int mipi_dbi_lcdic_write_display(const struct device *dev,
 				LOG_WRN("Unsupported pixel format, byte swapping disabled");
 			}
 		}
+#ifdef CONFIG_MIPI_DBI_ASYNC
+		dev_data->async_cb = cb;
+		dev_data->async_user_data = user_data;
+#endif
 		/* Use pixel format data width, so we can byte swap
 		 * if needed
 		 */
@@ -503,6 +515,10 @@ static int mipi_dbi_lcdic_write_display(const struct device *dev,
 		ret = mipi_dbi_lcdic_start_dma(dev);
 		if (ret) {
 			LOG_ERR("Could not start DMA (%d)", ret);
+#ifdef CONFIG_MIPI_DBI_ASYNC
+			dev_data->async_cb = NULL;
+			cb = NULL;
+#endif
 			goto release_power_lock;
 		}
 #else
@@ -515,6 +531,14 @@ static int mipi_dbi_lcdic_write_display(const struct device *dev,
 		interrupts |= LCDIC_IMR_CMD_DONE_INTR_MSK_MASK;
 		/* Write interrupt mask */
 		base->IMR &= ~interrupts;
+#endif
+#ifdef CONFIG_MIPI_DBI_ASYNC
+		if (cb != NULL) {
+			/* Both the lock and the power state lock are
+			 * released in the ISR after the transfer is complete.
+			 */
+			return 0;
+		}
 #endif
 		ret = k_sem_take(&dev_data->xfer_sem, K_FOREVER);
 		/* Do not release the lock from the power states.
@@ -529,10 +553,37 @@ release_power_lock:
 
 release_sem:
 	k_sem_give(&dev_data->lock);
+	if (ret == 0 && cb != NULL) {
+		/* Nothing to send */
+		cb(dev, 0, user_data);
+	}
 	return ret;
 
 }
 
+static int mipi_dbi_lcdic_write_display(const struct device *dev,
+					const struct mipi_dbi_config *dbi_config,
+					const uint8_t *framebuf,
+					struct display_buffer_descriptor *desc,
+					enum display_pixel_format pixfmt)
+{
+	return mipi_dbi_lcdic_write_display_common(dev, dbi_config, framebuf,
+						   desc, pixfmt, NULL, NULL);
+}
+
+#ifdef CONFIG_MIPI_DBI_ASYNC
+static int mipi_dbi_lcdic_write_display_async(const struct device *dev,
+					      const struct mipi_dbi_config *dbi_config,
+					      const uint8_t *framebuf,
+					      struct display_buffer_descriptor *desc,
+					      enum display_pixel_format pixfmt,
+					      mipi_dbi_write_cb_t cb, void *user_data)
+{
+	return mipi_dbi_lcdic_write_display_common(dev, dbi_config, framebuf,
+						   desc, pixfmt, cb, user_data);
+}
+#endif /* CONFIG_MIPI_DBI_ASYNC */
+
 static int mipi_dbi_lcdic_write_cmd(const struct device *dev,
 				    const struct mipi_dbi_config *dbi_config,
 				    uint8_t cmd,
@@ -787,6 +838,9 @@ static DEVICE_API(mipi_dbi, mipi_dbi_lcdic_driver_api) = {
 	.write_display = mipi_dbi_lcdic_write_display,
 	.configure_te = mipi_dbi_lcdic_configure_te,
 	.reset = mipi_dbi_lcdic_reset,
+#ifdef CONFIG_MIPI_DBI_ASYNC
+	.write_display_async = mipi_dbi_lcdic_write_display_async,
+#endif
 };
 
 static void mipi_dbi_lcdic_isr(const struct device *dev)
@@ -811,6 +865,18 @@ static void mipi_dbi_lcdic_isr(const struct device *dev)
 		if (data->xfer_bytes == 0) {
 			/* Disable interrupts */
 			base->IMR |= LCDIC_ALL_INTERRUPTS;
+#ifdef CONFIG_MIPI_DBI_ASYNC
+			if (data->async_cb != NULL) {
+				mipi_dbi_write_cb_t cb = data->async_cb;
+
+				/* Asynchronous display write is complete */
+				data->async_cb = NULL;
+				pm_policy_device_power_lock_put(dev);
+				k_sem_give(&data->lock);
+				cb(dev, 0, data->async_user_data);
+				return;
+			}
+#endif
 			/* All data has been sent. */
 			k_sem_give(&data->xfer_sem);
 			pm_policy_device_power_lock_put(dev);
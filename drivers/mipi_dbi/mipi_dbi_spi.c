@@ -30,6 +30,16 @@ struct mipi_dbi_spi_data {
 	struct k_mutex lock;
 	/* Used for 3 wire mode */
 	uint16_t spi_byte;
+#ifdef CONFIG_MIPI_DBI_ASYNC
+	/* Available when no asynchronous transfer is in progress */
+	struct k_sem async_sem;
+	/* SPI buffer of the asynchronous transfer */
+	struct spi_buf async_buf;
+	struct spi_buf_set async_buf_set;
+	/* Completion callback of the asynchronous transfer */
+	mipi_dbi_write_cb_t async_cb;
+	void *async_user_data;
+#endif
 };
 
 /* Expands to 1 if the node does not have the `write-only` property */
@@ -64,6 +74,21 @@ uint32_t var = MIPI_DBI_SPI_READ_REQUIRED;
  */
 #define MIPI_DBI_DC_BIT BIT(8)
 
+/* Wait for the asynchronous transfer in progress, if any. Must be called
+ * with the lock held so that no new transfer can be started meanwhile.
+ */
+static inline void mipi_dbi_spi_wait_idle(const struct device *dev)
+{
+#ifdef CONFIG_MIPI_DBI_ASYNC
+	struct mipi_dbi_spi_data *data = dev->data;
+
+	k_sem_take(&data->async_sem, K_FOREVER);
+	k_sem_give(&data->async_sem);
+#else
+	ARG_UNUSED(dev);
+#endif
+}
+
 static inline int
 mipi_dbi_spi_write_helper_3wire(const struct device *dev,
 				const struct mipi_dbi_config *dbi_config,
@@ -266,6 +291,8 @@ static int mipi_dbi_spi_write_helper(const struct device *dev,
 		return ret;
 	}
 
+	mipi_dbi_spi_wait_idle(dev);
+
 	if (dbi_config->mode == MIPI_DBI_MODE_SPI_3WIRE &&
 	    IS_ENABLED(CONFIG_MIPI_DBI_SPI_3WIRE)) {
 		ret = mipi_dbi_spi_write_helper_3wire(dev, dbi_config,
@@ -327,6 +354,83 @@ static int mipi_dbi_spi_write_display(const struct device *dev,
 					 framebuf, desc->buf_size);
 }
 
+#ifdef CONFIG_MIPI_DBI_ASYNC
+
+static void mipi_dbi_spi_async_cb(const struct device *spi_dev, int result,
+				  void *user_data)
+{
+	const struct device *dev = user_data;
+	struct mipi_dbi_spi_data *data = dev->data;
+	mipi_dbi_write_cb_t cb = data->async_cb;
+
+	ARG_UNUSED(spi_dev);
+
+	if (cb != NULL) {
+		cb(dev, result, data->async_user_data);
+	}
+
+	k_sem_give(&data->async_sem);
+}
+
+static int mipi_dbi_spi_write_display_async(const struct device *dev,
+					    const struct mipi_dbi_config *dbi_config,
+					    const uint8_t *framebuf,
+					    struct display_buffer_descriptor *desc,
+					    enum display_pixel_format pixfmt,
+					    mipi_dbi_write_cb_t cb, void *user_data)
+{
+	const struct mipi_dbi_spi_config *config = dev->config;
+	struct mipi_dbi_spi_data *data = dev->data;
+	int ret;
+
+	ARG_UNUSED(pixfmt);
+
+	if (dbi_config->mode != MIPI_DBI_MODE_SPI_4WIRE ||
+	    config->xfr_min_bits != MIPI_DBI_SPI_XFR_8BIT ||
+	    desc->buf_size == 0) {
+		/*
+		 * 3 wire mode and 16 bit stuffing need several SPI transfers
+		 * per buffer, write those synchronously.
+		 */
+		ret = mipi_dbi_spi_write_display(dev, dbi_config, framebuf,
+						 desc, pixfmt);
+		if (ret == 0 && cb != NULL) {
+			cb(dev, 0, user_data);
+		}
+
+		return ret;
+	}
+
+	ret = k_mutex_lock(&data->lock, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Wait for the previous buffer, the next one can be rendered meanwhile */
+	k_sem_take(&data->async_sem, K_FOREVER);
+
+	data->async_cb = cb;
+	data->async_user_data = user_data;
+	data->async_buf.buf = (void *)framebuf;
+	data->async_buf.len = desc->buf_size;
+	data->async_buf_set.buffers = &data->async_buf;
+	data->async_buf_set.count = 1;
+
+	/* Set CD pin high for data */
+	gpio_pin_set_dt(&config->cmd_data, 1);
+	ret = spi_transceive_cb(config->spi_dev, &dbi_config->config,
+				&data->async_buf_set, NULL,
+				mipi_dbi_spi_async_cb, (void *)dev);
+	if (ret < 0) {
+		k_sem_give(&data->async_sem);
+	}
+
+	k_mutex_unlock(&data->lock);
+	return ret;
+}
+
+#endif /* CONFIG_MIPI_DBI_ASYNC */
+
 #if MIPI_DBI_SPI_READ_REQUIRED
 
 static inline int
@@ -451,6 +555,9 @@ static int mipi_dbi_spi_command_read(const struct device *dev,
 	if (ret < 0) {
 		return ret;
 	}
+
+	mipi_dbi_spi_wait_idle(dev);
+
 	if (dbi_config->mode == MIPI_DBI_MODE_SPI_3WIRE &&
 	    IS_ENABLED(CONFIG_MIPI_DBI_SPI_3WIRE)) {
 		ret = mipi_dbi_spi_read_helper_3wire(dev, dbi_config,
@@ -503,8 +610,15 @@ static int mipi_dbi_spi_release(const struct device *dev,
 				const struct mipi_dbi_config *dbi_config)
 {
 	const struct mipi_dbi_spi_config *config = dev->config;
+	struct mipi_dbi_spi_data *data = dev->data;
+	int ret;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	mipi_dbi_spi_wait_idle(dev);
+	ret = spi_release(config->spi_dev, &dbi_config->config);
+	k_mutex_unlock(&data->lock);
 
-	return spi_release(config->spi_dev, &dbi_config->config);
+	return ret;
 }
 
 static int mipi_dbi_spi_init(const struct device *dev)
@@ -541,6 +655,9 @@ static int mipi_dbi_spi_init(const struct device *dev)
 	}
 
 	k_mutex_init(&data->lock);
+#ifdef CONFIG_MIPI_DBI_ASYNC
+	k_sem_init(&data->async_sem, 1, 1);
+#endif
 
 	return 0;
 }
@@ -553,6 +670,9 @@ static DEVICE_API(mipi_dbi, mipi_dbi_spi_driver_api) = {
 #if MIPI_DBI_SPI_READ_REQUIRED
 	.command_read = mipi_dbi_spi_command_read,
 #endif
+#ifdef CONFIG_MIPI_DBI_ASYNC
+	.write_display_async = mipi_dbi_spi_write_display_async,
+#endif
 };
 
 #define MIPI_DBI_SPI_INIT(n)							\
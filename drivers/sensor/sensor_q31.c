@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/sensor_q31.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_SENSOR_Q31_DSP
+#include <zephyr/dsp/dsp.h>
+
+/* Frames converted per call of the DSP functions, bounding the stack usage */
+#define SENSOR_Q31_DSP_FRAMES 16
+#endif /* CONFIG_SENSOR_Q31_DSP */
+
+static inline int16_t sensor_q31_sample(const uint8_t *frame, int axis, bool big_endian)
+{
+	const uint8_t *sample = frame + (axis * sizeof(int16_t));
+
+	return (int16_t)(big_endian ? sys_get_be16(sample) : sys_get_le16(sample));
+}
+
+#ifdef CONFIG_SENSOR_Q31_DSP
+void sensor_three_axis_from_int16(const uint8_t *frames, size_t stride, bool big_endian,
+				  int32_t scale, struct sensor_three_axis_sample_data *readings,
+				  size_t count)
+{
+	q31_t block[SENSOR_Q31_DSP_FRAMES * 3];
+	q31_t scale_fract;
+	int8_t shift = 0;
+
+	/*
+	 * The samples are converted to q31 fractions of 2^15, so the readings are their
+	 * product by scale * 2^-16, written as scale_fract * 2^shift.
+	 */
+	while ((scale >> shift) >= BIT(16)) {
+		shift++;
+	}
+	scale_fract = (q31_t)(((int64_t)scale << 15) >> shift);
+
+	for (size_t i = 0; i < count; i += SENSOR_Q31_DSP_FRAMES) {
+		size_t n = MIN(count - i, SENSOR_Q31_DSP_FRAMES);
+
+		for (size_t j = 0; j < n; j++) {
+			const uint8_t *frame = frames + ((i + j) * stride);
+
+			for (int axis = 0; axis < 3; axis++) {
+				block[(j * 3) + axis] =
+					(q31_t)sensor_q31_sample(frame, axis, big_endian) * BIT(16);
+			}
+		}
+
+		zdsp_scale_q31(block, scale_fract, shift, block, n * 3);
+
+		for (size_t j = 0; j < n; j++) {
+			for (int axis = 0; axis < 3; axis++) {
+				readings[i + j].values[axis] = block[(j * 3) + axis];
+			}
+		}
+	}
+}
+#else
+void sensor_three_axis_from_int16(const uint8_t *frames, size_t stride, bool big_endian,
+				  int32_t scale, struct sensor_three_axis_sample_data *readings,
+				  size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		const uint8_t *frame = frames + (i * stride);
+
+		for (int axis = 0; axis < 3; axis++) {
+			int64_t value = (int64_t)sensor_q31_sample(frame, axis, big_endian) * scale;
+
+			readings[i].values[axis] = CLAMP(value, INT32_MIN, INT32_MAX);
+		}
+	}
+}
+#endif /* CONFIG_SENSOR_Q31_DSP */
@@ -11,6 +11,7 @@
 
 #include <zephyr/logging/log.h>
 #include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/drivers/sensor_q31.h>
 
 LOG_MODULE_REGISTER(ICM42688_DECODER, CONFIG_SENSOR_LOG_LEVEL);
 
@@ -240,6 +241,13 @@ static inline q31_t icm42688_read_temperature_from_packet(const uint8_t *pkt)
 	return FIELD_PREP(GENMASK(31, 22), whole) | (fraction * GENMASK64(21, 0) / 1000000);
 }
 
+/* Value of an LSB of the FIFO packets, at the shift of the full scale */
+static const uint32_t icm42688_fifo_scale[2][2] = {
+	/* low-res,	hi-res */
+	{35744,		2235}, /* gyro */
+	{40168,		2511}, /* accel */
+};
+
 static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int fs,
 					 uint8_t axis_offset, q31_t *out)
 {
@@ -248,12 +256,6 @@ static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 	bool is_hires = FIELD_GET(FIFO_HEADER_20, pkt[0]) == 1;
 	int offset = 1 + (axis_offset * 2);
 
-	const uint32_t scale[2][2] = {
-		/* low-res,	hi-res */
-		{35744,		2235}, /* gyro */
-		{40168,		2511}, /* accel */
-	};
-
 	if (!is_accel && FIELD_GET(FIFO_HEADER_ACCEL, pkt[0]) == 1) {
 		offset += 6;
 	}
@@ -279,10 +281,10 @@ static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 			return -ENODATA;
 		}
 	} else {
-		signed_value = unsigned_value | (0 - (unsigned_value & BIT(16)));
+		signed_value = unsigned_value | (0 - (unsigned_value & BIT(15)));
 	}
 
-	*out = (q31_t)(signed_value * scale[is_accel][is_hires]);
+	*out = (q31_t)(signed_value * icm42688_fifo_scale[is_accel][is_hires]);
 	return 0;
 }
 
@@ -341,6 +343,46 @@ static int icm42688_calc_timestamp_delta(int rtc_freq, int chan_type, int dt_odr
 	return 0;
 }
 
+/*
+ * Decode the accel or gyro samples of consecutive 16 bytes packets holding both, the packets of
+ * the default FIFO configuration, converting all their samples at once. Returns the number of
+ * packets decoded, which ends at the first packet of another format or with a timestamp delta
+ * that overflows, left to the decoding of single packets.
+ */
+static int icm42688_fifo_decode_packets16(const struct icm42688_fifo_data *edata,
+					  const uint8_t *buffer, const uint8_t *buffer_end,
+					  bool is_accel, int frame_idx, uint16_t max_count,
+					  struct sensor_three_axis_sample_data *readings)
+{
+	const uint8_t *frame = buffer;
+	uint64_t ts_delta;
+	int count = 0;
+	int rc;
+
+	while (count < max_count && (frame + 16) <= buffer_end &&
+	       FIELD_GET(FIFO_HEADER_20, frame[0]) == 0 &&
+	       FIELD_GET(FIFO_HEADER_ACCEL, frame[0]) == 1 &&
+	       FIELD_GET(FIFO_HEADER_GYRO, frame[0]) == 1) {
+		rc = icm42688_calc_timestamp_delta(
+			edata->rtc_freq, is_accel ? SENSOR_CHAN_ACCEL_XYZ : SENSOR_CHAN_GYRO_XYZ,
+			is_accel ? edata->accel_odr : edata->gyro_odr, frame_idx + count,
+			&ts_delta);
+		if (rc < 0 || ts_delta > UINT32_MAX) {
+			break;
+		}
+
+		readings[count].timestamp_delta = ts_delta;
+		frame += 16;
+		count++;
+	}
+
+	/* Gyro samples follow the packet header and the accel samples */
+	sensor_three_axis_from_int16(buffer + (is_accel ? 1 : 7), 16, true,
+				     icm42688_fifo_scale[is_accel][0], readings, count);
+
+	return count;
+}
+
 static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
 				uint32_t *fit, uint16_t max_count, void *data_out)
 {
@@ -383,6 +425,32 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 			buffer = frame_end;
 			continue;
 		}
+		if ((IS_ACCEL(chan_spec.chan_type) || IS_GYRO(chan_spec.chan_type)) &&
+		    !is_20b && has_accel && has_gyro) {
+			struct sensor_three_axis_data *data =
+				(struct sensor_three_axis_data *)data_out;
+			const bool is_accel = IS_ACCEL(chan_spec.chan_type);
+			int n;
+
+			n = icm42688_fifo_decode_packets16(
+				edata, buffer, buffer_end, is_accel,
+				(is_accel ? accel_frame_count : gyro_frame_count) - 1,
+				max_count - count, &data->readings[count]);
+			if (n > 0) {
+				icm42688_get_shift(is_accel ? SENSOR_CHAN_ACCEL_XYZ
+							    : SENSOR_CHAN_GYRO_XYZ,
+						   edata->header.accel_fs, edata->header.gyro_fs,
+						   &data->shift);
+
+				/* The packets following the first one hold both accel and gyro */
+				accel_frame_count += n - 1;
+				gyro_frame_count += n - 1;
+				buffer += n * 16;
+				*fit = (uintptr_t)buffer;
+				count += n;
+				continue;
+			}
+		}
 		if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP) {
 			struct sensor_q31_data *data = (struct sensor_q31_data *)data_out;
 			uint64_t ts_delta;
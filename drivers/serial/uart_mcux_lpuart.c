@@ -926,13 +926,20 @@ static inline void mcux_lpuart_irq_driven_isr(const struct device *dev,
 #endif
 
 #ifdef CONFIG_UART_ASYNC_API
-static inline void mcux_lpuart_async_isr(struct mcux_lpuart_data *data,
-					      const struct mcux_lpuart_config *config,
-					      const uint32_t status) {
+static inline void mcux_lpuart_async_isr(const struct device *dev,
+					  struct mcux_lpuart_data *data,
+					  const struct mcux_lpuart_config *config,
+					  const uint32_t status) {
 	if (status & kLPUART_IdleLineFlag) {
-		async_timer_start(&data->async.rx_dma_params.timeout_work,
-				  data->async.rx_dma_params.timeout_us);
 		LPUART_ClearStatusFlags(config->base, kLPUART_IdleLineFlag);
+
+		if (data->async.rx_dma_params.timeout_us == 0) {
+			/* The idle line already is the end of the burst, report it now */
+			mcux_lpuart_async_rx_flush(dev);
+		} else {
+			async_timer_start(&data->async.rx_dma_params.timeout_work,
+					  data->async.rx_dma_params.timeout_us);
+		}
 	}
 
 	if (status & kLPUART_RxOverrunFlag) {
@@ -964,12 +971,12 @@ static void mcux_lpuart_isr(const struct device *dev)
 	if (data->api_type == LPUART_IRQ_DRIVEN) {
 		mcux_lpuart_irq_driven_isr(dev, data, config, status);
 	} else if (data->api_type == LPUART_ASYNC) {
-		mcux_lpuart_async_isr(data, config, status);
+		mcux_lpuart_async_isr(dev, data, config, status);
 	}
 #elif defined(CONFIG_UART_INTERRUPT_DRIVEN)
 	mcux_lpuart_irq_driven_isr(dev, data, config, status);
 #elif defined(CONFIG_UART_ASYNC_API)
-	mcux_lpuart_async_isr(data, config, status);
+	mcux_lpuart_async_isr(dev, data, config, status);
 #endif /* API */
 }
 #endif /* CONFIG_UART_MCUX_LPUART_ISR_SUPPORT */
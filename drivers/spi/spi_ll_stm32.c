@@ -487,11 +487,29 @@ static void spi_stm32_cs_control(const struct device *dev, bool on)
 #endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32_spi_subghz) */
 }
 
+#ifdef CONFIG_SPI_STM32_RTIO
+static void spi_stm32_iodev_complete(const struct device *dev, int status);
+
+/* Chip select stays asserted until the last entry of a transaction is done */
+static bool spi_stm32_iodev_txn_pending(struct spi_stm32_data *data, int status)
+{
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+
+	return (status == 0) && (rtio_ctx->txn_curr != NULL) &&
+	       (rtio_ctx->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION);
+}
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 static void spi_stm32_complete(const struct device *dev, int status)
 {
 	const struct spi_stm32_config *cfg = dev->config;
 	SPI_TypeDef *spi = cfg->spi;
 	struct spi_stm32_data *data = dev->data;
+	bool release_cs = true;
+
+#ifdef CONFIG_SPI_STM32_RTIO
+	release_cs = !spi_stm32_iodev_txn_pending(data, status);
+#endif /* CONFIG_SPI_STM32_RTIO */
 
 #ifdef CONFIG_SPI_STM32_INTERRUPT
 	ll_func_disable_int_tx_empty(spi);
@@ -519,7 +537,9 @@ static void spi_stm32_complete(const struct device *dev, int status)
 			/* NOP */
 		}
 
-		spi_stm32_cs_control(dev, false);
+		if (release_cs) {
+			spi_stm32_cs_control(dev, false);
+		}
 	}
 
 	/* BSY flag is cleared when MODF flag is raised */
@@ -545,6 +565,12 @@ static void spi_stm32_complete(const struct device *dev, int status)
 	}
 
 #ifdef CONFIG_SPI_STM32_INTERRUPT
+#ifdef CONFIG_SPI_STM32_RTIO
+	if (data->rtio_ctx->txn_head != NULL) {
+		spi_stm32_iodev_complete(dev, status);
+		return;
+	}
+#endif /* CONFIG_SPI_STM32_RTIO */
 	spi_context_complete(&data->ctx, dev, status);
 #endif
 
@@ -580,6 +606,7 @@ static void spi_stm32_isr(const struct device *dev)
 
 	if (err) {
 		spi_stm32_complete(dev, err);
+		return;
 	}
 
 	uint32_t transfer_dir = LL_SPI_GetTransferDirection(spi);
@@ -896,49 +923,19 @@ static int spi_stm32_half_duplex_switch_to_receive(const struct spi_stm32_config
 	return 0;
 }
 
-static int transceive(const struct device *dev,
-		      const struct spi_config *config,
-		      const struct spi_buf_set *tx_bufs,
-		      const struct spi_buf_set *rx_bufs,
-		      bool asynchronous,
-		      spi_callback_t cb,
-		      void *userdata)
+/* Start shifting the buffers set up in the context, once configured */
+static int spi_stm32_transfer_start(const struct device *dev,
+				    const struct spi_buf_set *tx_bufs,
+				    const struct spi_buf_set *rx_bufs)
 {
 	const struct spi_stm32_config *cfg = dev->config;
 	struct spi_stm32_data *data = dev->data;
+	const struct spi_config *config __maybe_unused = data->ctx.config;
 	SPI_TypeDef *spi = cfg->spi;
-	int ret;
-
-	if (!tx_bufs && !rx_bufs) {
-		return 0;
-	}
-
-#ifndef CONFIG_SPI_STM32_INTERRUPT
-	if (asynchronous) {
-		return -ENOTSUP;
-	}
-#endif /* CONFIG_SPI_STM32_INTERRUPT */
-
-	spi_context_lock(&data->ctx, asynchronous, cb, userdata, config);
-
-	spi_stm32_pm_policy_state_lock_get(dev);
-
-	ret = spi_stm32_configure(dev, config, tx_bufs != NULL);
-	if (ret) {
-		goto end;
-	}
-
-	/* Set buffers info */
-	if (SPI_WORD_SIZE_GET(config->operation) == 8) {
-		spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, 1);
-	} else {
-		spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, 2);
-	}
-
-	uint32_t transfer_dir = LL_SPI_GetTransferDirection(spi);
 
 #if DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
 	if (cfg->fifo_enabled && SPI_OP_MODE_GET(config->operation) == SPI_OP_MODE_MASTER) {
+		uint32_t transfer_dir = LL_SPI_GetTransferDirection(spi);
 		int total_frames;
 
 		if (transfer_dir == LL_SPI_FULL_DUPLEX) {
@@ -953,8 +950,7 @@ static int transceive(const struct device *dev,
 		}
 
 		if (total_frames < 0) {
-			ret = total_frames;
-			goto end;
+			return total_frames;
 		}
 		LL_SPI_SetTransferSize(spi, (uint32_t)total_frames);
 	}
@@ -1003,7 +999,65 @@ static int transceive(const struct device *dev,
 	}
 
 	ll_func_enable_int_tx_empty(spi);
+#endif /* CONFIG_SPI_STM32_INTERRUPT */
+
+	return 0;
+}
+
+static int transceive(const struct device *dev,
+		      const struct spi_config *config,
+		      const struct spi_buf_set *tx_bufs,
+		      const struct spi_buf_set *rx_bufs,
+		      bool asynchronous,
+		      spi_callback_t cb,
+		      void *userdata)
+{
+	const struct spi_stm32_config *cfg = dev->config;
+	struct spi_stm32_data *data = dev->data;
+	SPI_TypeDef *spi = cfg->spi;
+	int ret;
+
+	if (!tx_bufs && !rx_bufs) {
+		return 0;
+	}
+
+#ifndef CONFIG_SPI_STM32_INTERRUPT
+	if (asynchronous) {
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_SPI_STM32_INTERRUPT */
+
+	spi_context_lock(&data->ctx, asynchronous, cb, userdata, config);
 
+#ifdef CONFIG_SPI_STM32_RTIO
+	ret = spi_rtio_transceive(data->rtio_ctx, config, tx_bufs, rx_bufs);
+	spi_context_release(&data->ctx, ret);
+
+	return ret;
+#endif /* CONFIG_SPI_STM32_RTIO */
+
+	spi_stm32_pm_policy_state_lock_get(dev);
+
+	ret = spi_stm32_configure(dev, config, tx_bufs != NULL);
+	if (ret) {
+		goto end;
+	}
+
+	/* Set buffers info */
+	if (SPI_WORD_SIZE_GET(config->operation) == 8) {
+		spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, 1);
+	} else {
+		spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, 2);
+	}
+
+	ret = spi_stm32_transfer_start(dev, tx_bufs, rx_bufs);
+	if (ret) {
+		goto end;
+	}
+
+	uint32_t transfer_dir = LL_SPI_GetTransferDirection(spi);
+
+#ifdef CONFIG_SPI_STM32_INTERRUPT
 	do {
 		ret = spi_context_wait_for_completion(&data->ctx);
 
@@ -1364,12 +1418,120 @@ static int spi_stm32_transceive_async(const struct device *dev,
 }
 #endif /* CONFIG_SPI_ASYNC */
 
+#ifdef CONFIG_SPI_STM32_RTIO
+static void spi_stm32_iodev_start(const struct device *dev)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+	struct rtio_sqe *sqe = &rtio_ctx->txn_curr->sqe;
+	struct spi_dt_spec *spi_dt_spec = sqe->iodev->data;
+	const struct spi_config *config = &spi_dt_spec->config;
+	struct spi_buf_set *tx_bufs = NULL;
+	struct spi_buf_set *rx_bufs = NULL;
+	int ret;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		data->rtio_rx_buf.buf = sqe->rx.buf;
+		data->rtio_rx_buf.len = sqe->rx.buf_len;
+		rx_bufs = &data->rtio_rx;
+		break;
+	case RTIO_OP_TX:
+		data->rtio_tx_buf.buf = (uint8_t *)sqe->tx.buf;
+		data->rtio_tx_buf.len = sqe->tx.buf_len;
+		tx_bufs = &data->rtio_tx;
+		break;
+	case RTIO_OP_TINY_TX:
+		data->rtio_tx_buf.buf = sqe->tiny_tx.buf;
+		data->rtio_tx_buf.len = sqe->tiny_tx.buf_len;
+		tx_bufs = &data->rtio_tx;
+		break;
+	case RTIO_OP_TXRX:
+		data->rtio_tx_buf.buf = (uint8_t *)sqe->txrx.tx_buf;
+		data->rtio_tx_buf.len = sqe->txrx.buf_len;
+		data->rtio_rx_buf.buf = sqe->txrx.rx_buf;
+		data->rtio_rx_buf.len = sqe->txrx.buf_len;
+		tx_bufs = &data->rtio_tx;
+		rx_bufs = &data->rtio_rx;
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		ret = -EINVAL;
+		goto error;
+	}
+
+	if ((config->operation & SPI_HALF_DUPLEX) && (tx_bufs != NULL) && (rx_bufs != NULL)) {
+		ret = -ENOTSUP;
+		goto error;
+	}
+
+	/* Configurations of the blocking API calls are all copied to the same place */
+	if (sqe->iodev == &rtio_ctx->iodev) {
+		data->ctx.config = NULL;
+	}
+
+	spi_stm32_pm_policy_state_lock_get(dev);
+
+	ret = spi_stm32_configure(dev, config, tx_bufs != NULL);
+	if (ret) {
+		goto error;
+	}
+
+	if (SPI_WORD_SIZE_GET(config->operation) == 8) {
+		spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, 1);
+	} else {
+		spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, 2);
+	}
+
+	ret = spi_stm32_transfer_start(dev, tx_bufs, rx_bufs);
+	if (ret) {
+		spi_stm32_complete(dev, ret);
+	}
+
+	return;
+
+error:
+	/* Earlier entries of the transaction left the chip select asserted */
+	if (rtio_ctx->txn_curr != rtio_ctx->txn_head) {
+		spi_stm32_cs_control(dev, false);
+	}
+	spi_stm32_iodev_complete(dev, ret);
+}
+
+static void spi_stm32_iodev_complete(const struct device *dev, int status)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+
+	if (spi_stm32_iodev_txn_pending(data, status)) {
+		rtio_ctx->txn_curr = rtio_txn_next(rtio_ctx->txn_curr);
+		spi_stm32_iodev_start(dev);
+	} else if (spi_rtio_complete(rtio_ctx, status)) {
+		spi_stm32_iodev_start(dev);
+	} else {
+		spi_stm32_pm_policy_state_lock_put(dev);
+	}
+}
+
+static void spi_stm32_iodev_submit(const struct device *dev,
+				   struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_stm32_data *data = dev->data;
+
+	if (spi_rtio_submit(data->rtio_ctx, iodev_sqe)) {
+		spi_stm32_iodev_start(dev);
+	}
+}
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 static DEVICE_API(spi, api_funcs) = {
 	.transceive = spi_stm32_transceive,
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = spi_stm32_transceive_async,
 #endif
-#ifdef CONFIG_SPI_RTIO
+#if defined(CONFIG_SPI_STM32_RTIO)
+	.iodev_submit = spi_stm32_iodev_submit,
+#elif defined(CONFIG_SPI_RTIO)
 	.iodev_submit = spi_rtio_iodev_default_submit,
 #endif
 	.release = spi_stm32_release,
@@ -1450,6 +1612,14 @@ static int spi_stm32_init(const struct device *dev)
 		return err;
 	}
 
+#ifdef CONFIG_SPI_STM32_RTIO
+	data->rtio_tx.buffers = &data->rtio_tx_buf;
+	data->rtio_tx.count = 1;
+	data->rtio_rx.buffers = &data->rtio_rx_buf;
+	data->rtio_rx.count = 1;
+	spi_rtio_init(data->rtio_ctx, dev);
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 	spi_context_unlock_unconditionally(&data->ctx);
 
 	return pm_device_runtime_enable(dev);
@@ -1577,11 +1747,23 @@ static void spi_stm32_irq_config_func_##id(const struct device *dev)		\
 #define SPI_GET_FIFO_PROP(id)	DT_INST_PROP(id, fifo_enable)
 #define SPI_FIFO_ENABLED(id)	COND_CODE_1(SPI_SUPPORTS_FIFO(id), (SPI_GET_FIFO_PROP(id)), (0))
 
+#ifdef CONFIG_SPI_STM32_RTIO
+#define SPI_STM32_RTIO_DEFINE(id)					\
+	SPI_RTIO_DEFINE(spi_stm32_rtio_##id, CONFIG_SPI_STM32_RTIO_SQ_SIZE,	\
+			CONFIG_SPI_STM32_RTIO_CQ_SIZE)
+#define SPI_STM32_RTIO_CTX(id)	.rtio_ctx = &spi_stm32_rtio_##id,
+#else
+#define SPI_STM32_RTIO_DEFINE(id)
+#define SPI_STM32_RTIO_CTX(id)
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 #define STM32_SPI_INIT(id)						\
 STM32_SPI_IRQ_HANDLER_DECL(id);						\
 									\
 PINCTRL_DT_INST_DEFINE(id);						\
 									\
+SPI_STM32_RTIO_DEFINE(id)						\
+									\
 static const struct stm32_pclken pclken_##id[] =			\
 					       STM32_DT_INST_CLOCKS(id);\
 									\
@@ -1609,6 +1791,7 @@ static struct spi_stm32_data spi_stm32_dev_data_##id = {		\
 	SPI_DMA_CHANNEL(id, rx, RX, PERIPHERAL, MEMORY)			\
 	SPI_DMA_CHANNEL(id, tx, TX, MEMORY, PERIPHERAL)			\
 	SPI_DMA_STATUS_SEM(id)						\
+	SPI_STM32_RTIO_CTX(id)						\
 	SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(id), ctx)		\
 };									\
 									\
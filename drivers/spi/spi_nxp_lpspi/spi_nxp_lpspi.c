@@ -14,8 +14,19 @@ LOG_MODULE_DECLARE(spi_lpspi, CONFIG_SPI_LOG_LEVEL);
 struct lpspi_driver_data {
 	size_t fill_len;
 	uint8_t word_size_bytes;
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+	struct spi_rtio *rtio_ctx;
+	struct spi_buf rtio_tx_buf;
+	struct spi_buf rtio_rx_buf;
+	struct spi_buf_set rtio_tx;
+	struct spi_buf_set rtio_rx;
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
 };
 
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+static void lpspi_iodev_complete(const struct device *dev, int status);
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
+
 static inline uint8_t rx_fifo_cur_len(LPSPI_Type *base)
 {
 	return (base->FSR & LPSPI_FSR_RXCOUNT_MASK) >> LPSPI_FSR_RXCOUNT_SHIFT;
@@ -218,20 +229,39 @@ static inline void lpspi_handle_tx_irq(const struct device *dev)
 	lpspi_next_tx_fill(data->dev);
 }
 
-static inline void lpspi_end_xfer(const struct device *dev)
+/* ends the continuous transfer, and deasserts the chip select unless asked to hold it */
+static inline void lpspi_end_cs(const struct device *dev)
 {
 	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
-	const struct lpspi_config *config = dev->config;
 	struct lpspi_data *data = dev->data;
 	struct spi_context *ctx = &data->ctx;
 
-	spi_context_complete(ctx, dev, 0);
-	NVIC_ClearPendingIRQ(config->irqn);
 	if (!(ctx->config->operation & SPI_HOLD_ON_CS)) {
 		base->TCR &= ~(LPSPI_TCR_CONT_MASK | LPSPI_TCR_CONTC_MASK);
 	}
 	lpspi_wait_tx_fifo_empty(dev);
 	spi_context_cs_control(ctx, false);
+}
+
+static inline void lpspi_end_xfer(const struct device *dev)
+{
+	const struct lpspi_config *config = dev->config;
+	struct lpspi_data *data = dev->data;
+	struct spi_context *ctx = &data->ctx;
+
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+
+	if (lpspi_data->rtio_ctx->txn_head != NULL) {
+		NVIC_ClearPendingIRQ(config->irqn);
+		lpspi_iodev_complete(dev, 0);
+		return;
+	}
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
+
+	spi_context_complete(ctx, dev, 0);
+	NVIC_ClearPendingIRQ(config->irqn);
+	lpspi_end_cs(dev);
 	spi_context_release(&data->ctx, 0);
 }
 
@@ -289,31 +319,20 @@ static void lpspi_isr(const struct device *dev)
 	}
 }
 
-static int transceive(const struct device *dev, const struct spi_config *spi_cfg,
-		      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs,
-		      bool asynchronous, spi_callback_t cb, void *userdata)
+/* starts the transfer of the buffers set up in the context, continuing the
+ * previous command to keep the chip select asserted if cont is true
+ */
+static int lpspi_start_xfer(const struct device *dev, const struct spi_config *spi_cfg,
+			    bool cont)
 {
 	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
 	struct lpspi_data *data = dev->data;
-	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
 	struct spi_context *ctx = &data->ctx;
-	int ret = 0;
-
-	spi_context_lock(&data->ctx, asynchronous, cb, userdata, spi_cfg);
-
-	lpspi_data->word_size_bytes =
-		DIV_ROUND_UP(SPI_WORD_SIZE_GET(spi_cfg->operation), BITS_PER_BYTE);
-	if (lpspi_data->word_size_bytes > 4) {
-		LOG_ERR("Maximum 4 byte word size");
-		ret = -EINVAL;
-		goto error;
-	}
-
-	spi_context_buffers_setup(ctx, tx_bufs, rx_bufs, lpspi_data->word_size_bytes);
+	int ret;
 
 	ret = spi_mcux_configure(dev, spi_cfg);
 	if (ret) {
-		goto error;
+		return ret;
 	}
 
 	base->CR |= LPSPI_CR_RTF_MASK | LPSPI_CR_RRF_MASK; /* flush fifos */
@@ -331,7 +350,7 @@ static int transceive(const struct device *dev, const struct spi_config *spi_cfg
 	 * to also set CONTC in order to continue the previous command to keep CS
 	 * asserted.
 	 */
-	if (spi_cfg->operation & SPI_HOLD_ON_CS || base->TCR & LPSPI_TCR_CONTC_MASK) {
+	if (cont || spi_cfg->operation & SPI_HOLD_ON_CS || base->TCR & LPSPI_TCR_CONTC_MASK) {
 		base->TCR |= LPSPI_TCR_CONTC_MASK | LPSPI_TCR_CONT_MASK;
 	} else {
 		base->TCR |= LPSPI_TCR_CONT_MASK;
@@ -344,6 +363,42 @@ static int transceive(const struct device *dev, const struct spi_config *spi_cfg
 
 	base->IER |= LPSPI_IER_TDIE_MASK | LPSPI_IER_RDIE_MASK;
 
+	return 0;
+}
+
+static int transceive(const struct device *dev, const struct spi_config *spi_cfg,
+		      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs,
+		      bool asynchronous, spi_callback_t cb, void *userdata)
+{
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+	struct spi_context *ctx = &data->ctx;
+	int ret = 0;
+
+	spi_context_lock(&data->ctx, asynchronous, cb, userdata, spi_cfg);
+
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+	ret = spi_rtio_transceive(lpspi_data->rtio_ctx, spi_cfg, tx_bufs, rx_bufs);
+	spi_context_release(ctx, ret);
+
+	return ret;
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
+
+	lpspi_data->word_size_bytes =
+		DIV_ROUND_UP(SPI_WORD_SIZE_GET(spi_cfg->operation), BITS_PER_BYTE);
+	if (lpspi_data->word_size_bytes > 4) {
+		LOG_ERR("Maximum 4 byte word size");
+		ret = -EINVAL;
+		goto error;
+	}
+
+	spi_context_buffers_setup(ctx, tx_bufs, rx_bufs, lpspi_data->word_size_bytes);
+
+	ret = lpspi_start_xfer(dev, spi_cfg, false);
+	if (ret) {
+		goto error;
+	}
+
 	ret = spi_context_wait_for_completion(ctx);
 	if (ret >= 0) {
 		return ret;
@@ -371,12 +426,118 @@ static int lpspi_transceive_async(const struct device *dev, const struct spi_con
 }
 #endif /* CONFIG_SPI_ASYNC */
 
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+static void lpspi_iodev_start(const struct device *dev)
+{
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+	struct spi_rtio *rtio_ctx = lpspi_data->rtio_ctx;
+	struct rtio_sqe *sqe = &rtio_ctx->txn_curr->sqe;
+	struct spi_dt_spec *spi_dt_spec = sqe->iodev->data;
+	const struct spi_config *spi_cfg = &spi_dt_spec->config;
+	bool cont = (rtio_ctx->txn_curr != rtio_ctx->txn_head);
+	struct spi_buf_set *tx_bufs = NULL;
+	struct spi_buf_set *rx_bufs = NULL;
+	int ret;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		lpspi_data->rtio_rx_buf.buf = sqe->rx.buf;
+		lpspi_data->rtio_rx_buf.len = sqe->rx.buf_len;
+		rx_bufs = &lpspi_data->rtio_rx;
+		break;
+	case RTIO_OP_TX:
+		lpspi_data->rtio_tx_buf.buf = (uint8_t *)sqe->tx.buf;
+		lpspi_data->rtio_tx_buf.len = sqe->tx.buf_len;
+		tx_bufs = &lpspi_data->rtio_tx;
+		break;
+	case RTIO_OP_TINY_TX:
+		lpspi_data->rtio_tx_buf.buf = sqe->tiny_tx.buf;
+		lpspi_data->rtio_tx_buf.len = sqe->tiny_tx.buf_len;
+		tx_bufs = &lpspi_data->rtio_tx;
+		break;
+	case RTIO_OP_TXRX:
+		lpspi_data->rtio_tx_buf.buf = (uint8_t *)sqe->txrx.tx_buf;
+		lpspi_data->rtio_tx_buf.len = sqe->txrx.buf_len;
+		lpspi_data->rtio_rx_buf.buf = sqe->txrx.rx_buf;
+		lpspi_data->rtio_rx_buf.len = sqe->txrx.buf_len;
+		tx_bufs = &lpspi_data->rtio_tx;
+		rx_bufs = &lpspi_data->rtio_rx;
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		ret = -EINVAL;
+		goto error;
+	}
+
+	lpspi_data->word_size_bytes =
+		DIV_ROUND_UP(SPI_WORD_SIZE_GET(spi_cfg->operation), BITS_PER_BYTE);
+	if (lpspi_data->word_size_bytes > 4) {
+		LOG_ERR("Maximum 4 byte word size");
+		ret = -EINVAL;
+		goto error;
+	}
+
+	/* configurations of the blocking api calls are all copied to the same place */
+	if (!cont && sqe->iodev == &rtio_ctx->iodev) {
+		data->ctx.config = NULL;
+	}
+
+	spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, lpspi_data->word_size_bytes);
+
+	ret = lpspi_start_xfer(dev, spi_cfg, cont);
+	if (ret == 0) {
+		return;
+	}
+
+error:
+	/* earlier entries of the transaction left the chip select asserted */
+	if (cont) {
+		lpspi_end_cs(dev);
+	}
+	lpspi_iodev_complete(dev, ret);
+}
+
+static void lpspi_iodev_complete(const struct device *dev, int status)
+{
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+	struct spi_rtio *rtio_ctx = lpspi_data->rtio_ctx;
+
+	if (!status && rtio_ctx->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION) {
+		rtio_ctx->txn_curr = rtio_txn_next(rtio_ctx->txn_curr);
+		lpspi_iodev_start(dev);
+		return;
+	}
+
+	if (!status) {
+		lpspi_end_cs(dev);
+	}
+
+	if (spi_rtio_complete(rtio_ctx, status)) {
+		lpspi_iodev_start(dev);
+	}
+}
+
+static void lpspi_iodev_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+
+	if (spi_rtio_submit(lpspi_data->rtio_ctx, iodev_sqe)) {
+		lpspi_iodev_start(dev);
+	}
+}
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
+
 static DEVICE_API(spi, lpspi_driver_api) = {
 	.transceive = lpspi_transceive_sync,
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = lpspi_transceive_async,
 #endif
-#ifdef CONFIG_SPI_RTIO
+#if defined(CONFIG_SPI_MCUX_LPSPI_RTIO)
+	.iodev_submit = lpspi_iodev_submit,
+#elif defined(CONFIG_SPI_RTIO)
 	.iodev_submit = spi_rtio_iodev_default_submit,
 #endif
 	.release = spi_lpspi_release,
@@ -386,6 +547,9 @@ static int lpspi_init(const struct device *dev)
 {
 	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
 	struct lpspi_data *data = dev->data;
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
 	int err = 0;
 
 	err = spi_nxp_init_common(dev);
@@ -401,16 +565,37 @@ static int lpspi_init(const struct device *dev)
 	base->CFGR1 |= LPSPI_CFGR1_MASTER_MASK;
 	base->CFGR1 &= ~LPSPI_CFGR1_PCSPOL_MASK;
 
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+	lpspi_data->rtio_tx.buffers = &lpspi_data->rtio_tx_buf;
+	lpspi_data->rtio_tx.count = 1;
+	lpspi_data->rtio_rx.buffers = &lpspi_data->rtio_rx_buf;
+	lpspi_data->rtio_rx.count = 1;
+	spi_rtio_init(lpspi_data->rtio_ctx, dev);
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
+
 	spi_context_unlock_unconditionally(&data->ctx);
 
 	return 0;
 }
 
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO
+#define LPSPI_RTIO_DEFINE(n)                                                                       \
+	SPI_RTIO_DEFINE(lpspi_rtio_##n, CONFIG_SPI_MCUX_LPSPI_RTIO_SQ_SIZE,                        \
+			CONFIG_SPI_MCUX_LPSPI_RTIO_CQ_SIZE)
+#define LPSPI_RTIO_CTX(n) .rtio_ctx = &lpspi_rtio_##n,
+#else
+#define LPSPI_RTIO_DEFINE(n)
+#define LPSPI_RTIO_CTX(n)
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO */
+
 #define LPSPI_INIT(n)                                                                              \
 	SPI_NXP_LPSPI_COMMON_INIT(n)                                                               \
 	SPI_LPSPI_CONFIG_INIT(n)                                                              \
+	LPSPI_RTIO_DEFINE(n)                                                                       \
                                                                                                    \
-	static struct lpspi_driver_data lpspi_##n##_driver_data;                                   \
+	static struct lpspi_driver_data lpspi_##n##_driver_data = {                                \
+		LPSPI_RTIO_CTX(n)                                                                  \
+	};                                                                                         \
                                                                                                    \
 	static struct lpspi_data lpspi_data_##n = {                                             \
 		SPI_NXP_LPSPI_COMMON_DATA_INIT(n)                                                  \
@@ -2544,6 +2544,33 @@ static inline void dwc2_handle_rxflvl(const struct device *dev)
 	}
 }
 
+/* Complete bulk or interrupt transfer and start the next queued one without
+ * going through the driver thread. Can be called only from ISR context.
+ */
+static inline bool dwc2_isr_xfer_chain(const struct device *dev,
+				       struct udc_ep_config *const cfg)
+{
+	struct net_buf *buf;
+
+	if (!IS_ENABLED(CONFIG_UDC_DWC2_DMA_ISR_CHAIN) ||
+	    !dwc2_in_buffer_dma_mode(dev) ||
+	    USB_EP_GET_IDX(cfg->addr) == 0 || dwc2_ep_is_iso(cfg)) {
+		return false;
+	}
+
+	buf = udc_buf_get(cfg);
+	udc_ep_set_busy(cfg, false);
+
+	if (udc_submit_ep_event(dev, buf, 0)) {
+		LOG_ERR("Failed to submit endpoint event");
+	}
+
+	/* Sets the endpoint busy again if there is another buffer queued */
+	dwc2_handle_xfer_next(dev, cfg);
+
+	return true;
+}
+
 static inline void dwc2_handle_in_xfercompl(const struct device *dev,
 					    const uint8_t ep_idx)
 {
@@ -2563,6 +2590,10 @@ static inline void dwc2_handle_in_xfercompl(const struct device *dev,
 		return;
 	}
 
+	if (buf->len == 0 && dwc2_isr_xfer_chain(dev, ep_cfg)) {
+		return;
+	}
+
 	atomic_set_bit(&priv->xfer_finished, ep_idx);
 	k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
 }
@@ -2667,7 +2698,7 @@ static inline void dwc2_handle_out_xfercompl(const struct device *dev,
 	if (!is_iso && bcnt && (bcnt % udc_mps_ep_size(ep_cfg)) == 0 &&
 	    net_buf_tailroom(buf)) {
 		dwc2_prep_rx(dev, buf, ep_cfg);
-	} else {
+	} else if (!dwc2_isr_xfer_chain(dev, ep_cfg)) {
 		atomic_set_bit(&priv->xfer_finished, 16 + ep_idx);
 		k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
 	}
@@ -7,6 +7,7 @@
 
 #include <string.h>
 
+#include <zephyr/cache.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/video.h>
@@ -37,6 +38,9 @@ static struct video_buffer video_buf[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
 struct mem_block {
 	void *data;
+	atomic_t refcount;
+	video_buffer_release_cb_t release_cb;
+	void *release_cb_data;
 };
 
 static struct mem_block video_block[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
@@ -69,6 +73,9 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align, k_tim
 	vbuf->buffer = block->data;
 	vbuf->size = size;
 	vbuf->bytesused = 0;
+	block->release_cb = NULL;
+	block->release_cb_data = NULL;
+	atomic_set(&block->refcount, 1);
 
 	return vbuf;
 }
@@ -78,19 +85,62 @@ struct video_buffer *video_buffer_alloc(size_t size, k_timeout_t timeout)
 	return video_buffer_aligned_alloc(size, sizeof(void *), timeout);
 }
 
+static struct mem_block *video_buffer_to_block(const struct video_buffer *vbuf)
+{
+	/* vbuf to block, both arrays share the same index */
+	if (vbuf < video_buf || vbuf >= video_buf + ARRAY_SIZE(video_buf)) {
+		return NULL;
+	}
+
+	return &video_block[vbuf - video_buf];
+}
+
+struct video_buffer *video_buffer_ref(struct video_buffer *vbuf)
+{
+	struct mem_block *block;
+
+	__ASSERT_NO_MSG(vbuf != NULL);
+
+	block = video_buffer_to_block(vbuf);
+	__ASSERT(block != NULL, "Not a video buffer from the pool");
+	__ASSERT(atomic_get(&block->refcount) > 0, "Video buffer already released");
+
+	atomic_inc(&block->refcount);
+
+	return vbuf;
+}
+
+void video_buffer_set_release_cb(struct video_buffer *vbuf, video_buffer_release_cb_t cb,
+				 void *user_data)
+{
+	struct mem_block *block;
+
+	__ASSERT_NO_MSG(vbuf != NULL);
+
+	block = video_buffer_to_block(vbuf);
+	__ASSERT(block != NULL, "Not a video buffer from the pool");
+
+	block->release_cb = cb;
+	block->release_cb_data = user_data;
+}
+
 void video_buffer_release(struct video_buffer *vbuf)
 {
-	struct mem_block *block = NULL;
-	int i;
+	struct mem_block *block;
 
 	__ASSERT_NO_MSG(vbuf != NULL);
 
-	/* vbuf to block */
-	for (i = 0; i < ARRAY_SIZE(video_block); i++) {
-		if (video_block[i].data == vbuf->buffer) {
-			block = &video_block[i];
-			break;
-		}
+	block = video_buffer_to_block(vbuf);
+	if (block != NULL && atomic_dec(&block->refcount) > 1) {
+		/* Still in use by another device or by the application */
+		return;
+	}
+
+	if (block != NULL && block->release_cb != NULL) {
+		/* Hand the buffer back to its owner instead of freeing it */
+		atomic_set(&block->refcount, 1);
+		block->release_cb(vbuf, block->release_cb_data);
+		return;
 	}
 
 	vbuf->buffer = NULL;
@@ -99,6 +149,20 @@ void video_buffer_release(struct video_buffer *vbuf)
 	}
 }
 
+void video_buffer_cache_flush(const struct video_buffer *vbuf)
+{
+	__ASSERT_NO_MSG(vbuf != NULL);
+
+	(void)sys_cache_data_flush_range(vbuf->buffer, vbuf->size);
+}
+
+void video_buffer_cache_invalidate(const struct video_buffer *vbuf)
+{
+	__ASSERT_NO_MSG(vbuf != NULL);
+
+	(void)sys_cache_data_invd_range(vbuf->buffer, vbuf->size);
+}
+
 int video_format_caps_index(const struct video_format_cap *fmts, const struct video_format *fmt,
 			    size_t *idx)
 {
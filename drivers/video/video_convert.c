@@ -0,0 +1,274 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/drivers/video.h>
+#include <zephyr/drivers/video/convert.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * The line kernels below are written as plain loops over independent pixels
+ * without function calls or aliasing between the source and destination,
+ * so that the compiler can vectorize them where the target supports it
+ * (-O2 -ftree-vectorize with MVE, NEON or RVV).
+ */
+
+typedef void (*video_convert_line_t)(const uint8_t *restrict in, uint8_t *restrict out,
+				     uint32_t width);
+
+static inline uint8_t clamp_u8(int32_t value)
+{
+	return CLAMP(value, 0, UINT8_MAX);
+}
+
+/* ITU-R BT.601, limited range, 8 bit fixed point */
+static inline void yuv_to_rgb(int32_t y, int32_t u, int32_t v, uint8_t *rgb)
+{
+	int32_t c = 298 * (y - 16) + 128;
+	int32_t d = u - 128;
+	int32_t e = v - 128;
+
+	rgb[0] = clamp_u8((c + 409 * e) >> 8);
+	rgb[1] = clamp_u8((c - 100 * d - 208 * e) >> 8);
+	rgb[2] = clamp_u8((c + 516 * d) >> 8);
+}
+
+static inline uint16_t rgb_to_rgb565(const uint8_t *rgb)
+{
+	return ((rgb[0] & 0xf8) << 8) | ((rgb[1] & 0xfc) << 3) | (rgb[2] >> 3);
+}
+
+static inline uint8_t rgb_to_y(const uint8_t *rgb)
+{
+	return ((66 * rgb[0] + 129 * rgb[1] + 25 * rgb[2] + 128) >> 8) + 16;
+}
+
+static void yuyv_to_rgb24(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width / 2; i++) {
+		const uint8_t *yuyv = &in[i * 4];
+
+		yuv_to_rgb(yuyv[0], yuyv[1], yuyv[3], &out[i * 6]);
+		yuv_to_rgb(yuyv[2], yuyv[1], yuyv[3], &out[i * 6 + 3]);
+	}
+}
+
+static void yuyv_to_rgb565(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width / 2; i++) {
+		const uint8_t *yuyv = &in[i * 4];
+		uint8_t rgb[6];
+		uint16_t p0, p1;
+
+		yuv_to_rgb(yuyv[0], yuyv[1], yuyv[3], &rgb[0]);
+		yuv_to_rgb(yuyv[2], yuyv[1], yuyv[3], &rgb[3]);
+		p0 = rgb_to_rgb565(&rgb[0]);
+		p1 = rgb_to_rgb565(&rgb[3]);
+
+		out[i * 4 + 0] = p0 & 0xff;
+		out[i * 4 + 1] = p0 >> 8;
+		out[i * 4 + 2] = p1 & 0xff;
+		out[i * 4 + 3] = p1 >> 8;
+	}
+}
+
+static void yuyv_to_grey(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width; i++) {
+		out[i] = in[i * 2];
+	}
+}
+
+static void rgb24_to_rgb565(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width; i++) {
+		uint16_t p = rgb_to_rgb565(&in[i * 3]);
+
+		out[i * 2 + 0] = p & 0xff;
+		out[i * 2 + 1] = p >> 8;
+	}
+}
+
+static void rgb565_to_rgb24(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width; i++) {
+		uint16_t p = in[i * 2] | (in[i * 2 + 1] << 8);
+		uint8_t r = (p >> 11) & 0x1f;
+		uint8_t g = (p >> 5) & 0x3f;
+		uint8_t b = p & 0x1f;
+
+		/* Replicate the high bits so that full intensity maps to 0xff */
+		out[i * 3 + 0] = (r << 3) | (r >> 2);
+		out[i * 3 + 1] = (g << 2) | (g >> 4);
+		out[i * 3 + 2] = (b << 3) | (b >> 2);
+	}
+}
+
+static void rgb24_to_yuyv(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width / 2; i++) {
+		const uint8_t *rgb = &in[i * 6];
+		/* Chroma of the average of both pixels */
+		int32_t r = (rgb[0] + rgb[3] + 1) / 2;
+		int32_t g = (rgb[1] + rgb[4] + 1) / 2;
+		int32_t b = (rgb[2] + rgb[5] + 1) / 2;
+
+		out[i * 4 + 0] = rgb_to_y(&rgb[0]);
+		out[i * 4 + 1] = clamp_u8(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+		out[i * 4 + 2] = rgb_to_y(&rgb[3]);
+		out[i * 4 + 3] = clamp_u8(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+	}
+}
+
+static void swap16(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width; i++) {
+		out[i * 2 + 0] = in[i * 2 + 1];
+		out[i * 2 + 1] = in[i * 2 + 0];
+	}
+}
+
+static void swap24(const uint8_t *restrict in, uint8_t *restrict out, uint32_t width)
+{
+	for (uint32_t i = 0; i < width; i++) {
+		out[i * 3 + 0] = in[i * 3 + 2];
+		out[i * 3 + 1] = in[i * 3 + 1];
+		out[i * 3 + 2] = in[i * 3 + 0];
+	}
+}
+
+static const struct {
+	uint32_t in;
+	uint32_t out;
+	video_convert_line_t line;
+} video_convert_lines[] = {
+	{VIDEO_PIX_FMT_YUYV, VIDEO_PIX_FMT_RGB24, yuyv_to_rgb24},
+	{VIDEO_PIX_FMT_YUYV, VIDEO_PIX_FMT_RGB565, yuyv_to_rgb565},
+	{VIDEO_PIX_FMT_YUYV, VIDEO_PIX_FMT_GREY, yuyv_to_grey},
+	{VIDEO_PIX_FMT_RGB24, VIDEO_PIX_FMT_RGB565, rgb24_to_rgb565},
+	{VIDEO_PIX_FMT_RGB24, VIDEO_PIX_FMT_YUYV, rgb24_to_yuyv},
+	{VIDEO_PIX_FMT_RGB565, VIDEO_PIX_FMT_RGB24, rgb565_to_rgb24},
+	{VIDEO_PIX_FMT_RGB565, VIDEO_PIX_FMT_RGB565X, swap16},
+	{VIDEO_PIX_FMT_RGB565X, VIDEO_PIX_FMT_RGB565, swap16},
+	{VIDEO_PIX_FMT_RGB24, VIDEO_PIX_FMT_BGR24, swap24},
+	{VIDEO_PIX_FMT_BGR24, VIDEO_PIX_FMT_RGB24, swap24},
+};
+
+static video_convert_line_t video_convert_find(uint32_t in, uint32_t out)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(video_convert_lines); i++) {
+		if (video_convert_lines[i].in == in && video_convert_lines[i].out == out) {
+			return video_convert_lines[i].line;
+		}
+	}
+
+	return NULL;
+}
+
+/* Size of the smallest horizontal unit of pixels, in bytes and pixels */
+static int video_convert_unit(uint32_t pixfmt, size_t *bytes, uint32_t *pixels)
+{
+	unsigned int bits = video_bits_per_pixel(pixfmt);
+
+	if (pixfmt == VIDEO_PIX_FMT_YUYV) {
+		/* Two pixels share the chroma */
+		*bytes = 4;
+		*pixels = 2;
+		return 0;
+	}
+
+	if (bits == 0 || bits % 8 != 0) {
+		return -ENOTSUP;
+	}
+
+	*bytes = bits / 8;
+	*pixels = 1;
+	return 0;
+}
+
+static void video_convert_scale(const struct video_format *in_fmt, const uint8_t *in,
+				const struct video_format *out_fmt, uint8_t *out,
+				size_t unit_bytes, uint32_t unit_pixels)
+{
+	uint32_t in_units = in_fmt->width / unit_pixels;
+	uint32_t out_units = out_fmt->width / unit_pixels;
+
+	for (uint32_t y = 0; y < out_fmt->height; y++) {
+		const uint8_t *src = in + (size_t)(y * in_fmt->height / out_fmt->height) *
+					  in_fmt->pitch;
+		uint8_t *dst = out + (size_t)y * out_fmt->pitch;
+
+		for (uint32_t x = 0; x < out_units; x++) {
+			memcpy(&dst[x * unit_bytes], &src[(x * in_units / out_units) * unit_bytes],
+			       unit_bytes);
+		}
+	}
+}
+
+bool video_convert_supported(const struct video_format *in_fmt,
+			     const struct video_format *out_fmt)
+{
+	size_t bytes;
+	uint32_t pixels;
+
+	if (in_fmt->pixelformat == out_fmt->pixelformat) {
+		return video_convert_unit(in_fmt->pixelformat, &bytes, &pixels) == 0;
+	}
+
+	return in_fmt->width == out_fmt->width && in_fmt->height == out_fmt->height &&
+	       video_convert_find(in_fmt->pixelformat, out_fmt->pixelformat) != NULL;
+}
+
+int video_convert(const struct video_format *in_fmt, const uint8_t *in,
+		  const struct video_format *out_fmt, uint8_t *out)
+{
+	video_convert_line_t line;
+	size_t in_line = (size_t)in_fmt->width * video_bits_per_pixel(in_fmt->pixelformat) / 8;
+	size_t out_line = (size_t)out_fmt->width * video_bits_per_pixel(out_fmt->pixelformat) / 8;
+
+	if (!video_convert_supported(in_fmt, out_fmt)) {
+		return -ENOTSUP;
+	}
+
+	if (in_fmt->pitch < in_line || out_fmt->pitch < out_line) {
+		return -EINVAL;
+	}
+
+	if (in_fmt->pixelformat == out_fmt->pixelformat) {
+		size_t unit_bytes = 0;
+		uint32_t unit_pixels = 1;
+
+		(void)video_convert_unit(in_fmt->pixelformat, &unit_bytes, &unit_pixels);
+
+		if (in_fmt->width == out_fmt->width && in_fmt->height == out_fmt->height) {
+			for (uint32_t y = 0; y < in_fmt->height; y++) {
+				memcpy(out + (size_t)y * out_fmt->pitch,
+				       in + (size_t)y * in_fmt->pitch, in_line);
+			}
+		} else {
+			video_convert_scale(in_fmt, in, out_fmt, out, unit_bytes, unit_pixels);
+		}
+
+		return 0;
+	}
+
+	line = video_convert_find(in_fmt->pixelformat, out_fmt->pixelformat);
+
+	if (in_fmt->pitch == in_line && out_fmt->pitch == out_line) {
+		/* Contiguous frames, convert as a single long line */
+		line(in, out, in_fmt->width * in_fmt->height);
+		return 0;
+	}
+
+	for (uint32_t y = 0; y < in_fmt->height; y++) {
+		line(in + (size_t)y * in_fmt->pitch, out + (size_t)y * out_fmt->pitch,
+		     in_fmt->width);
+	}
+
+	return 0;
+}
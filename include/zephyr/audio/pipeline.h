@@ -0,0 +1,219 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public Audio Pipeline API
+ */
+
+#ifndef ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_
+#define ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Public Audio Pipeline API
+ * @defgroup audio_pipeline Audio Pipeline
+ * @ingroup audio_interface
+ * @{
+ */
+
+struct audio_pipeline_stage;
+
+/**
+ * @brief Process a block of audio samples in place.
+ *
+ * The block belongs to the pipeline for the duration of the call. The stage
+ * may change the amount of valid data, e.g. for sample rate conversion, up
+ * to the size of the memory slab blocks.
+ *
+ * @param stage Pointer to the stage
+ * @param block Pointer to the samples
+ * @param size Pointer to the number of valid bytes in the block
+ * @param capacity Size of the block in bytes
+ *
+ * @retval 0 to pass the block to the next stage
+ * @retval positive value to drop the block, e.g. for silence suppression
+ * @retval negative errno code to drop the block and count an error
+ */
+typedef int (*audio_pipeline_process_t)(struct audio_pipeline_stage *stage, void *block,
+					size_t *size, size_t capacity);
+
+/** Audio pipeline stage statistics */
+struct audio_pipeline_stage_stats {
+	/** Number of blocks processed */
+	uint32_t blocks;
+	/** Number of blocks dropped by the stage */
+	uint32_t dropped;
+	/** Number of errors returned by the stage */
+	uint32_t errors;
+	/** Time spent in the stage, in cycles */
+	uint64_t cycles;
+	/** Longest time spent on a single block, in cycles */
+	uint32_t max_cycles;
+};
+
+/** Audio pipeline processing stage */
+struct audio_pipeline_stage {
+	/** Name of the stage, for diagnostics */
+	const char *name;
+	/** Processing function */
+	audio_pipeline_process_t process;
+	/** Private data of the stage */
+	void *user_data;
+	/** @cond INTERNAL_HIDDEN */
+	struct audio_pipeline_stage_stats stats;
+	/** @endcond */
+};
+
+/** Audio pipeline statistics */
+struct audio_pipeline_stats {
+	/** Number of blocks read from the source */
+	uint32_t blocks;
+	/** Number of blocks that did not reach the sink */
+	uint32_t dropped;
+	/** Time from reading a block to queuing it to the sink, for the last block, in us */
+	uint32_t last_latency_us;
+	/** Longest time from reading a block to queuing it to the sink, in us */
+	uint32_t max_latency_us;
+};
+
+/**
+ * @brief Audio pipeline
+ *
+ * The members are internal, use the functions below to access them.
+ */
+struct audio_pipeline {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *rx_dev;
+	const struct device *tx_dev;
+	struct k_mem_slab *slab;
+	struct audio_pipeline_stage *stages;
+	size_t num_stages;
+	struct k_thread thread;
+	struct k_spinlock lock;
+	struct audio_pipeline_stats stats;
+	atomic_t running;
+	bool thread_created;
+	bool tx_started;
+	int status;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize an audio pipeline.
+ *
+ * Blocks are read from the RX direction of @p rx_dev, passed by reference
+ * through the stages in array order and queued to the TX direction of
+ * @p tx_dev, without being copied.
+ *
+ * Both directions must be configured with the same memory slab, since the
+ * transmitter frees the blocks to its own slab once they have been sent.
+ * If @p tx_dev is NULL, the blocks are freed after the last stage, e.g.
+ * for analysis only pipelines.
+ *
+ * @param pipe Pointer to the audio pipeline
+ * @param rx_dev I2S device to read the blocks from
+ * @param tx_dev I2S device to write the blocks to, or NULL
+ * @param stages Array of processing stages, must remain valid while the
+ *               pipeline is initialized
+ * @param num_stages Number of stages in @p stages
+ *
+ * @retval 0 on success
+ * @retval -ENODEV if a device is not ready
+ * @retval -EINVAL if the RX direction is not configured, or if both
+ *                 directions do not use the same memory slab
+ */
+int audio_pipeline_init(struct audio_pipeline *pipe, const struct device *rx_dev,
+			const struct device *tx_dev, struct audio_pipeline_stage *stages,
+			size_t num_stages);
+
+/**
+ * @brief Start the audio pipeline thread.
+ *
+ * The RX direction must be started by the caller. The TX direction is
+ * started by the pipeline once the first block has been queued to it.
+ *
+ * The pipeline thread runs until audio_pipeline_stop() is called or an
+ * I2S error occurs, in which case audio_pipeline_status() returns the error.
+ *
+ * @param pipe Pointer to the audio pipeline
+ * @param stack Stack of the pipeline thread
+ * @param stack_size Size of @p stack
+ * @param prio Priority of the pipeline thread, usually a cooperative or
+ *             high preemptive priority
+ *
+ * @retval 0 on success
+ * @retval -EBUSY if the pipeline is already running
+ */
+int audio_pipeline_start(struct audio_pipeline *pipe, k_thread_stack_t *stack,
+			 size_t stack_size, int prio);
+
+/**
+ * @brief Stop the audio pipeline thread.
+ *
+ * Waits until the pipeline thread exits, which happens after the block being
+ * processed has been passed to the sink, or when the next read from the source
+ * times out. The I2S streams are not stopped.
+ *
+ * @param pipe Pointer to the audio pipeline
+ *
+ * @return 0 on success, negative errno code from k_thread_join() otherwise
+ */
+int audio_pipeline_stop(struct audio_pipeline *pipe);
+
+/**
+ * @brief Get the status of the audio pipeline.
+ *
+ * @param pipe Pointer to the audio pipeline
+ *
+ * @retval 0 if the pipeline is running or was stopped normally
+ * @retval negative errno code of the I2S error that stopped the pipeline
+ */
+int audio_pipeline_status(struct audio_pipeline *pipe);
+
+/**
+ * @brief Get the audio pipeline statistics.
+ *
+ * @param pipe Pointer to the audio pipeline
+ * @param stats Pointer to store the statistics
+ */
+void audio_pipeline_stats_get(struct audio_pipeline *pipe, struct audio_pipeline_stats *stats);
+
+/**
+ * @brief Get the statistics of a stage of the audio pipeline.
+ *
+ * @param pipe Pointer to the audio pipeline
+ * @param idx Index of the stage in the array passed to audio_pipeline_init()
+ * @param stats Pointer to store the statistics
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @p idx is out of range
+ */
+int audio_pipeline_stage_stats_get(struct audio_pipeline *pipe, size_t idx,
+				   struct audio_pipeline_stage_stats *stats);
+
+/**
+ * @brief Reset the statistics of the audio pipeline and of its stages.
+ *
+ * @param pipe Pointer to the audio pipeline
+ */
+void audio_pipeline_stats_reset(struct audio_pipeline *pipe);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_ */
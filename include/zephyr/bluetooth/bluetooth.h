@@ -2837,6 +2837,78 @@ int bt_le_scan_cb_register(struct bt_le_scan_cb *cb);
  */
 void bt_le_scan_cb_unregister(struct bt_le_scan_cb *cb);
 
+/**
+ * @brief Host filter of advertising reports.
+ *
+ * Advertising reports not passing the filter are not given to the scan
+ * callbacks, which saves the processing of the callbacks in dense
+ * environments.
+ */
+struct bt_le_scan_filter {
+	/**
+	 * @brief Duplicate filtering window in milliseconds.
+	 *
+	 * A report of the same type, from the same advertiser and advertising
+	 * set, with the same data as a report passed less than this time ago
+	 * is dropped. 0 disables duplicate filtering.
+	 */
+	uint32_t dup_window_ms;
+
+	/** Reports received with a lower RSSI, in dBm, are dropped. */
+	int8_t rssi_min;
+
+	/** Number of UUIDs of @ref bt_le_scan_filter.uuids. */
+	uint8_t uuid_count;
+
+	/**
+	 * @brief UUIDs of the services of interest.
+	 *
+	 * If not empty, only reports with advertising data containing one of
+	 * these UUIDs, in service UUID lists or as service data, are passed.
+	 * The UUIDs must remain valid while the filter is set.
+	 */
+	const struct bt_uuid *const *uuids;
+};
+
+/** @brief Statistics of the host filter of advertising reports. */
+struct bt_le_scan_filter_stats {
+	/** Number of reports checked against the filter. */
+	uint32_t received;
+	/** Number of reports dropped for their RSSI. */
+	uint32_t rssi_dropped;
+	/** Number of reports dropped for lack of the UUIDs of interest. */
+	uint32_t uuid_dropped;
+	/** Number of reports dropped as duplicates. */
+	uint32_t dup_dropped;
+};
+
+/**
+ * @brief Set the host filter of advertising reports.
+ *
+ * Set the filter applied to the advertising reports before they are given to
+ * the callback of @ref bt_le_scan_start and to the callbacks registered with
+ * @ref bt_le_scan_cb_register. Reports are filtered by RSSI, then by UUIDs,
+ * then as duplicates. The duplicate filter tracks up to
+ * @kconfig{CONFIG_BT_SCAN_FILTER_DUP_SIZE} advertisers, and may pass
+ * duplicates of advertisers not tracked anymore.
+ *
+ * Setting the filter clears the duplicate filter and the statistics.
+ *
+ * @note Requires @kconfig{CONFIG_BT_SCAN_FILTER}.
+ *
+ * @param filter Filter to apply, or NULL to pass all reports.
+ */
+void bt_le_scan_filter_set(const struct bt_le_scan_filter *filter);
+
+/**
+ * @brief Get the statistics of the host filter of advertising reports.
+ *
+ * @note Requires @kconfig{CONFIG_BT_SCAN_FILTER}.
+ *
+ * @param stats Statistics since the filter was set.
+ */
+void bt_le_scan_filter_stats_get(struct bt_le_scan_filter_stats *stats);
+
 /**
  * @brief Add device (LE) to filter accept list.
  *
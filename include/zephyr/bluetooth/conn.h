@@ -1075,6 +1075,46 @@ bool bt_conn_is_type(const struct bt_conn *conn, enum bt_conn_type type);
  */
 int bt_conn_get_remote_info(const struct bt_conn *conn, struct bt_conn_remote_info *remote_info);
 
+/** @brief Connection TX statistics */
+struct bt_conn_tx_stats {
+	/** Number of bytes handed to the controller, HCI fragment payloads. */
+	uint64_t bytes;
+	/** Number of HCI fragments handed to the controller. */
+	uint32_t frags;
+};
+
+/** @brief Get the TX statistics of a connection.
+ *
+ *  The statistics are counted since the connection was created. Sampling
+ *  @p stats periodically gives the throughput of the connection.
+ *
+ *  @note @kconfig{CONFIG_BT_CONN_TX_STATS} must be enabled.
+ *
+ *  @param conn Connection object.
+ *  @param stats Statistics of the connection.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_conn_get_tx_stats(const struct bt_conn *conn, struct bt_conn_tx_stats *stats);
+
+/** @brief Set the TX scheduling weight of a connection.
+ *
+ *  When several connections have data to send, each one may send up to
+ *  @p weight times @kconfig{CONFIG_BT_CONN_TX_SCHED_QUANTUM} bytes to the
+ *  controller before the next one is served, so that the controller buffers
+ *  are shared between connections in proportion of their weights. Connections
+ *  have a weight of 1 when created.
+ *
+ *  @note @kconfig{CONFIG_BT_CONN_TX_SCHED_DRR} must be enabled.
+ *
+ *  @param conn Connection object.
+ *  @param weight TX weight of the connection, at least 1.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ *  @return -EINVAL @p weight is 0.
+ */
+int bt_conn_set_tx_weight(struct bt_conn *conn, uint8_t weight);
+
 /** @brief Get connection transmit power level.
  *
  *  @param conn           @ref BT_CONN_TYPE_LE connection object.
@@ -1396,6 +1396,33 @@ struct bt_gatt_notify_params {
 int bt_gatt_notify_cb(struct bt_conn *conn,
 		      struct bt_gatt_notify_params *params);
 
+/** @brief Notify attribute value change to a set of subscribed connections.
+ *
+ *  This function works in the same way as @ref bt_gatt_notify_cb with a
+ *  NULL connection, notifying the connected peers subscribed to the
+ *  notifications of the attribute, but resolves the attribute and the
+ *  subscribed connections once for all the connections instead of for
+ *  each of them, which is cheaper with many connections.
+ *
+ *  The notifications may be restricted to a set of connections, as a
+ *  bitmap of their indexes returned by @ref bt_conn_index, defined with
+ *  ATOMIC_DEFINE(name, CONFIG_BT_MAX_CONN). Connections of the set that
+ *  are not subscribed are skipped.
+ *
+ *  The callback of the parameters is called for each notification sent.
+ *
+ *  @param conns Bitmap of the connections to notify, or NULL to notify all
+ *               subscribed connections.
+ *  @param params Notification parameters.
+ *
+ *  @retval 0 The notification was sent to one connection at least.
+ *  @retval -ENOTCONN No subscribed connection to notify.
+ *  @return Other negative value in case of error, the error of the last
+ *          connection if the notification could not be sent to any.
+ */
+int bt_gatt_notify_multicast(const atomic_t *conns,
+			     struct bt_gatt_notify_params *params);
+
 /** @brief Send multiple notifications in a single PDU.
  *
  *  The GATT Server will send a single ATT_MULTIPLE_HANDLE_VALUE_NTF PDU
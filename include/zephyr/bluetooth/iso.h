@@ -381,6 +381,35 @@ struct bt_iso_tx_info {
 	uint16_t seq_num;
 };
 
+/** @brief ISO transmission latency statistics
+ *
+ *  Latencies are measured from the sending of an SDU with bt_iso_chan_send() or
+ *  bt_iso_chan_send_ts() to its completion reported by the controller.
+ */
+struct bt_iso_tx_latency {
+	/** Number of completed SDUs */
+	uint32_t count;
+
+	/** Minimum latency, in microseconds */
+	uint32_t min;
+
+	/** Maximum latency, in microseconds */
+	uint32_t max;
+
+	/** Sum of the latencies, in microseconds */
+	uint64_t total;
+
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+	/** @brief Latency histogram
+	 *
+	 *  Bucket i counts the latencies from i to i + 1 times
+	 *  CONFIG_BT_ISO_TX_LATENCY_BUCKET_US microseconds, the last bucket
+	 *  every latency beyond.
+	 */
+	uint32_t hist[CONFIG_BT_ISO_TX_LATENCY_BUCKETS];
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
+};
+
 
 /** Opaque type representing an Connected Isochronous Group (CIG). */
 struct bt_iso_cig;
@@ -1231,6 +1260,26 @@ int bt_iso_chan_get_info(const struct bt_iso_chan *chan, struct bt_iso_info *inf
  */
 int bt_iso_chan_get_tx_sync(const struct bt_iso_chan *chan, struct bt_iso_tx_info *info);
 
+/**
+ * @brief Get ISO transmission latency statistics
+ *
+ * @details Reads the latency statistics of the SDUs sent on an ISO channel since it was
+ *          connected, or since the statistics were last reset.
+ *
+ * @note Requires @kconfig{CONFIG_BT_ISO_TX_LATENCY_STATS}.
+ *
+ * @param[in]  chan    Channel object.
+ * @param[out] latency Latency statistics object.
+ * @param[in]  reset   Reset the statistics of the channel after reading them.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ * @retval -ENOTCONN The channel is not connected.
+ * @retval -ENOTSUP @kconfig{CONFIG_BT_ISO_TX_LATENCY_STATS} is not enabled.
+ */
+int bt_iso_chan_get_tx_latency(const struct bt_iso_chan *chan, struct bt_iso_tx_latency *latency,
+			       bool reset);
+
 /**
  * @brief Struct to hold the Broadcast Isochronous Group callbacks
  *
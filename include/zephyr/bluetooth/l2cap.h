@@ -551,7 +551,10 @@ struct bt_l2cap_chan_ops {
 	 *  buffers to store incoming data. Channels that requires segmentation
 	 *  must set this callback.
 	 *  If the application has not set a callback the L2CAP SDU MTU will be
-	 *  truncated to @ref BT_L2CAP_SDU_RX_MTU.
+	 *  truncated to @ref BT_L2CAP_SDU_RX_MTU, unless
+	 *  @kconfig{CONFIG_BT_L2CAP_SDU_FRAGS} is enabled, in which case
+	 *  segmented SDUs are received as a chain of the buffers of their
+	 *  PDUs.
 	 *
 	 *  @param chan The channel requesting a buffer.
 	 *
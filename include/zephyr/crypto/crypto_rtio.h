@@ -0,0 +1,99 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_CRYPTO_CRYPTO_RTIO_H_
+#define ZEPHYR_INCLUDE_CRYPTO_CRYPTO_RTIO_H_
+
+#include <zephyr/crypto/crypto.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Crypto RTIO API
+ * @defgroup crypto_rtio_api Crypto RTIO API
+ * @ingroup crypto
+ * @{
+ */
+
+/**
+ * @brief RTIO I/O device API of cipher sessions
+ *
+ * Submissions to a cipher session I/O device are executed on the RTIO work queue,
+ * using the synchronous cipher API, and are completed with:
+ *
+ * - @ref RTIO_OP_CRYPTO_AEAD: the length of the output of the packet, once it has
+ *   been encrypted or decrypted by cipher_ccm_op() or cipher_gcm_op(), depending
+ *   on the mode of the session.
+ *
+ * Submissions that are not chained may be executed concurrently by the work queue
+ * threads. Drivers do not support concurrent operations on the same session, so the
+ * submissions to a session must be chained, while those to different sessions can
+ * run in parallel. Failures complete the submission with a negative errno code.
+ */
+extern const struct rtio_iodev_api crypto_rtio_iodev_api;
+
+/**
+ * @brief Statically define an RTIO I/O device for a cipher session
+ *
+ * The session must be set up with cipher_begin_session(), with the
+ * @ref CAP_SYNC_OPS flag, before submitting operations to the I/O device, and
+ * must not be freed until they have completed.
+ *
+ * @param name Name of the I/O device
+ * @param ctx Pointer to the session context, a @ref cipher_ctx
+ */
+#define CRYPTO_RTIO_IODEV_DEFINE(name, ctx) RTIO_IODEV_DEFINE(name, &crypto_rtio_iodev_api, ctx)
+
+/**
+ * @brief Initialize an RTIO I/O device for a cipher session at runtime
+ *
+ * @param iodev I/O device to initialize
+ * @param ctx Pointer to the session context
+ */
+static inline void crypto_rtio_iodev_init(struct rtio_iodev *iodev, struct cipher_ctx *ctx)
+{
+	iodev->api = &crypto_rtio_iodev_api;
+	iodev->data = ctx;
+}
+
+/**
+ * @brief Prepare an AEAD operation submission
+ *
+ * The packet is encrypted or decrypted, as set up for the session. The packet, its
+ * buffers and the nonce must remain valid until the submission has completed.
+ *
+ * @param sqe Submission to prepare
+ * @param iodev I/O device of the cipher session
+ * @param prio Priority of the submission
+ * @param pkt AEAD packet, holding the input, output, associated data and tag buffers
+ * @param nonce Nonce of the operation
+ * @param userdata User data returned in the completion
+ */
+static inline void crypto_rtio_sqe_prep_aead(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					     int8_t prio, struct cipher_aead_pkt *pkt,
+					     uint8_t *nonce, void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_CRYPTO_AEAD;
+	sqe->prio = prio;
+	sqe->iodev = iodev;
+	sqe->crypto_aead.pkt = pkt;
+	sqe->crypto_aead.nonce = nonce;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_CRYPTO_CRYPTO_RTIO_H_ */
@@ -13,6 +13,10 @@
 #include <zephyr/types.h>
 #include <sys/types.h>
 
+#if defined(CONFIG_NET_BUF)
+#include <zephyr/sys_clock.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -699,6 +703,105 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+#if defined(CONFIG_JSON_LIBRARY_STREAM) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+
+struct json_stream_frame {
+	/* Object fields or array element, NULL when the value is skipped */
+	const struct json_obj_descr *descr;
+	/* Number of object fields or maximum number of array elements */
+	size_t descr_len;
+	void *val;
+	/* Array: next element and its size, and number of elements */
+	char *field;
+	ptrdiff_t elem_size;
+	size_t *elements;
+	/* Object: decoded fields and field of the current key, -1 if none */
+	int64_t decoded;
+	int8_t cur;
+	bool is_array;
+	bool nested;
+	uint8_t state;
+};
+
+/** @endcond */
+
+/**
+ * @brief State of a streaming JSON object parser
+ *
+ * To be initialized with @ref json_stream_init. The members are internal.
+ */
+struct json_stream {
+	/** @cond INTERNAL_HIDDEN */
+	struct json_stream_frame stack[CONFIG_JSON_LIBRARY_STREAM_MAX_DEPTH];
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	void *val;
+	int64_t result;
+	uint8_t depth;
+	uint8_t lex_state;
+	uint8_t hex_digits;
+	bool overflow;
+	/* Where the current string or literal goes, NULL to discard it */
+	char *sink;
+	size_t sink_size;
+	size_t len;
+	char tok[CONFIG_JSON_LIBRARY_STREAM_TOKEN_LEN + 1];
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize the streaming parsing of a JSON-encoded object
+ *
+ * The object is then given in chunks of any size to @ref json_stream_feed,
+ * which decodes the values as they are complete, so that the document
+ * does not have to be buffered. Values are decoded according to the
+ * descriptor pointed to by @a descr into the struct pointed to by @a val,
+ * as with @ref json_obj_parse.
+ *
+ * As the chunks do not outlive the call, only the types copying their value
+ * are supported: numbers, booleans, JSON_TOK_STRING_BUF strings, objects
+ * and arrays of these. Fields of other types make the parsing fail with
+ * -ENOTSUP when present in the document. A string or number does not have
+ * to fit in a single chunk, but numbers and keys are limited to
+ * @kconfig{CONFIG_JSON_LIBRARY_STREAM_TOKEN_LEN} characters and objects and
+ * arrays to @kconfig{CONFIG_JSON_LIBRARY_STREAM_MAX_DEPTH} levels.
+ *
+ * @param stream Parser state
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array. Must be less
+ * than 63.
+ * @param val Pointer to the struct to hold the decoded values
+ */
+void json_stream_init(struct json_stream *stream, const struct json_obj_descr *descr,
+		      size_t descr_len, void *val);
+
+/**
+ * @brief Parse the next chunk of a JSON-encoded object
+ *
+ * @param stream Parser state initialized with @ref json_stream_init
+ * @param data Next bytes of the document
+ * @param len Number of bytes in @a data
+ *
+ * @return 0 if more data is expected, 1 once the object is complete (any
+ * further data is ignored), or a negative error code, which is returned
+ * again by any further call.
+ */
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Get the result of the streaming parsing of a JSON-encoded object
+ *
+ * @param stream Parser state
+ *
+ * @return < 0 if error, -EAGAIN if the object is not complete yet, or the
+ * bitmap of decoded fields as returned by @ref json_obj_parse.
+ */
+int64_t json_stream_result(const struct json_stream *stream);
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -779,6 +882,47 @@ int json_obj_encode_buf(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode_buf(const struct json_obj_descr *descr, const void *val,
 			char *buffer, size_t buf_size);
 
+#if defined(CONFIG_NET_BUF) || defined(__DOXYGEN__)
+struct net_buf;
+
+/**
+ * @brief Encodes an object at the end of a network buffer
+ *
+ * The object is encoded in a single pass, with no need to compute its
+ * length first: fragments are added to @p buf as needed, from the pool
+ * of its last fragment.
+ *
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array
+ * @param val Struct holding the values
+ * @param buf Network buffer, the JSON data is appended to its last fragment
+ * @param timeout Time to wait for a new fragment
+ *
+ * @return 0 if object has been successfully encoded. A negative value
+ * indicates an error (as defined on errno.h), @p buf then holds part of
+ * the JSON data.
+ */
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf, k_timeout_t timeout);
+
+/**
+ * @brief Encodes an array at the end of a network buffer
+ *
+ * As @ref json_obj_encode_net_buf, for an array.
+ *
+ * @param descr Pointer to the descriptor array
+ * @param val Struct holding the values
+ * @param buf Network buffer, the JSON data is appended to its last fragment
+ * @param timeout Time to wait for a new fragment
+ *
+ * @return 0 if object has been successfully encoded. A negative value
+ * indicates an error (as defined on errno.h), @p buf then holds part of
+ * the JSON data.
+ */
+int json_arr_encode_net_buf(const struct json_obj_descr *descr, const void *val,
+			    struct net_buf *buf, k_timeout_t timeout);
+#endif /* CONFIG_NET_BUF */
+
 /**
  * @brief Encodes an object using an arbitrary writer function
  *
@@ -151,6 +151,8 @@ struct coredump_cmd_copy_arg {
 
 #define	COREDUMP_MEM_HDR_ID		'M'
 #define COREDUMP_MEM_HDR_VER		1
+/* Memory block with the content compressed */
+#define COREDUMP_MEM_HDR_VER_COMPRESSED	2
 
 /* Target code */
 enum coredump_tgt_code {
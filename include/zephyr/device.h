@@ -492,6 +492,9 @@ typedef uint8_t device_flags_t;
 /** Device initialization is deferred */
 #define DEVICE_FLAG_INIT_DEFERRED BIT(0)
 
+/** Device may be initialized in parallel with other devices */
+#define DEVICE_FLAG_INIT_PARALLEL BIT(1)
+
 /** @} */
 
 /** Device operations */
@@ -929,7 +932,8 @@ __syscall int device_deinit(const struct device *dev);
  * @param node_id Devicetree node identifier.
  */
 #define Z_DEVICE_DT_FLAGS(node_id)                                             \
-	(DT_PROP_OR(node_id, zephyr_deferred_init, 0U) * DEVICE_FLAG_INIT_DEFERRED)
+	((DT_PROP_OR(node_id, zephyr_deferred_init, 0U) * DEVICE_FLAG_INIT_DEFERRED) | \
+	 (DT_PROP_OR(node_id, zephyr_parallel_init, 0U) * DEVICE_FLAG_INIT_PARALLEL))
 
 #if defined(CONFIG_DEVICE_DEPS) || defined(__DOXYGEN__)
 
@@ -29,10 +29,46 @@
 extern "C" {
 #endif
 
+#if defined(CONFIG_IMG_DELTA) || defined(__DOXYGEN__)
+/**
+ * @brief State of the delta image decoder
+ *
+ * Users should treat this structure as opaque.
+ */
+struct flash_img_delta {
+	const struct flash_area *source;	/** Flash area of the base image */
+	uint32_t image_size;			/** Size of the image to reconstruct */
+	uint32_t image_off;			/** Bytes of the image reconstructed */
+	uint32_t source_off;			/** Offset in the base image */
+	uint32_t count;				/** Bytes left in the current step */
+	uint32_t value;				/** Value of the field being decoded */
+	uint8_t shift;				/** Bit position in the varint */
+	uint8_t state;				/** Patch decoder state */
+	uint8_t lz_state;			/** Decompressor state */
+	uint8_t lz_token;			/** Current sequence token */
+	uint32_t lz_len;			/** Length being decoded */
+	uint16_t lz_offset;			/** Match offset */
+	uint16_t lz_window_size;		/** Window size of the patch */
+	uint32_t lz_pos;			/** Bytes produced by the decompressor */
+	uint8_t lz_window[1U << CONFIG_IMG_DELTA_WINDOW_BITS]; /** Decompressed data */
+	uint8_t src_buf[CONFIG_IMG_DELTA_BUF_SIZE]; /** Base image data */
+	uint32_t src_buf_off;			/** Base image offset of src_buf */
+	uint16_t src_buf_len;			/** Valid bytes in src_buf */
+	uint16_t out_len;			/** Bytes in out_buf */
+	uint8_t out_buf[CONFIG_IMG_DELTA_BUF_SIZE]; /** Image data to write */
+};
+#endif
+
 struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
+#if defined(CONFIG_STREAM_FLASH_DOUBLE_BUFFER)
+	uint8_t flash_buf[CONFIG_IMG_BLOCK_BUF_SIZE];
+#endif
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#if defined(CONFIG_IMG_DELTA)
+	struct flash_img_delta delta;
+#endif
 };
 
 /**
@@ -65,6 +101,27 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id);
  */
 int flash_img_init(struct flash_img_context *ctx);
 
+/**
+ * @brief Initialize context needed for reconstructing an image from a delta patch.
+ *
+ * The data given to flash_img_buffered_write() is then a delta patch, created
+ * with scripts/dfu/img_delta.py from the image in the @p source_area_id
+ * partition, typically the running one, and the new image. The new image is
+ * written to the @p area_id partition as the patch is received, and
+ * flash_img_bytes_written() returns the number of bytes of the new image
+ * written. The flush fails with -EINVAL if the patch is incomplete.
+ *
+ * The function is enabled via CONFIG_IMG_DELTA Kconfig option.
+ *
+ * @param ctx            context to be initialized
+ * @param area_id        flash area id of partition where the image should be written
+ * @param source_area_id flash area id of partition of the base image
+ *
+ * @return  0 on success, negative errno code on fail
+ */
+int flash_img_delta_init_id(struct flash_img_context *ctx, uint8_t area_id,
+			    uint8_t source_area_id);
+
 /**
  * @brief Read number of bytes of the image written to the flash.
  *
@@ -0,0 +1,187 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public Damage Tracking Framebuffer API
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_DAMAGE_FB_H_
+#define ZEPHYR_INCLUDE_DISPLAY_DAMAGE_FB_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Public Damage Tracking Framebuffer API
+ * @defgroup damage_tracking_framebuffer Damage Tracking Framebuffer
+ * @ingroup utilities
+ * @{
+ */
+
+/** Rectangular area of the display */
+struct damage_fb_rect {
+	/** Position of the left edge in pixels */
+	uint16_t x;
+	/** Position of the top edge in pixels */
+	uint16_t y;
+	/** Width in pixels */
+	uint16_t width;
+	/** Height in pixels */
+	uint16_t height;
+};
+
+/** Damage tracking framebuffer statistics */
+struct damage_fb_stats {
+	/** Number of flushes that wrote at least one area */
+	uint32_t frames;
+	/** Number of display writes */
+	uint32_t writes;
+	/** Number of pixels written to the display */
+	uint64_t pixels;
+	/** Time spent in the display writes, in microseconds */
+	uint64_t write_time_us;
+	/** Duration of the last flush, in microseconds */
+	uint32_t last_flush_us;
+	/** Frames per second since the statistics were reset, times 100 */
+	uint32_t fps_x100;
+};
+
+/**
+ * @brief Damage tracking framebuffer
+ *
+ * The members are internal, use the functions below to access them.
+ */
+struct damage_fb {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *dev;
+	uint8_t *buf;
+	uint8_t *stage;
+	size_t stage_size;
+	uint16_t width;
+	uint16_t height;
+	uint8_t bpp;
+	uint8_t num_rects;
+	struct damage_fb_rect rects[CONFIG_DAMAGE_FRAMEBUFFER_MAX_RECTS];
+	struct k_mutex lock;
+	struct damage_fb_stats stats;
+	int64_t stats_start;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a damage tracking framebuffer.
+ *
+ * The framebuffer memory must hold a full frame in the current pixel format
+ * of the display. Only pixel formats with an integer number of bytes per pixel
+ * are supported.
+ *
+ * If a staging buffer is provided, damaged areas that are narrower than the
+ * display are packed into it before they are written, so that the display
+ * driver can send each strip in a single transfer instead of one transfer
+ * per line. The staging buffer should be DMA capable for drivers that use
+ * DMA and must hold at least one line of the display.
+ *
+ * @param fb Pointer to the damage tracking framebuffer
+ * @param dev Pointer to device structure for driver instance
+ * @param buf Pointer to the framebuffer memory
+ * @param size Size of the framebuffer memory in bytes
+ * @param stage Pointer to the staging buffer, or NULL
+ * @param stage_size Size of the staging buffer in bytes
+ *
+ * @retval 0 on success
+ * @retval -ENOTSUP if the pixel format of the display is not supported
+ * @retval -ENOMEM if a buffer is too small
+ */
+int damage_fb_init(struct damage_fb *fb, const struct device *dev,
+		   void *buf, size_t size, void *stage, size_t stage_size);
+
+/**
+ * @brief Get the framebuffer memory.
+ *
+ * Drawing into the memory directly must be followed by a call to
+ * damage_fb_damage() for the modified area.
+ *
+ * @param fb Pointer to the damage tracking framebuffer
+ * @param pitch Pointer to store the number of pixels per line, or NULL
+ *
+ * @return Pointer to the framebuffer memory
+ */
+void *damage_fb_get_buffer(struct damage_fb *fb, uint16_t *pitch);
+
+/**
+ * @brief Mark an area of the framebuffer as damaged.
+ *
+ * The area is clipped to the display and merged with the damaged areas it
+ * overlaps or touches. When there are no free slots left, it is merged with
+ * the area that grows the least.
+ *
+ * @param fb Pointer to the damage tracking framebuffer
+ * @param x Position of the left edge, may be negative
+ * @param y Position of the top edge, may be negative
+ * @param width Width of the area in pixels
+ * @param height Height of the area in pixels
+ */
+void damage_fb_damage(struct damage_fb *fb, int32_t x, int32_t y,
+		      uint16_t width, uint16_t height);
+
+/**
+ * @brief Copy pixel data into the framebuffer and mark the area as damaged.
+ *
+ * The data uses the same layout as for display_write().
+ *
+ * @param fb Pointer to the damage tracking framebuffer
+ * @param x Position of the left edge of the area
+ * @param y Position of the top edge of the area
+ * @param desc Pointer to a structure describing the buffer layout
+ * @param buf Pointer to buffer with the pixel data
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the area is outside of the display
+ */
+int damage_fb_write(struct damage_fb *fb, uint16_t x, uint16_t y,
+		    const struct display_buffer_descriptor *desc,
+		    const void *buf);
+
+/**
+ * @brief Write the damaged areas to the display.
+ *
+ * @param fb Pointer to the damage tracking framebuffer
+ *
+ * @return 0 on success, negative value from display_write() otherwise.
+ *         The areas that could not be written remain damaged.
+ */
+int damage_fb_flush(struct damage_fb *fb);
+
+/**
+ * @brief Get the framebuffer statistics.
+ *
+ * @param fb Pointer to the damage tracking framebuffer
+ * @param stats Pointer to store the statistics
+ */
+void damage_fb_stats_get(struct damage_fb *fb, struct damage_fb_stats *stats);
+
+/**
+ * @brief Reset the framebuffer statistics.
+ *
+ * @param fb Pointer to the damage tracking framebuffer
+ */
+void damage_fb_stats_reset(struct damage_fb *fb);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_DAMAGE_FB_H_ */
@@ -385,6 +385,50 @@ struct can_driver_config {
 #define CAN_DT_DRIVER_CONFIG_INST_GET(inst, _min_bitrate, _max_bitrate)				\
 	CAN_DT_DRIVER_CONFIG_GET(DT_DRV_INST(inst), _min_bitrate, _max_bitrate)
 
+#if defined(CONFIG_CAN_SW_FILTER) || defined(__DOXYGEN__)
+/**
+ * @brief RX filter tracked by the common CAN software filter layer.
+ */
+struct can_sw_filter {
+	/** Filter as given to can_add_rx_filter(). */
+	struct can_filter filter;
+	/** Callback function pointer, or NULL if the entry is free. */
+	can_rx_callback_t callback;
+	/** Callback user data pointer. */
+	void *user_data;
+	/** Driver filter ID, valid if @a in_hw is true. */
+	int hw_id;
+	/** Index + 1 of the next entry of the same hash bucket or of the masked list, 0 if none. */
+	uint16_t next;
+	/** True if the filter is installed in the CAN controller. */
+	bool in_hw;
+	/** True if the filter matches a single CAN ID, i.e. it is in the hash table. */
+	bool exact;
+};
+
+/**
+ * @brief Common CAN software filter layer data.
+ *
+ * Filters that do not fit in the CAN controller are matched in software, against the frames
+ * received by an accept-all hardware filter. Filters matching a single CAN ID are looked up in a
+ * hash table, others in a list.
+ */
+struct can_sw_filters {
+	/** Protects the hash table and list against the RX path. */
+	struct k_spinlock lock;
+	/** Filter entries, indexed by the filter ID returned by can_add_rx_filter(). */
+	struct can_sw_filter filters[CONFIG_CAN_SW_FILTER_MAX];
+	/** Index + 1 of the first entry of each hash bucket, 0 if empty. */
+	uint16_t buckets[CONFIG_CAN_SW_FILTER_HASH_SIZE];
+	/** Index + 1 of the first entry of the masked list, 0 if empty. */
+	uint16_t masked;
+	/** Driver filter IDs of the accept-all filters, for standard and extended CAN IDs. */
+	int catch_all_id[2];
+	/** True if the accept-all filter for standard or extended CAN IDs is installed. */
+	bool catch_all[2];
+};
+#endif /* CONFIG_CAN_SW_FILTER */
+
 /**
  * @brief Common CAN controller driver data.
  *
@@ -400,6 +444,10 @@ struct can_driver_data {
 	can_state_change_callback_t state_change_cb;
 	/** State change callback user data pointer or NULL. */
 	void *state_change_cb_user_data;
+#if defined(CONFIG_CAN_SW_FILTER) || defined(__DOXYGEN__)
+	/** Software filter layer data. */
+	struct can_sw_filters sw_filters;
+#endif /* CONFIG_CAN_SW_FILTER */
 };
 
 /**
@@ -1298,6 +1346,9 @@ __syscall int can_send(const struct device *dev, const struct can_frame *frame,
  *
  * The same callback function can be used for multiple filters.
  *
+ * With @kconfig{CONFIG_CAN_SW_FILTER}, filters that do not fit in the CAN controller are
+ * matched in software, up to @kconfig{CONFIG_CAN_SW_FILTER_MAX} filters in total.
+ *
  * @param dev       Pointer to the device structure for the driver instance.
  * @param callback  This function is called by the CAN controller driver whenever
  *                  a frame matching the filter is received.
@@ -1365,12 +1416,14 @@ __syscall int can_add_rx_filter_msgq(const struct device *dev, struct k_msgq *ms
  */
 __syscall void can_remove_rx_filter(const struct device *dev, int filter_id);
 
+#ifndef CONFIG_CAN_SW_FILTER
 static inline void z_impl_can_remove_rx_filter(const struct device *dev, int filter_id)
 {
 	const struct can_driver_api *api = (const struct can_driver_api *)dev->api;
 
 	api->remove_rx_filter(dev, filter_id);
 }
+#endif /* !CONFIG_CAN_SW_FILTER */
 
 /**
  * @brief Get maximum number of RX filters
@@ -97,6 +97,14 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_ACCESS_CACHE) || defined(__DOXYGEN__)
+	/** Internally used sector size, 0 if the disk is not cached */
+	uint32_t cache_sector_size;
+	/** Internally used sector count */
+	uint32_t cache_sector_count;
+	/** Internally used sector following the last one accessed */
+	uint32_t cache_next_sector;
+#endif
 };
 
 /**
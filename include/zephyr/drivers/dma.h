@@ -90,9 +90,13 @@ enum dma_channel_filter {
  * @brief DMA attributes
  */
 enum dma_attribute_type {
+	/** Required alignment of the buffer addresses, in bytes */
 	DMA_ATTR_BUFFER_ADDRESS_ALIGNMENT,
+	/** Required alignment of the buffer sizes, in bytes */
 	DMA_ATTR_BUFFER_SIZE_ALIGNMENT,
+	/** Required alignment of memory to memory copies, in bytes */
 	DMA_ATTR_COPY_ALIGNMENT,
+	/** Maximum number of blocks in the transfer list of a channel */
 	DMA_ATTR_MAX_BLOCK_COUNT,
 };
 
@@ -717,6 +721,63 @@ static inline int dma_get_attribute(const struct device *dev, uint32_t type, uin
 	return -ENOSYS;
 }
 
+/**
+ * @brief Get the maximum number of blocks in the transfer list of a channel.
+ *
+ * Drivers that do not report @ref DMA_ATTR_MAX_BLOCK_COUNT are assumed to
+ * support a single block per transfer.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ *
+ * @return Maximum number of blocks that can be passed to dma_config().
+ */
+static inline uint32_t dma_get_max_block_count(const struct device *dev)
+{
+	uint32_t count;
+
+	if (dma_get_attribute(dev, DMA_ATTR_MAX_BLOCK_COUNT, &count) < 0 || count == 0) {
+		return 1;
+	}
+
+	return count;
+}
+
+/**
+ * @brief Link an array of blocks into the transfer list of a configuration.
+ *
+ * Chains the blocks in array order through their next_block pointers and
+ * sets the head block, the block count and the cyclic flag of @p cfg, so
+ * that a scatter-gather list or a ring of buffers (for example a ping-pong
+ * pair for audio) can be described without linking the blocks by hand.
+ *
+ * In cyclic mode the controller wraps around to the first block after the
+ * last one and keeps running until dma_stop() is called. The callback is
+ * invoked at the completion of every block, where the buffer that just
+ * completed can be processed while the next one is being transferred.
+ *
+ * The number of blocks supported by a controller can be queried with
+ * dma_get_max_block_count().
+ *
+ * @param cfg Pointer to the configuration to update.
+ * @param blocks Array of block configurations, all other members of the
+ *               blocks must be set by the caller.
+ * @param count Number of blocks in @p blocks, must be at least 1.
+ * @param cyclic True to run the transfer list as a ring.
+ */
+static inline void dma_config_blocks_set(struct dma_config *cfg, struct dma_block_config *blocks,
+					 size_t count, bool cyclic)
+{
+	for (size_t i = 0; i < count; i++) {
+		blocks[i].next_block = (i + 1 < count) ? &blocks[i + 1] : NULL;
+	}
+
+	cfg->head_block = blocks;
+	cfg->block_count = count;
+	cfg->cyclic = cyclic ? 1 : 0;
+}
+
 /**
  * @brief Look-up generic width index to be used in registers
  *
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief DMA transfers of network buffer chains
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_NET_BUF_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_NET_BUF_H_
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/net_buf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup dma_interface
+ * @{
+ */
+
+/**
+ * @brief Describe scatter-gather entries as DMA blocks.
+ *
+ * Fill one block per entry, linked with @c next_block, to transfer the data of
+ * entries exported with net_buf_iov_export() from memory to @p dest_address,
+ * without copying the data of the buffer chain. The first block is meant to be
+ * set as @c head_block of the @ref dma_config, with @c block_count set to the
+ * returned value. The channel must support linked blocks for more than one
+ * entry.
+ *
+ * The data of the entries is flushed from the data cache, as with
+ * net_buf_iov_cache_flush().
+ *
+ * @param blocks Blocks to fill
+ * @param block_count Number of blocks of @p blocks
+ * @param iov Scatter-gather entries
+ * @param iov_count Number of entries of @p iov
+ * @param dest_address Destination of the first block
+ * @param dest_increment If true, each block is written after the previous one,
+ *                       otherwise all blocks are written to @p dest_address,
+ *                       as for the data register of a peripheral.
+ *
+ * @retval Number of blocks used.
+ * @retval -ENOBUFS if there are more entries than blocks.
+ */
+static inline int dma_net_buf_iov_blocks(struct dma_block_config *blocks, size_t block_count,
+					 const struct net_buf_iov *iov, size_t iov_count,
+					 uintptr_t dest_address, bool dest_increment)
+{
+	if (iov_count > block_count) {
+		return -ENOBUFS;
+	}
+
+	net_buf_iov_cache_flush(iov, iov_count);
+
+	for (size_t i = 0; i < iov_count; i++) {
+		memset(&blocks[i], 0, sizeof(blocks[i]));
+		blocks[i].source_address = (uintptr_t)iov[i].base;
+		blocks[i].dest_address = dest_address;
+		blocks[i].block_size = iov[i].len;
+		blocks[i].source_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		blocks[i].dest_addr_adj =
+			dest_increment ? DMA_ADDR_ADJ_INCREMENT : DMA_ADDR_ADJ_NO_CHANGE;
+		blocks[i].next_block = (i + 1 < iov_count) ? &blocks[i + 1] : NULL;
+
+		if (dest_increment) {
+			dest_address += iov[i].len;
+		}
+	}
+
+	return iov_count;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_NET_BUF_H_ */
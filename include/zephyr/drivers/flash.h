@@ -26,6 +26,9 @@
 #include <stddef.h>
 #include <sys/types.h>
 #include <zephyr/device.h>
+#if defined(CONFIG_FLASH_ASYNC)
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -666,6 +669,111 @@ __syscall int flash_ex_op(const struct device *dev, uint16_t code,
 __syscall int flash_copy(const struct device *src_dev, off_t src_offset,
 			 const struct device *dst_dev, off_t dst_offset, off_t size, uint8_t *buf,
 			 size_t buf_size);
+#if defined(CONFIG_FLASH_ASYNC) || defined(__DOXYGEN__)
+/**
+ * @brief Completion callback of an asynchronous flash operation.
+ *
+ * Called from the asynchronous flash thread when the operation is done.
+ * The operation structure may be reused to queue another operation from the
+ * callback.
+ *
+ * @param dev Flash device.
+ * @param result Result of the operation, as returned by the matching
+ *               blocking function.
+ * @param user_data User data given when the operation was started.
+ */
+typedef void (*flash_async_cb_t)(const struct device *dev, int result, void *user_data);
+
+/**
+ * @brief Asynchronous flash operation.
+ *
+ * Storage for an operation queued with flash_read_async(),
+ * flash_write_async() or flash_erase_async(). It must remain valid until the
+ * completion callback is called. The members are internal.
+ */
+struct flash_async_op {
+	/** @cond INTERNAL_HIDDEN */
+	void *fifo_reserved;
+	const struct device *dev;
+	off_t offset;
+	union {
+		void *data;
+		const void *cdata;
+	};
+	size_t len;
+	flash_async_cb_t cb;
+	void *user_data;
+	uint8_t type;
+	/** @endcond */
+};
+
+/**
+ * @brief Queue a read of flash memory.
+ *
+ * Asynchronous version of flash_read(). Operations are executed one at a
+ * time by a dedicated thread in the order they were queued, so a read queued
+ * after a write or an erase returns the updated data.
+ *
+ * @note This function is not available to user mode threads.
+ *
+ * @param dev Flash device.
+ * @param offset Offset (byte aligned) to read.
+ * @param data Buffer to store the read data, valid until completion.
+ * @param len Number of bytes to read.
+ * @param op Operation storage, valid until completion.
+ * @param cb Completion callback.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 if the operation was queued.
+ * @retval -ENODEV if the device is not ready.
+ */
+int flash_read_async(const struct device *dev, off_t offset, void *data, size_t len,
+		     struct flash_async_op *op, flash_async_cb_t cb, void *user_data);
+
+/**
+ * @brief Queue a write to flash memory.
+ *
+ * Asynchronous version of flash_write(). Operations are executed in the
+ * order they were queued.
+ *
+ * @note This function is not available to user mode threads.
+ *
+ * @param dev Flash device.
+ * @param offset Starting offset for the write.
+ * @param data Data to write, valid until completion.
+ * @param len Number of bytes to write.
+ * @param op Operation storage, valid until completion.
+ * @param cb Completion callback.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 if the operation was queued.
+ * @retval -ENODEV if the device is not ready.
+ */
+int flash_write_async(const struct device *dev, off_t offset, const void *data, size_t len,
+		      struct flash_async_op *op, flash_async_cb_t cb, void *user_data);
+
+/**
+ * @brief Queue an erase of flash memory.
+ *
+ * Asynchronous version of flash_erase(). Operations are executed in the
+ * order they were queued.
+ *
+ * @note This function is not available to user mode threads.
+ *
+ * @param dev Flash device.
+ * @param offset Erase area starting offset.
+ * @param size Size of area to be erased.
+ * @param op Operation storage, valid until completion.
+ * @param cb Completion callback.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 if the operation was queued.
+ * @retval -ENODEV if the device is not ready.
+ */
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_op *op, flash_async_cb_t cb, void *user_data);
+#endif /* CONFIG_FLASH_ASYNC */
+
 /*
  *  Extended operation interface provides flexible way for supporting flash
  *  controller features. Code space is divided equally into Zephyr codes
@@ -149,6 +149,20 @@ struct mipi_dbi_config {
 };
 
 
+/**
+ * @brief Callback for asynchronous display buffer writes
+ *
+ * Called by the MIPI DBI controller once the buffer passed to
+ * @ref mipi_dbi_write_display_async has been sent, possibly from interrupt
+ * context.
+ *
+ * @param dev mipi dbi controller
+ * @param result 0 on success, negative errno code otherwise
+ * @param user_data user data passed to @ref mipi_dbi_write_display_async
+ */
+typedef void (*mipi_dbi_write_cb_t)(const struct device *dev, int result,
+				    void *user_data);
+
 /** MIPI-DBI host driver API */
 __subsystem struct mipi_dbi_driver_api {
 	int (*command_write)(const struct device *dev,
@@ -168,6 +182,14 @@ __subsystem struct mipi_dbi_driver_api {
 	int (*configure_te)(const struct device *dev,
 			    uint8_t edge,
 			    k_timeout_t delay);
+#if defined(CONFIG_MIPI_DBI_ASYNC) || defined(__DOXYGEN__)
+	int (*write_display_async)(const struct device *dev,
+				   const struct mipi_dbi_config *config,
+				   const uint8_t *framebuf,
+				   struct display_buffer_descriptor *desc,
+				   enum display_pixel_format pixfmt,
+				   mipi_dbi_write_cb_t cb, void *user_data);
+#endif
 };
 
 /**
@@ -269,6 +291,50 @@ static inline int mipi_dbi_write_display(const struct device *dev,
 	return api->write_display(dev, config, framebuf, desc, pixfmt);
 }
 
+#if defined(CONFIG_MIPI_DBI_ASYNC) || defined(__DOXYGEN__)
+/**
+ * @brief Write a display buffer to the display controller asynchronously.
+ *
+ * Same as @ref mipi_dbi_write_display, but returns once the transfer has
+ * been started. The framebuffer and the descriptor must stay valid until
+ * the callback is called, which allows the caller to render into a second
+ * buffer in the meantime. If a previous asynchronous write is still in
+ * progress, this function waits for it to complete before starting the new
+ * one. Synchronous functions called meanwhile also wait for the transfer to
+ * complete.
+ *
+ * @param dev mipi dbi controller
+ * @param config MIPI DBI configuration
+ * @param framebuf: framebuffer to write to display
+ * @param desc: descriptor of framebuffer to write. Note that the pitch must
+ *   be equal to width. "buf_size" field determines how many bytes will be
+ *   written.
+ * @param pixfmt: pixel format of framebuffer data
+ * @param cb: callback called once the buffer has been written
+ * @param user_data: user data passed to the callback
+ * @retval 0 buffer write started. The callback is called with the result.
+ * @retval -EIO I/O error
+ * @retval -EBUSY controller is busy
+ * @retval -ENOSYS not implemented
+ */
+static inline int mipi_dbi_write_display_async(const struct device *dev,
+					       const struct mipi_dbi_config *config,
+					       const uint8_t *framebuf,
+					       struct display_buffer_descriptor *desc,
+					       enum display_pixel_format pixfmt,
+					       mipi_dbi_write_cb_t cb, void *user_data)
+{
+	const struct mipi_dbi_driver_api *api =
+		(const struct mipi_dbi_driver_api *)dev->api;
+
+	if (api->write_display_async == NULL) {
+		return -ENOSYS;
+	}
+	return api->write_display_async(dev, config, framebuf, desc, pixfmt,
+					cb, user_data);
+}
+#endif /* CONFIG_MIPI_DBI_ASYNC */
+
 /**
  * @brief Resets attached display controller
  *
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_SENSOR_Q31_H_
+#define ZEPHYR_DRIVERS_SENSOR_Q31_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/drivers/sensor_data_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Convert the 16 bits three axis samples of a FIFO buffer to q31 readings.
+ *
+ * Meant for decoders converting a whole FIFO buffer at once, for frames of
+ * @p stride bytes each holding the X, Y and Z samples, in this order, as
+ * consecutive 16 bits signed integers. The reading of each axis is the sample
+ * multiplied by @p scale, saturated to the q31 range, so that @p scale is the
+ * value of one LSB of the sensor at the shift of the decoded data. Only the
+ * axis values of @p readings are written, the timestamps are left to the
+ * decoder.
+ *
+ * With CONFIG_SENSOR_Q31_DSP, the conversion uses the vector functions of the
+ * DSP subsystem, for instance CMSIS-DSP with the Helium extension, in which
+ * case the lowest bits of the readings may be truncated.
+ *
+ * @param frames Samples of the first frame
+ * @param stride Size of a frame in bytes
+ * @param big_endian True for big endian samples, false for little endian ones
+ * @param scale Value of one LSB, must be positive
+ * @param readings Readings to write
+ * @param count Number of frames
+ */
+void sensor_three_axis_from_int16(const uint8_t *frames, size_t stride, bool big_endian,
+				  int32_t scale, struct sensor_three_axis_sample_data *readings,
+				  size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_DRIVERS_SENSOR_Q31_H_ */
@@ -780,10 +780,70 @@ struct video_buffer *video_buffer_alloc(size_t size, k_timeout_t timeout);
 /**
  * @brief Release a video buffer.
  *
+ * Drop a reference to the video buffer. When the last reference is dropped,
+ * the buffer is handed to the callback set with video_buffer_set_release_cb()
+ * if any, or freed otherwise.
+ *
  * @param buf Pointer to the video buffer to release.
  */
 void video_buffer_release(struct video_buffer *buf);
 
+/**
+ * @brief Take a reference to a video buffer.
+ *
+ * A buffer allocated with video_buffer_alloc() holds one reference.
+ * Taking additional references allows the same buffer to be enqueued into
+ * several video devices, or to be passed to a display, without copying the
+ * frame. Each user calls video_buffer_release() once it is done.
+ *
+ * @param buf Pointer to the video buffer.
+ *
+ * @retval pointer to the video buffer
+ */
+struct video_buffer *video_buffer_ref(struct video_buffer *buf);
+
+/**
+ * @typedef video_buffer_release_cb_t
+ * @brief Callback invoked when the last reference to a video buffer is dropped
+ *
+ * The callback is handed back the buffer with one reference, which allows
+ * the owner to enqueue it into the capture device again.
+ *
+ * @param buf Pointer to the video buffer.
+ * @param user_data User data given to video_buffer_set_release_cb().
+ */
+typedef void (*video_buffer_release_cb_t)(struct video_buffer *buf, void *user_data);
+
+/**
+ * @brief Set the callback for the release of the last reference.
+ *
+ * @param buf Pointer to the video buffer.
+ * @param cb Callback, or NULL to free the buffer on its last release.
+ * @param user_data User data passed to the callback.
+ */
+void video_buffer_set_release_cb(struct video_buffer *buf, video_buffer_release_cb_t cb,
+				 void *user_data);
+
+/**
+ * @brief Write back the data cache lines of a video buffer.
+ *
+ * To be called after the CPU wrote into a buffer, before it is handed to a
+ * device that reads it with DMA. This is a no-op without data cache.
+ *
+ * @param buf Pointer to the video buffer.
+ */
+void video_buffer_cache_flush(const struct video_buffer *buf);
+
+/**
+ * @brief Invalidate the data cache lines of a video buffer.
+ *
+ * To be called after a device wrote into a buffer with DMA, before the CPU
+ * reads it. This is a no-op without data cache.
+ *
+ * @param buf Pointer to the video buffer.
+ */
+void video_buffer_cache_invalidate(const struct video_buffer *buf);
+
 /**
  * @brief Search for a format that matches in a list of capabilities
  *
@@ -0,0 +1,83 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Video pixel format conversion and scaling
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_VIDEO_CONVERT_H_
+#define ZEPHYR_INCLUDE_DRIVERS_VIDEO_CONVERT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/drivers/video.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Video pixel format conversion and scaling
+ * @defgroup video_convert Video pixel format conversion
+ * @ingroup video_interface
+ * @{
+ */
+
+/**
+ * @brief Check if a conversion is supported.
+ *
+ * @param in_fmt Format of the source frame.
+ * @param out_fmt Format of the destination frame.
+ *
+ * @retval true if video_convert() supports converting @p in_fmt to @p out_fmt
+ * @retval false otherwise
+ */
+bool video_convert_supported(const struct video_format *in_fmt,
+			     const struct video_format *out_fmt);
+
+/**
+ * @brief Convert a frame to another pixel format or size.
+ *
+ * The following pixel formats conversions are supported, at the same frame
+ * size:
+ *
+ * - @ref VIDEO_PIX_FMT_YUYV to @ref VIDEO_PIX_FMT_RGB565, @ref VIDEO_PIX_FMT_RGB24
+ *   and @ref VIDEO_PIX_FMT_GREY (ITU-R BT.601, limited range)
+ * - @ref VIDEO_PIX_FMT_RGB24 to @ref VIDEO_PIX_FMT_RGB565 and @ref VIDEO_PIX_FMT_YUYV
+ * - @ref VIDEO_PIX_FMT_RGB565 to @ref VIDEO_PIX_FMT_RGB24
+ * - @ref VIDEO_PIX_FMT_RGB565 to and from @ref VIDEO_PIX_FMT_RGB565X
+ * - @ref VIDEO_PIX_FMT_RGB24 to and from @ref VIDEO_PIX_FMT_BGR24
+ *
+ * A frame can be scaled with the nearest neighbour method if both formats
+ * are the same, for any format with a whole number of bytes per pixel and
+ * for @ref VIDEO_PIX_FMT_YUYV.
+ *
+ * The pitch of both formats is honoured, so a frame can be converted into a
+ * region of a larger frame.
+ *
+ * @param in_fmt Format of the source frame.
+ * @param in Pointer to the source frame.
+ * @param out_fmt Format of the destination frame.
+ * @param out Pointer to the destination frame.
+ *
+ * @retval 0 on success
+ * @retval -ENOTSUP if the conversion is not supported
+ * @retval -EINVAL if a pitch is too small for the frame width
+ */
+int video_convert(const struct video_format *in_fmt, const uint8_t *in,
+		  const struct video_format *out_fmt, uint8_t *out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_VIDEO_CONVERT_H_ */
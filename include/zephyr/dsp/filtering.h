@@ -0,0 +1,281 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/filtering.h
+ *
+ * @brief Public APIs for DSP filtering
+ *
+ * The backend must provide the implementation in zdsp_backend_filtering.h.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_FILTERING_H_
+#define ZEPHYR_INCLUDE_DSP_FILTERING_H_
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_filtering Filtering Functions
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @addtogroup math_dsp_filtering_fir Finite Impulse Response (FIR) Filters
+ *
+ * Block based FIR filters.
+ * <pre>
+ *     dst[n] = b[0] * src[n] + b[1] * src[n-1] + ... + b[num_taps-1] * src[n-num_taps+1]
+ * </pre>
+ * The coefficients are stored in time reversed order, i.e.
+ * {b[num_taps-1], b[num_taps-2], ..., b[0]}.
+ *
+ * The state buffer holds the last input samples between two calls, its size
+ * must be num_taps + block_size - 1 samples, where block_size is the largest
+ * number of samples processed per call.
+ *
+ * Vectorized backends, e.g. CMSIS-DSP built for Helium, may require the
+ * number of taps to be a multiple of the vector length, pad the coefficients
+ * with zeros in that case.
+ * @{
+ */
+
+/** Instance structure of a Q15 FIR filter */
+struct zdsp_fir_instance_q15 {
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+	/** Pointer to the state buffer */
+	DSP_DATA q15_t *state;
+	/** Pointer to the coefficients */
+	const DSP_DATA q15_t *coeffs;
+};
+
+/** Instance structure of a Q31 FIR filter */
+struct zdsp_fir_instance_q31 {
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+	/** Pointer to the state buffer */
+	DSP_DATA q31_t *state;
+	/** Pointer to the coefficients */
+	const DSP_DATA q31_t *coeffs;
+};
+
+/** Instance structure of a floating-point FIR filter */
+struct zdsp_fir_instance_f32 {
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+	/** Pointer to the state buffer */
+	DSP_DATA float32_t *state;
+	/** Pointer to the coefficients */
+	const DSP_DATA float32_t *coeffs;
+};
+
+/**
+ * @brief Initialize a Q15 FIR filter, and clear its state.
+ *
+ * @param[out] inst       points to the instance structure
+ * @param[in]  num_taps   number of filter coefficients
+ * @param[in]  coeffs     points to the coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ */
+DSP_FUNC_SCOPE void zdsp_fir_init_q15(struct zdsp_fir_instance_q15 *inst, uint16_t num_taps,
+				      const DSP_DATA q15_t *coeffs, DSP_DATA q15_t *state,
+				      uint32_t block_size);
+
+/**
+ * @brief Q15 FIR filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are accumulated in a 64-bit accumulator, which is then
+ *   truncated and saturated to 1.15 format.
+ *
+ * @param[in]  inst       points to the instance structure
+ * @param[in]  src        points to the input samples
+ * @param[out] dst        points to the output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_q15(const struct zdsp_fir_instance_q15 *inst,
+				 const DSP_DATA q15_t *src, DSP_DATA q15_t *dst,
+				 uint32_t block_size);
+
+/**
+ * @brief Initialize a Q31 FIR filter, and clear its state.
+ *
+ * @param[out] inst       points to the instance structure
+ * @param[in]  num_taps   number of filter coefficients
+ * @param[in]  coeffs     points to the coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ */
+DSP_FUNC_SCOPE void zdsp_fir_init_q31(struct zdsp_fir_instance_q31 *inst, uint16_t num_taps,
+				      const DSP_DATA q31_t *coeffs, DSP_DATA q31_t *state,
+				      uint32_t block_size);
+
+/**
+ * @brief Q31 FIR filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are accumulated in a 64-bit accumulator, which is then
+ *   truncated to 1.31 format. The input must be scaled down by
+ *   log2(num_taps) bits to avoid overflows.
+ *
+ * @param[in]  inst       points to the instance structure
+ * @param[in]  src        points to the input samples
+ * @param[out] dst        points to the output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_q31(const struct zdsp_fir_instance_q31 *inst,
+				 const DSP_DATA q31_t *src, DSP_DATA q31_t *dst,
+				 uint32_t block_size);
+
+/**
+ * @brief Initialize a floating-point FIR filter, and clear its state.
+ *
+ * @param[out] inst       points to the instance structure
+ * @param[in]  num_taps   number of filter coefficients
+ * @param[in]  coeffs     points to the coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ */
+DSP_FUNC_SCOPE void zdsp_fir_init_f32(struct zdsp_fir_instance_f32 *inst, uint16_t num_taps,
+				      const DSP_DATA float32_t *coeffs, DSP_DATA float32_t *state,
+				      uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR filter.
+ *
+ * @param[in]  inst       points to the instance structure
+ * @param[in]  src        points to the input samples
+ * @param[out] dst        points to the output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_f32(const struct zdsp_fir_instance_f32 *inst,
+				 const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+				 uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @addtogroup math_dsp_filtering_biquad Biquad Cascade IIR Filters, Direct Form I
+ *
+ * Cascade of second order sections, each computing:
+ * <pre>
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+ * </pre>
+ * The feedback coefficients are negated compared to the usual notation.
+ *
+ * The Q15 variant uses 6 coefficients per stage, {b0, 0, b1, b2, a1, a2},
+ * the zero is used for the 16-bit SIMD multiply-accumulate of some backends.
+ * The Q31 variant uses 5 coefficients per stage, {b0, b1, b2, a1, a2}. The
+ * coefficients are scaled down by 2^post_shift to fit the fixed-point range,
+ * and the result of each stage is scaled back up by the same amount.
+ *
+ * The state buffer holds 4 samples per stage.
+ * @{
+ */
+
+/** Instance structure of a Q15 biquad cascade filter */
+struct zdsp_biquad_casd_df1_instance_q15 {
+	/** Number of second order stages */
+	int8_t num_stages;
+	/** Pointer to the state buffer, 4 * num_stages samples */
+	DSP_DATA q15_t *state;
+	/** Pointer to the coefficients, 6 * num_stages values */
+	const DSP_DATA q15_t *coeffs;
+	/** Shift applied to the result of each stage */
+	int8_t post_shift;
+};
+
+/** Instance structure of a Q31 biquad cascade filter */
+struct zdsp_biquad_casd_df1_instance_q31 {
+	/** Number of second order stages */
+	uint32_t num_stages;
+	/** Pointer to the state buffer, 4 * num_stages samples */
+	DSP_DATA q31_t *state;
+	/** Pointer to the coefficients, 5 * num_stages values {b0, b1, b2, a1, a2} */
+	const DSP_DATA q31_t *coeffs;
+	/** Shift applied to the result of each stage */
+	uint8_t post_shift;
+};
+
+/**
+ * @brief Initialize a Q15 biquad cascade filter, and clear its state.
+ *
+ * @param[out] inst       points to the instance structure
+ * @param[in]  num_stages number of second order stages
+ * @param[in]  coeffs     points to the coefficients, 6 * num_stages values
+ * @param[in]  state      points to the state buffer, 4 * num_stages samples
+ * @param[in]  post_shift shift applied to the result of each stage
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_cascade_df1_init_q15(
+	struct zdsp_biquad_casd_df1_instance_q15 *inst, uint8_t num_stages,
+	const DSP_DATA q15_t *coeffs, DSP_DATA q15_t *state, int8_t post_shift);
+
+/**
+ * @brief Q15 biquad cascade filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products of each stage are accumulated in a 64-bit accumulator, which
+ *   is then shifted and saturated to 1.15 format.
+ *
+ * @param[in]  inst       points to the instance structure
+ * @param[in]  src        points to the input samples
+ * @param[out] dst        points to the output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_cascade_df1_q15(
+	const struct zdsp_biquad_casd_df1_instance_q15 *inst, const DSP_DATA q15_t *src,
+	DSP_DATA q15_t *dst, uint32_t block_size);
+
+/**
+ * @brief Initialize a Q31 biquad cascade filter, and clear its state.
+ *
+ * @param[out] inst       points to the instance structure
+ * @param[in]  num_stages number of second order stages
+ * @param[in]  coeffs     points to the coefficients, 5 * num_stages values
+ * @param[in]  state      points to the state buffer, 4 * num_stages samples
+ * @param[in]  post_shift shift applied to the result of each stage
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_cascade_df1_init_q31(
+	struct zdsp_biquad_casd_df1_instance_q31 *inst, uint8_t num_stages,
+	const DSP_DATA q31_t *coeffs, DSP_DATA q31_t *state, int8_t post_shift);
+
+/**
+ * @brief Q31 biquad cascade filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products of each stage are accumulated in a 64-bit accumulator, which
+ *   is then shifted and truncated to 1.31 format. The input must be scaled
+ *   down by 2 bits to avoid overflows.
+ *
+ * @param[in]  inst       points to the instance structure
+ * @param[in]  src        points to the input samples
+ * @param[out] dst        points to the output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_cascade_df1_q31(
+	const struct zdsp_biquad_casd_df1_instance_q31 *inst, const DSP_DATA q31_t *src,
+	DSP_DATA q31_t *dst, uint32_t block_size);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "zdsp_backend_filtering.h"
+
+#endif /* ZEPHYR_INCLUDE_DSP_FILTERING_H_ */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+#define ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief File System RTIO API
+ * @defgroup file_system_rtio_api File System RTIO API
+ * @ingroup file_system_api
+ * @{
+ */
+
+/**
+ * @brief RTIO I/O device API of open files
+ *
+ * Submissions to a file I/O device are executed on the RTIO work queue, using the
+ * synchronous file system API, and are completed with:
+ *
+ * - @ref RTIO_OP_RX: the number of bytes read at the current position of the file,
+ *   as returned by fs_read(). A buffer from the memory pool of the RTIO context can
+ *   be used.
+ * - @ref RTIO_OP_TX and @ref RTIO_OP_TINY_TX: the number of bytes written at the
+ *   current position of the file, as returned by fs_write().
+ * - @ref RTIO_OP_FS_SYNC: 0 once the cached data of the file has been written to
+ *   the storage, as by fs_sync().
+ *
+ * Submissions that are not chained may be executed concurrently by the work queue
+ * threads, so the submissions to a file must be chained to be executed in order.
+ * Failures complete the submission with a negative errno code.
+ */
+extern const struct rtio_iodev_api fs_rtio_iodev_api;
+
+/**
+ * @brief Statically define an RTIO I/O device for a file
+ *
+ * The file must be opened with fs_open() before submitting operations to the I/O
+ * device, and remain open until they have completed.
+ *
+ * @param name Name of the I/O device
+ * @param zfp Pointer to the file object, a @ref fs_file_t
+ */
+#define FS_RTIO_IODEV_DEFINE(name, zfp) RTIO_IODEV_DEFINE(name, &fs_rtio_iodev_api, zfp)
+
+/**
+ * @brief Initialize an RTIO I/O device for a file at runtime
+ *
+ * @param iodev I/O device to initialize
+ * @param zfp Pointer to the file object
+ */
+static inline void fs_rtio_iodev_init(struct rtio_iodev *iodev, struct fs_file_t *zfp)
+{
+	iodev->api = &fs_rtio_iodev_api;
+	iodev->data = zfp;
+}
+
+/**
+ * @brief Prepare a file sync submission
+ *
+ * @param sqe Submission to prepare
+ * @param iodev I/O device of the file
+ * @param prio Priority of the submission
+ * @param userdata User data returned in the completion
+ */
+static inline void fs_rtio_sqe_prep_sync(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					 int8_t prio, void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_FS_SYNC;
+	sqe->prio = prio;
+	sqe->iodev = iodev;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_RTIO_H_ */
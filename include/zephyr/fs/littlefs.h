@@ -117,6 +117,27 @@ struct fs_littlefs {
 					  CONFIG_FS_LITTLEFS_CACHE_SIZE, \
 					  CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE)
 
+/** @brief Usage of the file cache buffers shared by all littlefs mounts */
+struct fs_littlefs_fc_stats {
+	/** Number of buffers in use, i.e. of open files */
+	uint32_t buffers;
+	/** Number of bytes in use */
+	size_t bytes;
+	/** Maximum number of bytes in use at once */
+	size_t max_bytes;
+	/** Number of file opens that failed to get a buffer */
+	uint32_t failures;
+};
+
+/**
+ * @brief Get the usage of the littlefs file cache buffers.
+ *
+ * @note Available when @kconfig{CONFIG_FS_LITTLEFS_FC_STATS} is enabled.
+ *
+ * @param stats Filled with the current usage.
+ */
+void fs_littlefs_fc_stats_get(struct fs_littlefs_fc_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,26 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Progress of the garbage collection of a sector, internal to NVS
+ */
+struct nvs_gc_state {
+	/** Sector being garbage collected */
+	uint32_t sec_addr;
+	/** Next allocation table entry to scan for the space needed */
+	uint32_t scan_addr;
+	/** Next allocation table entry to copy if still in use */
+	uint32_t addr;
+	/** Last allocation table entry of the sector */
+	uint32_t stop_addr;
+	/** Upper bound of the space needed to copy the remaining entries */
+	uint32_t reserve;
+	/** All entries were scanned */
+	bool scanned;
+	/** All entries were copied if in use, only the sector erase is left */
+	bool copied;
+};
+
 /**
  * @brief Non-volatile Storage File system structure
  */
@@ -62,6 +82,20 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+	/** ID of the allocation table entry each lookup cache entry points to */
+	uint16_t lookup_cache_id[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	/** Flag indicating if an ID did not fit in the lookup cache */
+	bool lookup_cache_full;
+#endif
+#if CONFIG_NVS_GC_INCREMENTAL
+	/** Background garbage collection work */
+	struct k_work gc_work;
+	/** Garbage collection in progress */
+	struct nvs_gc_state gc;
+	/** Flag indicating if a garbage collection is in progress */
+	bool gc_pending;
+#endif
 };
 
 /**
@@ -101,6 +135,11 @@ int nvs_clear(struct nvs_fs *fs);
  * @p 0 will return error.@n It is not possible to distinguish between deleted entry and entry
  * with data of length 0.
  *
+ * @note When the write closes the current sector, the oldest sector is garbage collected
+ * before returning, unless @kconfig{CONFIG_NVS_GC_INCREMENTAL} is enabled. In that case the
+ * garbage collection is done in the background and the write only waits for it when the
+ * current sector has no room left.
+ *
  * @param fs Pointer to file system
  * @param id Id of the entry to be written
  * @param data Pointer to the data to be written
@@ -176,7 +215,8 @@ size_t nvs_sector_max_data_size(struct nvs_fs *fs);
 /**
  * @brief Close the currently active sector and switch to the next one.
  *
- * @note The garbage collector is called on the new sector.
+ * @note The garbage collector is called on the new sector. With
+ * @kconfig{CONFIG_NVS_GC_INCREMENTAL}, it completes in the background.
  *
  * @warning This routine is made available for specific use cases.
  * It breaks the aim of the NVS to avoid any unnecessary flash erases.
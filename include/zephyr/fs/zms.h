@@ -67,6 +67,18 @@ struct zms_fs {
 #endif
 };
 
+/**
+ * @brief Entry of a batch write, see @ref zms_write_batch().
+ */
+struct zms_batch_entry {
+	/** ID of the entry to be written */
+	uint32_t id;
+	/** Pointer to the data to be written */
+	const void *data;
+	/** Number of bytes to be written, 0 to delete the entry */
+	size_t len;
+};
+
 /**
  * @}
  */
@@ -129,6 +141,30 @@ int zms_clear(struct zms_fs *fs);
  */
 ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len);
 
+/**
+ * @brief Write several entries to the file system at once.
+ *
+ * The entries are written in a row in the same sector, between a begin ATE and a commit
+ * ATE, so that after a power loss either all of them or none are found: an interrupted
+ * batch is rolled back when ZMS is mounted. This needs room in the sector to write again
+ * the current value of each entry, so a batch can take up to about half a sector.
+ * The entries are written even if their data is already stored.
+ *
+ * @note Available when @kconfig{CONFIG_ZMS_WRITE_BATCH} is enabled.
+ *
+ * @param fs Pointer to the file system.
+ * @param entries Entries to be written, in order.
+ * @param count Number of entries.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if ZMS is still not initialized.
+ * @retval -ENXIO if there is a device error.
+ * @retval -EIO if there is a memory read/write error.
+ * @retval -EINVAL if an entry is invalid or if the batch can't fit in a sector.
+ * @retval -ENOSPC if no space is left on the device.
+ */
+int zms_write_batch(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count);
+
 /**
  * @brief Delete an entry from the file system
  *
@@ -168,6 +168,59 @@ struct init_entry {
 		Z_INIT_ENTRY_SECTION(level, prio, 0) __used __noasan                      \
 		Z_INIT_ENTRY_NAME(name) = {.init_fn = (init_fn_), .dev = NULL}            \
 
+#if defined(CONFIG_INIT_TIME_STATS) || defined(__DOXYGEN__)
+
+/** @brief Time taken by an init entry during boot */
+struct init_time_stat {
+	/** Init entry */
+	const struct init_entry *entry;
+	/** Init level ordinal of the entry, see INIT_LEVEL_ORD() */
+	uint8_t level;
+	/** Hardware cycles spent in the init function */
+	uint32_t cycles;
+};
+
+/**
+ * @brief Callback invoked for each init time statistic
+ *
+ * @param stat Init time statistic.
+ * @param user_data User data passed to sys_init_time_stats_foreach().
+ */
+typedef void (*init_time_stat_cb_t)(const struct init_time_stat *stat, void *user_data);
+
+/**
+ * @brief Iterate over the init time statistics
+ *
+ * Once the boot is complete, the entries are visited from the longest to the
+ * shortest. Only available if @kconfig{CONFIG_INIT_TIME_STATS} is enabled.
+ *
+ * @note Entries run before the system timer is initialized may report
+ * inaccurate times on platforms where the cycle counter is not running yet.
+ *
+ * @param cb Callback invoked for each entry.
+ * @param user_data User data passed to @p cb.
+ */
+void sys_init_time_stats_foreach(init_time_stat_cb_t cb, void *user_data);
+
+/**
+ * @brief Get the name of an init level
+ *
+ * @param level Init level ordinal, see INIT_LEVEL_ORD().
+ *
+ * @return Init level name, e.g. "POST_KERNEL".
+ */
+const char *sys_init_level_name(uint8_t level);
+
+/**
+ * @brief Print the init time statistics
+ *
+ * Print the time taken by each init entry from the longest to the shortest,
+ * followed by the total time of each init level.
+ */
+void sys_init_time_stats_dump(void);
+
+#endif /* CONFIG_INIT_TIME_STATS */
+
 /** @} */
 
 #ifdef __cplusplus
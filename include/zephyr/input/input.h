@@ -127,23 +127,53 @@ struct input_callback {
 	void (*callback)(struct input_event *evt, void *user_data);
 	/** User data pointer. */
 	void *user_data;
+	/** Mask of the event types to receive (see @ref INPUT_EV_BIT), 0 for all. */
+	uint32_t types;
 };
 
 /**
- * @brief Register a callback structure for input events with a custom name.
+ * @brief Bit of an event type in the @ref input_callback types mask.
  *
- * Same as @ref INPUT_CALLBACK_DEFINE but allows specifying a custom name
- * for the callback structure. Useful if multiple callbacks are used for the
- * same callback function.
+ * Device specific and vendor event types all share the most significant bit.
+ *
+ * @param type Event type (see @ref INPUT_EV_CODES).
  */
-#define INPUT_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, name)         \
+#define INPUT_EV_BIT(type) ((type) < 31 ? BIT(type) : BIT(31))
+
+/**
+ * @brief Register a callback structure for some types of input events.
+ *
+ * Same as @ref INPUT_CALLBACK_DEFINE_NAMED but the callback is only invoked
+ * for the event types in @p _types. With
+ * @kconfig{CONFIG_INPUT_COALESCE} enabled, the last event of a frame passed to
+ * the callback carries the sync flag, even if the event that was reported with
+ * it is of a type that is filtered out.
+ *
+ * @param _dev @ref device pointer or NULL.
+ * @param _types Mask of @ref INPUT_EV_BIT of the event types to receive.
+ * @param _callback The callback function.
+ * @param _user_data Pointer to user specified data.
+ * @param name Name of the callback structure.
+ */
+#define INPUT_CALLBACK_DEFINE_TYPES_NAMED(_dev, _types, _callback, _user_data, name) \
 	static const STRUCT_SECTION_ITERABLE(input_callback,                   \
 					     _input_callback__##name) = {      \
 		.dev = _dev,                                                   \
 		.callback = _callback,                                         \
 		.user_data = _user_data,                                       \
+		.types = _types,                                               \
 	}
 
+/**
+ * @brief Register a callback structure for input events with a custom name.
+ *
+ * Same as @ref INPUT_CALLBACK_DEFINE but allows specifying a custom name
+ * for the callback structure. Useful if multiple callbacks are used for the
+ * same callback function.
+ */
+#define INPUT_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, name)         \
+	INPUT_CALLBACK_DEFINE_TYPES_NAMED(_dev, 0, _callback, _user_data, name)
+
 /**
  * @brief Register a callback structure for input events.
  *
@@ -158,6 +188,19 @@ struct input_callback {
 #define INPUT_CALLBACK_DEFINE(_dev, _callback, _user_data)                     \
 	INPUT_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _callback)
 
+/**
+ * @brief Register a callback structure for some types of input events.
+ *
+ * @see INPUT_CALLBACK_DEFINE_TYPES_NAMED() for more details.
+ *
+ * @param _dev @ref device pointer or NULL.
+ * @param _types Mask of @ref INPUT_EV_BIT of the event types to receive.
+ * @param _callback The callback function.
+ * @param _user_data Pointer to user specified data.
+ */
+#define INPUT_CALLBACK_DEFINE_TYPES(_dev, _types, _callback, _user_data)       \
+	INPUT_CALLBACK_DEFINE_TYPES_NAMED(_dev, _types, _callback, _user_data, _callback)
+
 #ifdef __cplusplus
 }
 #endif
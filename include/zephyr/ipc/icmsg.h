@@ -101,6 +101,12 @@ struct icmsg_data_t {
 	uint16_t remote_sid;
 	uint16_t local_sid;
 	atomic_t state;
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	/* Message received in place, not released from the RX buffer yet. */
+	volatile char *rx_inplace;
+	uint16_t rx_inplace_len;
+	atomic_t rx_hold;
+#endif
 };
 
 /** @brief Open an icmsg instance
@@ -170,6 +176,69 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	       struct icmsg_data_t *dev_data,
 	       const void *msg, size_t len);
 
+/** @brief Send several messages to the remote icmsg instance at once.
+ *
+ *  The messages are written to the TX buffer one after another and made
+ *  visible to the remote instance together, with a single notification.
+ *  Writing stops at the first message that does not fit in the TX buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] msgs Array of messages to send.
+ *  @param[in] count Number of messages in the @p msgs array.
+ *
+ *  @retval Number of sent messages.
+ *  @retval -EBUSY when the instance has not finished handshake with the remote
+ *                 instance.
+ *  @retval -ENODATA when one of the messages to send is empty.
+ *  @retval -ENOBUFS when there are no TX buffers available.
+ *  @retval -ENOMEM when the first message does not fit in the TX buffer.
+ *  @retval other errno codes from dependent modules.
+ */
+int icmsg_send_batch(const struct icmsg_config_t *conf,
+		     struct icmsg_data_t *dev_data,
+		     const struct ipc_service_msg *msgs, size_t count);
+
+/** @brief Hold the message received in place.
+ *
+ *  Must be called from the received callback, with the buffer passed to it.
+ *  The message stays in the RX buffer, and no other message is received,
+ *  until it is released with @ref icmsg_release_rx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the received message.
+ *
+ *  @retval 0 on success.
+ *  @retval -EINVAL when @p data is not a message received in place, i.e.
+ *                  it was copied because it wrapped around the end of
+ *                  the RX buffer.
+ *  @retval -EALREADY when the message is already held.
+ *  @retval -ENOTSUP when @kconfig{CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX} is disabled.
+ */
+int icmsg_hold_rx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data, const void *data);
+
+/** @brief Release the message held with @ref icmsg_hold_rx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the held message.
+ *
+ *  @retval 0 on success.
+ *  @retval -ENXIO when no message is held.
+ *  @retval -EINVAL when @p data is not the held message.
+ *  @retval -ENOTSUP when @kconfig{CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX} is disabled.
+ */
+int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_data_t *dev_data, const void *data);
+
 /**
  * @}
  */
@@ -218,6 +218,16 @@ struct ipc_ept_cfg {
 	void *priv;
 };
 
+/** @brief Message of a batch, see @ref ipc_service_send_batch. */
+struct ipc_service_msg {
+
+	/** Pointer to the data of the message. */
+	const void *data;
+
+	/** Number of bytes of the message. */
+	size_t len;
+};
+
 /** @brief Open an instance
  *
  *  Function to be used to open an instance before being able to register a new
@@ -315,6 +325,33 @@ int ipc_service_deregister_endpoint(struct ipc_ept *ept);
  */
 int ipc_service_send(struct ipc_ept *ept, const void *data, size_t len);
 
+/** @brief Send several messages using given IPC endpoint.
+ *
+ *  When supported by the backend, the messages are made available to the
+ *  remote together, with a single notification. Otherwise they are sent one
+ *  by one with @ref ipc_service_send. Sending stops at the first message
+ *  that cannot be sent.
+ *
+ *  @param[in] ept Registered endpoint by @ref ipc_service_register_endpoint.
+ *  @param[in] msgs Array of messages to send.
+ *  @param[in] count Number of messages in the @p msgs array.
+ *
+ *  @retval -EIO when no backend is registered or send hook is missing from
+ *               backend.
+ *  @retval -EINVAL when instance or endpoint is invalid.
+ *  @retval -ENOENT when the endpoint is not registered with the instance.
+ *  @retval -EBADMSG when the data is invalid (i.e. invalid data format,
+ *		     invalid length, ...)
+ *  @retval -EBUSY when the instance is busy.
+ *  @retval -ENOMEM when no memory / buffers are available for the first
+ *		    message.
+ *
+ *  @retval messages number of messages sent.
+ *  @retval other errno codes depending on the implementation of the backend.
+ */
+int ipc_service_send_batch(struct ipc_ept *ept, const struct ipc_service_msg *msgs,
+			   size_t count);
+
 /** @brief Get the TX buffer size
  *
  *  Get the maximal size of a buffer which can be obtained by @ref
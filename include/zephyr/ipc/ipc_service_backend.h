@@ -216,6 +216,30 @@ struct ipc_service_backend {
 	 */
 	int (*release_rx_buffer)(const struct device *instance, void *token,
 				 void *data);
+
+	/** @brief Pointer to the function that will be used to send several
+	 *	   messages to the endpoint at once.
+	 *
+	 *  Optional, @ref ipc_service_send_batch falls back to the send
+	 *  function when missing.
+	 *
+	 *  @param[in] instance Instance pointer.
+	 *  @param[in] token Backend-specific token.
+	 *  @param[in] msgs Array of messages to send.
+	 *  @param[in] count Number of messages in the @p msgs array.
+	 *
+	 *  @retval -EINVAL when instance is invalid.
+	 *  @retval -ENOENT when the endpoint is not registered with the instance.
+	 *  @retval -EBADMSG when the data is invalid (i.e. invalid data format,
+	 *		     invalid length, ...)
+	 *  @retval -EBUSY when the instance is busy or not ready.
+	 *
+	 *  @retval messages number of messages sent.
+	 *  @retval other errno codes depending on the implementation of the
+	 *	    backend.
+	 */
+	int (*send_batch)(const struct device *instance, void *token,
+			  const struct ipc_service_msg *msgs, size_t count);
 };
 
 /**
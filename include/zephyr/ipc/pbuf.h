@@ -217,6 +217,29 @@ int pbuf_rx_init(struct pbuf *pb);
 
 int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
 
+/**
+ * @brief Write a packet to the packet buffer without making it visible to the reader.
+ *
+ * Several packets can be written this way and made visible to the reader at
+ * once with @ref pbuf_write_commit, so the reader can be notified once for
+ * all of them.
+ *
+ * @param pb	A buffer to which to write.
+ * @param buf	Pointer to the data to be written to the buffer.
+ * @param len	Number of bytes to be written to the buffer. Must be positive.
+ * @retval int	Number of bytes written, negative error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-ENOMEM, if len is bigger than the buffer can fit.
+ */
+int pbuf_write_defer(struct pbuf *pb, const char *buf, uint16_t len);
+
+/**
+ * @brief Make the packets written with @ref pbuf_write_defer visible to the reader.
+ *
+ * @param pb	A buffer to which packets were written.
+ */
+void pbuf_write_commit(struct pbuf *pb);
+
 /**
  * @brief Read specified amount of data from the packet buffer.
  *
@@ -235,6 +258,35 @@ int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
  */
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len);
 
+/**
+ * @brief Get the next packet of the packet buffer without copying it.
+ *
+ * The packet stays in the buffer, and @p buf points to its data in the shared
+ * memory, until it is released with @ref pbuf_read_inplace_release. Packets
+ * wrapped around the end of the buffer are not contiguous and must be read
+ * with @ref pbuf_read instead.
+ *
+ * @param pb		A buffer from which data will be read.
+ * @param[out] buf	Pointer to the data of the packet.
+ * @param[out] len	Length of the packet.
+ * @retval int		Length of the packet, 0 if the buffer is empty,
+ *			negative error code on fail.
+ *			-EINVAL, if any of input parameter is incorrect.
+ *			-EAGAIN, if not whole message is ready yet.
+ *			-EFBIG, if the packet is wrapped around the end of the buffer.
+ */
+int pbuf_read_inplace(struct pbuf *pb, volatile char **buf, uint16_t *len);
+
+/**
+ * @brief Release the packet obtained with @ref pbuf_read_inplace.
+ *
+ * @param pb	A buffer from which the packet was obtained.
+ * @param len	Length of the packet.
+ * @retval 0 on success.
+ * @retval -EINVAL, if any of input parameter is incorrect.
+ */
+int pbuf_read_inplace_release(struct pbuf *pb, uint16_t len);
+
 /**
  * @brief Read handshake word from pbuf.
  *
@@ -87,6 +87,7 @@ struct k_mem_domain;
 struct k_mem_partition;
 struct k_futex;
 struct k_event;
+struct k_ringq;
 
 enum execution_context_types {
 	K_ISR = 0,
@@ -1049,6 +1050,36 @@ int k_thread_cpu_mask_disable(k_tid_t thread, int cpu);
  * @return Zero on success, otherwise error code
  */
 int k_thread_cpu_pin(k_tid_t thread, int cpu);
+
+/**
+ * @brief Let the load balancer choose the CPU of a thread
+ *
+ * The thread is pinned to the least loaded CPU of @p cpu_mask, and the
+ * balancer may later pin it to another CPU of @p cpu_mask, when the CPU it
+ * runs on is significantly more loaded than another one. A @p cpu_mask of
+ * zero stops balancing the thread, which stays pinned to its current CPU.
+ *
+ * The thread must not be currently runnable.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_CPU_MASK_BALANCE} in your
+ * project configuration.
+ *
+ * @param thread Thread to operate upon
+ * @param cpu_mask CPUs the thread may be pinned to
+ * @return Zero on success, otherwise error code
+ */
+int k_thread_cpu_balance(k_tid_t thread, uint32_t cpu_mask);
+
+/**
+ * @brief Get the load of a CPU seen by the load balancer
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_CPU_MASK_BALANCE} in your
+ * project configuration.
+ *
+ * @param cpu CPU index
+ * @return Load of the CPU over the last balancing period, in per mille
+ */
+int k_sched_cpu_load_get(int cpu);
 #endif
 
 /**
@@ -2353,8 +2384,18 @@ __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
  * @ingroup event_apis
  */
 
+/** @cond INTERNAL_HIDDEN */
+#ifdef CONFIG_EVENTS_WAIT_BUCKETS
+#define Z_EVENT_WAIT_BUCKETS CONFIG_EVENTS_WAIT_BUCKETS
+#else
+#define Z_EVENT_WAIT_BUCKETS 1
+#endif
+/** @endcond */
+
 struct k_event {
-	_wait_q_t         wait_q;
+	_wait_q_t         wait_q[Z_EVENT_WAIT_BUCKETS];
+	/* Events that the threads of each wait queue may be waiting for */
+	uint32_t          wait_events[Z_EVENT_WAIT_BUCKETS];
 	uint32_t          events;
 	struct k_spinlock lock;
 
@@ -2366,9 +2407,14 @@ struct k_event {
 
 };
 
+/** @cond INTERNAL_HIDDEN */
+#define Z_EVENT_WAIT_Q_INIT(i, obj) Z_WAIT_Q_INIT(&(obj).wait_q[i])
+/** @endcond */
+
 #define Z_EVENT_INITIALIZER(obj) \
 	{ \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.wait_q = { LISTIFY(Z_EVENT_WAIT_BUCKETS, Z_EVENT_WAIT_Q_INIT, (,), obj) }, \
+	.wait_events = { 0 }, \
 	.events = 0, \
 	.lock = {}, \
 	}
@@ -3635,6 +3681,43 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+/** @brief Initialize a work queue serviced by several threads.
+ *
+ * This works like k_work_queue_start(), except that @p count threads take the
+ * work items of the queue, so that several items can run at the same time.  A
+ * given work item never runs in two threads at the same time, and a flush of a
+ * work item completes once it is no longer running, as with a single thread;
+ * work items submitted in a given order may however complete in any order.
+ *
+ * k_work_queue_thread_get() returns the first thread of the pool.
+ *
+ * @note Requires @kconfig{CONFIG_WORKQUEUE_POOL}.
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param threads array of @p count thread structures, retained for the
+ *        lifetime of the queue.
+ *
+ * @param stacks array of @p count stacks, defined with
+ *        K_KERNEL_STACK_ARRAY_DEFINE() and @p stack_size.
+ *
+ * @param count number of threads of the queue.
+ *
+ * @param stack_size size of each stack, as given to
+ *        K_KERNEL_STACK_ARRAY_DEFINE(), in bytes.
+ *
+ * @param prio initial priority of the threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_start_pool(struct k_work_q *queue, struct k_thread *threads,
+			     k_thread_stack_t *stacks, size_t count, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg);
+
 /** @brief Run work queue using calling thread
  *
  * This will run the work queue forever unless stopped by @ref k_work_queue_stop.
@@ -4091,6 +4174,11 @@ struct k_work {
 	 * It can be RUNNING and CANCELING simultaneously.
 	 */
 	uint32_t flags;
+
+#if defined(CONFIG_OBJ_CORE_STATS_WORK_Q)
+	/* Cycle count when the work item was last queued. */
+	uint32_t queued_cycles;
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
 };
 
 #define Z_WORK_INITIALIZER(work_handler) { \
@@ -4150,6 +4238,9 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#if defined(CONFIG_WORKQUEUE_POOL)
+	struct k_work *target;
+#endif /* CONFIG_WORKQUEUE_POOL */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4229,8 +4320,60 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+	/** Control whether the threads of a work queue started with
+	 * k_work_queue_start_pool() are pinned to the CPUs, thread i
+	 * running only on CPU i modulo the number of CPUs.
+	 *
+	 * Requires @kconfig{CONFIG_SCHED_CPU_MASK}, ignored otherwise.
+	 */
+	bool cpu_pin;
 };
 
+#if defined(CONFIG_OBJ_CORE_STATS_WORK_Q) || defined(__DOXYGEN__)
+/** @brief Statistics of the work items of a work queue sharing a handler.
+ *
+ * The histograms count durations in microseconds: bucket 0 counts the
+ * durations below 1 us, bucket @c i the durations from 2^(i-1) us up to
+ * 2^i us, and the last bucket all the longer durations.
+ */
+struct k_work_handler_stats {
+	/** Handler of the work items, NULL for an unused entry. */
+	k_work_handler_t handler;
+
+	/** Number of completed executions. */
+	uint32_t count;
+
+	/** Longest delay between queuing and execution, in microseconds. */
+	uint32_t delay_max_us;
+
+	/** Longest execution time, in microseconds. */
+	uint32_t run_max_us;
+
+	/** Total execution time, in microseconds. */
+	uint64_t run_total_us;
+
+	/** Histogram of the delays between queuing and execution. */
+	uint32_t delay_hist[CONFIG_OBJ_CORE_STATS_WORK_Q_BUCKETS];
+
+	/** Histogram of the execution times. */
+	uint32_t run_hist[CONFIG_OBJ_CORE_STATS_WORK_Q_BUCKETS];
+};
+
+/** @brief Statistics of a work queue, per work handler.
+ *
+ * Retrieved through the object core statistics of the queue, with
+ * k_obj_core_stats_raw() or k_obj_core_stats_query().
+ */
+struct k_work_q_stats {
+	/** Executions of handlers not tracked, all the entries being used. */
+	uint32_t untracked;
+
+	/** Statistics of the first handlers executed by the queue. */
+	struct k_work_handler_stats handlers[CONFIG_OBJ_CORE_STATS_WORK_Q_HANDLERS];
+};
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
 /** @brief A structure used to hold work until it can be processed. */
 struct k_work_q {
 	/* The thread that animates the work. */
@@ -4257,11 +4400,31 @@ struct k_work_q {
 	/* Flags describing queue state. */
 	uint32_t flags;
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* The threads that animate the work, thread_id being the first. */
+	struct k_thread *threads;
+
+	/* Number of threads, and of threads not stopped. */
+	uint8_t num_threads;
+	uint8_t num_alive;
+
+	/* Number of work items running. */
+	uint8_t num_busy;
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
 	struct _timeout work_timeout_record;
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_OBJ_CORE_WORK_Q)
+	struct k_obj_core obj_core;
+#endif /* CONFIG_OBJ_CORE_WORK_Q */
+
+#if defined(CONFIG_OBJ_CORE_STATS_WORK_Q)
+	struct k_work_q_stats stats;
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4828,6 +4991,65 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs consecutive messages from @a data to
+ * message queue @a msgq in one operation. Messages are first handed over to
+ * threads waiting to receive, then as many of the remaining ones as fit are
+ * copied into the ring buffer with at most two copies. Waiting threads are
+ * woken up with a single reschedule.
+ *
+ * If no message at all can be sent, the caller waits (up to @a timeout) for
+ * the first message to be taken by a receiver, and the routine returns 1.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to an array of @a num_msgs messages.
+ * @param num_msgs Number of messages to send.
+ * @param timeout Waiting period to send a first message, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages sent (counted from the start of @a data),
+ *	0 if @a num_msgs is 0.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_n(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			   k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a max_msgs messages from message queue
+ * @a msgq in a "first in, first out" manner, in one operation. The
+ * messages are copied out of the ring buffer with at most two copies, then
+ * the freed space is refilled from threads waiting to send, which are woken
+ * up with a single reschedule.
+ *
+ * If the queue is empty, the caller waits (up to @a timeout) for one
+ * message to be sent, and the routine returns 1.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of an area holding up to @a max_msgs messages.
+ * @param max_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive a first message, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages received, 0 if @a max_msgs is 0.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_n(struct k_msgq *msgq, void *data, uint32_t max_msgs,
+			   k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4920,6 +5142,176 @@ static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 
 /** @} */
 
+/**
+ * @defgroup ringq_apis Ring Queue APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Ring queue slot
+ *
+ * Storage for one entry of a ring queue. An array of these is provided
+ * to k_ringq_init().
+ */
+struct k_ringq_slot {
+	/** @cond INTERNAL_HIDDEN */
+	/* Sequence number relative to the slot index, so that a zeroed
+	 * slot array is a valid empty queue.
+	 */
+	atomic_t seq;
+	void *data;
+	/** @endcond */
+};
+
+/**
+ * @brief Ring queue structure
+ *
+ * A bounded multi-producer, multi-consumer queue of pointers. Adding and
+ * removing entries is lock-free; the internal lock is only taken when a
+ * thread has to wait, or when a waiting thread has to be woken up.
+ */
+struct k_ringq {
+	/** Slot array */
+	struct k_ringq_slot *slots;
+	/** Number of slots minus one (the slot count is a power of two) */
+	uint32_t mask;
+	/** Position of the next entry to be added */
+	atomic_t tail;
+	/** Position of the next entry to be removed */
+	atomic_t head;
+	/** Number of threads waiting for an entry */
+	atomic_t get_waiters;
+	/** Number of threads waiting for a free slot */
+	atomic_t put_waiters;
+	/** Lock protecting the wait queues */
+	struct k_spinlock lock;
+	/** Threads waiting for an entry */
+	_wait_q_t get_wait_q;
+	/** Threads waiting for a free slot */
+	_wait_q_t put_wait_q;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#define Z_RINGQ_INITIALIZER(obj, q_slots, q_num_slots) \
+	{ \
+	.slots = q_slots, \
+	.mask = (q_num_slots) - 1, \
+	.tail = ATOMIC_INIT(0), \
+	.head = ATOMIC_INIT(0), \
+	.get_waiters = ATOMIC_INIT(0), \
+	.put_waiters = ATOMIC_INIT(0), \
+	.lock = {}, \
+	.get_wait_q = Z_WAIT_Q_INIT(&obj.get_wait_q), \
+	.put_wait_q = Z_WAIT_Q_INIT(&obj.put_wait_q), \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a ring queue.
+ *
+ * The ring queue can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct k_ringq <name>; @endcode
+ *
+ * @param name Name of the ring queue.
+ * @param num_slots Number of entries the queue can hold (power of 2).
+ */
+#define K_RINGQ_DEFINE(name, num_slots)					\
+	BUILD_ASSERT(IS_POWER_OF_TWO(num_slots),			\
+		     "ring queue size must be a power of two");		\
+	static struct k_ringq_slot _k_ringq_buf_##name[num_slots];	\
+	STRUCT_SECTION_ITERABLE(k_ringq, name) =			\
+		Z_RINGQ_INITIALIZER(name, _k_ringq_buf_##name, (num_slots))
+
+/**
+ * @brief Initialize a ring queue.
+ *
+ * This routine initializes a ring queue object, prior to its first use.
+ *
+ * @param ringq Address of the ring queue.
+ * @param slots Array of @a num_slots slots holding the queued entries.
+ * @param num_slots Number of entries the queue can hold (power of 2).
+ *
+ * @retval 0 Ring queue initialized.
+ * @retval -EINVAL @a num_slots is not a power of two.
+ */
+int k_ringq_init(struct k_ringq *ringq, struct k_ringq_slot *slots,
+		 uint32_t num_slots);
+
+/**
+ * @brief Add an entry to a ring queue.
+ *
+ * This routine adds @a data to the tail of ring queue @a ringq. It does
+ * not take any lock unless the queue is full and the caller has to wait,
+ * or a thread is waiting for an entry and has to be woken up.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param ringq Address of the ring queue.
+ * @param data Entry to add. This is an opaque value, it is not dereferenced.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Entry added.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_ringq_put(struct k_ringq *ringq, void *data, k_timeout_t timeout);
+
+/**
+ * @brief Remove an entry from a ring queue.
+ *
+ * This routine removes the entry at the head of ring queue @a ringq. It
+ * does not take any lock unless the queue is empty and the caller has to
+ * wait, or a thread is waiting for a free slot and has to be woken up.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param ringq Address of the ring queue.
+ * @param data Address of the area receiving the entry.
+ * @param timeout Waiting period for an entry, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Entry removed.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_ringq_get(struct k_ringq *ringq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Get the number of entries in a ring queue.
+ *
+ * With concurrent producers or consumers the value is only a snapshot.
+ *
+ * @param ringq Address of the ring queue.
+ *
+ * @return Number of entries.
+ */
+__syscall uint32_t k_ringq_num_used_get(struct k_ringq *ringq);
+
+static inline uint32_t z_impl_k_ringq_num_used_get(struct k_ringq *ringq)
+{
+	/* Read head first: it never passes the tail */
+	uint32_t head = (uint32_t)atomic_get(&ringq->head);
+	uint32_t tail = (uint32_t)atomic_get(&ringq->tail);
+
+	return MIN(tail - head, ringq->mask + 1U);
+}
+
+/** @} */
+
 /**
  * @defgroup mailbox_apis Mailbox APIs
  * @ingroup kernel_apis
@@ -5653,12 +6045,39 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
  * @{
  */
 
+#ifdef CONFIG_HEAP_MAGAZINE
+/* Block size of a magazine size class */
+#define Z_HEAP_MAGAZINE_BLOCK_SIZE(size_class) \
+	((size_t)CONFIG_HEAP_MAGAZINE_MIN_SIZE << (size_class))
+
+/* per-CPU cache of free blocks of one size class */
+struct z_heap_magazine {
+	uint8_t count;
+	void *blocks[CONFIG_HEAP_MAGAZINE_DEPTH];
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t flushes;
+#endif
+};
+
+struct z_heap_cpu_cache {
+	struct k_spinlock lock;
+	struct z_heap_magazine mags[CONFIG_HEAP_MAGAZINE_CLASSES];
+};
+#endif /* CONFIG_HEAP_MAGAZINE */
+
 /* kernel synchronized heap struct */
 
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_HEAP_MAGAZINE
+	/* Number of threads about to wait for memory */
+	atomic_t waiters;
+	struct z_heap_cpu_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
 /**
@@ -5787,6 +6206,43 @@ void *k_heap_realloc(struct k_heap *h, void *ptr, size_t bytes, k_timeout_t time
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+/**
+ * @brief Magazine statistics of a k_heap size class
+ *
+ * The counters are summed over all CPUs.
+ */
+struct k_heap_magazine_stats {
+	/** Size of the blocks of the size class */
+	size_t block_size;
+	/** Bytes currently held in the magazines */
+	size_t cached_bytes;
+	/** Allocations served from a magazine */
+	uint32_t hits;
+	/** Allocations that found their magazine empty */
+	uint32_t misses;
+	/** Batches of blocks returned to the heap by full magazines */
+	uint32_t flushes;
+};
+
+/**
+ * @brief Get the magazine statistics of a k_heap size class
+ *
+ * Only available with @kconfig{CONFIG_HEAP_MAGAZINE} and
+ * @kconfig{CONFIG_SYS_HEAP_RUNTIME_STATS}.  A high miss or flush count
+ * compared to the hits of a size class suggests a deeper magazine,
+ * see @kconfig{CONFIG_HEAP_MAGAZINE_DEPTH}.
+ *
+ * @param h Heap
+ * @param size_class Size class, from 0 to
+ *        @kconfig{CONFIG_HEAP_MAGAZINE_CLASSES} - 1
+ * @param stats Statistics of the size class
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Invalid heap, size class or statistics pointer
+ */
+int k_heap_magazine_stats_get(struct k_heap *h, unsigned int size_class,
+			      struct k_heap_magazine_stats *stats);
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
@@ -5953,6 +6409,43 @@ void *k_calloc(size_t nmemb, size_t size);
  */
 void *k_realloc(void *ptr, size_t size);
 
+/**
+ * @brief Statistics of a k_malloc() memory slab size class
+ *
+ * The allocation, waste and fallback counters are cumulative.  The mean
+ * internal fragmentation of the size class is @a wasted_bytes out of
+ * @a allocs * @a block_size bytes.
+ */
+struct k_malloc_slab_stats {
+	/** Size of the blocks of the size class */
+	size_t block_size;
+	/** Number of blocks of the size class */
+	uint32_t num_blocks;
+	/** Number of blocks currently allocated */
+	uint32_t num_used;
+	/** Number of allocations served by the size class */
+	uint32_t allocs;
+	/** Bytes of the blocks allocated so far not used by the requests */
+	uint32_t wasted_bytes;
+	/** Allocations of the size class that went to the heap, the slab being full */
+	uint32_t fallbacks;
+};
+
+/**
+ * @brief Get the statistics of a k_malloc() memory slab size class
+ *
+ * Only available with @kconfig{CONFIG_HEAP_MEM_SLABS} and
+ * @kconfig{CONFIG_SYS_HEAP_RUNTIME_STATS}.  Size class @p size_class
+ * holds blocks of 16 << @p size_class bytes, up to 256 bytes.
+ *
+ * @param size_class Size class
+ * @param stats Statistics of the size class
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Invalid size class or statistics pointer
+ */
+int k_malloc_slab_stats_get(unsigned int size_class, struct k_malloc_slab_stats *stats);
+
 /** @} */
 
 /* polling API - PRIVATE */
@@ -6215,6 +6708,84 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+/**
+ * @brief Poll set
+ *
+ * A set of poll events that stay registered with their objects across waits,
+ * see k_poll_set_init().
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+	/* Events signaled since they were last returned */
+	sys_dlist_t ready;
+	/* Events returned by the last wait, to be registered again */
+	sys_dlist_t rearm;
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * A poll set holds poll events that are registered with their objects once,
+ * when added to the set, instead of on each k_poll() call. Signaled events are
+ * moved to a ready list, and k_poll_set_wait() only returns the ready events,
+ * so the cost of waiting does not depend on the number of events in the set.
+ *
+ * Poll sets are only available to supervisor threads, and only one thread
+ * should wait on a poll set at a time.
+ *
+ * @param set Poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add a poll event to a poll set.
+ *
+ * The event must have been initialized with k_poll_event_init() or one of the
+ * initializer macros, and must not be part of another poll set or passed to
+ * k_poll() until removed from the set. It is returned by the next wait if its
+ * condition is already met.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set Poll set.
+ * @param event Event to add.
+ */
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove a poll event from a poll set.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set Poll set.
+ * @param event Event to remove.
+ */
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * The events returned by the previous wait are registered again first, so a
+ * ready event whose condition is still met, e.g. a semaphore that has not been
+ * taken, is returned again. The state field of each returned event holds the
+ * ready state, it does not need to be reset by the caller.
+ *
+ * Ready events not fitting in @p ready are returned by the next wait.
+ *
+ * @param set Poll set.
+ * @param ready Array filled with pointers to the ready events.
+ * @param num_ready Size of the @p ready array.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of ready events stored in @p ready, greater than 0.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready, int num_ready,
+		    k_timeout_t timeout);
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -59,6 +59,11 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+	struct {
+		/** Number of pages paged in ahead of page faults */
+		unsigned long			pages;
+	} prefetch;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
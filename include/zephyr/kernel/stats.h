@@ -27,6 +27,17 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_WAKE_LATENCY) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_WAKE_LATENCY is selected.
+	 * @{
+	 */
+	uint32_t  ready_stamp;  /**< cycle count when made ready, 0 if running */
+	uint32_t  wake_longest; /**< longest wake-to-run latency in cycles */
+	uint64_t  wake_total;   /**< sum of the wake-to-run latencies in cycles */
+	uint32_t  num_wakes;    /**< \# of wake-to-run latencies measured */
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
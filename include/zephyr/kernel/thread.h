@@ -130,6 +130,17 @@ struct _thread_base {
 #endif /* CONFIG_MP_MAX_NUM_CPUS */
 #endif /* CONFIG_SCHED_CPU_MASK */
 
+#ifdef CONFIG_SCHED_CPU_MASK_BALANCE
+	/* CPUs the balancer may pin the thread to, 0 if not balanced */
+	uint16_t balance_mask;
+
+	/* Balancing periods left before the thread may move again */
+	uint8_t balance_hold;
+
+	/* Execution cycles at the last balancing period */
+	uint64_t balance_cycles;
+#endif /* CONFIG_SCHED_CPU_MASK_BALANCE */
+
 	/* data returned by APIs */
 	void *swap_data;
 
@@ -199,6 +210,15 @@ struct _mem_domain_info {
 typedef struct _mem_domain_info _mem_domain_info_t;
 #endif /* CONFIG_USERSPACE */
 
+#if defined(CONFIG_DYNAMIC_OBJECTS) && (CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0)
+/* Recently looked up dynamic kernel object */
+struct _thread_kobj_cache {
+	const void *obj;
+	struct k_object *ko;
+	uint32_t gen;
+};
+#endif
+
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
 struct _thread_userspace_local_data {
 #if defined(CONFIG_ERRNO) && !defined(CONFIG_ERRNO_IN_TLS) && !defined(CONFIG_LIBC_ERRNO)
@@ -230,6 +250,15 @@ typedef struct k_thread_runtime_stats {
 	uint64_t average_cycles;      /* average # of non-idle cycles */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+	/*
+	 * Time between the thread being made ready and being switched in.
+	 * Always zero when gathering statistics for the CPU.
+	 */
+	uint64_t wake_peak_cycles;    /* longest wake-to-run latency */
+	uint64_t wake_average_cycles; /* average wake-to-run latency */
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	/*
 	 * This field is always zero for individual threads. It only comes
@@ -286,6 +315,11 @@ struct k_thread {
 	bool no_wake_on_timeout;
 #endif /* CONFIG_EVENTS */
 
+#if CONFIG_MUTEX_PI_CHAIN_DEPTH > 0
+	/** mutex on which the thread is pended, for transitive inheritance */
+	struct k_mutex *pended_mutex;
+#endif /* CONFIG_MUTEX_PI_CHAIN_DEPTH */
+
 #if defined(CONFIG_THREAD_MONITOR)
 	/** thread entry and parameters description */
 	struct __thread_entry entry;
@@ -334,6 +368,11 @@ struct k_thread {
 
 	/** current syscall frame pointer */
 	void *syscall_frame;
+
+#if defined(CONFIG_DYNAMIC_OBJECTS) && (CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0)
+	/** recently looked up dynamic kernel objects */
+	struct _thread_kobj_cache kobj_cache[CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE];
+#endif
 #endif /* CONFIG_USERSPACE */
 
 
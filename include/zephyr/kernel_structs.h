@@ -113,15 +113,23 @@ struct _priq_rb {
 
 
 /* Traditional/textbook "multi-queue" structure.  Separate lists for a
- * small number (max 32 here) of fixed priorities.  This corresponds
- * to the original Zephyr scheduler.  RAM requirements are
- * comparatively high, but performance is very fast.  Won't work with
- * features like deadline scheduling which need large priority spaces
- * to represent their requirements.
+ * number of fixed priorities.  This corresponds to the original
+ * Zephyr scheduler.  RAM requirements are comparatively high, but
+ * performance is very fast.  Won't work with features like deadline
+ * scheduling which need large priority spaces to represent their
+ * requirements.
+ *
+ * Non-empty lists are tracked in a bitmap.  When there are more
+ * priorities than fit in one word, a summary word with one bit per
+ * non-zero bitmap word keeps the lookup of the best list constant
+ * time.
  */
 struct _priq_mq {
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
 	unsigned long bitmask[PRIQ_BITMAP_SIZE];
+#if PRIQ_BITMAP_SIZE > 1
+	unsigned long bitmask_summary;
+#endif
 #ifndef CONFIG_SMP
 	unsigned int cached_queue_index;
 #endif
@@ -157,7 +165,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -305,6 +313,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	/* Index of the CPU whose queue holds (or last held) this timeout */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -64,6 +64,9 @@ struct log_backend_api {
 	void (*process)(const struct log_backend *const backend,
 			union log_msg_generic *msg);
 
+	void (*process_batch)(const struct log_backend *const backend,
+			      union log_msg_generic **msgs, size_t cnt);
+
 	void (*dropped)(const struct log_backend *const backend, uint32_t cnt);
 	void (*panic)(const struct log_backend *const backend);
 	void (*init)(const struct log_backend *const backend);
@@ -182,6 +185,39 @@ static inline void log_backend_msg_process(const struct log_backend *const backe
 	backend->api->process(backend, msg);
 }
 
+/**
+ * @brief Process a batch of messages.
+ *
+ * Function is optional and used in deferred mode only, when
+ * @kconfig{CONFIG_LOG_PROCESS_BATCH_SIZE} is greater than 1. It allows the
+ * backend to send several messages at once. Messages are given in the order
+ * in which they shall be output and are already filtered for the backend.
+ * Backend shall still implement the process callback, which is used for the
+ * remaining cases (e.g. panic). On return, content of all messages is
+ * processed by the backend and memory can be freed.
+ *
+ * If the backend has no batch processing, messages are processed one by one.
+ *
+ * @param[in] backend  Pointer to the backend instance.
+ * @param[in] msgs     Array of pointers to messages with log entries.
+ * @param[in] cnt      Number of messages in @p msgs.
+ */
+static inline void log_backend_msg_batch_process(const struct log_backend *const backend,
+						 union log_msg_generic **msgs, size_t cnt)
+{
+	__ASSERT_NO_MSG(backend != NULL);
+	__ASSERT_NO_MSG(msgs != NULL);
+
+	if (backend->api->process_batch != NULL) {
+		backend->api->process_batch(backend, msgs, cnt);
+		return;
+	}
+
+	for (size_t i = 0; i < cnt; i++) {
+		backend->api->process(backend, msgs[i]);
+	}
+}
+
 /**
  * @brief Notify backend about dropped log messages.
  *
@@ -57,6 +57,13 @@ extern "C" {
 /** @brief Flag forcing to skip logging the source. */
 #define LOG_OUTPUT_FLAG_SKIP_SOURCE		BIT(8)
 
+/** @brief Flag leaving the formatted message in the output buffer.
+ *
+ * The message is sent along with the following ones, when the buffer gets
+ * full or on @ref log_output_flush. Used to send a batch of messages at once.
+ */
+#define LOG_OUTPUT_FLAG_DEFER_FLUSH		BIT(9)
+
 /**@} */
 
 /** @brief Supported backend logging format types for use
@@ -90,6 +97,10 @@ struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT)
+	/* Timestamp of the previous compact dictionary based message */
+	log_timestamp_t dict_timestamp;
+#endif
 };
 
 /** @brief Log_output instance structure. */
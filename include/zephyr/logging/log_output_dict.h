@@ -23,6 +23,7 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	MSG_NORMAL_COMPACT = 2,
 };
 
 /**
@@ -38,6 +39,24 @@ struct log_dict_output_normal_msg_hdr_t {
 	log_timestamp_t timestamp;
 } __packed;
 
+/**
+ * Output for one compact dictionary based log message, with
+ * CONFIG_LOG_DICTIONARY_COMPACT.
+ *
+ * Integers are encoded on 7 bits per byte, least significant first, with
+ * the most significant bit set when more bytes follow:
+ *
+ * - uint8_t type, MSG_NORMAL_COMPACT
+ * - uint8_t domain on bits 0-3, level on bits 4-7
+ * - source ID
+ * - difference to the timestamp of the previous message, zigzag encoded
+ * - package length, in bytes
+ * - data length, in bytes
+ * - words of the package arguments, including its header
+ * - remaining bytes of the package, as is
+ * - data, as is
+ */
+
 /**
  * Output for one dictionary based log message about
  * dropped messages.
@@ -162,6 +162,10 @@ struct modem_cmux {
 	uint8_t frame_header[5];
 	uint16_t frame_header_len;
 
+	/* DLCI receive buffer the payload of the received frame is claimed from */
+	struct modem_cmux_dlci *receive_dlci;
+	uint16_t receive_dlci_claimed;
+
 	/* Work */
 	struct k_work_delayable receive_work;
 	struct k_work_delayable transmit_work;
@@ -34,6 +34,7 @@ extern "C" {
 struct net_if;
 struct net_pkt;
 struct device;
+struct net_capture_filter_insn;
 
 struct net_capture_interface_api {
 	/** Cleanup the setup. This will also disable capturing. After this
@@ -53,10 +54,35 @@ struct net_capture_interface_api {
 
 	/** Send captured data */
 	int (*send)(const struct device *dev, struct net_if *iface, struct net_pkt *pkt);
+
+	/** Set the filter and the snapshot length of the captured packets */
+	int (*set_filter)(const struct device *dev, const struct net_capture_filter_insn *prog,
+			  size_t count, size_t snaplen);
 };
 
 /** @endcond */
 
+/**
+ * @brief Instruction of a capture filter.
+ *
+ * The capture filters are classic BPF programs, with the same layout and
+ * semantics as a Linux socket filter. For instance, the output of
+ * ``tcpdump -dd`` can be used as is. The program is run on the captured
+ * network packet, starting from its link layer header, and returns how
+ * many bytes of the packet to capture, 0 meaning that the packet is not
+ * captured. Extensions (loads from negative offsets) are not supported.
+ */
+struct net_capture_filter_insn {
+	/** Opcode */
+	uint16_t code;
+	/** Jump offset if the condition is true */
+	uint8_t jt;
+	/** Jump offset if the condition is false */
+	uint8_t jf;
+	/** Constant operand */
+	uint32_t k;
+};
+
 /**
  * @brief Setup network packet capturing support.
  *
@@ -179,6 +205,47 @@ static inline int net_capture_disable(const struct device *dev)
 #endif
 }
 
+/**
+ * @brief Filter and truncate the captured network packets.
+ *
+ * @details The filter is run on each network packet before it is copied,
+ * so the packets that are not wanted cost neither memory nor tunnel
+ * bandwidth. Requires @kconfig{CONFIG_NET_CAPTURE_FILTER}.
+ *
+ * @param dev Network capture device
+ * @param prog Filter program, see @ref net_capture_filter_insn. The program
+ *        is not copied and must stay valid while it is set. NULL to capture
+ *        all the packets.
+ * @param count Number of instructions in the program.
+ * @param snaplen Maximum number of bytes captured from each packet, 0 for
+ *        no limit.
+ *
+ * @return 0 if ok, -EINVAL if the program is not valid, -ENOTSUP if
+ *         filtering is not supported.
+ */
+static inline int net_capture_filter_set(const struct device *dev,
+					 const struct net_capture_filter_insn *prog,
+					 size_t count, size_t snaplen)
+{
+#if defined(CONFIG_NET_CAPTURE)
+	const struct net_capture_interface_api *api =
+		(const struct net_capture_interface_api *)dev->api;
+
+	if (api->set_filter == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->set_filter(dev, prog, count, snaplen);
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(prog);
+	ARG_UNUSED(count);
+	ARG_UNUSED(snaplen);
+
+	return -ENOTSUP;
+#endif
+}
+
 /** @cond INTERNAL_HIDDEN */
 
 /**
@@ -106,6 +106,17 @@ struct coap_client_internal_request {
 	/* For GETs with observe option set */
 	bool is_observe;
 	int last_response_id;
+
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	/* For a block requested ahead in a Block2 transfer, the transfer request */
+	struct coap_client_internal_request *parent;
+	uint32_t block_num;
+	uint16_t block_len;
+	bool block_received;
+	uint8_t block_buf[CONFIG_COAP_CLIENT_BLOCK_SIZE];
+	/* For a Block2 transfer request, next block to request ahead */
+	uint32_t next_block_num;
+#endif
 };
 
 struct coap_client {
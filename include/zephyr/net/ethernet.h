@@ -202,6 +202,17 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload supported, packets with a GSO size are
+	 * split into segments of that size and their checksums computed by
+	 * the device.
+	 */
+	ETHERNET_HW_TSO			= BIT(21),
+
+	/** Several RX queues (DMA rings), the received packets are tagged
+	 * with the queue they come from, see net_pkt_set_rx_queue().
+	 */
+	ETHERNET_HW_RX_QUEUES		= BIT(22),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -221,6 +232,7 @@ enum ethernet_config_type {
 	ETHERNET_CONFIG_TYPE_RX_CHECKSUM_SUPPORT,
 	ETHERNET_CONFIG_TYPE_TX_CHECKSUM_SUPPORT,
 	ETHERNET_CONFIG_TYPE_EXTRA_TX_PKT_HEADROOM,
+	ETHERNET_CONFIG_TYPE_RX_QUEUES_NUM,
 };
 
 enum ethernet_qav_param_type {
@@ -503,6 +515,7 @@ struct ethernet_config {
 
 		int priority_queues_num;
 		int ports_num;
+		int rx_queues_num;
 
 		enum ethernet_checksum_support chksum_support;
 
@@ -1412,6 +1425,61 @@ static inline bool net_eth_type_is_wifi(struct net_if *iface)
 	return ctx->eth_if_type == L2_ETH_IF_TYPE_WIFI;
 }
 
+struct net_eth_napi;
+
+/**
+ * @brief Receive frames from a network device being polled.
+ *
+ * @param napi Polling context of the device
+ * @param budget Max number of frames to receive
+ *
+ * @return Number of frames received, or dropped because of an error.
+ */
+typedef int (*net_eth_napi_poll_t)(struct net_eth_napi *napi, int budget);
+
+/**
+ * @brief Enable again the RX interrupts of a network device, once it has
+ * no frame left.
+ *
+ * @param napi Polling context of the device
+ */
+typedef void (*net_eth_napi_irq_enable_t)(struct net_eth_napi *napi);
+
+/**
+ * @brief Polling context of a network device, see CONFIG_NET_ETH_NAPI.
+ *
+ * Usually embedded in the driver data, which the callbacks get with
+ * CONTAINER_OF().
+ */
+struct net_eth_napi {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	net_eth_napi_poll_t poll;
+	net_eth_napi_irq_enable_t irq_enable;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize the polling context of a network device.
+ *
+ * @param napi Polling context of the device
+ * @param poll Callback receiving frames from the device
+ * @param irq_enable Callback enabling the RX interrupts of the device
+ */
+void net_eth_napi_init(struct net_eth_napi *napi, net_eth_napi_poll_t poll,
+		       net_eth_napi_irq_enable_t irq_enable);
+
+/**
+ * @brief Schedule the poll of a network device.
+ *
+ * Called from the RX interrupt handler of the device, once it has disabled
+ * its RX interrupts. The device is polled until it has no frame left,
+ * then its RX interrupts are enabled again.
+ *
+ * @param napi Polling context of the device
+ */
+void net_eth_napi_schedule(struct net_eth_napi *napi);
+
 /**
  * @}
  */
@@ -36,10 +36,44 @@ extern "C" {
 
 #if defined(CONFIG_NET_ETHERNET_BRIDGE)
 #define NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT CONFIG_NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT
+#define NET_ETHERNET_BRIDGE_FDB_SIZE CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE
 #else
 #define NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT 1
+#define NET_ETHERNET_BRIDGE_FDB_SIZE 1
 #endif
 
+/* Learned location of a MAC address */
+struct eth_bridge_fdb_entry {
+	struct net_eth_addr addr;
+
+	/* Index of the Ethernet interface in eth_iface */
+	uint8_t port;
+
+	/* Is the entry in use */
+	bool valid;
+
+	/* Uptime in seconds when a frame was last received from addr */
+	uint32_t seen;
+};
+
+/** @endcond */
+
+/** Per-port counters of a bridge */
+struct eth_bridge_port_stats {
+	/** Frames received from the port */
+	uint32_t rx;
+	/** Frames sent to the port */
+	uint32_t tx;
+	/** Received frames sent to all the other ports, as their destination was not known */
+	uint32_t flooded;
+	/** Received frames dropped, as their destination is on the same port */
+	uint32_t filtered;
+	/** Frames that could not be sent to the port */
+	uint32_t dropped;
+};
+
+/** @cond INTERNAL_HIDDEN */
+
 struct eth_bridge_iface_context {
 	/* Lock to protect access to interface array below */
 	struct k_mutex lock;
@@ -50,6 +84,12 @@ struct eth_bridge_iface_context {
 	/* What Ethernet interfaces are bridged together */
 	struct net_if *eth_iface[NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT];
 
+	/* Counters of each Ethernet interface in eth_iface */
+	struct eth_bridge_port_stats stats[NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT];
+
+	/* Forwarding database, hashed by MAC address */
+	struct eth_bridge_fdb_entry fdb[NET_ETHERNET_BRIDGE_FDB_SIZE];
+
 	/* How many interfaces are bridged atm */
 	size_t count;
 
@@ -99,6 +139,19 @@ int eth_bridge_iface_add(struct net_if *br, struct net_if *iface);
  */
 int eth_bridge_iface_remove(struct net_if *br, struct net_if *iface);
 
+/**
+ * @brief Get the counters of an Ethernet interface of a bridge
+ *
+ * @param br A pointer to a bridge interface
+ * @param iface Ethernet interface of the bridge
+ * @param stats Counters of the interface
+ *
+ * @return 0 if OK, -ENOENT if @p iface is not in the bridge,
+ *         -EINVAL if @p br is not a bridge.
+ */
+int eth_bridge_port_stats_get(struct net_if *br, struct net_if *iface,
+			      struct eth_bridge_port_stats *stats);
+
 /**
  * @brief Get bridge index according to pointer
  *
@@ -12,6 +12,7 @@
 #ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 #define ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -104,6 +105,15 @@ enum http_hpack_static_key {
 #define HTTP_SERVER_HUFFMAN_DECODE_BUFFER_SIZE 0
 #endif
 
+#if defined(CONFIG_HTTP_SERVER)
+#define HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE CONFIG_HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE
+#else
+#define HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE 0
+#endif
+
+/* Size accounted for each dynamic table entry on top of its name and value, RFC7541 ch 4.1 */
+#define HTTP_HPACK_ENTRY_OVERHEAD 32
+
 /** @endcond */
 
 /** HTTP2 header field with decoding buffer. */
@@ -127,8 +137,32 @@ struct http_hpack_header_buf {
 	size_t datalen;
 };
 
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0 || defined(__DOXYGEN__)
+/** HPACK encoder with a dynamic table, one per HTTP2 connection. */
+struct http_hpack_encoder {
+	/** @cond INTERNAL_HIDDEN */
+	/* Names and values of the dynamic table entries, oldest first */
+	uint8_t data[HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE];
+	struct {
+		uint16_t name_len;
+		uint16_t value_len;
+	} entries[HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE / HTTP_HPACK_ENTRY_OVERHEAD];
+	uint16_t count;
+	uint16_t data_len;
+	/* Table size as defined in RFC7541 ch 4.1 */
+	uint16_t size;
+	uint16_t max_size;
+	/* Dynamic table size update(s) to signal in the next header block */
+	bool clear_pending : 1;
+	bool size_update_pending : 1;
+	/** @endcond */
+};
+#endif
+
 /** @cond INTERNAL_HIDDEN */
 
+struct http_hpack_encoder;
+
 int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 			      uint8_t *buf, size_t buflen);
 int http_hpack_huffman_encode(const uint8_t *str, size_t str_len,
@@ -138,6 +172,14 @@ int http_hpack_decode_header(const uint8_t *buf, size_t datalen,
 int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 			     struct http_hpack_header_buf *header);
 
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+void http_hpack_encoder_init(struct http_hpack_encoder *encoder);
+void http_hpack_encoder_set_max_size(struct http_hpack_encoder *encoder, uint32_t max_size);
+void http_hpack_encoder_reset(struct http_hpack_encoder *encoder);
+int http_hpack_encoder_encode_header(struct http_hpack_encoder *encoder, uint8_t *buf,
+				     size_t buflen, struct http_hpack_header_buf *header);
+#endif
+
 /** @endcond */
 
 #ifdef __cplusplus
@@ -120,6 +120,12 @@ struct http_resource_detail_static {
 
 	/** Size of the static resource. */
 	size_t static_data_len;
+
+	/** Entity tag of the static resource, including the double quotes,
+	 *  for example ``"\"v1\""``. Used only with
+	 *  @kconfig{CONFIG_HTTP_SERVER_ETAG}, NULL when the resource has no tag.
+	 */
+	const char *etag;
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -343,6 +349,8 @@ enum http1_parser_state {
 };
 
 #define HTTP_SERVER_INITIAL_WINDOW_SIZE 65536
+/* Send window granted by the client until it says otherwise, RFC 9113 ch 6.9.2 */
+#define HTTP_SERVER_DEFAULT_SEND_WINDOW_SIZE 65535
 #define HTTP_SERVER_WS_MAX_SEC_KEY_LEN 32
 
 /** @endcond */
@@ -356,6 +364,19 @@ struct http2_stream_ctx {
 	/** Currently processed resource detail. */
 	struct http_resource_detail *current_detail;
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+/** @cond INTERNAL_HIDDEN */
+	/** Stream-level send window, as granted by the client. */
+	int send_window;
+
+	/** Static content of the response not sent yet. */
+	const uint8_t *pending_data;
+
+	/** Length of the static content not sent yet. */
+	size_t pending_len;
+/** @endcond */
+#endif
+
 	/** Flag indicating that headers were sent in the reply. */
 	bool headers_sent : 1;
 
@@ -425,6 +446,19 @@ struct http_client_ctx {
 	/** Connection-level window size. */
 	int window_size;
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+/** @cond INTERNAL_HIDDEN */
+	/** Connection-level send window, as granted by the client. */
+	int send_window;
+
+	/** Initial stream-level send window, as set by the client. */
+	int initial_send_window;
+
+	/** Stream to serve first in the next round of scheduled responses. */
+	uint8_t next_stream;
+/** @endcond */
+#endif
+
 	/** Server state for the associated client. */
 	enum http_server_state server_state;
 
@@ -440,6 +474,11 @@ struct http_client_ctx {
 	/** HTTP/2 header parser context. */
 	struct http_hpack_header_buf header_field;
 
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+	/** HTTP/2 header encoder context. */
+	struct http_hpack_encoder hpack_encoder;
+#endif
+
 	/** HTTP/2 streams context. */
 	struct http2_stream_ctx streams[HTTP_SERVER_MAX_STREAMS];
 
@@ -490,6 +529,12 @@ struct http_client_ctx {
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (uint8_t supported_compression));
 /** @endcond */
 
+/** @cond INTERNAL_HIDDEN */
+	/** If-None-Match header value of the current request. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG,
+		   (char if_none_match[CONFIG_HTTP_SERVER_MAX_ETAG_LEN + 1]));
+/** @endcond */
+
 	/** Flag indicating that HTTP2 preface was sent. */
 	bool preface_sent : 1;
 
@@ -511,6 +556,9 @@ struct http_client_ctx {
 	/** Flag indicating accept encoding is being processed. */
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (bool accept_encoding_next: 1));
 
+	/** Flag indicating If-None-Match is being processed. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG, (bool if_none_match_next: 1));
+
 	/** The next frame on the stream is expectd to be a continuation frame. */
 	bool expect_continuation : 1;
 };
@@ -67,6 +67,12 @@ struct http_resource_desc {
 
 struct http_service_runtime_data {
 	int num_clients;
+#if CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0
+	/* Resources of the service looked up in the resource index */
+	bool indexed;
+	/* Number of wildcard resources, not in the resource index */
+	uint16_t num_globs;
+#endif
 };
 
 struct http_service_desc {
@@ -864,6 +864,26 @@ struct mqtt_transport {
 };
 
 /** @brief MQTT internal state. */
+#if defined(CONFIG_MQTT_INFLIGHT) || defined(__DOXYGEN__)
+/** @brief QoS 1 or QoS 2 publication waiting for an acknowledgment. */
+struct mqtt_inflight {
+	/** Internal. Publication, referencing the application topic and
+	 *  payload.
+	 */
+	struct mqtt_publish_param param;
+
+	/** Internal. Wall clock value (in milliseconds) of the last
+	 *  transmission.
+	 */
+	uint32_t sent_time;
+
+	/** Internal. Type of the packet awaited from the broker, 0 if the
+	 *  entry is free.
+	 */
+	uint8_t awaited;
+};
+#endif /* CONFIG_MQTT_INFLIGHT */
+
 struct mqtt_internal {
 	/** Internal. Mutex to protect access to the client instance. */
 	struct sys_mutex mutex;
@@ -889,6 +909,11 @@ struct mqtt_internal {
 	/** Internal. MQTT 5.0 disconnect reason set in case of processing errors. */
 	enum mqtt_disconnect_reason_code disconnect_reason;
 #endif /* CONFIG_MQTT_VERSION_5_0 */
+
+#if defined(CONFIG_MQTT_INFLIGHT) || defined(__DOXYGEN__)
+	/** Internal. Publications waiting for an acknowledgment. */
+	struct mqtt_inflight inflight[CONFIG_MQTT_INFLIGHT_WINDOW];
+#endif /* CONFIG_MQTT_INFLIGHT */
 };
 
 /**
@@ -1081,7 +1106,15 @@ int mqtt_connect(struct mqtt_client *client);
  * @param[in] param Parameters to be used for the publish message.
  *                  Shall not be NULL.
  *
+ * @note The payload is sent from the application buffer, it is not copied to
+ *       the client TX buffer.
+ * @note With @kconfig{CONFIG_MQTT_INFLIGHT}, the QoS 1 and QoS 2
+ *       publications are kept until the broker acknowledges them, and the
+ *       topic and payload must remain valid until then.
+ *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ * @retval -ENOBUFS With @kconfig{CONFIG_MQTT_INFLIGHT}, the maximum number of
+ *         in-flight publications is reached.
  */
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
@@ -1229,6 +1262,9 @@ int mqtt_abort(struct mqtt_client *client);
  *        makes it possible to respect the Keep Alive time agreed with the
  *        broker on connection. @ref mqtt_connect for details on Keep Alive
  *        time.
+ * @note  With @kconfig{CONFIG_MQTT_INFLIGHT_RETRANSMIT_TIMEOUT}, this also
+ *        sends again the in-flight publications that were not acknowledged in
+ *        time.
  *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
  */
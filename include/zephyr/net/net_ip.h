@@ -264,6 +264,12 @@ struct msghdr {
 	int           msg_flags;      /**< Flags on received message */
 };
 
+/** Message struct for sending or receiving several messages at once */
+struct mmsghdr {
+	struct msghdr msg_hdr;        /**< Message */
+	unsigned int  msg_len;        /**< Number of bytes sent or received */
+};
+
 /** Control message ancillary data */
 struct cmsghdr {
 	socklen_t cmsg_len;    /**< Number of bytes, including header */
@@ -1833,6 +1839,53 @@ int net_tx_priority2tc(enum net_priority prio);
  */
 int net_rx_priority2tc(enum net_priority prio);
 
+/** Statistics of a shaped Tx traffic class. */
+struct net_tc_tx_shaper_stats {
+	/** Packets passed to the driver. */
+	uint32_t pkts;
+	/** Bytes passed to the driver. */
+	uint64_t bytes;
+	/** Packets held back because the class was out of credit. */
+	uint32_t delayed;
+	/** Total time the packets were held back, in milliseconds. */
+	uint32_t delay_ms;
+	/** Packets dropped because the queue of the class was full. */
+	uint32_t dropped;
+};
+
+/**
+ * @brief Configure the rate shaper of a Tx traffic class.
+ *
+ * The class gains credit at @p rate bytes per second, up to @p burst bytes
+ * while it is idle. A packet is passed to the driver when the credit of the
+ * class is not negative, and its length is then deducted from the credit.
+ * This is the credit based shaper of IEEE 802.1Qav, with an idle slope of
+ * @p rate and a high credit of @p burst.
+ *
+ * Requires @kconfig{CONFIG_NET_TC_TX_SHAPER}.
+ *
+ * @param tc Tx traffic class, see net_tx_priority2tc().
+ * @param rate Rate in bytes per second, 0 to not shape the class.
+ * @param burst Burst size in bytes.
+ *
+ * @return 0 if ok, -EINVAL if the class does not exist, -ENOTSUP if the
+ *         shaper is not supported.
+ */
+int net_tc_tx_shaper_set(uint8_t tc, uint32_t rate, uint32_t burst);
+
+/**
+ * @brief Get the statistics of a Tx traffic class.
+ *
+ * The statistics are counted whether the class is shaped or not.
+ *
+ * @param tc Tx traffic class, see net_tx_priority2tc().
+ * @param stats Statistics.
+ *
+ * @return 0 if ok, -EINVAL if the class does not exist, -ENOTSUP if the
+ *         shaper is not supported.
+ */
+int net_tc_tx_shaper_stats_get(uint8_t tc, struct net_tc_tx_shaper_stats *stats);
+
 /**
  * @brief Convert network packet VLAN priority to network packet priority so we
  * can place the packet into correct queue.
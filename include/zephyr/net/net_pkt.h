@@ -61,6 +61,11 @@ struct net_pkt_alloc_stats_slab {
 	struct net_pkt_alloc_stats ok;
 	struct net_pkt_alloc_stats fail;
 	struct k_mem_slab *slab;
+#if defined(CONFIG_NET_PKT_RX_CACHE)
+	/* Allocations served by a per-thread cache, and bulk refills */
+	uint32_t cache_hits;
+	uint32_t cache_refills;
+#endif
 };
 
 #define NET_PKT_ALLOC_STATS_DEFINE(alloc_name, slab_name)		  \
@@ -360,6 +365,20 @@ struct net_pkt {
 	uint8_t ipv4_pmtu : 1;
 #endif /* CONFIG_NET_IPV4_PMTU */
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Size of the TCP segments this packet is to be split into
+	 * before transmission, 0 if the packet is sent as is.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_TC_RX_QUEUES)
+	/* Hardware RX queue the packet was received from, plus one, or 0
+	 * if the driver did not tell.
+	 */
+	uint8_t rx_queue;
+#endif /* CONFIG_NET_TC_RX_QUEUES */
+
 	/* @endcond */
 };
 
@@ -1047,6 +1066,66 @@ static inline void net_pkt_set_ip_reassembled(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IP_FRAGMENT */
 
+#if defined(CONFIG_NET_TCP_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	pkt->gso_size = size;
+}
+#else /* CONFIG_NET_TCP_GSO */
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_TC_RX_QUEUES)
+static inline int net_pkt_rx_queue(struct net_pkt *pkt)
+{
+	return (int)pkt->rx_queue - 1;
+}
+
+/**
+ * @brief Tell from which hardware RX queue a packet was received
+ *
+ * The packets of a queue are all processed by the same RX thread, see
+ * CONFIG_NET_TC_RX_QUEUES. Packets with no queue set are spread over the
+ * RX threads by a hash of their flow.
+ *
+ * @param pkt Network packet
+ * @param queue Hardware RX queue, from 0
+ */
+static inline void net_pkt_set_rx_queue(struct net_pkt *pkt, uint8_t queue)
+{
+	pkt->rx_queue = queue + 1U;
+}
+#else /* CONFIG_NET_TC_RX_QUEUES */
+static inline int net_pkt_rx_queue(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return -1;
+}
+
+static inline void net_pkt_set_rx_queue(struct net_pkt *pkt, uint8_t queue)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(queue);
+}
+#endif /* CONFIG_NET_TC_RX_QUEUES */
+
 static inline uint8_t net_pkt_priority(struct net_pkt *pkt)
 {
 	return pkt->priority;
@@ -127,7 +127,6 @@ enum prometheus_walk_state {
 struct prometheus_collector_walk_context {
 	struct prometheus_collector *collector;
 	struct prometheus_metric *metric;
-	struct prometheus_metric *tmp;
 	enum prometheus_walk_state state;
 };
 
@@ -137,12 +136,16 @@ struct prometheus_collector_walk_context {
  * @brief Walk through all metrics in a Prometheus collector and format them
  *        into a buffer.
  *
+ * Each call formats as many complete metrics as fit in the buffer, so that
+ * the buffer can be sent as one chunk of the HTTP response. The buffer holds
+ * metrics also when 0 is returned.
+ *
  * @param ctx Pointer to the walker context.
  * @param buffer Pointer to the buffer to store the formatted metrics.
  * @param buffer_size Size of the buffer.
  * @return 0 if successful and we went through all metrics, -EAGAIN if we
- *	 need to call this function again, any other negative error code
- *	 means an error occurred.
+ *	 need to call this function again, -ENOMEM if a metric does not fit
+ *	 in the buffer, any other negative error code means an error occurred.
  */
 int prometheus_collector_walk_metrics(struct prometheus_collector_walk_context *ctx,
 				      uint8_t *buffer, size_t buffer_size);
@@ -165,7 +168,6 @@ static inline int prometheus_collector_walk_init(struct prometheus_collector_wal
 	ctx->collector = collector;
 	ctx->state = PROMETHEUS_WALK_START;
 	ctx->metric = NULL;
-	ctx->tmp = NULL;
 
 	return 0;
 }
@@ -205,6 +205,9 @@ extern "C" {
  *  - 2 - DTLS CID will be enabled, and the most recent value set with
  *        TLS_DTLS_CID_VALUE will be sent to the peer. Otherwise, a random value
  *        will be used.
+ *  When the peer uses the CID sent to it, a change of its address, e.g. after a
+ *  NAT rebinding, is followed as soon as a record from the new address is
+ *  authenticated, without a new handshake.
  */
 #define TLS_DTLS_CID 14
 /** Read-only socket option to get DTLS CID status.
@@ -511,6 +514,27 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send several messages to arbitrary network addresses
+ *
+ * @details
+ * Sends the @p vlen messages of @p msgvec as zsock_sendmsg() would, but
+ * looking up and locking the socket only once. The @c msg_len field of
+ * each message sent is set to the number of bytes sent.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * If a message other than the first one cannot be sent, the batch stops
+ * there and the number of messages already sent is returned. The error is
+ * not reported: it is returned by the call passing the messages left, from
+ * the one that failed, if the failure persists.
+ *
+ * @return Number of messages sent, or -1 with errno set if the first one
+ *         could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -537,6 +561,66 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive several messages at once
+ *
+ * @details
+ * Receives up to @p vlen messages into @p msgvec as zsock_recvmsg() would,
+ * but looking up and locking the socket only once. Only the reception of
+ * the first message may block, the following ones return with the
+ * messages already queued. The @c msg_len field of each message received
+ * is set to the number of bytes received.
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * If a message other than the first one cannot be received, the batch
+ * stops there and the number of messages already received is returned.
+ * The error is not reported: it is returned by the next call if the
+ * failure persists.
+ *
+ * @return Number of messages received, or -1 with errno set if none was.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+/**
+ * @brief Receive a datagram without copying it
+ *
+ * @details
+ * Zephyr-specific extension of zsock_recvmsg() for native datagram
+ * sockets, available if @kconfig{CONFIG_NET_SOCKETS_RECV_ZEROCOPY} is
+ * enabled. Instead of copying the payload into the buffers of @p msg, the
+ * @c iov_base and @c iov_len fields of its I/O vectors are set to reference
+ * the payload where it was received, one vector per network buffer, and
+ * @c msg_iovlen is set to the number of vectors used. If the payload
+ * spans more network buffers than @p msg has vectors, the remaining data
+ * is dropped and @c ZSOCK_MSG_TRUNC is set in @c msg_flags. The source
+ * address and the control data are returned as by zsock_recvmsg().
+ *
+ * The referenced network buffers remain allocated, and hence unavailable
+ * to receive further packets, until @p ref is passed to
+ * zsock_recv_zc_release().
+ *
+ * This function is not available from user mode, which cannot access the
+ * network buffers.
+ *
+ * @param sock Socket descriptor.
+ * @param msg Message header, its @c msg_iov and @c msg_iovlen fields give
+ *        the vectors available on input.
+ * @param flags @c ZSOCK_MSG_DONTWAIT or @c ZSOCK_MSG_PEEK.
+ * @param ref Set to the reference to release once the payload is consumed.
+ *
+ * @return Number of bytes referenced by @p msg, or -1 with errno set.
+ */
+ssize_t zsock_recvmsg_zc(int sock, struct msghdr *msg, int flags, void **ref);
+
+/**
+ * @brief Release a datagram received with zsock_recvmsg_zc()
+ *
+ * @param ref Reference returned by zsock_recvmsg_zc().
+ */
+void zsock_recv_zc_release(void *ref);
+
 /**
  * @brief Receive data from a connected peer
  *
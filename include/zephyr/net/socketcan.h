@@ -45,6 +45,14 @@ enum {
 
 /** @endcond */
 
+/**
+ * Type of the control message, at level SOL_CAN_RAW, that holds the CAN
+ * controller timestamp of a received frame as an uint16_t. It is added by
+ * recvmsg() if @kconfig{CONFIG_CAN_RX_TIMESTAMP} is enabled and a large
+ * enough control buffer is given.
+ */
+#define CAN_RAW_RX_TIMESTAMP 0x100
+
 /* SocketCAN MTU size compatible with Linux */
 #ifdef CONFIG_CAN_FD_MODE
 /** SocketCAN max data length */
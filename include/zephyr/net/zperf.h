@@ -90,6 +90,9 @@ struct zperf_results {
 	uint64_t client_time_in_us;   /**< Client connection time in microseconds */
 	uint32_t packet_size;         /**< Packet size */
 	uint32_t nb_packets_errors;   /**< Number of packet errors */
+	uint32_t cpu_usage;           /**< CPU usage during the transfer in 0.1 % units,
+				       *   0 if @kconfig{CONFIG_NET_ZPERF_CPU_USAGE} is disabled
+				       */
 };
 
 /**
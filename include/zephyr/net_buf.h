@@ -1390,6 +1390,42 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate a chain of buffers from a pool.
+ *
+ * Allocate @p count buffers from a pool, each with a data buffer of at least
+ * @p size bytes, linked as fragments of the first one. The buffers that are
+ * available right away are taken with a single acquisition of the pool lock,
+ * which makes this cheaper than allocating the fragments one at a time. The
+ * allocation is all or nothing: if not all buffers can be allocated before
+ * the timeout, the ones already allocated are freed.
+ *
+ * The chain is freed with a single call to net_buf_unref() on its first
+ * buffer.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param count Number of buffers to allocate, at least one.
+ * @param timeout Affects the action taken should the pool be empty, for
+ *        the whole allocation, as with net_buf_alloc_len().
+ *
+ * @return First buffer of the chain or NULL if out of buffers.
+ */
+#if defined(CONFIG_NET_BUF_LOG)
+struct net_buf * __must_check net_buf_alloc_bulk_debug(struct net_buf_pool *pool,
+						       size_t size, size_t count,
+						       k_timeout_t timeout,
+						       const char *func,
+						       int line);
+#define net_buf_alloc_bulk(_pool, _size, _count, _timeout) \
+	net_buf_alloc_bulk_debug(_pool, _size, _count, _timeout, __func__, \
+				 __LINE__)
+#else
+struct net_buf * __must_check net_buf_alloc_bulk(struct net_buf_pool *pool,
+						 size_t size, size_t count,
+						 k_timeout_t timeout);
+#endif
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -1485,7 +1521,9 @@ struct net_buf * __must_check net_buf_slist_get(sys_slist_t *list);
 /**
  * @brief Decrements the reference count of a buffer.
  *
- * The buffer is put back into the pool if the reference count reaches zero.
+ * The buffer is put back into the pool if the reference count reaches zero,
+ * and so are its fragments, in turn. Consecutive fragments from the same pool
+ * without a destroy callback are put back into it as a single list.
  *
  * @param buf A valid pointer on a buffer
  */
@@ -2627,6 +2665,63 @@ size_t net_buf_append_bytes(struct net_buf *buf, size_t len,
  */
 size_t net_buf_data_match(const struct net_buf *buf, size_t offset, const void *data, size_t len);
 
+/**
+ * @brief Scatter-gather entry of a buffer chain.
+ */
+struct net_buf_iov {
+	/** Start of the data of the entry. */
+	void *base;
+	/** Number of bytes of the entry. */
+	size_t len;
+};
+
+/**
+ * @brief Export the data of a buffer chain as a scatter-gather list.
+ *
+ * @details Describe @a len bytes of the @a buf chain, starting from @a offset in
+ * it, with one entry per fragment holding some of these bytes, so that drivers
+ * can hand the data of the chain to a DMA controller or a bus without copying it
+ * in a linear buffer. The entries point to the fragments, which must not be
+ * modified or freed until the transfer has completed.
+ *
+ * When the data is written by DMA, the entries must be flushed from the data
+ * cache with net_buf_iov_cache_flush() before the transfer is started.
+ *
+ * @param buf Network buffer chain
+ * @param offset Starting offset of the data in the chain
+ * @param len Number of bytes to export
+ * @param iov Scatter-gather entries to fill
+ * @param iov_count Number of entries of @a iov
+ *
+ * @retval Number of entries used, 0 if @a len is 0.
+ * @retval -ENOBUFS if the data does not fit in @a iov_count entries.
+ * @retval -EINVAL if the chain does not hold @a offset + @a len bytes.
+ */
+int net_buf_iov_export(const struct net_buf *buf, size_t offset, size_t len,
+		       struct net_buf_iov *iov, size_t iov_count);
+
+/**
+ * @brief Flush the data of scatter-gather entries from the data cache.
+ *
+ * @details Write back the data described by the entries to memory, before a
+ * DMA controller reads it. This does nothing if there is no data cache.
+ *
+ * @param iov Scatter-gather entries
+ * @param iov_count Number of entries
+ */
+void net_buf_iov_cache_flush(const struct net_buf_iov *iov, size_t iov_count);
+
+/**
+ * @brief Invalidate the data of scatter-gather entries in the data cache.
+ *
+ * @details Discard the cached data of the entries, after a DMA controller wrote
+ * to their memory. This does nothing if there is no data cache.
+ *
+ * @param iov Scatter-gather entries
+ * @param iov_count Number of entries
+ */
+void net_buf_iov_cache_invd(const struct net_buf_iov *iov, size_t iov_count);
+
 /**
  * @brief Skip N number of bytes in a net_buf
  *
@@ -173,6 +173,8 @@ struct pm_device {
 #if defined(CONFIG_PM_DEVICE_RUNTIME_ASYNC) || defined(__DOXYGEN__)
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
+	/** Delay applied to pm_device_runtime_put(), in milliseconds */
+	uint32_t suspend_delay_ms;
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 };
@@ -207,6 +209,15 @@ BUILD_ASSERT(offsetof(struct pm_device_isr, base) == 0);
 #define Z_PM_DEVICE_RUNTIME_INIT(obj)
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+#define Z_PM_DEVICE_RUNTIME_DELAY_INIT(node_id)				\
+	.suspend_delay_ms = COND_CODE_1(DT_NODE_EXISTS(node_id),	\
+		(DT_PROP_OR(node_id, zephyr_pm_device_runtime_suspend_delay_ms, 0)), \
+		(0)),
+#else
+#define Z_PM_DEVICE_RUNTIME_DELAY_INIT(node_id)
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+
 #ifdef CONFIG_PM_DEVICE_POWER_DOMAIN
 #define	Z_PM_DEVICE_POWER_DOMAIN_INIT(_node_id)			\
 	.domain = DEVICE_DT_GET_OR_NULL(DT_PHANDLE(_node_id,	\
@@ -264,7 +275,9 @@ BUILD_ASSERT(offsetof(struct pm_device_isr, base) == 0);
 	{									\
 		.base = Z_PM_DEVICE_BASE_INIT(obj, node_id, pm_action_cb,	\
 				isr_safe ? BIT(PM_DEVICE_FLAG_ISR_SAFE) : 0),	\
-		COND_CODE_1(isr_safe, (), (Z_PM_DEVICE_RUNTIME_INIT(obj)))	\
+		COND_CODE_1(isr_safe, (),					\
+			    (Z_PM_DEVICE_RUNTIME_INIT(obj)			\
+			     Z_PM_DEVICE_RUNTIME_DELAY_INIT(node_id)))		\
 	}
 
 /**
@@ -104,6 +104,10 @@ int pm_device_runtime_get(const struct device *dev);
  * state will be left unchanged. In all other cases, usage count will be
  * decremented (down to 0).
  *
+ * @note If the device has a non-zero @c zephyr,pm-device-runtime-suspend-delay-ms
+ * devicetree property and @kconfig{CONFIG_PM_DEVICE_RUNTIME_ASYNC} is enabled,
+ * the suspend is deferred by that delay, as with pm_device_runtime_put_async().
+ *
  * @funcprops \pre_kernel_ok
  *
  * @param dev Device instance.
@@ -88,6 +88,29 @@ struct pm_policy_event {
  */
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks);
 
+/**
+ * @brief Function to record the time spent in a PM state
+ *
+ * This function is called by the power subsystem after waking up, with the
+ * time the CPU actually spent in the state returned by pm_policy_next_state().
+ * Used by the predictive policy.
+ *
+ * @param cpu CPU index.
+ * @param idle_us Time spent in the state, in microseconds.
+ */
+void pm_policy_idle_exit(uint8_t cpu, uint32_t idle_us);
+
+/**
+ * @brief Function to get the predicted number of ticks until the next wake up
+ *
+ * @param cpu CPU index.
+ * @param ticks The number of ticks to the next scheduled event.
+ *
+ * @return The typical duration of the recent idle periods of the CPU, or
+ * @p ticks if it is shorter or if there is no reliable prediction.
+ */
+int32_t pm_policy_predicted_ticks(uint8_t cpu, int32_t ticks);
+
 /** @endcond */
 
 /** Special value for 'all substates'. */
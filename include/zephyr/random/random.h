@@ -59,10 +59,16 @@ __syscall void sys_rand_get(void *dst, size_t len);
  * @note If the random values requested do not need to be cryptographically
  * secure then use sys_rand_get() instead.
  *
+ * @note With the CTR-DRBG generator, calls from interrupt context never block:
+ * they are served from the entropy pool set by
+ * @kconfig{CONFIG_CS_CTR_DRBG_ENTROPY_POOL_SIZE}, and fail with -EAGAIN if it
+ * does not hold enough entropy.
+ *
  * @param [out] dst destination buffer to fill.
  * @param len size of the destination buffer.
  *
- * @return 0 if success, -EIO if entropy reseed error
+ * @return 0 if success, -EIO if entropy reseed error, -EAGAIN if not enough
+ * entropy is available in interrupt context
  *
  */
 __syscall int sys_csrand_get(void *dst, size_t len);
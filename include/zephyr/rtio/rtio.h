@@ -371,6 +371,13 @@ struct rtio_sqe {
 			rtio_signaled_t callback;
 			void *userdata;
 		} await;
+
+		/** OP_CRYPTO_AEAD */
+		struct {
+			/* struct cipher_aead_pkt *pkt; */
+			void *pkt; /**< AEAD packet to encrypt or decrypt */
+			uint8_t *nonce; /**< Nonce of the operation */
+		} crypto_aead;
 	};
 };
 
@@ -395,6 +402,10 @@ struct rtio_sqe_pool {
 	const uint16_t pool_size;
 	uint16_t pool_free;
 	struct rtio_iodev_sqe *pool;
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	/* Bitmap of the entries in use, replacing free_q and pool_free */
+	atomic_t *used;
+#endif
 };
 
 struct rtio_cqe_pool {
@@ -402,8 +413,75 @@ struct rtio_cqe_pool {
 	const uint16_t pool_size;
 	uint16_t pool_free;
 	struct rtio_cqe *pool;
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	/* Bitmap of the entries in use, replacing free_q and pool_free */
+	atomic_t *used;
+#endif
+};
+
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+/**
+ * @brief Buffer lending statistics of an iodev reading to a mempool
+ */
+struct rtio_mempool_iodev_stats {
+	/** The iodev, NULL for an unused entry */
+	const struct rtio_iodev *iodev;
+	/** Number of blocks lent to completions of the iodev, not released yet */
+	uint32_t blocks;
+	/** Highest number of blocks lent at once */
+	uint32_t blocks_max;
+	/** Number of buffers lent */
+	uint32_t lent;
+};
+
+/**
+ * @brief Buffer lending statistics of an RTIO context mempool
+ *
+ * Buffers are lent when an iodev takes them from the pool for a read, and
+ * returned with rtio_release_buffer(). The latency is measured from the
+ * completion of the read to the release of its buffer.
+ */
+struct rtio_mempool_stats {
+	/** Number of blocks lent, not released yet */
+	uint32_t blocks;
+	/** Highest number of blocks lent at once */
+	uint32_t blocks_max;
+	/** Number of reads for which no buffer was available */
+	uint32_t alloc_failures;
+	/** Number of buffers released after their completion */
+	uint32_t released;
+	/** Longest time from a completion to the release of its buffer */
+	uint32_t release_latency_max_us;
+	/** Total time from completions to the release of their buffers */
+	uint64_t release_latency_total_us;
+	/** Blocks lent to iodevs that found no free entry in iodevs */
+	uint32_t untracked_blocks;
+	/** Statistics of the iodevs, in order of their first read */
+	struct rtio_mempool_iodev_stats iodevs[CONFIG_RTIO_MEMPOOL_STATS_IODEVS];
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Owner of a buffer lent by a mempool, kept for its first block */
+struct rtio_mempool_lend {
+	const struct rtio_iodev *iodev;
+	uint32_t cqe_cycles;
+	bool completed;
+};
+
+struct rtio_mempool_acct {
+	struct k_spinlock lock;
+	struct rtio_mempool_stats stats;
+	struct rtio_mempool_lend *lends;
 };
 
+/**
+ * @endcond
+ */
+#endif /* CONFIG_RTIO_MEMPOOL_STATS */
+
 /**
  * @brief An RTIO context containing what can be viewed as a pair of queues.
  *
@@ -450,6 +528,15 @@ struct rtio {
 #ifdef CONFIG_RTIO_SYS_MEM_BLOCKS
 	/* Mem block pool */
 	struct sys_mem_blocks *block_pool;
+
+	/* Blocks are allocated in order from a ring, starting at block_pool_head */
+	bool block_pool_ring;
+	atomic_t block_pool_head;
+#endif
+
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+	/* Lending statistics of the mem block pool */
+	struct rtio_mempool_acct *block_pool_acct;
 #endif
 
 	/* Submission queue */
@@ -457,6 +544,16 @@ struct rtio {
 
 	/* Completion queue */
 	struct mpsc cq;
+
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	/* Number of executor runs requested, the first one draining the
+	 * submission queue for the others
+	 */
+	atomic_t sq_drain;
+
+	/* Order of the submission queue entry acquisitions */
+	atomic_t sqe_seq;
+#endif
 };
 
 /** The memory partition associated with all RTIO context information */
@@ -516,6 +613,12 @@ struct rtio_iodev_sqe {
 	struct mpsc_node q;
 	struct rtio_iodev_sqe *next;
 	struct rtio *r;
+#if defined(CONFIG_RTIO_MULTI_PRODUCER) || defined(__DOXYGEN__)
+	/** Producer having acquired the entry, 0 once submitted */
+	uintptr_t owner;
+	/** Acquisition order of the entry */
+	uint32_t seq;
+#endif
 };
 
 /**
@@ -583,6 +686,12 @@ struct rtio_iodev {
 /** An operation to suspend bus while awaiting signal */
 #define RTIO_OP_AWAIT (RTIO_OP_I3C_CCC+1)
 
+/** An operation to write the cached data of a file to its storage */
+#define RTIO_OP_FS_SYNC (RTIO_OP_AWAIT+1)
+
+/** An operation to encrypt or decrypt an AEAD packet of a cipher session */
+#define RTIO_OP_CRYPTO_AEAD (RTIO_OP_FS_SYNC+1)
+
 /**
  * @brief Prepare a nop (no op) submission
  */
@@ -769,8 +878,51 @@ static inline void rtio_sqe_prep_delay(struct rtio_sqe *sqe,
 	sqe->userdata = userdata;
 }
 
+#if defined(CONFIG_RTIO_MULTI_PRODUCER) || defined(__DOXYGEN__)
+/**
+ * @brief Allocate an entry of a pool bitmap
+ *
+ * Lock free, and safe to call from several threads and CPUs at once.
+ *
+ * @param used Bitmap of the entries in use
+ * @param size Number of entries
+ *
+ * @retval index Index of the allocated entry
+ * @retval -ENOMEM No entry available
+ */
+static inline int rtio_pool_bitmap_alloc(atomic_t *used, uint16_t size)
+{
+	for (int i = 0; i < size; i++) {
+		if (!atomic_test_bit(used, i) && !atomic_test_and_set_bit(used, i)) {
+			return i;
+		}
+	}
+
+	return -ENOMEM;
+}
+
+/**
+ * @brief Identify the producer of submissions running on the current CPU
+ *
+ * Threads are identified by their thread, interrupts by their CPU.
+ */
+static inline uintptr_t rtio_producer_id(void)
+{
+	if (k_is_in_isr()) {
+		return (uintptr_t)arch_proc_id() + 1U;
+	}
+
+	return (uintptr_t)k_current_get();
+}
+#endif /* CONFIG_RTIO_MULTI_PRODUCER */
+
 static inline struct rtio_iodev_sqe *rtio_sqe_pool_alloc(struct rtio_sqe_pool *pool)
 {
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	int idx = rtio_pool_bitmap_alloc(pool->used, pool->pool_size);
+
+	return (idx < 0) ? NULL : &pool->pool[idx];
+#else
 	struct mpsc_node *node = mpsc_pop(&pool->free_q);
 
 	if (node == NULL) {
@@ -782,17 +934,36 @@ static inline struct rtio_iodev_sqe *rtio_sqe_pool_alloc(struct rtio_sqe_pool *p
 	pool->pool_free--;
 
 	return iodev_sqe;
+#endif
 }
 
 static inline void rtio_sqe_pool_free(struct rtio_sqe_pool *pool, struct rtio_iodev_sqe *iodev_sqe)
 {
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	iodev_sqe->owner = 0U;
+	atomic_clear_bit(pool->used, iodev_sqe - pool->pool);
+#else
 	mpsc_push(&pool->free_q, &iodev_sqe->q);
 
 	pool->pool_free++;
+#endif
 }
 
 static inline struct rtio_cqe *rtio_cqe_pool_alloc(struct rtio_cqe_pool *pool)
 {
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	int idx = rtio_pool_bitmap_alloc(pool->used, pool->pool_size);
+
+	if (idx < 0) {
+		return NULL;
+	}
+
+	struct rtio_cqe *cqe = &pool->pool[idx];
+
+	memset(cqe, 0, sizeof(struct rtio_cqe));
+
+	return cqe;
+#else
 	struct mpsc_node *node = mpsc_pop(&pool->free_q);
 
 	if (node == NULL) {
@@ -806,15 +977,59 @@ static inline struct rtio_cqe *rtio_cqe_pool_alloc(struct rtio_cqe_pool *pool)
 	pool->pool_free--;
 
 	return cqe;
+#endif
 }
 
 static inline void rtio_cqe_pool_free(struct rtio_cqe_pool *pool, struct rtio_cqe *cqe)
 {
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	atomic_clear_bit(pool->used, cqe - pool->pool);
+#else
 	mpsc_push(&pool->free_q, &cqe->q);
 
 	pool->pool_free++;
+#endif
 }
 
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+/* Accounting of the buffers lent by the mempool, see rtio_mempool_stats.c */
+void z_rtio_mempool_stats_lend(struct rtio *r, const struct rtio_iodev *iodev, void *buf,
+			       uint32_t buf_len);
+void z_rtio_mempool_stats_alloc_failed(struct rtio *r);
+void z_rtio_mempool_stats_complete(struct rtio *r, void *buf);
+void z_rtio_mempool_stats_release(struct rtio *r, void *buf, uint32_t buf_len);
+#endif /* CONFIG_RTIO_MEMPOOL_STATS */
+
+#ifdef CONFIG_RTIO_SYS_MEM_BLOCKS
+/* Take the blocks following the previous allocation, wrapping around at the end of the pool */
+static inline int rtio_block_pool_ring_alloc(struct rtio *r, size_t num_blks, void **buf)
+{
+	struct sys_mem_blocks *mem_pool = r->block_pool;
+	size_t head = (size_t)atomic_get(&r->block_pool_head);
+	uint8_t *blk;
+	int rc;
+
+	if (num_blks > mem_pool->info.num_blocks) {
+		return -ENOMEM;
+	}
+
+	if (head + num_blks > mem_pool->info.num_blocks) {
+		head = 0;
+	}
+
+	blk = mem_pool->buffer + (head << mem_pool->info.blk_sz_shift);
+	rc = sys_mem_blocks_get(mem_pool, blk, num_blks);
+	if (rc != 0) {
+		return rc;
+	}
+
+	atomic_set(&r->block_pool_head, (atomic_val_t)((head + num_blks) % mem_pool->info.num_blocks));
+	*buf = blk;
+
+	return 0;
+}
+#endif /* CONFIG_RTIO_SYS_MEM_BLOCKS */
+
 static inline int rtio_block_pool_alloc(struct rtio *r, size_t min_sz,
 					  size_t max_sz, uint8_t **buf, uint32_t *buf_len)
 {
@@ -838,7 +1053,13 @@ static inline int rtio_block_pool_alloc(struct rtio *r, size_t min_sz,
 
 	do {
 		size_t num_blks = DIV_ROUND_UP(bytes, block_size);
-		int rc = sys_mem_blocks_alloc_contiguous(r->block_pool, num_blks, (void **)buf);
+		int rc;
+
+		if (r->block_pool_ring) {
+			rc = rtio_block_pool_ring_alloc(r, num_blks, (void **)buf);
+		} else {
+			rc = sys_mem_blocks_alloc_contiguous(r->block_pool, num_blks, (void **)buf);
+		}
 
 		if (rc == 0) {
 			*buf_len = num_blks * block_size;
@@ -887,21 +1108,29 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 
 #define Z_RTIO_SQE_POOL_DEFINE(name, sz)			\
 	static struct rtio_iodev_sqe CONCAT(_sqe_pool_, name)[sz];	\
+	IF_ENABLED(CONFIG_RTIO_MULTI_PRODUCER,			\
+		   (static ATOMIC_DEFINE(CONCAT(_sqe_pool_used_, name), sz);)) \
 	STRUCT_SECTION_ITERABLE(rtio_sqe_pool, name) = {	\
 		.free_q = MPSC_INIT((name.free_q)),	\
 		.pool_size = sz,				\
 		.pool_free = sz,				\
 		.pool = CONCAT(_sqe_pool_, name),		\
+		IF_ENABLED(CONFIG_RTIO_MULTI_PRODUCER,		\
+			   (.used = CONCAT(_sqe_pool_used_, name),)) \
 	}
 
 
 #define Z_RTIO_CQE_POOL_DEFINE(name, sz)			\
 	static struct rtio_cqe CONCAT(_cqe_pool_, name)[sz];	\
+	IF_ENABLED(CONFIG_RTIO_MULTI_PRODUCER,			\
+		   (static ATOMIC_DEFINE(CONCAT(_cqe_pool_used_, name), sz);)) \
 	STRUCT_SECTION_ITERABLE(rtio_cqe_pool, name) = {	\
 		.free_q = MPSC_INIT((name.free_q)),	\
 		.pool_size = sz,				\
 		.pool_free = sz,				\
 		.pool = CONCAT(_cqe_pool_, name),		\
+		IF_ENABLED(CONFIG_RTIO_MULTI_PRODUCER,		\
+			   (.used = CONCAT(_cqe_pool_used_, name),)) \
 	}
 
 /**
@@ -927,12 +1156,17 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 #define RTIO_DMEM COND_CODE_1(CONFIG_USERSPACE, (K_APP_DMEM(rtio_partition) static), (static))
 
 #define Z_RTIO_BLOCK_POOL_DEFINE(name, blk_sz, blk_cnt, blk_align)                                 \
+	IF_ENABLED(CONFIG_RTIO_MEMPOOL_STATS,                                                      \
+		   (static struct rtio_mempool_lend CONCAT(_block_pool_lends_, name)[blk_cnt];     \
+		    static struct rtio_mempool_acct CONCAT(_block_pool_acct_, name) = {            \
+			    .lends = CONCAT(_block_pool_lends_, name),                             \
+		    };))                                                                           \
 	RTIO_BMEM uint8_t __aligned(WB_UP(blk_align))                                              \
 	CONCAT(_block_pool_, name)[blk_cnt*WB_UP(blk_sz)];                                         \
 	_SYS_MEM_BLOCKS_DEFINE_WITH_EXT_BUF(name, WB_UP(blk_sz), blk_cnt,                          \
 					    CONCAT(_block_pool_, name),	RTIO_DMEM)
 
-#define Z_RTIO_DEFINE(name, _sqe_pool, _cqe_pool, _block_pool)                                     \
+#define Z_RTIO_DEFINE(name, _sqe_pool, _cqe_pool, _block_pool, _block_pool_acct, _ring)            \
 	IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM,                                                         \
 		   (static K_SEM_DEFINE(CONCAT(_submit_sem_, name), 0, K_SEM_MAX_LIMIT)))          \
 	IF_ENABLED(CONFIG_RTIO_CONSUME_SEM,                                                        \
@@ -946,6 +1180,8 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 		.sqe_pool = _sqe_pool,                                                             \
 		.cqe_pool = _cqe_pool,                                                             \
 		IF_ENABLED(CONFIG_RTIO_SYS_MEM_BLOCKS, (.block_pool = _block_pool,))               \
+		IF_ENABLED(CONFIG_RTIO_SYS_MEM_BLOCKS, (.block_pool_ring = _ring,))                \
+		IF_ENABLED(CONFIG_RTIO_MEMPOOL_STATS, (.block_pool_acct = _block_pool_acct,))      \
 		.sq = MPSC_INIT((name.sq)),                                                        \
 		.cq = MPSC_INIT((name.cq)),                                                        \
 	}
@@ -961,7 +1197,7 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 	Z_RTIO_SQE_POOL_DEFINE(CONCAT(name, _sqe_pool), sq_sz);			\
 	Z_RTIO_CQE_POOL_DEFINE(CONCAT(name, _cqe_pool), cq_sz);			\
 	Z_RTIO_DEFINE(name, &CONCAT(name, _sqe_pool),				\
-		      &CONCAT(name, _cqe_pool), NULL)
+		      &CONCAT(name, _cqe_pool), NULL, NULL, false)
 
 /* clang-format on */
 
@@ -979,7 +1215,33 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 	Z_RTIO_SQE_POOL_DEFINE(name##_sqe_pool, sq_sz);		\
 	Z_RTIO_CQE_POOL_DEFINE(name##_cqe_pool, cq_sz);			\
 	Z_RTIO_BLOCK_POOL_DEFINE(name##_block_pool, blk_size, num_blks, balign); \
-	Z_RTIO_DEFINE(name, &name##_sqe_pool, &name##_cqe_pool, &name##_block_pool)
+	Z_RTIO_DEFINE(name, &name##_sqe_pool, &name##_cqe_pool, &name##_block_pool, \
+		      &_block_pool_acct_##name##_block_pool, false)
+
+/**
+ * @brief Statically define and initialize an RTIO context with a ring memory pool
+ *
+ * Same as RTIO_DEFINE_WITH_MEMPOOL(), but the buffers of reads are taken in
+ * order, each one following the previous one and wrapping around at the end
+ * of the pool, rather than from the first free blocks. When buffers are
+ * released in the order their reads completed, as when streaming from a FIFO,
+ * the pool does not fragment, and the data of consecutive reads stays
+ * contiguous. A read fails to get a buffer when the blocks following the
+ * previous buffer are still in use, even if other blocks are free.
+ *
+ * @param name Name of the RTIO
+ * @param sq_sz Size of the submission queue, must be power of 2
+ * @param cq_sz Size of the completion queue, must be power of 2
+ * @param num_blks Number of blocks in the memory pool
+ * @param blk_size The number of bytes in each block
+ * @param balign The block alignment
+ */
+#define RTIO_DEFINE_WITH_RING_MEMPOOL(name, sq_sz, cq_sz, num_blks, blk_size, balign) \
+	Z_RTIO_SQE_POOL_DEFINE(name##_sqe_pool, sq_sz);		\
+	Z_RTIO_CQE_POOL_DEFINE(name##_cqe_pool, cq_sz);			\
+	Z_RTIO_BLOCK_POOL_DEFINE(name##_block_pool, blk_size, num_blks, balign); \
+	Z_RTIO_DEFINE(name, &name##_sqe_pool, &name##_cqe_pool, &name##_block_pool, \
+		      &_block_pool_acct_##name##_block_pool, true)
 
 /* clang-format on */
 
@@ -992,7 +1254,19 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
  */
 static inline uint32_t rtio_sqe_acquirable(struct rtio *r)
 {
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	uint32_t acquirable = 0;
+
+	for (int i = 0; i < r->sqe_pool->pool_size; i++) {
+		if (!atomic_test_bit(r->sqe_pool->used, i)) {
+			acquirable++;
+		}
+	}
+
+	return acquirable;
+#else
 	return r->sqe_pool->pool_free;
+#endif
 }
 
 /**
@@ -1059,7 +1333,13 @@ static inline struct rtio_sqe *rtio_sqe_acquire(struct rtio *r)
 		return NULL;
 	}
 
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	/* Kept by the producer until it submits, see rtio_executor_publish() */
+	iodev_sqe->seq = (uint32_t)atomic_inc(&r->sqe_seq);
+	iodev_sqe->owner = rtio_producer_id();
+#else
 	mpsc_push(&r->sq, &iodev_sqe->q);
+#endif
 
 	return &iodev_sqe->sqe;
 }
@@ -1071,6 +1351,18 @@ static inline struct rtio_sqe *rtio_sqe_acquire(struct rtio *r)
  */
 static inline void rtio_sqe_drop_all(struct rtio *r)
 {
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	uintptr_t owner = rtio_producer_id();
+
+	/* Only drop the entries acquired by the caller */
+	for (int i = 0; i < r->sqe_pool->pool_size; i++) {
+		struct rtio_iodev_sqe *iodev_sqe = &r->sqe_pool->pool[i];
+
+		if (atomic_test_bit(r->sqe_pool->used, i) && (iodev_sqe->owner == owner)) {
+			rtio_sqe_pool_free(r->sqe_pool, iodev_sqe);
+		}
+	}
+#else
 	struct rtio_iodev_sqe *iodev_sqe;
 	struct mpsc_node *node = mpsc_pop(&r->sq);
 
@@ -1079,6 +1371,7 @@ static inline void rtio_sqe_drop_all(struct rtio *r)
 		rtio_sqe_pool_free(r->sqe_pool, iodev_sqe);
 		node = mpsc_pop(&r->sq);
 	}
+#endif
 }
 
 /**
@@ -1258,6 +1551,9 @@ static inline int z_impl_rtio_cqe_get_mempool_buffer(const struct rtio *r, struc
 }
 
 void rtio_executor_submit(struct rtio *r);
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+void rtio_executor_publish(struct rtio *r);
+#endif
 void rtio_executor_ok(struct rtio_iodev_sqe *iodev_sqe, int result);
 void rtio_executor_err(struct rtio_iodev_sqe *iodev_sqe, int result);
 
@@ -1370,9 +1666,15 @@ static inline int rtio_sqe_rx_buf(const struct rtio_iodev_sqe *iodev_sqe, uint32
 		if (rc == 0) {
 			sqe->rx.buf = *buf;
 			sqe->rx.buf_len = *buf_len;
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+			z_rtio_mempool_stats_lend(r, sqe->iodev, *buf, *buf_len);
+#endif
 			return 0;
 		}
 
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+		z_rtio_mempool_stats_alloc_failed(r);
+#endif
 		return -ENOMEM;
 	}
 #else
@@ -1411,6 +1713,9 @@ static inline void z_impl_rtio_release_buffer(struct rtio *r, void *buff, uint32
 		return;
 	}
 
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+	z_rtio_mempool_stats_release(r, buff, buff_len);
+#endif
 	rtio_block_pool_free(r, buff, buff_len);
 #else
 	ARG_UNUSED(r);
@@ -1419,6 +1724,29 @@ static inline void z_impl_rtio_release_buffer(struct rtio *r, void *buff, uint32
 #endif
 }
 
+#if defined(CONFIG_RTIO_MEMPOOL_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the buffer lending statistics of the memory pool of an RTIO context
+ *
+ * @param r RTIO context
+ * @param stats Filled with the statistics
+ *
+ * @retval 0 On success
+ * @retval -EINVAL If the context has no memory pool
+ */
+int rtio_mempool_stats_get(struct rtio *r, struct rtio_mempool_stats *stats);
+
+/**
+ * @brief Reset the buffer lending statistics of the memory pool of an RTIO context
+ *
+ * The counters and latencies are cleared. The blocks still lent stay accounted,
+ * and become the high-water marks.
+ *
+ * @param r RTIO context
+ */
+void rtio_mempool_stats_reset(struct rtio *r);
+#endif /* CONFIG_RTIO_MEMPOOL_STATS */
+
 /**
  * Grant access to an RTIO context to a user thread
  */
@@ -1534,6 +1862,13 @@ static inline int z_impl_rtio_sqe_copy_in_get_handles(struct rtio *r, const stru
 
 	for (unsigned long i = 0; i < sqe_count; i++) {
 		sqe = rtio_sqe_acquire(r);
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+		/* Another producer may have acquired entries since the check */
+		if (sqe == NULL) {
+			rtio_sqe_drop_all(r);
+			return -ENOMEM;
+		}
+#endif
 		__ASSERT_NO_MSG(sqe != NULL);
 		if (handle != NULL && i == 0) {
 			*handle = sqe;
@@ -1617,6 +1952,11 @@ static inline int z_impl_rtio_cqe_copy_out(struct rtio *r,
  *
  * @warning It is undefined behavior to have re-entrant calls to submit
  *
+ * With @kconfig{CONFIG_RTIO_MULTI_PRODUCER}, only the submission queue events
+ * acquired by the calling thread, or interrupt, are submitted, and several
+ * threads may submit to the same context at once. The completions waited for
+ * are then any completions of the context.
+ *
  * @param r RTIO context
  * @param wait_count Number of submissions to wait for completion of.
  *
@@ -1637,6 +1977,9 @@ static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 		r->submit_count = wait_count;
 	}
 
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	rtio_executor_publish(r);
+#endif
 	rtio_executor_submit(r);
 
 	if (wait_count > 0) {
@@ -1656,6 +1999,9 @@ static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 	uintptr_t cq_complete_count = cq_count + wait_count;
 	bool wraps = cq_complete_count < cq_count;
 
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+	rtio_executor_publish(r);
+#endif
 	rtio_executor_submit(r);
 
 	if (wraps) {
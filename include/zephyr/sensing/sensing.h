@@ -124,6 +124,25 @@ typedef void (*sensing_data_event_t)(
 		const void *buf,
 		void *context);
 
+/**
+ * @brief Sensor data batch receive callback.
+ *
+ * Receives the samples batched for the latency of the connection, see
+ * @ref SENSING_SENSOR_ATTRIBUTE_LATENCY, in the order they were reported.
+ * The buffers are shared with the other clients of the sensor, and are only
+ * valid during the callback, unless held with sensing_data_hold().
+ *
+ * @param handle The sensor instance handle.
+ * @param bufs The data buffers with sensor data.
+ * @param count Number of data buffers.
+ * @param context User provided context pointer.
+ */
+typedef void (*sensing_data_batch_event_t)(
+		sensing_sensor_handle_t handle,
+		const void *const *bufs,
+		uint16_t count,
+		void *context);
+
 /**
  * @struct sensing_sensor_info
  * @brief Sensor basic constant information
@@ -157,6 +176,13 @@ struct sensing_sensor_info {
 struct sensing_callback_list {
 	sensing_data_event_t on_data_event; /**< Callback function for a sensor data event. */
 	void *context;                      /**< Associated context with on_data_event */
+#if defined(CONFIG_SENSING_BATCHING) || defined(__DOXYGEN__)
+	/**
+	 * Callback function for the batched sensor data events of a connection with a
+	 * latency. Without it, each sample is reported with on_data_event.
+	 */
+	sensing_data_batch_event_t on_data_batch_event;
+#endif
 };
 
 /**
@@ -282,6 +308,29 @@ int sensing_get_config(
 const struct sensing_sensor_info *sensing_get_sensor_info(
 		sensing_sensor_handle_t handle);
 
+#if defined(CONFIG_SENSING_BATCHING) || defined(__DOXYGEN__)
+/**
+ * @brief Hold a sensor data buffer received by a data event callback.
+ *
+ * Sensor data buffers are shared by all the clients of a sensor, without
+ * copies, for the duration of their data event callbacks. A client holding a
+ * buffer can keep reading it after its callback returned, until it calls
+ * sensing_data_release(). Buffers are held from the pool the sensing
+ * subsystem reads samples to, see CONFIG_SENSING_RTIO_BLOCK_COUNT.
+ *
+ * @param buf The data buffer received by the callback.
+ * @return 0 on success, -EINVAL if @p buf is not a sensor data buffer in use.
+ */
+int sensing_data_hold(const void *buf);
+
+/**
+ * @brief Release a sensor data buffer held with sensing_data_hold().
+ *
+ * @param buf The data buffer.
+ */
+void sensing_data_release(const void *buf);
+#endif /* CONFIG_SENSING_BATCHING */
+
 #ifdef __cplusplus
 }
 #endif
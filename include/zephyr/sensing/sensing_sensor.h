@@ -91,6 +91,16 @@ struct sensing_connection {
 	/** Next consume time of the connection. Unit is micro seconds. */
 	uint64_t next_consume_time;
 	struct sensing_callback_list *callback_list; /**< Callback list of the connection. */
+#if defined(CONFIG_SENSING_BATCHING) || defined(__DOXYGEN__)
+	/** Maximum duration of sample batching in micro seconds, 0 to not batch. */
+	uint64_t latency;
+	/** Time of the first sample of the current batch. Unit is micro seconds. */
+	uint64_t batch_start;
+	/** Number of samples of the current batch. */
+	uint16_t batch_count;
+	/** Samples of the current batch, held until their report. */
+	const void *batch[CONFIG_SENSING_BATCH_MAX_SAMPLES];
+#endif
 };
 
 /**
@@ -405,6 +405,22 @@ int settings_commit(void);
  */
 int settings_commit_subtree(const char *subtree);
 
+/**
+ * Write the settings snapshot.
+ *
+ * The snapshot is a compacted copy of all the settings, sorted by name, that
+ * settings_load() and settings_load_subtree() read instead of the backends as
+ * long as no setting is modified. Saving or deleting a setting invalidates
+ * it, after which it is written again automatically once
+ * @kconfig{CONFIG_SETTINGS_SNAPSHOT_DELAY_MS} have elapsed without any other
+ * modification, or by calling this function. Only available if
+ * @kconfig{CONFIG_SETTINGS_SNAPSHOT} is enabled.
+ *
+ * @return 0 on success, -ENOSPC if the settings do not fit in the snapshot
+ * partition, or another negative error code on failure.
+ */
+int settings_snapshot_save(void);
+
 /**
  * @} settings
  */
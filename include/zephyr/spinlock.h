@@ -35,6 +35,15 @@ struct z_spinlock_key {
 	int key;
 };
 
+#ifdef CONFIG_MCS_SPINLOCKS
+/* Queue node of a CPU waiting for or holding an MCS spinlock */
+struct z_spin_mcs_node {
+	atomic_ptr_t next;
+	atomic_t locked;
+	bool busy;
+};
+#endif /* CONFIG_MCS_SPINLOCKS */
+
 /**
  * @brief Kernel Spin Lock
  *
@@ -61,6 +70,16 @@ struct k_spinlock {
 	 */
 	atomic_t owner;
 	atomic_t tail;
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/*
+	 * MCS spinlocks queue the waiting CPUs in a linked list of per-CPU
+	 * nodes, the tail being the last CPU that tried to take the lock.
+	 * Each CPU spins on its own node, which the previous CPU clears when
+	 * releasing the lock, so the lock cache line is only written once
+	 * per acquisition instead of being contended by all waiters.
+	 */
+	atomic_ptr_t tail;
+	struct z_spin_mcs_node *holder;
 #else
 	atomic_t locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -76,6 +95,13 @@ struct k_spinlock {
 	 */
 	uint32_t lock_time;
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Number of times the lock was taken, and how many of these
+	 * found it held by another CPU
+	 */
+	uint32_t lock_count;
+	uint32_t contended_count;
+#endif /* CONFIG_SPIN_LOCK_STATS */
 #endif /* CONFIG_SPIN_VALIDATE */
 
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
@@ -114,8 +140,18 @@ BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 4, "Too many CPUs for mask");
 bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 # endif /* CONFIG_KERNEL_COHERENCE */
 
+# ifdef CONFIG_SPIN_LOCK_STATS
+void z_spin_lock_stats_update(struct k_spinlock *l, bool contended);
+# endif /* CONFIG_SPIN_LOCK_STATS */
+
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_MCS_SPINLOCKS
+bool z_spin_mcs_lock(struct k_spinlock *l);
+bool z_spin_mcs_trylock(struct k_spinlock *l);
+void z_spin_mcs_unlock(struct k_spinlock *l);
+#endif /* CONFIG_MCS_SPINLOCKS */
+
 /**
  * @brief Spinlock key type
  *
@@ -140,14 +176,18 @@ static ALWAYS_INLINE void z_spinlock_validate_pre(struct k_spinlock *l)
 #endif
 }
 
-static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
+static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l, bool contended)
 {
 	ARG_UNUSED(l);
+	ARG_UNUSED(contended);
 #ifdef CONFIG_SPIN_VALIDATE
 	z_spin_lock_set_owner(l);
 #if defined(CONFIG_SPIN_LOCK_TIME_LIMIT) && (CONFIG_SPIN_LOCK_TIME_LIMIT != 0)
 	l->lock_time = sys_clock_cycle_get_32();
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spin_lock_stats_update(l, contended);
+#endif /* CONFIG_SPIN_LOCK_STATS */
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
@@ -183,6 +223,7 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 {
 	ARG_UNUSED(l);
 	k_spinlock_key_t k;
+	bool contended = false;
 
 	/* Note that we need to use the underlying arch-specific lock
 	 * implementation.  The "irq_lock()" API in SMP context is
@@ -200,15 +241,19 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	atomic_val_t ticket = atomic_inc(&l->tail);
 	/* Spin until our ticket is served */
 	while (atomic_get(&l->owner) != ticket) {
+		contended = true;
 		arch_spin_relax();
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	contended = z_spin_mcs_lock(l);
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
+		contended = true;
 		arch_spin_relax();
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
-	z_spinlock_validate_post(l);
+	z_spinlock_validate_post(l, contended);
 
 	return k;
 }
@@ -257,13 +302,17 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 	if (!atomic_cas(&l->tail, ticket_val, ticket_val + 1)) {
 		goto busy;
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	if (!z_spin_mcs_trylock(l)) {
+		goto busy;
+	}
 #else
 	if (!atomic_cas(&l->locked, 0, 1)) {
 		goto busy;
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
-	z_spinlock_validate_post(l);
+	z_spinlock_validate_post(l, false);
 
 	k->key = key;
 
@@ -317,6 +366,9 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/* Give the spinlock to the next CPU in a FIFO */
 	(void)atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/* Give the spinlock to the next CPU in the queue, if any */
+	z_spin_mcs_unlock(l);
 #else
 	/* Strictly we don't need atomic_clear() here (which is an
 	 * exchange operation that returns the old value).  We are always
@@ -349,6 +401,8 @@ static ALWAYS_INLINE bool z_spin_is_locked(struct k_spinlock *l)
 	atomic_val_t ticket_val = atomic_get(&l->owner);
 
 	return !atomic_cas(&l->tail, ticket_val, ticket_val);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	return atomic_ptr_get(&l->tail) != NULL;
 #else
 	return l->locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -365,6 +419,8 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	(void)atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	z_spin_mcs_unlock(l);
 #else
 	(void)atomic_clear(&l->locked);
 #endif /* CONFIG_TICKET_SPINLOCKS */
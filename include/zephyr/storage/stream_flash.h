@@ -25,6 +25,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -74,6 +77,14 @@ struct stream_flash_ctx {
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	uint8_t *flash_buf; /* Buffer being written to flash, NULL if not double buffered */
+	size_t flash_buf_bytes; /* Number of bytes of flash_buf to write */
+	size_t bytes_queued; /* Number of bytes written or being written to flash */
+	struct k_work work; /* Work item writing flash_buf */
+	struct k_sem idle; /* Given when no write of flash_buf is in progress */
+	int work_rc; /* Result of the last write of flash_buf */
+#endif
 };
 
 /**
@@ -95,6 +106,34 @@ struct stream_flash_ctx {
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb);
+/**
+ * @brief Write to flash from a second buffer while the first one is filled.
+ *
+ * Once a write buffer is full, stream_flash_buffered_write() hands it over to
+ * the stream flash work queue, which writes it to flash and, when
+ * CONFIG_STREAM_FLASH_ERASE is enabled, erases ahead what the next buffer needs,
+ * and continues storing data in the other buffer. It only waits when the other
+ * buffer is full before its write is completed. A write with the flush set waits
+ * for all the buffered data to be written.
+ *
+ * A failed write from the work queue is reported by the following
+ * stream_flash_buffered_write() calls, until the context is re-initialized.
+ *
+ * Must be called after stream_flash_init(), and before writing data. The
+ * context must be flushed before it is re-initialized. It must not be used from
+ * contexts that cannot wait for a work queue, such as fatal error handlers.
+ *
+ * Available when CONFIG_STREAM_FLASH_DOUBLE_BUFFER is enabled.
+ *
+ * @param ctx context
+ * @param buf Second write buffer, of the length of the buffer given to
+ *            stream_flash_init()
+ *
+ * @return non-negative on success, -EALREADY if a second buffer is already set,
+ * negative errno code on fail
+ */
+int stream_flash_double_buffer_set(struct stream_flash_ctx *ctx, uint8_t *buf);
+
 /**
  * @brief Read number of bytes written to the flash.
  *
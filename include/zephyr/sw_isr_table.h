@@ -50,6 +50,42 @@ const
 #endif
 struct _isr_table_entry _sw_isr_table[];
 
+#if defined(CONFIG_ISR_STATS) || defined(__DOXYGEN__)
+/** @brief Duration statistics of an ISR table entry */
+struct isr_stats {
+	/** Number of calls */
+	uint32_t count;
+	/** Longest duration, in cycles */
+	uint32_t max_cycles;
+	/** Sum of the durations, in cycles */
+	uint64_t total_cycles;
+	/**
+	 * Histogram of the durations, bucket n counts the durations from
+	 * 2^(n-1) to 2^n - 1 cycles.
+	 */
+	uint32_t hist[CONFIG_ISR_STATS_HIST_BUCKETS];
+};
+
+/* Call the ISR table entry of an IRQ line and record its duration */
+void z_isr_stats_dispatch(unsigned int irq);
+
+/**
+ * @brief Get the duration statistics of an ISR table entry.
+ *
+ * @param irq   Index in the software ISR table.
+ * @param stats Statistics of the entry.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p irq is out of the table.
+ */
+int isr_stats_get(unsigned int irq, struct isr_stats *stats);
+
+/**
+ * @brief Reset the duration statistics of all ISR table entries.
+ */
+void isr_stats_reset(void);
+#endif /* CONFIG_ISR_STATS */
+
 struct _irq_parent_entry {
 	const struct device *dev;
 	unsigned int level;
@@ -0,0 +1,144 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_PRIO_QUEUE_H_
+#define ZEPHYR_INCLUDE_SYS_PRIO_QUEUE_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/min_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Priority queue
+ * @defgroup prio_queue_apis Priority queue
+ * @ingroup min_heap_apis
+ * @{
+ */
+
+/**
+ * @brief Bounded priority queue with blocking consumers.
+ *
+ * Elements are copied into a min-heap, so that both pushing an element and
+ * popping the smallest one cost O(log n) comparisons. Consumers can wait for
+ * an element to be pushed. Elements can be pushed from ISRs.
+ */
+struct sys_prio_queue {
+	/** Heap holding the queued elements */
+	struct min_heap heap;
+	/** Protects the heap */
+	struct k_spinlock lock;
+	/** Counts the queued elements, consumers wait on it */
+	struct k_sem count;
+};
+
+/**
+ * @brief Statically define and initialize a priority queue.
+ *
+ * @param name Name of the priority queue.
+ * @param cap Capacity (number of elements).
+ * @param elem_sz Size in bytes of each element.
+ * @param align Required alignment of each element.
+ * @param cmp_func Comparator function ordering the elements, see
+ *                 @ref min_heap_cmp_t.
+ */
+#define SYS_PRIO_QUEUE_DEFINE(name, cap, elem_sz, align, cmp_func)                                \
+	static uint8_t name##_storage[(cap) * (elem_sz)] __aligned(align);                         \
+	struct sys_prio_queue name = {                                                             \
+		.heap = {                                                                          \
+			.storage = name##_storage,                                                 \
+			.capacity = (cap),                                                         \
+			.elem_size = (elem_sz),                                                    \
+			.size = 0,                                                                 \
+			.cmp = (cmp_func),                                                         \
+		},                                                                                 \
+		.count = Z_SEM_INITIALIZER(name.count, 0, cap),                                    \
+	};                                                                                         \
+	BUILD_ASSERT((cap) > 0)
+
+/**
+ * @brief Initialize a priority queue at runtime.
+ *
+ * @param queue Pointer to the priority queue.
+ * @param storage Memory block for @p cap elements of @p elem_size bytes.
+ * @param cap Maximum number of queued elements.
+ * @param elem_size Size in bytes of each element.
+ * @param cmp Comparator function ordering the elements.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p cap is 0.
+ */
+int sys_prio_queue_init(struct sys_prio_queue *queue, void *storage, size_t cap,
+			size_t elem_size, min_heap_cmp_t cmp);
+
+/**
+ * @brief Push a copy of an element into a priority queue.
+ *
+ * A consumer waiting in sys_prio_queue_pop() is woken up.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Pointer to the priority queue.
+ * @param item Pointer to the element to copy into the queue.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if the queue is full.
+ */
+int sys_prio_queue_push(struct sys_prio_queue *queue, const void *item);
+
+/**
+ * @brief Pop the smallest element of a priority queue.
+ *
+ * @funcprops \isr_ok if @p timeout is K_NO_WAIT
+ *
+ * @param queue Pointer to the priority queue.
+ * @param out_buf Buffer where the element is copied.
+ * @param timeout Waiting period for an element to be pushed, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 on success.
+ * @retval -EBUSY if the queue is empty and @p timeout is K_NO_WAIT.
+ * @retval -EAGAIN if no element was pushed before the timeout.
+ */
+int sys_prio_queue_pop(struct sys_prio_queue *queue, void *out_buf, k_timeout_t timeout);
+
+/**
+ * @brief Copy the smallest element of a priority queue without removing it.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Pointer to the priority queue.
+ * @param out_buf Buffer where the element is copied.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if the queue is empty.
+ */
+int sys_prio_queue_peek(struct sys_prio_queue *queue, void *out_buf);
+
+/**
+ * @brief Get the number of elements in a priority queue.
+ *
+ * @param queue Pointer to the priority queue.
+ *
+ * @return Number of queued elements.
+ */
+static inline size_t sys_prio_queue_count(struct sys_prio_queue *queue)
+{
+	return k_sem_count_get(&queue->count);
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_PRIO_QUEUE_H_ */
@@ -85,6 +85,22 @@ struct rbnode {
  */
 typedef bool (*rb_lessthan_t)(struct rbnode *a, struct rbnode *b);
 
+/**
+ * @typedef rb_augment_t
+ * @brief Red/black tree augmentation callback
+ *
+ * Called whenever the subtree below a node changed, to recompute data
+ * the user keeps in the node's container about its whole subtree, e.g.
+ * the highest end of the intervals stored in that subtree, or its
+ * number of nodes. The data of the children, obtained with
+ * rb_get_left() and rb_get_right(), is already up to date. This makes
+ * it possible to implement e.g. interval trees or order statistics on
+ * top of the tree, by walking down from @ref rbtree.root.
+ *
+ * @kconfig_dep{CONFIG_RB_AUGMENT}
+ */
+typedef void (*rb_augment_t)(struct rbnode *node);
+
 /**
  * @brief Balanced red/black tree structure
  */
@@ -93,8 +109,15 @@ struct rbtree {
 	struct rbnode *root;
 	/** Comparison function for nodes in the tree */
 	rb_lessthan_t lessthan_fn;
+#if defined(CONFIG_RB_AUGMENT) || defined(__DOXYGEN__)
+	/** Optional augmentation callback, see @ref rb_augment_t */
+	rb_augment_t augment_fn;
+#endif
 	/** @cond INTERNAL_HIDDEN */
 	int max_depth;
+#ifdef CONFIG_RB_CACHE_MINMAX
+	struct rbnode *minmax[2];
+#endif
 #ifdef CONFIG_MISRA_SANE
 	struct rbnode *iter_stack[Z_MAX_RBTREE_DEPTH];
 	unsigned char iter_left[Z_MAX_RBTREE_DEPTH];
@@ -128,18 +151,54 @@ void rb_remove(struct rbtree *tree, struct rbnode *node);
 
 /**
  * @brief Returns the lowest-sorted member of the tree
+ *
+ * Constant time if @kconfig{CONFIG_RB_CACHE_MINMAX} is enabled,
+ * logarithmic otherwise.
  */
 static inline struct rbnode *rb_get_min(struct rbtree *tree)
 {
+#ifdef CONFIG_RB_CACHE_MINMAX
+	return tree->minmax[0];
+#else
 	return z_rb_get_minmax(tree, 0U);
+#endif
 }
 
 /**
  * @brief Returns the highest-sorted member of the tree
+ *
+ * Constant time if @kconfig{CONFIG_RB_CACHE_MINMAX} is enabled,
+ * logarithmic otherwise.
  */
 static inline struct rbnode *rb_get_max(struct rbtree *tree)
 {
+#ifdef CONFIG_RB_CACHE_MINMAX
+	return tree->minmax[1];
+#else
 	return z_rb_get_minmax(tree, 1U);
+#endif
+}
+
+/**
+ * @brief Returns the left child of a node, or NULL
+ *
+ * Intended to walk down the tree from the root, e.g. for searches
+ * using augmented data, see @ref rb_augment_t.
+ */
+static inline struct rbnode *rb_get_left(struct rbnode *node)
+{
+	return z_rb_child(node, 0U);
+}
+
+/**
+ * @brief Returns the right child of a node, or NULL
+ *
+ * Intended to walk down the tree from the root, e.g. for searches
+ * using augmented data, see @ref rb_augment_t.
+ */
+static inline struct rbnode *rb_get_right(struct rbnode *node)
+{
+	return z_rb_child(node, 1U);
 }
 
 /**
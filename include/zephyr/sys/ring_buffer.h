@@ -8,6 +8,7 @@
 #define ZEPHYR_INCLUDE_SYS_RING_BUFFER_H_
 
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/barrier.h>
 #include <errno.h>
 
 #ifdef __cplusplus
@@ -21,6 +22,11 @@ extern "C" {
  *
  * @brief Simple ring buffer implementation.
  *
+ * One producer and one consumer can access a ring buffer concurrently
+ * without locking, e.g. an interrupt handler and a thread. Enable
+ * @kconfig{CONFIG_RING_BUFFER_SPSC} when they can run on different CPUs,
+ * so that the index updates are ordered with the data accesses.
+ *
  * @{
  */
 
@@ -41,6 +47,15 @@ typedef uint16_t ring_buf_idx_t;
 
 struct ring_buf_index { ring_buf_idx_t head, tail, base; };
 
+/* The producer and consumer indices are written by different CPUs in SPSC
+ * mode, keep them in different cache lines.
+ */
+#ifdef CONFIG_RING_BUFFER_SPSC
+#define Z_RING_BUF_INDEX_ALIGN __aligned(CONFIG_RING_BUFFER_SPSC_ALIGN)
+#else
+#define Z_RING_BUF_INDEX_ALIGN
+#endif
+
 /** @endcond */
 
 /**
@@ -49,14 +64,44 @@ struct ring_buf_index { ring_buf_idx_t head, tail, base; };
 struct ring_buf {
 	/** @cond INTERNAL_HIDDEN */
 	uint8_t *buffer;
-	struct ring_buf_index put;
-	struct ring_buf_index get;
 	uint32_t size;
+	struct ring_buf_index put Z_RING_BUF_INDEX_ALIGN;
+	struct ring_buf_index get Z_RING_BUF_INDEX_ALIGN;
 	/** @endcond */
 };
 
 /** @cond INTERNAL_HIDDEN */
 
+/* Reads the tail index published by the other side of the buffer. In SPSC
+ * mode, the data it covers is only accessed after the index was read.
+ */
+static inline ring_buf_idx_t z_ring_buf_tail_load(const struct ring_buf_index *ring)
+{
+#ifdef CONFIG_RING_BUFFER_SPSC
+	ring_buf_idx_t tail = *(const volatile ring_buf_idx_t *)&ring->tail;
+
+	barrier_dmem_fence_full();
+
+	return tail;
+#else
+	return ring->tail;
+#endif
+}
+
+/* Publishes a new tail index to the other side of the buffer. In SPSC mode,
+ * the data it covers is fully accessed before the index is updated.
+ */
+static inline void z_ring_buf_tail_store(struct ring_buf_index *ring, ring_buf_idx_t tail)
+{
+#ifdef CONFIG_RING_BUFFER_SPSC
+	barrier_dmem_fence_full();
+
+	*(volatile ring_buf_idx_t *)&ring->tail = tail;
+#else
+	ring->tail = tail;
+#endif
+}
+
 uint32_t ring_buf_area_claim(struct ring_buf *buf, struct ring_buf_index *ring,
 			     uint8_t **data, uint32_t size);
 int ring_buf_area_finish(struct ring_buf *buf, struct ring_buf_index *ring,
@@ -211,7 +256,7 @@ static inline void ring_buf_item_init(struct ring_buf *buf,
  */
 static inline bool ring_buf_is_empty(const struct ring_buf *buf)
 {
-	return buf->get.head == buf->put.tail;
+	return buf->get.head == z_ring_buf_tail_load(&buf->put);
 }
 
 /**
@@ -233,7 +278,7 @@ static inline void ring_buf_reset(struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_space_get(const struct ring_buf *buf)
 {
-	ring_buf_idx_t allocated = buf->put.head - buf->get.tail;
+	ring_buf_idx_t allocated = buf->put.head - z_ring_buf_tail_load(&buf->get);
 
 	return buf->size - allocated;
 }
@@ -271,7 +316,7 @@ static inline uint32_t ring_buf_capacity_get(const struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_size_get(const struct ring_buf *buf)
 {
-	ring_buf_idx_t available = buf->put.tail - buf->get.head;
+	ring_buf_idx_t available = z_ring_buf_tail_load(&buf->put) - buf->get.head;
 
 	return available;
 }
@@ -0,0 +1,68 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/syscall_list.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch Batched system calls
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/** Record of a system call made with k_syscall_batch(). */
+struct k_syscall_batch_rec {
+	/** System call identifier, e.g. K_SYSCALL_K_SEM_GIVE. */
+	uintptr_t id;
+	/** Marshalled arguments of the system call. */
+	uintptr_t args[6];
+	/** Return value of the system call, set by k_syscall_batch(). */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Make several system calls with a single trap
+ *
+ * Run the system calls described by @p recs in order, from the same trap
+ * into the kernel, and set the return value of each record. Each system
+ * call is verified exactly as if it had been made on its own, and a
+ * verification failure kills the calling thread.
+ *
+ * The arguments of a record are the words the system call handler receives,
+ * i.e. marshalled as the generated wrapper of the system call does: 64-bit
+ * arguments are split in two words, and 64-bit return values are written to
+ * the address passed as the last word.
+ *
+ * This is only useful to user mode threads; supervisor threads call the
+ * APIs directly.
+ *
+ * @param recs System call records.
+ * @param count Number of records, at most @kconfig{CONFIG_SYSCALL_BATCH_MAX}.
+ *
+ * @retval 0 All the system calls were made.
+ * @retval -EINVAL @p count is too large.
+ * @retval -ENOTSUP Called from supervisor mode.
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_rec *recs, size_t count);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <zephyr/syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -0,0 +1,70 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_TRACING_TRACING_RAM_H
+#define ZEPHYR_INCLUDE_TRACING_TRACING_RAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RAM tracing backend APIs
+ * @defgroup subsys_tracing_ram_apis RAM tracing backend APIs
+ * @ingroup subsys_tracing
+ * @{
+ */
+
+/**
+ * @brief Stop recording tracing data in the RAM buffer.
+ *
+ * The data recorded so far is kept, e.g. to be retrieved with
+ * tracing_ram_read() once a problem has been detected. With
+ * @kconfig{CONFIG_TRACING_BACKEND_RAM_CIRCULAR}, this is the trigger of the
+ * flight recorder. This function can be called from an ISR or from a fatal
+ * error handler.
+ */
+void tracing_ram_freeze(void);
+
+/**
+ * @brief Clear the RAM buffer and resume recording.
+ */
+void tracing_ram_unfreeze(void);
+
+/**
+ * @brief Check whether recording in the RAM buffer is stopped.
+ *
+ * @retval true if tracing_ram_freeze() was called.
+ * @retval false otherwise.
+ */
+bool tracing_ram_is_frozen(void);
+
+/**
+ * @brief Read the tracing data recorded in the RAM buffer.
+ *
+ * The data is returned in the order it was recorded, the oldest first. It
+ * should only be read once recording has been stopped with
+ * tracing_ram_freeze().
+ *
+ * @param offset Offset in the recorded data to start reading at.
+ * @param buf    Buffer to copy the data to.
+ * @param len    Size of the buffer.
+ *
+ * @return Number of bytes copied, 0 once the end of the data is reached.
+ */
+size_t tracing_ram_read(size_t offset, uint8_t *buf, size_t len);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_TRACING_TRACING_RAM_H */
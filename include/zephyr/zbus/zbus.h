@@ -10,6 +10,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/ring_buffer.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -65,6 +66,17 @@ struct zbus_channel_data {
 	struct net_buf_pool *msg_subscriber_pool;
 #endif /* ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION */
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Single writer channel. The message is published without taking the semaphore and
+	 * protected by the @ref zbus_channel_data.seq sequence counter instead.
+	 */
+	bool seqlock;
+
+	/** Sequence counter of a single writer channel. It is odd while the message is written.
+	 */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 #if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS) || defined(__DOXYGEN__)
 	/** Kernel timestamp of the last publish action on this channel */
 	k_ticks_t publish_timestamp;
@@ -120,6 +132,7 @@ enum __packed zbus_observer_type {
 	ZBUS_OBSERVER_LISTENER_TYPE,
 	ZBUS_OBSERVER_SUBSCRIBER_TYPE,
 	ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+	ZBUS_OBSERVER_BATCH_SUBSCRIBER_TYPE,
 };
 
 struct zbus_observer_data {
@@ -132,6 +145,45 @@ struct zbus_observer_data {
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 };
 
+#if defined(CONFIG_ZBUS_BATCH_SUBSCRIBER) || defined(__DOXYGEN__)
+/**
+ * @brief Batch of messages held for a batch subscriber.
+ *
+ * The messages published to the observed channels are copied to a ring buffer, and the
+ * subscriber is woken up once per batch: when @ref zbus_batch_subscriber.batch_count messages
+ * are held, when the time window expires after the first message of the batch, or when the
+ * ring buffer is full.
+ */
+struct zbus_batch_subscriber {
+	/** Ring buffer holding the channel reference and a copy of each message. */
+	struct ring_buf *rb;
+
+	/** Semaphore given when the batch is ready. */
+	struct k_sem sem;
+
+	/** Timer of the time window. */
+	struct k_timer timer;
+
+	/** Protects the batch state. */
+	struct k_spinlock lock;
+
+	/** Number of messages held. */
+	uint16_t count;
+
+	/** Number of messages completing a batch. */
+	uint16_t batch_count;
+
+	/** Time window in milliseconds, zero to only wake up on a complete batch. */
+	uint32_t window_ms;
+
+	/** Set when the subscriber has been woken up and has not waited again yet. */
+	bool ready;
+
+	/** Set while the time window timer runs. */
+	bool timing;
+};
+#endif /* CONFIG_ZBUS_BATCH_SUBSCRIBER */
+
 /**
  * @brief Type used to represent an observer.
  *
@@ -171,6 +223,13 @@ struct zbus_observer {
 		 */
 		struct k_fifo *message_fifo;
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
+#if defined(CONFIG_ZBUS_BATCH_SUBSCRIBER) || defined(__DOXYGEN__)
+		/** Observer batch. It turns the observer into a batch subscriber. It only exists if
+		 * the @kconfig{CONFIG_ZBUS_BATCH_SUBSCRIBER} is enabled.
+		 */
+		struct zbus_batch_subscriber *batch;
+#endif /* CONFIG_ZBUS_BATCH_SUBSCRIBER */
 	};
 };
 
@@ -276,10 +335,14 @@ struct zbus_channel_observation {
 
 /* clang-format off */
 #define _ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data)                               \
+	_ZBUS_CHAN_DEFINE_MODE(_name, _id, _type, _validator, _user_data, false)
+
+#define _ZBUS_CHAN_DEFINE_MODE(_name, _id, _type, _validator, _user_data, _seqlock)                \
 	static struct zbus_channel_data _CONCAT(_zbus_chan_data_, _name) = {                       \
 		.observers_start_idx = -1,                                                         \
 		.observers_end_idx = -1,                                                           \
 		.sem = Z_SEM_INITIALIZER(_CONCAT(_zbus_chan_data_, _name).sem, 1, 1),              \
+		IF_ENABLED(CONFIG_ZBUS_CHANNEL_SEQLOCK, (.seqlock = _seqlock,))                    \
 		IF_ENABLED(CONFIG_ZBUS_PRIORITY_BOOST,                                             \
 			   (.highest_observer_priority = ZBUS_MIN_THREAD_PRIORITY,))               \
 		 IF_ENABLED(CONFIG_ZBUS_RUNTIME_OBSERVERS,                                         \
@@ -418,6 +481,39 @@ struct zbus_channel_observation {
 	/* Create all channel observations from observers list */                                  \
 	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
 
+/**
+ * @brief Zbus single writer channel definition.
+ *
+ * This macro defines a channel published by a single writer without taking the channel
+ * semaphore. The message is protected by a sequence lock instead: @ref zbus_chan_read copies
+ * the message again when it was published during the copy, so publishing never waits for the
+ * readers, and the observers are notified with the priority of the writer.
+ *
+ * Only one thread or ISR may publish to, or notify, the channel. A concurrent publication is
+ * rejected with -EBUSY. @ref zbus_chan_claim does not prevent the writer from changing the
+ * message of such a channel, and its runtime observers must not be added or removed while it
+ * is published.
+ *
+ * @param _name The channel's name.
+ * @param _type The Message type. It must be a struct or union.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ *
+ * @see struct zbus_channel
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ * @param _init_val The message initialization.
+ */
+#define ZBUS_CHAN_DEFINE_SEQLOCK(_name, _type, _validator, _user_data, _observers, _init_val)      \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_ZBUS_CHANNEL_SEQLOCK),                                      \
+		     "CONFIG_ZBUS_CHANNEL_SEQLOCK is required");                                   \
+	static _type _ZBUS_MESSAGE_NAME(_name) = _init_val;                                        \
+	_ZBUS_CHAN_DEFINE_MODE(_name, ZBUS_CHAN_ID_INVALID, _type, _validator, _user_data, true);  \
+	/* Extern declaration of observers */                                                      \
+	ZBUS_OBS_DECLARE(_observers);                                                              \
+	/* Create all channel observations from observers list */                                  \
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+
 /**
  * @brief Initialize a message.
  *
@@ -555,6 +651,69 @@ struct zbus_channel_observation {
  * @param[in] _name The subscriber's name.
  */
 #define ZBUS_MSG_SUBSCRIBER_DEFINE(_name) ZBUS_MSG_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, true)
+
+/** @cond INTERNAL_HIDDEN */
+void z_zbus_batch_window_expired(struct k_timer *timer);
+/** @endcond */
+
+/* clang-format off */
+
+/**
+ * @brief Define and initialize a batch subscriber.
+ *
+ * This macro defines an observer of @ref ZBUS_OBSERVER_BATCH_SUBSCRIBER_TYPE type. The messages
+ * published to the observed channels are copied to a ring buffer of @p _buf_size bytes, without
+ * allocating any buffer, and the subscriber is woken up once per batch instead of once per
+ * message.
+ *
+ * @param[in] _name The subscriber's name.
+ * @param[in] _buf_size Size of the ring buffer in bytes. Each message takes the size of a
+ *                      pointer plus the size of the message.
+ * @param[in] _count Number of messages completing a batch.
+ * @param[in] _window_ms Time window in milliseconds after the first message of a batch, after
+ *                       which the subscriber is woken up even if the batch is not complete. Zero
+ *                       to only wake the subscriber up on complete batches.
+ * @param[in] _enable The subscriber's initial state.
+ */
+#define ZBUS_BATCH_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, _buf_size, _count, _window_ms, _enable)  \
+	BUILD_ASSERT((_count) > 0 && (_count) <= UINT16_MAX, "invalid batch count");              \
+	RING_BUF_DECLARE(_CONCAT(_zbus_batch_rb_, _name), _buf_size);                              \
+	static struct zbus_batch_subscriber _CONCAT(_zbus_batch_, _name) = {                       \
+		.rb = &_CONCAT(_zbus_batch_rb_, _name),                                            \
+		.sem = Z_SEM_INITIALIZER(_CONCAT(_zbus_batch_, _name).sem, 0, 1),                  \
+		.timer = Z_TIMER_INITIALIZER(_CONCAT(_zbus_batch_, _name).timer,                   \
+					     z_zbus_batch_window_expired, NULL),                   \
+		.batch_count = (_count),                                                           \
+		.window_ms = (_window_ms),                                                         \
+	};                                                                                         \
+	static struct zbus_observer_data _CONCAT(_zbus_obs_data_, _name) = {                       \
+		.enabled = _enable,                                                                \
+		IF_ENABLED(CONFIG_ZBUS_PRIORITY_BOOST, (                                           \
+			.priority = ZBUS_MIN_THREAD_PRIORITY,                                      \
+		))                                                                                 \
+	};                                                                                         \
+	_ZBUS_CPP_EXTERN const STRUCT_SECTION_ITERABLE(zbus_observer, _name) = {                   \
+		ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */                                    \
+		.type = ZBUS_OBSERVER_BATCH_SUBSCRIBER_TYPE,                                       \
+		.data = &_CONCAT(_zbus_obs_data_, _name),                                          \
+		.batch = &_CONCAT(_zbus_batch_, _name),                                            \
+	}
+/* clang-format on */
+
+/**
+ * @brief Define and initialize an enabled batch subscriber.
+ *
+ * This macro defines an observer of batch subscriber type, in the enabled state.
+ *
+ * @param[in] _name The subscriber's name.
+ * @param[in] _buf_size Size of the ring buffer in bytes.
+ * @param[in] _count Number of messages completing a batch.
+ * @param[in] _window_ms Time window in milliseconds, zero to only wake up on complete batches.
+ *
+ * @see ZBUS_BATCH_SUBSCRIBER_DEFINE_WITH_ENABLE
+ */
+#define ZBUS_BATCH_SUBSCRIBER_DEFINE(_name, _buf_size, _count, _window_ms)                         \
+	ZBUS_BATCH_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, _buf_size, _count, _window_ms, true)
 /**
  *
  * @brief Publish to a channel
@@ -1128,6 +1287,44 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_BATCH_SUBSCRIBER) || defined(__DOXYGEN__)
+
+/**
+ * @brief Wait for a batch of messages.
+ *
+ * This routine makes the batch subscriber wait until a batch is complete, its time window
+ * expired, or its ring buffer is full. The messages are then retrieved with
+ * @ref zbus_sub_batch_get.
+ *
+ * @param[in] sub The subscriber's reference.
+ * @param[in] timeout Waiting period for a batch,
+ *                or one of the special values, K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages held on success.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_sub_wait_batch(const struct zbus_observer *sub, k_timeout_t timeout);
+
+/**
+ * @brief Get the oldest message held by a batch subscriber.
+ *
+ * @param[in] sub The subscriber's reference.
+ * @param[out] chan The channel the message was published to.
+ * @param[out] msg A buffer large enough for the message of any observed channel.
+ *
+ * @retval 0 Message retrieved.
+ * @retval -ENOMSG No message is held.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_sub_batch_get(const struct zbus_observer *sub, const struct zbus_channel **chan,
+		       void *msg);
+
+#endif /* CONFIG_ZBUS_BATCH_SUBSCRIBER */
+
 /**
  *
  * @brief Iterate over channels.
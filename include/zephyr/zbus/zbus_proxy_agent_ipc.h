@@ -0,0 +1,181 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZBUS_PROXY_AGENT_IPC_H_
+#define ZEPHYR_INCLUDE_ZBUS_PROXY_AGENT_IPC_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/zbus/zbus.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup zbus_proxy_agent_ipc Zbus IPC proxy agent
+ * @ingroup zbus_apis
+ *
+ * The IPC proxy agent mirrors selected channels with the ones of a remote core, over an
+ * IPC service endpoint. The channels are identified on both cores by their numeric identifier,
+ * see @ref ZBUS_CHAN_DEFINE_WITH_ID, and must have the same message type on both cores.
+ *
+ * Publications made from ISRs are not sent to the remote core.
+ *
+ * Each publication of a mirrored channel is written directly to a TX buffer of the endpoint,
+ * when the backend supports no-copy sending, and publications are batched in one IPC message
+ * up to @kconfig{CONFIG_ZBUS_PROXY_AGENT_IPC_BATCH_WINDOW_MS}. Received messages are published
+ * straight from the RX buffer of the endpoint to the local channels.
+ *
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+/** Header of an IPC message of the proxy agent. */
+struct zbus_proxy_agent_ipc_hdr {
+	/** Number of records following the header. */
+	uint16_t count;
+	/** Reserved, zero. */
+	uint16_t reserved;
+} __packed;
+
+/** Record of a publication, followed by the message padded to 4 bytes. */
+struct zbus_proxy_agent_ipc_rec {
+	/** Identifier of the channel. */
+	uint32_t id;
+	/** Sequence number of the record, incremented for each record sent by the agent. */
+	uint32_t seq;
+	/** Size of the message. */
+	uint16_t size;
+	/** Reserved, zero. */
+	uint16_t reserved;
+} __packed;
+
+/** @endcond */
+
+/** Statistics of an IPC proxy agent. */
+struct zbus_proxy_agent_ipc_stats {
+	/** Publications sent to the remote core. */
+	uint32_t sent;
+	/** Publications that could not be sent to the remote core. */
+	uint32_t dropped;
+	/** Publications received from the remote core. */
+	uint32_t received;
+	/** Publications the remote core sent but were not received, based on sequence numbers. */
+	uint32_t lost;
+	/** Received publications of unknown channels or of an unexpected size. */
+	uint32_t rejected;
+};
+
+/** IPC proxy agent. Use @ref ZBUS_PROXY_AGENT_IPC_DEFINE to define one. */
+struct zbus_proxy_agent_ipc {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *instance;
+	struct ipc_ept ept;
+	struct ipc_ept_cfg ept_cfg;
+	struct k_mutex lock;
+	struct k_work_delayable flush_work;
+	/* TX buffer being filled, either from the endpoint or tx_copy */
+	uint8_t *tx_buf;
+	uint32_t tx_size;
+	uint32_t tx_len;
+	uint16_t tx_count;
+	bool tx_nocopy;
+	uint32_t tx_seq;
+	uint32_t rx_seq;
+	bool rx_synced;
+	/* Channel being published from a received record, not to be sent back */
+	const struct zbus_channel *rx_chan;
+	k_tid_t rx_thread;
+	atomic_t bound;
+	atomic_t isr_dropped;
+	struct zbus_proxy_agent_ipc_stats stats;
+	uint8_t tx_copy[CONFIG_ZBUS_PROXY_AGENT_IPC_TX_BUF_SIZE] __aligned(4);
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+void z_zbus_proxy_agent_ipc_forward(struct zbus_proxy_agent_ipc *agent,
+				    const struct zbus_channel *chan);
+/** @endcond */
+
+/**
+ * @brief Define an IPC proxy agent.
+ *
+ * @param _name Name of the agent.
+ * @param _instance IPC service instance device, e.g. ``DEVICE_DT_GET(DT_NODELABEL(ipc0))``.
+ * @param _ept_name Name of the endpoint, the same on both cores.
+ */
+#define ZBUS_PROXY_AGENT_IPC_DEFINE(_name, _instance, _ept_name)                                   \
+	struct zbus_proxy_agent_ipc _name = {                                                      \
+		.instance = (_instance),                                                           \
+		.ept_cfg = {                                                                       \
+			.name = (_ept_name),                                                       \
+			.priv = &_name,                                                            \
+		},                                                                                 \
+	};                                                                                         \
+	static void _CONCAT(_zbus_proxy_agent_ipc_cb_, _name)(const struct zbus_channel *chan)    \
+	{                                                                                          \
+		z_zbus_proxy_agent_ipc_forward(&_name, chan);                                      \
+	}                                                                                          \
+	ZBUS_LISTENER_DEFINE(_CONCAT(_zbus_proxy_agent_ipc_lis_, _name),                         \
+			     _CONCAT(_zbus_proxy_agent_ipc_cb_, _name))
+
+/**
+ * @brief Mirror a channel with the remote core.
+ *
+ * The publications of the channel are sent to the remote core, and the ones received from the
+ * remote core for the channel identifier are published to the channel.
+ *
+ * @param _name Name of the agent.
+ * @param _chan Channel to mirror, defined with @ref ZBUS_CHAN_DEFINE_WITH_ID.
+ */
+#define ZBUS_PROXY_AGENT_IPC_MIRROR(_name, _chan)                                                  \
+	ZBUS_CHAN_ADD_OBS(_chan, _CONCAT(_zbus_proxy_agent_ipc_lis_, _name), 0)
+
+/**
+ * @brief Start an IPC proxy agent.
+ *
+ * Open the IPC service instance and register the endpoint of the agent. Publications are sent
+ * to the remote core once the endpoint is bound.
+ *
+ * @param agent Agent to start.
+ *
+ * @retval 0 Agent started.
+ * @retval -errno Error from @ref ipc_service_open_instance or
+ *         @ref ipc_service_register_endpoint.
+ */
+int zbus_proxy_agent_ipc_start(struct zbus_proxy_agent_ipc *agent);
+
+/**
+ * @brief Send the pending publications of an IPC proxy agent immediately.
+ *
+ * @param agent Agent to flush.
+ *
+ * @retval 0 Publications sent, or none pending.
+ * @retval -errno Error from the IPC service.
+ */
+int zbus_proxy_agent_ipc_flush(struct zbus_proxy_agent_ipc *agent);
+
+/**
+ * @brief Get the statistics of an IPC proxy agent.
+ *
+ * @param agent Agent.
+ * @param stats Statistics.
+ */
+void zbus_proxy_agent_ipc_stats_get(struct zbus_proxy_agent_ipc *agent,
+				    struct zbus_proxy_agent_ipc_stats *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZBUS_PROXY_AGENT_IPC_H_ */
@@ -0,0 +1,94 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/fdtable.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+/** Data given back by @ref zvfs_epoll_wait for a ready file descriptor */
+typedef union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zvfs_epoll_data_t;
+
+/** Event of interest, or ready event, of a file descriptor */
+struct zvfs_epoll_event {
+	/** ZVFS_POLLIN, ZVFS_POLLOUT, ... as for @ref zvfs_poll */
+	uint32_t events;
+	/** Data attached to the file descriptor by @ref zvfs_epoll_ctl */
+	zvfs_epoll_data_t data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * An epoll instance holds a set of file descriptors along with the
+ * events of interest of each. Unlike @ref zvfs_poll, the set is given only
+ * once and @ref zvfs_epoll_wait returns the ready file descriptors only.
+ *
+ * The poll events of a file descriptor stay registered with their objects
+ * while it is in the set, so a wait only handles the file descriptors that
+ * are ready, or were returned by the previous wait, instead of all of them.
+ *
+ * Offloaded sockets cannot be added to the set.
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(void);
+
+/**
+ * @brief Add, modify or remove a file descriptor of a ZVFS epoll instance
+ *
+ * A thread blocked in @ref zvfs_epoll_wait on the instance takes the
+ * change into account.
+ *
+ * A file descriptor should be removed from the set before being closed, as
+ * its poll events are registered with the objects of the file descriptor.
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param op ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor
+ * @param event Events of interest and attached data, ignored for
+ *        ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, const struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for a file descriptor of a ZVFS epoll instance to be ready
+ *
+ * A file descriptor still ready, e.g. with data not read yet, is returned
+ * again by the next wait.
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param events Array filled with the ready events
+ * @param maxevents Length of @p events
+ * @param timeout Timeout in milliseconds, or -1 to wait forever
+ *
+ * @return Number of ready file descriptors, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
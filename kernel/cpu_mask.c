@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <ksched.h>
+#include <ipi.h>
+#include <timeout_q.h>
 #include <zephyr/spinlock.h>
 
 extern struct k_spinlock _sched_spinlock;
@@ -16,6 +19,22 @@ BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 16, "Too many CPUs for mask word");
 # endif /* CONFIG_SMP */
 
 
+static void timeout_follow_mask(k_tid_t thread)
+{
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	/* A pinned thread's timeout belongs on the queue of its CPU, move
+	 * a pending one (e.g. a sleep) along with the pin.
+	 */
+	int cpu = z_thread_timeout_cpu(thread);
+
+	if (cpu >= 0) {
+		(void)z_timeout_migrate(&thread->base.timeout, cpu);
+	}
+#else
+	ARG_UNUSED(thread);
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+}
+
 static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_mask)
 {
 	int ret = 0;
@@ -41,6 +60,10 @@ static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_m
 			 "Only one CPU allowed in mask when PIN_ONLY");
 #endif /* defined(CONFIG_ASSERT) && defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) */
 
+	if (ret == 0) {
+		timeout_follow_mask(thread);
+	}
+
 	return ret;
 }
 
@@ -70,3 +93,217 @@ int k_thread_cpu_pin(k_tid_t thread, int cpu)
 
 	return cpu_mask_mod(thread, mask, ~mask);
 }
+
+#ifdef CONFIG_SCHED_CPU_MASK_BALANCE
+/*
+ * Periodic balancer for the threads given to k_thread_cpu_balance(). Each
+ * period, the load of every CPU is computed from the runtime statistics.
+ * If the gap between the most and least loaded CPUs is above the threshold,
+ * the busiest balanced thread of the most loaded CPU whose own load is at
+ * most half of that gap is pinned to the least loaded CPU. Moving at most
+ * half of the gap cannot make the two CPUs swap places, and a moved thread
+ * is held on its new CPU for a few periods, so that threads do not bounce.
+ */
+
+#define BALANCE_PERIOD K_MSEC(CONFIG_SCHED_CPU_MASK_BALANCE_PERIOD_MS)
+
+struct balance_pass {
+	int from;
+	int to;
+	uint64_t window;
+	uint64_t max_cycles;
+	uint64_t best_cycles;
+	struct k_thread *best;
+};
+
+static struct k_work_delayable balance_work;
+static uint64_t cpu_last_total[CONFIG_MP_MAX_NUM_CPUS];
+static uint64_t cpu_last_execution[CONFIG_MP_MAX_NUM_CPUS];
+static uint16_t cpu_load[CONFIG_MP_MAX_NUM_CPUS];
+
+static bool thread_running(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static int least_loaded_cpu(uint32_t cpu_mask)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int best = -1;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (((cpu_mask & BIT(i)) != 0U) &&
+		    ((best < 0) || (cpu_load[i] < cpu_load[best]))) {
+			best = i;
+		}
+	}
+
+	return best;
+}
+
+static void balance_thread_cb(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	struct balance_pass *pass = user_data;
+	k_thread_runtime_stats_t stats;
+	uint64_t cycles;
+
+	if (thread->base.balance_mask == 0U) {
+		return;
+	}
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	cycles = stats.execution_cycles - thread->base.balance_cycles;
+	thread->base.balance_cycles = stats.execution_cycles;
+
+	if (thread->base.balance_hold > 0U) {
+		thread->base.balance_hold--;
+		return;
+	}
+
+	if ((pass->from < 0) || (thread->base.cpu_mask != BIT(pass->from)) ||
+	    ((thread->base.balance_mask & BIT(pass->to)) == 0U)) {
+		return;
+	}
+
+	if ((cycles > pass->best_cycles) && (cycles <= pass->max_cycles)) {
+		pass->best = thread;
+		pass->best_cycles = cycles;
+	}
+}
+
+static void balance_migrate(struct k_thread *thread, int from, int to)
+{
+	bool moved = false;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		/* The mask of a running thread is not checked until it
+		 * is switched out, leave it for a later period.
+		 */
+		if ((thread->base.cpu_mask != BIT(from)) || thread_running(thread)) {
+			K_SPINLOCK_BREAK;
+		}
+
+		thread->base.cpu_mask = BIT(to);
+		thread->base.balance_hold = CONFIG_SCHED_CPU_MASK_BALANCE_HOLD;
+		moved = true;
+
+		if (z_is_thread_queued(thread)) {
+			flag_ipi(IPI_CPU_MASK(to));
+		}
+	}
+
+	if (moved) {
+		timeout_follow_mask(thread);
+		signal_pending_ipi();
+	}
+}
+
+static void balance_handler(struct k_work *work)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint64_t window[CONFIG_MP_MAX_NUM_CPUS];
+	struct balance_pass pass = { .from = -1, .to = -1 };
+	k_thread_runtime_stats_t stats;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (k_thread_runtime_stats_cpu_get(i, &stats) != 0) {
+			window[i] = 0U;
+			continue;
+		}
+
+		uint64_t total = stats.total_cycles - cpu_last_total[i];
+
+		window[i] = stats.execution_cycles - cpu_last_execution[i];
+		cpu_load[i] = (window[i] != 0U) ? (uint16_t)((total * 1000U) / window[i]) : 0U;
+		cpu_last_total[i] = stats.total_cycles;
+		cpu_last_execution[i] = stats.execution_cycles;
+
+		if ((pass.from < 0) || (cpu_load[i] > cpu_load[pass.from])) {
+			pass.from = i;
+		}
+		if ((pass.to < 0) || (cpu_load[i] < cpu_load[pass.to])) {
+			pass.to = i;
+		}
+	}
+
+	if ((cpu_load[pass.from] - cpu_load[pass.to]) <
+	    (CONFIG_SCHED_CPU_MASK_BALANCE_THRESHOLD * 10)) {
+		pass.from = -1;
+	} else {
+		pass.window = window[pass.from];
+		pass.max_cycles = (pass.window * (cpu_load[pass.from] - cpu_load[pass.to])) /
+				  2000U;
+	}
+
+	/* Always walk the threads, to keep their cycle snapshots current */
+	k_thread_foreach(balance_thread_cb, &pass);
+
+	if (pass.best != NULL) {
+		balance_migrate(pass.best, pass.from, pass.to);
+	}
+
+	k_work_reschedule(&balance_work, BALANCE_PERIOD);
+}
+
+int k_thread_cpu_balance(k_tid_t thread, uint32_t cpu_mask)
+{
+	int ret = 0;
+	int cpu;
+
+	cpu_mask &= BIT_MASK(arch_num_cpus());
+
+	K_SPINLOCK(&_sched_spinlock) {
+		if (cpu_mask == 0U) {
+			thread->base.balance_mask = 0U;
+			K_SPINLOCK_BREAK;
+		}
+
+		if (!z_is_thread_prevented_from_running(thread)) {
+			ret = -EINVAL;
+			K_SPINLOCK_BREAK;
+		}
+
+		cpu = least_loaded_cpu(cpu_mask);
+		thread->base.cpu_mask = BIT(cpu);
+		thread->base.balance_mask = cpu_mask;
+		thread->base.balance_hold = 0U;
+	}
+
+	if ((ret == 0) && (cpu_mask != 0U)) {
+		timeout_follow_mask(thread);
+	}
+
+	return ret;
+}
+
+int k_sched_cpu_load_get(int cpu)
+{
+	if ((cpu < 0) || (cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	return cpu_load[cpu];
+}
+
+static int balance_init(void)
+{
+	k_work_init_delayable(&balance_work, balance_handler);
+	k_work_schedule(&balance_work, BALANCE_PERIOD);
+
+	return 0;
+}
+
+SYS_INIT(balance_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_SCHED_CPU_MASK_BALANCE */
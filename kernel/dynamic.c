@@ -27,33 +27,94 @@ struct dyn_cb_data {
 	k_thread_stack_t *stack;
 };
 
+/* A size class of the stack pool, i.e. an array of stacks of the same size */
+struct dyn_stack_pool {
+	k_thread_stack_t *stacks;
+	size_t obj_size;
+	size_t stack_size;
+	size_t num_stacks;
+	sys_bitarray_t *ba;
+};
+
 static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack, CONFIG_DYNAMIC_THREAD_POOL_SIZE,
 				   CONFIG_DYNAMIC_THREAD_STACK_SIZE);
 SYS_BITARRAY_DEFINE_STATIC(dynamic_ba, BA_SIZE);
 
+#if CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE > 0
+BUILD_ASSERT(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE < CONFIG_DYNAMIC_THREAD_STACK_SIZE,
+	     "small pool stacks must be smaller than the other pool stacks");
+
+static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack_small, CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE,
+				   CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE);
+SYS_BITARRAY_DEFINE_STATIC(dynamic_small_ba, CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE);
+#endif /* CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE > 0 */
+
+/* Sorted by increasing stack size, the smallest class that fits is used first */
+static const struct dyn_stack_pool dyn_stack_pools[] = {
+#if CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE > 0
+	{
+		.stacks = (k_thread_stack_t *)dynamic_stack_small,
+		.obj_size = sizeof(dynamic_stack_small[0]),
+		.stack_size = CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE,
+		.num_stacks = CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE,
+		.ba = &dynamic_small_ba,
+	},
+#endif /* CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE > 0 */
+	{
+		.stacks = (k_thread_stack_t *)dynamic_stack,
+		.obj_size = sizeof(dynamic_stack[0]),
+		.stack_size = CONFIG_DYNAMIC_THREAD_STACK_SIZE,
+		.num_stacks = CONFIG_DYNAMIC_THREAD_POOL_SIZE,
+		.ba = &dynamic_ba,
+	},
+};
+
+#define DYN_STACK_POOL_ENABLED                                                                     \
+	((CONFIG_DYNAMIC_THREAD_POOL_SIZE + CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE) > 0)
+
 static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size)
 {
 	int rv;
 	size_t offset;
-	k_thread_stack_t *stack;
 
-	if (size > CONFIG_DYNAMIC_THREAD_STACK_SIZE) {
-		LOG_DBG("stack size %zu is > pool stack size %d", size,
-			CONFIG_DYNAMIC_THREAD_STACK_SIZE);
-		return NULL;
-	}
+	ARRAY_FOR_EACH_PTR(dyn_stack_pools, pool) {
+		if (pool->num_stacks == 0 || size > pool->stack_size) {
+			continue;
+		}
 
-	rv = sys_bitarray_alloc(&dynamic_ba, 1, &offset);
-	if (rv < 0) {
-		LOG_DBG("unable to allocate stack from pool");
-		return NULL;
+		/* Fall back to the next size class if this one is exhausted */
+		rv = sys_bitarray_alloc(pool->ba, 1, &offset);
+		if (rv < 0) {
+			continue;
+		}
+
+		__ASSERT_NO_MSG(offset < pool->num_stacks);
+
+		return (k_thread_stack_t *)((uint8_t *)pool->stacks + offset * pool->obj_size);
 	}
 
-	__ASSERT_NO_MSG(offset < CONFIG_DYNAMIC_THREAD_POOL_SIZE);
+	LOG_DBG("unable to allocate stack of size %zu from pool", size);
 
-	stack = (k_thread_stack_t *)&dynamic_stack[offset];
+	return NULL;
+}
 
-	return stack;
+/* Return the size class @a stack belongs to, or NULL if not from the pool */
+static const struct dyn_stack_pool *z_thread_stack_pool_find(k_thread_stack_t *stack,
+							     size_t *offset)
+{
+	ARRAY_FOR_EACH_PTR(dyn_stack_pools, pool) {
+		uintptr_t start = (uintptr_t)pool->stacks;
+		uintptr_t addr = (uintptr_t)stack;
+
+		if (pool->num_stacks > 0 && addr >= start &&
+		    addr < start + pool->num_stacks * pool->obj_size &&
+		    (addr - start) % pool->obj_size == 0) {
+			*offset = (addr - start) / pool->obj_size;
+			return pool;
+		}
+	}
+
+	return NULL;
 }
 
 static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t size, int flags)
@@ -78,11 +139,11 @@ k_thread_stack_t *z_impl_k_thread_stack_alloc(size_t size, int flags)
 
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_ALLOC)) {
 		stack = z_thread_stack_alloc_dyn(size, flags);
-		if (stack == NULL && CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
+		if (stack == NULL && DYN_STACK_POOL_ENABLED) {
 			stack = z_thread_stack_alloc_pool(size);
 		}
 	} else if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_POOL)) {
-		if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
+		if (DYN_STACK_POOL_ENABLED) {
 			stack = z_thread_stack_alloc_pool(size);
 		}
 
@@ -128,9 +189,13 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 		}
 	}
 
-	if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
-		if (IS_ARRAY_ELEMENT(dynamic_stack, stack)) {
-			if (sys_bitarray_free(&dynamic_ba, 1, ARRAY_INDEX(dynamic_stack, stack))) {
+	if (DYN_STACK_POOL_ENABLED) {
+		const struct dyn_stack_pool *pool;
+		size_t offset;
+
+		pool = z_thread_stack_pool_find(stack, &offset);
+		if (pool != NULL) {
+			if (sys_bitarray_free(pool->ba, 1, offset)) {
 				LOG_ERR("stack %p is not allocated!", stack);
 				return -EINVAL;
 			}
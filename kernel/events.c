@@ -10,10 +10,15 @@
  * Event objects are used to signal one or more threads that a custom set of
  * events has occurred. Threads wait on event objects until another thread or
  * ISR posts the desired set of events to the event object. Each time events
- * are posted to an event object, all threads waiting on that event object are
- * processed to determine if there is a match. All threads that whose wait
- * conditions match the current set of events now belonging to the event object
- * are awakened.
+ * are posted to an event object, the threads waiting on that event object for
+ * one of the events that were not set yet are processed to determine if there
+ * is a match. All threads that whose wait conditions match the current set of
+ * events now belonging to the event object are awakened.
+ *
+ * The waiting threads are spread over several wait queues according to the
+ * lowest event they wait for, and the events that the threads of each wait
+ * queue wait for are tracked, so that only the wait queues with threads that
+ * could be awakened are processed.
  *
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
@@ -30,6 +35,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 /* private kernel APIs */
 #include <wait_q.h>
 #include <ksched.h>
@@ -43,6 +49,8 @@
 struct event_walk_data {
 	struct k_thread  *head;
 	uint32_t events;
+	/* Events still waited for by the threads left in the wait queue */
+	uint32_t wait_events;
 };
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -58,7 +66,10 @@ void z_impl_k_event_init(struct k_event *event)
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
 
-	z_waitq_init(&event->wait_q);
+	for (unsigned int i = 0; i < Z_EVENT_WAIT_BUCKETS; i++) {
+		z_waitq_init(&event->wait_q[i]);
+		event->wait_events[i] = 0;
+	}
 
 	k_object_init(event);
 
@@ -100,6 +111,12 @@ static bool are_wait_conditions_met(uint32_t desired, uint32_t current,
 	return match != 0;
 }
 
+/* Wait queue of the threads waiting for a set of events */
+static inline unsigned int event_wait_bucket(uint32_t events)
+{
+	return u32_count_trailing_zeros(events) % Z_EVENT_WAIT_BUCKETS;
+}
+
 static int event_walk_op(struct k_thread *thread, void *data)
 {
 	unsigned int      wait_condition;
@@ -125,6 +142,8 @@ static int event_walk_op(struct k_thread *thread, void *data)
 		thread->next_event_link = event_data->head;
 		event_data->head = thread;
 		z_abort_timeout(&thread->base.timeout);
+	} else {
+		event_data->wait_events |= thread->events;
 	}
 
 	return 0;
@@ -137,6 +156,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
+	uint32_t new_events;
 
 	data.head = NULL;
 	key = k_spin_lock(&event->lock);
@@ -147,6 +167,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	previous_events = event->events & events_mask;
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
+	new_events = events & ~event->events;
 	event->events = events;
 	data.events = events;
 	/*
@@ -154,12 +175,24 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * It is desirable to unpend all affected threads simultaneously. This
 	 * is done in three steps:
 	 *
-	 * 1. Walk the waitq and create a linked list of threads to unpend.
+	 * 1. Walk the waitqs and create a linked list of threads to unpend.
 	 * 2. Unpend each of the threads in the linked list
 	 * 3. Ready each of the threads in the linked list
+	 *
+	 * The pended threads did not have their wait conditions met by the
+	 * previous set of events, so only those waiting for one of the newly
+	 * set events may be awakened, and the other waitqs are not walked.
 	 */
 
-	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+	for (unsigned int i = 0; i < Z_EVENT_WAIT_BUCKETS; i++) {
+		if ((event->wait_events[i] & new_events) == 0U) {
+			continue;
+		}
+
+		data.wait_events = 0;
+		z_sched_waitq_walk(&event->wait_q[i], event_walk_op, &data);
+		event->wait_events[i] = data.wait_events;
+	}
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -244,6 +277,7 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 {
 	uint32_t  rv = 0;
 	unsigned int  wait_condition;
+	unsigned int  bucket;
 	struct k_thread  *thread;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
@@ -290,10 +324,13 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	thread->events = events;
 	thread->event_options = options;
 
+	bucket = event_wait_bucket(events);
+	event->wait_events[bucket] |= events;
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
-	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
+	if (z_pend_curr(&event->lock, key, &event->wait_q[bucket], timeout) == 0) {
 		/* Retrieve the set of events that woke the thread */
 		rv = thread->events;
 	}
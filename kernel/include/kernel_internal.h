@@ -27,6 +27,16 @@ extern "C" {
 /* Initialize per-CPU kernel data */
 void z_init_cpu(int id);
 
+#ifdef CONFIG_INIT_TIME_STATS
+struct init_entry;
+
+/* Record the time taken by an init entry */
+void z_init_time_stat_record(const struct init_entry *entry, uint8_t level, uint32_t cycles);
+
+/* Sort the init time statistics once all init levels are done */
+void z_init_time_stats_finish(void);
+#endif /* CONFIG_INIT_TIME_STATS */
+
 /* Initialize a thread */
 void z_init_thread_base(struct _thread_base *thread_base, int priority,
 			uint32_t initial_state, unsigned int options);
@@ -107,6 +117,29 @@ void *z_thread_aligned_alloc(size_t align, size_t size);
  */
 void *z_thread_malloc(size_t size);
 
+#ifdef CONFIG_HEAP_MAGAZINE
+/**
+ * @brief Allocate a small block from the magazine of the current CPU
+ *
+ * Used by the k_malloc() family, which bypasses k_heap_alloc().
+ *
+ * @param heap Heap to allocate from
+ * @param bytes Memory allocation size
+ * @return A pointer to the allocated memory, or NULL if the size is not
+ * cached by the magazines or the heap has no memory left for a refill
+ */
+void *z_heap_magazine_alloc(struct k_heap *heap, size_t bytes);
+
+/**
+ * @brief Give the blocks cached by the magazines of all CPUs back to the heap
+ *
+ * Must be called without holding the heap lock.
+ *
+ * @param heap Heap to drain the magazines of
+ */
+void z_heap_magazine_drain(struct k_heap *heap);
+#endif /* CONFIG_HEAP_MAGAZINE */
+
 
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
@@ -180,6 +213,16 @@ void z_mem_domain_exit_thread(struct k_thread *thread);
 extern struct k_spinlock z_mem_domain_lock;
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYS_MUTEX_FAST
+/* Make owner the owner of an unlocked mutex, if val is swapped from old_val to new_val */
+int z_mutex_adopt(struct k_mutex *mutex, struct k_thread *owner, atomic_t *val,
+		  atomic_val_t old_val, atomic_val_t new_val);
+
+/* Swap val from old_val to new_val if the mutex is unlocked */
+void z_mutex_cas_if_unlocked(struct k_mutex *mutex, atomic_t *val, atomic_val_t old_val,
+			     atomic_val_t new_val);
+#endif /* CONFIG_SYS_MUTEX_FAST */
+
 #ifdef CONFIG_GDBSTUB
 struct gdb_ctx;
 
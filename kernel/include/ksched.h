@@ -327,6 +327,16 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+/**
+ * @brief Record the time a thread is made ready.
+ *
+ * The wake-to-run latency is measured from there to the next
+ * z_sched_usage_start() call for the thread.
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
@@ -264,16 +264,26 @@ static ALWAYS_INLINE struct prio_info get_prio_info(int8_t old_prio)
 	return ret;
 }
 
+#if PRIQ_BITMAP_SIZE > 1
+BUILD_ASSERT(PRIQ_BITMAP_SIZE <= NBITS, "bitmap summary word too small");
+#endif
+
 static ALWAYS_INLINE unsigned int z_priq_mq_best_queue_index(struct _priq_mq *pq)
 {
-	unsigned int i = 0;
+#if PRIQ_BITMAP_SIZE > 1
+	/* Two-level lookup: the summary word gives the first non-empty
+	 * bitmap word, which in turn gives the first non-empty list.
+	 */
+	if (likely(pq->bitmask_summary)) {
+		unsigned int i = TRAILING_ZEROS(pq->bitmask_summary);
 
-	do {
-		if (likely(pq->bitmask[i])) {
-			return i * NBITS + TRAILING_ZEROS(pq->bitmask[i]);
-		}
-		i++;
-	} while (i < PRIQ_BITMAP_SIZE);
+		return i * NBITS + TRAILING_ZEROS(pq->bitmask[i]);
+	}
+#else
+	if (likely(pq->bitmask[0])) {
+		return TRAILING_ZEROS(pq->bitmask[0]);
+	}
+#endif
 
 	return K_NUM_THREAD_PRIO - 1;
 }
@@ -296,6 +306,9 @@ static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
+#if PRIQ_BITMAP_SIZE > 1
+	pq->bitmask_summary |= BIT(pos.idx);
+#endif
 
 #ifndef CONFIG_SMP
 	if (pos.offset_prio < pq->cached_queue_index) {
@@ -312,6 +325,11 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 	sys_dlist_dequeue(&thread->base.qnode_dlist);
 	if (unlikely(sys_dlist_is_empty(&pq->queues[pos.offset_prio]))) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+#if PRIQ_BITMAP_SIZE > 1
+		if (pq->bitmask[pos.idx] == 0) {
+			pq->bitmask_summary &= ~BIT(pos.idx);
+		}
+#endif
 #ifndef CONFIG_SMP
 		pq->cached_queue_index = z_priq_mq_best_queue_index(pq);
 #endif
@@ -13,6 +13,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/math_extras.h>
 
 #include <stdbool.h>
 
@@ -56,9 +57,52 @@ static inline void z_init_thread_timeout(struct _thread_base *thread_base)
 
 extern void z_thread_timeout(struct _timeout *timeout);
 
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+/* Adds the timeout to the queue of the given CPU, or of the calling CPU
+ * if cpu is negative.
+ *
+ * @return Absolute tick value when timeout will expire.
+ */
+k_ticks_t z_add_timeout_on_cpu(struct _timeout *to, _timeout_func_t fn,
+			       k_timeout_t timeout, int cpu);
+
+/* Moves a (possibly pending) timeout to the queue of the given CPU,
+ * keeping its expiry.
+ *
+ * @return 0 if a pending timeout was moved, -EINVAL if it was inactive.
+ */
+int z_timeout_migrate(struct _timeout *to, int cpu);
+
+/* Reprograms the local CPU's timer for its own timeout queue */
+void z_timeout_queue_reprogram(void);
+
+/* CPU whose queue a thread's timeouts go to: the CPU it is pinned to, or
+ * -1 (the calling CPU) for threads that may run anywhere.
+ */
+static inline int z_thread_timeout_cpu(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	uint32_t mask = thread->base.cpu_mask;
+
+	if ((mask != 0U) && ((mask & (mask - 1U)) == 0U)) {
+		return (int)u32_count_trailing_zeros(mask);
+	}
+#else
+	ARG_UNUSED(thread);
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	return -1;
+}
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
 static inline k_ticks_t z_add_thread_timeout(struct k_thread *thread, k_timeout_t ticks)
 {
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	return z_add_timeout_on_cpu(&thread->base.timeout, z_thread_timeout, ticks,
+				    z_thread_timeout_cpu(thread));
+#else
 	return z_add_timeout(&thread->base.timeout, z_thread_timeout, ticks);
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
 }
 
 static inline void z_abort_thread_timeout(struct k_thread *thread)
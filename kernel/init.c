@@ -337,6 +337,165 @@ static int do_device_init(const struct device *dev)
 	return rc;
 }
 
+#if defined(CONFIG_DEVICE_INIT_TIME_REPORT) || defined(CONFIG_INIT_TIME_STATS)
+#define INIT_ENTRY_TIMED 1
+#endif
+
+#ifdef CONFIG_DEVICE_INIT_TIME_REPORT
+static void init_time_report(const struct device *dev, uint32_t cycles, bool parallel)
+{
+	printk("init: %-32s %8u us%s\n", dev->name, k_cyc_to_us_floor32(cycles),
+	       parallel ? " (parallel)" : "");
+}
+#endif /* CONFIG_DEVICE_INIT_TIME_REPORT */
+
+static int init_entry_run(const struct init_entry *entry, enum init_level level, bool parallel)
+{
+	const struct device *dev = entry->dev;
+	int result = 0;
+#ifdef INIT_ENTRY_TIMED
+	uint32_t start = k_cycle_get_32();
+	uint32_t cycles;
+#endif /* INIT_ENTRY_TIMED */
+
+	ARG_UNUSED(parallel);
+
+	sys_trace_sys_init_enter(entry, level);
+	if (dev != NULL) {
+		if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
+			result = do_device_init(dev);
+		}
+	} else {
+		result = entry->init_fn();
+	}
+	sys_trace_sys_init_exit(entry, level, result);
+
+#ifdef INIT_ENTRY_TIMED
+	cycles = k_cycle_get_32() - start;
+#endif /* INIT_ENTRY_TIMED */
+
+#ifdef CONFIG_DEVICE_INIT_TIME_REPORT
+	/* The console is only usable once the kernel is running */
+	if (dev != NULL && level >= INIT_LEVEL_POST_KERNEL) {
+		init_time_report(dev, cycles, parallel);
+	}
+#endif /* CONFIG_DEVICE_INIT_TIME_REPORT */
+
+#ifdef CONFIG_INIT_TIME_STATS
+	z_init_time_stat_record(entry, level, cycles);
+#endif /* CONFIG_INIT_TIME_STATS */
+
+	return result;
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+#define INIT_WORKERS CONFIG_DEVICE_INIT_PARALLEL_THREADS
+
+static K_KERNEL_STACK_ARRAY_DEFINE(init_worker_stacks, INIT_WORKERS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_workers[INIT_WORKERS];
+static bool init_worker_started[INIT_WORKERS];
+
+/* Device being initialized by each worker thread, NULL if the worker is idle */
+static const struct device *init_worker_dev[INIT_WORKERS];
+static K_MUTEX_DEFINE(init_worker_mutex);
+static K_CONDVAR_DEFINE(init_worker_cond);
+
+/* Must be called with init_worker_mutex held */
+static bool init_in_flight(const struct device *dev)
+{
+	for (size_t i = 0; i < INIT_WORKERS; i++) {
+		if (init_worker_dev[i] == dev) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static int init_wait_cb(const struct device *dev, void *context)
+{
+	ARG_UNUSED(context);
+
+	(void)k_mutex_lock(&init_worker_mutex, K_FOREVER);
+	while (init_in_flight(dev)) {
+		(void)k_condvar_wait(&init_worker_cond, &init_worker_mutex, K_FOREVER);
+	}
+	(void)k_mutex_unlock(&init_worker_mutex);
+
+	return 0;
+}
+
+/* Wait until the devicetree dependencies of @a dev are initialized */
+static void init_wait_deps(const struct device *dev)
+{
+	(void)device_required_foreach(dev, init_wait_cb, NULL);
+}
+
+static void init_worker_entry(void *p1, void *p2, void *p3)
+{
+	const struct init_entry *entry = p1;
+	enum init_level level = (enum init_level)(uintptr_t)p2;
+	size_t slot = (size_t)(uintptr_t)p3;
+
+	/* Dependencies dispatched to other workers may still be initializing */
+	init_wait_deps(entry->dev);
+
+	(void)init_entry_run(entry, level, true);
+
+	(void)k_mutex_lock(&init_worker_mutex, K_FOREVER);
+	init_worker_dev[slot] = NULL;
+	k_condvar_broadcast(&init_worker_cond);
+	(void)k_mutex_unlock(&init_worker_mutex);
+}
+
+static void init_parallel_start(const struct init_entry *entry, enum init_level level)
+{
+	size_t slot = INIT_WORKERS;
+
+	/* Wait for an idle worker */
+	(void)k_mutex_lock(&init_worker_mutex, K_FOREVER);
+	while (true) {
+		for (slot = 0; slot < INIT_WORKERS; slot++) {
+			if (init_worker_dev[slot] == NULL) {
+				break;
+			}
+		}
+
+		if (slot < INIT_WORKERS) {
+			break;
+		}
+
+		(void)k_condvar_wait(&init_worker_cond, &init_worker_mutex, K_FOREVER);
+	}
+	init_worker_dev[slot] = entry->dev;
+	(void)k_mutex_unlock(&init_worker_mutex);
+
+	/* The previous thread of this worker may not have exited yet */
+	if (init_worker_started[slot]) {
+		(void)k_thread_join(&init_workers[slot], K_FOREVER);
+	}
+
+	init_worker_started[slot] = true;
+	k_thread_create(&init_workers[slot], init_worker_stacks[slot],
+			K_KERNEL_STACK_SIZEOF(init_worker_stacks[slot]), init_worker_entry,
+			(void *)entry, (void *)(uintptr_t)level, (void *)(uintptr_t)slot,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+	(void)k_thread_name_set(&init_workers[slot], "device_init");
+}
+
+/* Wait for all the devices initialized by the worker threads */
+static void init_parallel_finish(void)
+{
+	for (size_t i = 0; i < INIT_WORKERS; i++) {
+		if (init_worker_started[i]) {
+			(void)k_thread_join(&init_workers[i], K_FOREVER);
+			init_worker_started[i] = false;
+		}
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -363,21 +522,41 @@ static void z_sys_init_run_level(enum init_level level)
 		__init_end,
 	};
 	const struct init_entry *entry;
+#ifdef CONFIG_DEVICE_INIT_TIME_REPORT
+	uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_DEVICE_INIT_TIME_REPORT */
 
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
 		const struct device *dev = entry->dev;
-		int result = 0;
 
-		sys_trace_sys_init_enter(entry, level);
-		if (dev != NULL) {
-			if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
-				result = do_device_init(dev);
+		/* Worker threads can only be used once the kernel is running */
+		if (level >= INIT_LEVEL_POST_KERNEL && dev != NULL) {
+			if ((dev->flags & DEVICE_FLAG_INIT_PARALLEL) != 0U &&
+			    (dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
+				init_parallel_start(entry, level);
+				continue;
 			}
-		} else {
-			result = entry->init_fn();
+
+			init_wait_deps(dev);
 		}
-		sys_trace_sys_init_exit(entry, level, result);
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
+		(void)init_entry_run(entry, level, false);
+	}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if (level >= INIT_LEVEL_POST_KERNEL) {
+		init_parallel_finish();
+	}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
+#ifdef CONFIG_DEVICE_INIT_TIME_REPORT
+	if (level >= INIT_LEVEL_POST_KERNEL) {
+		printk("init: level %d done in %u us\n", level,
+		       k_cyc_to_us_floor32(k_cycle_get_32() - start));
 	}
+#endif /* CONFIG_DEVICE_INIT_TIME_REPORT */
 }
 
 
@@ -574,6 +753,10 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 	z_mem_manage_boot_finish();
 #endif /* CONFIG_MMU */
 
+#ifdef CONFIG_INIT_TIME_STATS
+	z_init_time_stats_finish();
+#endif /* CONFIG_INIT_TIME_STATS */
+
 #ifdef CONFIG_BOOTARGS
 	extern int main(int, char **);
 
@@ -0,0 +1,123 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <kernel_internal.h>
+
+#define MAX_STATS CONFIG_INIT_TIME_STATS_MAX_ENTRIES
+
+static struct init_time_stat init_stats[MAX_STATS];
+static atomic_t init_stats_count;
+static atomic_t init_stats_dropped;
+
+static const char *const level_names[] = {
+	[Z_INIT_ORD_EARLY] = "EARLY",
+	[Z_INIT_ORD_PRE_KERNEL_1] = "PRE_KERNEL_1",
+	[Z_INIT_ORD_PRE_KERNEL_2] = "PRE_KERNEL_2",
+	[Z_INIT_ORD_POST_KERNEL] = "POST_KERNEL",
+	[Z_INIT_ORD_APPLICATION] = "APPLICATION",
+	[Z_INIT_ORD_SMP] = "SMP",
+};
+
+void z_init_time_stat_record(const struct init_entry *entry, uint8_t level, uint32_t cycles)
+{
+	/* Devices initialized in parallel may complete at the same time */
+	atomic_val_t idx = atomic_inc(&init_stats_count);
+
+	if (idx >= MAX_STATS) {
+		(void)atomic_dec(&init_stats_count);
+		(void)atomic_inc(&init_stats_dropped);
+		return;
+	}
+
+	init_stats[idx].entry = entry;
+	init_stats[idx].level = level;
+	init_stats[idx].cycles = cycles;
+}
+
+void z_init_time_stats_finish(void)
+{
+	size_t count = (size_t)atomic_get(&init_stats_count);
+
+	/* Insertion sort, longest first, only done once at the end of the boot */
+	for (size_t i = 1; i < count; i++) {
+		struct init_time_stat stat = init_stats[i];
+		size_t j = i;
+
+		while (j > 0 && init_stats[j - 1].cycles < stat.cycles) {
+			init_stats[j] = init_stats[j - 1];
+			j--;
+		}
+
+		init_stats[j] = stat;
+	}
+
+	if (IS_ENABLED(CONFIG_INIT_TIME_STATS_REPORT)) {
+		sys_init_time_stats_dump();
+	}
+}
+
+void sys_init_time_stats_foreach(init_time_stat_cb_t cb, void *user_data)
+{
+	size_t count = (size_t)atomic_get(&init_stats_count);
+
+	for (size_t i = 0; i < count; i++) {
+		cb(&init_stats[i], user_data);
+	}
+}
+
+const char *sys_init_level_name(uint8_t level)
+{
+	if (level >= ARRAY_SIZE(level_names)) {
+		return "?";
+	}
+
+	return level_names[level];
+}
+
+static void dump_cb(const struct init_time_stat *stat, void *user_data)
+{
+	uint64_t *level_cycles = user_data;
+
+	level_cycles[stat->level] += stat->cycles;
+
+	if (stat->entry->dev != NULL) {
+		printk("%10u us  %-12s %s\n", k_cyc_to_us_floor32(stat->cycles),
+		       sys_init_level_name(stat->level), stat->entry->dev->name);
+	} else {
+		printk("%10u us  %-12s SYS_INIT %p\n", k_cyc_to_us_floor32(stat->cycles),
+		       sys_init_level_name(stat->level), (void *)stat->entry->init_fn);
+	}
+}
+
+void sys_init_time_stats_dump(void)
+{
+	uint64_t level_cycles[ARRAY_SIZE(level_names)] = {0};
+	uint64_t total = 0U;
+
+	printk("Init time statistics:\n");
+	sys_init_time_stats_foreach(dump_cb, level_cycles);
+
+	for (size_t i = 0; i < ARRAY_SIZE(level_names); i++) {
+		if (level_cycles[i] != 0U) {
+			printk("%10u us  %-12s total\n", (uint32_t)k_cyc_to_us_floor64(level_cycles[i]),
+			       level_names[i]);
+			total += level_cycles[i];
+		}
+	}
+
+	printk("%10u us  sum of all entries\n", (uint32_t)k_cyc_to_us_floor64(total));
+
+	if (atomic_get(&init_stats_dropped) != 0) {
+		printk("%ld init entries not recorded, increase "
+		       "CONFIG_INIT_TIME_STATS_MAX_ENTRIES\n",
+		       (long)atomic_get(&init_stats_dropped));
+	}
+}
@@ -7,6 +7,7 @@
 #include <kswap.h>
 #include <ksched.h>
 #include <ipi.h>
+#include <timeout_q.h>
 
 #ifdef CONFIG_TRACE_SCHED_IPI
 extern void z_trace_sched_ipi(void);
@@ -34,6 +35,10 @@ atomic_val_t ipi_mask_create(struct k_thread *thread)
 	uint32_t  id = _current_cpu->id;
 	struct k_thread *cpu_thread;
 	bool   executable_on_cpu = true;
+#ifdef CONFIG_IPI_OPTIMIZE_SINGLE_TARGET
+	uint32_t  flagged = (uint32_t)atomic_get(&_kernel.pending_ipi);
+	struct k_thread *target_thread = NULL;
+#endif /* CONFIG_IPI_OPTIMIZE_SINGLE_TARGET */
 
 	for (uint32_t i = 0; i < num_cpus; i++) {
 		if (id == i) {
@@ -59,7 +64,25 @@ atomic_val_t ipi_mask_create(struct k_thread *thread)
 		    (((z_sched_prio_cmp(cpu_thread, thread) < 0) &&
 		      (thread_is_preemptible(cpu_thread))) ||
 		     thread_is_metairq(thread)) && executable_on_cpu) {
+#ifdef CONFIG_IPI_OPTIMIZE_SINGLE_TARGET
+			/*
+			 * Only keep the CPU running the lowest priority
+			 * thread, preferring the CPUs that no other thread
+			 * readied by this operation is already heading to.
+			 */
+			bool flagged_cpu = (flagged & BIT(i)) != 0;
+			bool flagged_target = (flagged & ipi_mask) != 0;
+
+			if ((target_thread == NULL) ||
+			    (flagged_target && !flagged_cpu) ||
+			    ((flagged_target == flagged_cpu) &&
+			     (z_sched_prio_cmp(cpu_thread, target_thread) < 0))) {
+				target_thread = cpu_thread;
+				ipi_mask = BIT(i);
+			}
+#else
 			ipi_mask |= BIT(i);
+#endif /* CONFIG_IPI_OPTIMIZE_SINGLE_TARGET */
 		}
 	}
 
@@ -100,6 +123,11 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	/* Another CPU may have armed an earlier timeout on our queue */
+	z_timeout_queue_reprogram();
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
 #ifdef CONFIG_TIMESLICING
 	if (thread_is_sliceable(_current)) {
 		z_time_slice();
@@ -27,6 +27,10 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
+#ifdef CONFIG_HEAP_MAGAZINE
+	(void)atomic_set(&heap->waiters, 0);
+	(void)memset(heap->cache, 0, sizeof(heap->cache));
+#endif
 	sys_heap_init(&heap->heap, mem, bytes);
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
@@ -74,6 +78,239 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+#ifdef CONFIG_HEAP_MAGAZINE
+/*
+ * Small blocks are cached per CPU and size class.  A magazine is only
+ * ever used by the CPU owning it, except when the thread migrates
+ * before taking the lock, and when all magazines are drained because
+ * the heap ran out of memory: its lock is therefore uncontended in the
+ * common case.  The heap lock is always taken after a magazine lock.
+ */
+
+#define MAG_BATCH MAX(CONFIG_HEAP_MAGAZINE_DEPTH / 2, 1)
+#define MAG_MAX_BLOCK_SIZE Z_HEAP_MAGAZINE_BLOCK_SIZE(CONFIG_HEAP_MAGAZINE_CLASSES - 1)
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#define MAG_STAT_INC(mag, stat) ((mag)->stat++)
+#else
+#define MAG_STAT_INC(mag, stat) do { } while (false)
+#endif
+
+/* Smallest size class with blocks of at least the requested size */
+static int alloc_class(size_t bytes)
+{
+	if ((bytes == 0U) || (bytes > MAG_MAX_BLOCK_SIZE)) {
+		return -1;
+	}
+
+	for (int c = 0; c < CONFIG_HEAP_MAGAZINE_CLASSES - 1; c++) {
+		if (bytes <= Z_HEAP_MAGAZINE_BLOCK_SIZE(c)) {
+			return c;
+		}
+	}
+
+	return CONFIG_HEAP_MAGAZINE_CLASSES - 1;
+}
+
+/* Size class a freed block can be reused for without wasting half of it */
+static int free_class(size_t usable)
+{
+	for (int c = CONFIG_HEAP_MAGAZINE_CLASSES - 1; c >= 0; c--) {
+		if (usable >= Z_HEAP_MAGAZINE_BLOCK_SIZE(c)) {
+			return (usable < 2 * Z_HEAP_MAGAZINE_BLOCK_SIZE(c)) ? c : -1;
+		}
+	}
+
+	return -1;
+}
+
+static struct z_heap_cpu_cache *cache_lock(struct k_heap *heap, k_spinlock_key_t *key)
+{
+	struct z_heap_cpu_cache *cache;
+	unsigned int id = 0U;
+
+#ifdef CONFIG_SMP
+	/* The thread may still migrate before the lock is taken: that
+	 * only makes it use the magazines of another CPU.
+	 */
+	unsigned int irq = arch_irq_lock();
+
+	id = arch_curr_cpu()->id;
+	arch_irq_unlock(irq);
+#endif
+
+	cache = &heap->cache[id];
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+
+static void *magazine_alloc(struct k_heap *heap, size_t bytes)
+{
+	int c = alloc_class(bytes);
+	struct z_heap_cpu_cache *cache;
+	struct z_heap_magazine *mag;
+	k_spinlock_key_t key;
+	void *ret;
+
+	if (c < 0) {
+		return NULL;
+	}
+
+	cache = cache_lock(heap, &key);
+	mag = &cache->mags[c];
+
+	if (mag->count > 0U) {
+		MAG_STAT_INC(mag, hits);
+		ret = mag->blocks[--mag->count];
+	} else {
+		size_t block_size = Z_HEAP_MAGAZINE_BLOCK_SIZE(c);
+		k_spinlock_key_t heap_key = k_spin_lock(&heap->lock);
+
+		MAG_STAT_INC(mag, misses);
+
+		/* One block for the caller, a batch for the next ones */
+		ret = sys_heap_alloc(&heap->heap, block_size);
+		while ((ret != NULL) && (mag->count < MAG_BATCH)) {
+			void *block = sys_heap_alloc(&heap->heap, block_size);
+
+			if (block == NULL) {
+				break;
+			}
+			mag->blocks[mag->count++] = block;
+		}
+
+		k_spin_unlock(&heap->lock, heap_key);
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return ret;
+}
+
+void *z_heap_magazine_alloc(struct k_heap *heap, size_t bytes)
+{
+	return magazine_alloc(heap, bytes);
+}
+
+static bool magazine_free(struct k_heap *heap, void *mem)
+{
+	/* The size of a block in use doesn't change under our feet */
+	int c = free_class(sys_heap_usable_size(&heap->heap, mem));
+	struct z_heap_cpu_cache *cache;
+	struct z_heap_magazine *mag;
+	k_spinlock_key_t key;
+
+	if (c < 0) {
+		return false;
+	}
+
+	cache = cache_lock(heap, &key);
+
+	/* Counted waiters drain the magazines after announcing
+	 * themselves: from then on, memory must go back to the heap.
+	 */
+	if (atomic_get(&heap->waiters) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		return false;
+	}
+
+	mag = &cache->mags[c];
+	if (mag->count == CONFIG_HEAP_MAGAZINE_DEPTH) {
+		k_spinlock_key_t heap_key = k_spin_lock(&heap->lock);
+
+		MAG_STAT_INC(mag, flushes);
+
+		/* Keep the most recently freed blocks, likely still in the
+		 * data cache.
+		 */
+		for (int i = 0; i < MAG_BATCH; i++) {
+			sys_heap_free(&heap->heap, mag->blocks[i]);
+		}
+		k_spin_unlock(&heap->lock, heap_key);
+
+		mag->count -= MAG_BATCH;
+		(void)memmove(&mag->blocks[0], &mag->blocks[MAG_BATCH],
+			      mag->count * sizeof(mag->blocks[0]));
+	}
+	mag->blocks[mag->count++] = mem;
+
+	k_spin_unlock(&cache->lock, key);
+
+	return true;
+}
+
+void z_heap_magazine_drain(struct k_heap *heap)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct z_heap_cpu_cache *cache = &heap->cache[i];
+		k_spinlock_key_t cache_key = k_spin_lock(&cache->lock);
+		k_spinlock_key_t heap_key = k_spin_lock(&heap->lock);
+
+		for (int c = 0; c < CONFIG_HEAP_MAGAZINE_CLASSES; c++) {
+			struct z_heap_magazine *mag = &cache->mags[c];
+
+			while (mag->count > 0U) {
+				sys_heap_free(&heap->heap, mag->blocks[--mag->count]);
+			}
+		}
+
+		k_spin_unlock(&heap->lock, heap_key);
+		k_spin_unlock(&cache->lock, cache_key);
+	}
+}
+
+/*
+ * Called with the heap lock held when an allocation failed: give the
+ * blocks held by all magazines back to the heap so that the caller can
+ * retry.  A caller about to wait is counted first, so that frees which
+ * race with the drain don't hide memory from it in a magazine.
+ */
+static void magazine_reclaim(struct k_heap *heap, k_spinlock_key_t *key, bool wait)
+{
+	if (wait) {
+		atomic_inc(&heap->waiters);
+	}
+
+	k_spin_unlock(&heap->lock, *key);
+	z_heap_magazine_drain(heap);
+	*key = k_spin_lock(&heap->lock);
+}
+
+static void magazine_wait_done(struct k_heap *heap)
+{
+	atomic_dec(&heap->waiters);
+}
+#else
+static inline void *magazine_alloc(struct k_heap *heap, size_t bytes)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(bytes);
+
+	return NULL;
+}
+
+static inline bool magazine_free(struct k_heap *heap, void *mem)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(mem);
+
+	return false;
+}
+
+static inline void magazine_reclaim(struct k_heap *heap, k_spinlock_key_t *key, bool wait)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(key);
+	ARG_UNUSED(wait);
+}
+
+static inline void magazine_wait_done(struct k_heap *heap)
+{
+	ARG_UNUSED(heap);
+}
+#endif /* CONFIG_HEAP_MAGAZINE */
+
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
 static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
@@ -81,6 +318,8 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 				 sys_heap_allocator_t *sys_heap_allocator)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
+	bool wait = !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+	bool reclaim = IS_ENABLED(CONFIG_HEAP_MAGAZINE);
 	void *ret = NULL;
 
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
@@ -92,6 +331,12 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	while (ret == NULL) {
 		ret = sys_heap_allocator(&heap->heap, align, bytes);
 
+		if ((ret == NULL) && reclaim) {
+			reclaim = false;
+			magazine_reclaim(heap, &key, wait);
+			continue;
+		}
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -113,6 +358,11 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	}
 
 	k_spin_unlock(&heap->lock, key);
+
+	if (IS_ENABLED(CONFIG_HEAP_MAGAZINE) && !reclaim && wait) {
+		magazine_wait_done(heap);
+	}
+
 	return ret;
 }
 
@@ -120,8 +370,12 @@ void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, heap, timeout);
 
-	void *ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
-					sys_heap_noalign_alloc);
+	void *ret = magazine_alloc(heap, bytes);
+
+	if (ret == NULL) {
+		ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
+					  sys_heap_noalign_alloc);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, ret);
 
@@ -172,6 +426,8 @@ void *k_heap_calloc(struct k_heap *heap, size_t num, size_t size, k_timeout_t ti
 void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t timeout)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
+	bool wait = !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+	bool reclaim = IS_ENABLED(CONFIG_HEAP_MAGAZINE);
 	void *ret = NULL;
 
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
@@ -183,6 +439,12 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 	while (ret == NULL) {
 		ret = sys_heap_realloc(&heap->heap, ptr, bytes);
 
+		if ((ret == NULL) && (bytes != 0U) && reclaim) {
+			reclaim = false;
+			magazine_reclaim(heap, &key, wait);
+			continue;
+		}
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -196,11 +458,21 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, realloc, heap, ptr, bytes, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
+
+	if (IS_ENABLED(CONFIG_HEAP_MAGAZINE) && !reclaim && wait) {
+		magazine_wait_done(heap);
+	}
+
 	return ret;
 }
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+	if ((mem != NULL) && magazine_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
@@ -5,9 +5,11 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
+#include <kernel_internal.h>
 
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
@@ -34,13 +36,33 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	}
 	__align = align | sizeof(heap_ref);
 
+	mem = NULL;
+#ifdef CONFIG_HEAP_MAGAZINE
+	/* Magazine blocks are as aligned as sys_heap_noalign_alloc() ones */
+	if (align == 0U) {
+		mem = z_heap_magazine_alloc(heap, size);
+	}
+#endif
+
 	/*
 	 * No point calling k_heap_malloc/k_heap_aligned_alloc with K_NO_WAIT.
 	 * Better bypass them and go directly to sys_heap_*() instead.
 	 */
-	key = k_spin_lock(&heap->lock);
-	mem = sys_heap_allocator(&heap->heap, __align, size);
-	k_spin_unlock(&heap->lock, key);
+	if (mem == NULL) {
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+		k_spin_unlock(&heap->lock, key);
+	}
+
+#ifdef CONFIG_HEAP_MAGAZINE
+	/* Memory may still be held by the magazines of the CPUs */
+	if (mem == NULL) {
+		z_heap_magazine_drain(heap);
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+		k_spin_unlock(&heap->lock, key);
+	}
+#endif
 
 	if (mem == NULL) {
 		return NULL;
@@ -55,10 +77,146 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	return mem;
 }
 
+#if defined(CONFIG_HEAP_MEM_SLABS) && (K_HEAP_MEM_POOL_SIZE > 0)
+
+#define SLAB_CLASS(size) \
+	{ .block_size = (size), .num_blocks = CONFIG_HEAP_MEM_SLAB_BLOCKS_##size }
+#define SLAB_BYTES(size) ((size) * CONFIG_HEAP_MEM_SLAB_BLOCKS_##size)
+#define SLAB_REGION_SIZE \
+	(SLAB_BYTES(16) + SLAB_BYTES(32) + SLAB_BYTES(64) + SLAB_BYTES(128) + SLAB_BYTES(256))
+
+BUILD_ASSERT(SLAB_REGION_SIZE > 0, "no k_malloc() slab blocks configured");
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#define SLAB_STAT_ADD(cls, stat, n) ((void)atomic_add(&(cls)->stat, (atomic_val_t)(n)))
+#else
+#define SLAB_STAT_ADD(cls, stat, n) do { } while (false)
+#endif
+
+struct heap_slab {
+	struct k_mem_slab slab;
+	size_t block_size;
+	uint32_t num_blocks;
+	/* End of the blocks of this class in the slab region */
+	char *end;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	atomic_t allocs;
+	atomic_t wasted_bytes;
+	atomic_t fallbacks;
+#endif
+};
+
+/* All slabs share one region, so that k_free() can tell their blocks apart */
+static char __noinit __aligned(sizeof(void *)) slab_region[SLAB_REGION_SIZE];
+
+static struct heap_slab heap_slabs[] = {
+	SLAB_CLASS(16), SLAB_CLASS(32), SLAB_CLASS(64), SLAB_CLASS(128), SLAB_CLASS(256),
+};
+
+static int heap_slabs_init(void)
+{
+	char *buffer = slab_region;
+
+	ARRAY_FOR_EACH_PTR(heap_slabs, cls) {
+		if (cls->num_blocks > 0U) {
+			(void)k_mem_slab_init(&cls->slab, buffer, cls->block_size,
+					      cls->num_blocks);
+		}
+		buffer += cls->block_size * cls->num_blocks;
+		cls->end = buffer;
+	}
+
+	return 0;
+}
+
+SYS_INIT(heap_slabs_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+static void *slab_alloc(size_t size)
+{
+	void *mem;
+
+	if (size == 0U) {
+		return NULL;
+	}
+
+	ARRAY_FOR_EACH_PTR(heap_slabs, cls) {
+		if ((size > cls->block_size) || (cls->num_blocks == 0U)) {
+			continue;
+		}
+
+		/* Fails as well before the slabs are initialized */
+		if (k_mem_slab_alloc(&cls->slab, &mem, K_NO_WAIT) != 0) {
+			SLAB_STAT_ADD(cls, fallbacks, 1);
+			return NULL;
+		}
+
+		SLAB_STAT_ADD(cls, allocs, 1);
+		SLAB_STAT_ADD(cls, wasted_bytes, cls->block_size - size);
+		return mem;
+	}
+
+	return NULL;
+}
+
+static struct heap_slab *slab_find(void *ptr)
+{
+	char *p = ptr;
+
+	if ((p < slab_region) || (p >= &slab_region[SLAB_REGION_SIZE])) {
+		return NULL;
+	}
+
+	ARRAY_FOR_EACH_PTR(heap_slabs, cls) {
+		if (p < cls->end) {
+			return cls;
+		}
+	}
+
+	return NULL;
+}
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+int k_malloc_slab_stats_get(unsigned int size_class, struct k_malloc_slab_stats *stats)
+{
+	struct heap_slab *cls;
+
+	if ((size_class >= ARRAY_SIZE(heap_slabs)) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	cls = &heap_slabs[size_class];
+	stats->block_size = cls->block_size;
+	stats->num_blocks = cls->num_blocks;
+	stats->num_used = (cls->num_blocks > 0U) ? k_mem_slab_num_used_get(&cls->slab) : 0U;
+	stats->allocs = (uint32_t)atomic_get(&cls->allocs);
+	stats->wasted_bytes = (uint32_t)atomic_get(&cls->wasted_bytes);
+	stats->fallbacks = (uint32_t)atomic_get(&cls->fallbacks);
+
+	return 0;
+}
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+#else
+static inline void *slab_alloc(size_t size)
+{
+	ARG_UNUSED(size);
+
+	return NULL;
+}
+#endif /* CONFIG_HEAP_MEM_SLABS && K_HEAP_MEM_POOL_SIZE > 0 */
+
 void k_free(void *ptr)
 {
 	struct k_heap **heap_ref;
 
+#if defined(CONFIG_HEAP_MEM_SLABS) && (K_HEAP_MEM_POOL_SIZE > 0)
+	struct heap_slab *cls = slab_find(ptr);
+
+	if (cls != NULL) {
+		k_mem_slab_free(&cls->slab, ptr);
+		return;
+	}
+#endif
+
 	if (ptr != NULL) {
 		heap_ref = ptr;
 		--heap_ref;
@@ -92,7 +250,11 @@ void *k_malloc(size_t size)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_malloc, _SYSTEM_HEAP);
 
-	void *ret = z_alloc_helper(_SYSTEM_HEAP, 0, size, sys_heap_noalign_alloc);
+	void *ret = slab_alloc(size);
+
+	if (ret == NULL) {
+		ret = z_alloc_helper(_SYSTEM_HEAP, 0, size, sys_heap_noalign_alloc);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_malloc, _SYSTEM_HEAP, ret);
 
@@ -135,6 +297,26 @@ void *k_realloc(void *ptr, size_t size)
 	if (ptr == NULL) {
 		return k_malloc(size);
 	}
+
+#ifdef CONFIG_HEAP_MEM_SLABS
+	struct heap_slab *cls = slab_find(ptr);
+
+	if (cls != NULL) {
+		/* Slab blocks can't be resized: keep or move the block */
+		if (size <= cls->block_size) {
+			return ptr;
+		}
+
+		ret = k_malloc(size);
+		if (ret != NULL) {
+			(void)memcpy(ret, ptr, cls->block_size);
+			k_mem_slab_free(&cls->slab, ptr);
+		}
+
+		return ret;
+	}
+#endif
+
 	heap_ref = ptr;
 	ptr = --heap_ref;
 	heap = *heap_ref;
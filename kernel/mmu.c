@@ -1275,7 +1275,8 @@ static inline void do_backing_store_page_out(uintptr_t location)
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 }
 
-#if defined(CONFIG_SMP) && defined(CONFIG_DEMAND_PAGING_ALLOW_IRQ)
+#if defined(CONFIG_DEMAND_PAGING_ALLOW_IRQ) && \
+	(defined(CONFIG_SMP) || defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP))
 /*
  * SMP support is very simple. Some resources such as the scratch page could
  * be made per CPU, backing store driver execution be confined to the faulting
@@ -1284,6 +1285,9 @@ static inline void do_backing_store_page_out(uintptr_t location)
  * is inherently slow and whose access is most likely serialized anyway.
  * So let's simply enforce global demand paging serialization across all CPUs
  * with a mutex as there is no real gain from added parallelism here.
+ *
+ * The same mutex is used on UP with CONFIG_DEMAND_PAGING_ALLOW_SLEEP so
+ * that the backing store may sleep while a transfer is in flight.
  */
 static K_MUTEX_DEFINE(z_mm_paging_lock);
 #endif
@@ -1387,7 +1391,7 @@ static int do_mem_evict(void *addr)
 	__ASSERT(!k_is_in_isr(),
 		 "%s is unavailable in ISRs with CONFIG_DEMAND_PAGING_ALLOW_IRQ",
 		 __func__);
-#ifdef CONFIG_SMP
+#if defined(CONFIG_SMP) || defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
 	k_mutex_lock(&z_mm_paging_lock, K_FOREVER);
 #else
 	k_sched_lock();
@@ -1425,7 +1429,7 @@ static int do_mem_evict(void *addr)
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-#ifdef CONFIG_SMP
+#if defined(CONFIG_SMP) || defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
 	k_mutex_unlock(&z_mm_paging_lock);
 #else
 	k_sched_unlock();
@@ -1473,7 +1477,7 @@ int k_mem_page_frame_evict(uintptr_t phys)
 	__ASSERT(!k_is_in_isr(),
 		 "%s is unavailable in ISRs with CONFIG_DEMAND_PAGING_ALLOW_IRQ",
 		 __func__);
-#ifdef CONFIG_SMP
+#if defined(CONFIG_SMP) || defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
 	k_mutex_lock(&z_mm_paging_lock, K_FOREVER);
 #else
 	k_sched_lock();
@@ -1508,7 +1512,7 @@ int k_mem_page_frame_evict(uintptr_t phys)
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-#ifdef CONFIG_SMP
+#if defined(CONFIG_SMP) || defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
 	k_mutex_unlock(&z_mm_paging_lock);
 #else
 	k_sched_unlock();
@@ -1576,6 +1580,21 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+static inline void paging_stats_prefetch_inc(struct k_thread *faulting_thread)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.prefetch.pages++;
+
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.prefetch.pages++;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
 static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 {
 	struct k_mem_page_frame *pf;
@@ -1610,6 +1629,69 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#if CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0
+/*
+ * Page in the paged out pages following a faulting page, as long as free
+ * page frames are available: pages are never evicted to prefetch others.
+ * Called with z_mm_lock held, which may be released during the page-ins.
+ */
+static void do_page_prefetch(void *addr, struct k_thread *faulting_thread,
+			     k_spinlock_key_t *key)
+{
+	struct k_mem_page_frame *pf;
+	uintptr_t location, unused;
+	bool dirty;
+	int ret;
+	uint8_t *pos = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr),
+						  CONFIG_MMU_PAGE_SIZE));
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_PREFETCH_PAGES; i++) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+
+		if (arch_page_location_get(pos, &location) != ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+#ifdef CONFIG_DEMAND_MAPPING
+		/* Anonymous memory not touched yet is left to page faults */
+		if ((location == ARCH_UNPAGED_ANON_ZERO) ||
+		    (location == ARCH_UNPAGED_ANON_UNINIT)) {
+			break;
+		}
+#endif /* CONFIG_DEMAND_MAPPING */
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			break;
+		}
+
+		dirty = false;
+		ret = page_frame_prepare_locked(pf, &dirty, true, &unused);
+		__ASSERT(ret == 0, "failed to prepare page frame");
+		(void)ret;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key = k_spin_lock(&z_mm_lock);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
+		frame_mapped_set(pf, pos);
+
+		arch_mem_page_in(pos, k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, location);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
+			k_mem_paging_eviction_add(pf);
+		}
+
+		paging_stats_prefetch_inc(faulting_thread);
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0 */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1652,7 +1734,8 @@ static bool do_page_fault(void *addr, bool pin)
 	 * allowing k_mem_paging_backing_store_page_out() and
 	 * k_mem_paging_backing_store_page_in() to also sleep and allow
 	 * other threads to run (such as in the case where the transfer is
-	 * async DMA) is not supported on UP. Even if limited to thread
+	 * async DMA) is only available on UP with
+	 * CONFIG_DEMAND_PAGING_ALLOW_SLEEP. Even if limited to thread
 	 * context, arbitrary memory access triggering exceptions that put
 	 * a thread to sleep on a contended page fault operation will break
 	 * scheduling assumptions of cooperative threads or threads that
@@ -1666,7 +1749,7 @@ static bool do_page_fault(void *addr, bool pin)
 	 * As a result, sleeping/rescheduling in the SMP case is fine.
 	 */
 	__ASSERT(!k_is_in_isr(), "ISR page faults are forbidden");
-#ifdef CONFIG_SMP
+#if defined(CONFIG_SMP) || defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
 	k_mutex_lock(&z_mm_paging_lock, K_FOREVER);
 #else
 	k_sched_lock();
@@ -1751,10 +1834,16 @@ static bool do_page_fault(void *addr, bool pin)
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
+
+#if CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0
+	if (!pin) {
+		do_page_prefetch(addr, faulting_thread, &key);
+	}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0 */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-#ifdef CONFIG_SMP
+#if defined(CONFIG_SMP) || defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
 	k_mutex_unlock(&z_mm_paging_lock);
 #else
 	k_sched_unlock();
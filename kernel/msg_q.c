@@ -40,6 +40,40 @@ static inline bool handle_poll_events(struct k_msgq *msgq)
 #endif /* CONFIG_POLL */
 }
 
+/* Copy @a num messages into the ring buffer, in at most two chunks */
+static void msgq_copy_in(struct k_msgq *msgq, const char *data, uint32_t num)
+{
+	size_t len = num * msgq->msg_size;
+	size_t to_end = msgq->buffer_end - msgq->write_ptr;
+
+	if (len < to_end) {
+		(void)memcpy(msgq->write_ptr, data, len);
+		msgq->write_ptr += len;
+	} else {
+		(void)memcpy(msgq->write_ptr, data, to_end);
+		(void)memcpy(msgq->buffer_start, data + to_end, len - to_end);
+		msgq->write_ptr = msgq->buffer_start + (len - to_end);
+	}
+	msgq->used_msgs += num;
+}
+
+/* Copy @a num messages out of the ring buffer, in at most two chunks */
+static void msgq_copy_out(struct k_msgq *msgq, char *data, uint32_t num)
+{
+	size_t len = num * msgq->msg_size;
+	size_t to_end = msgq->buffer_end - msgq->read_ptr;
+
+	if (len < to_end) {
+		(void)memcpy(data, msgq->read_ptr, len);
+		msgq->read_ptr += len;
+	} else {
+		(void)memcpy(data, msgq->read_ptr, to_end);
+		(void)memcpy(data + to_end, msgq->buffer_start, len - to_end);
+		msgq->read_ptr = msgq->buffer_start + (len - to_end);
+	}
+	msgq->used_msgs -= num;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -298,6 +332,163 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_put_n(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *src = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t done = 0U;
+	uint32_t num;
+	int result;
+	bool resched = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_n, msgq, timeout);
+
+	if (num_msgs == 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_n, msgq, timeout, 0);
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	/* Threads only wait to read on an empty queue: serve them first */
+	while ((done < num_msgs) && (msgq->used_msgs < msgq->max_msgs)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(pending_thread->base.swap_data,
+			     src + (done * msgq->msg_size), msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+		done++;
+	}
+
+	num = MIN(num_msgs - done, msgq->max_msgs - msgq->used_msgs);
+	if (num > 0U) {
+		msgq_copy_in(msgq, src + (done * msgq->msg_size), num);
+		done += num;
+		resched = handle_poll_events(msgq) || resched;
+	}
+
+	if (done > 0U) {
+		result = (int)done;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_n, msgq, timeout);
+
+		/* Queue full: wait until the first message has been taken */
+		_current->base.swap_data = (void *)src;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = (result == 0) ? 1 : result;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_n, msgq, timeout, result);
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_n, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_n(struct k_msgq *msgq, const void *data,
+				      uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_n(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_put_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_get_n(struct k_msgq *msgq, void *data, uint32_t max_msgs,
+			k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t num;
+	int result;
+	bool resched = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_n, msgq, timeout);
+
+	if (max_msgs == 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_n, msgq, timeout, 0);
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	num = MIN(max_msgs, msgq->used_msgs);
+	if (num > 0U) {
+		msgq_copy_out(msgq, data, num);
+
+		/* Threads only wait to write on a full queue: refill from them */
+		while (msgq->used_msgs < msgq->max_msgs) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+			if (pending_thread == NULL) {
+				break;
+			}
+
+			msgq_copy_in(msgq, pending_thread->base.swap_data, 1U);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
+		}
+		result = (int)num;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_n, msgq, timeout);
+
+		/* Queue empty: wait for one message to be handed over */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = (result == 0) ? 1 : result;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_n, msgq, timeout, result);
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_n, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_n(struct k_msgq *msgq, void *data,
+				      uint32_t max_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, max_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_n(msgq, data, max_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_get_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -102,6 +102,101 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#if CONFIG_MUTEX_PI_CHAIN_DEPTH > 0
+/*
+ * Propagate the priority a mutex owner has been raised to along the chain
+ * of mutexes it is waiting for, i.e. to the owner of the mutex it is pended
+ * on, then to the owner of the mutex that one is pended on, etc. The depth
+ * limit also bounds the walk in case of a deadlock cycle.
+ */
+static bool boost_chain(struct k_thread *owner, int32_t prio)
+{
+	bool resched = false;
+
+	for (int i = 0; i < CONFIG_MUTEX_PI_CHAIN_DEPTH; i++) {
+		struct k_mutex *next = owner->pended_mutex;
+		int32_t new_prio;
+
+		if ((next == NULL) || (next->owner == NULL)) {
+			break;
+		}
+
+		new_prio = new_prio_for_inheritance(prio, next->owner->base.prio);
+		if (!z_is_prio_higher(new_prio, next->owner->base.prio)) {
+			break;
+		}
+
+		LOG_DBG("adjusting prio up on chained mutex %p", next);
+
+		resched = adjust_owner_prio(next, new_prio) || resched;
+		owner = next->owner;
+	}
+
+	return resched;
+}
+#endif /* CONFIG_MUTEX_PI_CHAIN_DEPTH */
+
+#if CONFIG_MUTEX_ADAPTIVE_SPIN_US > 0
+static bool owner_running(struct k_thread *owner)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (*(struct k_thread *volatile *)&_kernel.cpus[i].current == owner) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Busy wait, without holding the lock, while the mutex is owned by a thread
+ * running on another CPU, as it is likely to be unlocked sooner than two
+ * context switches would take. Only done when there are no waiters, as the
+ * mutex is handed over to the first waiter on unlock. Returns with the lock
+ * held again, true if the mutex can be taken.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	struct k_thread *owner = mutex->owner;
+	uint32_t budget = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	uint32_t start;
+
+	if ((z_waitq_head(&mutex->wait_q) != NULL) || !owner_running(owner)) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	start = k_cycle_get_32();
+	do {
+		arch_spin_relax();
+	} while ((*(volatile uint32_t *)&mutex->lock_count != 0U) &&
+		 (*(struct k_thread *volatile *)&mutex->owner == owner) &&
+		 owner_running(owner) &&
+		 ((k_cycle_get_32() - start) < budget));
+
+	*key = k_spin_lock(&lock);
+
+	return mutex->lock_count == 0U;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN_US */
+
+static void mutex_take(struct k_mutex *mutex)
+{
+	mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
+				_current->base.prio :
+				mutex->owner_orig_prio;
+
+	mutex->lock_count++;
+	mutex->owner = _current;
+
+	LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
+		_current, mutex, mutex->lock_count,
+		mutex->owner_orig_prio);
+}
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -115,18 +210,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	key = k_spin_lock(&lock);
 
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
-
-		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
-					_current->base.prio :
-					mutex->owner_orig_prio;
-
-		mutex->lock_count++;
-		mutex->owner = _current;
-
-		LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
-			_current, mutex, mutex->lock_count,
-			mutex->owner_orig_prio);
-
+		mutex_take(mutex);
 		k_spin_unlock(&lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
@@ -142,6 +226,17 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#if CONFIG_MUTEX_ADAPTIVE_SPIN_US > 0
+	if (mutex_spin(mutex, &key)) {
+		mutex_take(mutex);
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN_US */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -153,6 +248,11 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
+#if CONFIG_MUTEX_PI_CHAIN_DEPTH > 0
+	resched = boost_chain(mutex->owner, new_prio) || resched;
+	_current->pended_mutex = mutex;
+#endif /* CONFIG_MUTEX_PI_CHAIN_DEPTH */
+
 	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
 
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
@@ -171,6 +271,14 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#if CONFIG_MUTEX_PI_CHAIN_DEPTH > 0
+	/*
+	 * Owners further down the chain keep their raised priority until they
+	 * unlock the mutexes they hold, as their other waiters are not known.
+	 */
+	_current->pended_mutex = NULL;
+#endif /* CONFIG_MUTEX_PI_CHAIN_DEPTH */
+
 	/*
 	 * Check if mutex was unlocked after this thread was unpended.
 	 * If so, skip adjusting owner's priority down.
@@ -268,6 +376,9 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		 * adjust its priority
 		 */
 		mutex->owner_orig_prio = new_owner->base.prio;
+#if CONFIG_MUTEX_PI_CHAIN_DEPTH > 0
+		new_owner->pended_mutex = NULL;
+#endif /* CONFIG_MUTEX_PI_CHAIN_DEPTH */
 		arch_thread_return_value_set(new_owner, 0);
 		z_ready_thread(new_owner);
 		z_reschedule(&lock, key);
@@ -292,6 +403,46 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 #include <zephyr/syscalls/k_mutex_unlock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYS_MUTEX_FAST
+/*
+ * Used by sys_mutex, whose owner may have locked it with atomic ops only.
+ * The swap of the sys_mutex value is done under the mutex lock, so that
+ * it is atomic with the ownership change of the kernel mutex.
+ */
+int z_mutex_adopt(struct k_mutex *mutex, struct k_thread *owner, atomic_t *val,
+		  atomic_val_t old_val, atomic_val_t new_val)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (mutex->lock_count != 0U) {
+		ret = -EBUSY;
+	} else if (!atomic_cas(val, old_val, new_val)) {
+		ret = -EAGAIN;
+	} else {
+		mutex->owner = owner;
+		mutex->owner_orig_prio = owner->base.prio;
+		mutex->lock_count = 1U;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+void z_mutex_cas_if_unlocked(struct k_mutex *mutex, atomic_t *val, atomic_val_t old_val,
+			     atomic_val_t new_val)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (mutex->lock_count == 0U) {
+		(void)atomic_cas(val, old_val, new_val);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_SYS_MUTEX_FAST */
+
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static int init_mutex_obj_core_list(void)
 {
@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -445,6 +446,8 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_SET) {
+			retcode = signal_set(event, state);
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -812,3 +815,134 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+/* must be called with interrupts locked */
+static void set_wake(struct k_poll_set *set)
+{
+	struct k_thread *thread = z_unpend_first_thread(&set->wait_q);
+
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+}
+
+/* must be called with interrupts locked */
+static int signal_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set, poller);
+
+	/* The event has been removed from the object's list by the caller */
+	sys_dlist_append(&set->ready, &event->_node);
+	set_wake(set);
+
+	return 0;
+}
+
+/*
+ * Register an event that is not in any list with its object, or move it to
+ * the ready list if its condition is met. Must be called with interrupts
+ * locked, returns true if the event is ready.
+ */
+static bool set_arm_event(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if (is_condition_met(event, &state)) {
+		set_event_ready(event, state);
+		sys_dlist_append(&set->ready, &event->_node);
+		return true;
+	}
+
+	register_event(event, &set->poller);
+
+	return false;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->rearm);
+	z_waitq_init(&set->wait_q);
+}
+
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	__ASSERT(event->mode == K_POLL_MODE_NOTIFY_ONLY,
+		 "only NOTIFY_ONLY mode is supported\n");
+
+	sys_dnode_init(&event->_node);
+
+	if (set_arm_event(set, event)) {
+		set_wake(set);
+	}
+
+	z_reschedule(&lock, key);
+}
+
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ARG_UNUSED(set);
+
+	/* Either registered with its object, ready or to be rearmed */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+
+	event->poller = NULL;
+
+	k_spin_unlock(&lock, key);
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready, int num_ready,
+		    k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+	int rc = 0;
+	int count = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL ready\n");
+	__ASSERT(num_ready > 0, "<=0 ready\n");
+
+	key = k_spin_lock(&lock);
+
+	/* Only the events returned by the previous wait have to be registered */
+	while ((node = sys_dlist_get(&set->rearm)) != NULL) {
+		(void)set_arm_event(set, CONTAINER_OF(node, struct k_poll_event, _node));
+		k_spin_unlock(&lock, key);
+		key = k_spin_lock(&lock);
+	}
+
+	if (sys_dlist_is_empty(&set->ready)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&lock);
+	}
+
+	while (count < num_ready && (node = sys_dlist_get(&set->ready)) != NULL) {
+		ready[count++] = CONTAINER_OF(node, struct k_poll_event, _node);
+		sys_dlist_append(&set->rearm, node);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (count == 0) {
+		return (rc < 0) ? rc : -EAGAIN;
+	}
+
+	return count;
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Lock-free bounded multi-producer, multi-consumer ring queue.
+ *
+ * Entries are added and removed with the bounded MPMC algorithm by
+ * Dmitry Vyukov: every slot carries a sequence number telling whether
+ * it is ready to be written or read at a given position, and producers
+ * and consumers claim positions with a compare-and-swap on the tail and
+ * head counters respectively.
+ *
+ * The spinlock and wait queues are only used in the slow paths: when a
+ * caller has to block, and when a waiter has to be woken up.  Waiters
+ * announce themselves in a counter before the final retry under the
+ * lock, so a fast path that completes concurrently either is seen by
+ * the retry or sees the counter and wakes the waiter.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <zephyr/internal/syscall_handler.h>
+
+/* Positions and sequence numbers wrap around: do the arithmetic unsigned */
+static inline atomic_val_t pos_add(atomic_val_t pos, unsigned long n)
+{
+	return (atomic_val_t)((unsigned long)pos + n);
+}
+
+/* Signed distance between a slot sequence number and a position */
+static inline atomic_val_t seq_diff(atomic_val_t seq, atomic_val_t pos)
+{
+	return (atomic_val_t)((unsigned long)seq - (unsigned long)pos);
+}
+
+static inline atomic_val_t slot_seq(struct k_ringq_slot *slot, unsigned long idx)
+{
+	return pos_add(atomic_get(&slot->seq), idx);
+}
+
+static inline void slot_seq_set(struct k_ringq_slot *slot, unsigned long idx,
+				atomic_val_t seq)
+{
+	(void)atomic_set(&slot->seq, seq_diff(seq, (atomic_val_t)idx));
+}
+
+static bool try_put(struct k_ringq *ringq, void *data)
+{
+	atomic_val_t pos = atomic_get(&ringq->tail);
+	struct k_ringq_slot *slot;
+	unsigned long idx;
+
+	for (;;) {
+		atomic_val_t diff;
+
+		idx = (unsigned long)pos & ringq->mask;
+		slot = &ringq->slots[idx];
+		diff = seq_diff(slot_seq(slot, idx), pos);
+
+		if (diff == 0) {
+			if (atomic_cas(&ringq->tail, pos, pos_add(pos, 1))) {
+				break;
+			}
+			pos = atomic_get(&ringq->tail);
+		} else if (diff < 0) {
+			/* Slot still holds the entry of the previous lap */
+			return false;
+		} else {
+			pos = atomic_get(&ringq->tail);
+		}
+	}
+
+	slot->data = data;
+	slot_seq_set(slot, idx, pos_add(pos, 1));
+
+	return true;
+}
+
+static bool try_get(struct k_ringq *ringq, void **data)
+{
+	atomic_val_t pos = atomic_get(&ringq->head);
+	struct k_ringq_slot *slot;
+	unsigned long idx;
+
+	for (;;) {
+		atomic_val_t diff;
+
+		idx = (unsigned long)pos & ringq->mask;
+		slot = &ringq->slots[idx];
+		diff = seq_diff(slot_seq(slot, idx), pos_add(pos, 1));
+
+		if (diff == 0) {
+			if (atomic_cas(&ringq->head, pos, pos_add(pos, 1))) {
+				break;
+			}
+			pos = atomic_get(&ringq->head);
+		} else if (diff < 0) {
+			/* Slot not written yet in this lap */
+			return false;
+		} else {
+			pos = atomic_get(&ringq->head);
+		}
+	}
+
+	*data = slot->data;
+	slot_seq_set(slot, idx, pos_add(pos, ringq->mask + 1UL));
+
+	return true;
+}
+
+static void wake_one(struct k_ringq *ringq, atomic_t *waiters, _wait_q_t *wait_q)
+{
+	struct k_thread *thread;
+	k_spinlock_key_t key;
+
+	if (atomic_get(waiters) == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&ringq->lock);
+	thread = z_unpend_first_thread(wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		z_reschedule(&ringq->lock, key);
+	} else {
+		k_spin_unlock(&ringq->lock, key);
+	}
+}
+
+int k_ringq_init(struct k_ringq *ringq, struct k_ringq_slot *slots,
+		 uint32_t num_slots)
+{
+	if ((num_slots == 0U) || !IS_POWER_OF_TWO(num_slots)) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = 0; i < num_slots; i++) {
+		(void)atomic_set(&slots[i].seq, 0);
+	}
+
+	ringq->slots = slots;
+	ringq->mask = num_slots - 1U;
+	(void)atomic_set(&ringq->tail, 0);
+	(void)atomic_set(&ringq->head, 0);
+	(void)atomic_set(&ringq->get_waiters, 0);
+	(void)atomic_set(&ringq->put_waiters, 0);
+	ringq->lock = (struct k_spinlock) {};
+	z_waitq_init(&ringq->get_wait_q);
+	z_waitq_init(&ringq->put_wait_q);
+
+	k_object_init(ringq);
+
+	return 0;
+}
+
+int z_impl_k_ringq_put(struct k_ringq *ringq, void *data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int ret;
+
+	while (!try_put(ringq, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		key = k_spin_lock(&ringq->lock);
+		atomic_inc(&ringq->put_waiters);
+		if (try_put(ringq, data)) {
+			atomic_dec(&ringq->put_waiters);
+			k_spin_unlock(&ringq->lock, key);
+			break;
+		}
+
+		ret = z_pend_curr(&ringq->lock, key, &ringq->put_wait_q, timeout);
+		atomic_dec(&ringq->put_waiters);
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* Woken up, but another producer may have taken the slot */
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	wake_one(ringq, &ringq->get_waiters, &ringq->get_wait_q);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_ringq_put(struct k_ringq *ringq, void *data,
+				     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(ringq, K_OBJ_RINGQ));
+
+	return z_impl_k_ringq_put(ringq, data, timeout);
+}
+#include <zephyr/syscalls/k_ringq_put_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_ringq_get(struct k_ringq *ringq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int ret;
+
+	while (!try_get(ringq, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		key = k_spin_lock(&ringq->lock);
+		atomic_inc(&ringq->get_waiters);
+		if (try_get(ringq, data)) {
+			atomic_dec(&ringq->get_waiters);
+			k_spin_unlock(&ringq->lock, key);
+			break;
+		}
+
+		ret = z_pend_curr(&ringq->lock, key, &ringq->get_wait_q, timeout);
+		atomic_dec(&ringq->get_waiters);
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* Woken up, but another consumer may have taken the entry */
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	wake_one(ringq, &ringq->put_waiters, &ringq->put_wait_q);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_ringq_get(struct k_ringq *ringq, void **data,
+				     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(ringq, K_OBJ_RINGQ));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+
+	return z_impl_k_ringq_get(ringq, data, timeout);
+}
+#include <zephyr/syscalls/k_ringq_get_mrsh.c>
+
+static inline uint32_t z_vrfy_k_ringq_num_used_get(struct k_ringq *ringq)
+{
+	K_OOPS(K_SYSCALL_OBJ(ringq, K_OBJ_RINGQ));
+
+	return z_impl_k_ringq_num_used_get(ringq);
+}
+#include <zephyr/syscalls/k_ringq_num_used_get_mrsh.c>
+#endif /* CONFIG_USERSPACE */
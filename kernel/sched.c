@@ -59,6 +59,12 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	/* The queue a thread lives in is the one of the CPU it was
+	 * last placed on, see runq_place().  base.cpu must therefore
+	 * never change while the thread is queued.
+	 */
+	return &_kernel.cpus[thread->base.cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -67,11 +73,11 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
@@ -95,8 +101,107 @@ static ALWAYS_INLINE void runq_yield(void)
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* Work stealing: the local queue is preferred, but a strictly
+	 * better thread sitting in another CPU's queue is taken
+	 * instead.  This keeps the global priority (and deadline)
+	 * ordering of the single queue, and lets an idle CPU pick up
+	 * work queued elsewhere.  With SCHED_CPU_MASK, the backend
+	 * only returns threads allowed to run on the current CPU.
+	 */
+	struct k_thread *best = _priq_run_best(curr_cpu_runq());
+	unsigned int num_cpus = arch_num_cpus();
+	int currcpu = _current_cpu->id;
+
+	for (int i = 0; i < num_cpus; i++) {
+		struct k_thread *thread;
+
+		if (i == currcpu) {
+			continue;
+		}
+
+		thread = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((thread != NULL) &&
+		    ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+
+	return best;
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+}
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+static inline bool cpu_allowed(struct k_thread *thread, int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0U;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+	return true;
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
+
+static bool thread_running_anywhere(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus; i++) {
+		if (_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Pick the queue a thread becoming ready is added to.  Preference
+ * goes to the CPU it last ran on (cache affinity) if it would run
+ * there right away, then to an idle CPU, and finally back to the
+ * last CPU (or the first one it is allowed on).  A thread still
+ * running somewhere keeps its assignment: it is requeued by
+ * z_requeue_current() on its own CPU.
+ */
+static void runq_place(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int home = thread->base.cpu;
+	int target = -1;
+	struct k_thread *curr = _kernel.cpus[home].current;
+
+	if (thread_running_anywhere(thread)) {
+		return;
+	}
+
+	if (cpu_allowed(thread, home) && (curr != NULL) &&
+	    (z_sched_prio_cmp(thread, curr) > 0)) {
+		target = home;
+	}
+
+	for (int i = 0; (target < 0) && (i < num_cpus); i++) {
+		curr = _kernel.cpus[i].current;
+		if (cpu_allowed(thread, i) && (curr != NULL) &&
+		    z_is_idle_thread_object(curr)) {
+			target = i;
+		}
+	}
+
+	if ((target < 0) && !cpu_allowed(thread, home)) {
+		for (int i = 0; (target < 0) && (i < num_cpus); i++) {
+			if (cpu_allowed(thread, i)) {
+				target = i;
+			}
+		}
+	}
+
+	if (target >= 0) {
+		thread->base.cpu = target;
+	}
 }
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 
 /* _current is never in the run queue until context switch on
  * SMP configurations, see z_requeue_current()
@@ -110,6 +215,9 @@ static ALWAYS_INLINE void queue_thread(struct k_thread *thread)
 {
 	z_mark_thread_as_queued(thread);
 	if (should_queue_thread(thread)) {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+		runq_place(thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 		runq_add(thread);
 	}
 #ifdef CONFIG_SMP
@@ -347,6 +455,9 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+		z_sched_usage_ready(thread);
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
 		queue_thread(thread);
 		update_cache(0);
 
@@ -947,13 +1058,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -0,0 +1,97 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel_internal.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/llext/symbol.h>
+
+/*
+ * Each CPU needs one queue node per spinlock it holds or waits for at the
+ * same time. Locks are not always released in the reverse order they were
+ * taken (e.g. z_pend_curr()), so the node of the holder is recorded in the
+ * lock, and nodes are found by scanning the small per-CPU pool. Interrupts
+ * are masked while spinlocks are held, so the pool of a CPU is only ever
+ * accessed by that CPU.
+ */
+static struct z_spin_mcs_node mcs_nodes[CONFIG_MP_MAX_NUM_CPUS][CONFIG_MCS_SPINLOCK_NODES];
+
+static struct z_spin_mcs_node *node_alloc(void)
+{
+	struct z_spin_mcs_node *nodes = mcs_nodes[_current_cpu->id];
+
+	for (int i = 0; i < CONFIG_MCS_SPINLOCK_NODES; i++) {
+		if (!nodes[i].busy) {
+			nodes[i].busy = true;
+			atomic_ptr_clear(&nodes[i].next);
+			atomic_set(&nodes[i].locked, 1);
+
+			return &nodes[i];
+		}
+	}
+
+	__ASSERT(false, "More than %d spinlocks held on CPU %d",
+		 CONFIG_MCS_SPINLOCK_NODES, _current_cpu->id);
+	k_panic();
+
+	return NULL;
+}
+
+bool z_spin_mcs_lock(struct k_spinlock *l)
+{
+	struct z_spin_mcs_node *node = node_alloc();
+	struct z_spin_mcs_node *prev = atomic_ptr_set(&l->tail, node);
+
+	if (prev != NULL) {
+		/* Queue behind the previous CPU, which hands the lock over */
+		atomic_ptr_set(&prev->next, node);
+		while (atomic_get(&node->locked) != 0) {
+			arch_spin_relax();
+		}
+	}
+
+	l->holder = node;
+
+	return prev != NULL;
+}
+EXPORT_SYMBOL(z_spin_mcs_lock);
+
+bool z_spin_mcs_trylock(struct k_spinlock *l)
+{
+	struct z_spin_mcs_node *node = node_alloc();
+
+	if (!atomic_ptr_cas(&l->tail, NULL, node)) {
+		node->busy = false;
+		return false;
+	}
+
+	l->holder = node;
+
+	return true;
+}
+EXPORT_SYMBOL(z_spin_mcs_trylock);
+
+void z_spin_mcs_unlock(struct k_spinlock *l)
+{
+	struct z_spin_mcs_node *node = l->holder;
+	struct z_spin_mcs_node *next = atomic_ptr_get(&node->next);
+
+	if (next == NULL) {
+		if (atomic_ptr_cas(&l->tail, node, NULL)) {
+			node->busy = false;
+			return;
+		}
+
+		/* Another CPU swapped the tail but did not link its node yet */
+		do {
+			arch_spin_relax();
+			next = atomic_ptr_get(&node->next);
+		} while (next == NULL);
+	}
+
+	atomic_clear(&next->locked);
+	node->busy = false;
+}
+EXPORT_SYMBOL(z_spin_mcs_unlock);
@@ -43,6 +43,18 @@ void z_spin_lock_set_owner(struct k_spinlock *l)
 }
 EXPORT_SYMBOL(z_spin_lock_set_owner);
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+/* Called with the lock held, so the counters need no atomic operations */
+void z_spin_lock_stats_update(struct k_spinlock *l, bool contended)
+{
+	l->lock_count++;
+	if (contended) {
+		l->contended_count++;
+	}
+}
+EXPORT_SYMBOL(z_spin_lock_stats_update);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 #ifdef CONFIG_KERNEL_COHERENCE
 bool z_spin_lock_mem_coherent(struct k_spinlock *l)
 {
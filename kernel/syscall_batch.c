@@ -0,0 +1,53 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_rec *recs, size_t count)
+{
+	ARG_UNUSED(recs);
+	ARG_UNUSED(count);
+
+	/* Supervisor threads call the APIs directly */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_rec *recs, size_t count)
+{
+	void *ssf = _current->syscall_frame;
+	struct k_syscall_batch_rec rec;
+	uintptr_t ret;
+
+	if (count > CONFIG_SYSCALL_BATCH_MAX) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		/* The records are copied and checked one at a time, as a
+		 * system call of the batch may block, and the memory domain
+		 * of the thread change meanwhile.
+		 */
+		K_OOPS(k_usermode_from_copy(&rec, &recs[i], sizeof(rec)));
+		K_OOPS(K_SYSCALL_VERIFY_MSG(rec.id < K_SYSCALL_LIMIT &&
+					    rec.id != K_SYSCALL_K_SYSCALL_BATCH,
+					    "bad batched system call id %" PRIuPTR, rec.id));
+
+		ret = _k_syscall_table[rec.id](rec.args[0], rec.args[1], rec.args[2],
+					       rec.args[3], rec.args[4], rec.args[5], ssf);
+
+		/* Restore the frame for the next record and the caller */
+		_current->syscall_frame = ssf;
+
+		K_OOPS(k_usermode_to_copy(&recs[i].ret, &ret, sizeof(ret)));
+	}
+
+	return 0;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
@@ -537,6 +537,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	k_object_init(stack);
 	new_thread->stack_obj = stack;
 	new_thread->syscall_frame = NULL;
+#if defined(CONFIG_DYNAMIC_OBJECTS) && (CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0)
+	(void)memset(new_thread->kobj_cache, 0, sizeof(new_thread->kobj_cache));
+#endif
 
 	/* Any given thread has access to itself */
 	k_object_access_grant(new_thread, new_thread);
@@ -582,6 +585,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_EVENTS
 	new_thread->no_wake_on_timeout = false;
 #endif /* CONFIG_EVENTS */
+#if CONFIG_MUTEX_PI_CHAIN_DEPTH > 0
+	new_thread->pended_mutex = NULL;
+#endif /* CONFIG_MUTEX_PI_CHAIN_DEPTH */
 #ifdef CONFIG_THREAD_MONITOR
 	new_thread->entry.pEntry = entry;
 	new_thread->entry.parameter1 = p1;
@@ -1138,6 +1144,9 @@ void z_dummy_thread_init(struct k_thread *dummy_thread)
 #endif /* CONFIG_THREAD_STACK_INFO */
 #ifdef CONFIG_USERSPACE
 	dummy_thread->mem_domain_info.mem_domain = &k_mem_domain_default;
+#if defined(CONFIG_DYNAMIC_OBJECTS) && (CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0)
+	(void)memset(dummy_thread->kobj_cache, 0, sizeof(dummy_thread->kobj_cache));
+#endif
 #endif /* CONFIG_USERSPACE */
 #if (K_HEAP_MEM_POOL_SIZE > 0)
 	k_thread_system_pool_assign(dummy_thread);
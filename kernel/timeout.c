@@ -11,23 +11,56 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
-static uint64_t curr_tick;
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+struct timeout_queue {
+	/* Tick all expiries in this queue are relative to */
+	uint64_t tick;
+
+	/* Ticks left to process in the currently-executing sys_clock_announce() */
+	int announce_remaining;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+	struct k_spinlock lock;
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+	uint64_t map[WHEEL_LEVELS];
+#else
+	sys_dlist_t list;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+};
 
 /*
- * The timeout code shall take no locks other than its own (timeout_lock), nor
- * shall it call any other subsystem while holding this lock.
+ * The timeout code shall take no locks other than its own (the queue
+ * locks, and timeout_lock when per-CPU queues are used), nor shall it
+ * call any other subsystem while holding these locks.  The lock order
+ * is: lower numbered queue, higher numbered queue, timeout_lock.
  */
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+#define NUM_QUEUES CONFIG_MP_MAX_NUM_CPUS
+
+/* Global tick count, advanced by every sys_clock_announce() call.  Each
+ * CPU catches its own queue up with it when it processes its timer
+ * interrupt.
+ */
+static uint64_t curr_tick;
 static struct k_spinlock timeout_lock;
+#else
+#define NUM_QUEUES 1
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
+static struct timeout_queue timeout_queues[NUM_QUEUES];
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
 
-/* Ticks left to process in the currently-executing sys_clock_announce() */
-static int announce_remaining;
-
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 unsigned int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -40,34 +73,467 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
-static struct _timeout *first(void)
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/*
+ * Hierarchical timing wheel.  Each pending timeout stores its absolute
+ * expiry tick in dticks and lives in exactly one slot.  The level of a
+ * timeout is given by the most significant bit in which its expiry
+ * differs from the queue tick, so level 0 holds timeouts expiring within
+ * the current 64 tick window and each further level covers 64 times the
+ * span of the one below.  Timeouts beyond the span of the top level are
+ * parked in the top level and re-examined once per top level rotation.
+ *
+ * When the queue tick crosses the start of a slot on level L > 0, the
+ * slot is "cascaded": its timeouts are re-inserted and land on lower
+ * levels.  Per-level occupancy bitmaps make finding the next slot to
+ * process a count-trailing-zeros operation, so insertion, removal and
+ * next_timeout() are all O(1) in the number of pending timeouts.
+ */
+
+static inline uint64_t wheel_digit(uint64_t tick, int level)
+{
+	return (tick >> (level * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+static int wheel_level(struct timeout_queue *q, uint64_t expiry)
+{
+	uint64_t diff = expiry ^ q->tick;
+	int level;
+
+	if (diff == 0U) {
+		return 0;
+	}
+
+	level = (63 - u64_count_leading_zeros(diff)) / WHEEL_BITS;
+
+	return MIN(level, WHEEL_LEVELS - 1);
+}
+
+static sys_dlist_t *wheel_slot(struct timeout_queue *q, uint64_t expiry,
+			       int *level, int *slot)
+{
+	*level = wheel_level(q, expiry);
+	*slot = (int)wheel_digit(expiry, *level);
+
+	return &q->wheel[*level][*slot];
+}
+
+static void wheel_insert(struct timeout_queue *q, struct _timeout *to)
+{
+	int level, slot;
+	sys_dlist_t *list = wheel_slot(q, (uint64_t)to->dticks, &level, &slot);
+
+	/* Slots are initialized lazily on first use */
+	if (list->head == NULL) {
+		sys_dlist_init(list);
+	}
+
+	sys_dlist_append(list, &to->node);
+	q->map[level] |= BIT64(slot);
+}
+
+static void wheel_remove(struct timeout_queue *q, struct _timeout *to)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	int level, slot;
+	sys_dlist_t *list = wheel_slot(q, (uint64_t)to->dticks, &level, &slot);
+
+	sys_dlist_remove(&to->node);
+	if (sys_dlist_is_empty(list)) {
+		q->map[level] &= ~BIT64(slot);
+	}
+}
+
+/*
+ * Find the next tick at which the wheel needs attention: either the
+ * exact expiry of the earliest level 0 timeout, or the start of the
+ * next occupied slot on a higher level (a lower bound on the expiry of
+ * everything it contains).  Returns the level the event belongs to, or
+ * -1 if the wheel is empty.
+ */
+static int wheel_next_event(struct timeout_queue *q, uint64_t *tick)
+{
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		int shift = level * WHEEL_BITS;
+		uint64_t digit = wheel_digit(q->tick, level);
+		uint64_t base = q->tick & ~(BIT64(shift + WHEEL_BITS) - 1U);
+		uint64_t map = q->map[level];
+
+		if (map == 0U) {
+			continue;
+		}
+
+		/* Level 0 may hold timeouts expiring right now (cascaded
+		 * into the current slot), higher levels only ever hold
+		 * slots ahead of the queue tick.
+		 */
+		map &= ~((level == 0 ? BIT64(digit) : BIT64(digit) << 1) - 1U);
+		if (map == 0U) {
+			if (level < (WHEEL_LEVELS - 1)) {
+				continue;
+			}
+			/* Only parked far-future timeouts remain */
+			map = q->map[level];
+			base += BIT64(shift + WHEEL_BITS);
+		}
+
+		*tick = base | ((uint64_t)u64_count_trailing_zeros(map) << shift);
+		return level;
+	}
+
+	return -1;
+}
+
+/* Re-distribute every slot starting at the queue tick, top level first */
+static void wheel_cascade(struct timeout_queue *q)
+{
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		int slot = (int)wheel_digit(q->tick, level);
+		sys_dlist_t *list = &q->wheel[level][slot];
+		sys_dlist_t pending;
+		sys_dnode_t *node;
+
+		if ((q->tick & (BIT64(level * WHEEL_BITS) - 1U)) != 0U ||
+		    (q->map[level] & BIT64(slot)) == 0U) {
+			continue;
+		}
+
+		sys_dlist_init(&pending);
+		while ((node = sys_dlist_get(list)) != NULL) {
+			sys_dlist_append(&pending, node);
+		}
+		q->map[level] &= ~BIT64(slot);
+
+		while ((node = sys_dlist_get(&pending)) != NULL) {
+			wheel_insert(q, CONTAINER_OF(node, struct _timeout, node));
+		}
+	}
+}
+
+static struct _timeout *first(struct timeout_queue *q)
+{
+	uint64_t tick;
+	sys_dnode_t *t;
+
+	if (wheel_next_event(q, &tick) != 0) {
+		return NULL;
+	}
+
+	t = sys_dlist_peek_head(&q->wheel[0][wheel_digit(tick, 0)]);
+
+	return CONTAINER_OF(t, struct _timeout, node);
+}
+
+/* Ticks from the queue tick to the next event, or false if nothing is queued */
+static bool timeout_queue_next(struct timeout_queue *q, k_ticks_t *dticks)
+{
+	uint64_t tick;
+
+	if (wheel_next_event(q, &tick) < 0) {
+		return false;
+	}
+
+	*dticks = (k_ticks_t)(tick - q->tick);
+	return true;
+}
+
+/* Queue timeout to expire dticks after the queue tick. Returns true if the
+ * next queue event moved earlier.
+ */
+static bool timeout_queue_add(struct timeout_queue *q, struct _timeout *to,
+			      k_ticks_t dticks)
+{
+	k_ticks_t before, after;
+	bool had_next = timeout_queue_next(q, &before);
+
+	to->dticks = (k_ticks_t)(q->tick + dticks);
+	wheel_insert(q, to);
+	(void)timeout_queue_next(q, &after);
+
+	return !had_next || (after < before);
+}
+
+/* Returns true if the next queue event changed */
+static bool remove_timeout(struct timeout_queue *q, struct _timeout *t)
+{
+	k_ticks_t before, after;
+
+	(void)timeout_queue_next(q, &before);
+	wheel_remove(q, t);
+
+	return !timeout_queue_next(q, &after) || (after != before);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(struct timeout_queue *q, const struct _timeout *timeout)
+{
+	return (k_ticks_t)((uint64_t)timeout->dticks - q->tick);
+}
+
+/*
+ * Return the earliest timeout due within announce_remaining ticks,
+ * advancing the queue tick over higher level slot boundaries (and
+ * cascading them) on the way.
+ */
+static struct _timeout *first_due(struct timeout_queue *q)
+{
+	uint64_t tick;
+	int level;
+
+	while ((level = wheel_next_event(q, &tick)) >= 0 &&
+	       (tick - q->tick) <= (uint64_t)q->announce_remaining) {
+		if (level == 0) {
+			return first(q);
+		}
+
+		q->announce_remaining -= (int)(tick - q->tick);
+		q->tick = tick;
+		wheel_cascade(q);
+	}
+
+	return NULL;
+}
+
+static inline void expire_timeout(struct timeout_queue *q, struct _timeout *t)
+{
+	wheel_remove(q, t);
+	t->dticks = 0;
+}
+
+static inline void timeout_queue_advance(struct timeout_queue *q, int32_t ticks)
+{
+	/* Expiry ticks are absolute, nothing to adjust */
+	ARG_UNUSED(q);
+	ARG_UNUSED(ticks);
+}
+
+#ifdef CONFIG_ZTEST
+/* Keep the remaining time of queued timeouts across a forced jump of
+ * the queue tick, like the delta list does implicitly.
+ */
+static void timeout_queue_rebase(struct timeout_queue *q, uint64_t tick)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+	struct _timeout *t;
+
+	sys_dlist_init(&pending);
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		for (unsigned int slot = 0; slot < WHEEL_SLOTS; slot++) {
+			if ((q->map[level] & BIT64(slot)) == 0U) {
+				continue;
+			}
+			while ((node = sys_dlist_get(&q->wheel[level][slot])) != NULL) {
+				sys_dlist_append(&pending, node);
+			}
+		}
+		q->map[level] = 0U;
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&pending, t, node) {
+		t->dticks = (k_ticks_t)(tick + ((uint64_t)t->dticks - q->tick));
+	}
+
+	q->tick = tick;
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		wheel_insert(q, CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+#endif /* CONFIG_ZTEST */
+
+#else /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+static struct _timeout *first(struct timeout_queue *q)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
 
 	return (t == NULL) ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next(struct timeout_queue *q, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(&q->list, &t->node);
 
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static bool timeout_queue_next(struct timeout_queue *q, k_ticks_t *dticks)
+{
+	struct _timeout *to = first(q);
+
+	if (to == NULL) {
+		return false;
+	}
+
+	*dticks = to->dticks;
+	return true;
+}
+
+static bool timeout_queue_add(struct timeout_queue *q, struct _timeout *to,
+			      k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	/* The list is initialized lazily on first use */
+	if (q->list.head == NULL) {
+		sys_dlist_init(&q->list);
+	}
+
+	to->dticks = dticks;
+	for (t = first(q); t != NULL; t = next(q, t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&q->list, &to->node);
+	}
+
+	return to == first(q);
+}
+
+static bool remove_timeout(struct timeout_queue *q, struct _timeout *t)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	bool is_first = (t == first(q));
+
+	if (next(q, t) != NULL) {
+		next(q, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
+
+	return is_first;
 }
 
-static int32_t elapsed(void)
+/* must be locked */
+static k_ticks_t timeout_rem(struct timeout_queue *q, const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(q); t != NULL; t = next(q, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+static struct _timeout *first_due(struct timeout_queue *q)
+{
+	struct _timeout *t = first(q);
+
+	return ((t != NULL) && (t->dticks <= q->announce_remaining)) ? t : NULL;
+}
+
+static inline void expire_timeout(struct timeout_queue *q, struct _timeout *t)
+{
+	t->dticks = 0;
+	(void)remove_timeout(q, t);
+}
+
+static inline void timeout_queue_advance(struct timeout_queue *q, int32_t ticks)
+{
+	struct _timeout *t = first(q);
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+}
+
+#ifdef CONFIG_ZTEST
+static inline void timeout_queue_rebase(struct timeout_queue *q, uint64_t tick)
+{
+	/* Deltas are relative to the queue tick already */
+	q->tick = tick;
+}
+#endif /* CONFIG_ZTEST */
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+
+/* Reading the CPU id without pinning the caller is fine here: landing
+ * on another CPU's queue after a migration only costs locality.
+ */
+static inline struct timeout_queue *local_queue(void)
+{
+	return &timeout_queues[arch_curr_cpu()->id];
+}
+
+/* Lock the queue the timeout currently belongs to */
+static struct timeout_queue *queue_lock(const struct _timeout *to, k_spinlock_key_t *key)
+{
+	struct timeout_queue *q;
+
+	for (;;) {
+		uint8_t cpu = to->cpu;
+
+		q = &timeout_queues[cpu];
+		*key = k_spin_lock(&q->lock);
+		if (to->cpu == cpu) {
+			break;
+		}
+		k_spin_unlock(&q->lock, *key);
+	}
+
+	return q;
+}
+
+static uint64_t global_tick(void)
+{
+	uint64_t t = 0U;
+
+	K_SPINLOCK(&timeout_lock) {
+		t = curr_tick + sys_clock_elapsed();
+	}
+
+	return t;
+}
+
+/* Ask a remote CPU to reprogram its timer for its own queue */
+static void queue_kick(struct timeout_queue *q)
+{
+#ifdef CONFIG_SCHED_IPI_SUPPORTED
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+	arch_sched_directed_ipi(BIT(q - timeout_queues));
+#else
+	arch_sched_broadcast_ipi();
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
+#else
+	ARG_UNUSED(q);
+#endif /* CONFIG_SCHED_IPI_SUPPORTED */
+}
+
+#else
+
+static inline struct timeout_queue *local_queue(void)
+{
+	return &timeout_queues[0];
+}
+
+static inline struct timeout_queue *queue_lock(const struct _timeout *to,
+					       k_spinlock_key_t *key)
+{
+	ARG_UNUSED(to);
+
+	*key = k_spin_lock(&timeout_queues[0].lock);
+
+	return &timeout_queues[0];
+}
+
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
+static int32_t elapsed(struct timeout_queue *q)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
 	 * scheduled relatively to the currently firing timeout's original tick
-	 * value (=curr_tick) rather than relative to the current
+	 * value (=q->tick) rather than relative to the current
 	 * sys_clock_elapsed().
 	 *
 	 * This means that timeouts being scheduled from within timeout callbacks
@@ -79,27 +545,40 @@ static int32_t elapsed(void)
 	 *
 	 * The distinction is implemented by looking at announce_remaining which
 	 * will be non-zero while sys_clock_announce() is executing and zero
-	 * otherwise.
+	 * otherwise.  With per-CPU queues it is the queue of the calling CPU
+	 * that decides, and the result is relative to the tick of q which may
+	 * lag behind the global tick.
 	 */
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	struct timeout_queue *local = local_queue();
+
+	if (local->announce_remaining != 0) {
+		return (int32_t)(local->tick - q->tick);
+	}
+
+	return (int32_t)(global_tick() - q->tick);
+#else
+	return q->announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
 }
 
-static int32_t next_timeout(int32_t ticks_elapsed)
+static int32_t next_timeout(struct timeout_queue *q, int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	k_ticks_t dticks;
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if (!timeout_queue_next(q, &dticks) ||
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
-k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
+static k_ticks_t add_timeout(struct _timeout *to, _timeout_func_t fn,
+			     k_timeout_t timeout, int cpu)
 {
 	k_ticks_t ticks = 0;
 
@@ -114,125 +593,218 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
-	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	struct timeout_queue *q = (cpu < 0) ? local_queue() : &timeout_queues[cpu];
+	bool kick = false;
+
+	to->cpu = (uint8_t)(q - timeout_queues);
+#else
+	struct timeout_queue *q = local_queue();
+
+	ARG_UNUSED(cpu);
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
+	K_SPINLOCK(&q->lock) {
+		k_ticks_t dticks;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
 		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
-			ticks_elapsed = elapsed();
+			ticks_elapsed = elapsed(q);
 			has_elapsed = true;
-			to->dticks = timeout.ticks + 1 + ticks_elapsed;
-			ticks = curr_tick + to->dticks;
+			dticks = MAX(1, timeout.ticks + 1 + ticks_elapsed);
+			ticks = q->tick + timeout.ticks + 1 + ticks_elapsed;
 		} else {
-			k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = MAX(1, dticks);
+			dticks = Z_TICK_ABS(timeout.ticks) - q->tick;
+			dticks = MAX(1, dticks);
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
+		if (!timeout_queue_add(q, to, dticks)) {
+			K_SPINLOCK_BREAK;
 		}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+		if (q != local_queue()) {
+			kick = true;
+			K_SPINLOCK_BREAK;
 		}
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
 
-		if (to == first() && announce_remaining == 0) {
+		if (q->announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
 				 */
-				ticks_elapsed = elapsed();
+				ticks_elapsed = elapsed(q);
 			}
-			sys_clock_set_timeout(next_timeout(ticks_elapsed), false);
+			sys_clock_set_timeout(next_timeout(q, ticks_elapsed), false);
 		}
 	}
 
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	if (kick) {
+		queue_kick(q);
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
 	return ticks;
 }
 
-int z_abort_timeout(struct _timeout *to)
+k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
+{
+	return add_timeout(to, fn, timeout, -1);
+}
+
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+k_ticks_t z_add_timeout_on_cpu(struct _timeout *to, _timeout_func_t fn,
+			       k_timeout_t timeout, int cpu)
+{
+	__ASSERT_NO_MSG(cpu < CONFIG_MP_MAX_NUM_CPUS);
+
+	return add_timeout(to, fn, timeout, cpu);
+}
+
+int z_timeout_migrate(struct _timeout *to, int cpu)
 {
+	struct timeout_queue *dst = &timeout_queues[cpu];
+	struct timeout_queue *src, *lo, *hi;
+	k_spinlock_key_t key, key2;
 	int ret = -EINVAL;
+	bool kick = false;
 
-	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
-
-			remove_timeout(to);
-			to->dticks = TIMEOUT_DTICKS_ABORTED;
-			ret = 0;
-			if (is_first) {
-				sys_clock_set_timeout(next_timeout(elapsed()), false);
-			}
+	__ASSERT_NO_MSG(cpu < CONFIG_MP_MAX_NUM_CPUS);
+
+	/* Hold both queue locks, lowest index first, so the timeout is
+	 * never observable as inactive while it moves.
+	 */
+	for (;;) {
+		uint8_t cur = to->cpu;
+
+		src = &timeout_queues[cur];
+		if (src == dst) {
+			return 0;
 		}
+
+		lo = MIN(src, dst);
+		hi = MAX(src, dst);
+		key = k_spin_lock(&lo->lock);
+		key2 = k_spin_lock(&hi->lock);
+		if (to->cpu == cur) {
+			break;
+		}
+		k_spin_unlock(&hi->lock, key2);
+		k_spin_unlock(&lo->lock, key);
+	}
+
+	if (sys_dnode_is_linked(&to->node)) {
+		uint64_t expiry = src->tick + timeout_rem(src, to);
+
+		(void)remove_timeout(src, to);
+		/* An overdue timeout fires on the next announce of dst */
+		kick = timeout_queue_add(dst, to, MAX(0, (k_ticks_t)(expiry - dst->tick)));
+		ret = 0;
+	}
+	to->cpu = (uint8_t)cpu;
+
+	k_spin_unlock(&hi->lock, key2);
+	k_spin_unlock(&lo->lock, key);
+
+	if (kick) {
+		queue_kick(dst);
 	}
 
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
+void z_timeout_queue_reprogram(void)
 {
-	k_ticks_t ticks = 0;
+	struct timeout_queue *q = local_queue();
 
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
+	K_SPINLOCK(&q->lock) {
+		if (q->announce_remaining == 0) {
+			sys_clock_set_timeout(next_timeout(q, elapsed(q)), false);
 		}
 	}
+}
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
 
-	return ticks;
+int z_abort_timeout(struct _timeout *to)
+{
+	k_spinlock_key_t key;
+	struct timeout_queue *q = queue_lock(to, &key);
+	int ret = -EINVAL;
+
+	if (sys_dnode_is_linked(&to->node)) {
+		bool is_first = remove_timeout(q, to);
+
+		to->dticks = TIMEOUT_DTICKS_ABORTED;
+		ret = 0;
+		if (is_first && (q == local_queue())) {
+			sys_clock_set_timeout(next_timeout(q, elapsed(q)), false);
+		}
+	}
+
+	k_spin_unlock(&q->lock, key);
+
+	return ret;
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
+	k_spinlock_key_t key;
+	struct timeout_queue *q = queue_lock(timeout, &key);
 
-	K_SPINLOCK(&timeout_lock) {
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks = timeout_rem(timeout) - elapsed();
-		}
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks = timeout_rem(q, timeout) - elapsed(q);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
 k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
+	k_spinlock_key_t key;
+	struct timeout_queue *q = queue_lock(timeout, &key);
 
-	K_SPINLOCK(&timeout_lock) {
-		ticks = curr_tick;
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks += timeout_rem(timeout);
-		}
+	ticks = q->tick;
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks += timeout_rem(q, timeout);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
 int32_t z_get_next_timeout_expiry(void)
 {
 	int32_t ret = (int32_t) K_TICKS_FOREVER;
+	struct timeout_queue *q = local_queue();
 
-	K_SPINLOCK(&timeout_lock) {
-		ret = next_timeout(elapsed());
+	K_SPINLOCK(&q->lock) {
+		ret = next_timeout(q, elapsed(q));
 	}
 	return ret;
 }
 
 void sys_clock_announce(int32_t ticks)
 {
-	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	uint64_t target;
+
+	K_SPINLOCK(&timeout_lock) {
+		curr_tick += ticks;
+		target = curr_tick;
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
+	struct timeout_queue *q = local_queue();
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
 
 	/* We release the lock around the callbacks below, so on SMP
 	 * systems someone might be already running the loop.  Don't
@@ -240,41 +812,45 @@ void sys_clock_announce(int32_t ticks)
 	 * timeouts and confuse apps), just increment the tick count
 	 * and return.
 	 */
-	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
-		announce_remaining += ticks;
-		k_spin_unlock(&timeout_lock, key);
+	if (IS_ENABLED(CONFIG_SMP) && (q->announce_remaining != 0)) {
+		q->announce_remaining += ticks;
+		k_spin_unlock(&q->lock, key);
 		return;
 	}
 
-	announce_remaining = ticks;
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	/* Catch up with ticks announced by other CPUs as well */
+	q->announce_remaining = (int)(target - q->tick);
+#else
+	q->announce_remaining = ticks;
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
 
 	struct _timeout *t;
 
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
+	for (t = first_due(q); t != NULL; t = first_due(q)) {
+		int dt = timeout_rem(q, t);
 
-		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+		q->tick += dt;
+		expire_timeout(q, t);
 
-		k_spin_unlock(&timeout_lock, key);
+		k_spin_unlock(&q->lock, key);
 		t->fn(t);
-		key = k_spin_lock(&timeout_lock);
-		announce_remaining -= dt;
+		key = k_spin_lock(&q->lock);
+		q->announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
+	timeout_queue_advance(q, q->announce_remaining);
 
-	curr_tick += announce_remaining;
-	announce_remaining = 0;
+	q->tick += q->announce_remaining;
+	q->announce_remaining = 0;
 
-	sys_clock_set_timeout(next_timeout(0), false);
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	sys_clock_set_timeout(next_timeout(q, elapsed(q)), false);
+#else
+	sys_clock_set_timeout(next_timeout(q, 0), false);
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
 
-	k_spin_unlock(&timeout_lock, key);
+	k_spin_unlock(&q->lock, key);
 
 #ifdef CONFIG_TIMESLICING
 	z_time_slice();
@@ -284,9 +860,10 @@ void sys_clock_announce(int32_t ticks)
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
+	struct timeout_queue *q = local_queue();
 
-	K_SPINLOCK(&timeout_lock) {
-		t = curr_tick + elapsed();
+	K_SPINLOCK(&q->lock) {
+		t = q->tick + elapsed(q);
 	}
 	return t;
 }
@@ -295,8 +872,10 @@ uint32_t sys_clock_tick_get_32(void)
 {
 #ifdef CONFIG_TICKLESS_KERNEL
 	return (uint32_t)sys_clock_tick_get();
-#else
+#elif defined(CONFIG_TIMEOUT_PER_CPU_QUEUES)
 	return (uint32_t)curr_tick;
+#else
+	return (uint32_t)timeout_queues[0].tick;
 #endif /* CONFIG_TICKLESS_KERNEL */
 }
 
@@ -353,7 +932,17 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
-	curr_tick = tick;
+#ifdef CONFIG_TIMEOUT_PER_CPU_QUEUES
+	K_SPINLOCK(&timeout_lock) {
+		curr_tick = tick;
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU_QUEUES */
+
+	for (int i = 0; i < NUM_QUEUES; i++) {
+		K_SPINLOCK(&timeout_queues[i].lock) {
+			timeout_queue_rebase(&timeout_queues[i], tick);
+		}
+	}
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -71,6 +71,36 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	/* Keep the earliest time if the thread is made ready twice */
+	if (thread->base.usage.ready_stamp == 0U) {
+		thread->base.usage.ready_stamp = usage_now();
+	}
+}
+
+static void sched_thread_update_wake(struct k_thread *thread, uint32_t now)
+{
+	struct k_cycle_stats *usage = &thread->base.usage;
+	uint32_t cycles;
+
+	if (usage->ready_stamp == 0U) {
+		/* Preempted thread switched back in, not a wakeup */
+		return;
+	}
+
+	cycles = now - usage->ready_stamp;
+	usage->ready_stamp = 0U;
+
+	if (usage->track_usage) {
+		usage->wake_total += cycles;
+		usage->num_wakes++;
+		usage->wake_longest = MAX(usage->wake_longest, cycles);
+	}
+}
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -85,6 +115,10 @@ void z_sched_usage_start(struct k_thread *thread)
 		thread->base.usage.current = 0;
 	}
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+	sched_thread_update_wake(thread, _current_cpu->usage0);
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
+
 	k_spin_unlock(&usage_lock, key);
 #else
 	/* One write through a volatile pointer doesn't require
@@ -161,6 +195,11 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+	stats->wake_peak_cycles = 0;
+	stats->wake_average_cycles = 0;
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
+
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
@@ -217,6 +256,17 @@ void z_sched_thread_usage(struct k_thread *thread,
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+	stats->wake_peak_cycles = thread->base.usage.wake_longest;
+
+	if (thread->base.usage.num_wakes == 0) {
+		stats->wake_average_cycles = 0;
+	} else {
+		stats->wake_average_cycles = thread->base.usage.wake_total /
+					     thread->base.usage.num_wakes;
+	}
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -382,6 +432,11 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+	stats->wake_longest = 0U;
+	stats->wake_total = 0ULL;
+	stats->num_wakes = 0U;
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
 
 	if (thread != _current_cpu->current) {
 
@@ -48,7 +48,7 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
  * not.
  */
 #ifdef CONFIG_DYNAMIC_OBJECTS
-static struct k_spinlock lists_lock;       /* kobj dlist */
+static struct k_spinlock lists_lock;       /* kobj dlist and hash table */
 static struct k_spinlock objfree_lock;     /* k_object_free */
 
 #ifdef CONFIG_GEN_PRIV_STACKS
@@ -169,6 +169,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	sys_dnode_t dobj_hash;
 
 	/* The object itself */
 	void *data;
@@ -185,8 +186,22 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Hash table of allocated kernel objects, indexed by object address, for
+ * lookups. The buckets are initialized on first use.
  */
+#define DYN_OBJ_HASH_BUCKETS CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS
+
+BUILD_ASSERT(IS_POWER_OF_TWO(DYN_OBJ_HASH_BUCKETS),
+	     "CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS must be a power of two");
+
+static sys_dlist_t obj_hash[DYN_OBJ_HASH_BUCKETS];
+static bool obj_hash_ready;
+
+/*
+ * Incremented each time an allocated kernel object is removed, so that
+ * the per-thread lookup caches never return a freed object.
+ */
+static uint32_t obj_gen;
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -222,6 +237,47 @@ static size_t obj_align_get(enum k_objects otype)
 	return ret;
 }
 
+static inline size_t obj_hash_idx(const void *obj)
+{
+	uintptr_t h = (uintptr_t)obj / sizeof(void *);
+
+	h ^= h >> 7;
+
+	return h & (DYN_OBJ_HASH_BUCKETS - 1);
+}
+
+/* Must be called with lists_lock held */
+static sys_dlist_t *obj_hash_bucket(const void *obj)
+{
+	if (!obj_hash_ready) {
+		for (size_t i = 0; i < DYN_OBJ_HASH_BUCKETS; i++) {
+			sys_dlist_init(&obj_hash[i]);
+		}
+		obj_hash_ready = true;
+	}
+
+	return &obj_hash[obj_hash_idx(obj)];
+}
+
+static void dyn_object_add(struct dyn_obj *dyn)
+{
+	k_spinlock_key_t key = k_spin_lock(&lists_lock);
+
+	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	sys_dlist_append(obj_hash_bucket(dyn->kobj.name), &dyn->dobj_hash);
+	k_spin_unlock(&lists_lock, key);
+}
+
+static void dyn_object_remove(struct dyn_obj *dyn)
+{
+	k_spinlock_key_t key = k_spin_lock(&lists_lock);
+
+	sys_dlist_remove(&dyn->dobj_list);
+	sys_dlist_remove(&dyn->dobj_hash);
+	obj_gen++;
+	k_spin_unlock(&lists_lock, key);
+}
+
 static struct dyn_obj *dyn_object_find(const void *obj)
 {
 	struct dyn_obj *node;
@@ -229,12 +285,11 @@ static struct dyn_obj *dyn_object_find(const void *obj)
 
 	/* For any dynamically allocated kernel object, the object
 	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
+	 * which is linked in the hash bucket of that pointer.
 	 */
 	key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
+	SYS_DLIST_FOR_EACH_CONTAINER(obj_hash_bucket(obj), node, dobj_hash) {
 		if (node->kobj.name == obj) {
 			goto end;
 		}
@@ -374,10 +429,7 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	dyn->kobj.flags = 0;
 	(void)memset(dyn->kobj.perms, 0, CONFIG_MAX_THREAD_BYTES);
 
-	k_spinlock_key_t key = k_spin_lock(&lists_lock);
-
-	sys_dlist_append(&obj_list, &dyn->dobj_list);
-	k_spin_unlock(&lists_lock, key);
+	dyn_object_add(dyn);
 
 	return &dyn->kobj;
 }
@@ -470,7 +522,7 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		sys_dlist_remove(&dyn->dobj_list);
+		dyn_object_remove(dyn);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -484,6 +536,18 @@ void k_object_free(void *obj)
 	}
 }
 
+#if CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE),
+	     "CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE must be a power of two");
+
+static inline struct _thread_kobj_cache *thread_kobj_cache(const void *obj)
+{
+	size_t idx = obj_hash_idx(obj) & (CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE - 1);
+
+	return &_current->kobj_cache[idx];
+}
+#endif /* CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0 */
+
 struct k_object *k_object_find(const void *obj)
 {
 	struct k_object *ret;
@@ -492,6 +556,17 @@ struct k_object *k_object_find(const void *obj)
 
 	if (ret == NULL) {
 		struct dyn_obj *dyn;
+#if CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0
+		struct _thread_kobj_cache *cache = NULL;
+		uint32_t gen = obj_gen;
+
+		if (!k_is_in_isr()) {
+			cache = thread_kobj_cache(obj);
+			if (cache->obj == obj && cache->gen == gen && cache->ko != NULL) {
+				return cache->ko;
+			}
+		}
+#endif /* CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0 */
 
 		/* The cast to pointer-to-non-const violates MISRA
 		 * 11.8 but is justified since we know dynamic objects
@@ -501,6 +576,14 @@ struct k_object *k_object_find(const void *obj)
 		if (dyn != NULL) {
 			ret = &dyn->kobj;
 		}
+
+#if CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0
+		if (cache != NULL && ret != NULL) {
+			cache->obj = obj;
+			cache->ko = ret;
+			cache->gen = gen;
+		}
+#endif /* CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE > 0 */
 	}
 
 	return ret;
@@ -607,7 +690,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
-	sys_dlist_remove(&dyn->dobj_list);
+	dyn_object_remove(dyn);
 	k_free(dyn->data);
 	k_free(dyn);
 out:
@@ -12,9 +12,11 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/kernel_structs.h>
+#include <zephyr/init.h>
 #include <wait_q.h>
 #include <zephyr/spinlock.h>
 #include <errno.h>
+#include <string.h>
 #include <ksched.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/logging/log.h>
@@ -68,6 +70,136 @@ static struct k_spinlock lock;
 /* Invoked by work thread */
 static void handle_flush(struct k_work *work) { }
 
+#ifdef CONFIG_OBJ_CORE_WORK_Q
+static struct k_obj_type obj_type_work_q;
+
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+static int work_q_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_work_q *queue = CONTAINER_OF(obj_core, struct k_work_q, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memcpy(stats, &queue->stats, sizeof(queue->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int work_q_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_work_q *queue = CONTAINER_OF(obj_core, struct k_work_q, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(&queue->stats, 0, sizeof(queue->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc work_q_stats_desc = {
+	.raw_size = sizeof(struct k_work_q_stats),
+	.query_size = sizeof(struct k_work_q_stats),
+	.raw   = work_q_stats_raw,
+	.query = work_q_stats_raw,
+	.reset = work_q_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+/* Histogram bucket of a duration.
+ *
+ * @param us the duration, in microseconds
+ */
+static inline size_t work_stats_bucket(uint32_t us)
+{
+	size_t bucket = (us == 0U) ? 0U : (32U - __builtin_clz(us));
+
+	return MIN(bucket, CONFIG_OBJ_CORE_STATS_WORK_Q_BUCKETS - 1U);
+}
+
+/* Record the execution of a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue that executed the work item
+ * @param handler the handler of the work item
+ * @param queued cycle count when the work item was queued
+ * @param start cycle count when the handler was invoked
+ * @param end cycle count when the handler returned
+ */
+static void work_stats_record_locked(struct k_work_q *queue, k_work_handler_t handler,
+				     uint32_t queued, uint32_t start, uint32_t end)
+{
+	struct k_work_handler_stats *stats = NULL;
+	uint32_t delay_us;
+	uint32_t run_us;
+
+	for (size_t i = 0; i < ARRAY_SIZE(queue->stats.handlers); i++) {
+		if ((queue->stats.handlers[i].handler == handler) ||
+		    (queue->stats.handlers[i].handler == NULL)) {
+			stats = &queue->stats.handlers[i];
+			break;
+		}
+	}
+
+	if (stats == NULL) {
+		queue->stats.untracked++;
+		return;
+	}
+
+	delay_us = k_cyc_to_us_floor32(start - queued);
+	run_us = k_cyc_to_us_floor32(end - start);
+
+	stats->handler = handler;
+	stats->count++;
+	stats->delay_max_us = MAX(stats->delay_max_us, delay_us);
+	stats->run_max_us = MAX(stats->run_max_us, run_us);
+	stats->run_total_us += run_us;
+	stats->delay_hist[work_stats_bucket(delay_us)]++;
+	stats->run_hist[work_stats_bucket(run_us)]++;
+}
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
+static int init_work_q_obj_core_list(void)
+{
+	z_obj_type_init(&obj_type_work_q, K_OBJ_TYPE_WORK_Q_ID,
+			offsetof(struct k_work_q, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	k_obj_type_stats_init(&obj_type_work_q, &work_q_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
+	return 0;
+}
+
+SYS_INIT(init_work_q_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+/* Link a starting queue into the object core framework.
+ *
+ * A queue started again after being stopped is linked anew, with cleared
+ * statistics.
+ *
+ * @param queue the queue
+ */
+static void work_q_obj_core_link(struct k_work_q *queue)
+{
+	if (queue->obj_core.type != NULL) {
+		k_obj_core_unlink(K_OBJ_CORE(queue));
+	}
+
+	k_obj_core_init_and_link(K_OBJ_CORE(queue), &obj_type_work_q);
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	memset(&queue->stats, 0, sizeof(queue->stats));
+	k_obj_core_stats_register(K_OBJ_CORE(queue), &queue->stats,
+				  sizeof(queue->stats));
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+}
+#endif /* CONFIG_OBJ_CORE_WORK_Q */
+
 static inline void init_flusher(struct z_work_flusher *flusher)
 {
 	struct k_work *work = &flusher->work;
@@ -192,6 +324,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 				 struct z_work_flusher *flusher)
 {
 	init_flusher(flusher);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	flusher->target = work;
+#endif /* CONFIG_WORKQUEUE_POOL */
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
@@ -216,6 +351,25 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+/* Check whether a thread is one of the threads of a queue.
+ *
+ * @param queue the queue
+ * @param thread the thread
+ */
+static inline bool queue_is_thread(const struct k_work_q *queue,
+				   const struct k_thread *thread)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	for (size_t i = 1; i < queue->num_threads; i++) {
+		if (thread == &queue->threads[i]) {
+			return true;
+		}
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return thread == queue->thread_id;
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -265,7 +419,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = queue_is_thread(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -283,6 +437,9 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+		work->queued_cycles = k_cycle_get_32();
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
 		sys_slist_append(&queue->pending, &work->node);
 		ret = 1;
 		(void)notify_queue_locked(queue);
@@ -648,6 +805,64 @@ static void work_timeout_stop_locked(struct k_work_q *queue)
 }
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+/* Take the next work item that can run from a queue.
+ *
+ * With several threads, work items still running in another thread are left
+ * queued, as are the flushers of work items still running: the thread
+ * running the item takes them once it completes.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue
+ *
+ * @return the node of the work item, or NULL if none can run.
+ */
+static sys_snode_t *queue_take_locked(struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(&queue->pending, node) {
+		struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+		struct k_work *running = work;
+
+		if (work->handler == handle_flush) {
+			running = CONTAINER_OF(work, struct z_work_flusher, work)->target;
+		}
+
+		if (!flag_test(&work->flags, K_WORK_RUNNING_BIT) &&
+		    !flag_test(&running->flags, K_WORK_RUNNING_BIT)) {
+			sys_slist_remove(&queue->pending, prev, node);
+			return node;
+		}
+
+		prev = node;
+	}
+
+	return NULL;
+#else
+	return sys_slist_get(&queue->pending);
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
+/* Check whether a queue has completed all its work items.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue
+ */
+static inline bool queue_is_idle_locked(const struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	return (queue->num_busy == 0U) && sys_slist_is_empty(&queue->pending);
+#else
+	ARG_UNUSED(queue);
+
+	return true;
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -665,14 +880,22 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		k_work_handler_t handler = NULL;
 		k_spinlock_key_t key = k_spin_lock(&lock);
 		bool yield;
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+		uint32_t queued = 0U;
+		uint32_t start;
+		uint32_t end;
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_take_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#if defined(CONFIG_WORKQUEUE_POOL)
+			queue->num_busy++;
+#endif /* CONFIG_WORKQUEUE_POOL */
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -690,7 +913,11 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+			queued = work->queued_cycles;
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+		} else if (queue_is_idle_locked(queue) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -705,7 +932,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#if defined(CONFIG_WORKQUEUE_POOL)
+			/* The last thread of the queue clears them */
+			if (--queue->num_alive == 0U) {
+				flags_set(&queue->flags, 0);
+			}
+#else
 			flags_set(&queue->flags, 0);
+#endif /* CONFIG_WORKQUEUE_POOL */
 			k_spin_unlock(&lock, key);
 			return;
 		} else {
@@ -734,6 +968,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		k_spin_unlock(&lock, key);
 
 		__ASSERT_NO_MSG(handler != NULL);
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+		start = k_cycle_get_32();
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
 		handler(work);
 
 		/* Mark the work item as no longer running and deal
@@ -741,8 +978,19 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		 * was running.  Clear the BUSY flag and optionally
 		 * yield to prevent starving other threads.
 		 */
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+		end = k_cycle_get_32();
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
 		key = k_spin_lock(&lock);
 
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+		/* Flushers only wake their waiter */
+		if (handler != handle_flush) {
+			work_stats_record_locked(queue, handler, queued, start, end);
+		}
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
 		work_timeout_stop_locked(queue);
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
@@ -755,7 +1003,13 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+		if (--queue->num_busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif /* CONFIG_WORKQUEUE_POOL */
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -805,18 +1059,36 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
 	queue->thread_id = _current;
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->threads = _current;
+	queue->num_threads = 1U;
+	queue->num_alive = 1U;
+	queue->num_busy = 0U;
+#endif /* CONFIG_WORKQUEUE_POOL */
+#ifdef CONFIG_OBJ_CORE_WORK_Q
+	work_q_obj_core_link(queue);
+#endif /* CONFIG_OBJ_CORE_WORK_Q */
 	flags_set(&queue->flags, flags);
 	work_queue_main(queue, NULL, NULL);
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+/* Start the threads of a work queue.
+ *
+ * @param queue the queue
+ * @param threads the @p count threads of the queue
+ * @param stacks the @p count stacks of the threads
+ * @param stack_len distance between the stacks, in bytes
+ * @param stack_size size of each stack
+ * @param count the number of threads
+ * @param prio initial priority of the threads
+ * @param cfg optional additional configuration parameters
+ */
+static void work_queue_start(struct k_work_q *queue, struct k_thread *threads,
+			     k_thread_stack_t *stacks, size_t stack_len, size_t stack_size,
+			     size_t count, int prio, const struct k_work_queue_config *cfg)
 {
 	__ASSERT_NO_MSG(queue);
-	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(stacks);
 	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
 
 	uint32_t flags = K_WORK_QUEUE_STARTED;
@@ -831,22 +1103,44 @@ void k_work_queue_start(struct k_work_q *queue,
 		flags |= K_WORK_QUEUE_NO_YIELD;
 	}
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->threads = threads;
+	queue->num_threads = count;
+	queue->num_alive = count;
+	queue->num_busy = 0U;
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+#ifdef CONFIG_OBJ_CORE_WORK_Q
+	work_q_obj_core_link(queue);
+#endif /* CONFIG_OBJ_CORE_WORK_Q */
+
 	/* It hasn't actually been started yet, but all the state is in place
 	 * so we can submit things and once the thread gets control it's ready
 	 * to roll.
 	 */
 	flags_set(&queue->flags, flags);
 
-	(void)k_thread_create(&queue->thread, stack, stack_size,
-			      work_queue_main, queue, NULL, NULL,
-			      prio, 0, K_FOREVER);
+	for (size_t i = 0; i < count; i++) {
+		struct k_thread *thread = &threads[i];
 
-	if ((cfg != NULL) && (cfg->name != NULL)) {
-		k_thread_name_set(&queue->thread, cfg->name);
-	}
+		(void)k_thread_create(thread,
+				      (k_thread_stack_t *)((uint8_t *)stacks + i * stack_len),
+				      stack_size, work_queue_main, queue, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(thread, cfg->name);
+		}
+
+		if ((cfg != NULL) && (cfg->essential)) {
+			thread->base.user_options |= K_ESSENTIAL;
+		}
 
-	if ((cfg != NULL) && (cfg->essential)) {
-		queue->thread.base.user_options |= K_ESSENTIAL;
+#if defined(CONFIG_SCHED_CPU_MASK)
+		if ((cfg != NULL) && cfg->cpu_pin && (count > 1U)) {
+			(void)k_thread_cpu_pin(thread, i % arch_num_cpus());
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
 	}
 
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
@@ -857,12 +1151,42 @@ void k_work_queue_start(struct k_work_q *queue,
 	}
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
-	k_thread_start(&queue->thread);
-	queue->thread_id = &queue->thread;
+	queue->thread_id = &threads[0];
+
+	for (size_t i = 0; i < count; i++) {
+		k_thread_start(&threads[i]);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(stack);
+
+	work_queue_start(queue, &queue->thread, stack, 0, stack_size, 1, prio, cfg);
+}
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+void k_work_queue_start_pool(struct k_work_q *queue, struct k_thread *threads,
+			     k_thread_stack_t *stacks, size_t count, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg)
+{
+	size_t stack_len = K_KERNEL_STACK_LEN(stack_size);
+
+	__ASSERT_NO_MSG(threads);
+	__ASSERT_NO_MSG((count > 0U) && (count <= UINT8_MAX));
+
+	work_queue_start(queue, threads, stacks, stack_len,
+			 stack_len - K_KERNEL_STACK_RESERVED, count, prio, cfg);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -915,6 +1239,30 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* Wait for the threads of a stopped queue to exit.
+ *
+ * @param queue the queue
+ * @param timeout how long to wait for all the threads
+ *
+ * @retval 0 if all the threads exited
+ * @retval -EAGAIN if a thread did not exit within @p timeout
+ */
+static int queue_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret = 0;
+
+	for (size_t i = 0; (ret == 0) && (i < queue->num_threads); i++) {
+		ret = k_thread_join(&queue->threads[i], sys_timepoint_timeout(end));
+	}
+
+	return ret;
+#else
+	return k_thread_join(queue->thread_id, timeout);
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
@@ -935,10 +1283,14 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+#else
 	notify_queue_locked(queue);
+#endif /* CONFIG_WORKQUEUE_POOL */
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+	if (queue_join(queue, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
@@ -0,0 +1,172 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Slicing-by-4 CRC16-CCITT (reflected polynomial 0x8408), processing 4 bytes
+ * of data at a time with 4 tables of 256 entries. Table 0 is the usual byte
+ * table and entry i of table k is the CRC of byte i followed by k zero bytes:
+ *
+ *   table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff]
+ */
+
+#include <zephyr/sys/crc.h>
+
+static const uint16_t crc16_ccitt_table[4][256] = {
+	{
+		0x0000U, 0x1189U, 0x2312U, 0x329bU, 0x4624U, 0x57adU, 0x6536U, 0x74bfU,
+		0x8c48U, 0x9dc1U, 0xaf5aU, 0xbed3U, 0xca6cU, 0xdbe5U, 0xe97eU, 0xf8f7U,
+		0x1081U, 0x0108U, 0x3393U, 0x221aU, 0x56a5U, 0x472cU, 0x75b7U, 0x643eU,
+		0x9cc9U, 0x8d40U, 0xbfdbU, 0xae52U, 0xdaedU, 0xcb64U, 0xf9ffU, 0xe876U,
+		0x2102U, 0x308bU, 0x0210U, 0x1399U, 0x6726U, 0x76afU, 0x4434U, 0x55bdU,
+		0xad4aU, 0xbcc3U, 0x8e58U, 0x9fd1U, 0xeb6eU, 0xfae7U, 0xc87cU, 0xd9f5U,
+		0x3183U, 0x200aU, 0x1291U, 0x0318U, 0x77a7U, 0x662eU, 0x54b5U, 0x453cU,
+		0xbdcbU, 0xac42U, 0x9ed9U, 0x8f50U, 0xfbefU, 0xea66U, 0xd8fdU, 0xc974U,
+		0x4204U, 0x538dU, 0x6116U, 0x709fU, 0x0420U, 0x15a9U, 0x2732U, 0x36bbU,
+		0xce4cU, 0xdfc5U, 0xed5eU, 0xfcd7U, 0x8868U, 0x99e1U, 0xab7aU, 0xbaf3U,
+		0x5285U, 0x430cU, 0x7197U, 0x601eU, 0x14a1U, 0x0528U, 0x37b3U, 0x263aU,
+		0xdecdU, 0xcf44U, 0xfddfU, 0xec56U, 0x98e9U, 0x8960U, 0xbbfbU, 0xaa72U,
+		0x6306U, 0x728fU, 0x4014U, 0x519dU, 0x2522U, 0x34abU, 0x0630U, 0x17b9U,
+		0xef4eU, 0xfec7U, 0xcc5cU, 0xddd5U, 0xa96aU, 0xb8e3U, 0x8a78U, 0x9bf1U,
+		0x7387U, 0x620eU, 0x5095U, 0x411cU, 0x35a3U, 0x242aU, 0x16b1U, 0x0738U,
+		0xffcfU, 0xee46U, 0xdcddU, 0xcd54U, 0xb9ebU, 0xa862U, 0x9af9U, 0x8b70U,
+		0x8408U, 0x9581U, 0xa71aU, 0xb693U, 0xc22cU, 0xd3a5U, 0xe13eU, 0xf0b7U,
+		0x0840U, 0x19c9U, 0x2b52U, 0x3adbU, 0x4e64U, 0x5fedU, 0x6d76U, 0x7cffU,
+		0x9489U, 0x8500U, 0xb79bU, 0xa612U, 0xd2adU, 0xc324U, 0xf1bfU, 0xe036U,
+		0x18c1U, 0x0948U, 0x3bd3U, 0x2a5aU, 0x5ee5U, 0x4f6cU, 0x7df7U, 0x6c7eU,
+		0xa50aU, 0xb483U, 0x8618U, 0x9791U, 0xe32eU, 0xf2a7U, 0xc03cU, 0xd1b5U,
+		0x2942U, 0x38cbU, 0x0a50U, 0x1bd9U, 0x6f66U, 0x7eefU, 0x4c74U, 0x5dfdU,
+		0xb58bU, 0xa402U, 0x9699U, 0x8710U, 0xf3afU, 0xe226U, 0xd0bdU, 0xc134U,
+		0x39c3U, 0x284aU, 0x1ad1U, 0x0b58U, 0x7fe7U, 0x6e6eU, 0x5cf5U, 0x4d7cU,
+		0xc60cU, 0xd785U, 0xe51eU, 0xf497U, 0x8028U, 0x91a1U, 0xa33aU, 0xb2b3U,
+		0x4a44U, 0x5bcdU, 0x6956U, 0x78dfU, 0x0c60U, 0x1de9U, 0x2f72U, 0x3efbU,
+		0xd68dU, 0xc704U, 0xf59fU, 0xe416U, 0x90a9U, 0x8120U, 0xb3bbU, 0xa232U,
+		0x5ac5U, 0x4b4cU, 0x79d7U, 0x685eU, 0x1ce1U, 0x0d68U, 0x3ff3U, 0x2e7aU,
+		0xe70eU, 0xf687U, 0xc41cU, 0xd595U, 0xa12aU, 0xb0a3U, 0x8238U, 0x93b1U,
+		0x6b46U, 0x7acfU, 0x4854U, 0x59ddU, 0x2d62U, 0x3cebU, 0x0e70U, 0x1ff9U,
+		0xf78fU, 0xe606U, 0xd49dU, 0xc514U, 0xb1abU, 0xa022U, 0x92b9U, 0x8330U,
+		0x7bc7U, 0x6a4eU, 0x58d5U, 0x495cU, 0x3de3U, 0x2c6aU, 0x1ef1U, 0x0f78U,
+	},
+	{
+		0x0000U, 0x19d8U, 0x33b0U, 0x2a68U, 0x6760U, 0x7eb8U, 0x54d0U, 0x4d08U,
+		0xcec0U, 0xd718U, 0xfd70U, 0xe4a8U, 0xa9a0U, 0xb078U, 0x9a10U, 0x83c8U,
+		0x9591U, 0x8c49U, 0xa621U, 0xbff9U, 0xf2f1U, 0xeb29U, 0xc141U, 0xd899U,
+		0x5b51U, 0x4289U, 0x68e1U, 0x7139U, 0x3c31U, 0x25e9U, 0x0f81U, 0x1659U,
+		0x2333U, 0x3aebU, 0x1083U, 0x095bU, 0x4453U, 0x5d8bU, 0x77e3U, 0x6e3bU,
+		0xedf3U, 0xf42bU, 0xde43U, 0xc79bU, 0x8a93U, 0x934bU, 0xb923U, 0xa0fbU,
+		0xb6a2U, 0xaf7aU, 0x8512U, 0x9ccaU, 0xd1c2U, 0xc81aU, 0xe272U, 0xfbaaU,
+		0x7862U, 0x61baU, 0x4bd2U, 0x520aU, 0x1f02U, 0x06daU, 0x2cb2U, 0x356aU,
+		0x4666U, 0x5fbeU, 0x75d6U, 0x6c0eU, 0x2106U, 0x38deU, 0x12b6U, 0x0b6eU,
+		0x88a6U, 0x917eU, 0xbb16U, 0xa2ceU, 0xefc6U, 0xf61eU, 0xdc76U, 0xc5aeU,
+		0xd3f7U, 0xca2fU, 0xe047U, 0xf99fU, 0xb497U, 0xad4fU, 0x8727U, 0x9effU,
+		0x1d37U, 0x04efU, 0x2e87U, 0x375fU, 0x7a57U, 0x638fU, 0x49e7U, 0x503fU,
+		0x6555U, 0x7c8dU, 0x56e5U, 0x4f3dU, 0x0235U, 0x1bedU, 0x3185U, 0x285dU,
+		0xab95U, 0xb24dU, 0x9825U, 0x81fdU, 0xccf5U, 0xd52dU, 0xff45U, 0xe69dU,
+		0xf0c4U, 0xe91cU, 0xc374U, 0xdaacU, 0x97a4U, 0x8e7cU, 0xa414U, 0xbdccU,
+		0x3e04U, 0x27dcU, 0x0db4U, 0x146cU, 0x5964U, 0x40bcU, 0x6ad4U, 0x730cU,
+		0x8cccU, 0x9514U, 0xbf7cU, 0xa6a4U, 0xebacU, 0xf274U, 0xd81cU, 0xc1c4U,
+		0x420cU, 0x5bd4U, 0x71bcU, 0x6864U, 0x256cU, 0x3cb4U, 0x16dcU, 0x0f04U,
+		0x195dU, 0x0085U, 0x2aedU, 0x3335U, 0x7e3dU, 0x67e5U, 0x4d8dU, 0x5455U,
+		0xd79dU, 0xce45U, 0xe42dU, 0xfdf5U, 0xb0fdU, 0xa925U, 0x834dU, 0x9a95U,
+		0xafffU, 0xb627U, 0x9c4fU, 0x8597U, 0xc89fU, 0xd147U, 0xfb2fU, 0xe2f7U,
+		0x613fU, 0x78e7U, 0x528fU, 0x4b57U, 0x065fU, 0x1f87U, 0x35efU, 0x2c37U,
+		0x3a6eU, 0x23b6U, 0x09deU, 0x1006U, 0x5d0eU, 0x44d6U, 0x6ebeU, 0x7766U,
+		0xf4aeU, 0xed76U, 0xc71eU, 0xdec6U, 0x93ceU, 0x8a16U, 0xa07eU, 0xb9a6U,
+		0xcaaaU, 0xd372U, 0xf91aU, 0xe0c2U, 0xadcaU, 0xb412U, 0x9e7aU, 0x87a2U,
+		0x046aU, 0x1db2U, 0x37daU, 0x2e02U, 0x630aU, 0x7ad2U, 0x50baU, 0x4962U,
+		0x5f3bU, 0x46e3U, 0x6c8bU, 0x7553U, 0x385bU, 0x2183U, 0x0bebU, 0x1233U,
+		0x91fbU, 0x8823U, 0xa24bU, 0xbb93U, 0xf69bU, 0xef43U, 0xc52bU, 0xdcf3U,
+		0xe999U, 0xf041U, 0xda29U, 0xc3f1U, 0x8ef9U, 0x9721U, 0xbd49U, 0xa491U,
+		0x2759U, 0x3e81U, 0x14e9U, 0x0d31U, 0x4039U, 0x59e1U, 0x7389U, 0x6a51U,
+		0x7c08U, 0x65d0U, 0x4fb8U, 0x5660U, 0x1b68U, 0x02b0U, 0x28d8U, 0x3100U,
+		0xb2c8U, 0xab10U, 0x8178U, 0x98a0U, 0xd5a8U, 0xcc70U, 0xe618U, 0xffc0U,
+	},
+	{
+		0x0000U, 0x5adcU, 0xb5b8U, 0xef64U, 0x6361U, 0x39bdU, 0xd6d9U, 0x8c05U,
+		0xc6c2U, 0x9c1eU, 0x737aU, 0x29a6U, 0xa5a3U, 0xff7fU, 0x101bU, 0x4ac7U,
+		0x8595U, 0xdf49U, 0x302dU, 0x6af1U, 0xe6f4U, 0xbc28U, 0x534cU, 0x0990U,
+		0x4357U, 0x198bU, 0xf6efU, 0xac33U, 0x2036U, 0x7aeaU, 0x958eU, 0xcf52U,
+		0x033bU, 0x59e7U, 0xb683U, 0xec5fU, 0x605aU, 0x3a86U, 0xd5e2U, 0x8f3eU,
+		0xc5f9U, 0x9f25U, 0x7041U, 0x2a9dU, 0xa698U, 0xfc44U, 0x1320U, 0x49fcU,
+		0x86aeU, 0xdc72U, 0x3316U, 0x69caU, 0xe5cfU, 0xbf13U, 0x5077U, 0x0aabU,
+		0x406cU, 0x1ab0U, 0xf5d4U, 0xaf08U, 0x230dU, 0x79d1U, 0x96b5U, 0xcc69U,
+		0x0676U, 0x5caaU, 0xb3ceU, 0xe912U, 0x6517U, 0x3fcbU, 0xd0afU, 0x8a73U,
+		0xc0b4U, 0x9a68U, 0x750cU, 0x2fd0U, 0xa3d5U, 0xf909U, 0x166dU, 0x4cb1U,
+		0x83e3U, 0xd93fU, 0x365bU, 0x6c87U, 0xe082U, 0xba5eU, 0x553aU, 0x0fe6U,
+		0x4521U, 0x1ffdU, 0xf099U, 0xaa45U, 0x2640U, 0x7c9cU, 0x93f8U, 0xc924U,
+		0x054dU, 0x5f91U, 0xb0f5U, 0xea29U, 0x662cU, 0x3cf0U, 0xd394U, 0x8948U,
+		0xc38fU, 0x9953U, 0x7637U, 0x2cebU, 0xa0eeU, 0xfa32U, 0x1556U, 0x4f8aU,
+		0x80d8U, 0xda04U, 0x3560U, 0x6fbcU, 0xe3b9U, 0xb965U, 0x5601U, 0x0cddU,
+		0x461aU, 0x1cc6U, 0xf3a2U, 0xa97eU, 0x257bU, 0x7fa7U, 0x90c3U, 0xca1fU,
+		0x0cecU, 0x5630U, 0xb954U, 0xe388U, 0x6f8dU, 0x3551U, 0xda35U, 0x80e9U,
+		0xca2eU, 0x90f2U, 0x7f96U, 0x254aU, 0xa94fU, 0xf393U, 0x1cf7U, 0x462bU,
+		0x8979U, 0xd3a5U, 0x3cc1U, 0x661dU, 0xea18U, 0xb0c4U, 0x5fa0U, 0x057cU,
+		0x4fbbU, 0x1567U, 0xfa03U, 0xa0dfU, 0x2cdaU, 0x7606U, 0x9962U, 0xc3beU,
+		0x0fd7U, 0x550bU, 0xba6fU, 0xe0b3U, 0x6cb6U, 0x366aU, 0xd90eU, 0x83d2U,
+		0xc915U, 0x93c9U, 0x7cadU, 0x2671U, 0xaa74U, 0xf0a8U, 0x1fccU, 0x4510U,
+		0x8a42U, 0xd09eU, 0x3ffaU, 0x6526U, 0xe923U, 0xb3ffU, 0x5c9bU, 0x0647U,
+		0x4c80U, 0x165cU, 0xf938U, 0xa3e4U, 0x2fe1U, 0x753dU, 0x9a59U, 0xc085U,
+		0x0a9aU, 0x5046U, 0xbf22U, 0xe5feU, 0x69fbU, 0x3327U, 0xdc43U, 0x869fU,
+		0xcc58U, 0x9684U, 0x79e0U, 0x233cU, 0xaf39U, 0xf5e5U, 0x1a81U, 0x405dU,
+		0x8f0fU, 0xd5d3U, 0x3ab7U, 0x606bU, 0xec6eU, 0xb6b2U, 0x59d6U, 0x030aU,
+		0x49cdU, 0x1311U, 0xfc75U, 0xa6a9U, 0x2aacU, 0x7070U, 0x9f14U, 0xc5c8U,
+		0x09a1U, 0x537dU, 0xbc19U, 0xe6c5U, 0x6ac0U, 0x301cU, 0xdf78U, 0x85a4U,
+		0xcf63U, 0x95bfU, 0x7adbU, 0x2007U, 0xac02U, 0xf6deU, 0x19baU, 0x4366U,
+		0x8c34U, 0xd6e8U, 0x398cU, 0x6350U, 0xef55U, 0xb589U, 0x5aedU, 0x0031U,
+		0x4af6U, 0x102aU, 0xff4eU, 0xa592U, 0x2997U, 0x734bU, 0x9c2fU, 0xc6f3U,
+	},
+	{
+		0x0000U, 0x1cbbU, 0x3976U, 0x25cdU, 0x72ecU, 0x6e57U, 0x4b9aU, 0x5721U,
+		0xe5d8U, 0xf963U, 0xdcaeU, 0xc015U, 0x9734U, 0x8b8fU, 0xae42U, 0xb2f9U,
+		0xc3a1U, 0xdf1aU, 0xfad7U, 0xe66cU, 0xb14dU, 0xadf6U, 0x883bU, 0x9480U,
+		0x2679U, 0x3ac2U, 0x1f0fU, 0x03b4U, 0x5495U, 0x482eU, 0x6de3U, 0x7158U,
+		0x8f53U, 0x93e8U, 0xb625U, 0xaa9eU, 0xfdbfU, 0xe104U, 0xc4c9U, 0xd872U,
+		0x6a8bU, 0x7630U, 0x53fdU, 0x4f46U, 0x1867U, 0x04dcU, 0x2111U, 0x3daaU,
+		0x4cf2U, 0x5049U, 0x7584U, 0x693fU, 0x3e1eU, 0x22a5U, 0x0768U, 0x1bd3U,
+		0xa92aU, 0xb591U, 0x905cU, 0x8ce7U, 0xdbc6U, 0xc77dU, 0xe2b0U, 0xfe0bU,
+		0x16b7U, 0x0a0cU, 0x2fc1U, 0x337aU, 0x645bU, 0x78e0U, 0x5d2dU, 0x4196U,
+		0xf36fU, 0xefd4U, 0xca19U, 0xd6a2U, 0x8183U, 0x9d38U, 0xb8f5U, 0xa44eU,
+		0xd516U, 0xc9adU, 0xec60U, 0xf0dbU, 0xa7faU, 0xbb41U, 0x9e8cU, 0x8237U,
+		0x30ceU, 0x2c75U, 0x09b8U, 0x1503U, 0x4222U, 0x5e99U, 0x7b54U, 0x67efU,
+		0x99e4U, 0x855fU, 0xa092U, 0xbc29U, 0xeb08U, 0xf7b3U, 0xd27eU, 0xcec5U,
+		0x7c3cU, 0x6087U, 0x454aU, 0x59f1U, 0x0ed0U, 0x126bU, 0x37a6U, 0x2b1dU,
+		0x5a45U, 0x46feU, 0x6333U, 0x7f88U, 0x28a9U, 0x3412U, 0x11dfU, 0x0d64U,
+		0xbf9dU, 0xa326U, 0x86ebU, 0x9a50U, 0xcd71U, 0xd1caU, 0xf407U, 0xe8bcU,
+		0x2d6eU, 0x31d5U, 0x1418U, 0x08a3U, 0x5f82U, 0x4339U, 0x66f4U, 0x7a4fU,
+		0xc8b6U, 0xd40dU, 0xf1c0U, 0xed7bU, 0xba5aU, 0xa6e1U, 0x832cU, 0x9f97U,
+		0xeecfU, 0xf274U, 0xd7b9U, 0xcb02U, 0x9c23U, 0x8098U, 0xa555U, 0xb9eeU,
+		0x0b17U, 0x17acU, 0x3261U, 0x2edaU, 0x79fbU, 0x6540U, 0x408dU, 0x5c36U,
+		0xa23dU, 0xbe86U, 0x9b4bU, 0x87f0U, 0xd0d1U, 0xcc6aU, 0xe9a7U, 0xf51cU,
+		0x47e5U, 0x5b5eU, 0x7e93U, 0x6228U, 0x3509U, 0x29b2U, 0x0c7fU, 0x10c4U,
+		0x619cU, 0x7d27U, 0x58eaU, 0x4451U, 0x1370U, 0x0fcbU, 0x2a06U, 0x36bdU,
+		0x8444U, 0x98ffU, 0xbd32U, 0xa189U, 0xf6a8U, 0xea13U, 0xcfdeU, 0xd365U,
+		0x3bd9U, 0x2762U, 0x02afU, 0x1e14U, 0x4935U, 0x558eU, 0x7043U, 0x6cf8U,
+		0xde01U, 0xc2baU, 0xe777U, 0xfbccU, 0xacedU, 0xb056U, 0x959bU, 0x8920U,
+		0xf878U, 0xe4c3U, 0xc10eU, 0xddb5U, 0x8a94U, 0x962fU, 0xb3e2U, 0xaf59U,
+		0x1da0U, 0x011bU, 0x24d6U, 0x386dU, 0x6f4cU, 0x73f7U, 0x563aU, 0x4a81U,
+		0xb48aU, 0xa831U, 0x8dfcU, 0x9147U, 0xc666U, 0xdaddU, 0xff10U, 0xe3abU,
+		0x5152U, 0x4de9U, 0x6824U, 0x749fU, 0x23beU, 0x3f05U, 0x1ac8U, 0x0673U,
+		0x772bU, 0x6b90U, 0x4e5dU, 0x52e6U, 0x05c7U, 0x197cU, 0x3cb1U, 0x200aU,
+		0x92f3U, 0x8e48U, 0xab85U, 0xb73eU, 0xe01fU, 0xfca4U, 0xd969U, 0xc5d2U,
+	},
+};
+
+uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
+{
+	uint16_t crc = seed;
+
+	for (; len >= 4; len -= 4, src += 4) {
+		/* The CRC is fully shifted out by the first two bytes */
+		crc ^= (uint16_t)src[0] | ((uint16_t)src[1] << 8);
+		crc = crc16_ccitt_table[3][crc & 0xff] ^ crc16_ccitt_table[2][crc >> 8] ^
+		      crc16_ccitt_table[1][src[2]] ^ crc16_ccitt_table[0][src[3]];
+	}
+
+	for (; len > 0; len--, src++) {
+		crc = (crc >> 8) ^ crc16_ccitt_table[0][(crc ^ *src) & 0xff];
+	}
+
+	return crc;
+}
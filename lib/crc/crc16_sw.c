@@ -49,6 +49,7 @@ uint16_t crc16_reflect(uint16_t poly, uint16_t seed, const uint8_t *src, size_t
 }
 
 
+#if !defined(CONFIG_CRC16_CCITT_SLICING_BY_4)
 uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
 {
 	for (; len > 0; len--) {
@@ -62,6 +63,7 @@ uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
 
 	return seed;
 }
+#endif
 
 uint16_t crc16_itu_t(uint16_t seed, const uint8_t *src, size_t len)
 {
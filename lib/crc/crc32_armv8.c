@@ -0,0 +1,48 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CRC32 using the CRC32 instructions of ARMv8, which implement both the
+ * IEEE and the Castagnoli polynomials.
+ */
+
+#include <arm_acle.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include "crc32_priv.h"
+
+#if !defined(__ARM_FEATURE_CRC32)
+#error "The CRC32 instructions are not enabled for the target CPU"
+#endif
+
+uint32_t z_crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (; len >= sizeof(uint64_t); len -= sizeof(uint64_t)) {
+		crc = __crc32d(crc, sys_get_le64(data));
+		data += sizeof(uint64_t);
+	}
+
+	while (len-- > 0) {
+		crc = __crc32b(crc, *data++);
+	}
+
+	return crc;
+}
+
+uint32_t z_crc32c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (; len >= sizeof(uint64_t); len -= sizeof(uint64_t)) {
+		crc = __crc32cd(crc, sys_get_le64(data));
+		data += sizeof(uint64_t);
+	}
+
+	while (len-- > 0) {
+		crc = __crc32cb(crc, *data++);
+	}
+
+	return crc;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_PRIV_H_
+#define ZEPHYR_LIB_CRC_CRC32_PRIV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Update the CRC32 of the IEEE and Castagnoli polynomials, reflected, with
+ * len bytes of data. The initial value is neither applied nor the result
+ * inverted: crc32_ieee_update() and crc32_c() take care of it.
+ *
+ * The nibble table implementation of crc32_sw.c and crc32c_sw.c is used
+ * unless an implementation below is selected.
+ */
+#if defined(CONFIG_CRC32_SLICING_BY_8) || defined(CONFIG_CRC32_HW_ARMV8) || \
+	defined(CONFIG_CRC32_HW_RISCV_ZBC) || defined(CONFIG_CRC32_HW_X86_PCLMUL)
+#define CRC32_ACCELERATED 1
+#endif
+
+uint32_t z_crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len);
+uint32_t z_crc32c_update(uint32_t crc, const uint8_t *data, size_t len);
+
+/* Bit by bit update, for the few bytes not handled by a carry-less multiplier */
+static inline uint32_t crc32_bitwise_update(uint32_t crc, uint32_t poly, const uint8_t *data,
+					    size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+		}
+	}
+
+	return crc;
+}
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_PRIV_H_ */
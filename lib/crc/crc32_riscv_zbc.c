@@ -0,0 +1,84 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CRC32 using the carry-less multiplication instructions of the RISC-V Zbc
+ * extension, one register of data at a time with a Barrett reduction.
+ *
+ * For a reflected polynomial P, with XLEN bits of data s xored with the
+ * CRC:
+ *   q = s ^ (clmul(s, mu) << 1)
+ *   crc = clmulr(q, P) (XLEN 32) or clmulr(q, P << 32) >> 32 (XLEN 64)
+ * where mu is the reflected floor(x^(XLEN + 32) / P) without its top bit.
+ */
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include "crc32_priv.h"
+
+#define CRC32_IEEE_POLY 0xedb88320U
+#define CRC32C_POLY     0x82f63b78U
+
+#if defined(CONFIG_64BIT)
+#define CRC32_IEEE_MU 0x5a72d812fb808b20UL
+#define CRC32C_MU     0xa434f61c6f5389f8UL
+#define crc32_get_word(data) sys_get_le64(data)
+#else
+#define CRC32_IEEE_MU 0xfb808b20UL
+#define CRC32C_MU     0x6f5389f8UL
+#define crc32_get_word(data) sys_get_le32(data)
+#endif
+
+static inline unsigned long clmul(unsigned long a, unsigned long b)
+{
+	unsigned long r;
+
+	__asm__ ("clmul %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+
+	return r;
+}
+
+static inline unsigned long clmulr(unsigned long a, unsigned long b)
+{
+	unsigned long r;
+
+	__asm__ ("clmulr %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+
+	return r;
+}
+
+static uint32_t crc32_zbc_update(uint32_t crc, uint32_t poly, unsigned long mu,
+				 const uint8_t *data, size_t len)
+{
+	unsigned long s;
+	unsigned long q;
+
+	for (; len >= sizeof(unsigned long); len -= sizeof(unsigned long)) {
+		s = crc32_get_word(data) ^ crc;
+		q = s ^ (clmul(s, mu) << 1);
+
+#if defined(CONFIG_64BIT)
+		crc = clmulr(q, (unsigned long)poly << 32) >> 32;
+#else
+		crc = clmulr(q, poly);
+#endif
+
+		data += sizeof(unsigned long);
+	}
+
+	return crc32_bitwise_update(crc, poly, data, len);
+}
+
+uint32_t z_crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	return crc32_zbc_update(crc, CRC32_IEEE_POLY, CRC32_IEEE_MU, data, len);
+}
+
+uint32_t z_crc32c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	return crc32_zbc_update(crc, CRC32C_POLY, CRC32C_MU, data, len);
+}
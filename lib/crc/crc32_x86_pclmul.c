@@ -0,0 +1,60 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CRC32 using the PCLMULQDQ carry-less multiplication instruction, 8 bytes
+ * of data at a time with a Barrett reduction.
+ *
+ * For a reflected polynomial P, with 64 bits of data s xored with the CRC:
+ *   q = s ^ (low64(s * mu) << 1)
+ *   crc = bits 95 to 126 of q * (P << 32)
+ * where mu is the reflected floor(x^96 / P) without its top bit.
+ */
+
+#include <wmmintrin.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include "crc32_priv.h"
+
+#define CRC32_IEEE_POLY 0xedb88320U
+#define CRC32_IEEE_MU   0x5a72d812fb808b20ULL
+#define CRC32C_POLY     0x82f63b78U
+#define CRC32C_MU       0xa434f61c6f5389f8ULL
+
+__attribute__((target("pclmul")))
+static uint32_t crc32_pclmul_update(uint32_t crc, uint32_t poly, uint64_t mu,
+				    const uint8_t *data, size_t len)
+{
+	__m128i p;
+	uint64_t s;
+	uint64_t q;
+
+	for (; len >= sizeof(uint64_t); len -= sizeof(uint64_t)) {
+		s = sys_get_le64(data) ^ crc;
+
+		p = _mm_clmulepi64_si128(_mm_cvtsi64_si128(s), _mm_cvtsi64_si128(mu), 0x00);
+		q = s ^ ((uint64_t)_mm_cvtsi128_si64(p) << 1);
+
+		p = _mm_clmulepi64_si128(_mm_cvtsi64_si128(q),
+					 _mm_cvtsi64_si128((uint64_t)poly << 32), 0x00);
+		crc = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(p, p)) >> 31;
+
+		data += sizeof(uint64_t);
+	}
+
+	return crc32_bitwise_update(crc, poly, data, len);
+}
+
+uint32_t z_crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	return crc32_pclmul_update(crc, CRC32_IEEE_POLY, CRC32_IEEE_MU, data, len);
+}
+
+uint32_t z_crc32c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	return crc32_pclmul_update(crc, CRC32C_POLY, CRC32C_MU, data, len);
+}
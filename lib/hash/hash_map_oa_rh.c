@@ -0,0 +1,324 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Robin Hood hashing: on insertion, an entry takes the bucket of any entry
+ * closer to its home bucket than itself. Probe sequences stay short at high
+ * load factors, a lookup stops as soon as it meets an entry closer to its
+ * home than the key would be, and removal shifts the following entries back
+ * instead of leaving tombstones.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_oa_rh.h>
+#include <zephyr/sys/util.h>
+
+/* Distance of an unused bucket, entries are 1 + their distance to home */
+#define UNUSED 0
+
+struct oarh_buckets {
+	uint64_t *keys;
+	uint64_t *values;
+	uint32_t *dist;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_rh_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_rh_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_rh_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static inline size_t oarh_bucket_size(void)
+{
+	return 2 * sizeof(uint64_t) + sizeof(uint32_t);
+}
+
+static inline struct oarh_buckets oarh_buckets(void *mem, size_t n_buckets)
+{
+	uint64_t *keys = mem;
+
+	return (struct oarh_buckets){
+		.keys = keys,
+		.values = keys + n_buckets,
+		.dist = (uint32_t *)(keys + 2 * n_buckets),
+	};
+}
+
+static bool sys_hashmap_oa_rh_find(const struct sys_hashmap *map, uint64_t key, size_t *index)
+{
+	const size_t n_buckets = map->data->n_buckets;
+	const struct oarh_buckets b = oarh_buckets(map->data->buckets, n_buckets);
+	uint32_t hash;
+	uint32_t d;
+	size_t i;
+
+	if (n_buckets == 0) {
+		return false;
+	}
+
+	hash = map->hash_func(&key, sizeof(key));
+
+	for (i = hash & (n_buckets - 1), d = 1; d <= n_buckets; i = (i + 1) & (n_buckets - 1), ++d) {
+		/* the key would have taken the bucket of a closer entry */
+		if (b.dist[i] < d) {
+			return false;
+		}
+
+		if (b.dist[i] == d && b.keys[i] == key) {
+			*index = i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static int sys_hashmap_oa_rh_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					      uint64_t *old_value)
+{
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+	const size_t n_buckets = data->n_buckets;
+	const struct oarh_buckets b = oarh_buckets(data->buckets, n_buckets);
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+	bool evicted = false;
+	uint64_t tmp_key;
+	uint64_t tmp_value;
+	uint32_t tmp_dist;
+	uint32_t d;
+	size_t i;
+
+	for (i = hash & (n_buckets - 1), d = 1;; i = (i + 1) & (n_buckets - 1), ++d) {
+		__ASSERT(d <= n_buckets, "Hashmap full");
+
+		if (b.dist[i] == UNUSED) {
+			b.keys[i] = key;
+			b.values[i] = value;
+			b.dist[i] = d;
+			break;
+		}
+
+		if (!evicted && b.dist[i] == d && b.keys[i] == key) {
+			if (old_value != NULL) {
+				*old_value = b.values[i];
+			}
+
+			b.values[i] = value;
+
+			return 0;
+		}
+
+		/* the key is not further away: rob the richer entry of its bucket
+		 * and carry on inserting that entry instead
+		 */
+		if (b.dist[i] < d) {
+			tmp_key = b.keys[i];
+			tmp_value = b.values[i];
+			tmp_dist = b.dist[i];
+
+			b.keys[i] = key;
+			b.values[i] = value;
+			b.dist[i] = d;
+
+			key = tmp_key;
+			value = tmp_value;
+			d = tmp_dist;
+			evicted = true;
+		}
+	}
+
+	++data->size;
+
+	return 1;
+}
+
+static int sys_hashmap_oa_rh_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_n_buckets;
+	size_t new_n_buckets = 0;
+	struct oarh_buckets old;
+	void *old_mem;
+	void *new_mem;
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, 0, &new_n_buckets)) {
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	old_n_buckets = data->n_buckets;
+	old_mem = data->buckets;
+	old = oarh_buckets(old_mem, old_n_buckets);
+
+	new_mem = map->alloc_func(NULL, new_n_buckets * oarh_bucket_size());
+	if (new_mem == NULL && new_n_buckets != 0) {
+		return -ENOMEM;
+	}
+
+	if (new_mem != NULL) {
+		/* only the distances tell whether a bucket is used */
+		memset(oarh_buckets(new_mem, new_n_buckets).dist, 0,
+		       new_n_buckets * sizeof(uint32_t));
+	}
+
+	data->size = 0;
+	data->buckets = new_mem;
+	data->n_buckets = new_n_buckets;
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0; i < old_n_buckets; ++i) {
+		if (old.dist[i] != UNUSED) {
+			sys_hashmap_oa_rh_insert_no_rehash(map, old.keys[i], old.values[i], NULL);
+		}
+	}
+
+	/* free the old Hashmap */
+	map->alloc_func(old_mem, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_oa_rh_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	const struct oarh_buckets b = oarh_buckets(map->data->buckets, map->data->n_buckets);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = b.dist;
+	}
+
+	i = (uint32_t *)it->state - b.dist;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		if (b.dist[i] != UNUSED) {
+			it->state = &b.dist[i + 1];
+			it->key = b.keys[i];
+			it->value = b.values[i];
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Open Addressing / Robin Hood Hashmap API
+ */
+
+static void sys_hashmap_oa_rh_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_oa_rh_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_oa_rh_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+	const struct oarh_buckets b = oarh_buckets(data->buckets, data->n_buckets);
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		if (b.dist[i] != UNUSED) {
+			cb(b.keys[i], b.values[i], cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static inline int sys_hashmap_oa_rh_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					   uint64_t *old_value)
+{
+	int ret;
+
+	ret = sys_hashmap_oa_rh_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return sys_hashmap_oa_rh_insert_no_rehash(map, key, value, old_value);
+}
+
+static bool sys_hashmap_oa_rh_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+	const size_t n_buckets = data->n_buckets;
+	const struct oarh_buckets b = oarh_buckets(data->buckets, n_buckets);
+	size_t next;
+	size_t i;
+
+	if (!sys_hashmap_oa_rh_find(map, key, &i)) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = b.values[i];
+	}
+
+	/* shift back the following entries until one is at home or unused */
+	for (next = (i + 1) & (n_buckets - 1); b.dist[next] > 1;
+	     i = next, next = (next + 1) & (n_buckets - 1)) {
+		b.keys[i] = b.keys[next];
+		b.values[i] = b.values[next];
+		b.dist[i] = b.dist[next] - 1;
+	}
+
+	b.dist[i] = UNUSED;
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_oa_rh_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_oa_rh_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t i;
+
+	if (!sys_hashmap_oa_rh_find(map, key, &i)) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = oarh_buckets(map->data->buckets, map->data->n_buckets).values[i];
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_oa_rh_api = {
+	.iter = sys_hashmap_oa_rh_iter,
+	.clear = sys_hashmap_oa_rh_clear,
+	.insert = sys_hashmap_oa_rh_insert,
+	.remove = sys_hashmap_oa_rh_remove,
+	.get = sys_hashmap_oa_rh_get,
+};
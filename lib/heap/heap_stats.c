@@ -32,3 +32,30 @@ int sys_heap_runtime_stats_reset_max(struct sys_heap *heap)
 
 	return 0;
 }
+
+#ifdef CONFIG_HEAP_MAGAZINE
+int k_heap_magazine_stats_get(struct k_heap *heap, unsigned int size_class,
+			      struct k_heap_magazine_stats *stats)
+{
+	if ((heap == NULL) || (stats == NULL) ||
+	    (size_class >= CONFIG_HEAP_MAGAZINE_CLASSES)) {
+		return -EINVAL;
+	}
+
+	*stats = (struct k_heap_magazine_stats) {
+		.block_size = Z_HEAP_MAGAZINE_BLOCK_SIZE(size_class),
+	};
+
+	/* Unlocked like the sys_heap counters: a snapshot, not a barrier */
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		const struct z_heap_magazine *mag = &heap->cache[i].mags[size_class];
+
+		stats->cached_bytes += mag->count * stats->block_size;
+		stats->hits += mag->hits;
+		stats->misses += mag->misses;
+		stats->flushes += mag->flushes;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_HEAP_MAGAZINE */
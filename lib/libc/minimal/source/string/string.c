@@ -10,6 +10,11 @@
 #include <stdint.h>
 #include <sys/types.h>
 
+#if defined(CONFIG_MINIMAL_LIBC_STRING_SIMD)
+#include "string_simd.h"
+#define SIMD_THRESHOLD CONFIG_MINIMAL_LIBC_STRING_SIMD_THRESHOLD
+#endif
+
 /**
  *
  * @brief Copy a string
@@ -219,8 +224,14 @@ char *strncat(char *ZRESTRICT dest, const char *ZRESTRICT src,
  */
 int memcmp(const void *m1, const void *m2, size_t n)
 {
-	const char *c1 = m1;
-	const char *c2 = m2;
+	const unsigned char *c1 = m1;
+	const unsigned char *c2 = m2;
+
+#if defined(CONFIG_MINIMAL_LIBC_STRING_SIMD)
+	if (n >= SIMD_THRESHOLD) {
+		return z_simd_memcmp(m1, m2, n);
+	}
+#endif
 
 	if (!n) {
 		return 0;
@@ -283,6 +294,13 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
+#if defined(CONFIG_MINIMAL_LIBC_STRING_SIMD)
+	if (n >= SIMD_THRESHOLD) {
+		z_simd_memcpy(d, s, n);
+		return d;
+	}
+#endif
+
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
 	const uintptr_t mask = sizeof(mem_word_t) - 1;
 
@@ -337,6 +355,13 @@ void *memset(void *buf, int c, size_t n)
 	unsigned char *d_byte = (unsigned char *)buf;
 	unsigned char c_byte = (unsigned char)c;
 
+#if defined(CONFIG_MINIMAL_LIBC_STRING_SIMD)
+	if (n >= SIMD_THRESHOLD) {
+		z_simd_memset(buf, c_byte, n);
+		return buf;
+	}
+#endif
+
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
 	while (((uintptr_t)d_byte) & (sizeof(mem_word_t) - 1)) {
 		if (n == 0) {
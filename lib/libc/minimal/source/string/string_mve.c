@@ -0,0 +1,83 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Memory routines using the M-Profile Vector Extension (Helium). The tail
+ * of each area is processed with a predicated access rather than byte per
+ * byte.
+ */
+
+#include <arm_mve.h>
+
+#include "string_simd.h"
+
+#if !defined(__ARM_FEATURE_MVE)
+#error "MVE not supported by the compiler options"
+#endif
+
+#define VEC_LEN 16U
+
+void z_simd_memcpy(void *d, const void *s, size_t n)
+{
+	uint8_t *dst = d;
+	const uint8_t *src = s;
+	mve_pred16_t p;
+
+	for (; n >= VEC_LEN; n -= VEC_LEN) {
+		vst1q_u8(dst, vld1q_u8(src));
+		dst += VEC_LEN;
+		src += VEC_LEN;
+	}
+
+	if (n > 0) {
+		p = vctp8q(n);
+		vstrbq_p_u8(dst, vldrbq_z_u8(src, p), p);
+	}
+}
+
+void z_simd_memset(void *buf, unsigned char c, size_t n)
+{
+	uint8x16_t v = vdupq_n_u8(c);
+	uint8_t *dst = buf;
+
+	for (; n >= VEC_LEN; n -= VEC_LEN) {
+		vst1q_u8(dst, v);
+		dst += VEC_LEN;
+	}
+
+	if (n > 0) {
+		vstrbq_p_u8(dst, v, vctp8q(n));
+	}
+}
+
+int z_simd_memcmp(const void *m1, const void *m2, size_t n)
+{
+	const uint8_t *c1 = m1;
+	const uint8_t *c2 = m2;
+	mve_pred16_t ne;
+	mve_pred16_t p;
+	unsigned int i;
+
+	while (n > 0) {
+		p = vctp8q(n);
+		ne = vcmpneq_m_u8(vldrbq_z_u8(c1, p), vldrbq_z_u8(c2, p), p);
+		if (ne != 0) {
+			/* One predicate bit per byte lane */
+			i = __builtin_ctz(ne);
+			return c1[i] - c2[i];
+		}
+
+		if (n <= VEC_LEN) {
+			break;
+		}
+
+		n -= VEC_LEN;
+		c1 += VEC_LEN;
+		c2 += VEC_LEN;
+	}
+
+	return 0;
+}
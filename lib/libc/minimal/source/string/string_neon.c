@@ -0,0 +1,97 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Memory routines using the Advanced SIMD (NEON) registers of ARMv8-A,
+ * 32 bytes per iteration.
+ */
+
+#include <arm_neon.h>
+
+#include "string_simd.h"
+
+#define VEC_LEN 16U
+
+void z_simd_memcpy(void *d, const void *s, size_t n)
+{
+	uint8_t *dst = d;
+	const uint8_t *src = s;
+
+	for (; n >= 2 * VEC_LEN; n -= 2 * VEC_LEN) {
+		uint8x16_t v0 = vld1q_u8(src);
+		uint8x16_t v1 = vld1q_u8(src + VEC_LEN);
+
+		vst1q_u8(dst, v0);
+		vst1q_u8(dst + VEC_LEN, v1);
+		dst += 2 * VEC_LEN;
+		src += 2 * VEC_LEN;
+	}
+
+	if (n >= VEC_LEN) {
+		vst1q_u8(dst, vld1q_u8(src));
+		dst += VEC_LEN;
+		src += VEC_LEN;
+		n -= VEC_LEN;
+	}
+
+	/* Areas are never shorter than a vector: copy the last one again,
+	 * overlapping what is already copied, instead of looping on bytes.
+	 */
+	if (n > 0) {
+		vst1q_u8(dst + n - VEC_LEN, vld1q_u8(src + n - VEC_LEN));
+	}
+}
+
+void z_simd_memset(void *buf, unsigned char c, size_t n)
+{
+	uint8x16_t v = vdupq_n_u8(c);
+	uint8_t *dst = buf;
+
+	for (; n >= 2 * VEC_LEN; n -= 2 * VEC_LEN) {
+		vst1q_u8(dst, v);
+		vst1q_u8(dst + VEC_LEN, v);
+		dst += 2 * VEC_LEN;
+	}
+
+	if (n >= VEC_LEN) {
+		vst1q_u8(dst, v);
+		dst += VEC_LEN;
+		n -= VEC_LEN;
+	}
+
+	if (n > 0) {
+		vst1q_u8(dst + n - VEC_LEN, v);
+	}
+}
+
+int z_simd_memcmp(const void *m1, const void *m2, size_t n)
+{
+	const uint8_t *c1 = m1;
+	const uint8_t *c2 = m2;
+
+	for (; n >= VEC_LEN; n -= VEC_LEN) {
+		uint8x16_t eq = vceqq_u8(vld1q_u8(c1), vld1q_u8(c2));
+
+		if (vminvq_u8(eq) != 0xffU) {
+			break;
+		}
+
+		c1 += VEC_LEN;
+		c2 += VEC_LEN;
+	}
+
+	/* Locate the difference, if any, within the last bytes */
+	for (; n > 0; n--) {
+		if (*c1 != *c2) {
+			return *c1 - *c2;
+		}
+
+		c1++;
+		c2++;
+	}
+
+	return 0;
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_LIBC_MINIMAL_SOURCE_STRING_STRING_SIMD_H_
+#define ZEPHYR_LIB_LIBC_MINIMAL_SOURCE_STRING_STRING_SIMD_H_
+
+#include <stddef.h>
+
+/*
+ * Vector implementations of the memory routines, used by string.c for
+ * areas of at least CONFIG_MINIMAL_LIBC_STRING_SIMD_THRESHOLD bytes.
+ * They make no assumption on the alignment of the areas.
+ */
+void z_simd_memcpy(void *d, const void *s, size_t n);
+void z_simd_memset(void *buf, unsigned char c, size_t n);
+int z_simd_memcmp(const void *m1, const void *m2, size_t n);
+
+#endif /* ZEPHYR_LIB_LIBC_MINIMAL_SOURCE_STRING_STRING_SIMD_H_ */
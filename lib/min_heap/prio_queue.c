@@ -0,0 +1,67 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/sys/prio_queue.h>
+
+int sys_prio_queue_init(struct sys_prio_queue *queue, void *storage, size_t cap,
+			size_t elem_size, min_heap_cmp_t cmp)
+{
+	if (cap == 0) {
+		return -EINVAL;
+	}
+
+	min_heap_init(&queue->heap, storage, cap, elem_size, cmp);
+
+	return k_sem_init(&queue->count, 0, cap);
+}
+
+int sys_prio_queue_push(struct sys_prio_queue *queue, const void *item)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	int ret;
+
+	ret = min_heap_push(&queue->heap, item);
+	k_spin_unlock(&queue->lock, key);
+
+	if (ret == 0) {
+		k_sem_give(&queue->count);
+	}
+
+	return ret;
+}
+
+int sys_prio_queue_pop(struct sys_prio_queue *queue, void *out_buf, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	/* Each taken count is a reservation for one element of the heap */
+	ret = k_sem_take(&queue->count, timeout);
+	if (ret < 0) {
+		return ret;
+	}
+
+	key = k_spin_lock(&queue->lock);
+	(void)min_heap_pop(&queue->heap, out_buf);
+	k_spin_unlock(&queue->lock, key);
+
+	return 0;
+}
+
+int sys_prio_queue_peek(struct sys_prio_queue *queue, void *out_buf)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	void *top = min_heap_peek(&queue->heap);
+
+	if (top != NULL) {
+		memcpy(out_buf, top, queue->heap.elem_size);
+	}
+
+	k_spin_unlock(&queue->lock, key);
+
+	return top != NULL ? 0 : -ENOENT;
+}
@@ -17,6 +17,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/cache.h>
 
 #include <zephyr/net_buf.h>
 
@@ -344,6 +345,122 @@ success:
 	return buf;
 }
 
+#if defined(CONFIG_NET_BUF_LOG)
+struct net_buf *net_buf_alloc_bulk_debug(struct net_buf_pool *pool, size_t size,
+					 size_t count, k_timeout_t timeout,
+					 const char *func, int line)
+#else
+struct net_buf *net_buf_alloc_bulk(struct net_buf_pool *pool, size_t size,
+				   size_t count, k_timeout_t timeout)
+#endif
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct net_buf *first = NULL;
+	struct net_buf **next = &first;
+	struct net_buf *buf;
+	k_spinlock_key_t key;
+	size_t taken;
+
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(count > 0);
+
+	NET_BUF_DBG("%s():%d: pool %p size %zu count %zu", func, line, pool,
+		    size, count);
+
+	/* Take the buffers that are available right away with a single
+	 * acquisition of the pool lock.
+	 */
+	key = k_spin_lock(&pool->lock);
+
+	for (taken = 0; taken < count; taken++) {
+		buf = NULL;
+
+		if (pool->uninit_count < pool->buf_count) {
+			buf = k_lifo_get(&pool->free, K_NO_WAIT);
+		}
+
+		if (!buf && pool->uninit_count) {
+			buf = pool_get_uninit(pool, pool->uninit_count--);
+		}
+
+		if (!buf) {
+			break;
+		}
+
+		*next = buf;
+		next = &buf->frags;
+	}
+
+	k_spin_unlock(&pool->lock, key);
+
+	/* Wait for the others to be freed */
+	for (; taken < count; taken++) {
+		buf = k_lifo_get(&pool->free, sys_timepoint_timeout(end));
+		if (!buf) {
+			break;
+		}
+
+		*next = buf;
+		next = &buf->frags;
+	}
+
+	*next = NULL;
+
+	/* Every buffer must be valid for net_buf_unref() if the allocation
+	 * fails afterwards.
+	 */
+	for (buf = first; buf; buf = buf->frags) {
+		buf->__buf = NULL;
+		buf->ref   = 1U;
+		buf->flags = 0U;
+		buf->size  = 0U;
+		memset(buf->user_data, 0, buf->user_data_size);
+	}
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_sub(&pool->avail_count, taken);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+	pool->max_used = MAX(pool->max_used,
+			     pool->buf_count - atomic_get(&pool->avail_count));
+#endif
+
+	if (taken < count) {
+		NET_BUF_ERR("%s():%d: Failed to get %zu free buffers", func, line,
+			    count);
+		goto fail;
+	}
+
+	for (buf = first; buf; buf = buf->frags) {
+		if (size) {
+			size_t buf_size = size;
+
+			buf->__buf = data_alloc(buf, &buf_size,
+						sys_timepoint_timeout(end));
+			if (!buf->__buf) {
+				NET_BUF_ERR("%s():%d: Failed to allocate data",
+					    func, line);
+				goto fail;
+			}
+
+			NET_BUF_ASSERT(size <= buf_size);
+			buf->size = buf_size;
+		}
+
+		net_buf_simple_reset(&buf->b);
+	}
+
+	NET_BUF_DBG("allocated bufs %p", first);
+
+	return first;
+
+fail:
+	if (first) {
+		net_buf_unref(first);
+	}
+
+	return NULL;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_fixed_debug(struct net_buf_pool *pool,
 					  k_timeout_t timeout, const char *func,
@@ -418,12 +535,29 @@ struct net_buf *net_buf_slist_get(sys_slist_t *list)
 	return buf;
 }
 
+/* Put the buffers of a list back into the free LIFO of their pool, taking the
+ * LIFO lock once.
+ */
+static void pool_put_list(struct net_buf_pool *pool, struct net_buf *head,
+			  struct net_buf *tail)
+{
+	if (head == tail) {
+		k_lifo_put(&pool->free, head);
+	} else {
+		k_queue_append_list(&pool->free._queue, head, tail);
+	}
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
 #else
 void net_buf_unref(struct net_buf *buf)
 #endif
 {
+	struct net_buf_pool *free_pool = NULL;
+	struct net_buf *head = NULL;
+	struct net_buf *tail = NULL;
+
 	__ASSERT_NO_MSG(buf);
 
 	while (buf) {
@@ -434,14 +568,14 @@ void net_buf_unref(struct net_buf *buf)
 		if (!buf->ref) {
 			NET_BUF_ERR("%s():%d: buf %p double free", func, line,
 				    buf);
-			return;
+			break;
 		}
 #endif
 		NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
 			    buf->pool_id, buf->frags);
 
 		if (--buf->ref > 0) {
-			return;
+			break;
 		}
 
 		buf->data = NULL;
@@ -456,12 +590,42 @@ void net_buf_unref(struct net_buf *buf)
 
 		if (pool->destroy) {
 			pool->destroy(buf);
+			buf = frags;
+			continue;
+		}
+
+		if (buf->__buf) {
+			if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+				pool->alloc->cb->unref(buf, buf->__buf);
+			}
+			buf->__buf = NULL;
+		}
+
+		/* Consecutive fragments from the same pool are returned to
+		 * it at once.
+		 */
+		if (pool != free_pool) {
+			if (head) {
+				pool_put_list(free_pool, head, tail);
+			}
+			free_pool = pool;
+			head = NULL;
+		}
+
+		buf->node.next = NULL;
+		if (head) {
+			tail->node.next = &buf->node;
 		} else {
-			net_buf_destroy(buf);
+			head = buf;
 		}
+		tail = buf;
 
 		buf = frags;
 	}
+
+	if (head) {
+		pool_put_list(free_pool, head, tail);
+	}
 }
 
 struct net_buf *net_buf_ref(struct net_buf *buf)
@@ -728,3 +892,59 @@ size_t net_buf_data_match(const struct net_buf *buf, size_t offset, const void *
 
 	return compared;
 }
+
+int net_buf_iov_export(const struct net_buf *buf, size_t offset, size_t len,
+		       struct net_buf_iov *iov, size_t iov_count)
+{
+	size_t count = 0;
+	size_t to_export;
+
+	__ASSERT_NO_MSG(iov || !iov_count);
+
+	/* find the fragment holding the first byte */
+	while (buf && offset >= buf->len) {
+		offset -= buf->len;
+		buf = buf->frags;
+	}
+
+	while (len > 0) {
+		if (!buf) {
+			return -EINVAL;
+		}
+
+		to_export = MIN(len, buf->len - offset);
+
+		if (count == iov_count) {
+			return -ENOBUFS;
+		}
+
+		iov[count].base = buf->data + offset;
+		iov[count].len = to_export;
+		count++;
+
+		len -= to_export;
+		buf = buf->frags;
+		offset = 0;
+
+		/* skip empty fragments */
+		while (buf && !buf->len) {
+			buf = buf->frags;
+		}
+	}
+
+	return count;
+}
+
+void net_buf_iov_cache_flush(const struct net_buf_iov *iov, size_t iov_count)
+{
+	for (size_t i = 0; i < iov_count; i++) {
+		(void)sys_cache_data_flush_range(iov[i].base, iov[i].len);
+	}
+}
+
+void net_buf_iov_cache_invd(const struct net_buf_iov *iov, size_t iov_count)
+{
+	for (size_t i = 0; i < iov_count; i++) {
+		(void)sys_cache_data_invd_range(iov[i].base, iov[i].len);
+	}
+}
@@ -741,6 +741,32 @@ static void _ldiv10(uint64_t *v)
 	_ldiv5(v);
 }
 
+#ifdef CONFIG_CBPRINTF_CONVERSION_TABLES
+/* Rounding constants, 0.5 divided by 10 to the number of printed decimals, in
+ * the 4.60 fixed point format of the fraction. The last entry matches the
+ * 16 digits limit of the conversion.
+ */
+static const uint64_t round_half[17] = {
+	0x0800000000000000ULL, /* 0.5 */
+	0x00ccccccccccccccULL, /* 0.5e-1 */
+	0x00147ae147ae147aULL, /* 0.5e-2 */
+	0x00020c49ba5e353fULL, /* 0.5e-3 */
+	0x0000346dc5d63886ULL, /* 0.5e-4 */
+	0x0000053e2d6238daULL, /* 0.5e-5 */
+	0x0000008637bd05afULL, /* 0.5e-6 */
+	0x0000000d6bf94d5eULL, /* 0.5e-7 */
+	0x000000015798ee23ULL, /* 0.5e-8 */
+	0x00000000225c17d0ULL, /* 0.5e-9 */
+	0x00000000036f9bfbULL, /* 0.5e-10 */
+	0x000000000057f5ffULL, /* 0.5e-11 */
+	0x000000000008cbccULL, /* 0.5e-12 */
+	0x000000000000e12eULL, /* 0.5e-13 */
+	0x0000000000001684ULL, /* 0.5e-14 */
+	0x0000000000000240ULL, /* 0.5e-15 */
+	0x0000000000000039ULL, /* 0.5e-16 */
+};
+#endif
+
 /* Extract the next decimal character in the converted representation of a
  * fractional component.
  */
@@ -777,6 +803,78 @@ static inline size_t conversion_radix(char specifier)
 	}
 }
 
+#ifdef CONFIG_CBPRINTF_CONVERSION_TABLES
+/* "00" to "99", to convert decimal values two digits at a time. */
+static const char digit_pairs[200] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+#endif
+
+/* Writes the given value into the buffer in base 10, backwards from bp.
+ *
+ * Values which fit in 32 bits are converted with native divisions, which
+ * avoids the 64-bit division helper on 32-bit architectures.
+ */
+static char *encode_decimal(uint_value_type value, const char *bps, char *bp)
+{
+#ifdef CONFIG_CBPRINTF_CONVERSION_TABLES
+	const char *bpe = bp;
+	unsigned int pair;
+
+#ifdef CONFIG_CBPRINTF_FULL_INTEGRAL
+	while ((value > UINT32_MAX) && ((bp - bps) >= 2)) {
+		pair = (unsigned int)(value % 100U);
+		value /= 100U;
+		bp -= 2;
+		bp[0] = digit_pairs[2U * pair];
+		bp[1] = digit_pairs[2U * pair + 1U];
+	}
+#endif
+
+	uint32_t value32 = (uint32_t)value;
+
+	while ((value32 >= 10U) && ((bp - bps) >= 2)) {
+		pair = value32 % 100U;
+		value32 /= 100U;
+		bp -= 2;
+		bp[0] = digit_pairs[2U * pair];
+		bp[1] = digit_pairs[2U * pair + 1U];
+	}
+
+	/* A single digit is left, unless the pairs consumed the whole value */
+	if (((value32 != 0U) || (bp == bpe)) && (bps < bp)) {
+		--bp;
+		*bp = '0' + value32;
+	}
+#else
+#ifdef CONFIG_CBPRINTF_FULL_INTEGRAL
+	while ((value > UINT32_MAX) && (bps < bp)) {
+		--bp;
+		*bp = '0' + (unsigned int)(value % 10U);
+		value /= 10U;
+	}
+#endif
+
+	uint32_t value32 = (uint32_t)value;
+
+	do {
+		--bp;
+		*bp = '0' + (value32 % 10U);
+		value32 /= 10U;
+	} while ((value32 != 0U) && (bps < bp));
+#endif
+
+	return bp;
+}
+
 /* Writes the given value into the buffer in the specified base.
  *
  * Precision is applied *ONLY* within the space allowed.
@@ -796,14 +894,21 @@ static char *encode_uint(uint_value_type value,
 	const unsigned int radix = conversion_radix(conv->specifier);
 	char *bp = bps + (bpe - bps);
 
-	do {
-		unsigned int lsv = (unsigned int)(value % radix);
+	if (radix == 10U) {
+		bp = encode_decimal(value, bps, bp);
+	} else {
+		/* Power of two radix, no division needed */
+		const unsigned int shift = (radix == 16U) ? 4U : 3U;
 
-		--bp;
-		*bp = (lsv <= 9) ? ('0' + lsv)
-			: upcase ? ('A' + lsv - 10) : ('a' + lsv - 10);
-		value /= radix;
-	} while ((value != 0) && (bps < bp));
+		do {
+			unsigned int lsv = (unsigned int)value & (radix - 1U);
+
+			--bp;
+			*bp = (lsv <= 9) ? ('0' + lsv)
+				: upcase ? ('A' + lsv - 10) : ('a' + lsv - 10);
+			value >>= shift;
+		} while ((value != 0) && (bps < bp));
+	}
 
 	/* Record required alternate forms.  This can be determined
 	 * from the radix without re-checking specifier.
@@ -1178,10 +1283,14 @@ static char *encode_float(double value,
 	}
 
 	/* Round the value to the last digit being printed. */
+#ifdef CONFIG_CBPRINTF_CONVERSION_TABLES
+	uint64_t round = round_half[decimals];
+#else
 	uint64_t round = BIT64(59); /* 0.5 */
 	while (decimals-- != 0) {
 		_ldiv10(&round);
 	}
+#endif
 	fract += round;
 	/* Make sure rounding didn't make fract >= 1.0 */
 	if (fract >= BIT64(60)) {
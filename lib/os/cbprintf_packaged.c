@@ -910,6 +910,41 @@ bool is_ptr(const char *fmt, int n)
 	return false;
 }
 
+/* Number of arguments covered by the mask returned by get_ptr_args(). */
+#define PTR_ARGS_MAX 32
+
+/* Function returns a mask of the arguments which are pointers (%p), among the
+ * first PTR_ARGS_MAX ones. It uses the same rules as is_ptr(), but parses the
+ * format string once for all the string candidates of a package.
+ */
+static uint32_t get_ptr_args(const char *fmt)
+{
+	uint32_t mask = 0;
+	char c;
+	bool mod = false;
+	int cnt = 0;
+
+	while (((c = *fmt++) != '\0') && (cnt < PTR_ARGS_MAX)) {
+		if (mod && is_fmt_spec(c)) {
+			if (c == 'p') {
+				mask |= BIT(cnt);
+			}
+			cnt++;
+			mod = false;
+		}
+		if (c == '%') {
+			mod = !mod;
+		}
+	}
+
+	return mask;
+}
+
+static bool is_ptr_arg(const char *fmt, uint32_t ptr_args, int n)
+{
+	return (n < PTR_ARGS_MAX) ? ((ptr_args & BIT(n)) != 0U) : is_ptr(fmt, n);
+}
+
 int cbprintf_package_convert(void *in_packaged,
 			     size_t in_len,
 			     cbprintf_convert_cb cb,
@@ -970,6 +1005,12 @@ int cbprintf_package_convert(void *in_packaged,
 	const char *fmt = *(const char **)(buf + sizeof(void *));
 	uint8_t *str_pos = &buf[args_size];
 	size_t strl_cnt = 0;
+	uint32_t ptr_args = 0;
+
+	/* Parse the format string once, not for each string candidate. */
+	if (IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR) && fmt_present && (rws_nbr > 0)) {
+		ptr_args = get_ptr_args(fmt);
+	}
 
 	/* If null destination, just calculate output length. */
 	if (cb == NULL) {
@@ -1003,7 +1044,7 @@ int cbprintf_package_convert(void *in_packaged,
 			int len;
 
 			if (IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR) &&
-			    fmt_present && is_ptr(fmt, arg_idx)) {
+			    fmt_present && is_ptr_arg(fmt, ptr_args, arg_idx)) {
 				LOG_WRN("(unsigned) char * used for %%p argument. "
 					"It's recommended to cast it to void * because "
 					"it may cause misbehavior in certain "
@@ -1082,7 +1123,7 @@ calculate_string_length:
 		bool is_ro = ptr_in_rodata(str);
 
 		if (IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR) &&
-		    fmt_present && is_ptr(fmt, arg_idx)) {
+		    fmt_present && is_ptr_arg(fmt, ptr_args, arg_idx)) {
 			continue;
 		}
 
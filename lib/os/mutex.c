@@ -8,6 +8,7 @@
 #include <zephyr/sys/mutex.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <kernel_internal.h>
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -23,13 +24,88 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
-	 * that are outside their memory domain
+	/* sys_mutex memory is only touched with CONFIG_SYS_MUTEX_FAST,
+	 * otherwise just used to lookup the underlying k_mutex, but we
+	 * don't want threads using mutexes that are outside their memory
+	 * domain
 	 */
 	return K_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
 
+#ifdef CONFIG_SYS_MUTEX_FAST
+static int check_owner(atomic_val_t val)
+{
+	/* The value comes from user memory, it may be anything */
+	struct k_object *obj = k_object_find((void *)val);
+
+	if ((_current->base.user_options & K_USER) != 0U) {
+		/* A user thread may only boost a thread it has access to */
+		return k_object_validate(obj, K_OBJ_THREAD, _OBJ_INIT_TRUE);
+	}
+
+	if ((obj == NULL) || (obj->type != K_OBJ_THREAD) ||
+	    ((obj->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/*
+ * The sys_mutex is owned by the thread in its value, or by the owner of
+ * the kernel mutex if its value is Z_SYS_MUTEX_KERNEL. Waiting for it
+ * requires the kernel mutex to be used, so a thread that locked it with
+ * atomic ops is made the owner of the kernel mutex first.
+ */
+int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
+{
+	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	atomic_val_t val;
+	int ret;
+
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+	while (true) {
+		val = atomic_get(&mutex->val);
+
+		if (val == 0) {
+			(void)atomic_cas(&mutex->val, 0, Z_SYS_MUTEX_KERNEL);
+			continue;
+		}
+
+		if (val != Z_SYS_MUTEX_KERNEL) {
+			ret = check_owner(val);
+			if (ret != 0) {
+				return (ret == -EPERM) ? -EPERM : -EINVAL;
+			}
+
+			ret = z_mutex_adopt(kernel_mutex, (struct k_thread *)val, &mutex->val, val,
+					    Z_SYS_MUTEX_KERNEL);
+			if (ret == -EAGAIN) {
+				/* Unlocked in the meantime */
+				continue;
+			}
+
+			/* -EBUSY if held by a thread about to release it, see below */
+		}
+
+		ret = k_mutex_lock(kernel_mutex, sys_timepoint_timeout(end));
+		if (ret != 0) {
+			return ret;
+		}
+
+		if (atomic_get(&mutex->val) == Z_SYS_MUTEX_KERNEL) {
+			return 0;
+		}
+
+		/* The sys_mutex went back to atomic ops while waiting, try again */
+		(void)k_mutex_unlock(kernel_mutex);
+	}
+}
+#else
 int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
@@ -40,6 +116,7 @@ int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 
 	return k_mutex_lock(kernel_mutex, timeout);
 }
+#endif /* CONFIG_SYS_MUTEX_FAST */
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 						 k_timeout_t timeout)
@@ -55,12 +132,47 @@ static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+#ifdef CONFIG_SYS_MUTEX_FAST
+	atomic_val_t val;
+	int ret;
+#endif
 
-	if ((kernel_mutex == NULL) || (kernel_mutex->lock_count == 0)) {
+	if (kernel_mutex == NULL) {
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SYS_MUTEX_FAST
+	val = atomic_get(&mutex->val);
+	if (val == (atomic_val_t)_current) {
+		if (atomic_cas(&mutex->val, val, 0)) {
+			return 0;
+		}
+
+		/* Another thread made us the owner of the kernel mutex meanwhile */
+		val = atomic_get(&mutex->val);
+	}
+
+	if (val != 0 && val != Z_SYS_MUTEX_KERNEL) {
+		/* Locked by another thread with atomic ops */
+		return -EPERM;
+	}
+#endif
+
+	if (kernel_mutex->lock_count == 0) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_SYS_MUTEX_FAST
+	ret = k_mutex_unlock(kernel_mutex);
+	if (ret == 0) {
+		/* Uncontended again, use atomic ops for the next lock */
+		z_mutex_cas_if_unlocked(kernel_mutex, &mutex->val, Z_SYS_MUTEX_KERNEL, 0);
+	}
+
+	return ret;
+#else
 	return k_mutex_unlock(kernel_mutex);
+#endif
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
@@ -0,0 +1,501 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* Poll events used by a file descriptor, e.g. one for POLLIN and one
+ * for POLLOUT for a TCP socket.
+ */
+#define ZVFS_EPOLL_FD_EVENTS 2
+
+/* Ready poll events taken from the poll set at once */
+#define ZVFS_EPOLL_WAIT_EVENTS 8
+
+struct zvfs_epoll_item {
+	/* Registered with their objects while the fd is in the set */
+	struct k_poll_event poll_events[ZVFS_EPOLL_FD_EVENTS];
+	/* In the list of items to arm again, or of items to check */
+	sys_dnode_t node;
+	/* -1 when the item is not used */
+	int fd;
+	uint32_t events;
+	zvfs_epoll_data_t data;
+	/* Result of the last ZFD_IOCTL_POLL_PREPARE */
+	int result;
+	uint8_t num_events;
+};
+
+struct zvfs_epoll {
+	struct k_poll_set set;
+	/* Raised to wake up the waiting thread when the instance is closed,
+	 * or when an fd ready without any poll event is added.
+	 */
+	struct k_poll_signal ctl_sig;
+	struct k_poll_event ctl_event;
+	struct k_mutex lock;
+	/* Items returned or checked by the last wait, and items ready right
+	 * away, to be prepared again by the next wait.
+	 */
+	sys_dlist_t rearm;
+	struct zvfs_epoll_item items[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	bool in_use;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+/* Unregister the poll events of an item from their objects */
+static void zvfs_epoll_disarm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	for (int i = 0; i < item->num_events; i++) {
+		k_poll_set_remove(&ep->set, &item->poll_events[i]);
+	}
+
+	item->num_events = 0;
+}
+
+/* Prepare the poll events of an item and add them to the poll set, which
+ * registers them with their objects until they are signaled.
+ */
+static int zvfs_epoll_arm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->events,
+	};
+	struct k_poll_event *pev = item->poll_events;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int result;
+
+	zvfs_epoll_disarm(ep, item);
+
+	ctx = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		item->result = -EBADF;
+		return item->result;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+					 item->poll_events + ARRAY_SIZE(item->poll_events));
+	if (result == 0 || result == -EALREADY) {
+		item->num_events = pev - item->poll_events;
+
+		for (int i = 0; i < item->num_events; i++) {
+			k_poll_set_add(&ep->set, &item->poll_events[i]);
+		}
+	} else if (result == -EXDEV) {
+		result = -ENOTSUP;
+	}
+
+	k_mutex_unlock(lock);
+
+	item->result = result;
+
+	return result;
+}
+
+/* Get the current events of an item, once one of its poll events has been
+ * signaled or when it is ready without any.
+ */
+static uint32_t zvfs_epoll_update(struct zvfs_epoll_item *item)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->events,
+	};
+	struct k_poll_event *pev = item->poll_events;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int result;
+
+	if (item->result != 0 && item->result != -EALREADY) {
+		return (item->result == -EBADF) ? ZVFS_POLLNVAL : ZVFS_POLLERR;
+	}
+
+	ctx = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return ZVFS_POLLNVAL;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, &pfd, &pev);
+	k_mutex_unlock(lock);
+
+	/* EAGAIN asks for the events to be prepared again, which the next
+	 * wait does anyway.
+	 */
+	if (result != 0 && result != -EAGAIN) {
+		return ZVFS_POLLERR;
+	}
+
+	return pfd.revents;
+}
+
+/* Have the next wait check an item that is ready without any signaled
+ * poll event, or could not be prepared.
+ */
+static void zvfs_epoll_recheck(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	if (!sys_dnode_is_linked(&item->node)) {
+		sys_dlist_append(&ep->rearm, &item->node);
+	}
+
+	k_poll_signal_raise(&ep->ctl_sig, 0);
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	int err;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	if (!ep->in_use) {
+		k_mutex_unlock(&ep->lock);
+		errno = EBADF;
+		return -1;
+	}
+
+	ep->in_use = false;
+	k_poll_signal_raise(&ep->ctl_sig, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		zvfs_epoll_disarm(ep, &ep->items[i]);
+		ep->items[i].fd = -1;
+	}
+
+	k_poll_set_remove(&ep->set, &ep->ctl_event);
+
+	k_mutex_unlock(&ep->lock);
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+static struct zvfs_epoll_item *zvfs_epoll_find(struct zvfs_epoll *ep, int fd)
+{
+	for (int i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		if (ep->items[i].fd == fd) {
+			return &ep->items[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Get the item a ready poll event belongs to, NULL for the control event */
+static struct zvfs_epoll_item *zvfs_epoll_event_item(struct zvfs_epoll *ep,
+						     struct k_poll_event *event)
+{
+	if (event == &ep->ctl_event) {
+		return NULL;
+	}
+
+	return &ep->items[((uintptr_t)event - (uintptr_t)ep->items) / sizeof(ep->items[0])];
+}
+
+static int zvfs_epoll_ctl_locked(struct zvfs_epoll *ep, int op, int fd,
+				 const struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_item *item = zvfs_epoll_find(ep, fd);
+	int ret;
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			return -EEXIST;
+		}
+
+		item = zvfs_epoll_find(ep, -1);
+		if (item == NULL) {
+			return -ENOSPC;
+		}
+
+		item->fd = fd;
+		item->events = event->events;
+		item->data = event->data;
+
+		ret = zvfs_epoll_arm(ep, item);
+		if (ret != 0 && ret != -EALREADY) {
+			item->fd = -1;
+			return ret;
+		}
+
+		if (ret == -EALREADY) {
+			zvfs_epoll_recheck(ep, item);
+		}
+
+		break;
+	case ZVFS_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			return -ENOENT;
+		}
+
+		item->events = event->events;
+		item->data = event->data;
+
+		/* Also checked by the next wait when it failed, which reports
+		 * ZVFS_POLLNVAL or ZVFS_POLLERR.
+		 */
+		ret = zvfs_epoll_arm(ep, item);
+		if (ret != 0) {
+			zvfs_epoll_recheck(ep, item);
+		}
+
+		if (ret != -EALREADY) {
+			return ret;
+		}
+
+		break;
+	case ZVFS_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			return -ENOENT;
+		}
+
+		zvfs_epoll_disarm(ep, item);
+
+		if (sys_dnode_is_linked(&item->node)) {
+			sys_dlist_remove(&item->node);
+		}
+
+		item->fd = -1;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create(void)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	k_mutex_init(&ep->lock);
+	sys_dlist_init(&ep->rearm);
+
+	for (int i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		ep->items[i].fd = -1;
+		ep->items[i].num_events = 0;
+		sys_dnode_init(&ep->items[i].node);
+	}
+
+	k_poll_set_init(&ep->set);
+	k_poll_signal_init(&ep->ctl_sig);
+	k_poll_event_init(&ep->ctl_event, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+			  &ep->ctl_sig);
+	k_poll_set_add(&ep->set, &ep->ctl_event);
+	ep->in_use = true;
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, const struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll *ep;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd < 0 || fd == epfd || (op != ZVFS_EPOLL_CTL_DEL && event == NULL)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	ret = ep->in_use ? zvfs_epoll_ctl_locked(ep, op, fd, event) : -EBADF;
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Prepare again the items returned or checked by the last wait, their poll
+ * events have been signaled and their objects may have changed, e.g. from
+ * the connection semaphore to the transmit one of a TCP socket. The items
+ * ready without any signaled poll event are added to @p check.
+ */
+static void zvfs_epoll_rearm(struct zvfs_epoll *ep, sys_dlist_t *check)
+{
+	struct zvfs_epoll_item *item;
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(&ep->rearm)) != NULL) {
+		item = CONTAINER_OF(node, struct zvfs_epoll_item, node);
+
+		if (zvfs_epoll_arm(ep, item) != 0) {
+			sys_dlist_append(check, &item->node);
+		}
+	}
+}
+
+/* Take the ready poll events from the poll set, and add the items they
+ * belong to to @p check.
+ */
+static void zvfs_epoll_collect(struct zvfs_epoll *ep, sys_dlist_t *check, k_timeout_t timeout)
+{
+	struct k_poll_event *ready[ZVFS_EPOLL_WAIT_EVENTS];
+	struct zvfs_epoll_item *item;
+	int count;
+
+	do {
+		count = k_poll_set_wait(&ep->set, ready, ARRAY_SIZE(ready), timeout);
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		for (int i = 0; i < count; i++) {
+			item = zvfs_epoll_event_item(ep, ready[i]);
+			if (item == NULL) {
+				k_poll_signal_reset(&ep->ctl_sig);
+				continue;
+			}
+
+			/* The fd may have been removed or modified meanwhile,
+			 * its events are then checked again or not at all.
+			 */
+			if (item->fd >= 0 && !sys_dnode_is_linked(&item->node)) {
+				sys_dlist_append(check, &item->node);
+			}
+		}
+
+		k_mutex_unlock(&ep->lock);
+
+		timeout = K_NO_WAIT;
+	} while (count == (int)ARRAY_SIZE(ready));
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct zvfs_epoll_item *item;
+	struct zvfs_epoll *ep;
+	k_timepoint_t end;
+	sys_dlist_t check;
+	sys_dnode_t *node;
+	uint32_t revents;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+	sys_dlist_init(&check);
+
+	do {
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		if (!ep->in_use) {
+			k_mutex_unlock(&ep->lock);
+			errno = EBADF;
+			return -1;
+		}
+
+		zvfs_epoll_rearm(ep, &check);
+
+		k_mutex_unlock(&ep->lock);
+
+		/* Only the ready events are taken from the poll set, the others
+		 * stay registered with their objects.
+		 */
+		zvfs_epoll_collect(ep, &check, sys_dlist_is_empty(&check) ?
+					       sys_timepoint_timeout(end) : K_NO_WAIT);
+
+		ret = 0;
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		if (!ep->in_use) {
+			k_mutex_unlock(&ep->lock);
+			errno = EBADF;
+			return -1;
+		}
+
+		while ((node = sys_dlist_get(&check)) != NULL) {
+			item = CONTAINER_OF(node, struct zvfs_epoll_item, node);
+
+			revents = zvfs_epoll_update(item);
+			if (revents != 0 && ret < maxevents) {
+				events[ret].events = revents;
+				events[ret].data = item->data;
+				ret++;
+			}
+
+			/* Also the ones not reported, ready ones are then
+			 * returned by the next wait.
+			 */
+			sys_dlist_append(&ep->rearm, &item->node);
+		}
+
+		k_mutex_unlock(&ep->lock);
+
+		/* Nothing ready after a wake up by the control signal or a
+		 * spurious one, wait again for the remaining time.
+		 */
+	} while (ret == 0 && !K_TIMEOUT_EQ(sys_timepoint_timeout(end), K_NO_WAIT));
+
+	return ret;
+}
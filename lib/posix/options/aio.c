@@ -7,76 +7,488 @@
 #include <errno.h>
 #include <signal.h>
 
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/posix/aio.h>
+#include <zephyr/sys/timeutil.h>
+#include <zephyr/sys/util.h>
+
+/* prototypes for external, not-yet-public, functions in fdtable.c */
+ssize_t zvfs_read(int fd, void *buf, size_t sz, const size_t *from_offset);
+ssize_t zvfs_write(int fd, const void *buf, size_t sz, const size_t *from_offset);
+int zvfs_fsync(int fd);
+
+/* Operation of a request, in addition to LIO_READ and LIO_WRITE */
+#define AIO_OP_FSYNC (LIO_NOP + 1)
+
+enum aio_state {
+	AIO_STATE_FREE,
+	AIO_STATE_QUEUED,
+	AIO_STATE_RUNNING,
+	AIO_STATE_DONE,
+};
+
+struct aio_lio {
+	struct sigevent sig;
+	/* Requests of the list that are not done yet, the list is free if 0 */
+	int pending;
+};
+
+struct aio_req {
+	/* reserved for the k_queue */
+	void *reserved;
+	struct aiocb *cb;
+	struct aio_lio *lio;
+	enum aio_state state;
+	int op;
+	int error;
+	ssize_t ret;
+};
+
+static struct aio_req aio_reqs[CONFIG_POSIX_AIO_MAX];
+static struct aio_lio aio_lios[CONFIG_POSIX_AIO_MAX];
+
+static K_QUEUE_DEFINE(aio_queue);
+static K_MUTEX_DEFINE(aio_lock);
+static K_CONDVAR_DEFINE(aio_done);
+
+static K_THREAD_STACK_ARRAY_DEFINE(aio_stacks, CONFIG_POSIX_AIO_THREADS,
+				   CONFIG_POSIX_AIO_THREAD_STACK_SIZE);
+static struct k_thread aio_threads[CONFIG_POSIX_AIO_THREADS];
+
+static void aio_notify(const struct sigevent *sig)
+{
+	/* As for timers, signals are delivered by calling the notification function */
+	if (sig->sigev_notify != SIGEV_NONE && sig->sigev_notify_function != NULL) {
+		sig->sigev_notify_function(sig->sigev_value);
+	}
+}
+
+static bool aio_sigevent_is_valid(const struct sigevent *sig)
+{
+	return sig->sigev_notify == SIGEV_NONE || sig->sigev_notify == SIGEV_SIGNAL ||
+	       sig->sigev_notify == SIGEV_THREAD;
+}
+
+/* Must be called with aio_lock held */
+static struct aio_req *aio_req_find(const struct aiocb *cb)
+{
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if (req->state != AIO_STATE_FREE && req->cb == cb) {
+			return req;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Marks a request as done and gets the notifications to send, they are sent
+ * without holding aio_lock. Must be called with aio_lock held.
+ */
+static void aio_req_complete(struct aio_req *req, struct sigevent *sig, struct sigevent *lio_sig)
+{
+	req->state = AIO_STATE_DONE;
+	*sig = req->cb->aio_sigevent;
+	lio_sig->sigev_notify = SIGEV_NONE;
+
+	if (req->lio != NULL) {
+		if (--req->lio->pending == 0) {
+			*lio_sig = req->lio->sig;
+		}
+		req->lio = NULL;
+	}
+
+	k_condvar_broadcast(&aio_done);
+}
+
+static void aio_req_run(struct aio_req *req)
+{
+	struct aiocb *cb = req->cb;
+	size_t off = (size_t)cb->aio_offset;
+	ssize_t ret;
+
+	switch (req->op) {
+	case LIO_READ:
+		ret = zvfs_read(cb->aio_fildes, (void *)cb->aio_buf, cb->aio_nbytes, &off);
+		if (ret < 0 && errno == ENOTSUP) {
+			/* Not seekable, e.g. a socket, the offset is ignored */
+			ret = zvfs_read(cb->aio_fildes, (void *)cb->aio_buf, cb->aio_nbytes, NULL);
+		}
+		break;
+	case LIO_WRITE:
+		ret = zvfs_write(cb->aio_fildes, (const void *)cb->aio_buf, cb->aio_nbytes, &off);
+		if (ret < 0 && errno == ENOTSUP) {
+			ret = zvfs_write(cb->aio_fildes, (const void *)cb->aio_buf, cb->aio_nbytes,
+					 NULL);
+		}
+		break;
+	case AIO_OP_FSYNC:
+		ret = zvfs_fsync(cb->aio_fildes);
+		break;
+	default:
+		ret = 0;
+		break;
+	}
+
+	req->ret = ret;
+	req->error = (ret < 0) ? errno : 0;
+}
+
+static void aio_thread(void *p1, void *p2, void *p3)
+{
+	struct sigevent sig;
+	struct sigevent lio_sig;
+	struct aio_req *req;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		req = k_queue_get(&aio_queue, K_FOREVER);
+
+		k_mutex_lock(&aio_lock, K_FOREVER);
+		if (req->state != AIO_STATE_QUEUED) {
+			/* Canceled since it was queued */
+			k_mutex_unlock(&aio_lock);
+			continue;
+		}
+
+		req->state = AIO_STATE_RUNNING;
+		k_mutex_unlock(&aio_lock);
+
+		aio_req_run(req);
+
+		k_mutex_lock(&aio_lock, K_FOREVER);
+		aio_req_complete(req, &sig, &lio_sig);
+		k_mutex_unlock(&aio_lock);
+
+		aio_notify(&sig);
+		aio_notify(&lio_sig);
+	}
+}
+
+/* Must be called with aio_lock held */
+static int aio_submit(struct aiocb *cb, int op, struct aio_lio *lio)
+{
+	struct aio_req *free_req = NULL;
+
+	if (cb == NULL || cb->aio_offset < 0 || !aio_sigevent_is_valid(&cb->aio_sigevent)) {
+		return EINVAL;
+	}
+
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if (req->state != AIO_STATE_FREE && req->cb == cb) {
+			if (req->state != AIO_STATE_DONE) {
+				/* The control block is still in use */
+				return EINVAL;
+			}
+
+			/* The result of the previous request was never collected */
+			req->state = AIO_STATE_FREE;
+		}
+
+		if (req->state == AIO_STATE_FREE && free_req == NULL) {
+			free_req = req;
+		}
+	}
+
+	if (free_req == NULL) {
+		return EAGAIN;
+	}
+
+	free_req->cb = cb;
+	free_req->lio = lio;
+	free_req->op = op;
+	free_req->error = EINPROGRESS;
+	free_req->ret = -1;
+	free_req->state = AIO_STATE_QUEUED;
+
+	if (lio != NULL) {
+		lio->pending++;
+	}
+
+	k_queue_append(&aio_queue, free_req);
+
+	return 0;
+}
+
+static int aio_submit_one(struct aiocb *cb, int op)
+{
+	int err;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	err = aio_submit(cb, op, NULL);
+	k_mutex_unlock(&aio_lock);
+
+	if (err != 0) {
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
 
 int aio_cancel(int fildes, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	struct sigevent sig[CONFIG_POSIX_AIO_MAX];
+	struct sigevent lio_sig[CONFIG_POSIX_AIO_MAX];
+	size_t canceled = 0;
+	bool not_canceled = false;
+
+	if (aiocbp != NULL && aiocbp->aio_fildes != fildes) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
 
-	errno = ENOSYS;
-	return -1;
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if (req->state == AIO_STATE_FREE || req->cb->aio_fildes != fildes ||
+		    (aiocbp != NULL && req->cb != aiocbp)) {
+			continue;
+		}
+
+		if (req->state == AIO_STATE_QUEUED) {
+			(void)k_queue_remove(&aio_queue, req);
+			req->error = ECANCELED;
+			req->ret = -1;
+			aio_req_complete(req, &sig[canceled], &lio_sig[canceled]);
+			canceled++;
+		} else if (req->state == AIO_STATE_RUNNING) {
+			not_canceled = true;
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	for (size_t i = 0; i < canceled; i++) {
+		aio_notify(&sig[i]);
+		aio_notify(&lio_sig[i]);
+	}
+
+	if (not_canceled) {
+		return AIO_NOTCANCELED;
+	}
+
+	return (canceled > 0) ? AIO_CANCELED : AIO_ALLDONE;
 }
 
 int aio_error(const struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	struct aio_req *req;
+	int err;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	req = aio_req_find(aiocbp);
+	err = (req == NULL) ? -1 : req->error;
+	k_mutex_unlock(&aio_lock);
+
+	if (err < 0) {
+		errno = EINVAL;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return err;
 }
 
 int aio_fsync(int fildes, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	if (aiocbp == NULL || aiocbp->aio_fildes != fildes) {
+		errno = EINVAL;
+		return -1;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	/* All the data is written at once, O_SYNC and O_DSYNC are the same */
+	return aio_submit_one(aiocbp, AIO_OP_FSYNC);
 }
 
 int aio_read(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
-
-	errno = ENOSYS;
-	return -1;
+	return aio_submit_one(aiocbp, LIO_READ);
 }
 
 ssize_t aio_return(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	struct aio_req *req;
+	ssize_t ret = -1;
+	int err = EINVAL;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	req = aio_req_find(aiocbp);
+	if (req != NULL && req->state == AIO_STATE_DONE) {
+		ret = req->ret;
+		err = req->error;
+		req->state = AIO_STATE_FREE;
+	}
+
+	k_mutex_unlock(&aio_lock);
 
-	errno = ENOSYS;
-	return -1;
+	if (ret < 0) {
+		errno = err;
+	}
+
+	return ret;
 }
 
 int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
 {
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(timeout);
+	k_timepoint_t end;
+	int ret = -1;
+
+	if (timeout != NULL && !timespec_is_valid(timeout)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout == NULL ? K_FOREVER : timespec_to_timeout(timeout));
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	while (ret != 0) {
+		bool pending = false;
+
+		for (int i = 0; i < nent; i++) {
+			struct aio_req *req;
+
+			if (list[i] == NULL) {
+				continue;
+			}
+
+			req = aio_req_find(list[i]);
+			if (req == NULL || req->state == AIO_STATE_DONE) {
+				/* Completed, the result may already have been collected */
+				ret = 0;
+				break;
+			}
+
+			pending = true;
+		}
 
-	errno = ENOSYS;
-	return -1;
+		if (ret == 0 || !pending) {
+			ret = 0;
+			break;
+		}
+
+		if (k_condvar_wait(&aio_done, &aio_lock, sys_timepoint_timeout(end)) != 0) {
+			errno = EAGAIN;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
 }
 
 int aio_write(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
-
-	errno = ENOSYS;
-	return -1;
+	return aio_submit_one(aiocbp, LIO_WRITE);
 }
 
 int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
 	       struct sigevent *ZRESTRICT sig)
 {
-	ARG_UNUSED(mode);
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(sig);
+	struct aio_lio *lio = NULL;
+	bool failed = false;
+	int err = 0;
+
+	if ((mode != LIO_WAIT && mode != LIO_NOWAIT) || nent < 0 ||
+	    nent > CONFIG_POSIX_AIO_MAX || (sig != NULL && !aio_sigevent_is_valid(sig))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	if (mode == LIO_NOWAIT && sig != NULL && sig->sigev_notify != SIGEV_NONE) {
+		ARRAY_FOR_EACH_PTR(aio_lios, l) {
+			if (l->pending == 0) {
+				lio = l;
+				break;
+			}
+		}
+
+		if (lio == NULL) {
+			k_mutex_unlock(&aio_lock);
+			errno = EAGAIN;
+			return -1;
+		}
+
+		lio->sig = *sig;
+		/* Keep the list busy until all the requests are submitted */
+		lio->pending = 1;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		int op = (list[i] == NULL) ? LIO_NOP : list[i]->aio_lio_opcode;
+		int ret;
+
+		if (op != LIO_READ && op != LIO_WRITE) {
+			continue;
+		}
+
+		ret = aio_submit(list[i], op, lio);
+		if (ret != 0) {
+			err = ret;
+		}
+	}
+
+	if (lio != NULL && --lio->pending == 0) {
+		/* Everything is already done, or nothing was submitted */
+		struct sigevent lio_sig = lio->sig;
+
+		k_mutex_unlock(&aio_lock);
+		aio_notify(&lio_sig);
+		k_mutex_lock(&aio_lock, K_FOREVER);
+	}
+
+	if (mode == LIO_WAIT) {
+		for (int i = 0; i < nent; i++) {
+			struct aio_req *req;
+
+			if (list[i] == NULL || (list[i]->aio_lio_opcode != LIO_READ &&
+						list[i]->aio_lio_opcode != LIO_WRITE)) {
+				continue;
+			}
+
+			while ((req = aio_req_find(list[i])) != NULL &&
+			       req->state != AIO_STATE_DONE) {
+				(void)k_condvar_wait(&aio_done, &aio_lock, K_FOREVER);
+			}
+
+			if (req != NULL && req->error != 0) {
+				failed = true;
+			}
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (err != 0) {
+		errno = err;
+		return -1;
+	}
+
+	if (failed) {
+		errno = EIO;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int aio_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_threads); i++) {
+		k_thread_create(&aio_threads[i], aio_stacks[i],
+				K_THREAD_STACK_SIZEOF(aio_stacks[i]), aio_thread, NULL, NULL, NULL,
+				CONFIG_POSIX_AIO_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&aio_threads[i], "posix_aio");
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return 0;
 }
+
+SYS_INIT(aio_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
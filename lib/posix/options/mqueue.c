@@ -16,11 +16,34 @@
 
 #define SIGEV_MASK (SIGEV_NONE | SIGEV_SIGNAL | SIGEV_THREAD)
 
+#define PRIO_BITMAP_WORDS DIV_ROUND_UP(CONFIG_POSIX_MQ_PRIO_MAX, 32)
+
+typedef struct mqueue_msg {
+	sys_snode_t node;
+	size_t len;
+	char data[];
+} mqueue_msg;
+
+/*
+ * Messages are kept in one FIFO list per priority, with a bitmap of the
+ * non-empty lists, so that sending and receiving do not depend on the
+ * number of queued messages. The free and queued message counts are
+ * tracked by semaphores, which blocked senders and receivers wait on.
+ */
 typedef struct mqueue_object {
 	sys_snode_t snode;
 	char *mem_buffer;
 	char *mem_obj;
-	struct k_msgq queue;
+	struct k_spinlock lock;
+	struct k_sem free_sem;
+	struct k_sem used_sem;
+	sys_slist_t free_list;
+	sys_slist_t prio_list[CONFIG_POSIX_MQ_PRIO_MAX];
+	uint32_t prio_bitmap[PRIO_BITMAP_WORDS];
+	long msg_size;
+	long max_msgs;
+	long cur_msgs;
+	int receivers;
 	atomic_t ref_count;
 	char *name;
 	struct sigevent not;
@@ -39,13 +62,18 @@ sys_slist_t mq_list = SYS_SLIST_STATIC_INIT(&mq_list);
 
 static mqueue_object *find_in_list(const char *name);
 static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_len,
-			  k_timeout_t timeout);
+			    unsigned int msg_prio, k_timeout_t timeout);
 static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
-			   k_timeout_t timeout);
+			       unsigned int *msg_prio, k_timeout_t timeout);
 static void remove_notification(mqueue_object *msg_queue);
 static void remove_mq(mqueue_object *msg_queue);
 static void *mq_notify_thread(void *arg);
 
+static inline size_t msg_slot_size(long msg_size)
+{
+	return ROUND_UP(sizeof(mqueue_msg) + msg_size, sizeof(void *));
+}
+
 /**
  * @brief Open a message queue.
  *
@@ -145,19 +173,24 @@ mqd_t mq_open(const char *name, int oflags, ...)
 
 		strcpy(msg_queue->name, name);
 
-		mq_buf_ptr = k_malloc(msg_size * max_msgs * sizeof(uint8_t));
+		mq_buf_ptr = k_malloc(msg_slot_size(msg_size) * max_msgs);
 		if (mq_buf_ptr != NULL) {
-			(void)memset(mq_buf_ptr, 0,
-				     msg_size * max_msgs * sizeof(uint8_t));
+			(void)memset(mq_buf_ptr, 0, msg_slot_size(msg_size) * max_msgs);
 			msg_queue->mem_buffer = mq_buf_ptr;
 		} else {
 			goto free_mq_buffer;
 		}
 
 		(void)atomic_set(&msg_queue->ref_count, 1);
-		/* initialize zephyr message queue */
-		k_msgq_init(&msg_queue->queue, msg_queue->mem_buffer, msg_size,
-			    max_msgs);
+		msg_queue->msg_size = msg_size;
+		msg_queue->max_msgs = max_msgs;
+		k_sem_init(&msg_queue->free_sem, max_msgs, max_msgs);
+		k_sem_init(&msg_queue->used_sem, 0, max_msgs);
+		for (long i = 0; i < max_msgs; i++) {
+			mqueue_msg *msg = (mqueue_msg *)&mq_buf_ptr[i * msg_slot_size(msg_size)];
+
+			sys_slist_append(&msg_queue->free_list, &msg->node);
+		}
 		k_sem_take(&mq_sem, K_FOREVER);
 		sys_slist_append(&mq_list, (sys_snode_t *)&(msg_queue->snode));
 		k_sem_give(&mq_sem);
@@ -234,7 +267,8 @@ int mq_unlink(const char *name)
 /**
  * @brief Send a message to a message queue.
  *
- * All messages in message queue are of equal priority.
+ * Messages are received in decreasing order of priority, and in the order
+ * they were sent for the same priority.
  *
  * See IEEE 1003.1
  */
@@ -243,14 +277,12 @@ int mq_send(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 
-	return send_message(mqd, msg_ptr, msg_len, K_FOREVER);
+	return send_message(mqd, msg_ptr, msg_len, msg_prio, K_FOREVER);
 }
 
 /**
  * @brief Send message to a message queue within abstime time.
  *
- * All messages in message queue are of equal priority.
- *
  * See IEEE 1003.1
  */
 int mq_timedsend(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
@@ -263,14 +295,14 @@ int mq_timedsend(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 		return -1;
 	}
 
-	return send_message(mqd, msg_ptr, msg_len,
+	return send_message(mqd, msg_ptr, msg_len, msg_prio,
 			    K_MSEC(timespec_to_timeoutms(CLOCK_REALTIME, abstime)));
 }
 
 /**
  * @brief Receive a message from a message queue.
  *
- * All messages in message queue are of equal priority.
+ * The oldest message of the highest priority is copied to msg_ptr.
  *
  * See IEEE 1003.1
  */
@@ -279,14 +311,12 @@ int mq_receive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 
-	return receive_message(mqd, msg_ptr, msg_len, K_FOREVER);
+	return receive_message(mqd, msg_ptr, msg_len, msg_prio, K_FOREVER);
 }
 
 /**
  * @brief Receive message from a message queue within abstime time.
  *
- * All messages in message queue are of equal priority.
- *
  * See IEEE 1003.1
  */
 int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
@@ -299,7 +329,7 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 		return -1;
 	}
 
-	return receive_message(mqd, msg_ptr, msg_len,
+	return receive_message(mqd, msg_ptr, msg_len, msg_prio,
 			       K_MSEC(timespec_to_timeoutms(CLOCK_REALTIME, abstime)));
 }
 
@@ -311,7 +341,7 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 int mq_getattr(mqd_t mqdes, struct mq_attr *mqstat)
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
-	struct k_msgq_attrs attrs;
+	k_spinlock_key_t key;
 
 	if (mqd == NULL) {
 		errno = EBADF;
@@ -319,11 +349,12 @@ int mq_getattr(mqd_t mqdes, struct mq_attr *mqstat)
 	}
 
 	k_sem_take(&mq_sem, K_FOREVER);
-	k_msgq_get_attrs(&mqd->mqueue->queue, &attrs);
+	key = k_spin_lock(&mqd->mqueue->lock);
 	mqstat->mq_flags = mqd->flags;
-	mqstat->mq_maxmsg = attrs.max_msgs;
-	mqstat->mq_msgsize = attrs.msg_size;
-	mqstat->mq_curmsgs = attrs.used_msgs;
+	mqstat->mq_maxmsg = mqd->mqueue->max_msgs;
+	mqstat->mq_msgsize = mqd->mqueue->msg_size;
+	mqstat->mq_curmsgs = mqd->mqueue->cur_msgs;
+	k_spin_unlock(&mqd->mqueue->lock, key);
 	k_sem_give(&mq_sem);
 	return 0;
 }
@@ -447,72 +478,148 @@ static mqueue_object *find_in_list(const char *name)
 }
 
 static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_len,
-			  k_timeout_t timeout)
+			    unsigned int msg_prio, k_timeout_t timeout)
 {
-	int32_t ret = -1;
+	mqueue_object *mq;
+	mqueue_msg *msg;
+	k_spinlock_key_t key;
+	bool notify;
 
 	if (mqd == NULL) {
 		errno = EBADF;
-		return ret;
+		return -1;
 	}
 
+	mq = mqd->mqueue;
+
 	if ((mqd->flags & O_NONBLOCK) != 0U) {
 		timeout = K_NO_WAIT;
 	}
 
-	if (msg_len >  mqd->mqueue->queue.msg_size) {
+	if (msg_len > (size_t)mq->msg_size) {
 		errno = EMSGSIZE;
-		return ret;
+		return -1;
 	}
 
-	uint32_t msgq_num = k_msgq_num_used_get(&mqd->mqueue->queue);
+	if (msg_prio >= CONFIG_POSIX_MQ_PRIO_MAX) {
+		errno = EINVAL;
+		return -1;
+	}
 
-	if (k_msgq_put(&mqd->mqueue->queue, (void *)msg_ptr, timeout) != 0) {
+	if (k_sem_take(&mq->free_sem, timeout) != 0) {
 		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
-		return ret;
+		return -1;
 	}
 
-	if (k_msgq_num_used_get(&mqd->mqueue->queue) - msgq_num > 0) {
-		struct sigevent *sevp = &mqd->mqueue->not;
+	key = k_spin_lock(&mq->lock);
+	msg = CONTAINER_OF(sys_slist_get_not_empty(&mq->free_list), mqueue_msg, node);
+	k_spin_unlock(&mq->lock, key);
+
+	/* The slot is reserved, copy without holding the lock */
+	memcpy(msg->data, msg_ptr, msg_len);
+	msg->len = msg_len;
+
+	key = k_spin_lock(&mq->lock);
+	sys_slist_append(&mq->prio_list[msg_prio], &msg->node);
+	mq->prio_bitmap[msg_prio / 32U] |= BIT(msg_prio % 32U);
+	/* Notify when a message arrives on an empty queue nobody waits on */
+	notify = (mq->cur_msgs++ == 0) && (mq->receivers == 0);
+	k_spin_unlock(&mq->lock, key);
+
+	k_sem_give(&mq->used_sem);
+
+	if (notify) {
+		struct sigevent *sevp = &mq->not;
 
 		if (sevp->sigev_notify == SIGEV_NONE) {
 			sevp->sigev_notify_function(sevp->sigev_value);
 		} else if (sevp->sigev_notify == SIGEV_THREAD) {
 			pthread_t th;
 
-			ret = pthread_create(&th,
-					     sevp->sigev_notify_attributes,
-					     mq_notify_thread,
-					     mqd->mqueue);
+			(void)pthread_create(&th, sevp->sigev_notify_attributes,
+					     mq_notify_thread, mq);
 		}
 	}
 
 	return 0;
 }
 
+/* Must be called with the lock of the queue held, and a message queued */
+static mqueue_msg *get_highest_prio_msg(mqueue_object *mq, unsigned int *prio)
+{
+	unsigned int word = PRIO_BITMAP_WORDS - 1U;
+	sys_snode_t *node;
+
+	while (mq->prio_bitmap[word] == 0U) {
+		word--;
+	}
+
+	*prio = word * 32U + find_msb_set(mq->prio_bitmap[word]) - 1U;
+	node = sys_slist_get_not_empty(&mq->prio_list[*prio]);
+	if (sys_slist_is_empty(&mq->prio_list[*prio])) {
+		mq->prio_bitmap[word] &= ~BIT(*prio % 32U);
+	}
+
+	mq->cur_msgs--;
+
+	return CONTAINER_OF(node, mqueue_msg, node);
+}
+
 static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
-			     k_timeout_t timeout)
+			       unsigned int *msg_prio, k_timeout_t timeout)
 {
-	int ret = -1;
+	mqueue_object *mq;
+	mqueue_msg *msg = NULL;
+	k_spinlock_key_t key;
+	unsigned int prio = 0U;
+	int ret;
 
 	if (mqd == NULL) {
 		errno = EBADF;
-		return ret;
+		return -1;
 	}
 
-	if (msg_len < mqd->mqueue->queue.msg_size) {
+	mq = mqd->mqueue;
+
+	if (msg_len < (size_t)mq->msg_size) {
 		errno = EMSGSIZE;
-		return ret;
+		return -1;
 	}
 
 	if ((mqd->flags & O_NONBLOCK) != 0U) {
 		timeout = K_NO_WAIT;
 	}
 
-	if (k_msgq_get(&mqd->mqueue->queue, (void *)msg_ptr, timeout) != 0) {
+	key = k_spin_lock(&mq->lock);
+	mq->receivers++;
+	k_spin_unlock(&mq->lock, key);
+
+	ret = k_sem_take(&mq->used_sem, timeout);
+
+	key = k_spin_lock(&mq->lock);
+	mq->receivers--;
+	if (ret == 0) {
+		msg = get_highest_prio_msg(mq, &prio);
+	}
+	k_spin_unlock(&mq->lock, key);
+
+	if (ret != 0) {
 		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
-	} else {
-		ret = mqd->mqueue->queue.msg_size;
+		return -1;
+	}
+
+	/* Copied straight from the slot, which is released afterwards */
+	memcpy(msg_ptr, msg->data, msg->len);
+	ret = msg->len;
+
+	key = k_spin_lock(&mq->lock);
+	sys_slist_append(&mq->free_list, &msg->node);
+	k_spin_unlock(&mq->lock, key);
+
+	k_sem_give(&mq->free_sem);
+
+	if (msg_prio != NULL) {
+		*msg_prio = prio;
 	}
 
 	return ret;
@@ -22,17 +22,6 @@ struct internal_ctx {
 };
 
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
-static bool share_paren(const struct smf_state *test_state, const struct smf_state *target_state)
-{
-	for (const struct smf_state *state = test_state; state != NULL; state = state->parent) {
-		if (target_state == state) {
-			return true;
-		}
-	}
-
-	return false;
-}
-
 static const struct smf_state *get_child_of(const struct smf_state *states,
 					    const struct smf_state *parent)
 {
@@ -56,31 +45,77 @@ static const struct smf_state *get_last_of(const struct smf_state *states)
 	return get_child_of(states, NULL);
 }
 
+static size_t get_depth_of(const struct smf_state *state)
+{
+	size_t depth = 0;
+
+	for (; state != NULL; state = state->parent) {
+		depth++;
+	}
+
+	return depth;
+}
+
 /**
- * @brief Find the Least Common Ancestor (LCA) of two states
+ * @brief Find the deepest state that is both an ancestor of, or equal to,
+ *        source and dest
+ *
+ * Both states are first moved up to the same depth, so that the states are
+ * compared at most once per level.
  *
  * @param source transition source
  * @param dest transition destination
- * @return LCA state, or NULL if states have no LCA.
+ * @return common state, or NULL if states have no common ancestor.
  */
-static const struct smf_state *get_lca_of(const struct smf_state *source,
-					  const struct smf_state *dest)
+static const struct smf_state *get_common_of(const struct smf_state *source,
+					     const struct smf_state *dest)
+{
+	size_t source_depth = get_depth_of(source);
+	size_t dest_depth = get_depth_of(dest);
+
+	for (; source_depth > dest_depth; source_depth--) {
+		source = source->parent;
+	}
+
+	for (; dest_depth > source_depth; dest_depth--) {
+		dest = dest->parent;
+	}
+
+	while (source != dest) {
+		source = source->parent;
+		dest = dest->parent;
+	}
+
+	return source;
+}
+
+static bool smf_execute_entry_action(struct smf_ctx *const ctx, const struct smf_state *state)
 {
-	for (const struct smf_state *ancestor = source->parent; ancestor != NULL;
-	     ancestor = ancestor->parent) {
-		if (ancestor == dest) {
-			return ancestor->parent;
-		} else if (share_paren(dest, ancestor)) {
-			return ancestor;
+	struct internal_ctx *const internal = (void *)&ctx->internal;
+
+	/* Keep track of the executing entry action in case it calls
+	 * smf_set_state()
+	 */
+	ctx->executing = state;
+	if (state->entry) {
+		state->entry(ctx);
+
+		/* No need to continue if terminate was set */
+		if (internal->terminate) {
+			return true;
 		}
 	}
 
-	return NULL;
+	return false;
 }
 
 /**
  * @brief Executes all entry actions from the direct child of topmost to the new state
  *
+ * The states to enter are recorded on the way up from the new state, and
+ * entered in reverse order. Only the part of a path longer than
+ * CONFIG_SMF_ANCESTOR_PATH_LEN is searched level by level.
+ *
  * @param ctx State machine context
  * @param new_state State we are transitioning to
  * @param topmost State we are entering from. Its entry action is not executed
@@ -90,38 +125,33 @@ static bool smf_execute_all_entry_actions(struct smf_ctx *const ctx,
 					  const struct smf_state *new_state,
 					  const struct smf_state *topmost)
 {
-	struct internal_ctx *const internal = (void *)&ctx->internal;
+	const struct smf_state *path[CONFIG_SMF_ANCESTOR_PATH_LEN];
+	const struct smf_state *state = new_state;
+	size_t len = 0;
 
-	if (new_state == topmost) {
-		/* There are no child states, so do nothing */
-		return false;
+	for (; state != NULL && state != topmost && len < ARRAY_SIZE(path);
+	     state = state->parent) {
+		path[len++] = state;
 	}
 
-	for (const struct smf_state *to_execute = get_child_of(new_state, topmost);
-	     to_execute != NULL && to_execute != new_state;
-	     to_execute = get_child_of(new_state, to_execute)) {
-		/* Keep track of the executing entry action in case it calls
-		 * smf_set_state()
+	if (state != NULL && state != topmost) {
+		/* Enter the states above the recorded path, up to and
+		 * including state
 		 */
-		ctx->executing = to_execute;
-		/* Execute every entry action EXCEPT that of the topmost state */
-		if (to_execute->entry) {
-			to_execute->entry(ctx);
-
-			/* No need to continue if terminate was set */
-			if (internal->terminate) {
+		for (const struct smf_state *to_execute = get_child_of(state, topmost);
+		     to_execute != NULL; to_execute = get_child_of(state, to_execute)) {
+			if (smf_execute_entry_action(ctx, to_execute)) {
 				return true;
 			}
+
+			if (to_execute == state) {
+				break;
+			}
 		}
 	}
 
-	/* and execute the new state entry action */
-	ctx->executing = new_state;
-	if (new_state->entry) {
-		new_state->entry(ctx);
-
-		/* No need to continue if terminate was set */
-		if (internal->terminate) {
+	while (len > 0) {
+		if (smf_execute_entry_action(ctx, path[--len])) {
 			return true;
 		}
 	}
@@ -289,18 +319,11 @@ void smf_set_state(struct smf_ctx *const ctx, const struct smf_state *new_state)
 	}
 
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
-	const struct smf_state *topmost;
-
-	if (share_paren(ctx->executing, new_state)) {
-		/* new state is a parent of where we are now*/
-		topmost = new_state;
-	} else if (share_paren(new_state, ctx->executing)) {
-		/* we are a parent of the new state */
-		topmost = ctx->executing;
-	} else {
-		/* not directly related, find LCA */
-		topmost = get_lca_of(ctx->executing, new_state);
-	}
+	/*
+	 * The new state if it is a parent of where we are now, where we are
+	 * now if we are a parent of the new state, else the LCA.
+	 */
+	const struct smf_state *topmost = get_common_of(ctx->executing, new_state);
 
 	internal->is_exit = true;
 	internal->new_state = true;
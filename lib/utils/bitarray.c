@@ -157,6 +157,41 @@ mismatch:
 	return false;
 }
 
+/*
+ * Find the first cleared bit at or after a location, one bundle at a time.
+ *
+ * @param bitarray Bitarray struct
+ * @param offset   Starting bit location
+ *
+ * @return Offset of the cleared bit, or the number of bits in the
+ *         bitarray if all bits from offset on are set.
+ */
+static size_t find_next_cleared(sys_bitarray_t *bitarray, size_t offset)
+{
+	size_t idx = offset / bundle_bitness(bitarray);
+	uint32_t bundle;
+
+	if (offset >= bitarray->num_bits) {
+		return bitarray->num_bits;
+	}
+
+	/* Ignore the bits before offset in the first bundle */
+	bundle = ~bitarray->bundles[idx] & ~(BIT(offset % bundle_bitness(bitarray)) - 1);
+
+	while (bundle == 0U) {
+		idx++;
+		if (idx >= bitarray->num_bundles) {
+			return bitarray->num_bits;
+		}
+
+		bundle = ~bitarray->bundles[idx];
+	}
+
+	/* The unused bits of the last bundle are always cleared */
+	return MIN(idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1,
+		   bitarray->num_bits);
+}
+
 /*
  * Set or clear a region of bits.
  *
@@ -495,7 +530,7 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 	uint32_t bit_idx;
 	int ret;
 	struct bundle_data bd;
-	size_t off_start, off_end;
+	size_t off_end;
 	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
@@ -513,29 +548,10 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
 	/* Find the first non-allocated bit by looking at bundles
 	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
 	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
+	bit_idx = find_next_cleared(bitarray, 0);
 
 	off_end = bitarray->num_bits - num_bits;
 	ret = -ENOSPC;
@@ -549,10 +565,10 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 			break;
 		}
 
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
+		/* Fast-forward to the first free bit after the mismatched
+		 * bit, skipping whole bundles of allocated bits at once.
 		 */
-		bit_idx = mismatch + 1;
+		bit_idx = find_next_cleared(bitarray, mismatch + 1);
 	}
 
 out:
@@ -18,6 +18,10 @@
 
 #include <zephyr/data/json.h>
 
+#if defined(CONFIG_NET_BUF)
+#include <zephyr/net_buf.h>
+#endif
+
 struct json_obj_key_value {
 	const char *key;
 	size_t key_len;
@@ -1189,6 +1193,569 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+#if defined(CONFIG_JSON_LIBRARY_STREAM)
+
+/*
+ * The streaming parser is a byte at a time lexer feeding a pushdown
+ * automaton: the frames on the stack stand for the recursion of
+ * obj_parse() and arr_parse(), so that parsing can stop at the end of a
+ * chunk and resume with the next one.
+ */
+
+enum json_stream_lex {
+	STREAM_LEX_JSON,
+	STREAM_LEX_WORD,
+	STREAM_LEX_STRING,
+	STREAM_LEX_ESCAPE,
+	STREAM_LEX_UNICODE,
+	STREAM_LEX_DONE,
+};
+
+enum json_stream_state {
+	STREAM_KEY_OR_END,
+	STREAM_KEY,
+	STREAM_COLON,
+	STREAM_VALUE_OR_END,
+	STREAM_VALUE,
+	STREAM_NEXT_OR_END,
+};
+
+static struct json_stream_frame *stream_top(struct json_stream *stream)
+{
+	return &stream->stack[stream->depth - 1];
+}
+
+static struct json_stream_frame *stream_push(struct json_stream *stream, bool is_array,
+					     const struct json_obj_descr *descr, size_t descr_len,
+					     void *val)
+{
+	struct json_stream_frame *frame;
+
+	if (stream->depth == ARRAY_SIZE(stream->stack)) {
+		return NULL;
+	}
+
+	frame = &stream->stack[stream->depth++];
+	frame->descr = descr;
+	frame->descr_len = descr_len;
+	frame->val = val;
+	frame->decoded = 0;
+	frame->cur = -1;
+	frame->is_array = is_array;
+	frame->nested = false;
+	frame->state = is_array ? STREAM_VALUE_OR_END : STREAM_KEY_OR_END;
+
+	return frame;
+}
+
+static int stream_push_obj(struct json_stream *stream, const struct json_obj_descr *descr,
+			   size_t descr_len, void *val)
+{
+	return stream_push(stream, false, descr, descr_len, val) != NULL ? 0 : -ENOMEM;
+}
+
+static int stream_push_arr(struct json_stream *stream, const struct json_obj_descr *elem_descr,
+			   size_t max_elements, void *field, void *val)
+{
+	struct json_stream_frame *frame;
+
+	frame = stream_push(stream, true, elem_descr, max_elements, val);
+	if (frame == NULL) {
+		return -ENOMEM;
+	}
+
+	if (elem_descr == NULL) {
+		return 0;
+	}
+
+	/* Same layout as for arr_parse() */
+	frame->elements = (size_t *)((char *)val + elem_descr->offset);
+
+	if (elem_descr->type == JSON_TOK_ARRAY_START) {
+		frame->descr = elem_descr->array.element_descr;
+		frame->nested = true;
+	}
+
+	*frame->elements = 0;
+	frame->field = field;
+	frame->elem_size = get_elem_size(frame->descr);
+
+	__ASSERT_NO_MSG(frame->elem_size > 0);
+
+	return 0;
+}
+
+/* Descriptor of the value expected by @a frame, NULL if it is to be skipped */
+static const struct json_obj_descr *stream_value_descr(const struct json_stream_frame *frame,
+						       void **field, void **val)
+{
+	if (!frame->is_array) {
+		if (frame->cur < 0) {
+			return NULL;
+		}
+
+		*field = (char *)frame->val + frame->descr[frame->cur].offset;
+		*val = frame->val;
+
+		return &frame->descr[frame->cur];
+	}
+
+	if (frame->descr == NULL || *frame->elements == frame->descr_len) {
+		return NULL;
+	}
+
+	*field = frame->field;
+	*val = frame->nested ? frame->field : frame->val;
+
+	return frame->descr;
+}
+
+static int stream_value_done(struct json_stream *stream)
+{
+	struct json_stream_frame *frame = stream_top(stream);
+
+	if (frame->is_array) {
+		if (frame->descr != NULL) {
+			(*frame->elements)++;
+			frame->field += frame->elem_size;
+		}
+	} else if (frame->cur >= 0) {
+		frame->decoded |= (int64_t)1 << frame->cur;
+	}
+
+	return 0;
+}
+
+static int stream_pop(struct json_stream *stream)
+{
+	stream->depth--;
+
+	if (stream->depth == 0) {
+		stream->result = stream->stack[0].decoded;
+		stream->lex_state = STREAM_LEX_DONE;
+
+		return 1;
+	}
+
+	return stream_value_done(stream);
+}
+
+static int stream_find_field(const struct json_stream_frame *frame, const char *key,
+			     size_t key_len)
+{
+	for (size_t i = 0; i < frame->descr_len; i++) {
+		/* Field has been decoded already, skip */
+		if (frame->decoded & ((int64_t)1 << i)) {
+			continue;
+		}
+
+		if (key_len == frame->descr[i].field_name_len &&
+		    memcmp(key, frame->descr[i].field_name, key_len) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int stream_value(struct json_stream *stream, struct json_stream_frame *frame,
+			enum json_tokens type)
+{
+	const struct json_obj_descr *descr;
+	struct json_token token;
+	void *field = NULL;
+	void *val = NULL;
+	int ret;
+
+	if (frame->is_array && frame->descr != NULL && *frame->elements == frame->descr_len) {
+		return -ENOSPC;
+	}
+
+	descr = stream_value_descr(frame, &field, &val);
+	frame->state = STREAM_NEXT_OR_END;
+
+	/* As for skip_field(), anything goes within a skipped value */
+	if (element_token(type) < 0 && (frame->descr != NULL || type != JSON_TOK_NULL)) {
+		return -EINVAL;
+	}
+
+	if (descr == NULL) {
+		if (type == JSON_TOK_OBJECT_START) {
+			return stream_push_obj(stream, NULL, 0, NULL);
+		}
+
+		if (type == JSON_TOK_ARRAY_START) {
+			return stream_push_arr(stream, NULL, 0, NULL, NULL);
+		}
+
+		return 0;
+	}
+
+	if (!equivalent_types(type, descr->type)) {
+		return -EINVAL;
+	}
+
+	switch (descr->type) {
+	case JSON_TOK_OBJECT_START:
+		return stream_push_obj(stream, descr->object.sub_descr,
+				       descr->object.sub_descr_len, field);
+	case JSON_TOK_ARRAY_START:
+		return stream_push_arr(stream, descr->array.element_descr,
+				       descr->array.n_elements, field, val);
+	case JSON_TOK_STRING_BUF:
+		/* Already copied to the field by the lexer */
+		if (stream->overflow) {
+			return -EINVAL;
+		}
+
+		((char *)field)[stream->len] = '\0';
+		break;
+	case JSON_TOK_STRING:
+	case JSON_TOK_OPAQUE:
+	case JSON_TOK_FLOAT:
+	case JSON_TOK_OBJ_ARRAY:
+		/* Would point into a chunk which does not outlive the call */
+		return -ENOTSUP;
+	default:
+		token.type = type;
+		token.start = stream->tok;
+		token.end = stream->tok + stream->len;
+
+		ret = decode_value(NULL, descr, &token, field, val);
+		if (ret < 0) {
+			return ret;
+		}
+
+		break;
+	}
+
+	return stream_value_done(stream);
+}
+
+static int stream_token(struct json_stream *stream, enum json_tokens type)
+{
+	struct json_stream_frame *frame;
+
+	if (stream->depth == 0) {
+		if (type != JSON_TOK_OBJECT_START) {
+			return -EINVAL;
+		}
+
+		return stream_push_obj(stream, stream->descr, stream->descr_len, stream->val);
+	}
+
+	frame = stream_top(stream);
+
+	switch (frame->state) {
+	case STREAM_KEY_OR_END:
+		if (type == JSON_TOK_OBJECT_END) {
+			return stream_pop(stream);
+		}
+
+		__fallthrough;
+	case STREAM_KEY:
+		if (type != JSON_TOK_STRING) {
+			return -EINVAL;
+		}
+
+		/* A key too long to be held matches no field */
+		frame->cur = stream->overflow ? -1 : stream_find_field(frame, stream->tok,
+								       stream->len);
+		frame->state = STREAM_COLON;
+
+		return 0;
+	case STREAM_COLON:
+		if (type != JSON_TOK_COLON) {
+			return -EINVAL;
+		}
+
+		frame->state = STREAM_VALUE;
+
+		return 0;
+	case STREAM_VALUE_OR_END:
+		if (type == JSON_TOK_ARRAY_END) {
+			return stream_pop(stream);
+		}
+
+		__fallthrough;
+	case STREAM_VALUE:
+		return stream_value(stream, frame, type);
+	case STREAM_NEXT_OR_END:
+		if (type == JSON_TOK_COMMA) {
+			frame->state = frame->is_array ? STREAM_VALUE : STREAM_KEY;
+			return 0;
+		}
+
+		if (type == (frame->is_array ? JSON_TOK_ARRAY_END : JSON_TOK_OBJECT_END)) {
+			return stream_pop(stream);
+		}
+
+		return -EINVAL;
+	default:
+		return -EINVAL;
+	}
+}
+
+static void stream_sink(struct json_stream *stream, char *sink, size_t size)
+{
+	stream->sink = sink;
+	stream->sink_size = size;
+	stream->len = 0;
+	stream->overflow = false;
+}
+
+static void stream_append(struct json_stream *stream, char chr)
+{
+	if (stream->sink == NULL) {
+		return;
+	}
+
+	if (stream->len == stream->sink_size) {
+		stream->overflow = true;
+		return;
+	}
+
+	stream->sink[stream->len++] = chr;
+}
+
+/* Keys are held until complete, string values are copied straight to
+ * their field or discarded.
+ */
+static void stream_string_begin(struct json_stream *stream)
+{
+	const struct json_obj_descr *descr;
+	struct json_stream_frame *frame;
+	void *field;
+	void *val;
+
+	stream_sink(stream, NULL, 0);
+
+	if (stream->depth == 0) {
+		return;
+	}
+
+	frame = stream_top(stream);
+
+	switch (frame->state) {
+	case STREAM_KEY_OR_END:
+	case STREAM_KEY:
+		stream_sink(stream, stream->tok, sizeof(stream->tok) - 1);
+		break;
+	case STREAM_VALUE_OR_END:
+	case STREAM_VALUE:
+		descr = stream_value_descr(frame, &field, &val);
+		if (descr != NULL && descr->type == JSON_TOK_STRING_BUF && descr->field.size > 0) {
+			stream_sink(stream, field, descr->field.size - 1);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static bool stream_word_is(const struct json_stream *stream, const char *word)
+{
+	return stream->len == strlen(word) && memcmp(stream->tok, word, stream->len) == 0;
+}
+
+static int stream_word(struct json_stream *stream)
+{
+	const char *chr = stream->tok;
+	const char *end = stream->tok + stream->len;
+
+	if (stream->overflow) {
+		return -EINVAL;
+	}
+
+	if (stream_word_is(stream, "true")) {
+		return stream_token(stream, JSON_TOK_TRUE);
+	}
+
+	if (stream_word_is(stream, "false")) {
+		return stream_token(stream, JSON_TOK_FALSE);
+	}
+
+	if (stream_word_is(stream, "null")) {
+		return stream_token(stream, JSON_TOK_NULL);
+	}
+
+#ifdef CONFIG_JSON_LIBRARY_FP_SUPPORT
+	if (stream_word_is(stream, "NaN") || stream_word_is(stream, "Infinity") ||
+	    stream_word_is(stream, "-Infinity")) {
+		return stream_token(stream, JSON_TOK_NUMBER);
+	}
+#endif
+
+	/* Same characters as accepted by lexer_number() */
+	if (*chr == '-') {
+		chr++;
+	}
+
+	if (chr == end || isdigit((unsigned char)*chr) == 0) {
+		return -EINVAL;
+	}
+
+	for (; chr < end; chr++) {
+		if (isdigit((unsigned char)*chr) == 0 && *chr != '.' && *chr != 'e' &&
+		    *chr != '+' && *chr != '-') {
+			return -EINVAL;
+		}
+	}
+
+	return stream_token(stream, JSON_TOK_NUMBER);
+}
+
+static int stream_char(struct json_stream *stream, char chr)
+{
+	int ret;
+
+	switch (stream->lex_state) {
+	case STREAM_LEX_WORD:
+		if (isalnum((unsigned char)chr) != 0 || chr == '.' || chr == '+' || chr == '-') {
+			stream_append(stream, chr);
+			return 0;
+		}
+
+		stream->lex_state = STREAM_LEX_JSON;
+
+		ret = stream_word(stream);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* The character ending the word is handled below */
+		break;
+	case STREAM_LEX_STRING:
+		if (chr == '"') {
+			stream->lex_state = STREAM_LEX_JSON;
+			return stream_token(stream, JSON_TOK_STRING);
+		}
+
+		if (chr == '\\') {
+			stream->lex_state = STREAM_LEX_ESCAPE;
+		}
+
+		stream_append(stream, chr);
+		return 0;
+	case STREAM_LEX_ESCAPE:
+		switch (chr) {
+		case '"':
+		case '\\':
+		case '/':
+		case 'b':
+		case 'f':
+		case 'n':
+		case 'r':
+		case 't':
+			stream->lex_state = STREAM_LEX_STRING;
+			break;
+		case 'u':
+			stream->hex_digits = 4;
+			stream->lex_state = STREAM_LEX_UNICODE;
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		stream_append(stream, chr);
+		return 0;
+	case STREAM_LEX_UNICODE:
+		if (isxdigit((unsigned char)chr) == 0) {
+			return -EINVAL;
+		}
+
+		if (--stream->hex_digits == 0) {
+			stream->lex_state = STREAM_LEX_STRING;
+		}
+
+		stream_append(stream, chr);
+		return 0;
+	case STREAM_LEX_DONE:
+		return 1;
+	default:
+		break;
+	}
+
+	switch (chr) {
+	case '{':
+	case '}':
+	case '[':
+	case ']':
+	case ',':
+	case ':':
+		return stream_token(stream, (enum json_tokens)chr);
+	case '"':
+		stream_string_begin(stream);
+		stream->lex_state = STREAM_LEX_STRING;
+		return 0;
+	default:
+		if (isspace((unsigned char)chr) != 0) {
+			return 0;
+		}
+
+		if (isalnum((unsigned char)chr) != 0 || chr == '-') {
+			stream_sink(stream, stream->tok, sizeof(stream->tok) - 1);
+			stream_append(stream, chr);
+			stream->lex_state = STREAM_LEX_WORD;
+			return 0;
+		}
+
+		return -EINVAL;
+	}
+}
+
+void json_stream_init(struct json_stream *stream, const struct json_obj_descr *descr,
+		      size_t descr_len, void *val)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(stream->result) * CHAR_BIT - 1));
+
+	stream->descr = descr;
+	stream->descr_len = descr_len;
+	stream->val = val;
+	stream->result = -EAGAIN;
+	stream->depth = 0;
+	stream->lex_state = STREAM_LEX_JSON;
+	stream_sink(stream, NULL, 0);
+}
+
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	int ret = 0;
+
+	if (stream->lex_state == STREAM_LEX_DONE) {
+		return 1;
+	}
+
+	if (stream->result != -EAGAIN) {
+		return stream->result;
+	}
+
+	for (size_t i = 0; i < len && ret == 0; i++) {
+		ret = stream_char(stream, data[i]);
+	}
+
+	if (ret < 0) {
+		/* As for arr_parse(), any error within an element is -EINVAL */
+		for (int i = 0; i < (int)stream->depth - 1; i++) {
+			if (stream->stack[i].is_array && stream->stack[i].descr != NULL) {
+				ret = -EINVAL;
+				break;
+			}
+		}
+
+		stream->result = ret;
+	}
+
+	return ret;
+}
+
+int64_t json_stream_result(const struct json_stream *stream)
+{
+	return stream->result;
+}
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 static char escape_as(char chr)
 {
 	switch (chr) {
@@ -1215,22 +1782,39 @@ static int json_escape_internal(const char *str,
 				json_append_bytes_t append_bytes,
 				void *data)
 {
+	const char *run = str;
 	const char *cur;
-	int ret = 0;
+	int ret;
 
-	for (cur = str; ret == 0 && *cur; cur++) {
+	/* Characters not to be escaped are appended in runs */
+	for (cur = str; *cur; cur++) {
 		char escaped = escape_as(*cur);
+		char bytes[2] = { '\\', escaped };
 
-		if (escaped) {
-			char bytes[2] = { '\\', escaped };
+		if (!escaped) {
+			continue;
+		}
 
-			ret = append_bytes(bytes, 2, data);
-		} else {
-			ret = append_bytes(cur, 1, data);
+		if (cur != run) {
+			ret = append_bytes(run, cur - run, data);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		ret = append_bytes(bytes, 2, data);
+		if (ret < 0) {
+			return ret;
 		}
+
+		run = cur + 1;
 	}
 
-	return ret;
+	if (cur == run) {
+		return 0;
+	}
+
+	return append_bytes(run, cur - run, data);
 }
 
 size_t json_calc_escaped_len(const char *str, size_t len)
@@ -1370,72 +1954,68 @@ static int str_encode(const char *str, json_append_bytes_t append_bytes,
 	return ret;
 }
 
-static int int32_encode(const int32_t *num, json_append_bytes_t append_bytes,
-			void *data)
+/* Write the decimal digits of num backwards from end, returning the first
+ * one. Values fitting 32 bits avoid the 64-bit division helpers.
+ */
+static char *digits_encode(uint64_t num, char *end)
 {
-	char buf[3 * sizeof(int32_t)];
-	int ret;
+	uint32_t num_32;
 
-	ret = snprintk(buf, sizeof(buf), "%d", *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
+	while (num > UINT32_MAX) {
+		*--end = '0' + (char)(num % 10U);
+		num /= 10U;
 	}
 
-	return append_bytes(buf, (size_t)ret, data);
+	num_32 = (uint32_t)num;
+
+	do {
+		*--end = '0' + (char)(num_32 % 10U);
+		num_32 /= 10U;
+	} while (num_32 != 0U);
+
+	return end;
 }
 
-static int uint32_encode(const uint32_t *num, json_append_bytes_t append_bytes,
-			 void *data)
+static int num_encode(uint64_t num, bool negative, json_append_bytes_t append_bytes,
+		      void *data)
 {
-	char buf[3 * sizeof(uint32_t)];
-	int ret;
+	char buf[sizeof("-18446744073709551615")];
+	char *end = buf + sizeof(buf);
+	char *start;
 
-	ret = snprintk(buf, sizeof(buf), "%u", *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
+	start = digits_encode(num, end);
+	if (negative) {
+		*--start = '-';
 	}
 
-	return append_bytes(buf, (size_t)ret, data);
+	return append_bytes(start, end - start, data);
 }
 
-static int int64_encode(const int64_t *num, json_append_bytes_t append_bytes,
+static int int32_encode(const int32_t *num, json_append_bytes_t append_bytes,
 			void *data)
 {
-	char buf[sizeof("-9223372036854775808")];
-	int ret;
+	/* Negated as unsigned to cope with INT32_MIN */
+	return num_encode(*num < 0 ? -(uint64_t)*num : (uint64_t)*num, *num < 0,
+			  append_bytes, data);
+}
 
-	ret = snprintk(buf, sizeof(buf), "%" PRId64, *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
-	}
+static int uint32_encode(const uint32_t *num, json_append_bytes_t append_bytes,
+			 void *data)
+{
+	return num_encode(*num, false, append_bytes, data);
+}
 
-	return append_bytes(buf, (size_t)ret, data);
+static int int64_encode(const int64_t *num, json_append_bytes_t append_bytes,
+			void *data)
+{
+	return num_encode(*num < 0 ? -(uint64_t)*num : (uint64_t)*num, *num < 0,
+			  append_bytes, data);
 }
 
 static int uint64_encode(const uint64_t *num, json_append_bytes_t append_bytes,
 			void *data)
 {
-	char buf[sizeof("18446744073709551610")];
-	int ret;
-
-	ret = snprintk(buf, sizeof(buf), "%" PRIu64, *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
-	}
-
-	return append_bytes(buf, (size_t)ret, data);
+	return num_encode(*num, false, append_bytes, data);
 }
 
 static int print_double(char *str, size_t size, const char *fmt, double num)
@@ -1666,12 +2246,17 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 	}
 
 	for (i = 0; i < descr_len; i++) {
-		ret = str_encode(descr[i].field_name, append_bytes, data);
+		ret = append_bytes("\"", 1, data);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = json_escape_internal(descr[i].field_name, append_bytes, data);
 		if (ret < 0) {
 			return ret;
 		}
 
-		ret = append_bytes(":", 1, data);
+		ret = append_bytes("\":", 2, data);
 		if (ret < 0) {
 			return ret;
 		}
@@ -1739,6 +2324,61 @@ int json_arr_encode_buf(const struct json_obj_descr *descr, const void *val,
 	return json_arr_encode(descr, val, append_bytes_to_buf, &appender);
 }
 
+#if defined(CONFIG_NET_BUF)
+struct net_buf_appender {
+	struct net_buf *buf;
+	/* Last fragment of buf, not to walk the chain on every append */
+	struct net_buf *frag;
+	k_timeout_t timeout;
+};
+
+static int append_bytes_to_net_buf(const char *bytes, size_t len, void *data)
+{
+	struct net_buf_appender *appender = data;
+	size_t count = MIN(len, net_buf_tailroom(appender->frag));
+
+	net_buf_add_mem(appender->frag, bytes, count);
+	if (count == len) {
+		return 0;
+	}
+
+	/* Out of room, further fragments come from the pool of the buffer */
+	len -= count;
+	if (net_buf_append_bytes(appender->buf, len, bytes + count, appender->timeout,
+				 NULL, NULL) < len) {
+		return -ENOMEM;
+	}
+
+	appender->frag = net_buf_frag_last(appender->frag);
+
+	return 0;
+}
+
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf_appender appender = {
+		.buf = buf,
+		.frag = net_buf_frag_last(buf),
+		.timeout = timeout,
+	};
+
+	return json_obj_encode(descr, descr_len, val, append_bytes_to_net_buf, &appender);
+}
+
+int json_arr_encode_net_buf(const struct json_obj_descr *descr, const void *val,
+			    struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf_appender appender = {
+		.buf = buf,
+		.frag = net_buf_frag_last(buf),
+		.timeout = timeout,
+	};
+
+	return json_arr_encode(descr, val, append_bytes_to_net_buf, &appender);
+}
+#endif /* CONFIG_NET_BUF */
+
 static int measure_bytes(const char *bytes, size_t len, void *data)
 {
 	ssize_t *total = data;
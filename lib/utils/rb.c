@@ -69,6 +69,36 @@ static void set_color(struct rbnode *n, enum rb_color color)
 	*p = (*p & ~1UL) | (uint8_t)color;
 }
 
+/* Recomputes the augmented data of a node whose subtree changed */
+static inline void augment_node(struct rbtree *tree, struct rbnode *node)
+{
+#ifdef CONFIG_RB_AUGMENT
+	if (tree->augment_fn != NULL) {
+		tree->augment_fn(node);
+	}
+#else
+	ARG_UNUSED(tree);
+	ARG_UNUSED(node);
+#endif
+}
+
+/* Recomputes the augmented data of the stacked nodes, bottom up */
+static inline void augment_path(struct rbtree *tree, struct rbnode **stack,
+				int stacksz)
+{
+#ifdef CONFIG_RB_AUGMENT
+	if (tree->augment_fn != NULL) {
+		for (int i = stacksz - 1; i >= 0; i--) {
+			tree->augment_fn(stack[i]);
+		}
+	}
+#else
+	ARG_UNUSED(tree);
+	ARG_UNUSED(stack);
+	ARG_UNUSED(stacksz);
+#endif
+}
+
 /* Searches the tree down to a node that is either identical with the
  * "node" argument or has an empty/leaf child pointer where "node"
  * should be, leaving all nodes found in the resulting stack.  Note
@@ -126,8 +156,10 @@ static uint8_t get_side(struct rbnode *parent, struct rbnode *child)
  *  N  c  -->  a   P
  * a b            b c
  *
+ * Only the subtrees of the two nodes change, so only their augmented
+ * data is recomputed.
  */
-static void rotate(struct rbnode **stack, int stacksz)
+static void rotate(struct rbtree *tree, struct rbnode **stack, int stacksz)
 {
 	CHECK(stacksz >= 2);
 
@@ -148,13 +180,16 @@ static void rotate(struct rbnode **stack, int stacksz)
 	set_child(parent, side, b);
 	stack[stacksz - 2] = child;
 	stack[stacksz - 1] = parent;
+
+	augment_node(tree, parent);
+	augment_node(tree, child);
 }
 
 /* The node at the top of the provided stack is red, and its parent is
  * too.  Iteratively fix the tree so it becomes a valid red black tree
  * again
  */
-static void fix_extra_red(struct rbnode **stack, int stacksz)
+static void fix_extra_red(struct rbtree *tree, struct rbnode **stack, int stacksz)
 {
 	while (stacksz > 1) {
 		struct rbnode *node = stack[stacksz - 1];
@@ -200,11 +235,11 @@ static void fix_extra_red(struct rbnode **stack, int stacksz)
 		uint8_t parent_side = get_side(parent, node);
 
 		if (parent_side != side) {
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 		}
 
 		/* Rotate the grandparent with parent, swapping colors */
-		rotate(stack, stacksz - 1);
+		rotate(tree, stack, stacksz - 1);
 		set_color(stack[stacksz - 3], BLACK);
 		set_color(stack[stacksz - 2], RED);
 		return;
@@ -225,6 +260,11 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 		tree->root = node;
 		tree->max_depth = 1;
 		set_color(node, BLACK);
+		augment_node(tree, node);
+#ifdef CONFIG_RB_CACHE_MINMAX
+		tree->minmax[0] = node;
+		tree->minmax[1] = node;
+#endif
 		return;
 	}
 
@@ -243,9 +283,22 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 	set_child(parent, side, node);
 	set_color(node, RED);
 
+#ifdef CONFIG_RB_CACHE_MINMAX
+	/* The node is a new extreme iff it went left (right) of the
+	 * previous one
+	 */
+	if (parent == tree->minmax[side]) {
+		tree->minmax[side] = node;
+	}
+#endif
+
 	stack[stacksz] = node;
 	++stacksz;
-	fix_extra_red(stack, stacksz);
+
+	/* All ancestors of the node got a new descendant */
+	augment_path(tree, stack, stacksz);
+
+	fix_extra_red(tree, stack, stacksz);
 
 	if (stacksz > tree->max_depth) {
 		tree->max_depth = stacksz;
@@ -266,7 +319,7 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
  * then clean it up (replace it with a simple NULL child in the
  * parent) when finished.
  */
-static void fix_missing_black(struct rbnode **stack, int stacksz,
+static void fix_missing_black(struct rbtree *tree, struct rbnode **stack, int stacksz,
 			      struct rbnode *null_node)
 {
 	/* Loop upward until we reach the root */
@@ -287,7 +340,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 		 */
 		if (!is_black(sib)) {
 			stack[stacksz - 1] = sib;
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 			set_color(parent, RED);
 			set_color(sib, BLACK);
 			stack[stacksz] = n;
@@ -308,6 +361,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 					is_black(c1))) {
 			if (n == null_node) {
 				set_child(parent, n_side, NULL);
+				augment_path(tree, stack, stacksz - 1);
 			}
 
 			set_color(sib, RED);
@@ -339,7 +393,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 			stack[stacksz - 1] = sib;
 			stack[stacksz] = inner;
 			++stacksz;
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 			set_color(sib, RED);
 			set_color(inner, BLACK);
 
@@ -361,9 +415,10 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 		set_color(parent, BLACK);
 		set_color(outer, BLACK);
 		stack[stacksz - 1] = sib;
-		rotate(stack, stacksz);
+		rotate(tree, stack, stacksz);
 		if (n == null_node) {
 			set_child(parent, n_side, NULL);
+			augment_path(tree, stack, stacksz);
 		}
 		return;
 	}
@@ -384,6 +439,22 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 		return;
 	}
 
+#ifdef CONFIG_RB_CACHE_MINMAX
+	/* An extreme node has no child on its side, so the next one
+	 * is its only child, a leaf, or else its parent
+	 */
+	for (uint8_t side = 0U; side < 2U; side++) {
+		if (node == tree->minmax[side]) {
+			tmp = get_child(node, (side == 0U) ? 1U : 0U);
+			if ((tmp == NULL) && (stacksz > 1)) {
+				tmp = stack[stacksz - 2];
+			}
+
+			tree->minmax[side] = tmp;
+		}
+	}
+#endif
+
 	/* We can only remove a node with zero or one child, if we
 	 * have two then pick the "biggest" child of side 0 (smallest
 	 * of 1 would work too) and swap our spot in the tree with
@@ -479,13 +550,15 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 	 */
 	if (child == NULL) {
 		if (is_black(node)) {
-			fix_missing_black(stack, stacksz, node);
+			fix_missing_black(tree, stack, stacksz, node);
 		} else {
 			/* Red childless nodes can just be dropped */
 			set_child(parent, get_side(parent, node), NULL);
+			augment_path(tree, stack, stacksz - 1);
 		}
 	} else {
 		set_child(parent, get_side(parent, node), child);
+		augment_path(tree, stack, stacksz - 1);
 
 		/* Check colors, if one was red (at least one must have been
 		 * black in a valid tree), then we're done.
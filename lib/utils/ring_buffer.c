@@ -38,7 +38,7 @@ int ring_buf_area_finish(struct ring_buf *buf, struct ring_buf_index *ring,
 		return -EINVAL;
 	}
 
-	ring->tail += size;
+	z_ring_buf_tail_store(ring, ring->tail + size);
 	ring->head = ring->tail;
 
 	tail_offset = ring->tail - ring->base;
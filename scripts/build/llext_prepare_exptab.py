@@ -12,7 +12,8 @@ is a special section filled with 'llext_const_symbol' structures
 generated by the EXPORT_SYMBOL macro.
 
 Currently, the preparatory work consists mostly of sorting the
-exports table to allow usage of binary search algorithms at runtime.
+exports table to allow usage of binary search algorithms at runtime,
+by SLID or, with CONFIG_LLEXT_EXPORT_BUILTINS_SORTED, by name.
 If CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID option is enabled, SLIDs
 of all exported functions are also injected in the export table by
 this script. (In this case, the preparation process is destructive)
@@ -21,6 +22,7 @@ this script. (In this case, the preparation process is destructive)
 import llext_slidlib
 
 from elftools.elf.elffile import ELFFile
+from elftools.elf.constants import SH_FLAGS
 from elftools.elf.sections import Section
 
 import argparse
@@ -217,26 +219,59 @@ class ZephyrElfExptabPreparator():
         return 0
 
     def _prepare_exptab_for_str_linking(self):
-        #TODO: sort the export table by symbol
-        #      name to allow binary search too
-        #
-        # Plan of action:
-        #   1) Locate in which section the names are located
-        #   2) Load the export table and resolve names
-        #   3) Sort the exports by name
-        #       WARN: THIS MUST USE THE SAME SORTING RULES
-        #       AS LLEXT CODE OR DICHOTOMIC SEARCH WILL BREAK
-        #       Using a custom sorting function might be required.
-        #   4) Write back the updated export table
-        #
-        # N.B.: reusing part of the code in _prepare_elf_for_slid_linking
-        # might be possible and desireable.
-        #
-        # As of writing, this function will never be called as this script
-        # is only called if CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID is enabled,
-        # which makes _prepare_exptab_for_slid_linking be called instead.
-        #
-        self.log.warn(f"_prepare_exptab_for_str_linking: do nothing")
+        """
+        IMPLEMENTATION NOTES:
+          Symbol names are regular NUL-terminated strings of the image,
+          pointed to by their runtime address.
+
+          The export table is sorted by name in ASCENDING order of the
+          raw bytes, which is the order of strcmp() used by LLEXT code.
+        """
+        if self.elf['e_type'] != 'ET_EXEC':
+            self.log.error(f"cannot sort the export table of a {self.elf['e_type']} ELF")
+            return 1
+
+        def read_symbol_name(name_addr):
+            for section in self.elf.iter_sections():
+                start = section['sh_addr']
+                if (section['sh_flags'] & SH_FLAGS.SHF_ALLOC) == 0 or \
+                        section['sh_type'] == 'SHT_NOBITS' or \
+                        not start <= name_addr < start + section['sh_size']:
+                    continue
+
+                raw_name = b''
+                self.elf_fd.seek(section['sh_offset'] + name_addr - start)
+
+                c = self.elf_fd.read(1)
+                while c != b'\0':
+                    raw_name += c
+                    c = self.elf_fd.read(1)
+
+                return raw_name
+
+            return None
+
+        #1) Load the export table and resolve names
+        exports_list = []
+        for (name_addr, export_address) in self.exptab_manipulator:
+            export_name = read_symbol_name(name_addr)
+            if export_name is None:
+                self.log.error(f"export name at 0x{name_addr:X} not found in ELF")
+                return 1
+
+            exports_list.append((export_name, name_addr, export_address))
+
+        #2) Sort the export table (order specified above)
+        exports_list.sort(key=lambda export: export[0])
+
+        for prev, cur in zip(exports_list, exports_list[1:]):
+            if prev[0] == cur[0]:
+                self.log.warning(f"{cur[0].decode('utf-8')} is exported more than once")
+
+        #3) Write back the updated export table
+        for i, (_, name_addr, export_address) in enumerate(exports_list):
+            self.exptab_manipulator[i] = (name_addr, export_address)
+
         return 0
 
     def _set_prep_done_shdr_flag(self):
@@ -24,6 +24,8 @@ LOG_THREADS_META_HDR_SIZE = struct.calcsize(LOG_THREADS_META_HDR_STRUCT)
 
 COREDUMP_MEM_HDR_ID = b'M'
 COREDUMP_MEM_HDR_VER = 1
+COREDUMP_MEM_HDR_VER_COMPRESSED = 2
+LOG_MEM_LZ_MIN_MATCH = 4
 LOG_MEM_HDR_STRUCT = "<cH"
 LOG_MEM_HDR_SIZE = struct.calcsize(LOG_MEM_HDR_STRUCT)
 
@@ -99,11 +101,46 @@ class CoredumpLogFile:
 
         return True
 
+    def decompress_memory(self, size):
+        # Note: keep sync with coredump_compression.c
+        out = bytearray()
+
+        while len(out) < size:
+            token = self.fd.read(1)
+            if not token:
+                return None
+
+            token = token[0]
+            if token < 0x80:
+                literals = self.fd.read(token + 1)
+                if len(literals) != token + 1:
+                    return None
+
+                out += literals
+            else:
+                data = self.fd.read(2)
+                if len(data) != 2:
+                    return None
+
+                length = (token & 0x7f) + LOG_MEM_LZ_MIN_MATCH
+                dist = struct.unpack("<H", data)[0]
+                if dist == 0 or dist > len(out):
+                    return None
+
+                # The match may overlap the bytes it produces
+                for _ in range(length):
+                    out.append(out[-dist])
+
+        if len(out) != size:
+            return None
+
+        return bytes(out)
+
     def parse_memory_section(self):
         hdr = self.fd.read(LOG_MEM_HDR_SIZE)
         _, hdr_ver = struct.unpack(LOG_MEM_HDR_STRUCT, hdr)
 
-        if hdr_ver != COREDUMP_MEM_HDR_VER:
+        if hdr_ver not in (COREDUMP_MEM_HDR_VER, COREDUMP_MEM_HDR_VER_COMPRESSED):
             logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}!")
             return False
 
@@ -121,7 +158,13 @@ class CoredumpLogFile:
 
         size = eaddr - saddr
 
-        data = self.fd.read(size)
+        if hdr_ver == COREDUMP_MEM_HDR_VER_COMPRESSED:
+            data = self.decompress_memory(size)
+            if data is None:
+                logger.error("Cannot decompress memory block")
+                return False
+        else:
+            data = self.fd.read(size)
 
         mem = {"start": saddr, "end": eaddr, "data": data}
         self.memory_regions.append(mem)
@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 Zephyr contributors
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Delta image patch tool
+######################
+
+Creates, and applies, the compressed delta patches that the image writer
+reconstructs images from when CONFIG_IMG_DELTA is enabled, see
+flash_img_delta_init_id().
+
+The base image must be the content of the partition the device reads it from,
+typically the running image as it was written to its slot, signed image
+included.
+
+Usage::
+
+    python3 img_delta.py create old.signed.bin new.signed.bin patch.bin
+    python3 img_delta.py apply old.signed.bin patch.bin new.signed.bin
+
+The decompression window size of the patch, set with --window-bits, must not be
+larger than the one selected with CONFIG_IMG_DELTA_WINDOW_BITS on the device.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x544C445A  # "ZDLT"
+HEADER = struct.Struct('<IIB3x')
+
+BLOCK = 8  # Size of the blocks indexed to find matches in the base image
+MAX_CANDIDATES = 16
+MIN_MATCH = 4
+LZ_HASH_CHAIN = 32
+
+
+def varint(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def zigzag(value):
+    return (value << 1) if value >= 0 else ((-value << 1) - 1)
+
+
+def exact_len(old, o, new, n):
+    """Length of the common prefix of old[o:] and new[n:]."""
+    length = 0
+    limit = min(len(old) - o, len(new) - n)
+    while length + 64 <= limit and old[o + length : o + length + 64] == new[n + length : n + length + 64]:
+        length += 64
+    while length < limit and old[o + length] == new[n + length]:
+        length += 1
+    return length
+
+
+def approx_len(old, o, new, n, start):
+    """Extend an exact match of start bytes, tolerating byte differences as bsdiff does."""
+    limit = min(len(old) - o, len(new) - n)
+    score = best_score = start
+    best = start
+    for i in range(start, limit):
+        if old[o + i] == new[n + i]:
+            score += 1
+        else:
+            score -= 1
+        if score > best_score:
+            best_score = score
+            best = i + 1
+        elif score < best_score - 16:
+            break
+    return best
+
+
+def diff(old, new):
+    """Split new into records of (base offset, diff length, extra length)."""
+    index = {}
+    for o in range(0, len(old) - BLOCK + 1):
+        positions = index.setdefault(old[o : o + BLOCK], [])
+        if len(positions) < MAX_CANDIDATES:
+            positions.append(o)
+
+    records = []
+    n = 0
+    extra_start = 0
+    cur = 0  # Base offset following the previous match
+    while n <= len(new) - BLOCK:
+        candidates = list(index.get(new[n : n + BLOCK], ()))
+        expected = cur + (n - extra_start)
+        if 0 <= expected < len(old):
+            candidates.append(expected)
+
+        best_o, best = 0, 0
+        for o in candidates:
+            length = exact_len(old, o, new, n)
+            if length > best:
+                best_o, best = o, length
+
+        if best < BLOCK:
+            n += 1
+            continue
+
+        length = approx_len(old, best_o, new, n, best)
+        records.append((n, best_o, length))
+        n += length
+        extra_start = n
+        cur = best_o + length
+
+    return records
+
+
+def encode_body(old, new):
+    """Patch body: records of diff, extra data and base offset adjustment."""
+    out = bytearray()
+    pos = 0
+    n = 0
+    # The first record has no diff, each match ends a record and starts the next one
+    out += varint(0)
+    for start, o, length in diff(old, new):
+        out += varint(start - n) + new[n:start] + varint(zigzag(o - pos))
+        out += varint(length)
+        out += bytes((new[start + i] - old[o + i]) & 0xFF for i in range(length))
+        pos = o + length
+        n = start + length
+    out += varint(len(new) - n) + new[n:] + varint(0)
+    return bytes(out)
+
+
+def compress(data, window):
+    """LZ4 block format sequences with match offsets up to the window size."""
+    out = bytearray()
+    chains = {}
+    literal_start = 0
+    i = 0
+
+    def length_bytes(value):
+        buf = bytearray()
+        while value >= 255:
+            buf.append(255)
+            value -= 255
+        buf.append(value)
+        return buf
+
+    def emit(literals, offset, match):
+        lit = len(literals)
+        token = (min(lit, 15) << 4) | (min(match - MIN_MATCH, 15) if match else 0)
+        out.append(token)
+        if lit >= 15:
+            out.extend(length_bytes(lit - 15))
+        out.extend(literals)
+        if match:
+            out.extend(struct.pack('<H', offset))
+            if match - MIN_MATCH >= 15:
+                out.extend(length_bytes(match - MIN_MATCH - 15))
+
+    def insert(pos):
+        key = data[pos : pos + MIN_MATCH]
+        chain = chains.setdefault(key, [])
+        chain.append(pos)
+        if len(chain) > LZ_HASH_CHAIN:
+            del chain[0]
+
+    while i + MIN_MATCH <= len(data):
+        best, best_off = 0, 0
+        for cand in reversed(chains.get(data[i : i + MIN_MATCH], ())):
+            if i - cand > window:
+                break
+            length = exact_len(data, cand, data, i)
+            if length > best:
+                best, best_off = length, i - cand
+        if best >= MIN_MATCH:
+            emit(data[literal_start:i], best_off, best)
+            end = i + best
+            while i < end:
+                if i + MIN_MATCH <= len(data):
+                    insert(i)
+                i += 1
+            literal_start = i
+        else:
+            insert(i)
+            i += 1
+
+    emit(data[literal_start:], 0, 0)
+    return bytes(out)
+
+
+def decompress(data):
+    out = bytearray()
+    i = 0
+
+    def length(value):
+        nonlocal i
+        if value == 15:
+            while True:
+                byte = data[i]
+                i += 1
+                value += byte
+                if byte != 255:
+                    break
+        return value
+
+    while i < len(data):
+        token = data[i]
+        i += 1
+        lit = length(token >> 4)
+        out += data[i : i + lit]
+        i += lit
+        if i >= len(data):
+            break
+        offset = data[i] | (data[i + 1] << 8)
+        i += 2
+        match = length(token & 0x0F) + MIN_MATCH
+        for _ in range(match):
+            out.append(out[-offset])
+    return bytes(out)
+
+
+def create(old, new, window_bits):
+    return HEADER.pack(MAGIC, len(new), window_bits) + compress(
+        encode_body(old, new), 1 << window_bits
+    )
+
+
+def apply(old, patch):
+    magic, size, _ = HEADER.unpack_from(patch)
+    if magic != MAGIC:
+        raise ValueError('not a delta patch')
+    data = decompress(patch[HEADER.size :])
+    new = bytearray()
+    pos = 0
+    i = 0
+
+    def read_varint():
+        nonlocal i
+        value = shift = 0
+        while True:
+            byte = data[i]
+            i += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+
+    while len(new) < size:
+        length = read_varint()
+        new += bytes((data[i + k] + old[pos + k]) & 0xFF for k in range(length))
+        i += length
+        pos += length
+        length = read_varint()
+        new += data[i : i + length]
+        i += length
+        adjust = read_varint()
+        pos += (adjust >> 1) ^ -(adjust & 1)
+    return bytes(new)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[1],
+                                     allow_abbrev=False)
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    create_parser = sub.add_parser('create', help='create a patch')
+    create_parser.add_argument('old', help='base image')
+    create_parser.add_argument('new', help='new image')
+    create_parser.add_argument('patch', help='patch to create')
+    create_parser.add_argument('--window-bits', type=int, default=12,
+                               choices=range(8, 16),
+                               help='log2 of the decompression window size (default: 12)')
+
+    apply_parser = sub.add_parser('apply', help='apply a patch')
+    apply_parser.add_argument('old', help='base image')
+    apply_parser.add_argument('patch', help='patch to apply')
+    apply_parser.add_argument('new', help='image to create')
+
+    args = parser.parse_args()
+
+    with open(args.old, 'rb') as f:
+        old = f.read()
+
+    if args.command == 'create':
+        with open(args.new, 'rb') as f:
+            new = f.read()
+        patch = create(old, new, args.window_bits)
+        if apply(old, patch) != new:
+            sys.exit('patch verification failed')
+        with open(args.patch, 'wb') as f:
+            f.write(patch)
+        print(f'{len(patch)} bytes patch for a {len(new)} bytes image')
+    else:
+        with open(args.patch, 'rb') as f:
+            patch = f.read()
+        with open(args.new, 'wb') as f:
+            f.write(apply(old, patch))
+
+
+if __name__ == '__main__':
+    main()
@@ -55,6 +55,7 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_NORMAL_COMPACT = 2
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -88,6 +89,12 @@ class LogParserV3(LogParser):
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
 
+        # Compact messages carry 32-bit words of the package and
+        # timestamps relative to the one of the previous message
+        self.fmt_pkg_word = endian + "I"
+        self.timestamp_mask = (1 << (struct.calcsize(self.fmt_msg_timestamp) * 8)) - 1
+        self.timestamp = 0
+
 
     def __get_string(self, arg, arg_offset, string_tbl):
         one_str = self.database.find_string(arg)
@@ -279,12 +286,82 @@ class LogParserV3(LogParser):
             domain_id = domain_lvl & 0x0F
             level = (domain_lvl >> 4) & 0x0F
 
-        level_str, color = get_log_level_str_color(level)
-        source_id_str = self.database.get_log_source_string(domain_id, source_id)
-
         # Skip over data to point to next message (save as return value)
         next_msg_offset = offset + pkg_len + data_len
 
+        if not self.print_one_msg(logdata[offset:next_msg_offset], pkg_len,
+                                  domain_id, level, source_id, timestamp):
+            return None
+
+        # Point to next message
+        return next_msg_offset
+
+
+    @staticmethod
+    def get_varint(logdata, offset):
+        """Decode one variable length integer, returning it and the next offset"""
+        val = 0
+        shift = 0
+
+        while True:
+            one_byte = logdata[offset]
+            offset += 1
+
+            val |= (one_byte & 0x7F) << shift
+            shift += 7
+
+            if (one_byte & 0x80) == 0:
+                return val, offset
+
+
+    def parse_one_compact_msg(self, logdata, offset):
+        """Parse one compact log message and print the encoded message"""
+        domain_lvl = logdata[offset]
+        offset += 1
+
+        domain_id = domain_lvl & 0x0F
+        level = (domain_lvl >> 4) & 0x0F
+
+        source_id, offset = self.get_varint(logdata, offset)
+
+        delta, offset = self.get_varint(logdata, offset)
+        delta = (delta >> 1) ^ -(delta & 1)
+        self.timestamp = (self.timestamp + delta) & self.timestamp_mask
+
+        pkg_len, offset = self.get_varint(logdata, offset)
+        data_len, offset = self.get_varint(logdata, offset)
+
+        # Rebuild the package as laid out by the target, its first
+        # byte being the number of words of the arguments
+        msg = b""
+        if pkg_len > 0:
+            word, offset = self.get_varint(logdata, offset)
+            msg += struct.pack(self.fmt_pkg_word, word)
+
+            num_words = min(msg[0], pkg_len // struct.calcsize(self.fmt_pkg_word))
+            for _ in range(1, num_words):
+                word, offset = self.get_varint(logdata, offset)
+                msg += struct.pack(self.fmt_pkg_word, word)
+
+        raw_len = pkg_len + data_len - len(msg)
+        msg += logdata[offset:(offset + raw_len)]
+        offset += raw_len
+
+        if not self.print_one_msg(msg, pkg_len, domain_id, level, source_id, self.timestamp):
+            return None
+
+        return offset
+
+
+    def print_one_msg(self, logdata, pkg_len, domain_id, level, source_id, timestamp):
+        """Print one log message from its package followed by its data"""
+        offset = 0
+        data_len = len(logdata) - pkg_len
+        next_msg_offset = len(logdata)
+
+        level_str, color = get_log_level_str_color(level)
+        source_id_str = self.database.get_log_source_string(domain_id, source_id)
+
         # Offset from beginning of cbprintf_packaged data to end of va_list arguments
         offset_end_of_args = struct.unpack_from("B", logdata, offset)[0]
         offset_end_of_args *= self.data_types.get_sizeof(DataTypes.INT)
@@ -309,7 +386,7 @@ class LogParserV3(LogParser):
 
         if len(string_tbl) != num_packed_strings:
             logger.error("------ Error extracting string table")
-            return None
+            return False
 
         # Skip packaged string header
         offset += self.data_types.get_sizeof(DataTypes.PTR)
@@ -329,7 +406,7 @@ class LogParserV3(LogParser):
 
         if not fmt_str:
             logger.error("------ Error getting format string at 0x%x", fmt_str_ptr)
-            return None
+            return False
 
         args = self.process_one_fmt_str(fmt_str, logdata[offset:offset_end_of_args], string_tbl)
 
@@ -347,8 +424,7 @@ class LogParserV3(LogParser):
             # Has hexdump data
             self.print_hexdump(extra_data, len(log_prefix), color)
 
-        # Point to next message
-        return next_msg_offset
+        return True
 
 
     def parse_log_data(self, logdata, debug=False):
@@ -373,6 +449,13 @@ class LogParserV3(LogParser):
 
                 offset = ret
 
+            elif msg_type == MSG_TYPE_NORMAL_COMPACT:
+                ret = self.parse_one_compact_msg(logdata, offset)
+                if ret is None:
+                    return False
+
+                offset = ret
+
             else:
                 logger.error("------ Unknown message type: %s", msg_type)
                 return False
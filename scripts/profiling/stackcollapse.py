@@ -14,6 +14,10 @@ from addresses
 
 Usage:
     ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+
+With CONFIG_PROFILING_PERF_AGGREGATE, each stack trace is printed once with
+its number of samples, and the name of the sampled thread is added as the
+root frame.
 """
 
 import re
@@ -35,31 +39,57 @@ def addr_to_sym(addr, elf):
     return "[unknown]"
 
 
+def symbolize(addrs, elf):
+    func_trace = reversed(list(map(lambda a: addr_to_sym(a, elf), addrs)))
+    prev_func = next(func_trace)
+    line = prev_func
+    # merge dublicate functions
+    for func in func_trace:
+        if prev_func != func:
+            prev_func = func
+            line += ";" + func
+
+    return line
+
+
 def collapse(buf, elf):
     while buf:
         count, = struct.unpack_from(">Q", buf)
         assert count > 0
         addrs = struct.unpack_from(f">{count}Q", buf, 8)
 
-        func_trace = reversed(list(map(lambda a: addr_to_sym(a, elf), addrs)))
-        prev_func = next(func_trace)
-        line = prev_func
-        # merge dublicate functions
-        for func in func_trace:
-            if prev_func != func:
-                prev_func = func
-                line += ";" + func
-
-        print(line, 1)
+        print(symbolize(addrs, elf), 1)
         buf = buf[8 + 8 * count:]
 
 
+def collapse_aggregated(buf, elf, threads):
+    while buf:
+        count, samples, thread = struct.unpack_from(">QQQ", buf)
+        assert count > 0
+        addrs = struct.unpack_from(f">{count}Q", buf, 24)
+
+        thread_name = threads.get(thread, f"thread_{thread:x}")
+        print(thread_name + ";" + symbolize(addrs, elf), samples)
+        buf = buf[24 + 8 * count:]
+
+
 if __name__ == "__main__":
     elf = ELFFile(open(sys.argv[2], "rb"))
     with open(sys.argv[1], "r") as f:
         inp = f.read()
 
     lines = inp.splitlines()
-    assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
-    buf = binascii.unhexlify("".join(lines[1:]))
-    collapse(buf, elf)
+    header = re.match(r"Perf buf length (\d+)( aggregated)?", lines[0])
+    length = int(header.group(1))
+    buf = binascii.unhexlify("".join(lines[1:length + 1]))
+
+    if header.group(2):
+        threads = {}
+        for line in lines[length + 1:]:
+            m = re.match(r"Perf thread ([0-9a-f]+) (.*)", line)
+            if m:
+                threads[int(m.group(1), 16)] = m.group(2)
+        collapse_aggregated(buf, elf, threads)
+    else:
+        assert length == len(lines) - 1
+        collapse(buf, elf)
@@ -0,0 +1,233 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/audio/pipeline.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(audio_pipeline, CONFIG_AUDIO_PIPELINE_LOG_LEVEL);
+
+int audio_pipeline_init(struct audio_pipeline *pipe, const struct device *rx_dev,
+			const struct device *tx_dev, struct audio_pipeline_stage *stages,
+			size_t num_stages)
+{
+	const struct i2s_config *rx_cfg;
+	const struct i2s_config *tx_cfg;
+
+	if (!device_is_ready(rx_dev) || (tx_dev != NULL && !device_is_ready(tx_dev))) {
+		return -ENODEV;
+	}
+
+	rx_cfg = i2s_config_get(rx_dev, I2S_DIR_RX);
+	if (rx_cfg == NULL || rx_cfg->mem_slab == NULL) {
+		LOG_ERR("RX direction of %s is not configured", rx_dev->name);
+		return -EINVAL;
+	}
+
+	if (tx_dev != NULL) {
+		tx_cfg = i2s_config_get(tx_dev, I2S_DIR_TX);
+		if (tx_cfg == NULL || tx_cfg->mem_slab != rx_cfg->mem_slab) {
+			LOG_ERR("TX direction of %s must use the RX memory slab", tx_dev->name);
+			return -EINVAL;
+		}
+	}
+
+	memset(pipe, 0, sizeof(struct audio_pipeline));
+	pipe->rx_dev = rx_dev;
+	pipe->tx_dev = tx_dev;
+	pipe->slab = rx_cfg->mem_slab;
+	pipe->stages = stages;
+	pipe->num_stages = num_stages;
+
+	for (size_t i = 0; i < num_stages; i++) {
+		memset(&stages[i].stats, 0, sizeof(stages[i].stats));
+	}
+
+	return 0;
+}
+
+/* Run a block through the stages, returns true if it must be passed to the sink */
+static bool audio_pipeline_process(struct audio_pipeline *pipe, void *block, size_t *size)
+{
+	size_t capacity = pipe->slab->info.block_size;
+
+	for (size_t i = 0; i < pipe->num_stages; i++) {
+		struct audio_pipeline_stage *stage = &pipe->stages[i];
+		uint32_t start = k_cycle_get_32();
+		int ret = stage->process(stage, block, size, capacity);
+		uint32_t cycles = k_cycle_get_32() - start;
+		k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+		stage->stats.blocks++;
+		stage->stats.cycles += cycles;
+		stage->stats.max_cycles = MAX(stage->stats.max_cycles, cycles);
+		if (ret < 0) {
+			stage->stats.errors++;
+		}
+		if (ret != 0) {
+			stage->stats.dropped++;
+		}
+
+		k_spin_unlock(&pipe->lock, key);
+
+		if (ret != 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int audio_pipeline_sink(struct audio_pipeline *pipe, void *block, size_t size)
+{
+	int ret;
+
+	ret = i2s_write(pipe->tx_dev, block, size);
+	if (ret < 0) {
+		LOG_ERR("Failed to write to %s (%d)", pipe->tx_dev->name, ret);
+		k_mem_slab_free(pipe->slab, block);
+		return ret;
+	}
+
+	if (!pipe->tx_started) {
+		ret = i2s_trigger(pipe->tx_dev, I2S_DIR_TX, I2S_TRIGGER_START);
+		if (ret < 0) {
+			LOG_ERR("Failed to start %s (%d)", pipe->tx_dev->name, ret);
+			return ret;
+		}
+
+		pipe->tx_started = true;
+	}
+
+	return 0;
+}
+
+static void audio_pipeline_thread(void *p1, void *p2, void *p3)
+{
+	struct audio_pipeline *pipe = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&pipe->running)) {
+		void *block;
+		size_t size;
+		uint32_t start;
+		uint32_t latency;
+		k_spinlock_key_t key;
+		bool forward;
+		int ret;
+
+		ret = i2s_read(pipe->rx_dev, &block, &size);
+		if (ret == -EAGAIN) {
+			/* Timed out, check whether the pipeline was stopped */
+			continue;
+		} else if (ret < 0) {
+			LOG_ERR("Failed to read from %s (%d)", pipe->rx_dev->name, ret);
+			pipe->status = ret;
+			break;
+		}
+
+		start = k_cycle_get_32();
+		forward = audio_pipeline_process(pipe, block, &size);
+
+		if (!forward || pipe->tx_dev == NULL) {
+			k_mem_slab_free(pipe->slab, block);
+		} else {
+			ret = audio_pipeline_sink(pipe, block, size);
+			if (ret < 0) {
+				pipe->status = ret;
+				break;
+			}
+		}
+
+		latency = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+		key = k_spin_lock(&pipe->lock);
+		pipe->stats.blocks++;
+		if (!forward) {
+			pipe->stats.dropped++;
+		}
+		pipe->stats.last_latency_us = latency;
+		pipe->stats.max_latency_us = MAX(pipe->stats.max_latency_us, latency);
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	atomic_clear(&pipe->running);
+}
+
+int audio_pipeline_start(struct audio_pipeline *pipe, k_thread_stack_t *stack,
+			 size_t stack_size, int prio)
+{
+	if (!atomic_cas(&pipe->running, 0, 1)) {
+		return -EBUSY;
+	}
+
+	pipe->status = 0;
+
+	k_thread_create(&pipe->thread, stack, stack_size, audio_pipeline_thread,
+			pipe, NULL, NULL, prio, 0, K_NO_WAIT);
+	pipe->thread_created = true;
+	k_thread_name_set(&pipe->thread, "audio_pipeline");
+
+	return 0;
+}
+
+int audio_pipeline_stop(struct audio_pipeline *pipe)
+{
+	atomic_clear(&pipe->running);
+
+	if (!pipe->thread_created) {
+		return 0;
+	}
+
+	return k_thread_join(&pipe->thread, K_FOREVER);
+}
+
+int audio_pipeline_status(struct audio_pipeline *pipe)
+{
+	return pipe->status;
+}
+
+void audio_pipeline_stats_get(struct audio_pipeline *pipe, struct audio_pipeline_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	*stats = pipe->stats;
+
+	k_spin_unlock(&pipe->lock, key);
+}
+
+int audio_pipeline_stage_stats_get(struct audio_pipeline *pipe, size_t idx,
+				   struct audio_pipeline_stage_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	if (idx >= pipe->num_stages) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+	*stats = pipe->stages[idx].stats;
+	k_spin_unlock(&pipe->lock, key);
+
+	return 0;
+}
+
+void audio_pipeline_stats_reset(struct audio_pipeline *pipe)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	memset(&pipe->stats, 0, sizeof(pipe->stats));
+	for (size_t i = 0; i < pipe->num_stages; i++) {
+		memset(&pipe->stages[i].stats, 0, sizeof(pipe->stages[i].stats));
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+}
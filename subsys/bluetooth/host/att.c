@@ -2727,6 +2727,9 @@ static uint8_t att_indicate(struct bt_att_chan *chan, struct net_buf *buf)
 
 	LOG_DBG("chan %p handle 0x%04x", chan, handle);
 
+	/* The indication may be of Service Changed */
+	bt_gatt_client_cache_invalidate(chan->att->conn);
+
 	bt_gatt_notification(chan->att->conn, handle, buf->data, buf->len);
 
 	buf = bt_att_chan_create_pdu(chan, BT_ATT_OP_CONFIRM, 0);
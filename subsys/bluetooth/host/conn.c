@@ -752,6 +752,13 @@ static int send_buf(struct bt_conn *conn, struct net_buf *buf,
 	}
 
 	if (!err) {
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+		conn->tx_deficit -= frag_len;
+#endif
+#if defined(CONFIG_BT_CONN_TX_STATS)
+		conn->tx_stats.bytes += frag_len;
+		conn->tx_stats.frags++;
+#endif
 		return 0;
 	}
 
@@ -805,6 +812,54 @@ static bool acl_has_data(struct bt_conn *conn)
 }
 #endif	/* defined(CONFIG_BT_CONN) */
 
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+static int32_t tx_quantum(const struct bt_conn *conn)
+{
+	return CONFIG_BT_CONN_TX_SCHED_QUANTUM * MAX(conn->tx_weight, 1);
+}
+
+/* Weighted deficit round-robin: the connection is served until it has sent
+ * its quantum, what it sends in excess is taken from its next round.
+ */
+static bool tx_round_over(struct bt_conn *conn)
+{
+	/* The next fragment is the last one of this round if it may use up
+	 * the deficit.
+	 */
+	if (conn->tx_deficit > (int32_t)conn_mtu(conn)) {
+		return false;
+	}
+
+	LOG_DBG("round over for %p deficit %d", conn, conn->tx_deficit);
+
+	return true;
+}
+
+static void tx_round_end(struct bt_conn *conn, bool idle)
+{
+	if (idle) {
+		/* An idle connection does not save its share for later */
+		conn->tx_deficit = 0;
+	} else {
+		conn->tx_deficit = MIN(conn->tx_deficit + tx_quantum(conn),
+				       tx_quantum(conn));
+	}
+}
+#else
+static bool tx_round_over(struct bt_conn *conn)
+{
+	ARG_UNUSED(conn);
+
+	return false;
+}
+
+static void tx_round_end(struct bt_conn *conn, bool idle)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(idle);
+}
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+
 /* Connection "Scheduler" of sorts:
  *
  * Will try to get the optimal number of queued buffers for the connection.
@@ -827,6 +882,12 @@ static bool should_stop_tx(struct bt_conn *conn)
 	 */
 	if (!conn->has_data(conn)) {
 		LOG_DBG("No more data for %p", conn);
+		tx_round_end(conn, true);
+		return true;
+	}
+
+	if (tx_round_over(conn)) {
+		tx_round_end(conn, false);
 		return true;
 	}
 
@@ -844,9 +905,38 @@ static bool should_stop_tx(struct bt_conn *conn)
 		return false;
 	}
 
+	tx_round_end(conn, false);
+
 	return true;
 }
 
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+int bt_conn_set_tx_weight(struct bt_conn *conn, uint8_t weight)
+{
+	if (weight == 0U) {
+		return -EINVAL;
+	}
+
+	conn->tx_weight = weight;
+
+	return 0;
+}
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+
+#if defined(CONFIG_BT_CONN_TX_STATS)
+int bt_conn_get_tx_stats(const struct bt_conn *conn, struct bt_conn_tx_stats *stats)
+{
+	unsigned int key;
+
+	/* The TX processor updates the statistics from another thread */
+	key = irq_lock();
+	*stats = conn->tx_stats;
+	irq_unlock(key);
+
+	return 0;
+}
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 void bt_conn_data_ready(struct bt_conn *conn)
 {
 	LOG_DBG("DR");
@@ -1124,6 +1214,63 @@ exit:
 	bt_conn_unref(conn);
 }
 
+#if defined(CONFIG_BT_ISO_TX_DIRECT)
+int bt_conn_iso_send_direct(struct bt_conn *conn, struct net_buf *buf)
+{
+	uint16_t len = buf->len;
+	struct bt_conn_tx *tx;
+	int err;
+
+	/* The TX processor runs in the cooperative system workqueue, locking
+	 * the scheduler keeps it from running between the check of the
+	 * resources and their use, as it does itself.
+	 */
+	k_sched_lock();
+
+	/* Queued SDUs and the remaining fragments of an SDU are sent first */
+	if ((IS_ENABLED(CONFIG_BT_TESTING) && _suspend_tx) ||
+	    conn->state != BT_CONN_CONNECTED || !k_fifo_is_empty(&conn->iso.txq) ||
+	    conn->next_is_frag || buf->frags || len > conn_mtu(conn) ||
+	    bt_buf_has_view(buf) || cannot_send_to_controller(conn) ||
+	    dont_have_tx_context(conn)) {
+		k_sched_unlock();
+		return -EAGAIN;
+	}
+
+	(void)k_sem_take(bt_conn_get_pkts(conn), K_NO_WAIT);
+
+	tx = conn_tx_alloc();
+	conn->get_and_clear_cb(conn, buf, &tx->cb, &tx->user_data);
+
+	atomic_inc(&conn->in_ll);
+	sys_slist_append(&conn->tx_pending, &tx->node);
+
+	err = send_iso(conn, buf, FRAG_SINGLE);
+	if (!err) {
+#if defined(CONFIG_BT_CONN_TX_STATS)
+		conn->tx_stats.bytes += len;
+		conn->tx_stats.frags++;
+#endif
+		k_sched_unlock();
+		return 0;
+	}
+
+	LOG_WRN("Unable to send to driver (err %d), queuing", err);
+
+	atomic_dec(&conn->in_ll);
+	(void)sys_slist_find_and_remove(&conn->tx_pending, &tx->node);
+	tx_free(tx);
+	k_sem_give(bt_conn_get_pkts(conn));
+
+	/* Give the SDU back without the headers pushed by send_iso() */
+	net_buf_pull(buf, buf->len - len);
+
+	k_sched_unlock();
+
+	return -EAGAIN;
+}
+#endif /* CONFIG_BT_ISO_TX_DIRECT */
+
 static void process_unack_tx(struct bt_conn *conn)
 {
 	LOG_DBG("%p", conn);
@@ -198,6 +198,11 @@ struct bt_conn_iso {
 
 	/** Queue from which conn will pull data */
 	struct k_fifo                   txq;
+
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS)
+	/** Latencies of the SDUs sent */
+	struct bt_iso_tx_latency        tx_latency;
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
 };
 
 typedef void (*bt_conn_tx_cb_t)(struct bt_conn *conn, void *user_data, int err);
@@ -327,6 +332,19 @@ struct bt_conn {
 	/* Next buffer should be an ACL/ISO HCI fragment */
 	bool			next_is_frag;
 
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+	/* Bytes this connection may still send in its TX scheduling round,
+	 * negative after it sent more than its share.
+	 */
+	int32_t			tx_deficit;
+	/* Share of the TX scheduling rounds, 0 meaning 1 */
+	uint8_t			tx_weight;
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	struct bt_conn_tx_stats	tx_stats;
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 	/* Must be at the end so that everything else in the structure can be
 	 * memset to zero without affecting the ref.
 	 */
@@ -409,6 +427,11 @@ struct bt_iso_create_param {
 
 int bt_conn_iso_init(void);
 
+/* Send an ISO SDU fitting a single HCI ISO Data packet to the HCI driver,
+ * returns -EAGAIN if it has to be queued instead.
+ */
+int bt_conn_iso_send_direct(struct bt_conn *conn, struct net_buf *buf);
+
 /* Cleanup ISO references */
 void bt_iso_cleanup_acl(struct bt_conn *iso_conn);
 
@@ -1216,6 +1216,117 @@ BT_GATT_SERVICE_DEFINE(_1_gatt_svc,
 );
 
 #if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+/* Registered services in ascending handle order, searched by bisection */
+struct db_index_entry {
+	struct bt_gatt_service *svc;
+	uint16_t start_handle;
+	uint16_t end_handle;
+	/* Bit set of the UUIDs of the attributes of the service */
+	uint32_t uuid_filter;
+};
+
+static struct db_index_entry db_index[CONFIG_BT_GATT_DB_INDEX_SIZE];
+static size_t db_index_count;
+/* False if the services do not fit in the index */
+static bool db_index_valid;
+
+static uint32_t uuid_filter_bit(const struct bt_uuid *uuid)
+{
+	uint32_t val;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		val = BT_UUID_16(uuid)->val;
+		break;
+	case BT_UUID_TYPE_32:
+		val = BT_UUID_32(uuid)->val;
+		break;
+	default:
+		/* 16 and 32 bits UUIDs match 128 bits UUIDs built from the
+		 * base UUID, which hold their value in these 4 bytes.
+		 */
+		val = sys_get_le32(&BT_UUID_128(uuid)->val[12]);
+		break;
+	}
+
+	return BIT((val ^ (val >> 5) ^ (val >> 16)) & 31U);
+}
+
+static void db_index_update(void)
+{
+	struct bt_gatt_service *svc;
+	size_t count = 0;
+
+	db_index_valid = false;
+	db_index_count = 0;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&db, svc, node) {
+		struct db_index_entry *entry;
+
+		if (count == ARRAY_SIZE(db_index)) {
+			LOG_WRN("Too many services for CONFIG_BT_GATT_DB_INDEX_SIZE");
+			return;
+		}
+
+		entry = &db_index[count++];
+		entry->svc = svc;
+		entry->start_handle = svc->attrs[0].handle;
+		entry->end_handle = svc->attrs[svc->attr_count - 1].handle;
+		entry->uuid_filter = 0U;
+
+		for (size_t i = 0; i < svc->attr_count; i++) {
+			entry->uuid_filter |= uuid_filter_bit(svc->attrs[i].uuid);
+		}
+	}
+
+	db_index_count = count;
+	db_index_valid = true;
+}
+
+/* Position of the first service ending at or after handle */
+static size_t db_index_find(uint16_t handle)
+{
+	size_t lo = 0;
+	size_t hi = db_index_count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (db_index[mid].end_handle < handle) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Position of the first attribute of the service at or after handle */
+static size_t svc_attr_find(const struct bt_gatt_service *svc, uint16_t handle)
+{
+	size_t lo = 0;
+	size_t hi = svc->attr_count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (svc->attrs[mid].handle < handle) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+#else
+static inline void db_index_update(void)
+{
+}
+#endif /* CONFIG_BT_GATT_DB_INDEX */
+
 static uint8_t found_attr(const struct bt_gatt_attr *attr, uint16_t handle,
 			  void *user_data)
 {
@@ -1298,6 +1409,7 @@ populate:
 	}
 
 	gatt_insert(svc, last_handle);
+	db_index_update();
 
 	return 0;
 }
@@ -1695,6 +1807,8 @@ static int gatt_unregister(struct bt_gatt_service *svc)
 		return -ENOENT;
 	}
 
+	db_index_update();
+
 	for (uint16_t i = 0; i < svc->attr_count; i++) {
 		struct bt_gatt_attr *attr = &svc->attrs[i];
 
@@ -2049,6 +2163,43 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 	size_t i;
 	struct bt_gatt_service *svc;
 
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+	if (db_index_valid) {
+		uint32_t uuid_bit = uuid ? uuid_filter_bit(uuid) : 0U;
+
+		for (size_t pos = db_index_find(start_handle); pos < db_index_count; pos++) {
+			const struct db_index_entry *entry = &db_index[pos];
+
+			if (entry->start_handle > end_handle) {
+				return;
+			}
+
+			/* Skip services without attributes of the UUID */
+			if (uuid && !(entry->uuid_filter & uuid_bit)) {
+				continue;
+			}
+
+			svc = entry->svc;
+
+			for (i = svc_attr_find(svc, start_handle); i < svc->attr_count; i++) {
+				struct bt_gatt_attr *attr = &svc->attrs[i];
+
+				if (gatt_foreach_iter(attr, attr->handle,
+						      start_handle,
+						      end_handle,
+						      uuid, attr_data,
+						      &num_matches,
+						      func, user_data) ==
+				    BT_GATT_ITER_STOP) {
+					return;
+				}
+			}
+		}
+
+		return;
+	}
+#endif /* CONFIG_BT_GATT_DB_INDEX */
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&db, svc, node) {
 		struct bt_gatt_service *next;
 
@@ -2500,12 +2651,9 @@ static int gatt_notify_mult(struct bt_conn *conn, uint16_t handle,
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE_FLUSH_MS != 0 */
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
 
-static int gatt_notify(struct bt_conn *conn, uint16_t handle,
-		       struct bt_gatt_notify_params *params)
+static int gatt_notify_verify(struct bt_conn *conn,
+			      struct bt_gatt_notify_params *params)
 {
-	struct net_buf *buf;
-	struct bt_att_notify *nfy;
-
 #if defined(CONFIG_BT_GATT_ENFORCE_CHANGE_UNAWARE)
 	/* BLUETOOTH CORE SPECIFICATION Version 5.3
 	 * Vol 3, Part G 2.5.3 (page 1479):
@@ -2525,16 +2673,14 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 		return -EPERM;
 	}
 
-	if (IS_ENABLED(CONFIG_BT_GATT_ENFORCE_SUBSCRIPTION)) {
-		/* Check if client has subscribed before sending notifications.
-		 * This is not really required in the Bluetooth specification,
-		 * but follows its spirit.
-		 */
-		if (!bt_gatt_is_subscribed(conn, params->attr, BT_GATT_CCC_NOTIFY)) {
-			LOG_WRN("Device is not subscribed to characteristic");
-			return -EINVAL;
-		}
-	}
+	return 0;
+}
+
+static int gatt_notify_send(struct bt_conn *conn, uint16_t handle,
+			    struct bt_gatt_notify_params *params)
+{
+	struct net_buf *buf;
+	struct bt_att_notify *nfy;
 
 	if (IS_ENABLED(CONFIG_BT_EATT) &&
 	    !bt_att_chan_opt_valid(conn, BT_ATT_CHAN_OPT(params))) {
@@ -2564,6 +2710,30 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 	return bt_att_send(conn, buf);
 }
 
+static int gatt_notify(struct bt_conn *conn, uint16_t handle,
+		       struct bt_gatt_notify_params *params)
+{
+	int err;
+
+	err = gatt_notify_verify(conn, params);
+	if (err) {
+		return err;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_GATT_ENFORCE_SUBSCRIPTION)) {
+		/* Check if client has subscribed before sending notifications.
+		 * This is not really required in the Bluetooth specification,
+		 * but follows its spirit.
+		 */
+		if (!bt_gatt_is_subscribed(conn, params->attr, BT_GATT_CCC_NOTIFY)) {
+			LOG_WRN("Device is not subscribed to characteristic");
+			return -EINVAL;
+		}
+	}
+
+	return gatt_notify_send(conn, handle, params);
+}
+
 /* Converts error (negative errno) to ATT Error code */
 static uint8_t att_err_from_int(int err)
 {
@@ -2889,47 +3059,60 @@ struct bt_gatt_attr *bt_gatt_find_by_uuid(const struct bt_gatt_attr *attr,
 	return found;
 }
 
-int bt_gatt_notify_cb(struct bt_conn *conn,
-		      struct bt_gatt_notify_params *params)
+/* Find the attribute and value handle to notify */
+static int gatt_notify_resolve(struct notify_data *data,
+			       struct bt_gatt_notify_params *params)
 {
-	struct notify_data data;
-
-	__ASSERT(params, "invalid parameters\n");
-	__ASSERT(params->attr || params->uuid, "invalid parameters\n");
-
-	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
-		return -EAGAIN;
-	}
-
-	if (conn && conn->state != BT_CONN_CONNECTED) {
-		return -ENOTCONN;
-	}
-
-	data.attr = params->attr;
-	data.handle = bt_gatt_attr_get_handle(data.attr);
+	data->attr = params->attr;
+	data->handle = bt_gatt_attr_get_handle(data->attr);
 
 	/* Lookup UUID if it was given */
 	if (params->uuid) {
-		if (!gatt_find_by_uuid(&data, params->uuid)) {
+		if (!gatt_find_by_uuid(data, params->uuid)) {
 			return -ENOENT;
 		}
 
-		params->attr = data.attr;
+		params->attr = data->attr;
 	} else {
-		if (!data.handle) {
+		if (!data->handle) {
 			return -ENOENT;
 		}
 	}
 
 	/* Check if attribute is a characteristic then adjust the handle */
-	if (!bt_uuid_cmp(data.attr->uuid, BT_UUID_GATT_CHRC)) {
-		struct bt_gatt_chrc *chrc = data.attr->user_data;
+	if (!bt_uuid_cmp(data->attr->uuid, BT_UUID_GATT_CHRC)) {
+		struct bt_gatt_chrc *chrc = data->attr->user_data;
 
 		if (!(chrc->properties & BT_GATT_CHRC_NOTIFY)) {
 			return -EINVAL;
 		}
 
-		data.handle = bt_gatt_attr_value_handle(data.attr);
+		data->handle = bt_gatt_attr_value_handle(data->attr);
+	}
+
+	return 0;
+}
+
+int bt_gatt_notify_cb(struct bt_conn *conn,
+		      struct bt_gatt_notify_params *params)
+{
+	struct notify_data data;
+	int err;
+
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(params->attr || params->uuid, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	if (conn && conn->state != BT_CONN_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	err = gatt_notify_resolve(&data, params);
+	if (err) {
+		return err;
 	}
 
 	if (conn) {
@@ -2946,6 +3129,104 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	return data.err;
 }
 
+static uint8_t notify_subscribers_cb(const struct bt_gatt_attr *attr,
+				     uint16_t handle, void *user_data)
+{
+	struct bt_gatt_ccc_managed_user_data *ccc;
+	atomic_t *subscribers = user_data;
+
+	if (!is_host_managed_ccc(attr)) {
+		return BT_GATT_ITER_CONTINUE;
+	}
+
+	ccc = attr->user_data;
+
+	/* Resolve the connections of the peers configured, as notify_cb() */
+	for (size_t i = 0; i < ARRAY_SIZE(ccc->cfg); i++) {
+		struct bt_gatt_ccc_cfg *cfg = &ccc->cfg[i];
+		struct bt_conn *conn;
+
+		if (cfg->value != BT_GATT_CCC_NOTIFY) {
+			continue;
+		}
+
+		conn = bt_conn_lookup_addr_le(cfg->id, &cfg->peer);
+		if (!conn) {
+			continue;
+		}
+
+		if ((conn->state == BT_CONN_CONNECTED) &&
+		    (!ccc->cfg_match || ccc->cfg_match(conn, attr))) {
+			atomic_set_bit(subscribers, bt_conn_index(conn));
+		}
+
+		bt_conn_unref(conn);
+	}
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+int bt_gatt_notify_multicast(const atomic_t *conns,
+			     struct bt_gatt_notify_params *params)
+{
+	ATOMIC_DEFINE(subscribers, CONFIG_BT_MAX_CONN);
+	struct notify_data data;
+	int err;
+
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(params->attr || params->uuid, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	err = gatt_notify_resolve(&data, params);
+	if (err) {
+		return err;
+	}
+
+	/* Resolve the subscribers once, instead of for each connection */
+	(void)memset(subscribers, 0, sizeof(subscribers));
+	bt_gatt_foreach_attr_type(data.handle, 0xffff, BT_UUID_GATT_CCC, NULL,
+				  1, notify_subscribers_cb, subscribers);
+
+	err = -ENOTCONN;
+
+	for (uint8_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
+		struct bt_conn *conn;
+		int ret;
+
+		if (!atomic_test_bit(subscribers, i) ||
+		    (conns && !atomic_test_bit(conns, i))) {
+			continue;
+		}
+
+		conn = bt_conn_lookup_index(i);
+		if (!conn) {
+			continue;
+		}
+
+		if (conn->state != BT_CONN_CONNECTED) {
+			bt_conn_unref(conn);
+			continue;
+		}
+
+		ret = gatt_notify_verify(conn, params);
+		if (!ret) {
+			ret = gatt_notify_send(conn, data.handle, params);
+		}
+
+		bt_conn_unref(conn);
+
+		/* Succeed if sent to a connection at least */
+		if ((ret == 0) || (err != 0)) {
+			err = ret;
+		}
+	}
+
+	return err;
+}
+
 #if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
 static int gatt_notify_multiple_verify_args(struct bt_conn *conn,
 					    struct bt_gatt_notify_params params[],
@@ -3813,6 +4094,385 @@ int bt_gatt_exchange_mtu(struct bt_conn *conn,
 	return err;
 }
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+/* The responses to the discovery requests of bonded peers are recorded
+ * along with their request, and replayed instead of sending the same
+ * request again, as long as the Database Hash of the peer is unchanged.
+ */
+#define GATT_CACHE_HASH_LEN 16
+#define GATT_CACHE_REQ_MAX  (sizeof(struct bt_att_find_type_req) + BT_UUID_SIZE_128)
+
+enum {
+	GATT_CACHE_IDLE,  /* Database Hash to be read before next discovery */
+	GATT_CACHE_HASH,  /* Reading the Database Hash */
+	GATT_CACHE_READY, /* Cache matching the database of the peer */
+	GATT_CACHE_OFF,   /* Peer not cached during this connection */
+};
+
+struct gatt_cache_rec {
+	uint8_t op;
+	uint8_t req_len;
+	uint8_t err;
+	uint16_t rsp_len;
+	/* Request parameters then response */
+	uint8_t data[];
+} __packed;
+
+struct gatt_cache {
+	uint8_t id;
+	bt_addr_le_t peer;
+	bool dirty;
+	uint16_t len;
+	/* Database Hash then records, as stored in settings */
+	uint8_t data[GATT_CACHE_HASH_LEN + CONFIG_BT_GATT_CLIENT_CACHE_SIZE];
+};
+
+struct gatt_cache_conn {
+	struct gatt_cache *cache;
+	uint8_t state;
+	bool replaying;
+	/* Discovery waiting for the Database Hash */
+	struct bt_gatt_discover_params *deferred;
+	/* Response to replay once the current one is handled */
+	struct bt_gatt_discover_params *pending;
+	bt_att_func_t pending_func;
+	const struct gatt_cache_rec *pending_rec;
+	struct bt_gatt_read_params hash_params;
+};
+
+static struct gatt_cache gatt_caches[CONFIG_BT_GATT_CLIENT_CACHE_PEERS];
+static struct gatt_cache_conn gatt_cache_conns[CONFIG_BT_MAX_CONN];
+
+static int gatt_find_type_encode(struct net_buf *buf, size_t len, void *user_data);
+static int read_included_uuid_encode(struct net_buf *buf, size_t len, void *user_data);
+static int gatt_read_type_encode(struct net_buf *buf, size_t len, void *user_data);
+static int gatt_read_group_encode(struct net_buf *buf, size_t len, void *user_data);
+static int gatt_find_info_encode(struct net_buf *buf, size_t len, void *user_data);
+
+static struct gatt_cache *gatt_cache_find(uint8_t id, const bt_addr_le_t *addr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(gatt_caches); i++) {
+		if (id == gatt_caches[i].id && bt_addr_le_eq(addr, &gatt_caches[i].peer)) {
+			return &gatt_caches[i];
+		}
+	}
+
+	return NULL;
+}
+
+static bool gatt_cache_in_use(const struct gatt_cache *cache)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(gatt_cache_conns); i++) {
+		if (gatt_cache_conns[i].cache == cache) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static struct gatt_cache *gatt_cache_alloc(uint8_t id, const bt_addr_le_t *addr)
+{
+	struct gatt_cache *cache;
+
+	cache = gatt_cache_find(id, addr);
+	if (!cache) {
+		cache = gatt_cache_find(BT_ID_DEFAULT, BT_ADDR_LE_ANY);
+	}
+
+	/* Replace the cache of a peer not connected */
+	for (size_t i = 0; !cache && i < ARRAY_SIZE(gatt_caches); i++) {
+		if (!gatt_cache_in_use(&gatt_caches[i])) {
+			cache = &gatt_caches[i];
+		}
+	}
+
+	if (cache) {
+		cache->id = id;
+		bt_addr_le_copy(&cache->peer, addr);
+		cache->len = 0U;
+	}
+
+	return cache;
+}
+
+static void gatt_cache_reset(struct gatt_cache *cache)
+{
+	memset(cache, 0, sizeof(*cache));
+	bt_addr_le_copy(&cache->peer, BT_ADDR_LE_ANY);
+}
+
+/* Encode the parameters of a discovery request, which identify its response */
+static uint8_t gatt_cache_encode_req(bt_att_encode_t encode, void *params, uint8_t *req)
+{
+	struct net_buf buf;
+
+	net_buf_simple_init_with_data(&buf.b, req, GATT_CACHE_REQ_MAX);
+	net_buf_simple_reset(&buf.b);
+
+	if (encode(&buf, GATT_CACHE_REQ_MAX, params)) {
+		return 0U;
+	}
+
+	return buf.len;
+}
+
+static const struct gatt_cache_rec *gatt_cache_rec_find(const struct gatt_cache *cache,
+							uint8_t op, const uint8_t *req,
+							uint8_t req_len)
+{
+	const uint8_t *recs = &cache->data[GATT_CACHE_HASH_LEN];
+	uint16_t off = 0U;
+
+	while (off < cache->len) {
+		const struct gatt_cache_rec *rec = (const void *)&recs[off];
+
+		if (rec->op == op && rec->req_len == req_len &&
+		    !memcmp(rec->data, req, req_len)) {
+			return rec;
+		}
+
+		off += sizeof(*rec) + rec->req_len + sys_le16_to_cpu(rec->rsp_len);
+	}
+
+	return NULL;
+}
+
+static void gatt_cache_store(struct bt_conn *conn, uint8_t op, bt_att_encode_t encode,
+			     void *params, int err, const void *pdu, uint16_t length)
+{
+	struct gatt_cache_conn *cc = &gatt_cache_conns[bt_conn_index(conn)];
+	struct gatt_cache *cache = cc->cache;
+	struct gatt_cache_rec *rec;
+	uint8_t req[GATT_CACHE_REQ_MAX];
+	uint8_t req_len;
+
+	if (cc->state != GATT_CACHE_READY || cc->replaying) {
+		return;
+	}
+
+	/* Other errors may depend on the security of the connection */
+	if (err && err != BT_ATT_ERR_ATTRIBUTE_NOT_FOUND) {
+		return;
+	}
+
+	req_len = gatt_cache_encode_req(encode, params, req);
+	if (!req_len || gatt_cache_rec_find(cache, op, req, req_len)) {
+		return;
+	}
+
+	if (sizeof(*rec) + req_len + length > CONFIG_BT_GATT_CLIENT_CACHE_SIZE - cache->len) {
+		LOG_DBG("No space to cache response to op 0x%02x", op);
+		return;
+	}
+
+	rec = (void *)&cache->data[GATT_CACHE_HASH_LEN + cache->len];
+	rec->op = op;
+	rec->req_len = req_len;
+	rec->err = err;
+	rec->rsp_len = sys_cpu_to_le16(length);
+	memcpy(rec->data, req, req_len);
+	memcpy(&rec->data[req_len], pdu, length);
+
+	cache->len += sizeof(*rec) + req_len + length;
+	cache->dirty = true;
+}
+
+static bool gatt_cache_replay(struct bt_conn *conn, bt_att_func_t func, void *params,
+			      bt_att_encode_t encode, uint8_t op)
+{
+	struct gatt_cache_conn *cc = &gatt_cache_conns[bt_conn_index(conn)];
+	const struct gatt_cache_rec *rec;
+	uint8_t req[GATT_CACHE_REQ_MAX];
+	uint8_t req_len;
+
+	if (cc->state != GATT_CACHE_READY) {
+		return false;
+	}
+
+	req_len = gatt_cache_encode_req(encode, params, req);
+	if (!req_len) {
+		return false;
+	}
+
+	rec = gatt_cache_rec_find(cc->cache, op, req, req_len);
+	if (!rec) {
+		return false;
+	}
+
+	/* Replay the responses of a discovery in a loop instead of recursing
+	 * from the callback continuing the discovery.
+	 */
+	if (cc->replaying) {
+		if (cc->pending) {
+			return false;
+		}
+
+		cc->pending = params;
+		cc->pending_func = func;
+		cc->pending_rec = rec;
+
+		return true;
+	}
+
+	cc->replaying = true;
+
+	while (true) {
+		LOG_DBG("op 0x%02x answered from cache", rec->op);
+
+		func(conn, rec->err, &rec->data[rec->req_len], sys_le16_to_cpu(rec->rsp_len),
+		     params);
+
+		if (!cc->pending) {
+			break;
+		}
+
+		params = cc->pending;
+		func = cc->pending_func;
+		rec = cc->pending_rec;
+		cc->pending = NULL;
+	}
+
+	cc->replaying = false;
+
+	return true;
+}
+
+static uint8_t gatt_cache_hash_read(struct bt_conn *conn, uint8_t err,
+				    struct bt_gatt_read_params *params,
+				    const void *data, uint16_t length)
+{
+	struct gatt_cache_conn *cc = CONTAINER_OF(params, struct gatt_cache_conn, hash_params);
+	struct bt_gatt_discover_params *deferred = cc->deferred;
+	struct gatt_cache *cache = NULL;
+
+	if (cc->state != GATT_CACHE_HASH) {
+		return BT_GATT_ITER_STOP;
+	}
+
+	cc->deferred = NULL;
+
+	if (!err && data && length == GATT_CACHE_HASH_LEN) {
+		cache = gatt_cache_find(conn->id, &conn->le.dst);
+		if (!cache || memcmp(cache->data, data, GATT_CACHE_HASH_LEN)) {
+			LOG_DBG("Database Hash of %s changed", bt_addr_le_str(&conn->le.dst));
+
+			cache = gatt_cache_alloc(conn->id, &conn->le.dst);
+			if (cache) {
+				memcpy(cache->data, data, GATT_CACHE_HASH_LEN);
+				cache->dirty = true;
+			}
+		}
+	}
+
+	cc->cache = cache;
+	cc->state = cache ? GATT_CACHE_READY : GATT_CACHE_OFF;
+
+	if (deferred && bt_gatt_discover(conn, deferred)) {
+		deferred->func(conn, NULL, deferred);
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+/* Read the Database Hash of a bonded peer before its first discovery */
+static bool gatt_cache_defer(struct bt_conn *conn, struct bt_gatt_discover_params *params)
+{
+	struct gatt_cache_conn *cc = &gatt_cache_conns[bt_conn_index(conn)];
+
+	if (cc->state != GATT_CACHE_IDLE || cc->replaying ||
+	    !bt_le_bond_exists(conn->id, &conn->le.dst)) {
+		return false;
+	}
+
+	cc->hash_params.func = gatt_cache_hash_read;
+	cc->hash_params.handle_count = 0U;
+	cc->hash_params.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	cc->hash_params.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+	cc->hash_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+#if defined(CONFIG_BT_EATT)
+	cc->hash_params.chan_opt = BT_ATT_CHAN_OPT_NONE;
+#endif /* CONFIG_BT_EATT */
+
+	cc->state = GATT_CACHE_HASH;
+
+	if (bt_gatt_read(conn, &cc->hash_params)) {
+		cc->state = GATT_CACHE_IDLE;
+		return false;
+	}
+
+	cc->deferred = params;
+
+	return true;
+}
+
+static void gatt_cache_disconnected(struct bt_conn *conn)
+{
+	struct gatt_cache_conn *cc = &gatt_cache_conns[bt_conn_index(conn)];
+	struct gatt_cache *cache = cc->cache;
+
+	if (IS_ENABLED(CONFIG_BT_SETTINGS) && cache && cache->dirty &&
+	    bt_le_bond_exists(conn->id, &conn->le.dst)) {
+		int err;
+
+		err = bt_settings_store_dbcache(cache->id, &cache->peer, cache->data,
+						GATT_CACHE_HASH_LEN + cache->len);
+		if (err) {
+			LOG_ERR("Failed to store discovery cache (err %d)", err);
+		} else {
+			cache->dirty = false;
+		}
+	}
+
+	memset(cc, 0, sizeof(*cc));
+}
+
+static int gatt_cache_clear(uint8_t id, const bt_addr_le_t *addr)
+{
+	struct gatt_cache *cache;
+
+	cache = gatt_cache_find(id, addr);
+	if (cache) {
+		for (size_t i = 0; i < ARRAY_SIZE(gatt_cache_conns); i++) {
+			if (gatt_cache_conns[i].cache == cache) {
+				gatt_cache_conns[i].cache = NULL;
+				gatt_cache_conns[i].state = GATT_CACHE_OFF;
+			}
+		}
+
+		gatt_cache_reset(cache);
+	}
+
+	if (IS_ENABLED(CONFIG_BT_SETTINGS)) {
+		return bt_settings_delete_dbcache(id, addr);
+	}
+
+	return 0;
+}
+
+void bt_gatt_client_cache_invalidate(struct bt_conn *conn)
+{
+	struct gatt_cache_conn *cc = &gatt_cache_conns[bt_conn_index(conn)];
+
+	if (cc->state == GATT_CACHE_READY) {
+		cc->state = GATT_CACHE_IDLE;
+	}
+}
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
+static int gatt_discover_req_send(struct bt_conn *conn, bt_att_func_t func,
+				  struct bt_gatt_discover_params *params,
+				  bt_att_encode_t encode, uint8_t op, size_t len)
+{
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	if (gatt_cache_replay(conn, func, params, encode, op)) {
+		return 0;
+	}
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
+	return gatt_req_send(conn, func, params, encode, op, len, BT_ATT_CHAN_OPT(params));
+}
+
 static void gatt_discover_next(struct bt_conn *conn, uint16_t last_handle,
 			       struct bt_gatt_discover_params *params)
 {
@@ -3853,6 +4513,11 @@ static void gatt_find_type_rsp(struct bt_conn *conn, int err,
 	uint8_t count;
 	uint16_t end_handle = 0U, start_handle;
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	gatt_cache_store(conn, BT_ATT_OP_FIND_TYPE_REQ, gatt_find_type_encode, params, err, pdu,
+			 length);
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 	LOG_DBG("err %d", err);
 
 	if (err || (length % sizeof(struct bt_att_handle_group) != 0)) {
@@ -3953,9 +4618,8 @@ static int gatt_find_type(struct bt_conn *conn,
 		return -EINVAL;
 	}
 
-	return gatt_req_send(conn, gatt_find_type_rsp, params,
-			     gatt_find_type_encode, BT_ATT_OP_FIND_TYPE_REQ,
-			     len, BT_ATT_CHAN_OPT(params));
+	return gatt_discover_req_send(conn, gatt_find_type_rsp, params, gatt_find_type_encode,
+				      BT_ATT_OP_FIND_TYPE_REQ, len);
 }
 
 static void read_included_uuid_cb(struct bt_conn *conn, int err,
@@ -3971,6 +4635,11 @@ static void read_included_uuid_cb(struct bt_conn *conn, int err,
 		struct bt_uuid_128 u128;
 	} u;
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	gatt_cache_store(conn, BT_ATT_OP_READ_REQ, read_included_uuid_encode, params, err, pdu,
+			 length);
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 	if (length != 16U) {
 		LOG_ERR("Invalid data len %u", length);
 		params->func(conn, NULL, params);
@@ -4025,9 +4694,9 @@ static int read_included_uuid(struct bt_conn *conn,
 {
 	LOG_DBG("handle 0x%04x", params->_included.start_handle);
 
-	return gatt_req_send(conn, read_included_uuid_cb, params,
-			     read_included_uuid_encode, BT_ATT_OP_READ_REQ,
-			     sizeof(struct bt_att_read_req), BT_ATT_CHAN_OPT(params));
+	return gatt_discover_req_send(conn, read_included_uuid_cb, params,
+				      read_included_uuid_encode, BT_ATT_OP_READ_REQ,
+				      sizeof(struct bt_att_read_req));
 }
 
 static uint16_t parse_include(struct bt_conn *conn, const void *pdu,
@@ -4339,6 +5008,11 @@ static void gatt_read_type_rsp(struct bt_conn *conn, int err,
 	struct bt_gatt_discover_params *params = user_data;
 	uint16_t handle;
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	gatt_cache_store(conn, BT_ATT_OP_READ_TYPE_REQ, gatt_read_type_encode, params, err, pdu,
+			 length);
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 	LOG_DBG("err %d", err);
 
 	if (err) {
@@ -4392,9 +5066,8 @@ static int gatt_read_type(struct bt_conn *conn,
 {
 	LOG_DBG("start_handle 0x%04x end_handle 0x%04x", params->start_handle, params->end_handle);
 
-	return gatt_req_send(conn, gatt_read_type_rsp, params,
-			     gatt_read_type_encode, BT_ATT_OP_READ_TYPE_REQ,
-			     sizeof(struct bt_att_read_type_req), BT_ATT_CHAN_OPT(params));
+	return gatt_discover_req_send(conn, gatt_read_type_rsp, params, gatt_read_type_encode,
+				      BT_ATT_OP_READ_TYPE_REQ, sizeof(struct bt_att_read_type_req));
 }
 
 static uint16_t parse_service(struct bt_conn *conn, const void *pdu,
@@ -4496,6 +5169,11 @@ static void gatt_read_group_rsp(struct bt_conn *conn, int err,
 	struct bt_gatt_discover_params *params = user_data;
 	uint16_t handle;
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	gatt_cache_store(conn, BT_ATT_OP_READ_GROUP_REQ, gatt_read_group_encode, params, err, pdu,
+			 length);
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 	LOG_DBG("err %d", err);
 
 	if (err) {
@@ -4535,11 +5213,9 @@ static int gatt_read_group(struct bt_conn *conn,
 {
 	LOG_DBG("start_handle 0x%04x end_handle 0x%04x", params->start_handle, params->end_handle);
 
-	return gatt_req_send(conn, gatt_read_group_rsp, params,
-			     gatt_read_group_encode,
-			     BT_ATT_OP_READ_GROUP_REQ,
-			     sizeof(struct bt_att_read_group_req),
-			     BT_ATT_CHAN_OPT(params));
+	return gatt_discover_req_send(conn, gatt_read_group_rsp, params, gatt_read_group_encode,
+				      BT_ATT_OP_READ_GROUP_REQ,
+				      sizeof(struct bt_att_read_group_req));
 }
 
 static void gatt_find_info_rsp(struct bt_conn *conn, int err,
@@ -4562,6 +5238,11 @@ static void gatt_find_info_rsp(struct bt_conn *conn, int err,
 	int i;
 	bool skip = false;
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	gatt_cache_store(conn, BT_ATT_OP_FIND_INFO_REQ, gatt_find_info_encode, params, err, pdu,
+			 length);
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 	LOG_DBG("err %d", err);
 
 	if (err) {
@@ -4682,10 +5363,9 @@ static int gatt_find_info(struct bt_conn *conn,
 {
 	LOG_DBG("start_handle 0x%04x end_handle 0x%04x", params->start_handle, params->end_handle);
 
-	return gatt_req_send(conn, gatt_find_info_rsp, params,
-			     gatt_find_info_encode, BT_ATT_OP_FIND_INFO_REQ,
-			     sizeof(struct bt_att_find_info_req),
-			     BT_ATT_CHAN_OPT(params));
+	return gatt_discover_req_send(conn, gatt_find_info_rsp, params, gatt_find_info_encode,
+				      BT_ATT_OP_FIND_INFO_REQ,
+				      sizeof(struct bt_att_find_info_req));
 }
 
 int bt_gatt_discover(struct bt_conn *conn,
@@ -4702,6 +5382,12 @@ int bt_gatt_discover(struct bt_conn *conn,
 		return -ENOTCONN;
 	}
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	if (gatt_cache_defer(conn, params)) {
+		return 0;
+	}
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 	switch (params->type) {
 	case BT_GATT_DISCOVER_PRIMARY:
 	case BT_GATT_DISCOVER_SECONDARY:
@@ -6394,6 +7080,76 @@ static int db_hash_commit(void)
 
 BT_SETTINGS_DEFINE(hash, "hash", db_hash_set, db_hash_commit);
 #endif /*CONFIG_BT_GATT_CACHING */
+
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+static int dbcache_set(const char *name, size_t len_rd, settings_read_cb read_cb,
+		       void *cb_arg)
+{
+	struct gatt_cache *cache;
+	bt_addr_le_t addr;
+	const char *next;
+	ssize_t len;
+	int err;
+	uint8_t id;
+
+	if (!name) {
+		LOG_ERR("Insufficient number of arguments");
+		return -EINVAL;
+	}
+
+	err = bt_settings_decode_key(name, &addr);
+	if (err) {
+		LOG_ERR("Unable to decode address %s", name);
+		return -EINVAL;
+	}
+
+	settings_name_next(name, &next);
+
+	if (!next) {
+		id = BT_ID_DEFAULT;
+	} else {
+		unsigned long next_id = strtoul(next, NULL, 10);
+
+		if (next_id >= CONFIG_BT_ID_MAX) {
+			LOG_ERR("Invalid local identity %lu", next_id);
+			return -EINVAL;
+		}
+
+		id = (uint8_t)next_id;
+	}
+
+	if (!len_rd) {
+		cache = gatt_cache_find(id, &addr);
+		if (cache) {
+			gatt_cache_reset(cache);
+		}
+
+		return 0;
+	}
+
+	cache = gatt_cache_alloc(id, &addr);
+	if (!cache) {
+		LOG_WRN("Unable to restore discovery cache: no cache left");
+		return 0;
+	}
+
+	len = read_cb(cb_arg, cache->data, sizeof(cache->data));
+	if (len < GATT_CACHE_HASH_LEN) {
+		LOG_ERR("Failed to decode value (err %zd)", len);
+		gatt_cache_reset(cache);
+		return len < 0 ? len : -EINVAL;
+	}
+
+	cache->len = len - GATT_CACHE_HASH_LEN;
+	cache->dirty = false;
+
+	LOG_DBG("Restored discovery cache for %s, %u bytes", bt_addr_le_str(&addr), cache->len);
+
+	return 0;
+}
+
+BT_SETTINGS_DEFINE(dbcache, "dbcache", dbcache_set, NULL);
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
 #endif /* CONFIG_BT_SETTINGS */
 
 static uint8_t remove_peer_from_attr(const struct bt_gatt_attr *attr,
@@ -6512,6 +7268,13 @@ int bt_gatt_clear(uint8_t id, const bt_addr_le_t *addr)
 		bt_gatt_clear_subscriptions(id, addr);
 	}
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	err = gatt_cache_clear(id, addr);
+	if (err < 0) {
+		return err;
+	}
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 	return 0;
 }
 
@@ -6545,6 +7308,10 @@ void bt_gatt_disconnected(struct bt_conn *conn)
 	remove_subscriptions(conn);
 #endif /* CONFIG_BT_GATT_CLIENT */
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+	gatt_cache_disconnected(conn);
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 #if defined(CONFIG_BT_GATT_CACHING)
 	remove_cf_cfg(conn);
 #endif
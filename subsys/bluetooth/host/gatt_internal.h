@@ -65,6 +65,15 @@ static inline void bt_gatt_mult_notification(struct bt_conn *conn,
 }
 #endif /* CONFIG_BT_GATT_CLIENT */
 
+#if defined(CONFIG_BT_GATT_CLIENT_CACHE)
+/* Have the Database Hash of the peer read again before next discovery */
+void bt_gatt_client_cache_invalidate(struct bt_conn *conn);
+#else
+static inline void bt_gatt_client_cache_invalidate(struct bt_conn *conn)
+{
+}
+#endif /* CONFIG_BT_GATT_CLIENT_CACHE */
+
 struct bt_gatt_attr;
 
 /* Check attribute permission */
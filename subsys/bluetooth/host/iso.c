@@ -93,6 +93,33 @@ struct bt_iso_big bigs[CONFIG_BT_ISO_MAX_BIG];
 static struct bt_iso_big *lookup_big_by_handle(uint8_t big_handle);
 #endif /* CONFIG_BT_ISO_BROADCAST */
 
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS)
+/* The cycle count when an SDU is sent is kept in the TX user data */
+BUILD_ASSERT(CONFIG_BT_CONN_TX_USER_DATA_SIZE >= sizeof(uint32_t));
+
+static struct k_spinlock tx_latency_lock;
+
+static void iso_tx_latency_update(struct bt_conn *iso, uint32_t sent)
+{
+	struct bt_iso_tx_latency *latency = &iso->iso.tx_latency;
+	uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - sent);
+	size_t bucket = MIN(us / CONFIG_BT_ISO_TX_LATENCY_BUCKET_US,
+			    CONFIG_BT_ISO_TX_LATENCY_BUCKETS - 1);
+	k_spinlock_key_t key = k_spin_lock(&tx_latency_lock);
+
+	if (latency->count == 0U || us < latency->min) {
+		latency->min = us;
+	}
+
+	latency->max = MAX(latency->max, us);
+	latency->total += us;
+	latency->count++;
+	latency->hist[bucket]++;
+
+	k_spin_unlock(&tx_latency_lock, key);
+}
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
+
 static void bt_iso_sent_cb(struct bt_conn *iso, void *user_data, int err)
 {
 #if defined(CONFIG_BT_ISO_TX)
@@ -101,6 +128,13 @@ static void bt_iso_sent_cb(struct bt_conn *iso, void *user_data, int err)
 
 	__ASSERT(chan != NULL, "NULL chan for iso %p", iso);
 
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS)
+	if (!err) {
+		/* The TX callback data is the cycle count when the SDU was sent */
+		iso_tx_latency_update(iso, (uint32_t)(uintptr_t)user_data);
+	}
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
+
 	ops = chan->ops;
 
 	if (!err && ops != NULL && ops->sent != NULL) {
@@ -168,7 +202,14 @@ static void iso_get_and_clear_cb(struct bt_conn *conn, struct net_buf *buf, bt_c
 		*cb = NULL;
 	}
 
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS)
+	uint32_t sent;
+
+	memcpy(&sent, buf->user_data, sizeof(sent));
+	*ud = (void *)(uintptr_t)sent;
+#else
 	*ud = NULL;
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
 }
 
 static struct bt_conn *iso_new(void)
@@ -444,6 +485,10 @@ void bt_iso_connected(struct bt_conn *iso)
 		return;
 	}
 
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS)
+	memset(&iso->iso.tx_latency, 0, sizeof(iso->iso.tx_latency));
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
+
 	bt_iso_chan_set_state(chan, BT_ISO_STATE_CONNECTED);
 
 	if (chan->ops->connected) {
@@ -867,6 +912,19 @@ int conn_iso_send(struct bt_conn *conn, struct net_buf *buf, enum bt_iso_timesta
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS)
+	uint32_t sent = k_cycle_get_32();
+
+	memcpy(buf->user_data, &sent, sizeof(sent));
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
+
+#if defined(CONFIG_BT_ISO_TX_DIRECT)
+	if (bt_conn_iso_send_direct(conn, buf) == 0) {
+		BT_ISO_DATA_DBG("%p sent", buf);
+		return 0;
+	}
+#endif /* CONFIG_BT_ISO_TX_DIRECT */
+
 	k_fifo_put(&conn->iso.txq, buf);
 	BT_ISO_DATA_DBG("%p put on list", buf);
 
@@ -1034,6 +1092,46 @@ static bool valid_chan_io_qos(const struct bt_iso_chan_io_qos *io_qos, bool is_t
 }
 #endif /* CONFIG_BT_ISO_CENTRAL || CONFIG_BT_ISO_BROADCASTER */
 
+int bt_iso_chan_get_tx_latency(const struct bt_iso_chan *chan, struct bt_iso_tx_latency *latency,
+			       bool reset)
+{
+#if defined(CONFIG_BT_ISO_TX_LATENCY_STATS)
+	k_spinlock_key_t key;
+
+	CHECKIF(chan == NULL) {
+		LOG_DBG("chan is NULL");
+		return -EINVAL;
+	}
+
+	CHECKIF(chan->iso == NULL) {
+		LOG_DBG("chan->iso is NULL");
+		return -EINVAL;
+	}
+
+	CHECKIF(latency == NULL) {
+		LOG_DBG("latency is NULL");
+		return -EINVAL;
+	}
+
+	CHECKIF(chan->state != BT_ISO_STATE_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	key = k_spin_lock(&tx_latency_lock);
+
+	*latency = chan->iso->iso.tx_latency;
+	if (reset) {
+		memset(&chan->iso->iso.tx_latency, 0, sizeof(chan->iso->iso.tx_latency));
+	}
+
+	k_spin_unlock(&tx_latency_lock, key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif /* CONFIG_BT_ISO_TX_LATENCY_STATS */
+}
+
 int bt_iso_chan_get_tx_sync(const struct bt_iso_chan *chan, struct bt_iso_tx_info *info)
 {
 	struct bt_hci_cp_le_read_iso_tx_sync *cp;
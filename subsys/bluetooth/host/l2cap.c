@@ -1248,7 +1248,7 @@ static void l2cap_chan_rx_init(struct bt_l2cap_le_chan *chan)
 	/* Truncate MTU if channel have disabled segmentation but still have
 	 * set an MTU which requires it.
 	 */
-	if (!chan->chan.ops->alloc_buf &&
+	if (!IS_ENABLED(CONFIG_BT_L2CAP_SDU_FRAGS) && !chan->chan.ops->alloc_buf &&
 	    (chan->rx.mps < chan->rx.mtu + BT_L2CAP_SDU_HDR_SIZE)) {
 		LOG_WRN("Segmentation disabled but MTU > MPS, truncating MTU");
 		chan->rx.mtu = chan->rx.mps - BT_L2CAP_SDU_HDR_SIZE;
@@ -2546,6 +2546,45 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 	l2cap_chan_le_recv_sdu(chan, buf, seg);
 }
 
+#if defined(CONFIG_BT_L2CAP_SDU_FRAGS)
+/* Chain the received PDUs to the SDU, instead of copying them */
+static void l2cap_chan_le_recv_frag(struct bt_l2cap_le_chan *chan,
+				    struct net_buf *buf)
+{
+	size_t len;
+
+	len = net_buf_frags_len(chan->_sdu);
+	if (len + buf->len > chan->_sdu_len) {
+		LOG_ERR("SDU length mismatch");
+		bt_l2cap_chan_disconnect(&chan->chan);
+		return;
+	}
+
+	LOG_DBG("chan %p len %u", chan, buf->len);
+
+	net_buf_frag_add(chan->_sdu, net_buf_ref(buf));
+	len += buf->len;
+
+	if (len < chan->_sdu_len) {
+		/* Give more credits if remote has run out of them, as
+		 * l2cap_chan_le_recv_seg() does.
+		 */
+		if (atomic_get(&chan->rx.credits) == 0) {
+			LOG_DBG("remote is not fully utilizing MPS");
+			l2cap_chan_send_credits(chan, 1);
+		}
+
+		return;
+	}
+
+	buf = chan->_sdu;
+	chan->_sdu = NULL;
+	chan->_sdu_len = 0U;
+
+	l2cap_chan_le_recv_sdu(chan, buf, 0U);
+}
+#endif /* CONFIG_BT_L2CAP_SDU_FRAGS */
+
 #if defined(CONFIG_BT_L2CAP_SEG_RECV)
 static void l2cap_chan_le_recv_seg_direct(struct bt_l2cap_le_chan *chan, struct net_buf *seg)
 {
@@ -2619,6 +2658,12 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 
 	/* Check if segments already exist */
 	if (chan->_sdu) {
+#if defined(CONFIG_BT_L2CAP_SDU_FRAGS)
+		if (!chan->chan.ops->alloc_buf) {
+			l2cap_chan_le_recv_frag(chan, buf);
+			return;
+		}
+#endif /* CONFIG_BT_L2CAP_SDU_FRAGS */
 		l2cap_chan_le_recv_seg(chan, buf);
 		return;
 	}
@@ -2667,6 +2712,21 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 		return;
 	}
 
+#if defined(CONFIG_BT_L2CAP_SDU_FRAGS)
+	/* Keep the PDU as first fragment of a segmented SDU */
+	if (buf->len < sdu_len) {
+		uint16_t credits = DIV_ROUND_UP(sdu_len - buf->len, chan->rx.mps);
+
+		chan->_sdu = net_buf_ref(buf);
+		chan->_sdu_len = sdu_len;
+
+		LOG_DBG("sending %d extra credits (sdu_len %d buf_len %d mps %d)",
+			credits, sdu_len, buf->len, chan->rx.mps);
+		l2cap_chan_send_credits(chan, credits);
+		return;
+	}
+#endif /* CONFIG_BT_L2CAP_SDU_FRAGS */
+
 	owned_ref = net_buf_ref(buf);
 	err = chan->chan.ops->recv(&chan->chan, owned_ref);
 	if (err != -EINPROGRESS) {
@@ -21,6 +21,7 @@
 #include <zephyr/bluetooth/addr.h>
 #include <zephyr/bluetooth/hci.h>
 #include <zephyr/bluetooth/hci_vs.h>
+#include <zephyr/bluetooth/uuid.h>
 #include <zephyr/kernel.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/sys/__assert.h>
@@ -629,6 +630,202 @@ static uint8_t get_adv_props_legacy(uint8_t evt_type)
 	}
 }
 
+#if defined(CONFIG_BT_SCAN_FILTER)
+struct scan_filter_entry {
+	uint32_t adv_hash;
+	uint32_t data_hash;
+	uint32_t time;
+};
+
+static struct {
+	struct bt_le_scan_filter params;
+	bool enabled;
+	struct bt_le_scan_filter_stats stats;
+	struct scan_filter_entry dup[CONFIG_BT_SCAN_FILTER_DUP_SIZE];
+} scan_filter;
+
+#define SCAN_FILTER_HASH_INIT 2166136261U
+
+/* FNV-1a */
+static uint32_t scan_filter_hash(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+
+	for (size_t i = 0; i < len; i++) {
+		hash ^= p[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static bool scan_filter_uuids_match(const uint8_t *data, size_t len, size_t uuid_len)
+{
+	for (size_t i = 0; i + uuid_len <= len; i += uuid_len) {
+		union {
+			struct bt_uuid uuid;
+			struct bt_uuid_16 u16;
+			struct bt_uuid_32 u32;
+			struct bt_uuid_128 u128;
+		} u;
+
+		if (!bt_uuid_create(&u.uuid, &data[i], uuid_len)) {
+			return false;
+		}
+
+		for (uint8_t j = 0; j < scan_filter.params.uuid_count; j++) {
+			if (!bt_uuid_cmp(&u.uuid, scan_filter.params.uuids[j])) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+static bool scan_filter_uuid(const uint8_t *data, uint16_t len)
+{
+	while (len > 1) {
+		uint8_t ad_len = data[0];
+
+		if (ad_len == 0U || ad_len >= len) {
+			return false;
+		}
+
+		switch (data[1]) {
+		case BT_DATA_UUID16_SOME:
+		case BT_DATA_UUID16_ALL:
+			if (scan_filter_uuids_match(&data[2], ad_len - 1, BT_UUID_SIZE_16)) {
+				return true;
+			}
+			break;
+		case BT_DATA_UUID32_SOME:
+		case BT_DATA_UUID32_ALL:
+			if (scan_filter_uuids_match(&data[2], ad_len - 1, BT_UUID_SIZE_32)) {
+				return true;
+			}
+			break;
+		case BT_DATA_UUID128_SOME:
+		case BT_DATA_UUID128_ALL:
+			if (scan_filter_uuids_match(&data[2], ad_len - 1, BT_UUID_SIZE_128)) {
+				return true;
+			}
+			break;
+		case BT_DATA_SVC_DATA16:
+			if (scan_filter_uuids_match(&data[2], MIN(ad_len - 1, BT_UUID_SIZE_16),
+						    BT_UUID_SIZE_16)) {
+				return true;
+			}
+			break;
+		case BT_DATA_SVC_DATA32:
+			if (scan_filter_uuids_match(&data[2], MIN(ad_len - 1, BT_UUID_SIZE_32),
+						    BT_UUID_SIZE_32)) {
+				return true;
+			}
+			break;
+		case BT_DATA_SVC_DATA128:
+			if (scan_filter_uuids_match(&data[2], MIN(ad_len - 1, BT_UUID_SIZE_128),
+						    BT_UUID_SIZE_128)) {
+				return true;
+			}
+			break;
+		default:
+			break;
+		}
+
+		data += ad_len + 1;
+		len -= ad_len + 1;
+	}
+
+	return false;
+}
+
+static bool scan_filter_dup(const bt_addr_le_t *addr, const struct bt_le_scan_recv_info *info,
+			    const uint8_t *data, uint16_t len)
+{
+	struct scan_filter_entry *entry;
+	uint32_t adv_hash;
+	uint32_t data_hash;
+	uint32_t now;
+
+	/* Reports of different types, as scan responses, are tracked apart */
+	adv_hash = scan_filter_hash(SCAN_FILTER_HASH_INIT, addr, sizeof(*addr));
+	adv_hash = scan_filter_hash(adv_hash, &info->sid, sizeof(info->sid));
+	adv_hash = scan_filter_hash(adv_hash, &info->adv_type, sizeof(info->adv_type));
+	data_hash = scan_filter_hash(SCAN_FILTER_HASH_INIT, data, len);
+
+	now = k_uptime_get_32();
+	entry = &scan_filter.dup[adv_hash % ARRAY_SIZE(scan_filter.dup)];
+
+	if ((entry->adv_hash == adv_hash) && (entry->data_hash == data_hash) &&
+	    ((now - entry->time) < scan_filter.params.dup_window_ms)) {
+		return true;
+	}
+
+	entry->adv_hash = adv_hash;
+	entry->data_hash = data_hash;
+	entry->time = now;
+
+	return false;
+}
+
+static bool scan_filter_accept(const bt_addr_le_t *addr, const struct bt_le_scan_recv_info *info,
+			       const uint8_t *data, uint16_t len)
+{
+	if (!scan_filter.enabled) {
+		return true;
+	}
+
+	scan_filter.stats.received++;
+
+	if (info->rssi < scan_filter.params.rssi_min) {
+		scan_filter.stats.rssi_dropped++;
+		return false;
+	}
+
+	if (scan_filter.params.uuid_count && !scan_filter_uuid(data, len)) {
+		scan_filter.stats.uuid_dropped++;
+		return false;
+	}
+
+	if (scan_filter.params.dup_window_ms && scan_filter_dup(addr, info, data, len)) {
+		scan_filter.stats.dup_dropped++;
+		return false;
+	}
+
+	return true;
+}
+
+void bt_le_scan_filter_set(const struct bt_le_scan_filter *filter)
+{
+	k_sched_lock();
+
+	scan_filter.enabled = (filter != NULL);
+	if (filter) {
+		scan_filter.params = *filter;
+	}
+
+	(void)memset(&scan_filter.stats, 0, sizeof(scan_filter.stats));
+	(void)memset(scan_filter.dup, 0, sizeof(scan_filter.dup));
+
+	k_sched_unlock();
+}
+
+void bt_le_scan_filter_stats_get(struct bt_le_scan_filter_stats *stats)
+{
+	k_sched_lock();
+	*stats = scan_filter.stats;
+	k_sched_unlock();
+}
+#else
+static inline bool scan_filter_accept(const bt_addr_le_t *addr,
+				      const struct bt_le_scan_recv_info *info,
+				      const uint8_t *data, uint16_t len)
+{
+	return true;
+}
+#endif /* CONFIG_BT_SCAN_FILTER */
+
 static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 			struct net_buf_simple *buf, uint16_t len)
 {
@@ -655,6 +852,13 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
 	}
 
+	if (!scan_filter_accept(addr, info, buf->data, len)) {
+#if defined(CONFIG_BT_CENTRAL)
+		check_pending_conn(&id_addr, addr, info->adv_props);
+#endif /* CONFIG_BT_CENTRAL */
+		return;
+	}
+
 	if (scan_dev_found_cb) {
 		net_buf_simple_save(buf, &state);
 
@@ -49,6 +49,10 @@ int bt_settings_delete_cf(uint8_t id, const bt_addr_le_t *addr);
 int bt_settings_store_ccc(uint8_t id, const bt_addr_le_t *addr, const void *value, size_t val_len);
 int bt_settings_delete_ccc(uint8_t id, const bt_addr_le_t *addr);
 
+int bt_settings_store_dbcache(uint8_t id, const bt_addr_le_t *addr, const void *value,
+			      size_t val_len);
+int bt_settings_delete_dbcache(uint8_t id, const bt_addr_le_t *addr);
+
 int bt_settings_store_hash(const void *value, size_t val_len);
 int bt_settings_delete_hash(void);
 
@@ -34,6 +34,9 @@ static struct isotp_global_ctx global_ctx = {
 	.ff_sf_alloc_list = SYS_SLIST_STATIC_INIT(&global_ctx.ff_sf_alloc_list)
 };
 
+/* Protects the TX backlog and state changes depending on it */
+static struct k_spinlock send_lock;
+
 #ifdef CONFIG_ISOTP_USE_TX_BUF
 NET_BUF_POOL_VAR_DEFINE(isotp_tx_pool, CONFIG_ISOTP_TX_BUF_COUNT,
 			CONFIG_ISOTP_BUF_TX_DATA_POOL_SIZE, 0, NULL);
@@ -759,21 +762,84 @@ static inline void send_report_error(struct isotp_send_ctx *sctx, uint32_t err)
 static void send_can_tx_cb(const struct device *dev, int error, void *arg)
 {
 	struct isotp_send_ctx *sctx = (struct isotp_send_ctx *)arg;
+	k_spinlock_key_t key;
+	bool submit = false;
 
 	ARG_UNUSED(dev);
 
+	key = k_spin_lock(&send_lock);
+
 	sctx->tx_backlog--;
+
+	/* CF are paced by tx_sem, the state machine only continues when the
+	 * controller has no more frames of this context queued.
+	 */
+	if (sctx->tx_backlog == 0 && sctx->state != ISOTP_TX_SEND_CF) {
+		if (sctx->state == ISOTP_TX_WAIT_BACKLOG) {
+			sctx->state = ISOTP_TX_WAIT_FIN;
+		}
+
+		submit = true;
+	}
+
+	k_spin_unlock(&send_lock, key);
+
 	k_sem_give(&sctx->tx_sem);
 
-	if (sctx->state == ISOTP_TX_WAIT_BACKLOG) {
-		if (sctx->tx_backlog > 0) {
-			return;
+	if (submit) {
+		k_work_submit(&sctx->work);
+	}
+}
+
+static int send_frame(struct isotp_send_ctx *sctx, struct can_frame *frame)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	/* Limit the number of frames queued in the controller at once */
+	k_sem_take(&sctx->tx_sem, K_FOREVER);
+
+	key = k_spin_lock(&send_lock);
+	sctx->tx_backlog++;
+	k_spin_unlock(&send_lock, key);
+
+	ret = can_send(sctx->can_dev, frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	if (ret != 0) {
+		key = k_spin_lock(&send_lock);
+		sctx->tx_backlog--;
+		k_spin_unlock(&send_lock, key);
+
+		k_sem_give(&sctx->tx_sem);
+	}
+
+	return ret;
+}
+
+/*
+ * Enter a state once all queued frames are transmitted, so that the
+ * completion of a frame is never mistaken for the event the state waits for.
+ */
+static void send_wait_backlog(struct isotp_send_ctx *sctx, uint8_t state)
+{
+	k_spinlock_key_t key;
+	bool submit = false;
+
+	key = k_spin_lock(&send_lock);
+
+	sctx->state = state;
+	if (sctx->tx_backlog == 0) {
+		if (state == ISOTP_TX_WAIT_BACKLOG) {
+			sctx->state = ISOTP_TX_WAIT_FIN;
 		}
 
-		sctx->state = ISOTP_TX_WAIT_FIN;
+		submit = true;
 	}
 
-	k_work_submit(&sctx->work);
+	k_spin_unlock(&send_lock, key);
+
+	if (submit) {
+		k_work_submit(&sctx->work);
+	}
 }
 
 static void send_timeout_handler(struct k_timer *timer)
@@ -817,8 +883,6 @@ static void send_process_fc(struct isotp_send_ctx *sctx, struct can_frame *frame
 	case ISOTP_PCI_FS_CTS:
 		sctx->state = ISOTP_TX_SEND_CF;
 		sctx->wft = 0;
-		sctx->tx_backlog = 0;
-		k_sem_reset(&sctx->tx_sem);
 		sctx->opts.bs = *data++;
 		sctx->opts.stmin = *data++;
 		sctx->bs = sctx->opts.bs;
@@ -939,7 +1003,7 @@ static inline int send_sf(struct isotp_send_ctx *sctx)
 	}
 
 	sctx->state = ISOTP_TX_SEND_SF;
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	return ret;
 }
 
@@ -979,7 +1043,7 @@ static inline int send_ff(struct isotp_send_ctx *sctx)
 	pull_send_ctx_data(sctx, sctx->tx_addr.dl - index);
 	memcpy(&frame.data[index], data, sctx->tx_addr.dl - index);
 
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	return ret;
 }
 
@@ -1021,12 +1085,11 @@ static inline int send_cf(struct isotp_send_ctx *sctx)
 		frame.dlc = can_bytes_to_dlc(len + index);
 	}
 
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	if (ret == 0) {
 		sctx->sn++;
 		pull_send_ctx_data(sctx, len);
 		sctx->bs--;
-		sctx->tx_backlog++;
 	}
 
 	ret = ret ? ret : rem_len;
@@ -1097,15 +1160,14 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 		do {
 			ret = send_cf(sctx);
 			if (!ret) {
-				sctx->state = ISOTP_TX_WAIT_BACKLOG;
+				send_wait_backlog(sctx, ISOTP_TX_WAIT_BACKLOG);
 				break;
 			}
 
 			if (ret < 0) {
 				LOG_ERR("Failed to send CF");
-				send_report_error(sctx, ret == -EAGAIN ?
-						ISOTP_N_TIMEOUT_A :
-						ISOTP_N_ERROR);
+				sctx->error_nr = ret == -EAGAIN ? ISOTP_N_TIMEOUT_A : ISOTP_N_ERROR;
+				send_wait_backlog(sctx, ISOTP_TX_ERR);
 				break;
 			}
 
@@ -1115,12 +1177,9 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 				LOG_DBG("BS reached. Wait for FC again");
 				break;
 			} else if (sctx->opts.stmin) {
-				sctx->state = ISOTP_TX_WAIT_ST;
+				send_wait_backlog(sctx, ISOTP_TX_WAIT_ST);
 				break;
 			}
-
-			/* Ensure FIFO style transmission of CF */
-			k_sem_take(&sctx->tx_sem, K_FOREVER);
 		} while (ret > 0);
 
 		break;
@@ -1219,7 +1278,8 @@ static int send(struct isotp_send_ctx *sctx, const struct device *can_dev,
 		sctx->has_callback = 0;
 	}
 
-	k_sem_init(&sctx->tx_sem, 0, 1);
+	k_sem_init(&sctx->tx_sem, CONFIG_ISOTP_TX_CF_QUEUE_DEPTH, CONFIG_ISOTP_TX_CF_QUEUE_DEPTH);
+	sctx->tx_backlog = 0;
 	sctx->can_dev = can_dev;
 	sctx->tx_addr = *tx_addr;
 	sctx->rx_addr = *rx_addr;
@@ -0,0 +1,157 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * LZ77 compression of the memory blocks, streamed to the backend.
+ *
+ * The compressed stream is a sequence of tokens:
+ * - 0x00 to 0x7f: (token + 1) literal bytes follow.
+ * - 0x80 to 0xff: copy (token & 0x7f) + LZ_MIN_MATCH bytes from the output,
+ *   the 16-bit little endian distance back in the output follows.
+ *
+ * The stream ends once the size of the memory region has been decoded. A
+ * match may overlap the bytes it produces, so runs of a repeated byte are
+ * encoded as a match at a distance of 1.
+ *
+ * The matches are looked up in a copy of the bytes already emitted, not in
+ * the memory being dumped, so that the dump stays consistent even if that
+ * memory changes while it is compressed (e.g. the state of the compressor
+ * itself). The state is static as the dump is done with interrupts locked,
+ * the stack usage does not depend on the size of the memory blocks.
+ */
+
+#include <string.h>
+#include <zephyr/debug/coredump.h>
+#include <zephyr/sys/util.h>
+
+#include "coredump_internal.h"
+
+#define LZ_WINDOW_SIZE   BIT(CONFIG_DEBUG_COREDUMP_COMPRESSION_WINDOW_BITS)
+#define LZ_WINDOW_MASK   (LZ_WINDOW_SIZE - 1)
+#define LZ_HASH_BITS     8
+#define LZ_MIN_MATCH     4
+#define LZ_MAX_MATCH     (0x7f + LZ_MIN_MATCH)
+#define LZ_MAX_LITERALS  0x80
+#define LZ_MATCH_TOKEN   0x80
+#define LZ_OUT_SIZE      64
+
+static uint8_t lz_window[LZ_WINDOW_SIZE];
+/* Position + 1 of the last 3 bytes with that hash, 0 if none */
+static uint32_t lz_hash_table[BIT(LZ_HASH_BITS)];
+static uint8_t lz_literals[1 + LZ_MAX_LITERALS];
+static size_t lz_literals_len;
+/* Batches the tokens, as some backends add an overhead to each output */
+static uint8_t lz_out[LZ_OUT_SIZE];
+static size_t lz_out_len;
+
+static inline uint32_t lz_hash(const uint8_t *p)
+{
+	uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
+
+	return (v * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+static void lz_emit(const uint8_t *buf, size_t len)
+{
+	while (len > 0) {
+		size_t n = MIN(len, sizeof(lz_out) - lz_out_len);
+
+		memcpy(&lz_out[lz_out_len], buf, n);
+		lz_out_len += n;
+		buf += n;
+		len -= n;
+
+		if (lz_out_len == sizeof(lz_out)) {
+			coredump_buffer_output(lz_out, lz_out_len);
+			lz_out_len = 0;
+		}
+	}
+}
+
+static void lz_flush_literals(void)
+{
+	if (lz_literals_len == 0) {
+		return;
+	}
+
+	lz_literals[0] = lz_literals_len - 1;
+	lz_emit(lz_literals, 1 + lz_literals_len);
+	lz_literals_len = 0;
+}
+
+/* Returns the length of the match at pos, copying the matched bytes in the window */
+static size_t lz_match(const uint8_t *src, size_t pos, size_t len, size_t cand)
+{
+	size_t max = MIN(len - pos, LZ_MAX_MATCH);
+	size_t n;
+
+	/*
+	 * The window slot of each candidate byte is only overwritten once it
+	 * has been compared, as the distance is at most the window size.
+	 */
+	for (n = 0; n < max; n++) {
+		uint8_t b = lz_window[(cand + n) & LZ_WINDOW_MASK];
+
+		if (b != src[pos + n]) {
+			break;
+		}
+
+		lz_window[(pos + n) & LZ_WINDOW_MASK] = b;
+	}
+
+	return n;
+}
+
+void z_coredump_compressed_output(const uint8_t *src, size_t len)
+{
+	size_t pos = 0;
+
+	memset(lz_hash_table, 0, sizeof(lz_hash_table));
+	lz_literals_len = 0;
+	lz_out_len = 0;
+
+	while (pos < len) {
+		size_t match_len = 0;
+		size_t dist = 0;
+
+		if (len - pos >= LZ_MIN_MATCH) {
+			uint32_t h = lz_hash(&src[pos]);
+			uint32_t cand = lz_hash_table[h];
+
+			lz_hash_table[h] = pos + 1;
+
+			if (cand != 0 && pos - (cand - 1) <= LZ_WINDOW_SIZE) {
+				dist = pos - (cand - 1);
+				match_len = lz_match(src, pos, len, cand - 1);
+			}
+		}
+
+		if (match_len >= LZ_MIN_MATCH) {
+			uint8_t token[3] = {
+				LZ_MATCH_TOKEN | (match_len - LZ_MIN_MATCH),
+				dist & 0xff,
+				dist >> 8,
+			};
+
+			lz_flush_literals();
+			lz_emit(token, sizeof(token));
+			pos += match_len;
+		} else {
+			uint8_t b = src[pos];
+
+			lz_window[pos & LZ_WINDOW_MASK] = b;
+			lz_literals[1 + lz_literals_len++] = b;
+			if (lz_literals_len == LZ_MAX_LITERALS) {
+				lz_flush_literals();
+			}
+
+			pos++;
+		}
+	}
+
+	lz_flush_literals();
+	coredump_buffer_output(lz_out, lz_out_len);
+}
@@ -9,9 +9,14 @@
 #include <zephyr/toolchain.h>
 #include <zephyr/debug/coredump.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/util.h>
 
 #include "coredump_internal.h"
+
+#ifdef CONFIG_DEBUG_COREDUMP_HEAP_METADATA
+#include <heap.h>
+#endif
 #if defined(CONFIG_DEBUG_COREDUMP_BACKEND_LOGGING)
 extern struct coredump_backend_api coredump_backend_logging;
 static struct coredump_backend_api
@@ -133,6 +138,27 @@ static void dump_thread(struct k_thread *thread)
 }
 #endif
 
+#ifdef CONFIG_DEBUG_COREDUMP_HEAP_METADATA
+static void dump_heaps_metadata(void)
+{
+	STRUCT_SECTION_FOREACH(k_heap, heap) {
+		struct z_heap *h = heap->heap.heap;
+		uintptr_t start_addr = POINTER_TO_UINT(heap);
+
+		coredump_memory_dump(start_addr, start_addr + sizeof(*heap));
+
+		if (h == NULL) {
+			continue;
+		}
+
+		/* Chunk 0 holds the heap header and the free list buckets */
+		start_addr = POINTER_TO_UINT(h);
+		coredump_memory_dump(start_addr,
+				     start_addr + chunksz_to_bytes(h, chunk_size(h, 0)));
+	}
+}
+#endif /* CONFIG_DEBUG_COREDUMP_HEAP_METADATA */
+
 #if defined(CONFIG_COREDUMP_DEVICE)
 static void process_coredump_dev_memory(const struct device *dev)
 {
@@ -177,6 +203,10 @@ void process_memory_region_list(void)
 	coredump_memory_dump(start_addr, POINTER_TO_UINT(irq_stack));
 #endif /* CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS */
 
+#ifdef CONFIG_DEBUG_COREDUMP_HEAP_METADATA
+	dump_heaps_metadata();
+#endif
+
 #if defined(CONFIG_COREDUMP_DEVICE)
 #define MY_FN(inst) process_coredump_dev_memory(DEVICE_DT_INST_GET(inst));
 	DT_INST_FOREACH_STATUS_OKAY(MY_FN)
@@ -262,7 +292,8 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 	len = end_addr - start_addr;
 
 	m.id = COREDUMP_MEM_HDR_ID;
-	m.hdr_version = COREDUMP_MEM_HDR_VER;
+	m.hdr_version = IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESSION) ?
+			COREDUMP_MEM_HDR_VER_COMPRESSED : COREDUMP_MEM_HDR_VER;
 
 	if (sizeof(uintptr_t) == 8) {
 		m.start	= sys_cpu_to_le64(start_addr);
@@ -274,7 +305,11 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 
 	coredump_buffer_output((uint8_t *)&m, sizeof(m));
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+	z_coredump_compressed_output((const uint8_t *)start_addr, len);
+#else
 	coredump_buffer_output((uint8_t *)start_addr, len);
+#endif
 }
 
 int coredump_query(enum coredump_query_id query_id, void *arg)
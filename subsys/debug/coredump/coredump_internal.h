@@ -43,6 +43,17 @@ void z_coredump_start(void);
  */
 void z_coredump_end(void);
 
+/**
+ * @brief Compress and output the content of a memory block
+ *
+ * The compressed stream is sent to the backend as it is produced,
+ * see coredump_compression.c for the format.
+ *
+ * @param src Start of the memory block
+ * @param len Length of the memory block
+ */
+void z_coredump_compressed_output(const uint8_t *src, size_t len);
+
 /**
  * @endcond
  */
@@ -314,6 +314,56 @@ static int print_raw_data(const struct shell *sh,
 	return 0;
 }
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+/**
+ * @brief Find the stored size of a compressed memory block
+ *
+ * @param offset Offset of the compressed data
+ * @param size Size of the memory region once decompressed
+ * @param left_size How much of the coredump is left from offset
+ * @return the stored size of the data, a negative errno otherwise
+ */
+static int compressed_data_size(off_t offset, size_t size, size_t left_size)
+{
+	uint8_t token;
+	struct coredump_cmd_copy_arg copy = {
+		.offset = offset,
+		.buffer = &token,
+		.length = sizeof(token),
+	};
+	size_t decoded = 0;
+	int ret;
+
+	while (decoded < size) {
+		if ((size_t)(copy.offset - offset) >= left_size) {
+			return -ENOMEM;
+		}
+
+		ret = coredump_cmd(COREDUMP_CMD_COPY_STORED_DUMP, &copy);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* Keep in sync with coredump_compression.c */
+		if (token & 0x80) {
+			/* Match token, followed by the distance */
+			decoded += (token & 0x7f) + 4;
+			copy.offset += 3;
+		} else {
+			/* Literal token, followed by the literals */
+			decoded += token + 1;
+			copy.offset += 1 + token + 1;
+		}
+	}
+
+	if (decoded != size || (size_t)(copy.offset - offset) > left_size) {
+		return -EINVAL;
+	}
+
+	return copy.offset - offset;
+}
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESSION */
+
 /**
  * @brief Helper parsing and pretty-printing the coredump
  *
@@ -414,6 +464,18 @@ static int parse_and_print_coredump(const struct shell *sh,
 		shell_print(sh, "\tSize %u", data_size);
 		shell_print(sh, "\tStarts at %p ends at %p",
 			    (void *)hdr->start, (void *)hdr->end);
+
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+		if (hdr->hdr_version == COREDUMP_MEM_HDR_VER_COMPRESSED) {
+			data_size = compressed_data_size(copy->offset + copy->length,
+							 data_size, left_size - copy->length);
+			if (data_size < 0) {
+				return data_size;
+			}
+
+			shell_print(sh, "\tCompressed size %u", data_size);
+		}
+#endif
 		break;
 	}
 	default:
@@ -81,6 +81,12 @@ static void thread_print_cb(struct thread_analyzer_info *info)
 		" ", info->usage.current_cycles, info->usage.peak_cycles,
 		info->usage.average_cycles);
 #endif
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+	THREAD_ANALYZER_PRINT(
+		THREAD_ANALYZER_FMT(
+			" %-20s: Longest Wake Latency: %llu; Average Wake Latency: %llu"),
+		" ", info->usage.wake_peak_cycles, info->usage.wake_average_cycles);
+#endif
 #endif
 #else
 	THREAD_ANALYZER_PRINT(
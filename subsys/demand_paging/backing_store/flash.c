@@ -0,0 +1,109 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Flash partition backing store implementation
+ */
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/bitarray.h>
+
+/*
+ * Like the RAM backing store, this is a backing store with limited storage
+ * space: locations are allocated on page-out and freed as soon as pages are
+ * paged in, in k_mem_paging_backing_store_page_finalize(). A location is the
+ * offset of a page-sized slot in the "backing_store_partition" fixed
+ * partition.
+ *
+ * Flash transfers are done by the flash driver, which may use DMA and sleep
+ * until the transfer completes. With CONFIG_DEMAND_PAGING_ALLOW_SLEEP other
+ * threads run meanwhile.
+ */
+#define BACKING_STORE_SIZE FIXED_PARTITION_SIZE(backing_store_partition)
+#define BACKING_STORE_PAGES (BACKING_STORE_SIZE / CONFIG_MMU_PAGE_SIZE)
+
+BUILD_ASSERT(BACKING_STORE_PAGES > 1,
+	     "backing_store_partition must hold at least two pages");
+BUILD_ASSERT(FIXED_PARTITION_OFFSET(backing_store_partition) % CONFIG_MMU_PAGE_SIZE == 0,
+	     "backing_store_partition must be page aligned");
+
+SYS_BITARRAY_DEFINE_STATIC(backing_slots, BACKING_STORE_PAGES);
+static const struct flash_area *backing_fa;
+static unsigned int free_slots;
+
+int k_mem_paging_backing_store_location_get(struct k_mem_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	size_t slot;
+	int ret;
+
+	if ((!page_fault && free_slots == 1) || free_slots == 0) {
+		return -ENOMEM;
+	}
+
+	ret = sys_bitarray_alloc(&backing_slots, 1, &slot);
+	__ASSERT(ret == 0, "slot count mismatch");
+	if (ret != 0) {
+		return ret;
+	}
+	*location = slot * CONFIG_MMU_PAGE_SIZE;
+	free_slots--;
+
+	return 0;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	__ASSERT(location % CONFIG_MMU_PAGE_SIZE == 0,
+		 "unaligned location 0x%lx", location);
+	__ASSERT(location < BACKING_STORE_SIZE,
+		 "bad location 0x%lx, past bounds of backing store", location);
+
+	(void)sys_bitarray_free(&backing_slots, 1, location / CONFIG_MMU_PAGE_SIZE);
+	free_slots++;
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	if (flash_area_flatten(backing_fa, location, CONFIG_MMU_PAGE_SIZE) != 0 ||
+	    flash_area_write(backing_fa, location, K_MEM_SCRATCH_PAGE,
+			     CONFIG_MMU_PAGE_SIZE) != 0) {
+		k_panic();
+	}
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	if (flash_area_read(backing_fa, location, K_MEM_SCRATCH_PAGE,
+			    CONFIG_MMU_PAGE_SIZE) != 0) {
+		k_panic();
+	}
+}
+
+void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
+					      uintptr_t location)
+{
+#ifdef CONFIG_DEMAND_MAPPING
+	/* ignore those */
+	if (location == ARCH_UNPAGED_ANON_ZERO || location == ARCH_UNPAGED_ANON_UNINIT) {
+		return;
+	}
+#endif
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	int ret;
+
+	ret = flash_area_open(FIXED_PARTITION_ID(backing_store_partition), &backing_fa);
+	__ASSERT(ret == 0, "flash_area_open() returned %d", ret);
+	if (ret != 0) {
+		k_panic();
+	}
+	free_slots = BACKING_STORE_PAGES;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Working set clock (WSClock) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* A clock hand sweeps the page frames when a page needs to be evicted.
+ * A page frame found accessed since the hand last passed is part of the
+ * working set: its accessed state is cleared and the time of the sweep is
+ * recorded as its last use. A page frame not used for more than the working
+ * set window is out of the working set and may be evicted.
+ *
+ * When evicting a page, try to evict the page with the lowest value below,
+ * and the oldest last use among pages of the same value:
+ *
+ * 0 out of the working set, clean
+ * 1 out of the working set, dirty
+ * 2 in the working set, clean
+ * 3 in the working set, dirty
+ *
+ * Pages which were paged in but never accessed, e.g. prefetched ones, have
+ * no last use and are out of the working set.
+ */
+
+/* Time of the last use of each page frame, in milliseconds */
+static uint32_t wsclock_last_use[K_MEM_NUM_PAGE_FRAMES];
+static uint32_t wsclock_hand;
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	uint32_t now = k_uptime_get_32();
+	unsigned int last_prec = 4U;
+	uint32_t last_age = 0U;
+	struct k_mem_page_frame *last_pf = NULL, *pf;
+	bool last_dirty = false;
+	bool dirty;
+	uintptr_t flags;
+	uint32_t pf_idx;
+	uint32_t age;
+	uint32_t start = wsclock_hand;
+
+	do {
+		pf_idx = wsclock_hand;
+		pf = &k_mem_page_frames[pf_idx];
+		wsclock_hand = (wsclock_hand + 1) % ARRAY_SIZE(k_mem_page_frames);
+
+		unsigned int prec;
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Clear accessed bit in page tables, the prior state is reported */
+		flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, true);
+		dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			wsclock_last_use[pf_idx] = now;
+		}
+
+		age = now - wsclock_last_use[pf_idx];
+		prec = (dirty ? 1U : 0U) +
+		       ((age <= CONFIG_EVICTION_WSCLOCK_WINDOW) ? 2U : 0U);
+		if (prec == 0) {
+			/* If we find a clean page out of the working set we're done */
+			last_pf = pf;
+			last_dirty = dirty;
+			break;
+		}
+
+		if ((prec < last_prec) || ((prec == last_prec) && (age > last_age))) {
+			last_prec = prec;
+			last_age = age;
+			last_pf = pf;
+			last_dirty = dirty;
+		}
+	} while (wsclock_hand != start);
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	/* The victim's frame gets a new page, which has not been used yet */
+	wsclock_last_use[last_pf - k_mem_page_frames] = now - CONFIG_EVICTION_WSCLOCK_WINDOW - 1U;
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	uint32_t now = k_uptime_get_32();
+
+	/* Nothing is known to be in the working set yet */
+	for (size_t i = 0; i < ARRAY_SIZE(wsclock_last_use); i++) {
+		wsclock_last_use[i] = now - CONFIG_EVICTION_WSCLOCK_WINDOW - 1U;
+	}
+}
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * Empty functions defined here so that architectures unconditionally
+ * implement eviction tracking can still use this algorithm for
+ * testing.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
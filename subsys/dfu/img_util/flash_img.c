@@ -17,6 +17,8 @@
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/storage/stream_flash.h>
 
+#include "flash_img_delta.h"
+
 LOG_MODULE_REGISTER(flash_img, CONFIG_IMG_MANAGER_LOG_LEVEL);
 
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
@@ -124,11 +126,16 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 	/* if CONFIG_IMG_ERASE_PROGRESSIVELY is enabled the enabled CONFIG_STREAM_FLASH_ERASE
 	 * ensures that stream_flash erases flash progresively.
 	 */
-	rc = stream_flash_buffered_write(&ctx->stream, data, len, flush);
+	if (flash_img_delta_active(ctx)) {
+		rc = flash_img_delta_write(ctx, data, len, flush);
+	} else {
+		rc = stream_flash_buffered_write(&ctx->stream, data, len, flush);
+	}
 	if (!flush) {
 		return rc;
 	}
 
+	flash_img_delta_close(ctx);
 	flash_area_close(ctx->flash_area);
 	ctx->flash_area = NULL;
 
@@ -205,6 +212,10 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 		return rc;
 	}
 
+#if defined(CONFIG_IMG_DELTA)
+	ctx->delta.source = NULL;
+#endif
+
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
 #if defined(CONFIG_MCUBOOT_BOOTLOADER_MODE_SWAP_USING_OFFSET)
@@ -238,14 +249,23 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 		}
 	}
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
-				 (ctx->flash_area->fa_off + sector_data.fs_size),
-				 (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
+			       (ctx->flash_area->fa_off + sector_data.fs_size),
+			       (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
 #else
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
 #endif
+
+#if defined(CONFIG_STREAM_FLASH_DOUBLE_BUFFER)
+	if (rc == 0) {
+		/* Receive the image in one buffer while the other one is written */
+		rc = stream_flash_double_buffer_set(&ctx->stream, ctx->flash_buf);
+	}
+#endif
+
+	return rc;
 }
 
 #ifdef CONFIG_MCUBOOT_BOOTLOADER_MODE_RAM_LOAD
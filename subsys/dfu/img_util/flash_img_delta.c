@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Streaming decoder of delta patches, as created by scripts/dfu/img_delta.py.
+ *
+ * A patch is a 12 bytes header:
+ *   uint32_t magic;       DELTA_MAGIC, little endian
+ *   uint32_t image_size;  size of the new image, little endian
+ *   uint8_t window_bits;  log2 of the decompression window size
+ *   uint8_t reserved[3];
+ *
+ * followed by the compressed patch body. Compression uses the sequences of the
+ * LZ4 block format, with match offsets limited to the window size: a token byte
+ * holds the literal count in its high nibble and the match length minus 4 in its
+ * low nibble, a nibble of 15 being extended by the following bytes up to the first
+ * one that is not 255. The literals and the 16 bits little endian match offset
+ * follow. The last sequence has no match.
+ *
+ * The patch body is a sequence of records, in the style of bsdiff, made of
+ * unsigned LEB128 varints:
+ *   diff_len, then diff_len bytes added to the base image bytes, read from the
+ *             current base image offset, which then moves past them;
+ *   extra_len, then extra_len bytes copied to the new image;
+ *   adjust, zigzag encoded, added to the base image offset.
+ *
+ * The patch ends once image_size bytes have been reconstructed.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/dfu/flash_img.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/storage/stream_flash.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "flash_img_delta.h"
+
+LOG_MODULE_DECLARE(flash_img, CONFIG_IMG_MANAGER_LOG_LEVEL);
+
+#define DELTA_MAGIC       0x544c445aU /* "ZDLT" */
+#define DELTA_HEADER_SIZE 12U
+
+#define LZ_WINDOW_MASK (BIT(CONFIG_IMG_DELTA_WINDOW_BITS) - 1U)
+#define LZ_MIN_MATCH   4U
+
+enum delta_state {
+	DELTA_HEADER,
+	DELTA_DIFF_LEN,
+	DELTA_DIFF,
+	DELTA_EXTRA_LEN,
+	DELTA_EXTRA,
+	DELTA_ADJUST,
+};
+
+enum lz_state {
+	LZ_TOKEN,
+	LZ_LITERAL_LEN,
+	LZ_LITERALS,
+	LZ_OFFSET_LO,
+	LZ_OFFSET_HI,
+	LZ_MATCH_LEN,
+};
+
+BUILD_ASSERT(CONFIG_IMG_DELTA_BUF_SIZE >= DELTA_HEADER_SIZE);
+
+static int delta_image_byte(struct flash_img_context *ctx, uint8_t b)
+{
+	struct flash_img_delta *d = &ctx->delta;
+	int rc = 0;
+
+	d->out_buf[d->out_len++] = b;
+	d->image_off++;
+
+	if (d->out_len == sizeof(d->out_buf)) {
+		rc = stream_flash_buffered_write(&ctx->stream, d->out_buf, d->out_len, false);
+		d->out_len = 0U;
+	}
+
+	return rc;
+}
+
+static int delta_source_byte(struct flash_img_delta *d, uint8_t *b)
+{
+	uint32_t len;
+	int rc;
+
+	if ((d->source_off - d->src_buf_off) >= d->src_buf_len) {
+		len = MIN(sizeof(d->src_buf), d->source->fa_size - d->source_off);
+		rc = flash_area_read(d->source, d->source_off, d->src_buf, len);
+		if (rc != 0) {
+			LOG_ERR("Base image read error %d at 0x%08x", rc, d->source_off);
+			return rc;
+		}
+		d->src_buf_off = d->source_off;
+		d->src_buf_len = len;
+	}
+
+	*b = d->src_buf[d->source_off - d->src_buf_off];
+
+	return 0;
+}
+
+/* Decode a byte of the patch header, which is not compressed */
+static int delta_header_byte(struct flash_img_context *ctx, uint8_t b)
+{
+	struct flash_img_delta *d = &ctx->delta;
+	uint8_t window_bits;
+
+	d->out_buf[d->out_len++] = b;
+	if (d->out_len < DELTA_HEADER_SIZE) {
+		return 0;
+	}
+
+	d->out_len = 0U;
+
+	if (sys_get_le32(&d->out_buf[0]) != DELTA_MAGIC) {
+		LOG_ERR("Not a delta patch");
+		return -EINVAL;
+	}
+
+	d->image_size = sys_get_le32(&d->out_buf[4]);
+	if (d->image_size > ctx->flash_area->fa_size) {
+		LOG_ERR("Image size %u too large", d->image_size);
+		return -EFBIG;
+	}
+
+	window_bits = d->out_buf[8];
+	if (window_bits > CONFIG_IMG_DELTA_WINDOW_BITS) {
+		LOG_ERR("Patch window of 2^%u bytes not supported", window_bits);
+		return -ENOTSUP;
+	}
+
+	d->lz_window_size = BIT(window_bits);
+	d->state = DELTA_DIFF_LEN;
+
+	return 0;
+}
+
+/* Decode a byte of the decompressed patch body */
+static int delta_patch_byte(struct flash_img_context *ctx, uint8_t b)
+{
+	struct flash_img_delta *d = &ctx->delta;
+	uint32_t value;
+	int32_t adjust;
+	uint8_t old;
+	int rc;
+
+	switch (d->state) {
+	case DELTA_DIFF:
+		rc = delta_source_byte(d, &old);
+		if (rc != 0) {
+			return rc;
+		}
+		d->source_off++;
+		if (--d->count == 0U) {
+			d->state = DELTA_EXTRA_LEN;
+		}
+		return delta_image_byte(ctx, b + old);
+	case DELTA_EXTRA:
+		if (--d->count == 0U) {
+			d->state = DELTA_ADJUST;
+		}
+		return delta_image_byte(ctx, b);
+	default:
+		break;
+	}
+
+	/* Varint fields */
+	if (d->shift > 28U) {
+		return -EINVAL;
+	}
+
+	d->value |= (uint32_t)(b & 0x7f) << d->shift;
+	d->shift += 7U;
+	if (b & 0x80) {
+		return 0;
+	}
+
+	value = d->value;
+	d->value = 0U;
+	d->shift = 0U;
+
+	switch (d->state) {
+	case DELTA_DIFF_LEN:
+		if ((value > (d->image_size - d->image_off)) ||
+		    (value > (d->source->fa_size - d->source_off))) {
+			return -EINVAL;
+		}
+		d->count = value;
+		d->state = (value != 0U) ? DELTA_DIFF : DELTA_EXTRA_LEN;
+		break;
+	case DELTA_EXTRA_LEN:
+		if (value > (d->image_size - d->image_off)) {
+			return -EINVAL;
+		}
+		d->count = value;
+		d->state = (value != 0U) ? DELTA_EXTRA : DELTA_ADJUST;
+		break;
+	case DELTA_ADJUST:
+		adjust = (int32_t)(value >> 1) ^ -(int32_t)(value & 1U);
+		if ((adjust < 0) ? ((uint32_t)-adjust > d->source_off)
+				 : ((uint32_t)adjust > (d->source->fa_size - d->source_off))) {
+			return -EINVAL;
+		}
+		d->source_off += adjust;
+		d->state = DELTA_DIFF_LEN;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int lz_output(struct flash_img_context *ctx, uint8_t b)
+{
+	struct flash_img_delta *d = &ctx->delta;
+
+	d->lz_window[d->lz_pos & LZ_WINDOW_MASK] = b;
+	d->lz_pos++;
+
+	return delta_patch_byte(ctx, b);
+}
+
+static int lz_match(struct flash_img_context *ctx)
+{
+	struct flash_img_delta *d = &ctx->delta;
+	int rc = 0;
+
+	for (; (rc == 0) && (d->lz_len > 0U); d->lz_len--) {
+		rc = lz_output(ctx, d->lz_window[(d->lz_pos - d->lz_offset) & LZ_WINDOW_MASK]);
+	}
+
+	d->lz_state = LZ_TOKEN;
+
+	return rc;
+}
+
+/* Decompress a byte of the patch body */
+static int lz_byte(struct flash_img_context *ctx, uint8_t b)
+{
+	struct flash_img_delta *d = &ctx->delta;
+	int rc = 0;
+
+	switch (d->lz_state) {
+	case LZ_TOKEN:
+		d->lz_token = b;
+		d->lz_len = b >> 4;
+		if (d->lz_len == 15U) {
+			d->lz_state = LZ_LITERAL_LEN;
+		} else {
+			d->lz_state = (d->lz_len != 0U) ? LZ_LITERALS : LZ_OFFSET_LO;
+		}
+		break;
+	case LZ_LITERAL_LEN:
+		d->lz_len += b;
+		if (b != 255U) {
+			d->lz_state = LZ_LITERALS;
+		}
+		break;
+	case LZ_LITERALS:
+		rc = lz_output(ctx, b);
+		if (--d->lz_len == 0U) {
+			d->lz_state = LZ_OFFSET_LO;
+		}
+		break;
+	case LZ_OFFSET_LO:
+		d->lz_offset = b;
+		d->lz_state = LZ_OFFSET_HI;
+		break;
+	case LZ_OFFSET_HI:
+		d->lz_offset |= (uint16_t)b << 8;
+		if ((d->lz_offset == 0U) || (d->lz_offset > d->lz_window_size) ||
+		    (d->lz_offset > d->lz_pos)) {
+			return -EINVAL;
+		}
+		d->lz_len = (d->lz_token & 0x0f) + LZ_MIN_MATCH;
+		if ((d->lz_token & 0x0f) == 15U) {
+			d->lz_state = LZ_MATCH_LEN;
+		} else {
+			rc = lz_match(ctx);
+		}
+		break;
+	case LZ_MATCH_LEN:
+		d->lz_len += b;
+		if (b != 255U) {
+			rc = lz_match(ctx);
+		}
+		break;
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	return rc;
+}
+
+int flash_img_delta_write(struct flash_img_context *ctx, const uint8_t *data, size_t len,
+			  bool flush)
+{
+	struct flash_img_delta *d = &ctx->delta;
+	int rc = 0;
+
+	for (size_t i = 0; (rc == 0) && (i < len); i++) {
+		if (d->state == DELTA_HEADER) {
+			rc = delta_header_byte(ctx, data[i]);
+		} else {
+			rc = lz_byte(ctx, data[i]);
+		}
+	}
+
+	if (rc != 0) {
+		LOG_ERR("Delta patch error %d at image offset 0x%08x", rc, d->image_off);
+		return rc;
+	}
+
+	if (!flush) {
+		return 0;
+	}
+
+	/* The patch must end after the last literals of a sequence, and a record */
+	if ((d->state != DELTA_DIFF_LEN) || (d->shift != 0U) ||
+	    (d->image_off != d->image_size) ||
+	    ((d->lz_state != LZ_TOKEN) && (d->lz_state != LZ_OFFSET_LO))) {
+		LOG_ERR("Incomplete delta patch, %u of %u bytes", d->image_off, d->image_size);
+		return -EINVAL;
+	}
+
+	rc = stream_flash_buffered_write(&ctx->stream, d->out_buf, d->out_len, true);
+	d->out_len = 0U;
+
+	return rc;
+}
+
+void flash_img_delta_close(struct flash_img_context *ctx)
+{
+	if (ctx->delta.source != NULL) {
+		flash_area_close(ctx->delta.source);
+		ctx->delta.source = NULL;
+	}
+}
+
+int flash_img_delta_init_id(struct flash_img_context *ctx, uint8_t area_id,
+			    uint8_t source_area_id)
+{
+	const struct flash_area *source;
+	int rc;
+
+	if (area_id == source_area_id) {
+		return -EINVAL;
+	}
+
+	rc = flash_area_open(source_area_id, &source);
+	if (rc != 0) {
+		return rc;
+	}
+
+	rc = flash_img_init_id(ctx, area_id);
+	if (rc != 0) {
+		flash_area_close(source);
+		return rc;
+	}
+
+	memset(&ctx->delta, 0, sizeof(ctx->delta));
+	ctx->delta.source = source;
+	ctx->delta.state = DELTA_HEADER;
+	ctx->delta.lz_state = LZ_TOKEN;
+
+	return 0;
+}
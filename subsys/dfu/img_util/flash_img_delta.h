@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DFU_IMG_UTIL_FLASH_IMG_DELTA_H_
+#define ZEPHYR_SUBSYS_DFU_IMG_UTIL_FLASH_IMG_DELTA_H_
+
+#include <zephyr/dfu/flash_img.h>
+
+#ifdef CONFIG_IMG_DELTA
+static inline bool flash_img_delta_active(const struct flash_img_context *ctx)
+{
+	return ctx->delta.source != NULL;
+}
+
+/* Decode patch data, writing the reconstructed image */
+int flash_img_delta_write(struct flash_img_context *ctx, const uint8_t *data, size_t len,
+			  bool flush);
+
+/* Release the base image */
+void flash_img_delta_close(struct flash_img_context *ctx);
+#else
+static inline bool flash_img_delta_active(const struct flash_img_context *ctx)
+{
+	ARG_UNUSED(ctx);
+	return false;
+}
+
+static inline int flash_img_delta_write(struct flash_img_context *ctx, const uint8_t *data,
+					size_t len, bool flush)
+{
+	return -ENOTSUP;
+}
+
+static inline void flash_img_delta_close(struct flash_img_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif /* CONFIG_IMG_DELTA */
+
+#endif /* ZEPHYR_SUBSYS_DFU_IMG_UTIL_FLASH_IMG_DELTA_H_ */
@@ -14,6 +14,8 @@
 #include <errno.h>
 #include <zephyr/device.h>
 
+#include "disk_cache.h"
+
 #define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(disk);
@@ -66,6 +68,9 @@ int disk_access_init(const char *pdrv)
 			if (rc == 0) {
 				/* Increment reference count */
 				disk->refcnt++;
+				if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+					disk_cache_attach(disk);
+				}
 			}
 		}
 	} else if ((disk != NULL) && (disk->refcnt < UINT16_MAX)) {
@@ -98,7 +103,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
-		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+			rc = disk_cache_read(disk, data_buf, start_sector, num_sector);
+		} else {
+			rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		}
 	}
 
 	return rc;
@@ -112,7 +121,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
-		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+			rc = disk_cache_write(disk, data_buf, start_sector, num_sector);
+		} else {
+			rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		}
 	}
 
 	return rc;
@@ -131,6 +144,9 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt++;
+					if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+						disk_cache_attach(disk);
+					}
 				}
 			} else if (disk->refcnt < UINT16_MAX) {
 				disk->refcnt++;
@@ -143,12 +159,26 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
 				disk->refcnt = 0U;
+				if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+					(void)disk_cache_sync(disk);
+					disk_cache_detach(disk);
+				}
 				disk->ops->ioctl(disk, cmd, buf);
 				rc = 0;
 			} else if (disk->refcnt == 1U) {
-				rc = disk->ops->ioctl(disk, cmd, buf);
+				rc = 0;
+				if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+					/* Write back the cache, it is kept if this fails */
+					rc = disk_cache_sync(disk);
+				}
+				if (rc == 0) {
+					rc = disk->ops->ioctl(disk, cmd, buf);
+				}
 				if (rc == 0) {
 					disk->refcnt--;
+					if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+						disk_cache_detach(disk);
+					}
 				}
 			} else if (disk->refcnt > 0) {
 				disk->refcnt--;
@@ -157,6 +187,15 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+		case DISK_IOCTL_CTRL_SYNC:
+			rc = 0;
+			if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+				rc = disk_cache_sync(disk);
+			}
+			if (rc == 0) {
+				rc = disk->ops->ioctl(disk, cmd, buf);
+			}
+			break;
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -204,6 +243,10 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+		disk_cache_detach(disk);
+	}
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
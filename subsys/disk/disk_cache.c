@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Write-back LRU cache of disk sectors, shared by all the disks.
+ *
+ * The cache lock is held during the transfers, it is a mutex so that a disk
+ * backed by another one, like the loopback disk, can access it from its
+ * driver. A block being transferred is marked busy so that such a nested
+ * access doesn't reuse it.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/drivers/disk.h>
+#include <errno.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define CACHE_BLOCKS     CONFIG_DISK_ACCESS_CACHE_BLOCKS
+#define CACHE_BLOCK_SIZE CONFIG_DISK_ACCESS_CACHE_BLOCK_SIZE
+#define READ_AHEAD       CONFIG_DISK_ACCESS_CACHE_READ_AHEAD
+
+struct disk_cache_block {
+	/* Disk of the cached sector, NULL if the block is free */
+	struct disk_info *disk;
+	uint32_t sector;
+	/* Value of use_count when the block was last accessed */
+	uint32_t last_use;
+	bool dirty;
+	bool busy;
+};
+
+static struct disk_cache_block blocks[CACHE_BLOCKS];
+static uint8_t block_data[CACHE_BLOCKS][CACHE_BLOCK_SIZE] __aligned(4);
+#if READ_AHEAD > 0
+static uint8_t read_ahead_buf[(READ_AHEAD + 1) * CACHE_BLOCK_SIZE] __aligned(4);
+static bool read_ahead_busy;
+#endif
+static uint32_t use_count;
+
+static K_MUTEX_DEFINE(disk_cache_lock);
+
+static inline uint8_t *block_buf(const struct disk_cache_block *block)
+{
+	return block_data[block - blocks];
+}
+
+static inline void block_touch(struct disk_cache_block *block)
+{
+	block->last_use = ++use_count;
+}
+
+static bool is_cached(const struct disk_info *disk, uint32_t start_sector, uint32_t num_sector)
+{
+	/* Out of bounds accesses are left to the driver to fail */
+	return (disk->cache_sector_size != 0U) && (start_sector < disk->cache_sector_count) &&
+	       (num_sector <= (disk->cache_sector_count - start_sector));
+}
+
+static struct disk_cache_block *block_find(const struct disk_info *disk, uint32_t sector)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		if ((blocks[i].disk == disk) && (blocks[i].sector == sector)) {
+			return &blocks[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int block_flush(struct disk_cache_block *block)
+{
+	struct disk_info *disk = block->disk;
+	int rc;
+
+	if (!block->dirty) {
+		return 0;
+	}
+
+	block->busy = true;
+	rc = disk->ops->write(disk, block_buf(block), block->sector, 1);
+	block->busy = false;
+	if (rc == 0) {
+		block->dirty = false;
+	} else {
+		LOG_ERR("Failed to write back sector %u of %s (%d)", block->sector, disk->name,
+			rc);
+	}
+
+	return rc;
+}
+
+/* Get a block for a sector that is not cached, evicting the least recently used one */
+static int block_alloc(struct disk_info *disk, uint32_t sector, struct disk_cache_block **out)
+{
+	struct disk_cache_block *victim = NULL;
+	int rc;
+
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		if (blocks[i].busy) {
+			continue;
+		}
+		if (blocks[i].disk == NULL) {
+			victim = &blocks[i];
+			break;
+		}
+		if ((victim == NULL) || ((int32_t)(blocks[i].last_use - victim->last_use) < 0)) {
+			victim = &blocks[i];
+		}
+	}
+
+	if (victim == NULL) {
+		return -EBUSY;
+	}
+
+	if (victim->disk != NULL) {
+		rc = block_flush(victim);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	victim->disk = disk;
+	victim->sector = sector;
+	victim->dirty = false;
+	block_touch(victim);
+	*out = victim;
+
+	return 0;
+}
+
+/* Read a sector that is not cached into the cache and into data_buf, along with the
+ * following ones up to count sectors.
+ */
+static int block_fill(struct disk_info *disk, uint8_t *data_buf, uint32_t sector,
+		      uint32_t count)
+{
+	struct disk_cache_block *block;
+	uint32_t sector_size = disk->cache_sector_size;
+	int rc;
+
+#if READ_AHEAD > 0
+	if ((count > 1U) && !read_ahead_busy) {
+		read_ahead_busy = true;
+		rc = disk->ops->read(disk, read_ahead_buf, sector, count);
+		/* Sectors already cached may have been modified, and may be written back
+		 * when evicted below.
+		 */
+		for (uint32_t i = 1U; (rc == 0) && (i < count); i++) {
+			block = block_find(disk, sector + i);
+			if (block != NULL) {
+				memcpy(&read_ahead_buf[i * sector_size], block_buf(block),
+				       sector_size);
+			}
+		}
+		if (rc == 0) {
+			memcpy(data_buf, read_ahead_buf, sector_size);
+		}
+		for (uint32_t i = 0U; (rc == 0) && (i < count); i++) {
+			if (block_find(disk, sector + i) != NULL) {
+				continue;
+			}
+			rc = block_alloc(disk, sector + i, &block);
+			if (rc == 0) {
+				memcpy(block_buf(block), &read_ahead_buf[i * sector_size],
+				       sector_size);
+			}
+		}
+		read_ahead_busy = false;
+
+		return rc;
+	}
+#else
+	ARG_UNUSED(count);
+#endif
+
+	rc = block_alloc(disk, sector, &block);
+	if (rc) {
+		return rc;
+	}
+
+	block->busy = true;
+	rc = disk->ops->read(disk, block_buf(block), sector, 1);
+	block->busy = false;
+	if (rc) {
+		block->disk = NULL;
+		return rc;
+	}
+
+	memcpy(data_buf, block_buf(block), sector_size);
+
+	return 0;
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	uint32_t sector_size = 0U;
+	uint32_t sector_count = 0U;
+
+	disk->cache_sector_size = 0U;
+
+	if ((disk->ops->read == NULL) || (disk->ops->write == NULL) ||
+	    (disk->ops->ioctl == NULL)) {
+		return;
+	}
+
+	if ((disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) != 0) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count) != 0)) {
+		return;
+	}
+
+	if ((sector_size == 0U) || (sector_size > CACHE_BLOCK_SIZE)) {
+		LOG_WRN("Sector size %u of %s not supported by the cache", sector_size,
+			disk->name);
+		return;
+	}
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+	disk->cache_sector_count = sector_count;
+	disk->cache_next_sector = UINT32_MAX;
+	disk->cache_sector_size = sector_size;
+	k_mutex_unlock(&disk_cache_lock);
+
+	LOG_DBG("Caching %s, %u sectors of %u bytes", disk->name, sector_count, sector_size);
+}
+
+void disk_cache_detach(struct disk_info *disk)
+{
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		if (blocks[i].disk == disk) {
+			blocks[i].disk = NULL;
+			blocks[i].dirty = false;
+		}
+	}
+	disk->cache_sector_size = 0U;
+	k_mutex_unlock(&disk_cache_lock);
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *block;
+	uint32_t sector_size;
+	uint32_t sector;
+	uint32_t count;
+	int rc = 0;
+
+	if (disk->cache_sector_size == 0U) {
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+
+	if (!is_cached(disk, start_sector, num_sector)) {
+		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		goto end;
+	}
+
+	sector_size = disk->cache_sector_size;
+
+	if ((num_sector * 2U) > CACHE_BLOCKS) {
+		/* Large transfer, only take the sectors not written back from the cache */
+		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		for (size_t i = 0; (rc == 0) && (i < ARRAY_SIZE(blocks)); i++) {
+			block = &blocks[i];
+			if ((block->disk == disk) && block->dirty &&
+			    (block->sector - start_sector < num_sector)) {
+				memcpy(&data_buf[(block->sector - start_sector) * sector_size],
+				       block_buf(block), sector_size);
+			}
+		}
+		goto end;
+	}
+
+	for (uint32_t i = 0U; (rc == 0) && (i < num_sector); i++) {
+		sector = start_sector + i;
+		block = block_find(disk, sector);
+		if (block != NULL) {
+			memcpy(&data_buf[i * sector_size], block_buf(block), sector_size);
+			block_touch(block);
+			continue;
+		}
+
+		count = 1U;
+		if ((READ_AHEAD > 0) && ((i > 0U) || (sector == disk->cache_next_sector))) {
+			/* Sequential access */
+			count = MIN(MIN(READ_AHEAD + 1U, CACHE_BLOCKS / 2U),
+				    disk->cache_sector_count - sector);
+		}
+
+		rc = block_fill(disk, &data_buf[i * sector_size], sector, count);
+	}
+
+end:
+	if (rc == 0) {
+		disk->cache_next_sector = start_sector + num_sector;
+	}
+	k_mutex_unlock(&disk_cache_lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *block;
+	uint32_t sector_size;
+	int rc = 0;
+
+	if (disk->cache_sector_size == 0U) {
+		return disk->ops->write(disk, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+
+	if (!is_cached(disk, start_sector, num_sector)) {
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		goto end;
+	}
+
+	sector_size = disk->cache_sector_size;
+
+	if ((num_sector * 2U) > CACHE_BLOCKS) {
+		/* Large transfer, written through. The cached sectors now match the disk. */
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		for (size_t i = 0; (rc == 0) && (i < ARRAY_SIZE(blocks)); i++) {
+			block = &blocks[i];
+			if ((block->disk == disk) && (block->sector - start_sector < num_sector)) {
+				memcpy(block_buf(block),
+				       &data_buf[(block->sector - start_sector) * sector_size],
+				       sector_size);
+				block->dirty = false;
+			}
+		}
+		goto end;
+	}
+
+	for (uint32_t i = 0U; i < num_sector; i++) {
+		block = block_find(disk, start_sector + i);
+		if (block == NULL) {
+			rc = block_alloc(disk, start_sector + i, &block);
+			if (rc) {
+				break;
+			}
+		}
+
+		memcpy(block_buf(block), &data_buf[i * sector_size], sector_size);
+		block->dirty = true;
+		block_touch(block);
+	}
+
+end:
+	k_mutex_unlock(&disk_cache_lock);
+
+	return rc;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	struct disk_cache_block *block;
+	int rc = 0;
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+
+	/* Write back in increasing sector order */
+	do {
+		block = NULL;
+		for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+			if ((blocks[i].disk == disk) && blocks[i].dirty && !blocks[i].busy &&
+			    ((block == NULL) || (blocks[i].sector < block->sector))) {
+				block = &blocks[i];
+			}
+		}
+
+		if (block != NULL) {
+			rc = block_flush(block);
+		}
+	} while ((block != NULL) && (rc == 0));
+
+	k_mutex_unlock(&disk_cache_lock);
+
+	return rc;
+}
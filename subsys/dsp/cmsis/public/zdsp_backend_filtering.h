@@ -0,0 +1,136 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SUBSYS_MATH_CMSIS_BACKEND_PUBLIC_ZDSP_BACKEND_FILTERING_H_
+#define SUBSYS_MATH_CMSIS_BACKEND_PUBLIC_ZDSP_BACKEND_FILTERING_H_
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The instances are converted to the CMSIS-DSP ones on each call, so that the
+ * zdsp structures do not depend on the layout of the library structures.
+ */
+
+static inline void zdsp_fir_init_q15(struct zdsp_fir_instance_q15 *inst, uint16_t num_taps,
+				      const q15_t *coeffs, q15_t *state,
+				      uint32_t block_size)
+{
+	inst->num_taps = num_taps;
+	inst->coeffs = coeffs;
+	inst->state = state;
+	memset(state, 0, (num_taps + block_size - 1) * sizeof(q15_t));
+}
+static inline void zdsp_fir_q15(const struct zdsp_fir_instance_q15 *inst,
+				 const q15_t *src, q15_t *dst, uint32_t block_size)
+{
+	const arm_fir_instance_q15 s = {
+		.numTaps = inst->num_taps,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+	};
+
+	arm_fir_q15(&s, src, dst, block_size);
+}
+
+static inline void zdsp_fir_init_q31(struct zdsp_fir_instance_q31 *inst, uint16_t num_taps,
+				      const q31_t *coeffs, q31_t *state,
+				      uint32_t block_size)
+{
+	inst->num_taps = num_taps;
+	inst->coeffs = coeffs;
+	inst->state = state;
+	memset(state, 0, (num_taps + block_size - 1) * sizeof(q31_t));
+}
+static inline void zdsp_fir_q31(const struct zdsp_fir_instance_q31 *inst,
+				 const q31_t *src, q31_t *dst, uint32_t block_size)
+{
+	const arm_fir_instance_q31 s = {
+		.numTaps = inst->num_taps,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+	};
+
+	arm_fir_q31(&s, src, dst, block_size);
+}
+
+static inline void zdsp_fir_init_f32(struct zdsp_fir_instance_f32 *inst, uint16_t num_taps,
+				      const float32_t *coeffs, float32_t *state,
+				      uint32_t block_size)
+{
+	inst->num_taps = num_taps;
+	inst->coeffs = coeffs;
+	inst->state = state;
+	memset(state, 0, (num_taps + block_size - 1) * sizeof(float32_t));
+}
+static inline void zdsp_fir_f32(const struct zdsp_fir_instance_f32 *inst,
+				 const float32_t *src, float32_t *dst, uint32_t block_size)
+{
+	const arm_fir_instance_f32 s = {
+		.numTaps = inst->num_taps,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+	};
+
+	arm_fir_f32(&s, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_cascade_df1_init_q15(
+	struct zdsp_biquad_casd_df1_instance_q15 *inst, uint8_t num_stages,
+	const q15_t *coeffs, q15_t *state, int8_t post_shift)
+{
+	inst->num_stages = num_stages;
+	inst->coeffs = coeffs;
+	inst->state = state;
+	inst->post_shift = post_shift;
+	memset(state, 0, 4U * num_stages * sizeof(q15_t));
+}
+static inline void zdsp_biquad_cascade_df1_q15(
+	const struct zdsp_biquad_casd_df1_instance_q15 *inst, const q15_t *src,
+	q15_t *dst, uint32_t block_size)
+{
+	const arm_biquad_casd_df1_inst_q15 s = {
+		.numStages = inst->num_stages,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+		.postShift = inst->post_shift,
+	};
+
+	arm_biquad_cascade_df1_q15(&s, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_cascade_df1_init_q31(
+	struct zdsp_biquad_casd_df1_instance_q31 *inst, uint8_t num_stages,
+	const q31_t *coeffs, q31_t *state, int8_t post_shift)
+{
+	inst->num_stages = num_stages;
+	inst->coeffs = coeffs;
+	inst->state = state;
+	inst->post_shift = post_shift;
+	memset(state, 0, 4U * num_stages * sizeof(q31_t));
+}
+static inline void zdsp_biquad_cascade_df1_q31(
+	const struct zdsp_biquad_casd_df1_instance_q31 *inst, const q31_t *src,
+	q31_t *dst, uint32_t block_size)
+{
+	const arm_biquad_casd_df1_inst_q31 s = {
+		.numStages = inst->num_stages,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+		.postShift = inst->post_shift,
+	};
+
+	arm_biquad_cascade_df1_q31(&s, src, dst, block_size);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUBSYS_MATH_CMSIS_BACKEND_PUBLIC_ZDSP_BACKEND_FILTERING_H_ */
@@ -0,0 +1,294 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <zephyr/display/damage_fb.h>
+
+#define LOG_LEVEL CONFIG_DAMAGE_FB_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(damage_fb);
+
+static inline uint32_t rect_area(const struct damage_fb_rect *r)
+{
+	return (uint32_t)r->width * r->height;
+}
+
+static void rect_union(struct damage_fb_rect *r, const struct damage_fb_rect *o)
+{
+	uint16_t x1 = MIN(r->x, o->x);
+	uint16_t y1 = MIN(r->y, o->y);
+	uint16_t x2 = MAX(r->x + r->width, o->x + o->width);
+	uint16_t y2 = MAX(r->y + r->height, o->y + o->height);
+
+	r->x = x1;
+	r->y = y1;
+	r->width = x2 - x1;
+	r->height = y2 - y1;
+}
+
+static uint32_t rect_union_area(const struct damage_fb_rect *r,
+				const struct damage_fb_rect *o)
+{
+	struct damage_fb_rect u = *r;
+
+	rect_union(&u, o);
+
+	return rect_area(&u);
+}
+
+static void damage_fb_remove(struct damage_fb *fb, uint8_t idx)
+{
+	fb->num_rects--;
+	fb->rects[idx] = fb->rects[fb->num_rects];
+}
+
+static void damage_fb_add(struct damage_fb *fb, struct damage_fb_rect r)
+{
+	while (true) {
+		uint32_t best_cost = UINT32_MAX;
+		uint8_t best = 0;
+		bool merged = false;
+
+		for (uint8_t i = 0; i < fb->num_rects; i++) {
+			uint32_t u = rect_union_area(&r, &fb->rects[i]);
+
+			/*
+			 * Merge if writing the union costs no more pixels than
+			 * writing both areas, i.e. they overlap or are aligned
+			 * neighbours.
+			 */
+			if (u <= rect_area(&r) + rect_area(&fb->rects[i])) {
+				rect_union(&r, &fb->rects[i]);
+				damage_fb_remove(fb, i);
+				merged = true;
+				break;
+			}
+
+			if (u - rect_area(&fb->rects[i]) < best_cost) {
+				best_cost = u - rect_area(&fb->rects[i]);
+				best = i;
+			}
+		}
+
+		if (merged) {
+			/* The grown area may now overlap other areas */
+			continue;
+		}
+
+		if (fb->num_rects < ARRAY_SIZE(fb->rects)) {
+			fb->rects[fb->num_rects++] = r;
+			return;
+		}
+
+		rect_union(&r, &fb->rects[best]);
+		damage_fb_remove(fb, best);
+	}
+}
+
+int damage_fb_init(struct damage_fb *fb, const struct device *dev,
+		   void *buf, size_t size, void *stage, size_t stage_size)
+{
+	struct display_capabilities caps;
+	uint8_t bits;
+
+	display_get_capabilities(dev, &caps);
+
+	bits = DISPLAY_BITS_PER_PIXEL(caps.current_pixel_format);
+	if (bits < 8 || bits % 8 != 0) {
+		LOG_ERR("Pixel format 0x%x not supported", caps.current_pixel_format);
+		return -ENOTSUP;
+	}
+
+	if (size < (size_t)caps.x_resolution * caps.y_resolution * (bits / 8)) {
+		LOG_ERR("Framebuffer too small");
+		return -ENOMEM;
+	}
+
+	if (stage != NULL && stage_size < (size_t)caps.x_resolution * (bits / 8)) {
+		LOG_ERR("Staging buffer smaller than one line");
+		return -ENOMEM;
+	}
+
+	memset(fb, 0, sizeof(struct damage_fb));
+	fb->dev = dev;
+	fb->buf = buf;
+	fb->stage = stage;
+	fb->stage_size = stage != NULL ? stage_size : 0;
+	fb->width = caps.x_resolution;
+	fb->height = caps.y_resolution;
+	fb->bpp = bits / 8;
+	fb->stats_start = k_uptime_get();
+	k_mutex_init(&fb->lock);
+
+	return 0;
+}
+
+void *damage_fb_get_buffer(struct damage_fb *fb, uint16_t *pitch)
+{
+	if (pitch != NULL) {
+		*pitch = fb->width;
+	}
+
+	return fb->buf;
+}
+
+void damage_fb_damage(struct damage_fb *fb, int32_t x, int32_t y,
+		      uint16_t width, uint16_t height)
+{
+	int32_t x1 = CLAMP(x, 0, fb->width);
+	int32_t y1 = CLAMP(y, 0, fb->height);
+	int32_t x2 = CLAMP(x + width, 0, fb->width);
+	int32_t y2 = CLAMP(y + height, 0, fb->height);
+	struct damage_fb_rect r;
+
+	if (x2 <= x1 || y2 <= y1) {
+		return;
+	}
+
+	r.x = x1;
+	r.y = y1;
+	r.width = x2 - x1;
+	r.height = y2 - y1;
+
+	k_mutex_lock(&fb->lock, K_FOREVER);
+	damage_fb_add(fb, r);
+	k_mutex_unlock(&fb->lock);
+}
+
+int damage_fb_write(struct damage_fb *fb, uint16_t x, uint16_t y,
+		    const struct display_buffer_descriptor *desc,
+		    const void *buf)
+{
+	const uint8_t *src = buf;
+	size_t line = (size_t)desc->width * fb->bpp;
+
+	if (desc->width > desc->pitch ||
+	    x + desc->width > fb->width ||
+	    y + desc->height > fb->height) {
+		return -EINVAL;
+	}
+
+	for (uint16_t i = 0; i < desc->height; i++) {
+		memcpy(fb->buf + ((size_t)(y + i) * fb->width + x) * fb->bpp,
+		       src + (size_t)i * desc->pitch * fb->bpp, line);
+	}
+
+	damage_fb_damage(fb, x, y, desc->width, desc->height);
+
+	return 0;
+}
+
+static int damage_fb_write_rect(struct damage_fb *fb,
+				const struct damage_fb_rect *r, bool last)
+{
+	struct display_buffer_descriptor desc = {
+		.width = r->width,
+		.frame_incomplete = !last,
+	};
+	size_t line = (size_t)r->width * fb->bpp;
+	const uint8_t *src = fb->buf + ((size_t)r->y * fb->width + r->x) * fb->bpp;
+	uint16_t rows;
+	uint32_t start;
+	int ret;
+
+	if (r->width == fb->width || fb->stage == NULL) {
+		/* Write straight from the framebuffer */
+		desc.height = r->height;
+		desc.pitch = fb->width;
+		desc.buf_size = ((size_t)(r->height - 1) * fb->width + r->width) * fb->bpp;
+
+		start = k_cycle_get_32();
+		ret = display_write(fb->dev, r->x, r->y, &desc, src);
+		fb->stats.write_time_us += k_cyc_to_us_floor64(k_cycle_get_32() - start);
+		fb->stats.writes++;
+
+		return ret;
+	}
+
+	/* Pack the lines into the staging buffer, as many as it can hold */
+	desc.pitch = r->width;
+	for (uint16_t y = 0; y < r->height; y += rows) {
+		rows = MIN(r->height - y, fb->stage_size / line);
+
+		for (uint16_t i = 0; i < rows; i++) {
+			memcpy(fb->stage + i * line,
+			       src + (size_t)(y + i) * fb->width * fb->bpp, line);
+		}
+
+		desc.height = rows;
+		desc.buf_size = rows * line;
+		desc.frame_incomplete = !last || y + rows < r->height;
+
+		start = k_cycle_get_32();
+		ret = display_write(fb->dev, r->x, r->y + y, &desc, fb->stage);
+		fb->stats.write_time_us += k_cyc_to_us_floor64(k_cycle_get_32() - start);
+		fb->stats.writes++;
+
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+int damage_fb_flush(struct damage_fb *fb)
+{
+	uint32_t start = k_cycle_get_32();
+	int ret = 0;
+
+	k_mutex_lock(&fb->lock, K_FOREVER);
+
+	if (fb->num_rects == 0) {
+		k_mutex_unlock(&fb->lock);
+		return 0;
+	}
+
+	while (fb->num_rects > 0) {
+		const struct damage_fb_rect *r = &fb->rects[fb->num_rects - 1];
+
+		ret = damage_fb_write_rect(fb, r, fb->num_rects == 1);
+		if (ret) {
+			LOG_ERR("Failed to write %ux%u at %u,%u (%d)",
+				r->width, r->height, r->x, r->y, ret);
+			break;
+		}
+
+		fb->stats.pixels += rect_area(r);
+		fb->num_rects--;
+	}
+
+	fb->stats.frames++;
+	fb->stats.last_flush_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	k_mutex_unlock(&fb->lock);
+
+	return ret;
+}
+
+void damage_fb_stats_get(struct damage_fb *fb, struct damage_fb_stats *stats)
+{
+	int64_t elapsed;
+
+	k_mutex_lock(&fb->lock, K_FOREVER);
+
+	*stats = fb->stats;
+	elapsed = k_uptime_get() - fb->stats_start;
+	if (elapsed > 0) {
+		stats->fps_x100 = (uint64_t)fb->stats.frames * 100U * MSEC_PER_SEC / elapsed;
+	}
+
+	k_mutex_unlock(&fb->lock);
+}
+
+void damage_fb_stats_reset(struct damage_fb *fb)
+{
+	k_mutex_lock(&fb->lock, K_FOREVER);
+	memset(&fb->stats, 0, sizeof(fb->stats));
+	fb->stats_start = k_uptime_get();
+	k_mutex_unlock(&fb->lock);
+}
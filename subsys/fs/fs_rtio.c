@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/work.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(fs, CONFIG_FS_LOG_LEVEL);
+
+static void fs_rtio_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	struct fs_file_t *zfp = sqe->iodev->data;
+	uint8_t *buf;
+	uint32_t buf_len;
+	ssize_t rc;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		/* A buffer from the memory pool is allocated as a single block */
+		rc = rtio_sqe_rx_buf(iodev_sqe, 1, 1, &buf, &buf_len);
+		if (rc == 0) {
+			rc = fs_read(zfp, buf, buf_len);
+		}
+		break;
+	case RTIO_OP_TX:
+		rc = fs_write(zfp, sqe->tx.buf, sqe->tx.buf_len);
+		break;
+	case RTIO_OP_TINY_TX:
+		rc = fs_write(zfp, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len);
+		break;
+	case RTIO_OP_FS_SYNC:
+		rc = fs_sync(zfp);
+		break;
+	default:
+		rc = -ENOTSUP;
+		break;
+	}
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, rc);
+	}
+}
+
+static void fs_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		LOG_ERR("RTIO work item allocation failed. Consider to increase "
+			"CONFIG_RTIO_WORKQ_POOL_ITEMS.");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, fs_rtio_submit_sync);
+}
+
+const struct rtio_iodev_api fs_rtio_iodev_api = {
+	.submit = fs_rtio_submit,
+};
@@ -74,19 +74,58 @@ static inline bool littlefs_on_blkdev(int flags)
 	return (flags & FS_MOUNT_FLAG_USE_DISK_ACCESS) ? true : false;
 }
 
+#ifdef CONFIG_FS_LITTLEFS_FC_STATS
+static struct fs_littlefs_fc_stats fc_stats;
+static struct k_spinlock fc_stats_lock;
+#endif
+
 static inline void *fc_allocate(size_t size)
 {
 	void *ret = NULL;
 
-	ret = k_heap_alloc(&file_cache_heap, size, K_NO_WAIT);
+	/* Wait for a file to be closed if the heap is exhausted */
+	ret = k_heap_alloc(&file_cache_heap, size, K_MSEC(CONFIG_FS_LITTLEFS_FC_HEAP_TIMEOUT));
+
+#ifdef CONFIG_FS_LITTLEFS_FC_STATS
+	k_spinlock_key_t key = k_spin_lock(&fc_stats_lock);
+
+	if (ret != NULL) {
+		fc_stats.buffers++;
+		fc_stats.bytes += size;
+		fc_stats.max_bytes = MAX(fc_stats.max_bytes, fc_stats.bytes);
+	} else {
+		fc_stats.failures++;
+	}
+	k_spin_unlock(&fc_stats_lock, key);
+#endif
 
 	return ret;
 }
 
-static inline void fc_release(void *buf)
+static inline void fc_release(void *buf, size_t size)
 {
 	k_heap_free(&file_cache_heap, buf);
+
+#ifdef CONFIG_FS_LITTLEFS_FC_STATS
+	k_spinlock_key_t key = k_spin_lock(&fc_stats_lock);
+
+	fc_stats.buffers--;
+	fc_stats.bytes -= size;
+	k_spin_unlock(&fc_stats_lock, key);
+#else
+	ARG_UNUSED(size);
+#endif
+}
+
+#ifdef CONFIG_FS_LITTLEFS_FC_STATS
+void fs_littlefs_fc_stats_get(struct fs_littlefs_fc_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&fc_stats_lock);
+
+	*stats = fc_stats;
+	k_spin_unlock(&fc_stats_lock, key);
 }
+#endif
 
 static inline void fs_lock(struct fs_littlefs *fs)
 {
@@ -262,9 +301,10 @@ static int lfs_api_sync(const struct lfs_config *c)
 static void release_file_data(struct fs_file_t *fp)
 {
 	struct lfs_file_data *fdp = fp->filep;
+	struct fs_littlefs *fs = fp->mp->fs_data;
 
 	if (fdp->config.buffer) {
-		fc_release(fdp->cache_block);
+		fc_release(fdp->cache_block, fs->lfs.cfg->cache_size);
 	}
 
 	k_mem_slab_free(&file_data_pool, fp->filep);
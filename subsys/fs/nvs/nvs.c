@@ -9,6 +9,8 @@
 #include <string.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <limits.h>
+#include <zephyr/init.h>
 #include <zephyr/fs/nvs.h>
 #include <zephyr/sys/crc.h>
 #include "nvs_priv.h"
@@ -36,42 +38,107 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
-static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+
+/* Find the cache entry of id: the one holding id, or else the empty one where
+ * to add it. Returns -ENOENT if id is not in the cache and there is no room
+ * left for it.
+ */
+static int nvs_lookup_cache_slot(struct nvs_fs *fs, uint16_t id)
 {
-	int rc;
-	uint32_t addr, ate_addr;
-	uint32_t *cache_entry;
-	struct nvs_ate ate;
+	size_t pos = nvs_lookup_cache_pos(id);
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
-	addr = fs->ate_wra;
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if ((fs->lookup_cache[pos] == NVS_LOOKUP_CACHE_NO_ADDR) ||
+		    (fs->lookup_cache_id[pos] == id)) {
+			return pos;
+		}
 
-	while (true) {
-		/* Make a copy of 'addr' as it will be advanced by nvs_pref_ate() */
-		ate_addr = addr;
-		rc = nvs_prev_ate(fs, &addr, &ate);
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
 
-		if (rc) {
-			return rc;
-		}
+	return -ENOENT;
+}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
+/* Remove the entry at pos, moving back the following entries of the probe
+ * sequence so that they can still be found.
+ */
+static void nvs_lookup_cache_remove(struct nvs_fs *fs, size_t pos)
+{
+	size_t next = pos;
+	size_t home;
 
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
-		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
-		}
+	for (size_t i = 1; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		next = (next + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 
-		if (addr == fs->ate_wra) {
+		if (fs->lookup_cache[next] == NVS_LOOKUP_CACHE_NO_ADDR) {
 			break;
 		}
+
+		/* Keep the entry if its own position lies in (pos, next] */
+		home = nvs_lookup_cache_pos(fs->lookup_cache_id[next]);
+		if ((pos < next) ? ((home > pos) && (home <= next)) :
+				   ((home > pos) || (home <= next))) {
+			continue;
+		}
+
+		fs->lookup_cache[pos] = fs->lookup_cache[next];
+		fs->lookup_cache_id[pos] = fs->lookup_cache_id[next];
+		pos = next;
 	}
 
-	return 0;
+	fs->lookup_cache[pos] = NVS_LOOKUP_CACHE_NO_ADDR;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE_FULL_ID */
+
+/* Address of the ATE to start looking for id from, NVS_LOOKUP_CACHE_NO_ADDR if
+ * there is no ATE of id.
+ */
+static uint32_t nvs_lookup_cache_get(struct nvs_fs *fs, uint16_t id)
+{
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+	int pos = nvs_lookup_cache_slot(fs, id);
+
+	if ((pos >= 0) && (fs->lookup_cache[pos] != NVS_LOOKUP_CACHE_NO_ADDR)) {
+		return fs->lookup_cache[pos];
+	}
+
+	/* An ID that did not fit is found by walking all the ATEs */
+	return fs->lookup_cache_full ? fs->ate_wra : NVS_LOOKUP_CACHE_NO_ADDR;
+#else
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#endif
+}
+
+static void nvs_lookup_cache_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+	int pos = nvs_lookup_cache_slot(fs, id);
+
+	if (pos < 0) {
+		fs->lookup_cache_full = true;
+		return;
+	}
+
+	fs->lookup_cache[pos] = addr;
+	fs->lookup_cache_id[pos] = id;
+#else
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = addr;
+#endif
 }
 
 static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
 {
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		/* An entry moved back to i is checked again */
+		while ((fs->lookup_cache[i] != NVS_LOOKUP_CACHE_NO_ADDR) &&
+		       ((fs->lookup_cache[i] >> ADDR_SECT_SHIFT) == sector)) {
+			nvs_lookup_cache_remove(fs, i);
+		}
+	}
+#else
 	uint32_t *cache_entry = fs->lookup_cache;
 	uint32_t *const cache_end = &fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 
@@ -80,6 +147,7 @@ static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
 			*cache_entry = NVS_LOOKUP_CACHE_NO_ADDR;
 		}
 	}
+#endif
 }
 
 #endif /* CONFIG_NVS_LOOKUP_CACHE */
@@ -166,7 +234,7 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
-		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		nvs_lookup_cache_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -494,7 +562,10 @@ static int nvs_recover_last_ate(struct nvs_fs *fs, uint32_t *addr)
 	*addr -= ate_size;
 	ate_end_addr = *addr;
 	data_end_addr = *addr & ADDR_SECT_MASK;
-	while (ate_end_addr > data_end_addr) {
+	/* The ate at data_end_addr is also checked, as the last position
+	 * within the sector can hold a delete ate.
+	 */
+	while (ate_end_addr >= data_end_addr) {
 		rc = nvs_flash_ate_rd(fs, ate_end_addr, &end_ate);
 		if (rc) {
 			return rc;
@@ -505,6 +576,9 @@ static int nvs_recover_last_ate(struct nvs_fs *fs, uint32_t *addr)
 			data_end_addr += end_ate.offset + end_ate.len;
 			*addr = ate_end_addr;
 		}
+		if ((ate_end_addr & ADDR_OFFS_MASK) == 0U) {
+			break;
+		}
 		ate_end_addr -= ate_size;
 	}
 
@@ -622,24 +696,27 @@ static int nvs_add_gc_done_ate(struct nvs_fs *fs)
 
 /* garbage collection: the address ate_wra has been updated to the new sector
  * that has just been started. The data to gc is in the sector after this new
- * sector.
+ * sector. Prepare gc to examine the entries of that sector, newest first.
  */
-static int nvs_gc(struct nvs_fs *fs)
+static int nvs_gc_start(struct nvs_fs *fs, struct nvs_gc_state *gc)
 {
 	int rc;
-	struct nvs_ate close_ate, gc_ate, wlk_ate;
-	uint32_t sec_addr, gc_addr, gc_prev_addr, wlk_addr, wlk_prev_addr,
-	      data_addr, stop_addr;
-	size_t ate_size;
+	struct nvs_ate close_ate, gc_ate;
+	uint32_t addr;
+	size_t ate_size, entry_size, max_entry_size = 0U;
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
-	sec_addr = (fs->ate_wra & ADDR_SECT_MASK);
-	nvs_sector_advance(fs, &sec_addr);
-	gc_addr = sec_addr + fs->sector_size - ate_size;
+	gc->sec_addr = (fs->ate_wra & ADDR_SECT_MASK);
+	nvs_sector_advance(fs, &gc->sec_addr);
+	gc->addr = gc->sec_addr + fs->sector_size - ate_size;
+	gc->stop_addr = gc->addr - ate_size;
+	gc->reserve = 0U;
+	gc->scanned = true;
+	gc->copied = false;
 
 	/* if the sector is not closed don't do gc */
-	rc = nvs_flash_ate_rd(fs, gc_addr, &close_ate);
+	rc = nvs_flash_ate_rd(fs, gc->addr, &close_ate);
 	if (rc < 0) {
 		/* flash error */
 		return rc;
@@ -647,65 +724,174 @@ static int nvs_gc(struct nvs_fs *fs)
 
 	rc = nvs_ate_cmp_const(&close_ate, fs->flash_parameters->erase_value);
 	if (!rc) {
-		goto gc_done;
+		gc->copied = true;
+		return 0;
 	}
 
-	stop_addr = gc_addr - ate_size;
-
 	if (nvs_close_ate_valid(fs, &close_ate)) {
-		gc_addr &= ADDR_SECT_MASK;
-		gc_addr += close_ate.offset;
+		gc->addr &= ADDR_SECT_MASK;
+		gc->addr += close_ate.offset;
 	} else {
-		rc = nvs_recover_last_ate(fs, &gc_addr);
+		rc = nvs_recover_last_ate(fs, &gc->addr);
 		if (rc) {
 			return rc;
 		}
 	}
 
-	do {
-		gc_prev_addr = gc_addr;
-		rc = nvs_prev_ate(fs, &gc_addr, &gc_ate);
+	if (!IS_ENABLED(CONFIG_NVS_GC_INCREMENTAL)) {
+		return 0;
+	}
+
+	/* Writes done before gc completes must leave room for the entries
+	 * that may have to be copied. Until the entries are scanned, all the
+	 * valid ones are assumed to be in use. The write sector is not erased
+	 * when gc is resumed after a power loss, so also keep room for copying
+	 * again the largest entry, as the space of an interrupted copy is lost.
+	 */
+	for (addr = gc->addr; addr <= gc->stop_addr; addr += ate_size) {
+		rc = nvs_flash_ate_rd(fs, addr, &gc_ate);
 		if (rc) {
 			return rc;
 		}
 
-		if (!nvs_ate_valid(fs, &gc_ate)) {
-			continue;
+		if (nvs_ate_valid(fs, &gc_ate) && gc_ate.len) {
+			entry_size = ate_size + nvs_al_size(fs, gc_ate.len);
+			gc->reserve += entry_size;
+			max_entry_size = MAX(max_entry_size, entry_size);
 		}
+	}
+
+	gc->reserve += max_entry_size;
+
+	gc->scan_addr = gc->addr;
+	gc->scanned = false;
+
+	return 0;
+}
+
+/* Tell whether the entry gc_ate at gc_ate_addr is the latest one for its id.
+ * Returns 1 if so, 0 if not and errcode on error.
+ */
+static int nvs_gc_entry_latest(struct nvs_fs *fs, const struct nvs_ate *gc_ate,
+			       uint32_t gc_ate_addr)
+{
+	int rc;
+	struct nvs_ate wlk_ate;
+	uint32_t wlk_addr, wlk_prev_addr;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
+	wlk_addr = nvs_lookup_cache_get(fs, gc_ate->id);
 
-		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
-			wlk_addr = fs->ate_wra;
-		}
-#else
+	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		wlk_addr = fs->ate_wra;
+	}
+#else
+	wlk_addr = fs->ate_wra;
 #endif
-		do {
-			wlk_prev_addr = wlk_addr;
-			rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
-			if (rc) {
-				return rc;
-			}
-			/* if ate with same id is reached we might need to copy.
-			 * only consider valid wlk_ate's. Something wrong might
-			 * have been written that has the same ate but is
-			 * invalid, don't consider these as a match.
-			 */
-			if ((wlk_ate.id == gc_ate.id) &&
-			    (nvs_ate_valid(fs, &wlk_ate))) {
-				break;
-			}
-		} while (wlk_addr != fs->ate_wra);
-
-		/* if walk has reached the same address as gc_addr copy is
-		 * needed unless it is a deleted item.
+	do {
+		wlk_prev_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		/* if ate with same id is reached we might need to copy.
+		 * only consider valid wlk_ate's. Something wrong might
+		 * have been written that has the same ate but is
+		 * invalid, don't consider these as a match.
 		 */
-		if ((wlk_prev_addr == gc_prev_addr) && gc_ate.len) {
+		if ((wlk_ate.id == gc_ate->id) &&
+		    (nvs_ate_valid(fs, &wlk_ate))) {
+			break;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+	/* if walk has reached the same address as gc_ate_addr the entry is
+	 * the latest one.
+	 */
+	return (wlk_prev_addr == gc_ate_addr) ? 1 : 0;
+}
+
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+/* Examine up to max_entries entries of the sector being garbage collected,
+ * releasing the space kept for the ones that are no longer in use. Entries in
+ * use can only get out of use later on, so the space kept stays sufficient.
+ */
+static int nvs_gc_scan(struct nvs_fs *fs, struct nvs_gc_state *gc, int max_entries)
+{
+	int rc;
+	struct nvs_ate gc_ate;
+	uint32_t gc_prev_addr;
+	size_t ate_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	for (int i = 0; (i < max_entries) && !gc->scanned; i++) {
+		gc_prev_addr = gc->scan_addr;
+		rc = nvs_prev_ate(fs, &gc->scan_addr, &gc_ate);
+		if (rc) {
+			return rc;
+		}
+
+		gc->scanned = (gc_prev_addr == gc->stop_addr);
+
+		if (!nvs_ate_valid(fs, &gc_ate) || !gc_ate.len) {
+			continue;
+		}
+
+		rc = nvs_gc_entry_latest(fs, &gc_ate, gc_prev_addr);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (!rc) {
+			gc->reserve -= MIN(gc->reserve, ate_size + nvs_al_size(fs, gc_ate.len));
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NVS_GC_INCREMENTAL */
+
+/* Examine up to max_entries entries of the sector being garbage collected,
+ * copying the ones that are still the latest for their id to the write
+ * sector.
+ */
+static int nvs_gc_copy(struct nvs_fs *fs, struct nvs_gc_state *gc, int max_entries)
+{
+	int rc;
+	struct nvs_ate gc_ate;
+	uint32_t gc_prev_addr, data_addr;
+	size_t ate_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	for (int i = 0; (i < max_entries) && !gc->copied; i++) {
+		gc_prev_addr = gc->addr;
+		rc = nvs_prev_ate(fs, &gc->addr, &gc_ate);
+		if (rc) {
+			return rc;
+		}
+
+		gc->copied = (gc_prev_addr == gc->stop_addr);
+
+		if (!nvs_ate_valid(fs, &gc_ate) || !gc_ate.len) {
+			continue;
+		}
+
+		rc = nvs_gc_entry_latest(fs, &gc_ate, gc_prev_addr);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (rc) {
 			/* copy needed */
 			LOG_DBG("Moving %d, len %d", gc_ate.id, gc_ate.len);
 
+			if (fs->ate_wra < (fs->data_wra + ate_size +
+					   nvs_al_size(fs, gc_ate.len))) {
+				return -ENOSPC;
+			}
+
 			data_addr = (gc_prev_addr & ADDR_SECT_MASK);
 			data_addr += gc_ate.offset;
 
@@ -721,10 +907,20 @@ static int nvs_gc(struct nvs_fs *fs)
 			if (rc) {
 				return rc;
 			}
+
+			gc->reserve -= MIN(gc->reserve, ate_size + nvs_al_size(fs, gc_ate.len));
 		}
-	} while (gc_prev_addr != stop_addr);
+	}
+
+	return 0;
+}
+
+static int nvs_gc_finish(struct nvs_fs *fs, struct nvs_gc_state *gc)
+{
+	int rc;
+	size_t ate_size;
 
-gc_done:
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
 	/* Make it possible to detect that gc has finished by writing a
 	 * gc done ate to the sector. In the field we might have nvs systems
@@ -740,11 +936,239 @@ gc_done:
 	}
 
 	/* Erase the gc'ed sector */
-	rc = nvs_flash_erase_sector(fs, sec_addr);
+	rc = nvs_flash_erase_sector(fs, gc->sec_addr);
+
+	return rc;
+}
+
+static int nvs_gc(struct nvs_fs *fs)
+{
+	struct nvs_gc_state gc;
+	int rc;
+
+	rc = nvs_gc_start(fs, &gc);
+	if (rc) {
+		return rc;
+	}
+
+	while (!gc.copied) {
+		rc = nvs_gc_copy(fs, &gc, INT_MAX);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return nvs_gc_finish(fs, &gc);
+}
+
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+K_THREAD_STACK_DEFINE(nvs_gc_stack, CONFIG_NVS_GC_INCREMENTAL_STACK_SIZE);
+static struct k_work_q nvs_gc_work_q;
+
+/* One step of the background garbage collection, with the lock held */
+static int nvs_gc_step(struct nvs_fs *fs)
+{
+	int rc;
+
+	if (!fs->gc.scanned) {
+		return nvs_gc_scan(fs, &fs->gc, CONFIG_NVS_GC_INCREMENTAL_STEP_ENTRIES);
+	}
+
+	if (!fs->gc.copied) {
+		return nvs_gc_copy(fs, &fs->gc, CONFIG_NVS_GC_INCREMENTAL_STEP_ENTRIES);
+	}
+
+	rc = nvs_gc_finish(fs, &fs->gc);
+	if (rc == 0) {
+		fs->gc_pending = false;
+	}
 
 	return rc;
 }
 
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	if (!fs->gc_pending) {
+		k_mutex_unlock(&fs->nvs_lock);
+		return;
+	}
+
+	rc = nvs_gc_step(fs);
+	if (rc) {
+		/* Left pending, the next write that needs room retries it */
+		LOG_ERR("Garbage collection failed: %d", rc);
+	} else if (fs->gc_pending) {
+		(void)k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+}
+
+static int nvs_gc_work_q_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "nvs_gc"};
+
+	k_work_queue_start(&nvs_gc_work_q, nvs_gc_stack, K_THREAD_STACK_SIZEOF(nvs_gc_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(nvs_gc_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+static void nvs_gc_cancel(struct nvs_fs *fs)
+{
+	struct k_work_sync sync;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	fs->gc_pending = false;
+	k_mutex_unlock(&fs->nvs_lock);
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+}
+#endif /* CONFIG_NVS_GC_INCREMENTAL */
+
+/* Start the garbage collection after closing a sector: it completes here or,
+ * with CONFIG_NVS_GC_INCREMENTAL, in the background.
+ */
+static int nvs_gc_begin(struct nvs_fs *fs)
+{
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	int rc;
+
+	rc = nvs_gc_start(fs, &fs->gc);
+	if (rc) {
+		return rc;
+	}
+
+	fs->gc_pending = true;
+	(void)k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+
+	return 0;
+#else
+	return nvs_gc(fs);
+#endif
+}
+
+/* Complete the garbage collection in progress, if any */
+static int nvs_gc_complete(struct nvs_fs *fs)
+{
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	int rc;
+
+	while (fs->gc_pending) {
+		rc = nvs_gc_step(fs);
+		if (rc) {
+			return rc;
+		}
+	}
+#endif
+
+	return 0;
+}
+
+/* Make room for a write when the space kept for the garbage collection in
+ * progress is in the way: scan one more entry as long as some are left, as
+ * that only reads the flash, or else complete the garbage collection.
+ */
+static int nvs_gc_make_room(struct nvs_fs *fs)
+{
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	if (!fs->gc.scanned) {
+		return nvs_gc_scan(fs, &fs->gc, 1);
+	}
+#endif
+
+	return nvs_gc_complete(fs);
+}
+
+/* Space of the write sector kept for the garbage collection in progress, and
+ * for one more allocation entry so that a delete still fits after it.
+ */
+static size_t nvs_gc_reserve(struct nvs_fs *fs)
+{
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	if (fs->gc_pending) {
+		return fs->gc.reserve + nvs_al_size(fs, sizeof(struct nvs_ate));
+	}
+#endif
+
+	return 0;
+}
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+/* Number of ATEs read at once when rebuilding the cache */
+#define NVS_LOOKUP_CACHE_REBUILD_ATES 16
+
+static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
+{
+	int rc;
+	uint32_t addr, ate_addr, last_addr;
+	struct nvs_ate ate;
+	struct nvs_ate ates[NVS_LOOKUP_CACHE_REBUILD_ATES];
+	size_t ate_size, cnt;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+	fs->lookup_cache_full = false;
+#endif
+	addr = fs->ate_wra;
+
+	while (true) {
+		/* The ATEs of a sector are contiguous up to the last one, which
+		 * nvs_prev_ate() reads on its own to jump to the previous
+		 * sector. Read the others in chunks when they are not padded.
+		 */
+		last_addr = (addr & ADDR_SECT_MASK) + fs->sector_size - 2 * ate_size;
+
+		while ((ate_size == sizeof(struct nvs_ate)) && (addr < last_addr)) {
+			cnt = MIN((last_addr - addr) / ate_size, ARRAY_SIZE(ates));
+
+			rc = nvs_flash_rd(fs, addr, ates, cnt * sizeof(struct nvs_ate));
+			if (rc) {
+				return rc;
+			}
+
+			for (size_t i = 0; i < cnt; i++, addr += ate_size) {
+				if (ates[i].id != 0xFFFF &&
+				    nvs_lookup_cache_get(fs, ates[i].id) ==
+					    NVS_LOOKUP_CACHE_NO_ADDR &&
+				    nvs_ate_valid(fs, &ates[i])) {
+					nvs_lookup_cache_set(fs, ates[i].id, addr);
+				}
+			}
+		}
+
+		/* Make a copy of 'addr' as it will be advanced by nvs_pref_ate() */
+		ate_addr = addr;
+		rc = nvs_prev_ate(fs, &addr, &ate);
+
+		if (rc) {
+			return rc;
+		}
+
+		if (ate.id != 0xFFFF &&
+		    nvs_lookup_cache_get(fs, ate.id) == NVS_LOOKUP_CACHE_NO_ADDR &&
+		    nvs_ate_valid(fs, &ate)) {
+			nvs_lookup_cache_set(fs, ate.id, ate_addr);
+		}
+
+		if (addr == fs->ate_wra) {
+			break;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NVS_LOOKUP_CACHE */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -760,6 +1184,12 @@ static int nvs_startup(struct nvs_fs *fs)
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+	/* Until the cache is rebuilt, all IDs are looked up by walking the ATEs */
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	fs->lookup_cache_full = true;
+#endif
+
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 	/* step through the sectors to find a open sector following
 	 * a closed sector, this is where NVS can write.
@@ -867,6 +1297,22 @@ static int nvs_startup(struct nvs_fs *fs)
 		fs->ate_wra -= ate_size;
 	}
 
+	/* possible data write after last ate write, update data_wra */
+	while (fs->ate_wra > fs->data_wra) {
+		empty_len = fs->ate_wra - fs->data_wra;
+
+		rc = nvs_flash_cmp_const(fs, fs->data_wra, erase_value,
+				empty_len);
+		if (rc < 0) {
+			goto end;
+		}
+		if (!rc) {
+			break;
+		}
+
+		fs->data_wra += fs->flash_parameters->write_block_size;
+	}
+
 	/* if the sector after the write sector is not empty gc was interrupted
 	 * we might need to restart gc if it has not yet finished. Otherwise
 	 * just erase the sector.
@@ -909,6 +1355,13 @@ static int nvs_startup(struct nvs_fs *fs)
 			rc = nvs_flash_erase_sector(fs, addr);
 			goto end;
 		}
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+		/* The write sector holds the entries already copied, but also
+		 * entries written meanwhile: resume gc, which copies only the
+		 * entries that are still the latest.
+		 */
+		LOG_INF("No GC Done marker found: resuming gc");
+#else
 		LOG_INF("No GC Done marker found: restarting gc");
 		rc = nvs_flash_erase_sector(fs, fs->ate_wra);
 		if (rc) {
@@ -917,7 +1370,8 @@ static int nvs_startup(struct nvs_fs *fs)
 		fs->ate_wra &= ADDR_SECT_MASK;
 		fs->ate_wra += (fs->sector_size - 2 * ate_size);
 		fs->data_wra = (fs->ate_wra & ADDR_SECT_MASK);
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#endif
+#if defined(CONFIG_NVS_LOOKUP_CACHE) && !defined(CONFIG_NVS_LOOKUP_CACHE_FULL_ID)
 		/**
 		 * At this point, the lookup cache wasn't built but the gc function need to use it.
 		 * So, temporarily, we set the lookup cache to the end of the fs.
@@ -931,22 +1385,6 @@ static int nvs_startup(struct nvs_fs *fs)
 		goto end;
 	}
 
-	/* possible data write after last ate write, update data_wra */
-	while (fs->ate_wra > fs->data_wra) {
-		empty_len = fs->ate_wra - fs->data_wra;
-
-		rc = nvs_flash_cmp_const(fs, fs->data_wra, erase_value,
-				empty_len);
-		if (rc < 0) {
-			goto end;
-		}
-		if (!rc) {
-			break;
-		}
-
-		fs->data_wra += fs->flash_parameters->write_block_size;
-	}
-
 	/* If the ate_wra is pointing to the first ate write location in a
 	 * sector and data_wra is not 0, erase the sector as it contains no
 	 * valid data (this also avoids closing a sector without any data).
@@ -989,6 +1427,10 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	nvs_gc_cancel(fs);
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1009,6 +1451,16 @@ int nvs_mount(struct nvs_fs *fs)
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	if (fs->ready) {
+		/* remount, the gc in progress is resumed by nvs_startup() */
+		nvs_gc_cancel(fs);
+	}
+
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+	fs->gc_pending = false;
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
@@ -1091,7 +1543,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1169,7 +1621,7 @@ no_cached_entry:
 			goto end;
 		}
 
-		if (fs->ate_wra >= (fs->data_wra + required_space)) {
+		if (fs->ate_wra >= (fs->data_wra + required_space + nvs_gc_reserve(fs))) {
 
 			rc = nvs_flash_wrt_entry(fs, id, data, len);
 			if (rc) {
@@ -1178,13 +1630,20 @@ no_cached_entry:
 			break;
 		}
 
+		if (nvs_gc_reserve(fs)) {
+			rc = nvs_gc_make_room(fs);
+			if (rc) {
+				goto end;
+			}
+			continue;
+		}
 
 		rc = nvs_sector_close(fs);
 		if (rc) {
 			goto end;
 		}
 
-		rc = nvs_gc(fs);
+		rc = nvs_gc_begin(fs);
 		if (rc) {
 			goto end;
 		}
@@ -1227,7 +1686,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	cnt_his = 0U;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -1252,7 +1711,8 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		}
 	}
 
-	if (((wlk_addr == fs->ate_wra) && (wlk_ate.id != id)) ||
+	if (((wlk_addr == fs->ate_wra) &&
+	     ((wlk_ate.id != id) || !nvs_ate_valid(fs, &wlk_ate))) ||
 	    (wlk_ate.len == 0U) || (cnt_his < cnt)) {
 		return -ENOENT;
 	}
@@ -1378,7 +1838,12 @@ size_t nvs_sector_max_data_size(struct nvs_fs *fs)
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
-	return fs->ate_wra - fs->data_wra - ate_size - NVS_DATA_CRC_SIZE;
+	/* Not counting the space kept for the garbage collection in progress */
+	if (fs->ate_wra < fs->data_wra + ate_size + NVS_DATA_CRC_SIZE + nvs_gc_reserve(fs)) {
+		return 0;
+	}
+
+	return fs->ate_wra - fs->data_wra - ate_size - NVS_DATA_CRC_SIZE - nvs_gc_reserve(fs);
 }
 
 int nvs_sector_use_next(struct nvs_fs *fs)
@@ -1392,12 +1857,17 @@ int nvs_sector_use_next(struct nvs_fs *fs)
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
+	ret = nvs_gc_complete(fs);
+	if (ret != 0) {
+		goto end;
+	}
+
 	ret = nvs_sector_close(fs);
 	if (ret != 0) {
 		goto end;
 	}
 
-	ret = nvs_gc(fs);
+	ret = nvs_gc_begin(fs);
 
 end:
 	k_mutex_unlock(&fs->nvs_lock);
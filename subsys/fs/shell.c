@@ -516,6 +516,20 @@ static int cmd_statvfs(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+#ifdef CONFIG_FS_LITTLEFS_FC_STATS
+static int cmd_littlefs_cache(const struct shell *sh, size_t argc, char **argv)
+{
+	struct fs_littlefs_fc_stats stats;
+
+	fs_littlefs_fc_stats_get(&stats);
+
+	shell_fprintf(sh, SHELL_NORMAL, "buffers %u, bytes %zu, max bytes %zu, failures %u\n",
+		      stats.buffers, stats.bytes, stats.max_bytes, stats.failures);
+
+	return 0;
+}
+#endif
+
 static int cmd_write(const struct shell *sh, size_t argc, char **argv)
 {
 	char path[MAX_PATH_LEN];
@@ -919,6 +933,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_fs,
 	SHELL_CMD_ARG(statvfs, NULL, "Show file system state", cmd_statvfs, 2, 0),
 	SHELL_CMD_ARG(trunc, NULL, "Truncate file", cmd_trunc, 2, 255),
 	SHELL_CMD_ARG(write, NULL, "Write file", cmd_write, 3, 255),
+#ifdef CONFIG_FS_LITTLEFS_FC_STATS
+	SHELL_CMD(littlefs_cache, NULL, "Show littlefs file cache usage", cmd_littlefs_cache),
+#endif
 #ifdef CONFIG_FILE_SYSTEM_SHELL_TEST_COMMANDS
 	SHELL_CMD_ARG(read_test, NULL, "Read file test", cmd_read_test, 2, 2),
 	SHELL_CMD_ARG(erase_write_test, NULL, "Erase/write file test", cmd_erase_write_test, 3, 3),
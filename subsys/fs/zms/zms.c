@@ -535,37 +535,46 @@ static int zms_validate_closed_sector(struct zms_fs *fs, uint64_t addr, struct z
 	return 0;
 }
 
-/* store an entry in flash */
-static int zms_flash_write_entry(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+/* write the data of an entry, unless it fits in the ATE, and prepare its ATE */
+static int zms_flash_entry_data_wrt(struct zms_fs *fs, uint32_t id, const void *data, size_t len,
+				    struct zms_ate *entry)
 {
-	int rc;
-	struct zms_ate entry;
-
 	/* Initialize all members to 0 */
-	memset(&entry, 0, sizeof(struct zms_ate));
+	memset(entry, 0, sizeof(struct zms_ate));
 
-	entry.id = id;
-	entry.len = (uint16_t)len;
-	entry.cycle_cnt = fs->sector_cycle;
+	entry->id = id;
+	entry->len = (uint16_t)len;
+	entry->cycle_cnt = fs->sector_cycle;
 
 	if (len > ZMS_DATA_IN_ATE_SIZE) {
 		/* only compute CRC if len is greater than 8 bytes */
 		if (IS_ENABLED(CONFIG_ZMS_DATA_CRC)) {
-			entry.data_crc = crc32_ieee(data, len);
+			entry->data_crc = crc32_ieee(data, len);
 		}
-		entry.offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
+		entry->offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
 	} else if ((len > 0) && (len <= ZMS_DATA_IN_ATE_SIZE)) {
 		/* Copy data into entry for small data ( < 8B) */
-		memcpy(&entry.data, data, len);
+		memcpy(&entry->data, data, len);
 	}
 
-	zms_ate_crc8_update(&entry);
+	zms_ate_crc8_update(entry);
 
 	if (len > ZMS_DATA_IN_ATE_SIZE) {
-		rc = zms_flash_data_wrt(fs, data, len);
-		if (rc) {
-			return rc;
-		}
+		return zms_flash_data_wrt(fs, data, len);
+	}
+
+	return 0;
+}
+
+/* store an entry in flash */
+static int zms_flash_write_entry(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+{
+	int rc;
+	struct zms_ate entry;
+
+	rc = zms_flash_entry_data_wrt(fs, id, data, len, &entry);
+	if (rc) {
+		return rc;
 	}
 
 	rc = zms_flash_ate_wrt(fs, &entry);
@@ -589,8 +598,8 @@ static int zms_recover_last_ate(struct zms_fs *fs, uint64_t *addr, uint64_t *dat
 
 	LOG_DBG("Recovering last ate from sector %llu", SECTOR_NUM(*addr));
 
-	/* skip close and empty ATE */
-	*addr -= 2 * fs->ate_size;
+	/* *addr points to the close ATE, the first ATE of the sector is right below it */
+	*addr -= fs->ate_size;
 
 	ate_end_addr = *addr;
 	data_end_addr = *addr & ADDR_SECT_MASK;
@@ -1014,7 +1023,7 @@ static int zms_gc(struct zms_fs *fs)
 			return rc;
 		}
 
-		if (!zms_ate_valid(fs, &gc_ate) || !gc_ate.len) {
+		if (!zms_ate_valid(fs, &gc_ate) || !gc_ate.len || (gc_ate.id == ZMS_HEAD_ID)) {
 			continue;
 		}
 
@@ -1128,6 +1137,269 @@ end:
 	return 0;
 }
 
+#ifdef CONFIG_ZMS_WRITE_BATCH
+/* A batch write starts with a begin ATE and ends with a commit ATE, both using the ID
+ * ZMS_HEAD_ID and holding the number of entries of the batch.
+ */
+static int zms_add_batch_ate(struct zms_fs *fs, uint32_t marker, uint32_t count)
+{
+	struct zms_ate batch_ate;
+
+	batch_ate.id = ZMS_HEAD_ID;
+	batch_ate.len = ZMS_DATA_IN_ATE_SIZE;
+	batch_ate.offset = count;
+	batch_ate.metadata = marker;
+	batch_ate.cycle_cnt = fs->sector_cycle;
+
+	zms_ate_crc8_update(&batch_ate);
+
+	return zms_flash_ate_wrt(fs, &batch_ate);
+}
+
+static bool zms_batch_ate_valid(struct zms_fs *fs, const struct zms_ate *entry, uint32_t marker)
+{
+	return (zms_ate_valid(fs, entry) && (entry->id == ZMS_HEAD_ID) &&
+		(entry->len == ZMS_DATA_IN_ATE_SIZE) && (entry->metadata == marker));
+}
+
+/* Tell if ate_cnt ATEs and data_size bytes of data fit in the write sector, leaving
+ * the ATE for a delete and the first ATE position of the sector free.
+ */
+static bool zms_batch_fits(struct zms_fs *fs, size_t ate_cnt, size_t data_size)
+{
+	uint64_t ate_space = (uint64_t)ate_cnt * fs->ate_size;
+
+	return (SECTOR_OFFSET(fs->ate_wra) > ate_space) &&
+	       (fs->ate_wra - ate_space >= fs->data_wra + data_size);
+}
+
+/* Search for the most recent valid ATE with the given ID.
+ * retval: 1 if found, 0 if not found, < 0 on error
+ */
+static int zms_find_latest_ate(struct zms_fs *fs, uint32_t id, struct zms_ate *ate,
+			       uint64_t *ate_addr)
+{
+	uint64_t wlk_addr;
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+
+	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		return 0;
+	}
+#else
+	wlk_addr = fs->ate_wra;
+#endif
+
+	return zms_find_ate_with_id(fs, id, wlk_addr, fs->ate_wra, ate, ate_addr);
+}
+
+/* Write the ATEs of a batch at once. entries are sorted by increasing address, so the
+ * last one is written at fs->ate_wra.
+ */
+static int zms_flash_batch_ates_wrt(struct zms_fs *fs, const struct zms_ate *entries, size_t cnt)
+{
+	int rc;
+	uint64_t addr;
+
+	addr = fs->ate_wra - (uint64_t)(cnt - 1) * fs->ate_size;
+	rc = zms_flash_al_wrt(fs, addr, entries, cnt * sizeof(struct zms_ate));
+	if (rc) {
+		return rc;
+	}
+
+	for (size_t i = cnt; i-- > 0;) {
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+		fs->lookup_cache[zms_lookup_cache_pos(entries[i].id)] = fs->ate_wra;
+#endif
+		fs->ate_wra -= fs->ate_size;
+	}
+
+	return 0;
+}
+
+/* Compare the values of two ATEs, a missing ATE (NULL) being equal to a deleted one.
+ * returns 0 if equal, 1 if not equal, errcode if error
+ */
+static int zms_batch_value_cmp(struct zms_fs *fs, const struct zms_ate *ate1, uint64_t ate1_addr,
+			       const struct zms_ate *ate2, uint64_t ate2_addr)
+{
+	int rc;
+	size_t len = ate1 ? ate1->len : 0U;
+	size_t bytes_to_cmp;
+	size_t block_size;
+	uint64_t addr1;
+	uint64_t addr2;
+	uint8_t buf[ZMS_BLOCK_SIZE];
+
+	if (len != (ate2 ? ate2->len : 0U)) {
+		return 1;
+	}
+
+	if (len == 0U) {
+		return 0;
+	}
+
+	if (len <= ZMS_DATA_IN_ATE_SIZE) {
+		return memcmp(&ate1->data, &ate2->data, len) ? 1 : 0;
+	}
+
+	addr1 = (ate1_addr & ADDR_SECT_MASK) + ate1->offset;
+	addr2 = (ate2_addr & ADDR_SECT_MASK) + ate2->offset;
+	block_size = zms_round_down_write_block_size(fs, ZMS_BLOCK_SIZE);
+
+	while (len) {
+		bytes_to_cmp = MIN(block_size, len);
+		rc = zms_flash_rd(fs, addr1, buf, bytes_to_cmp);
+		if (rc) {
+			return rc;
+		}
+		rc = zms_flash_block_cmp(fs, addr2, buf, bytes_to_cmp);
+		if (rc) {
+			return rc;
+		}
+		len -= bytes_to_cmp;
+		addr1 += bytes_to_cmp;
+		addr2 += bytes_to_cmp;
+	}
+
+	return 0;
+}
+
+/* Write again the value an entry had before an interrupted batch write, as the garbage
+ * collector does, or delete the entry if it didn't exist.
+ */
+static int zms_batch_restore(struct zms_fs *fs, uint32_t id, struct zms_ate *old_ate,
+			     uint64_t old_addr)
+{
+	int rc;
+	uint64_t data_addr;
+
+	if (!old_ate || !old_ate->len) {
+		return zms_flash_write_entry(fs, id, NULL, 0);
+	}
+
+	if (old_ate->len > ZMS_DATA_IN_ATE_SIZE) {
+		data_addr = (old_addr & ADDR_SECT_MASK) + old_ate->offset;
+		old_ate->offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
+
+		rc = zms_flash_block_move(fs, data_addr, old_ate->len);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	old_ate->cycle_cnt = fs->sector_cycle;
+	zms_ate_crc8_update(old_ate);
+
+	return zms_flash_ate_wrt(fs, old_ate);
+}
+
+/* Roll back a batch write of the write sector that has been interrupted, i.e. which has
+ * a begin ATE but no commit ATE. The value each entry of the batch had before is written
+ * again, in the room zms_write_batch() reserved for this, then the batch is committed.
+ * Entries with their former value, e.g. restored by a previously interrupted rollback,
+ * are skipped.
+ */
+static int zms_batch_recover(struct zms_fs *fs)
+{
+	int rc;
+	int old_found;
+	int cur_found;
+	uint64_t addr;
+	uint64_t begin_addr;
+	uint64_t end_addr;
+	uint64_t old_addr = 0U;
+	uint64_t cur_addr = 0U;
+	uint32_t count;
+	struct zms_ate ate;
+	struct zms_ate old_ate;
+	struct zms_ate cur_ate;
+
+	rc = zms_get_sector_cycle(fs, fs->ate_wra, &fs->sector_cycle);
+	if (rc) {
+		/* sector never used */
+		return (rc == -ENOENT) ? 0 : rc;
+	}
+
+	/* Look for the most recent batch ATE of the write sector */
+	end_addr = zms_close_ate_addr(fs, fs->ate_wra);
+	for (addr = fs->ate_wra + fs->ate_size; addr < end_addr; addr += fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+		if (zms_batch_ate_valid(fs, &ate, ZMS_BATCH_COMMIT)) {
+			return 0;
+		}
+		if (zms_batch_ate_valid(fs, &ate, ZMS_BATCH_BEGIN)) {
+			break;
+		}
+	}
+
+	if (addr >= end_addr) {
+		return 0;
+	}
+
+	begin_addr = addr;
+	count = ate.offset;
+	LOG_WRN("Rolling back an interrupted batch write of %u entries", count);
+
+	/* The restored values are written after end_addr */
+	end_addr = fs->ate_wra;
+	for (addr = begin_addr - fs->ate_size; addr > end_addr; addr -= fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+		if (!zms_ate_valid(fs, &ate) || (ate.id == ZMS_HEAD_ID)) {
+			continue;
+		}
+
+		/* Value before the batch */
+		old_found = zms_find_ate_with_id(fs, ate.id, begin_addr, fs->ate_wra, &old_ate,
+						 &old_addr);
+		if (old_found < 0) {
+			return old_found;
+		}
+
+		/* Current value */
+		cur_found = zms_find_latest_ate(fs, ate.id, &cur_ate, &cur_addr);
+		if (cur_found < 0) {
+			return cur_found;
+		}
+
+		rc = zms_batch_value_cmp(fs, old_found ? &old_ate : NULL, old_addr,
+					 cur_found ? &cur_ate : NULL, cur_addr);
+		if (rc < 0) {
+			return rc;
+		}
+		if (rc == 0) {
+			/* Value unchanged by the batch or already restored */
+			continue;
+		}
+
+		/* Only repeated power losses during the rollback can exhaust the reserved room
+		 * with partially written values. Leave the rest of the batch as it is then.
+		 */
+		if (!zms_batch_fits(fs, 2,
+				    (old_found && (old_ate.len > ZMS_DATA_IN_ATE_SIZE))
+					    ? zms_al_size(fs, old_ate.len)
+					    : 0)) {
+			LOG_ERR("No room left to roll back the batch write");
+			return 0;
+		}
+
+		rc = zms_batch_restore(fs, ate.id, old_found ? &old_ate : NULL, old_addr);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return zms_add_batch_ate(fs, ZMS_BATCH_COMMIT, count);
+}
+#endif /* CONFIG_ZMS_WRITE_BATCH */
+
 static int zms_init(struct zms_fs *fs)
 {
 	int rc;
@@ -1187,6 +1459,23 @@ static int zms_init(struct zms_fs *fs)
 
 			if (!sec_closed) {
 				/* We found an Open sector following a closed one */
+				if (!zms_empty_ate_valid(fs, &empty_ate)) {
+					/* Power was lost before the sector was started, it
+					 * doesn't contain any data yet.
+					 */
+					rc = zms_flash_erase_sector(fs, addr);
+					if (rc) {
+						goto end;
+					}
+					rc = zms_add_empty_ate(fs, addr);
+					if (rc) {
+						goto end;
+					}
+					rc = zms_get_sector_cycle(fs, addr, &fs->sector_cycle);
+					if (rc) {
+						goto end;
+					}
+				}
 				break;
 			}
 		}
@@ -1377,6 +1666,11 @@ end:
 	if (!rc) {
 		rc = zms_lookup_cache_rebuild(fs);
 	}
+#endif
+#ifdef CONFIG_ZMS_WRITE_BATCH
+	if (!rc) {
+		rc = zms_batch_recover(fs);
+	}
 #endif
 	/* If the sector is empty add a gc done ate to avoid having insufficient
 	 * space when doing gc.
@@ -1603,6 +1897,133 @@ int zms_delete(struct zms_fs *fs, uint32_t id)
 	return zms_write(fs, id, NULL, 0);
 }
 
+#ifdef CONFIG_ZMS_WRITE_BATCH
+int zms_write_batch(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count)
+{
+	int rc;
+	int prev_found;
+	uint32_t gc_count;
+	uint64_t prev_addr;
+	struct zms_ate prev_ate;
+	struct zms_ate ates[CONFIG_ZMS_WRITE_BATCH_ATES];
+	size_t ate_num = 0U;
+	/* begin and commit ATEs */
+	size_t ate_cnt = 2U;
+	size_t data_size = 0U;
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	if ((count == 0U) || (entries == NULL)) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if ((entries[i].len > (fs->sector_size - 5 * fs->ate_size)) ||
+		    (entries[i].len > UINT16_MAX) ||
+		    ((entries[i].len > 0) && (entries[i].data == NULL))) {
+			return -EINVAL;
+		}
+
+		ate_cnt++;
+		if (entries[i].len > ZMS_DATA_IN_ATE_SIZE) {
+			data_size += zms_al_size(fs, entries[i].len);
+		}
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	/* Reserve room to roll the batch back if it is interrupted, i.e. to write again the
+	 * current value of each entry.
+	 */
+	for (size_t i = 0; i < count; i++) {
+		prev_found = zms_find_latest_ate(fs, entries[i].id, &prev_ate, &prev_addr);
+		if (prev_found < 0) {
+			rc = prev_found;
+			goto end;
+		}
+
+		ate_cnt++;
+		if (prev_found && (prev_ate.len > ZMS_DATA_IN_ATE_SIZE)) {
+			data_size += zms_al_size(fs, prev_ate.len);
+		}
+	}
+
+	/* The batch must fit in a sector, which also holds the header ATEs and the gc done
+	 * ATE, and keeps room for a delete ATE.
+	 */
+	if ((ate_cnt * fs->ate_size + data_size) >= (fs->sector_size - 4 * fs->ate_size)) {
+		rc = -EINVAL;
+		goto end;
+	}
+
+	gc_count = 0;
+	while (!zms_batch_fits(fs, ate_cnt, data_size)) {
+		if (gc_count == fs->sector_count) {
+			/* gc'ed all sectors, no extra space will be created
+			 * by extra gc.
+			 */
+			rc = -ENOSPC;
+			goto end;
+		}
+		rc = zms_sector_close(fs);
+		if (rc) {
+			LOG_ERR("Failed to close the sector, returned = %d", rc);
+			goto end;
+		}
+		rc = zms_gc(fs);
+		if (rc) {
+			LOG_ERR("Garbage collection failed, returned = %d", rc);
+			goto end;
+		}
+		gc_count++;
+	}
+
+	rc = zms_add_batch_ate(fs, ZMS_BATCH_BEGIN, (uint32_t)count);
+	if (rc) {
+		goto end;
+	}
+
+	/* Write the data of the entries one after the other. Their ATEs are gathered to be
+	 * written at once, when they are not padded to the write block size.
+	 */
+	for (size_t i = 0; i < count; i++) {
+		struct zms_ate *entry = &ates[ARRAY_SIZE(ates) - 1 - ate_num];
+
+		rc = zms_flash_entry_data_wrt(fs, entries[i].id, entries[i].data, entries[i].len,
+					      entry);
+		if (rc) {
+			goto end;
+		}
+
+		if (fs->ate_size != sizeof(struct zms_ate)) {
+			rc = zms_flash_ate_wrt(fs, entry);
+			if (rc) {
+				goto end;
+			}
+			continue;
+		}
+
+		ate_num++;
+		if ((ate_num == ARRAY_SIZE(ates)) || (i == count - 1)) {
+			rc = zms_flash_batch_ates_wrt(fs, &ates[ARRAY_SIZE(ates) - ate_num],
+						      ate_num);
+			if (rc) {
+				goto end;
+			}
+			ate_num = 0U;
+		}
+	}
+
+	rc = zms_add_batch_ate(fs, ZMS_BATCH_COMMIT, (uint32_t)count);
+end:
+	k_mutex_unlock(&fs->zms_lock);
+	return rc;
+}
+#endif /* CONFIG_ZMS_WRITE_BATCH */
+
 ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, uint32_t cnt)
 {
 	int rc;
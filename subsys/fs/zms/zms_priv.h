@@ -41,6 +41,10 @@
 #define ZMS_INVALID_SECTOR_NUM -1
 #define ZMS_DATA_IN_ATE_SIZE   8
 
+/* Metadata of the ATEs that begin and commit a batch write */
+#define ZMS_BATCH_BEGIN  0x5a4d5342 /* "BSMZ" */
+#define ZMS_BATCH_COMMIT 0x5a4d5343 /* "CSMZ" */
+
 /**
  * @ingroup zms_data_structures
  * ZMS Allocation Table Entry (ATE) structure
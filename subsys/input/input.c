@@ -18,15 +18,147 @@ K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 
 #endif
 
+static bool input_callback_match(const struct input_callback *callback,
+				 const struct input_event *evt)
+{
+	if (callback->dev != NULL && callback->dev != evt->dev) {
+		return false;
+	}
+
+	return callback->types == 0U || (callback->types & INPUT_EV_BIT(evt->type)) != 0U;
+}
+
 static void input_process(struct input_event *evt)
 {
 	STRUCT_SECTION_FOREACH(input_callback, callback) {
-		if (callback->dev == NULL || callback->dev == evt->dev) {
+		if (input_callback_match(callback, evt)) {
 			callback->callback(evt, callback->user_data);
 		}
 	}
 }
 
+#ifdef CONFIG_INPUT_COALESCE
+
+struct input_frame {
+	const struct device *dev;
+	struct input_event evts[CONFIG_INPUT_COALESCE_MAX_EVENTS];
+	uint8_t len;
+	/* Sync flag of the last event added to the frame */
+	bool sync;
+	/* Only absolute and relative events, may be merged with the next frame */
+	bool motion_only;
+};
+
+static struct input_frame frame = {
+	.motion_only = true,
+};
+
+static bool input_is_motion(const struct input_event *evt)
+{
+	return evt->type == INPUT_EV_ABS || evt->type == INPUT_EV_REL;
+}
+
+/* Add an event to the frame, returns false if the frame is full */
+static bool input_frame_add(struct input_frame *f, const struct input_event *evt)
+{
+	if (input_is_motion(evt)) {
+		for (uint8_t i = 0; i < f->len; i++) {
+			struct input_event *prev = &f->evts[i];
+
+			if (prev->type != evt->type || prev->code != evt->code) {
+				continue;
+			}
+
+			if (evt->type == INPUT_EV_REL) {
+				prev->value += evt->value;
+			} else {
+				prev->value = evt->value;
+			}
+
+			return true;
+		}
+	}
+
+	if (f->len == ARRAY_SIZE(f->evts)) {
+		return false;
+	}
+
+	if (!input_is_motion(evt)) {
+		f->motion_only = false;
+	}
+
+	f->dev = evt->dev;
+	f->evts[f->len] = *evt;
+	f->evts[f->len].sync = 0;
+	f->len++;
+
+	return true;
+}
+
+/*
+ * Pass the frame to each callback at once, the last event that a callback
+ * receives carries the sync flag of the frame.
+ */
+static void input_frame_flush(struct input_frame *f)
+{
+	STRUCT_SECTION_FOREACH(input_callback, callback) {
+		int last = -1;
+
+		for (int i = 0; i < f->len; i++) {
+			if (input_callback_match(callback, &f->evts[i])) {
+				last = i;
+			}
+		}
+
+		for (int i = 0; i <= last; i++) {
+			struct input_event evt = f->evts[i];
+
+			if (!input_callback_match(callback, &evt)) {
+				continue;
+			}
+
+			evt.sync = f->sync && i == last;
+			callback->callback(&evt, callback->user_data);
+		}
+	}
+
+	f->len = 0;
+	f->sync = false;
+	f->motion_only = true;
+}
+
+static void input_coalesce(const struct input_event *evt)
+{
+	struct input_event next;
+
+	if (frame.len > 0 && frame.dev != evt->dev) {
+		/* Events of another device were interleaved, pass the frame as is */
+		input_frame_flush(&frame);
+	}
+
+	if (!input_frame_add(&frame, evt)) {
+		input_frame_flush(&frame);
+		input_frame_add(&frame, evt);
+	}
+
+	frame.sync = evt->sync;
+
+	if (evt->sync) {
+		/* The next frame of the device is already queued, merge it */
+		if (frame.motion_only && k_msgq_peek(&input_msgq, &next) == 0 &&
+		    next.dev == frame.dev && input_is_motion(&next)) {
+			return;
+		}
+
+		input_frame_flush(&frame);
+	} else if (k_msgq_num_used_get(&input_msgq) == 0) {
+		/* Do not hold the events of devices that report without a sync */
+		input_frame_flush(&frame);
+	}
+}
+
+#endif /* CONFIG_INPUT_COALESCE */
+
 bool input_queue_empty(void)
 {
 #ifdef CONFIG_INPUT_MODE_THREAD
@@ -89,7 +221,11 @@ static void input_thread(void *p1, void *p2, void *p3)
 			continue;
 		}
 
+#ifdef CONFIG_INPUT_COALESCE
+		input_coalesce(&evt);
+#else
 		input_process(&evt);
+#endif
 	}
 }
 
@@ -149,6 +149,83 @@ static int initialize_tx_with_sid_disabled(struct icmsg_data_t *dev_data)
 	return 0;
 }
 
+static bool remote_session_valid(struct icmsg_data_t *dev_data, atomic_t state)
+{
+	if (state == ICMSG_STATE_CONNECTED_SID_ENABLED &&
+	    (UNBOUND_ENABLED || UNBOUND_DETECT)) {
+		/* The incoming message is valid only if remote session is as expected,
+		 * so we need to check remote session now.
+		 */
+		uint32_t remote_sid_req = REMOTE_SID_REQ_FROM_TX(
+			pbuf_handshake_read(dev_data->tx_pb));
+
+		if (remote_sid_req != dev_data->remote_sid) {
+			atomic_set(&dev_data->state, ICMSG_STATE_DISCONNECTED);
+			if (dev_data->cb->unbound) {
+				dev_data->cb->unbound(dev_data->ctx);
+			}
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+static void rx_inplace_release(struct icmsg_data_t *dev_data)
+{
+	(void)pbuf_read_inplace_release(dev_data->rx_pb, dev_data->rx_inplace_len);
+	dev_data->rx_inplace = NULL;
+	dev_data->rx_inplace_len = 0;
+}
+
+/* Returns -EFBIG when the message must be copied because it wraps around the end of
+ * the RX buffer, 0 otherwise with rerun set if more messages are available.
+ */
+static int callback_process_inplace(struct icmsg_data_t *dev_data, atomic_t state, bool *rerun)
+{
+	volatile char *buf;
+	uint16_t len;
+	int ret;
+
+	*rerun = false;
+
+	if (dev_data->rx_inplace != NULL) {
+		if (atomic_get(&dev_data->rx_hold)) {
+			/* Receiving resumes when the held message is released. */
+			return 0;
+		}
+
+		rx_inplace_release(dev_data);
+	}
+
+	ret = pbuf_read_inplace(dev_data->rx_pb, &buf, &len);
+	if (ret == -EFBIG) {
+		return ret;
+	}
+
+	if (!remote_session_valid(dev_data, state) || ret <= 0) {
+		return 0;
+	}
+
+	dev_data->rx_inplace = buf;
+	dev_data->rx_inplace_len = len;
+
+	if (dev_data->cb->received) {
+		dev_data->cb->received((const void *)buf, len, dev_data->ctx);
+	}
+
+	if (atomic_get(&dev_data->rx_hold)) {
+		return 0;
+	}
+
+	rx_inplace_release(dev_data);
+	*rerun = (data_available(dev_data) > 0);
+
+	return 0;
+}
+#endif /* CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX */
+
 static bool callback_process(struct icmsg_data_t *dev_data)
 {
 	int ret;
@@ -256,27 +333,22 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 	case ICMSG_STATE_INITIALIZING_SID_DISABLED:
 #endif
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+		if (state != ICMSG_STATE_INITIALIZING_SID_DISABLED || !UNBOUND_DISABLED) {
+			if (callback_process_inplace(dev_data, state, &rerun) != -EFBIG) {
+				return rerun;
+			}
+		}
+#endif
+
 		len_available = data_available(dev_data);
 
 		if (len_available > 0 && sizeof(rx_buffer) >= len_available) {
 			len = pbuf_read(dev_data->rx_pb, rx_buffer, sizeof(rx_buffer));
 		}
 
-		if (state == ICMSG_STATE_CONNECTED_SID_ENABLED &&
-		    (UNBOUND_ENABLED || UNBOUND_DETECT)) {
-			/* The incoming message is valid only if remote session is as expected,
-			 * so we need to check remote session now.
-			 */
-			uint32_t remote_sid_req = REMOTE_SID_REQ_FROM_TX(
-				pbuf_handshake_read(dev_data->tx_pb));
-
-			if (remote_sid_req != dev_data->remote_sid) {
-				atomic_set(&dev_data->state, ICMSG_STATE_DISCONNECTED);
-				if (dev_data->cb->unbound) {
-					dev_data->cb->unbound(dev_data->ctx);
-				}
-				return false;
-			}
+		if (!remote_session_valid(dev_data, state)) {
+			return false;
 		}
 
 		if (len_available == 0) {
@@ -412,6 +484,12 @@ int icmsg_open(const struct icmsg_config_t *conf,
 	k_mutex_init(&dev_data->tx_lock);
 #endif
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	dev_data->rx_inplace = NULL;
+	dev_data->rx_inplace_len = 0;
+	atomic_clear(&dev_data->rx_hold);
+#endif
+
 	ret = pbuf_rx_init(dev_data->rx_pb);
 
 	if (ret < 0) {
@@ -539,6 +617,124 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	return sent_bytes;
 }
 
+int icmsg_send_batch(const struct icmsg_config_t *conf,
+		     struct icmsg_data_t *dev_data,
+		     const struct ipc_service_msg *msgs, size_t count)
+{
+	int ret;
+	int write_ret = 0;
+	int release_ret;
+	size_t sent = 0;
+	uint32_t state = atomic_get(&dev_data->state);
+
+	if (!is_endpoint_ready(state)) {
+		/* If instance was disconnected on the remote side, some threads may still
+		 * don't know it yet and still may try to send messages.
+		 */
+		return (state == ICMSG_STATE_DISCONNECTED) ? count : -EBUSY;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		/* Empty message is not allowed */
+		if (msgs[i].len == 0) {
+			return -ENODATA;
+		}
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	ret = reserve_tx_buffer_if_unused(dev_data);
+	if (ret < 0) {
+		return -ENOBUFS;
+	}
+
+	for (; sent < count; sent++) {
+		write_ret = pbuf_write_defer(dev_data->tx_pb, msgs[sent].data, msgs[sent].len);
+		if (write_ret < (int)msgs[sent].len) {
+			break;
+		}
+	}
+
+	if (sent > 0) {
+		/* Make all the written messages visible to the remote at once. */
+		pbuf_write_commit(dev_data->tx_pb);
+	}
+
+	release_ret = release_tx_buffer(dev_data);
+	__ASSERT_NO_MSG(!release_ret);
+
+	if (sent == 0) {
+		return (write_ret < 0) ? write_ret : -EBADMSG;
+	}
+
+	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
+
+	ret = mbox_send_dt(&conf->mbox_tx, NULL);
+	if (ret) {
+		return ret;
+	}
+
+	return sent;
+}
+
+int icmsg_hold_rx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data, const void *data)
+{
+	ARG_UNUSED(conf);
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	/* Only called from the received callback, rx_inplace cannot change meanwhile. */
+	if (data == NULL || (const void *)dev_data->rx_inplace != data) {
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&dev_data->rx_hold, 0, 1)) {
+		return -EALREADY;
+	}
+
+	return 0;
+#else
+	ARG_UNUSED(dev_data);
+	ARG_UNUSED(data);
+
+	return -ENOTSUP;
+#endif
+}
+
+int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_data_t *dev_data, const void *data)
+{
+	ARG_UNUSED(conf);
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	if (!atomic_get(&dev_data->rx_hold)) {
+		return -ENXIO;
+	}
+
+	if (data == NULL || (const void *)dev_data->rx_inplace != data) {
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&dev_data->rx_hold, 1, 0)) {
+		return -ENXIO;
+	}
+
+	/* The RX buffer is released when processing resumes, so it is only
+	 * ever advanced from the processing work.
+	 */
+	submit_mbox_work(dev_data);
+
+	return 0;
+#else
+	ARG_UNUSED(dev_data);
+	ARG_UNUSED(data);
+
+	return -ENOTSUP;
+#endif
+}
+
 #if defined(CONFIG_IPC_SERVICE_BACKEND_ICMSG_WQ_ENABLE)
 
 static int work_q_init(void)
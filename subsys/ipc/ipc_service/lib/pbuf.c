@@ -112,7 +112,7 @@ int pbuf_rx_init(struct pbuf *pb)
 	return 0;
 }
 
-int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
+int pbuf_write_defer(struct pbuf *pb, const char *data, uint16_t len)
 {
 	if (pb == NULL || len == 0 || data == NULL) {
 		/* Incorrect call. */
@@ -170,13 +170,29 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	}
 
 	wr_idx = idx_wrap(blen, ROUND_UP(wr_idx + len, _PBUF_IDX_SIZE));
-	/* Update wr_idx. */
+	/* Update local wr_idx only, the reader sees the packet once it is committed. */
 	pb->data.wr_idx = wr_idx;
-	*(pb->cfg->wr_idx_loc) = wr_idx;
+
+	return len;
+}
+
+void pbuf_write_commit(struct pbuf *pb)
+{
+	/* Update shared wr_idx. */
+	*(pb->cfg->wr_idx_loc) = pb->data.wr_idx;
 	__sync_synchronize();
 	sys_cache_data_flush_range((void *)pb->cfg->wr_idx_loc, sizeof(*(pb->cfg->wr_idx_loc)));
+}
 
-	return len;
+int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
+{
+	int ret = pbuf_write_defer(pb, data, len);
+
+	if (ret > 0) {
+		pbuf_write_commit(pb);
+	}
+
+	return ret;
 }
 
 int pbuf_get_initial_buf(struct pbuf *pb, volatile char **buf, uint16_t *len)
@@ -295,6 +311,76 @@ int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 	return len;
 }
 
+int pbuf_read_inplace(struct pbuf *pb, volatile char **buf, uint16_t *len)
+{
+	if (pb == NULL || buf == NULL || len == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	/* Invalidate wr_idx only, local rd_idx is used to increase buffer security. */
+	sys_cache_data_invd_range((void *)(pb->cfg->wr_idx_loc), sizeof(*(pb->cfg->wr_idx_loc)));
+	__sync_synchronize();
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = *(pb->cfg->wr_idx_loc);
+	uint32_t rd_idx = pb->data.rd_idx;
+
+	__ASSERT_NO_MSG(IS_PTR_ALIGNED_BYTES(rd_idx, _PBUF_IDX_SIZE));
+	if (!IS_PTR_ALIGNED_BYTES(wr_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	if (rd_idx == wr_idx) {
+		/* Buffer is empty. */
+		return 0;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], PBUF_PACKET_LEN_SZ);
+	uint16_t plen = sys_get_be16(&data_loc[rd_idx]);
+
+	if (idx_occupied(blen, wr_idx, rd_idx) < plen + PBUF_PACKET_LEN_SZ) {
+		/* This should never happen. */
+		return -EAGAIN;
+	}
+
+	rd_idx = idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ);
+
+	if (plen > blen - rd_idx) {
+		/* Wrapped around the end of the buffer, it must be copied. */
+		return -EFBIG;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], plen);
+	__sync_synchronize();
+
+	*buf = (volatile char *)&data_loc[rd_idx];
+	*len = plen;
+
+	return (int)plen;
+}
+
+int pbuf_read_inplace_release(struct pbuf *pb, uint16_t len)
+{
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	const uint32_t blen = pb->cfg->len;
+	uint32_t rd_idx = pb->data.rd_idx;
+
+	rd_idx = idx_wrap(blen, ROUND_UP(rd_idx + PBUF_PACKET_LEN_SZ + len, _PBUF_IDX_SIZE));
+
+	pb->data.rd_idx = rd_idx;
+	*(pb->cfg->rd_idx_loc) = rd_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->rd_idx_loc, sizeof(*(pb->cfg->rd_idx_loc)));
+
+	return 0;
+}
+
 uint32_t pbuf_handshake_read(struct pbuf *pb)
 {
 	volatile uint32_t *ptr = pb->cfg->handshake_loc;
@@ -72,6 +72,7 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 	elf_shdr_t *region = ldr->sects + mem_idx;
 	uintptr_t region_alloc = region->sh_size;
 	uintptr_t region_align = region->sh_addralign;
+	uintptr_t peek_align;
 
 	if (!region_alloc) {
 		return 0;
@@ -102,6 +103,17 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 		}
 	}
 
+	/*
+	 * Regions mapped in place, e.g. from memory-mapped flash, only need
+	 * the MMU/MPU alignment when memory permissions are applied to them.
+	 * Otherwise the alignment of the ELF sections is enough.
+	 */
+	if (IS_ENABLED(CONFIG_USERSPACE) || IS_ENABLED(CONFIG_MMU)) {
+		peek_align = region_align;
+	} else {
+		peek_align = region->sh_addralign;
+	}
+
 	if (ldr->storage == LLEXT_STORAGE_WRITABLE ||           /* writable storage         */
 	    (ldr->storage == LLEXT_STORAGE_PERSISTENT &&        /* || persistent storage    */
 	     !(region->sh_flags & SHF_WRITE) &&                 /*    && read-only region   */
@@ -115,7 +127,7 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 			/* Region has data in the file, check if peek() is supported */
 			ext->mem[mem_idx] = llext_peek(ldr, region->sh_offset);
 			if (ext->mem[mem_idx]) {
-				if (IS_ALIGNED(ext->mem[mem_idx], region_align) ||
+				if (IS_ALIGNED(ext->mem[mem_idx], peek_align) ||
 				    ldr_parm->pre_located) {
 					/* Map this region directly to the ELF buffer */
 					llext_init_mem_part(ext, mem_idx,
@@ -126,7 +138,7 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 				}
 
 				LOG_WRN("Cannot peek region %d: %p not aligned to %#zx",
-					mem_idx, ext->mem[mem_idx], (size_t)region_align);
+					mem_idx, ext->mem[mem_idx], (size_t)peek_align);
 			}
 		} else if (ldr_parm->pre_located) {
 			/*
@@ -140,6 +152,13 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 		}
 	}
 
+	if (ldr->storage == LLEXT_STORAGE_PERSISTENT && (region->sh_flags & SHF_ALLOC)) {
+		LOG_DBG("Region %d copied: %s", mem_idx,
+			(region->sh_flags & SHF_WRITE) ? "writable" :
+			(region->sh_flags & SHF_LLEXT_HAS_RELOCS) ? "has relocations" :
+			"cannot be peeked");
+	}
+
 	if (ldr_parm->pre_located) {
 		/*
 		 * The ELF file is supposed to be pre-located, but some
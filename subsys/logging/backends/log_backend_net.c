@@ -43,18 +43,27 @@ static struct log_backend_net_ctx {
 	.sock = -1,
 };
 
-static int line_out(uint8_t *data, size_t length, void *output_ctx)
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+/* Messages of a batch are gathered here and sent at once, as a single write
+ * over TCP or as one datagram per message (RFC 5426) with one call over UDP.
+ */
+static struct log_backend_net_batch {
+	uint8_t buf[CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE];
+	struct iovec io_vector[CONFIG_LOG_PROCESS_BATCH_SIZE];
+	struct mmsghdr msgs[CONFIG_LOG_PROCESS_BATCH_SIZE];
+	size_t len;
+	int cnt;
+	bool active;
+} batch;
+#endif
+
+static int line_send(struct log_backend_net_ctx *ctx, uint8_t *data, size_t length)
 {
-	struct log_backend_net_ctx *ctx = (struct log_backend_net_ctx *)output_ctx;
 	int ret = -ENOMEM;
 	struct msghdr msg = { 0 };
 	struct iovec io_vector[2];
 	int pos = 0;
 
-	if (ctx == NULL) {
-		return length;
-	}
-
 #if defined(CONFIG_NET_TCP)
 	char len[sizeof("123456789")];
 
@@ -87,6 +96,85 @@ fail:
 	return length;
 }
 
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+static void batch_send(struct log_backend_net_ctx *ctx)
+{
+	int ret;
+
+	if (batch.cnt == 0) {
+		return;
+	}
+
+	if (ctx->is_tcp) {
+		ret = zsock_send(ctx->sock, batch.buf, batch.len, 0);
+	} else {
+		for (int i = 0; i < batch.cnt; i++) {
+			batch.msgs[i].msg_hdr = (struct msghdr){
+				.msg_iov = &batch.io_vector[i],
+				.msg_iovlen = 1,
+			};
+		}
+
+		ret = zsock_sendmmsg(ctx->sock, batch.msgs, batch.cnt, ZSOCK_MSG_DONTWAIT);
+	}
+
+	if (ret < 0) {
+		DBG("Cannot send %d messages (%d)\n", batch.cnt, -errno);
+	}
+
+	batch.len = 0;
+	batch.cnt = 0;
+}
+
+static int batch_add(struct log_backend_net_ctx *ctx, uint8_t *data, size_t length)
+{
+	char len[sizeof("123456789")];
+	size_t len_size = 0;
+
+	if (IS_ENABLED(CONFIG_NET_TCP) && ctx->is_tcp) {
+		/* Octet counting framing of RFC 6587 */
+		(void)snprintk(len, sizeof(len), "%zu ", length);
+		len_size = strlen(len);
+	}
+
+	if (batch.cnt == ARRAY_SIZE(batch.io_vector) ||
+	    batch.len + len_size + length > sizeof(batch.buf)) {
+		batch_send(ctx);
+	}
+
+	if (len_size + length > sizeof(batch.buf)) {
+		return line_send(ctx, data, length);
+	}
+
+	memcpy(&batch.buf[batch.len], len, len_size);
+	memcpy(&batch.buf[batch.len + len_size], data, length);
+
+	batch.io_vector[batch.cnt].iov_base = &batch.buf[batch.len];
+	batch.io_vector[batch.cnt].iov_len = len_size + length;
+	batch.len += len_size + length;
+	batch.cnt++;
+
+	return length;
+}
+#endif
+
+static int line_out(uint8_t *data, size_t length, void *output_ctx)
+{
+	struct log_backend_net_ctx *ctx = (struct log_backend_net_ctx *)output_ctx;
+
+	if (ctx == NULL) {
+		return length;
+	}
+
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+	if (batch.active) {
+		return batch_add(ctx, data, length);
+	}
+#endif
+
+	return line_send(ctx, data, length);
+}
+
 LOG_OUTPUT_DEFINE(log_output_net, line_out, output_buf, sizeof(output_buf));
 
 static int do_net_init(struct log_backend_net_ctx *ctx)
@@ -217,6 +305,21 @@ static void process(const struct log_backend *const backend,
 	log_output_func(&log_output_net, &msg->log, flags);
 }
 
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+static void process_batch(const struct log_backend *const backend,
+			  union log_msg_generic **msgs, size_t cnt)
+{
+	batch.active = true;
+
+	for (size_t i = 0; i < cnt; i++) {
+		process(backend, msgs[i]);
+	}
+
+	batch.active = false;
+	batch_send(&ctx);
+}
+#endif
+
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
 	log_format_current = log_type;
@@ -352,6 +455,9 @@ const struct log_backend_api log_backend_net_api = {
 	.init = init_net,
 	.is_ready = backend_ready,
 	.process = process,
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+	.process_batch = process_batch,
+#endif
 	.format_set = format_set,
 };
 
@@ -58,6 +58,10 @@ LOG_MODULE_REGISTER(log);
 #define CONFIG_LOG_BUFFER_SIZE 4
 #endif
 
+#ifndef CONFIG_LOG_PROCESS_BATCH_SIZE
+#define CONFIG_LOG_PROCESS_BATCH_SIZE 1
+#endif
+
 #ifdef CONFIG_LOG_PROCESS_THREAD_CUSTOM_PRIORITY
 #define LOG_PROCESS_THREAD_PRIORITY CONFIG_LOG_PROCESS_THREAD_PRIORITY
 #else
@@ -144,6 +148,17 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+/* CPU 0 uses log_buffer, the other CPUs have a buffer of the same size
+ * each, so that they do not contend for the lock of a single buffer.
+ */
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	cpu_buf32[CONFIG_MP_MAX_NUM_CPUS - 1][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+static struct mpsc_pbuf_buffer cpu_log_buffer[CONFIG_MP_MAX_NUM_CPUS - 1];
+/* Oldest message claimed from each buffer, not processed yet */
+static union log_msg_generic *cpu_msg[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -153,6 +168,7 @@ static char tag[CONFIG_LOG_TAG_MAX_LEN + 1] =
 	COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, ({}), (CONFIG_LOG_TAG_DEFAULT));
 
 static void msg_process(union log_msg_generic *msg);
+static void msg_free(struct mpsc_pbuf_buffer *buffer, const union log_msg_generic *msg);
 
 static log_timestamp_t dummy_timestamp(void)
 {
@@ -519,6 +535,65 @@ static void msg_process(union log_msg_generic *msg)
 	}
 }
 
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+static void msg_batch_process(union log_msg_generic **msgs, size_t cnt)
+{
+	union log_msg_generic *filtered[CONFIG_LOG_PROCESS_BATCH_SIZE];
+
+	STRUCT_SECTION_FOREACH(log_backend, backend) {
+		size_t n = 0;
+
+		if (!log_backend_is_active(backend)) {
+			continue;
+		}
+
+		for (size_t i = 0; i < cnt; i++) {
+			if (msg_filter_check(backend, msgs[i])) {
+				filtered[n++] = msgs[i];
+			}
+		}
+
+		if (n > 0) {
+			log_backend_msg_batch_process(backend, filtered, n);
+		}
+	}
+}
+
+/* Claim up to CONFIG_LOG_PROCESS_BATCH_SIZE messages and process them at
+ * once. Messages are freed in the order they were claimed, each to the
+ * buffer it was claimed from.
+ */
+static bool msg_batch_claim_process(k_timeout_t *backoff)
+{
+	union log_msg_generic *msgs[CONFIG_LOG_PROCESS_BATCH_SIZE];
+	struct mpsc_pbuf_buffer *buffers[CONFIG_LOG_PROCESS_BATCH_SIZE];
+	size_t cnt = 0;
+
+	while (cnt < ARRAY_SIZE(msgs)) {
+		msgs[cnt] = z_log_msg_claim(backoff);
+		if (msgs[cnt] == NULL) {
+			break;
+		}
+
+		buffers[cnt++] = curr_log_buffer;
+	}
+
+	if (cnt == 0) {
+		return false;
+	}
+
+	msg_batch_process(msgs, cnt);
+
+	for (size_t i = 0; i < cnt; i++) {
+		msg_free(buffers[i], msgs[i]);
+	}
+
+	atomic_sub(&buffered_cnt, cnt);
+
+	return true;
+}
+#endif /* CONFIG_LOG_PROCESS_BATCH_SIZE > 1 */
+
 void dropped_notify(void)
 {
 	uint32_t dropped = z_log_dropped_read_and_clear();
@@ -561,19 +636,28 @@ bool z_impl_log_process(void)
 	}
 
 	k_timeout_t backoff = K_NO_WAIT;
-	union log_msg_generic *msg;
+	bool processed;
 
 	if (!backend_attached) {
 		return false;
 	}
 
-	msg = z_log_msg_claim(&backoff);
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+	processed = msg_batch_claim_process(&backoff);
+#else
+	union log_msg_generic *msg = z_log_msg_claim(&backoff);
 
 	if (msg) {
 		msg_process(msg);
 		z_log_msg_free(msg);
 		atomic_dec(&buffered_cnt);
-	} else if (CONFIG_LOG_PROCESSING_LATENCY_US > 0 && !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
+	}
+
+	processed = (msg != NULL);
+#endif
+
+	if (!processed && CONFIG_LOG_PROCESSING_LATENCY_US > 0 &&
+	    !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
 		/* If backoff is requested, it means that there are pending
 		 * messages but they are too new and processing shall back off
 		 * to allow arrival of newer messages from remote domains.
@@ -654,7 +738,37 @@ void z_log_msg_init(void)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+	for (int i = 0; i < ARRAY_SIZE(cpu_log_buffer); i++) {
+		config.buf = cpu_buf32[i];
+		mpsc_pbuf_init(&cpu_log_buffer[i], &config);
+	}
+#endif
+}
+
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+static struct mpsc_pbuf_buffer *cpu_buffer_get(unsigned int cpu)
+{
+	return cpu == 0 ? &log_buffer : &cpu_log_buffer[cpu - 1];
+}
+
+/* Buffer a message has been allocated from, the thread may have moved to
+ * another CPU since.
+ */
+static struct mpsc_pbuf_buffer *msg_buffer_get(const struct log_msg *msg)
+{
+	for (int i = 0; i < ARRAY_SIZE(cpu_log_buffer); i++) {
+		if ((const uint32_t *)msg >= cpu_buf32[i] &&
+		    (const uint32_t *)msg < cpu_buf32[i] + ARRAY_SIZE(cpu_buf32[i])) {
+			return &cpu_log_buffer[i];
+		}
+	}
+
+	return &log_buffer;
 }
+#endif
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 {
@@ -671,7 +785,14 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	/* Not having interrupts locked, the thread may move to another CPU
+	 * right after. It then merely shares the buffer of that CPU.
+	 */
+	return msg_alloc(cpu_buffer_get(arch_curr_cpu()->id), wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -703,7 +824,11 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	msg_commit(msg_buffer_get(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -783,10 +908,57 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 	return msg;
 }
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+/* Claim the oldest message of the buffers of all CPUs. Messages with the
+ * same timestamp are processed in no particular order.
+ */
+static union log_msg_generic *z_log_msg_claim_per_cpu(void)
+{
+	union log_msg_generic *msg = NULL;
+	log_timestamp_t t_min = 0;
+	int chosen = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(cpu_msg); i++) {
+		log_timestamp_t t;
+
+		if (cpu_msg[i] == NULL) {
+			cpu_msg[i] = (union log_msg_generic *)mpsc_pbuf_claim(cpu_buffer_get(i));
+			if (cpu_msg[i] == NULL) {
+				continue;
+			}
+		}
+
+		t = log_msg_get_timestamp(&cpu_msg[i]->log);
+
+		/* Compared as a difference to cope with 32 bit timestamps wrapping */
+		if (msg == NULL ||
+		    (sizeof(log_timestamp_t) > sizeof(uint32_t) ? t < t_min :
+		     (int32_t)(t - t_min) < 0)) {
+			t_min = t;
+			msg = cpu_msg[i];
+			chosen = i;
+		}
+	}
+
+	if (msg != NULL) {
+		cpu_msg[chosen] = NULL;
+		curr_log_buffer = cpu_buffer_get(chosen);
+	}
+
+	return msg;
+}
+#endif
+
 union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 {
 	size_t len;
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	ARG_UNUSED(backoff);
+
+	return z_log_msg_claim_per_cpu();
+#endif
+
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
@@ -823,6 +995,16 @@ bool z_log_msg_pending(void)
 	size_t len;
 	int i = 0;
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	for (int i = 0; i < ARRAY_SIZE(cpu_msg); i++) {
+		if (cpu_msg[i] != NULL || msg_pending(cpu_buffer_get(i))) {
+			return true;
+		}
+	}
+
+	return false;
+#endif
+
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
@@ -907,6 +1089,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 
 	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	for (int i = 0; i < ARRAY_SIZE(cpu_log_buffer); i++) {
+		uint32_t cpu_size;
+		uint32_t cpu_usage;
+
+		mpsc_pbuf_get_utilization(&cpu_log_buffer[i], &cpu_size, &cpu_usage);
+		*buf_size += cpu_size;
+		*usage += cpu_usage;
+	}
+#endif
+
 	return 0;
 }
 
@@ -918,7 +1111,22 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	uint32_t cpu_max;
+	int err;
+
+	/* Sum of the maximums of each buffer, not reached at once */
+	err = mpsc_pbuf_get_max_utilization(&log_buffer, max);
+
+	for (int i = 0; err == 0 && i < ARRAY_SIZE(cpu_log_buffer); i++) {
+		err = mpsc_pbuf_get_max_utilization(&cpu_log_buffer[i], &cpu_max);
+		*max += cpu_max;
+	}
+
+	return err;
+#else
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+#endif
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
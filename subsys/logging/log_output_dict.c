@@ -10,7 +10,91 @@
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
+
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT)
+/* Longest encoding of a 64 bit integer */
+#define VARINT_MAX_LEN 10
+
+static size_t varint_encode(uint8_t *buf, uint64_t val)
+{
+	size_t len = 0;
+
+	while (val >= 0x80) {
+		buf[len++] = (uint8_t)val | 0x80;
+		val >>= 7;
+	}
+
+	buf[len++] = (uint8_t)val;
+
+	return len;
+}
+
+static void compact_msg_process(const struct log_output *output, struct log_msg *msg)
+{
+	struct log_output_control_block *control_block = output->control_block;
+	void *source = (void *)log_msg_get_source(msg);
+	log_timestamp_t timestamp = msg->hdr.timestamp;
+	uint8_t buf[8 * VARINT_MAX_LEN];
+	size_t words = 0;
+	size_t pkg_len;
+	size_t data_len;
+	uint8_t *pkg;
+	uint8_t *data;
+	int64_t delta;
+	size_t len = 0;
+
+	pkg = log_msg_get_package(msg, &pkg_len);
+	data = log_msg_get_data(msg, &data_len);
+
+	/* Signed, as messages of several domains may come out of order */
+	delta = sizeof(log_timestamp_t) > sizeof(uint32_t) ?
+		(int64_t)(timestamp - control_block->dict_timestamp) :
+		(int32_t)(timestamp - control_block->dict_timestamp);
+	control_block->dict_timestamp = timestamp;
+
+	if (pkg_len > 0U) {
+		words = MIN(((union cbprintf_package_hdr *)pkg)->desc.len,
+			    pkg_len / sizeof(uint32_t));
+	}
+
+	buf[len++] = MSG_NORMAL_COMPACT;
+	buf[len++] = msg->hdr.desc.domain | (msg->hdr.desc.level << 4);
+	len += varint_encode(&buf[len], (source != NULL) ? log_source_id(source) : 0U);
+	len += varint_encode(&buf[len], ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+	len += varint_encode(&buf[len], pkg_len);
+	len += varint_encode(&buf[len], data_len);
+
+	/* Arguments are mostly small integers or zero padding */
+	for (size_t i = 0; i < words; i++) {
+		uint32_t word;
+
+		if (len > sizeof(buf) - VARINT_MAX_LEN) {
+			log_output_write(output->func, buf, len, control_block->ctx);
+			len = 0;
+		}
+
+		memcpy(&word, &pkg[i * sizeof(word)], sizeof(word));
+		len += varint_encode(&buf[len], word);
+	}
+
+	log_output_write(output->func, buf, len, control_block->ctx);
+
+	/* String indexes and appended strings */
+	if (pkg_len > words * sizeof(uint32_t)) {
+		log_output_write(output->func, &pkg[words * sizeof(uint32_t)],
+				 pkg_len - words * sizeof(uint32_t), control_block->ctx);
+	}
+
+	if (data_len > 0U) {
+		log_output_write(output->func, data, data_len, control_block->ctx);
+	}
+
+	log_output_flush(output);
+}
+#endif /* CONFIG_LOG_DICTIONARY_COMPACT */
 
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
@@ -18,6 +102,11 @@ void log_dict_output_msg_process(const struct log_output *output,
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
 
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT)
+	compact_msg_process(output, msg);
+	return;
+#endif
+
 	/* Keep sync with header in struct log_msg */
 	output_hdr.type = MSG_NORMAL;
 	output_hdr.domain = msg->hdr.desc.domain;
@@ -72,6 +72,9 @@ LOG_MODULE_REGISTER(mcumgr_fs_grp, CONFIG_MCUMGR_GRP_FS_LOG_LEVEL);
 #define FILE_SEMAPHORE_MAX_TAKE_TIME_WORK_HANDLER K_MSEC(500)
 #define FILE_CLOSE_IDLE_TIME K_MSEC(CONFIG_MCUMGR_GRP_FS_FILE_AUTOMATIC_IDLE_CLOSE_TIME)
 
+/* Longest CBOR header of a byte string shorter than 4 GiB */
+#define BSTR_HDR_MAX_LEN 5
+
 enum {
 	STATE_NO_UPLOAD_OR_DOWNLOAD = 0,
 	STATE_UPLOAD,
@@ -228,17 +231,33 @@ static void fs_mgmt_upload_download_finish_check(void)
 	}
 }
 
+/* Length of the CBOR header of a byte string of len bytes */
+static size_t bstr_hdr_len(size_t len)
+{
+	if (len < 24) {
+		return 1;
+	} else if (len <= UINT8_MAX) {
+		return 2;
+	} else if (len <= UINT16_MAX) {
+		return 3;
+	}
+
+	return BSTR_HDR_MAX_LEN;
+}
+
 /**
  * Command handler: fs file (read)
  */
 static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 {
-	uint8_t file_data[MCUMGR_GRP_FS_DL_CHUNK_SIZE];
+	uint8_t *file_data;
 	char path[CONFIG_MCUMGR_GRP_FS_PATH_LEN + 1];
 	uint64_t off = ULLONG_MAX;
 	ssize_t bytes_read = 0;
+	size_t read_size;
 	int rc;
 	zcbor_state_t *zse = ctxt->writer->zs;
+	zcbor_state_t zse_start;
 	zcbor_state_t *zsd = ctxt->reader->zs;
 	bool ok;
 	struct zcbor_string name = { 0 };
@@ -346,10 +365,29 @@ static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 	 * length.
 	 */
 
-	/* Read the requested chunk from the file. */
-	bytes_read = fs_read(&fs_mgmt_ctxt.file, file_data, MCUMGR_GRP_FS_DL_CHUNK_SIZE);
+	zse_start = *zse;
+
+	ok = fs_mgmt_file_rsp(zse, MGMT_ERR_EOK, off)				&&
+	     zcbor_tstr_put_lit(zse, "data")					&&
+	     (zse->payload_end - zse->payload) > BSTR_HDR_MAX_LEN;
+
+	if (!ok) {
+		goto end;
+	}
+
+	/* Read the requested chunk from the file straight into the response buffer, where
+	 * it will be once the byte string header is encoded in front of it. zcbor moves the
+	 * data if the header of the actual length turns out to be shorter.
+	 */
+	read_size = MIN(MCUMGR_GRP_FS_DL_CHUNK_SIZE,
+			(size_t)(zse->payload_end - zse->payload) - BSTR_HDR_MAX_LEN);
+	file_data = zse->payload_mut + bstr_hdr_len(read_size);
+
+	bytes_read = fs_read(&fs_mgmt_ctxt.file, file_data, read_size);
 
 	if (bytes_read < 0) {
+		/* Drop the start of the response */
+		*zse = zse_start;
 		ok = smp_add_cmd_err(zse, MGMT_GROUP_ID_FS, FS_MGMT_ERR_FILE_READ_FAILED);
 		fs_mgmt_cleanup();
 		goto end;
@@ -358,10 +396,8 @@ static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 	/* Increment offset */
 	fs_mgmt_ctxt.off += bytes_read;
 
-	/* Encode the response. */
-	ok = fs_mgmt_file_rsp(zse, MGMT_ERR_EOK, off)				&&
-	     zcbor_tstr_put_lit(zse, "data")					&&
-	     zcbor_bstr_encode_ptr(zse, file_data, bytes_read)			&&
+	/* Encode the rest of the response. */
+	ok = zcbor_bstr_encode_ptr(zse, file_data, bytes_read)			&&
 	     ((off != 0)							||
 		(zcbor_tstr_put_lit(zse, "len") && zcbor_uint64_put(zse, fs_mgmt_ctxt.len)));
 
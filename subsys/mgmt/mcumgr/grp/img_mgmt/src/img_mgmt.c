@@ -97,6 +97,17 @@ LOG_MODULE_REGISTER(mcumgr_img_grp, CONFIG_MCUMGR_GRP_IMG_LOG_LEVEL);
 
 struct img_mgmt_state g_img_mgmt_state;
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/* Upload chunk received ahead of the expected offset, unused if len is 0 */
+struct img_mgmt_upload_chunk {
+	size_t off;
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE];
+};
+
+static struct img_mgmt_upload_chunk upload_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW];
+#endif
+
 #ifdef CONFIG_MCUMGR_GRP_IMG_MUTEX
 static K_MUTEX_DEFINE(img_mgmt_mutex);
 #endif
@@ -407,9 +418,123 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	memset(upload_window, 0, sizeof(upload_window));
+#endif
 	img_mgmt_release_lock();
 }
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
+/**
+ * Notifies the application that a chunk, other than the last one of the image,
+ * has been written.
+ */
+static void img_mgmt_upload_notify_write_complete(void)
+{
+	int32_t err_rc;
+	uint16_t err_group;
+
+	(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK_WRITE_COMPLETE, NULL, 0,
+				   &err_rc, &err_group);
+}
+#endif
+
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/**
+ * Finds where to keep a chunk received ahead of the expected offset until the
+ * data before it arrives.
+ *
+ * @return The chunk to store the data in, NULL if the chunk cannot be kept, the
+ *	   client then has to send it again.
+ */
+static struct img_mgmt_upload_chunk *
+img_mgmt_upload_window_slot(const struct img_mgmt_upload_req *req)
+{
+	struct img_mgmt_upload_chunk *free_chunk = NULL;
+
+	if (g_img_mgmt_state.area_id == -1 || req->off <= g_img_mgmt_state.off ||
+	    req->img_data.len == 0 || req->img_data.len > sizeof(upload_window[0].data) ||
+	    req->off + req->img_data.len > g_img_mgmt_state.size) {
+		return NULL;
+	}
+
+	ARRAY_FOR_EACH_PTR(upload_window, chunk) {
+		if (chunk->len != 0 && chunk->off < g_img_mgmt_state.off) {
+			/* Stale, the data was sent again in order */
+			chunk->len = 0;
+		}
+
+		if (chunk->len != 0 && chunk->off == req->off) {
+			free_chunk = chunk;
+			break;
+		}
+
+		if (chunk->len == 0 && free_chunk == NULL) {
+			free_chunk = chunk;
+		}
+	}
+
+	if (free_chunk == NULL) {
+		LOG_DBG("Upload window full, dropping offset %zu", req->off);
+	}
+
+	return free_chunk;
+}
+
+/**
+ * Keeps a chunk in the slot returned by img_mgmt_upload_window_slot().
+ */
+static void img_mgmt_upload_window_put(struct img_mgmt_upload_chunk *chunk,
+				       const struct img_mgmt_upload_req *req)
+{
+	chunk->off = req->off;
+	chunk->len = req->img_data.len;
+	memcpy(chunk->data, req->img_data.value, req->img_data.len);
+}
+
+/**
+ * Writes the kept chunks that continue the data written so far.
+ *
+ * @param last	Set to true if the last chunk of the image was written.
+ *
+ * @return 0 on success, negative error code from writing the data otherwise.
+ */
+static int img_mgmt_upload_window_flush(bool *last)
+{
+	bool found;
+	int rc;
+
+	do {
+		found = false;
+
+		ARRAY_FOR_EACH_PTR(upload_window, chunk) {
+			if (chunk->len == 0 || chunk->off != g_img_mgmt_state.off) {
+				continue;
+			}
+
+			*last = (chunk->off + chunk->len == g_img_mgmt_state.size);
+			rc = img_mgmt_write_image_data(chunk->off, chunk->data, chunk->len,
+						       *last);
+			if (rc != 0) {
+				return rc;
+			}
+
+			g_img_mgmt_state.off += chunk->len;
+			chunk->len = 0;
+			found = true;
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
+			if (!*last) {
+				img_mgmt_upload_notify_write_complete();
+			}
+#endif
+		}
+	} while (found && !*last);
+
+	return 0;
+}
+#endif
+
 /**
  * Command handler: image erase
  */
@@ -742,6 +867,10 @@ img_mgmt_upload(struct smp_streamer *ctxt)
 	bool data_match = false;
 #endif
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	struct img_mgmt_upload_chunk *window_chunk = NULL;
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_CHECK_HOOK)
 	enum mgmt_cb_return status;
 #endif
@@ -801,7 +930,19 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		goto end;
 	}
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
 	if (!action.proceed) {
+		/* Chunk ahead of the expected offset, kept if there is room for it */
+		window_chunk = img_mgmt_upload_window_slot(&req);
+		if (window_chunk != NULL) {
+			action.write_bytes = req.img_data.len;
+		}
+	}
+
+	if (!action.proceed && window_chunk == NULL) {
+#else
+	if (!action.proceed) {
+#endif
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
@@ -812,7 +953,8 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_CHECK_HOOK)
 	/* Request is valid.  Give the application a chance to reject this upload
-	 * request.
+	 * request, chunks received ahead of the expected offset are checked before
+	 * being kept.
 	 */
 	status = mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK, &upload_check_data,
 				      sizeof(upload_check_data), &err_rc, &err_group);
@@ -832,6 +974,16 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 	}
 #endif
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	if (window_chunk != NULL) {
+		/* Written, and notified as such, once the data before it arrives */
+		img_mgmt_upload_window_put(window_chunk, &req);
+		rc = img_mgmt_upload_good_rsp(ctxt);
+		img_mgmt_release_lock();
+		return rc;
+	}
+#endif
+
 	/* Remember flash area ID and image size for subsequent upload requests. */
 	g_img_mgmt_state.area_id = action.area_id;
 	g_img_mgmt_state.size = action.size;
@@ -846,6 +998,9 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #endif
 
 		g_img_mgmt_state.off = 0;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		memset(upload_window, 0, sizeof(upload_window));
+#endif
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
@@ -923,7 +1078,17 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+			if (!last) {
+#if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
+				img_mgmt_upload_notify_write_complete();
+#endif
+				rc = img_mgmt_upload_window_flush(&last);
+			}
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
@@ -967,10 +1132,11 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 			(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_PENDING, NULL, 0,
 						   &err_rc, &err_group);
-		} else {
-			/* Notify that the write has completed */
-			(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK_WRITE_COMPLETE,
-						   NULL, 0, &err_rc, &err_group);
+		} else if (CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW == 0) {
+			/* Notify that the write has completed, with an upload window
+			 * each chunk is notified as soon as it is written instead.
+			 */
+			img_mgmt_upload_notify_write_complete();
 #endif
 		}
 	}
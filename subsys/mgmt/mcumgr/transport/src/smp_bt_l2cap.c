@@ -0,0 +1,254 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ * @brief Bluetooth L2CAP connection oriented channel transport for the mcumgr SMP protocol.
+ *
+ * Each SMP packet is carried in one L2CAP SDU, so packets up to the negotiated MTU are sent
+ * without any SMP level fragmentation, with the credit based flow control of the channel.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/l2cap.h>
+#include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+#include <zephyr/mgmt/mcumgr/smp/smp.h>
+#include <zephyr/mgmt/mcumgr/transport/smp.h>
+#include <zephyr/mgmt/mcumgr/mgmt/handlers.h>
+#include <zephyr/net_buf.h>
+#include <errno.h>
+
+#include <mgmt/mcumgr/transport/smp_internal.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(mcumgr_smp, CONFIG_MCUMGR_TRANSPORT_LOG_LEVEL);
+
+#define SMP_BT_L2CAP_MTU CONFIG_MCUMGR_TRANSPORT_NETBUF_SIZE
+
+#if defined(CONFIG_MCUMGR_TRANSPORT_BT_PERM_RW_AUTHEN)
+#define SMP_BT_L2CAP_SEC_LEVEL BT_SECURITY_L3
+#elif defined(CONFIG_MCUMGR_TRANSPORT_BT_PERM_RW_ENCRYPT)
+#define SMP_BT_L2CAP_SEC_LEVEL BT_SECURITY_L2
+#else
+#define SMP_BT_L2CAP_SEC_LEVEL BT_SECURITY_L1
+#endif
+
+struct smp_bt_l2cap_chan {
+	struct bt_l2cap_le_chan le;
+	/* Changes each time the channel is connected, 0 if disconnected */
+	uint8_t id;
+};
+
+struct smp_bt_l2cap_user_data {
+	struct smp_bt_l2cap_chan *chan;
+	uint8_t id;
+};
+
+BUILD_ASSERT(sizeof(struct smp_bt_l2cap_user_data) <=
+	     CONFIG_MCUMGR_TRANSPORT_NETBUF_USER_DATA_SIZE,
+	     "CONFIG_MCUMGR_TRANSPORT_NETBUF_USER_DATA_SIZE not large enough to fit Bluetooth"
+	     " L2CAP user data");
+
+NET_BUF_POOL_FIXED_DEFINE(smp_bt_l2cap_rx_pool, CONFIG_BT_MAX_CONN, SMP_BT_L2CAP_MTU, 8, NULL);
+NET_BUF_POOL_FIXED_DEFINE(smp_bt_l2cap_tx_pool, 1, BT_L2CAP_SDU_BUF_SIZE(SMP_BT_L2CAP_MTU),
+			  CONFIG_BT_CONN_TX_USER_DATA_SIZE, NULL);
+
+static struct smp_transport smp_bt_l2cap_transport;
+static struct smp_bt_l2cap_chan smp_bt_l2cap_chans[CONFIG_BT_MAX_CONN];
+static uint8_t next_id = 1;
+
+static struct net_buf *smp_bt_l2cap_alloc_buf(struct bt_l2cap_chan *chan)
+{
+	return net_buf_alloc(&smp_bt_l2cap_rx_pool, K_NO_WAIT);
+}
+
+static int smp_bt_l2cap_recv(struct bt_l2cap_chan *chan, struct net_buf *buf)
+{
+	struct smp_bt_l2cap_chan *sc = CONTAINER_OF(chan, struct smp_bt_l2cap_chan, le.chan);
+	struct smp_bt_l2cap_user_data *ud;
+	struct net_buf *nb;
+
+	nb = smp_packet_alloc();
+	if (nb == NULL) {
+		LOG_DBG("failed net_buf alloc for SMP packet");
+		return -ENOMEM;
+	}
+
+	if (net_buf_tailroom(nb) < buf->len) {
+		LOG_DBG("SMP packet len (%u) > net_buf len (%zu)", buf->len,
+			net_buf_tailroom(nb));
+		smp_packet_free(nb);
+		return -EMSGSIZE;
+	}
+
+	net_buf_add_mem(nb, buf->data, buf->len);
+
+	ud = net_buf_user_data(nb);
+	ud->chan = sc;
+	ud->id = sc->id;
+
+	smp_rx_req(&smp_bt_l2cap_transport, nb);
+
+	return 0;
+}
+
+static void smp_bt_l2cap_connected(struct bt_l2cap_chan *chan)
+{
+	struct smp_bt_l2cap_chan *sc = CONTAINER_OF(chan, struct smp_bt_l2cap_chan, le.chan);
+
+	sc->id = next_id++;
+	if (next_id == 0) {
+		/* Avoid use of 0 (invalid ID) */
+		next_id = 1;
+	}
+}
+
+static void smp_bt_l2cap_disconnected(struct bt_l2cap_chan *chan)
+{
+	struct smp_bt_l2cap_chan *sc = CONTAINER_OF(chan, struct smp_bt_l2cap_chan, le.chan);
+
+	sc->id = 0;
+
+	/* Remove all pending requests from this channel which have yet to be processed */
+	smp_rx_remove_invalid(&smp_bt_l2cap_transport, sc);
+}
+
+static const struct bt_l2cap_chan_ops smp_bt_l2cap_ops = {
+	.alloc_buf = smp_bt_l2cap_alloc_buf,
+	.recv = smp_bt_l2cap_recv,
+	.connected = smp_bt_l2cap_connected,
+	.disconnected = smp_bt_l2cap_disconnected,
+};
+
+static int smp_bt_l2cap_accept(struct bt_conn *conn, struct bt_l2cap_server *server,
+			       struct bt_l2cap_chan **chan)
+{
+	ARRAY_FOR_EACH_PTR(smp_bt_l2cap_chans, sc) {
+		if (sc->le.chan.conn == NULL) {
+			memset(&sc->le, 0, sizeof(sc->le));
+			sc->le.chan.ops = &smp_bt_l2cap_ops;
+			sc->le.rx.mtu = SMP_BT_L2CAP_MTU;
+			*chan = &sc->le.chan;
+
+			return 0;
+		}
+	}
+
+	return -ENOMEM;
+}
+
+static struct bt_l2cap_server smp_bt_l2cap_server = {
+	.psm = CONFIG_MCUMGR_TRANSPORT_BT_L2CAP_PSM,
+	.sec_level = SMP_BT_L2CAP_SEC_LEVEL,
+	.accept = smp_bt_l2cap_accept,
+};
+
+static struct smp_bt_l2cap_chan *smp_bt_l2cap_chan_from_pkt(const struct net_buf *nb)
+{
+	struct smp_bt_l2cap_user_data *ud = net_buf_user_data(nb);
+
+	if (ud->chan == NULL || ud->id == 0 || ud->chan->id != ud->id) {
+		/* The channel was disconnected since the request was received */
+		return NULL;
+	}
+
+	return ud->chan;
+}
+
+static uint16_t smp_bt_l2cap_get_mtu(const struct net_buf *nb)
+{
+	struct smp_bt_l2cap_chan *sc = smp_bt_l2cap_chan_from_pkt(nb);
+
+	if (sc == NULL) {
+		return 0;
+	}
+
+	return MIN(sc->le.tx.mtu, SMP_BT_L2CAP_MTU);
+}
+
+static void smp_bt_l2cap_ud_free(void *ud)
+{
+	struct smp_bt_l2cap_user_data *user_data = ud;
+
+	user_data->chan = NULL;
+	user_data->id = 0;
+}
+
+static int smp_bt_l2cap_ud_copy(struct net_buf *dst, const struct net_buf *src)
+{
+	struct smp_bt_l2cap_user_data *src_ud = net_buf_user_data(src);
+	struct smp_bt_l2cap_user_data *dst_ud = net_buf_user_data(dst);
+
+	dst_ud->chan = src_ud->chan;
+	dst_ud->id = src_ud->id;
+
+	return 0;
+}
+
+static int smp_bt_l2cap_tx_pkt(struct net_buf *nb)
+{
+	struct smp_bt_l2cap_chan *sc = smp_bt_l2cap_chan_from_pkt(nb);
+	struct net_buf *sdu;
+	int rc = MGMT_ERR_EOK;
+
+	if (sc == NULL) {
+		rc = MGMT_ERR_ENOENT;
+		goto cleanup;
+	}
+
+	if (nb->len > smp_bt_l2cap_get_mtu(nb)) {
+		LOG_DBG("SMP packet len (%u) > L2CAP MTU (%u)", nb->len,
+			smp_bt_l2cap_get_mtu(nb));
+		rc = MGMT_ERR_EMSGSIZE;
+		goto cleanup;
+	}
+
+	/* Waits for the previous response to be handed to the controller */
+	sdu = net_buf_alloc(&smp_bt_l2cap_tx_pool, K_FOREVER);
+	net_buf_reserve(sdu, BT_L2CAP_SDU_CHAN_SEND_RESERVE);
+	net_buf_add_mem(sdu, nb->data, nb->len);
+
+	if (bt_l2cap_chan_send(&sc->le.chan, sdu) != 0) {
+		net_buf_unref(sdu);
+		rc = MGMT_ERR_EUNKNOWN;
+	}
+
+cleanup:
+	smp_bt_l2cap_ud_free(net_buf_user_data(nb));
+	smp_packet_free(nb);
+
+	return rc;
+}
+
+static bool smp_bt_l2cap_query_valid_check(struct net_buf *nb, void *arg)
+{
+	struct smp_bt_l2cap_user_data *ud = net_buf_user_data(nb);
+
+	return ud->chan != arg;
+}
+
+static void smp_bt_l2cap_setup(void)
+{
+	int rc;
+
+	smp_bt_l2cap_transport.functions.output = smp_bt_l2cap_tx_pkt;
+	smp_bt_l2cap_transport.functions.get_mtu = smp_bt_l2cap_get_mtu;
+	smp_bt_l2cap_transport.functions.ud_copy = smp_bt_l2cap_ud_copy;
+	smp_bt_l2cap_transport.functions.ud_free = smp_bt_l2cap_ud_free;
+	smp_bt_l2cap_transport.functions.query_valid_check = smp_bt_l2cap_query_valid_check;
+
+	rc = smp_transport_init(&smp_bt_l2cap_transport);
+	if (rc == 0) {
+		rc = bt_l2cap_server_register(&smp_bt_l2cap_server);
+	}
+
+	if (rc != 0) {
+		LOG_ERR("Bluetooth L2CAP SMP transport register failed (err %d)", rc);
+	}
+}
+
+MCUMGR_HANDLER_DEFINE(smp_bt_l2cap, smp_bt_l2cap_setup);
@@ -70,6 +70,13 @@ static void modem_backend_uart_isr_irq_handler_transmit_ready(struct modem_backe
 
 	if (ring_buf_is_empty(&backend->isr.transmit_rb) == true) {
 		uart_irq_tx_disable(backend->uart);
+
+		/* Data may have been added before the interrupt was disabled */
+		if (ring_buf_is_empty(&backend->isr.transmit_rb) == false) {
+			uart_irq_tx_enable(backend->uart);
+			return;
+		}
+
 		k_work_submit(&backend->transmit_idle_work);
 		return;
 	}
@@ -174,7 +181,7 @@ static int modem_backend_uart_isr_transmit(void *data, const uint8_t *buf, size_
 		return 0;
 	}
 
-	uart_irq_tx_disable(backend->uart);
+	/* The ring buffer is safe to fill while the interrupt handler drains it */
 	written = ring_buf_put(&backend->isr.transmit_rb, buf, size);
 	uart_irq_tx_enable(backend->uart);
 
@@ -343,11 +343,12 @@ static bool modem_cmux_transmit_cmd_frame(struct modem_cmux *cmux,
 	return true;
 }
 
-static int16_t modem_cmux_transmit_data_frame(struct modem_cmux *cmux,
-					      const struct modem_cmux_frame *frame)
+static int modem_cmux_transmit_data_frame(struct modem_cmux *cmux,
+					  const struct modem_cmux_frame *frame)
 {
+	struct modem_cmux_frame chunk = *frame;
 	uint16_t space;
-	int ret;
+	int ret = 0;
 
 	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
 
@@ -356,22 +357,30 @@ static int16_t modem_cmux_transmit_data_frame(struct modem_cmux *cmux,
 		return 0;
 	}
 
-	space = ring_buf_space_get(&cmux->transmit_rb);
+	/* Split the data in as many frames as the transmit buffer fits at once */
+	while (ret < frame->data_len) {
+		space = ring_buf_space_get(&cmux->transmit_rb);
 
-	/*
-	 * One command frame is reserved for command channel, and we shall prefer
-	 * waiting for more than MODEM_CMUX_DATA_FRAME_SIZE_MIN bytes available in the
-	 * transmit buffer rather than transmitting a few bytes at a time. This avoids
-	 * excessive wrapping overhead, since transmitting a single byte will require 8
-	 * bytes of wrapping.
-	 */
-	if (space < (MODEM_CMUX_CMD_FRAME_SIZE_MAX + MODEM_CMUX_DATA_FRAME_SIZE_MIN)) {
-		k_mutex_unlock(&cmux->transmit_rb_lock);
-		return 0;
+		/*
+		 * One command frame is reserved for command channel, and we shall prefer
+		 * waiting for more than MODEM_CMUX_DATA_FRAME_SIZE_MIN bytes available in the
+		 * transmit buffer rather than transmitting a few bytes at a time. This avoids
+		 * excessive wrapping overhead, since transmitting a single byte will require 8
+		 * bytes of wrapping.
+		 */
+		if (space < (MODEM_CMUX_CMD_FRAME_SIZE_MAX + MODEM_CMUX_DATA_FRAME_SIZE_MIN)) {
+			break;
+		}
+
+		chunk.data = &frame->data[ret];
+		chunk.data_len = MIN(frame->data_len - ret,
+				     space - MODEM_CMUX_CMD_FRAME_SIZE_MAX);
+		chunk.data_len = MIN(chunk.data_len, CONFIG_MODEM_CMUX_MTU);
+
+		modem_cmux_log_transmit_frame(&chunk);
+		ret += modem_cmux_transmit_frame(cmux, &chunk);
 	}
 
-	modem_cmux_log_transmit_frame(frame);
-	ret = modem_cmux_transmit_frame(cmux, frame);
 	k_mutex_unlock(&cmux->transmit_rb_lock);
 	return ret;
 }
@@ -626,6 +635,94 @@ static void modem_cmux_on_dlci_frame_uih(struct modem_cmux_dlci *dlci)
 	modem_pipe_notify_receive_ready(&dlci->pipe);
 }
 
+static void modem_cmux_receive_dlci_begin(struct modem_cmux *cmux)
+{
+	struct modem_cmux_dlci *dlci;
+
+	cmux->receive_dlci = NULL;
+	cmux->receive_dlci_claimed = 0;
+
+	/*
+	 * The FCS of UIH frames only covers the header, so their payload does not need
+	 * to be buffered before being validated. It is written straight to the receive
+	 * buffer of the DLCI, and only committed once the frame is complete.
+	 */
+	if (cmux->frame.type != MODEM_CMUX_FRAME_TYPE_UIH || cmux->frame.dlci_address == 0) {
+		return;
+	}
+
+	dlci = modem_cmux_find_dlci(cmux);
+	if (dlci == NULL || dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) {
+		return;
+	}
+
+	cmux->receive_dlci = dlci;
+}
+
+static void modem_cmux_receive_dlci_put(struct modem_cmux *cmux, const uint8_t *data,
+					uint16_t len)
+{
+	struct modem_cmux_dlci *dlci = cmux->receive_dlci;
+	uint8_t *claimed;
+	uint32_t size;
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	while (len > 0) {
+		size = ring_buf_put_claim(&dlci->receive_rb, &claimed, len);
+		if (size == 0) {
+			break;
+		}
+
+		memcpy(claimed, data, size);
+		cmux->receive_dlci_claimed += size;
+		data += size;
+		len -= size;
+	}
+
+	k_mutex_unlock(&dlci->receive_rb_lock);
+}
+
+static void modem_cmux_receive_dlci_abort(struct modem_cmux *cmux)
+{
+	struct modem_cmux_dlci *dlci = cmux->receive_dlci;
+
+	if (dlci == NULL) {
+		return;
+	}
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+	ring_buf_put_finish(&dlci->receive_rb, 0);
+	k_mutex_unlock(&dlci->receive_rb_lock);
+
+	cmux->receive_dlci = NULL;
+}
+
+static void modem_cmux_receive_dlci_finish(struct modem_cmux *cmux)
+{
+	struct modem_cmux_dlci *dlci = cmux->receive_dlci;
+
+#if CONFIG_MODEM_STATS
+	modem_cmux_advertise_receive_buf_stats(cmux);
+#endif
+
+	cmux->frame.data = NULL;
+	modem_cmux_log_frame(&cmux->frame, "rcvd", 0);
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+	ring_buf_put_finish(&dlci->receive_rb, cmux->receive_dlci_claimed);
+	k_mutex_unlock(&dlci->receive_rb_lock);
+
+	if (cmux->receive_dlci_claimed != cmux->frame.data_len) {
+		LOG_WRN("DLCI %u receive buffer overrun (dropped %u out of %u bytes)",
+			dlci->dlci_address, cmux->frame.data_len - cmux->receive_dlci_claimed,
+			cmux->frame.data_len);
+	}
+
+	cmux->receive_dlci = NULL;
+	modem_pipe_notify_receive_ready(&dlci->pipe);
+}
+
 static void modem_cmux_on_dlci_frame_sabm(struct modem_cmux_dlci *dlci)
 {
 	struct modem_cmux *cmux = dlci->cmux;
@@ -716,6 +813,7 @@ static void modem_cmux_drop_frame(struct modem_cmux *cmux)
 
 	LOG_WRN("Dropped frame");
 	cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+	modem_cmux_receive_dlci_abort(cmux);
 
 #if defined(CONFIG_MODEM_CMUX_LOG_LEVEL_DBG)
 	struct modem_cmux_frame *frame = &cmux->frame;
@@ -725,6 +823,29 @@ static void modem_cmux_drop_frame(struct modem_cmux *cmux)
 #endif
 }
 
+static uint16_t modem_cmux_process_received_payload(struct modem_cmux *cmux,
+						    const uint8_t *data, size_t len)
+{
+	uint16_t chunk = MIN(len, cmux->frame.data_len - cmux->receive_buf_len);
+
+	if (cmux->receive_dlci != NULL) {
+		modem_cmux_receive_dlci_put(cmux, data, chunk);
+	} else if (cmux->receive_buf_len < cmux->receive_buf_size) {
+		memcpy(&cmux->receive_buf[cmux->receive_buf_len], data,
+		       MIN(chunk, cmux->receive_buf_size - cmux->receive_buf_len));
+	}
+
+	cmux->receive_buf_len += chunk;
+
+	/* Check if datalen reached */
+	if (cmux->frame.data_len == cmux->receive_buf_len) {
+		/* Await FCS */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+	}
+
+	return chunk;
+}
+
 static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t byte)
 {
 	uint8_t fcs;
@@ -751,6 +872,7 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 
 	case MODEM_CMUX_RECEIVE_STATE_ADDRESS:
 		/* Initialize */
+		modem_cmux_receive_dlci_abort(cmux);
 		cmux->receive_buf_len = 0;
 		cmux->frame_header_len = 0;
 
@@ -812,6 +934,7 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 		}
 
 		/* Await data */
+		modem_cmux_receive_dlci_begin(cmux);
 		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DATA;
 		break;
 
@@ -838,26 +961,17 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 		}
 
 		/* Await data */
+		modem_cmux_receive_dlci_begin(cmux);
 		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DATA;
 		break;
 
 	case MODEM_CMUX_RECEIVE_STATE_DATA:
-		/* Copy byte to data */
-		if (cmux->receive_buf_len < cmux->receive_buf_size) {
-			cmux->receive_buf[cmux->receive_buf_len] = byte;
-		}
-		cmux->receive_buf_len++;
-
-		/* Check if datalen reached */
-		if (cmux->frame.data_len == cmux->receive_buf_len) {
-			/* Await FCS */
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
-		}
-
+		/* Data is processed in bulk by modem_cmux_process_received_data() */
+		modem_cmux_process_received_payload(cmux, &byte, 1);
 		break;
 
 	case MODEM_CMUX_RECEIVE_STATE_FCS:
-		if (cmux->receive_buf_len > cmux->receive_buf_size) {
+		if (cmux->receive_dlci == NULL && cmux->receive_buf_len > cmux->receive_buf_size) {
 			LOG_WRN("Receive buffer overrun (%u > %u)",
 				cmux->receive_buf_len, cmux->receive_buf_size);
 			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DROP;
@@ -898,8 +1012,12 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 		}
 
 		/* Process frame */
-		cmux->frame.data = cmux->receive_buf;
-		modem_cmux_on_frame(cmux);
+		if (cmux->receive_dlci != NULL) {
+			modem_cmux_receive_dlci_finish(cmux);
+		} else {
+			cmux->frame.data = cmux->receive_buf;
+			modem_cmux_on_frame(cmux);
+		}
 
 		/* Await start of next frame */
 		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
@@ -910,6 +1028,25 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+static void modem_cmux_process_received_data(struct modem_cmux *cmux, const uint8_t *data,
+					     size_t len)
+{
+	size_t processed;
+
+	while (len > 0) {
+		/* Copy the payload of frames at once rather than byte by byte */
+		if (cmux->receive_state == MODEM_CMUX_RECEIVE_STATE_DATA) {
+			processed = modem_cmux_process_received_payload(cmux, data, len);
+		} else {
+			modem_cmux_process_received_byte(cmux, *data);
+			processed = 1;
+		}
+
+		data += processed;
+		len -= processed;
+	}
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
@@ -926,9 +1063,7 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (int i = 0; i < ret; i++) {
-		modem_cmux_process_received_byte(cmux, cmux->work_buf[i]);
-	}
+	modem_cmux_process_received_data(cmux, cmux->work_buf, ret);
 
 	/* Reschedule received work */
 	k_work_schedule(&cmux->receive_work, K_NO_WAIT);
@@ -19,6 +19,17 @@ LOG_MODULE_REGISTER(modem_ppp, CONFIG_MODEM_MODULES_LOG_LEVEL);
 #define MODEM_PPP_CODE_ESCAPE		(0x7D)
 #define MODEM_PPP_VALUE_ESCAPE		(0x20)
 
+/* Bytes escaped with the default async control character map: 0x00 to 0x1F, 0x7D and 0x7E */
+static const uint32_t modem_ppp_escape_map[8] = {
+	0xFFFFFFFF, 0x00000000, 0x00000000, 0x60000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+static bool modem_ppp_needs_escape(uint8_t byte)
+{
+	return (modem_ppp_escape_map[byte >> 5] & BIT(byte & 0x1F)) != 0;
+}
+
 static uint16_t modem_ppp_fcs_init(uint8_t byte)
 {
 	return crc16_ccitt(0xFFFF, &byte, 1);
@@ -54,6 +65,8 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 
 	switch (ppp->transmit_state) {
 	case MODEM_PPP_TRANSMIT_STATE_IDLE:
+	/* Data is wrapped in bulk by modem_ppp_wrap_net_pkt_data() */
+	case MODEM_PPP_TRANSMIT_STATE_DATA:
 		LOG_WRN("Invalid transmit state");
 		return 0;
 
@@ -64,6 +77,8 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 
 	case MODEM_PPP_TRANSMIT_STATE_HDR_FF:
 		net_pkt_cursor_init(ppp->tx_pkt);
+		/* Skipping the wrapped data must not extend the packet */
+		net_pkt_set_overwrite(ppp->tx_pkt, true);
 		ppp->tx_pkt_fcs = modem_ppp_fcs_init(0xFF);
 		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_HDR_7D;
 		return 0xFF;
@@ -88,8 +103,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = (ppp->tx_pkt_protocol >> 8) & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -106,8 +120,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = ppp->tx_pkt_protocol & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -121,23 +134,6 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		return ppp->tx_pkt_escaped;
 
 	/* Writing data */
-	case MODEM_PPP_TRANSMIT_STATE_DATA:
-		(void)net_pkt_read_u8(ppp->tx_pkt, &byte);
-		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
-
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
-			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
-			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_DATA;
-			return MODEM_PPP_CODE_ESCAPE;
-		}
-
-		if (net_pkt_remaining_data(ppp->tx_pkt) == 0) {
-			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_FCS_LOW;
-		}
-
-		return byte;
-
 	case MODEM_PPP_TRANSMIT_STATE_ESCAPING_DATA:
 		if (net_pkt_remaining_data(ppp->tx_pkt) == 0) {
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_FCS_LOW;
@@ -152,8 +148,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		ppp->tx_pkt_fcs = modem_ppp_fcs_final(ppp->tx_pkt_fcs);
 		byte = ppp->tx_pkt_fcs & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -169,8 +164,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	case MODEM_PPP_TRANSMIT_STATE_FCS_HIGH:
 		byte = (ppp->tx_pkt_fcs >> 8) & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -192,6 +186,64 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	return 0;
 }
 
+/* Wrap as much packet data as fits in the contiguous space of the transmit ring buffer */
+static void modem_ppp_wrap_net_pkt_data(struct modem_ppp *ppp)
+{
+	struct net_pkt *pkt = ppp->tx_pkt;
+	struct net_buf *frag = pkt->cursor.buf;
+	const uint8_t *src = pkt->cursor.pos;
+	uint8_t *dst;
+	uint32_t space;
+	uint32_t written = 0;
+	size_t consumed = 0;
+	size_t avail;
+	size_t i;
+
+	space = ring_buf_put_claim(&ppp->transmit_rb, &dst, UINT32_MAX);
+
+	while ((frag != NULL) && (written < space) &&
+	       (ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_DATA)) {
+		avail = frag->len - (src - frag->data);
+		if (avail == 0) {
+			frag = frag->frags;
+			src = (frag != NULL) ? frag->data : NULL;
+			continue;
+		}
+
+		for (i = 0; (i < avail) && (written < space); i++) {
+			if (!modem_ppp_needs_escape(src[i])) {
+				dst[written++] = src[i];
+				continue;
+			}
+
+			dst[written++] = MODEM_PPP_CODE_ESCAPE;
+
+			if (written == space) {
+				/* No space left for the escaped byte, write it next */
+				ppp->tx_pkt_escaped = src[i] ^ MODEM_PPP_VALUE_ESCAPE;
+				ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_DATA;
+				i++;
+				break;
+			}
+
+			dst[written++] = src[i] ^ MODEM_PPP_VALUE_ESCAPE;
+		}
+
+		/* FCS of the whole span at once */
+		ppp->tx_pkt_fcs = crc16_ccitt(ppp->tx_pkt_fcs, src, i);
+		consumed += i;
+		src += i;
+	}
+
+	ring_buf_put_finish(&ppp->transmit_rb, written);
+	(void)net_pkt_skip(pkt, consumed);
+
+	if ((ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_DATA) &&
+	    (net_pkt_remaining_data(pkt) == 0)) {
+		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_FCS_LOW;
+	}
+}
+
 static bool modem_ppp_is_byte_expected(uint8_t byte, uint8_t expected_byte)
 {
 	if (byte == expected_byte) {
@@ -201,6 +253,17 @@ static bool modem_ppp_is_byte_expected(uint8_t byte, uint8_t expected_byte)
 	return false;
 }
 
+static void modem_ppp_drop_rx_pkt(struct modem_ppp *ppp)
+{
+	LOG_WRN("Dropped PPP frame");
+	net_pkt_unref(ppp->rx_pkt);
+	ppp->rx_pkt = NULL;
+	ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+	ppp->stats.drop++;
+#endif
+}
+
 static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 {
 	switch (ppp->receive_state) {
@@ -285,26 +348,14 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 		}
 
 		if (net_pkt_write_u8(ppp->rx_pkt, byte) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_rx_pkt(ppp);
 		}
 
 		break;
 
 	case MODEM_PPP_RECEIVE_STATE_UNESCAPING:
 		if (net_pkt_write_u8(ppp->rx_pkt, (byte ^ MODEM_PPP_VALUE_ESCAPE)) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_rx_pkt(ppp);
 			break;
 		}
 
@@ -313,6 +364,55 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+/* Length of the leading bytes which are neither delimiters nor escapes */
+static size_t modem_ppp_received_run(const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if ((data[i] == MODEM_PPP_CODE_DELIMITER) || (data[i] == MODEM_PPP_CODE_ESCAPE)) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+static void modem_ppp_process_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					    size_t len)
+{
+	size_t avail;
+	size_t run;
+	size_t i = 0;
+
+	while (i < len) {
+		if (ppp->receive_state != MODEM_PPP_RECEIVE_STATE_WRITING) {
+			modem_ppp_process_received_byte(ppp, data[i]);
+			i++;
+			continue;
+		}
+
+		run = modem_ppp_received_run(&data[i], len - i);
+		avail = net_pkt_available_buffer(ppp->rx_pkt);
+
+		/* Delimiters, escapes and buffer allocation are handled byte by byte */
+		if ((run == 0) || (avail < 2)) {
+			modem_ppp_process_received_byte(ppp, data[i]);
+			i++;
+			continue;
+		}
+
+		/* Keep one byte available like the byte by byte processing */
+		run = MIN(run, avail - 1);
+
+		if (net_pkt_write(ppp->rx_pkt, &data[i], run) < 0) {
+			modem_ppp_drop_rx_pkt(ppp);
+		}
+
+		i += run;
+	}
+}
+
 #if CONFIG_MODEM_STATS
 static uint32_t get_transmit_buf_length(struct modem_ppp *ppp)
 {
@@ -373,6 +473,11 @@ static void modem_ppp_send_handler(struct k_work *item)
 
 		/* Fill transmit ring buffer */
 		while (ring_buf_space_get(&ppp->transmit_rb) > 0) {
+			if (ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_DATA) {
+				modem_ppp_wrap_net_pkt_data(ppp);
+				continue;
+			}
+
 			byte = modem_ppp_wrap_net_pkt_byte(ppp);
 
 			ring_buf_put(&ppp->transmit_rb, &byte, 1);
@@ -420,9 +525,7 @@ static void modem_ppp_process_handler(struct k_work *item)
 	advertise_receive_buf_stats(ppp, ret);
 #endif
 
-	for (int i = 0; i < ret; i++) {
-		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
-	}
+	modem_ppp_process_received_data(ppp, ppp->receive_buf, ret);
 
 	k_work_submit(&ppp->process_work);
 }
@@ -44,6 +44,19 @@ static inline uint8_t get_6co_cid(struct net_icmpv6_nd_opt_6co *opt)
 }
 
 static struct net_6lo_context ctx_6co[CONFIG_NET_MAX_6LO_CONTEXTS];
+
+/* Result of the last context lookup by address. The source and destination
+ * addresses of the packets usually share a prefix, so this saves most of the
+ * lookups done for each packet compressed.
+ */
+static struct {
+	struct net_if *iface;
+	uint8_t prefix[8];
+	struct net_6lo_context *ctx;
+	bool valid;
+} ctx_6co_last;
+
+static struct k_spinlock ctx_6co_lock;
 #endif
 
 static const uint8_t udp_nhc_inline_size_table[] = {4, 3, 3, 1};
@@ -156,6 +169,16 @@ static inline bool net_6lo_maddr_48_bit_compressible(struct in6_addr *addr)
 }
 
 #if defined(CONFIG_NET_6LO_CONTEXT)
+/* Must be called after any change of the contexts */
+static void reset_6lo_context_last(void)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ctx_6co_lock);
+	ctx_6co_last.valid = false;
+	k_spin_unlock(&ctx_6co_lock, key);
+}
+
 /* RFC 6775, 4.2, 5.4.2, 5.4.3 and 7.2*/
 static inline void set_6lo_context(struct net_if *iface, uint8_t index,
 				   struct net_icmpv6_nd_opt_6co *context)
@@ -170,6 +193,8 @@ static inline void set_6lo_context(struct net_if *iface, uint8_t index,
 	ctx_6co[index].cid = get_6co_cid(context);
 
 	net_ipv6_addr_copy_raw((uint8_t *)&ctx_6co[index].prefix, context->prefix);
+
+	reset_6lo_context_last();
 }
 
 void net_6lo_set_context(struct net_if *iface,
@@ -192,6 +217,7 @@ void net_6lo_set_context(struct net_if *iface,
 			/* Remove if lifetime is zero */
 			if (!context->lifetime) {
 				ctx_6co[i].is_used = false;
+				reset_6lo_context_last();
 				return;
 			}
 
@@ -233,8 +259,18 @@ get_6lo_context_by_cid(struct net_if *iface, uint8_t cid)
 static inline struct net_6lo_context *
 get_6lo_context_by_addr(struct net_if *iface, struct in6_addr *addr)
 {
+	struct net_6lo_context *ctx = NULL;
+	k_spinlock_key_t key;
 	uint8_t i;
 
+	key = k_spin_lock(&ctx_6co_lock);
+
+	if (ctx_6co_last.valid && ctx_6co_last.iface == iface &&
+	    !memcmp(ctx_6co_last.prefix, addr->s6_addr, 8)) {
+		ctx = ctx_6co_last.ctx;
+		goto out;
+	}
+
 	for (i = 0U; i < CONFIG_NET_MAX_6LO_CONTEXTS; i++) {
 		if (!ctx_6co[i].is_used) {
 			continue;
@@ -242,11 +278,21 @@ get_6lo_context_by_addr(struct net_if *iface, struct in6_addr *addr)
 
 		if (ctx_6co[i].iface == iface &&
 		    !memcmp(ctx_6co[i].prefix.s6_addr, addr->s6_addr, 8)) {
-			return &ctx_6co[i];
+			ctx = &ctx_6co[i];
+			break;
 		}
 	}
 
-	return NULL;
+	/* Not finding a context is cached as well */
+	ctx_6co_last.iface = iface;
+	memcpy(ctx_6co_last.prefix, addr->s6_addr, 8);
+	ctx_6co_last.ctx = ctx;
+	ctx_6co_last.valid = true;
+
+out:
+	k_spin_unlock(&ctx_6co_lock, key);
+
+	return ctx;
 }
 
 #endif
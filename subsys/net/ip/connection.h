@@ -54,6 +54,14 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Internal slist node of the hash bucket */
+	sys_snode_t hash_node;
+
+	/** Hash bucket, or list of the connections without a local port */
+	sys_slist_t *hash_list;
+#endif
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
@@ -618,8 +618,7 @@ enum net_verdict net_icmpv4_input(struct net_pkt *pkt,
 		return NET_DROP;
 	}
 
-	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), NET_IF_CHECKSUM_IPV4_ICMP) ||
-	    net_pkt_is_ip_reassembled(pkt)) {
+	if (net_pkt_need_calc_rx_chksum(pkt, NET_IF_CHECKSUM_IPV4_ICMP)) {
 		if (net_calc_chksum_icmpv4(pkt) != 0U) {
 			NET_DBG("DROP: Invalid checksum");
 			goto drop;
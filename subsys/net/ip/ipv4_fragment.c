@@ -32,83 +32,97 @@ static void reassembly_timeout(struct k_work *work);
 
 static struct net_ipv4_reassembly reassembly[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
 
-static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *src,
-						  struct in_addr *dst, uint8_t protocol)
-{
-	int i, avail = -1;
+/* Pending reassemblies are hashed on their identification and source address, the unused
+ * ones are kept in a free list.
+ */
+static sys_slist_t reassembly_hash_table[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+static sys_slist_t reassembly_free;
 
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
-		if (k_work_delayable_remaining_get(&reassembly[i].timer) &&
-		    reassembly[i].id == id &&
-		    net_ipv4_addr_cmp(src, &reassembly[i].src) &&
-		    net_ipv4_addr_cmp(dst, &reassembly[i].dst) &&
-		    reassembly[i].protocol == protocol) {
-			return &reassembly[i];
-		}
+/* Bytes held by the fragments of all the pending reassemblies */
+static size_t reassembly_mem;
 
-		if (k_work_delayable_remaining_get(&reassembly[i].timer)) {
-			continue;
-		}
+static sys_slist_t *reassembly_bucket(uint16_t id, const struct in_addr *src)
+{
+	uint32_t hash = (id ^ UNALIGNED_GET(&src->s_addr)) * 2654435761U;
 
-		if (avail < 0) {
-			avail = i;
+	return &reassembly_hash_table[(hash >> 16) % CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+}
+
+static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *src,
+						  struct in_addr *dst, uint8_t protocol)
+{
+	sys_slist_t *bucket = reassembly_bucket(id, src);
+	struct net_ipv4_reassembly *reass;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, reass, node) {
+		if (reass->id == id &&
+		    net_ipv4_addr_cmp(src, &reass->src) &&
+		    net_ipv4_addr_cmp(dst, &reass->dst) &&
+		    reass->protocol == protocol) {
+			return reass;
 		}
 	}
 
-	if (avail < 0) {
+	node = sys_slist_get(&reassembly_free);
+	if (node == NULL) {
 		return NULL;
 	}
 
-	k_work_reschedule(&reassembly[avail].timer, K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
+	reass = CONTAINER_OF(node, struct net_ipv4_reassembly, node);
+	sys_slist_prepend(bucket, &reass->node);
 
-	net_ipaddr_copy(&reassembly[avail].src, src);
-	net_ipaddr_copy(&reassembly[avail].dst, dst);
+	k_work_reschedule(&reass->timer, K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
 
-	reassembly[avail].protocol = protocol;
-	reassembly[avail].id = id;
+	net_ipaddr_copy(&reass->src, src);
+	net_ipaddr_copy(&reass->dst, dst);
 
-	return &reassembly[avail];
+	reass->protocol = protocol;
+	reass->id = id;
+	reass->received = 0U;
+	reass->total_len = 0U;
+	reass->mem = 0U;
+
+	return reass;
 }
 
-static bool reassembly_cancel(uint32_t id, struct in_addr *src, struct in_addr *dst)
+static bool reassembly_cancel(struct net_ipv4_reassembly *reass)
 {
-	int i, j;
-
-	LOG_DBG("Cancel 0x%x", id);
+	int32_t remaining;
+	int j;
 
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
-		int32_t remaining;
+	LOG_DBG("Cancel 0x%x", reass->id);
 
-		if (reassembly[i].id != id ||
-		    !net_ipv4_addr_cmp(src, &reassembly[i].src) ||
-		    !net_ipv4_addr_cmp(dst, &reassembly[i].dst)) {
-			continue;
-		}
+	if (!sys_slist_find_and_remove(reassembly_bucket(reass->id, &reass->src),
+				       &reass->node)) {
+		/* Already reassembled or cancelled */
+		return false;
+	}
 
-		remaining = k_ticks_to_ms_ceil32(
-			k_work_delayable_remaining_get(&reassembly[i].timer));
-		k_work_cancel_delayable(&reassembly[i].timer);
+	remaining = k_ticks_to_ms_ceil32(k_work_delayable_remaining_get(&reass->timer));
+	k_work_cancel_delayable(&reass->timer);
 
-		LOG_DBG("IPv4 reassembly id 0x%x remaining %d ms", reassembly[i].id, remaining);
+	LOG_DBG("IPv4 reassembly id 0x%x remaining %d ms", reass->id, remaining);
 
-		reassembly[i].id = 0U;
+	for (j = 0; j < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; j++) {
+		if (!reass->pkt[j]) {
+			continue;
+		}
 
-		for (j = 0; j < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; j++) {
-			if (!reassembly[i].pkt[j]) {
-				continue;
-			}
+		LOG_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data", j, reass->pkt[j],
+			net_pkt_get_len(reass->pkt[j]));
 
-			LOG_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data", j,
-				reassembly[i].pkt[j], net_pkt_get_len(reassembly[i].pkt[j]));
+		net_pkt_unref(reass->pkt[j]);
+		reass->pkt[j] = NULL;
+	}
 
-			net_pkt_unref(reassembly[i].pkt[j]);
-			reassembly[i].pkt[j] = NULL;
-		}
+	reassembly_mem -= reass->mem;
+	reass->mem = 0U;
+	reass->id = 0U;
 
-		return true;
-	}
+	sys_slist_append(&reassembly_free, &reass->node);
 
-	return false;
+	return true;
 }
 
 static void reassembly_info(char *str, struct net_ipv4_reassembly *reass)
@@ -134,7 +148,45 @@ static void reassembly_timeout(struct k_work *work)
 				      NET_ICMPV4_TIME_EXCEEDED_FRAGMENT_REASSEMBLY_TIME);
 	}
 
-	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+	reassembly_cancel(reass);
+}
+
+/* Make room for len more bytes of fragments under CONFIG_NET_IPV4_FRAGMENT_MAX_MEM by
+ * cancelling the oldest pending reassemblies, other than the one the fragment belongs to.
+ */
+static bool reassembly_reclaim(struct net_ipv4_reassembly *keep, size_t len)
+{
+	if (CONFIG_NET_IPV4_FRAGMENT_MAX_MEM == 0) {
+		return true;
+	}
+
+	while (reassembly_mem + len > CONFIG_NET_IPV4_FRAGMENT_MAX_MEM) {
+		struct net_ipv4_reassembly *oldest = NULL;
+		k_ticks_t oldest_remaining = 0;
+
+		for (int i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+			k_ticks_t remaining;
+
+			if (&reassembly[i] == keep || reassembly[i].mem == 0U) {
+				continue;
+			}
+
+			remaining = k_work_delayable_remaining_get(&reassembly[i].timer);
+			if (oldest == NULL || remaining < oldest_remaining) {
+				oldest = &reassembly[i];
+				oldest_remaining = remaining;
+			}
+		}
+
+		if (oldest == NULL) {
+			return false;
+		}
+
+		reassembly_info("Reassembly evicted", oldest);
+		reassembly_cancel(oldest);
+	}
+
+	return true;
 }
 
 static void reassemble_packet(struct net_ipv4_reassembly *reass)
@@ -145,13 +197,13 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 	struct net_buf *last;
 	int i;
 
-	k_work_cancel_delayable(&reass->timer);
-
 	NET_ASSERT(reass->pkt[0]);
 
 	last = net_buf_frag_last(reass->pkt[0]->buffer);
 
-	/* We start from 2nd packet which is then appended to the first one */
+	/* We start from 2nd packet which is then appended to the first one. The fragments
+	 * are stored sorted by offset, so their buffers are chained in place without copying.
+	 */
 	for (i = 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
 		pkt = reass->pkt[i];
 		if (!pkt) {
@@ -161,17 +213,12 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 		net_pkt_cursor_init(pkt);
 
 		/* Get rid of IPv4 header which is at the beginning of the fragment. */
-		ipv4_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
-		if (!ipv4_hdr) {
-			goto error;
-		}
-
 		LOG_DBG("Removing %d bytes from start of pkt %p", net_pkt_ip_hdr_len(pkt),
 			pkt->buffer);
 
 		if (net_pkt_pull(pkt, net_pkt_ip_hdr_len(pkt))) {
 			LOG_ERR("Failed to pull headers");
-			reassembly_cancel(reass->id, &reass->src, &reass->dst);
+			reassembly_cancel(reass);
 			return;
 		}
 
@@ -188,6 +235,9 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 	pkt = reass->pkt[0];
 	reass->pkt[0] = NULL;
 
+	/* Release the slot, the packet now owns all the fragment buffers */
+	reassembly_cancel(reass);
+
 	/* Update the header details for the packet */
 	net_pkt_cursor_init(pkt);
 
@@ -235,61 +285,14 @@ void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data)
 	}
 }
 
-/* Verify that we have all the fragments received and in correct order.
- * Return:
- * - a negative value if the fragments are erroneous and must be dropped
- * - zero if we are expecting more fragments
- * - a positive value if we can proceed with the reassembly
- */
-static int fragments_are_ready(struct net_ipv4_reassembly *reass)
+static inline int fragment_payload_len(struct net_pkt *pkt)
 {
-	unsigned int expected_offset = 0;
-	bool more = true;
-	int i;
-
-	/* Fragments can arrive in any order, for example in reverse order:
-	 *   1 -> Fragment3(M=0, offset=x2)
-	 *   2 -> Fragment2(M=1, offset=x1)
-	 *   3 -> Fragment1(M=1, offset=0)
-	 * We have to test several requirements before proceeding with the reassembly:
-	 * - We received the first fragment (Fragment Offset is 0)
-	 * - All intermediate fragments are contiguous
-	 * - The More bit of the last fragment is 0
-	 */
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		struct net_pkt *pkt = reass->pkt[i];
-		unsigned int offset;
-		int payload_len;
-
-		if (!pkt) {
-			break;
-		}
-
-		offset = net_pkt_ipv4_fragment_offset(pkt);
-
-		if (offset < expected_offset) {
-			/* Overlapping or duplicated, drop it */
-			return -EBADMSG;
-		} else if (offset != expected_offset) {
-			/* Not contiguous, let's wait for fragments */
-			return 0;
-		}
-
-		payload_len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
-
-		if (payload_len < 0) {
-			return -EBADMSG;
-		}
-
-		expected_offset += payload_len;
-		more = net_pkt_ipv4_fragment_more(pkt);
-	}
-
-	if (more) {
-		return 0;
-	}
+	return net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
+}
 
-	return 1;
+static inline unsigned int fragment_end(struct net_pkt *pkt)
+{
+	return net_pkt_ipv4_fragment_offset(pkt) + fragment_payload_len(pkt);
 }
 
 static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
@@ -318,15 +321,99 @@ static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
 	return -ENOMEM;
 }
 
+/* Store a fragment in the reassembly, keeping the fragments sorted by offset.
+ *
+ * The stored fragments never overlap, so the received payload covers the whole packet once
+ * it equals the total length given by the last fragment (More bit is 0), whatever the order
+ * the fragments arrived in.
+ *
+ * Return:
+ * - zero if the fragment was stored
+ * - -EALREADY if the fragment duplicates a stored one and must be dropped alone
+ * - -EBADMSG if the fragment overlaps or contradicts the stored ones
+ * - -ENOMEM if there is no room left for the fragment
+ */
+static int fragment_insert(struct net_ipv4_reassembly *reass, struct net_pkt *pkt)
+{
+	unsigned int offset = net_pkt_ipv4_fragment_offset(pkt);
+	bool more = net_pkt_ipv4_fragment_more(pkt);
+	int payload_len = fragment_payload_len(pkt);
+	unsigned int total_len = reass->total_len;
+	unsigned int end;
+	int i;
+
+	if (payload_len < 0) {
+		return -EBADMSG;
+	}
+
+	end = offset + payload_len;
+
+	if (!more) {
+		if (total_len != 0U && total_len != end) {
+			return -EBADMSG;
+		}
+
+		total_len = end;
+	}
+
+	if ((total_len != 0U && end > total_len) ||
+	    end + net_pkt_ip_hdr_len(pkt) > UINT16_MAX) {
+		return -EBADMSG;
+	}
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT && reass->pkt[i]; i++) {
+		if (net_pkt_ipv4_fragment_offset(reass->pkt[i]) >= offset) {
+			break;
+		}
+	}
+
+	if (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT && reass->pkt[i] &&
+	    net_pkt_ipv4_fragment_offset(reass->pkt[i]) == offset &&
+	    fragment_end(reass->pkt[i]) == end) {
+		return -EALREADY;
+	}
+
+	/* Overlapping fragments are erroneous, drop them */
+	if (i > 0 && fragment_end(reass->pkt[i - 1]) > offset) {
+		return -EBADMSG;
+	}
+
+	if (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT && reass->pkt[i] &&
+	    net_pkt_ipv4_fragment_offset(reass->pkt[i]) < end) {
+		return -EBADMSG;
+	}
+
+	/* The last fragment must not be followed by stored ones */
+	if (!more && i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT && reass->pkt[i]) {
+		return -EBADMSG;
+	}
+
+	if (i == CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
+		return -ENOMEM;
+	}
+
+	/* Make room for this fragment */
+	if (reass->pkt[i] && shift_packets(reass, i)) {
+		return -ENOMEM;
+	}
+
+	LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, i, offset);
+
+	reass->pkt[i] = pkt;
+	reass->received += payload_len;
+	reass->total_len = total_len;
+
+	return 0;
+}
+
 enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ipv4_hdr *hdr)
 {
 	struct net_ipv4_reassembly *reass = NULL;
 	uint16_t flag;
-	bool found;
 	uint8_t more;
 	uint16_t id;
+	size_t len;
 	int ret;
-	int i;
 
 	flag = ntohs(*((uint16_t *)&hdr->offset));
 	id = ntohs(*((uint16_t *)&hdr->id));
@@ -347,56 +434,41 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 		 */
 		net_icmpv4_send_error(pkt, NET_ICMPV4_BAD_IP_HEADER,
 				      NET_ICMPV4_BAD_IP_HEADER_LENGTH);
+		net_pkt_unref(pkt);
 		goto drop;
 	}
 
-	/* The fragments might come in wrong order so place them in the reassembly chain in the
-	 * correct order.
-	 */
-	for (i = 0, found = false; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv4_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv4_fragment_offset(pkt)) {
-				continue;
-			}
+	len = net_pkt_get_len(pkt);
 
-			/* Make room for this fragment. If there is no room then it will discard
-			 * the whole reassembly.
-			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
-		}
-
-		LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, i,
-			net_pkt_ipv4_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
-
-		break;
+	if (!reassembly_reclaim(reass, len)) {
+		LOG_ERR("Fragment memory limit reached, dropping id %u", reass->id);
+		net_pkt_unref(pkt);
+		goto drop;
 	}
 
-	if (!found) {
+	ret = fragment_insert(reass, pkt);
+	if (ret == -EALREADY) {
+		LOG_DBG("Duplicate fragment offset %d for 0x%x, dropping pkt %p",
+			net_pkt_ipv4_fragment_offset(pkt), reass->id, pkt);
+		net_pkt_unref(pkt);
+		goto accept;
+	} else if (ret == -ENOMEM) {
 		/* We could not add this fragment into our saved fragment list. The whole packet
 		 * must be discarded at this point.
 		 */
 		LOG_ERR("No slots available for 0x%x", reass->id);
 		net_pkt_unref(pkt);
 		goto drop;
-	}
-
-	ret = fragments_are_ready(reass);
-	if (ret < 0) {
+	} else if (ret < 0) {
 		LOG_ERR("Reassembled IPv4 verify failed, dropping id %u", reass->id);
-
-		/* Let the caller release the already inserted pkt */
-		if (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
-
 		net_pkt_unref(pkt);
 		goto drop;
-	} else if (ret == 0) {
+	}
+
+	reass->mem += len;
+	reassembly_mem += len;
+
+	if (reass->total_len == 0U || reass->received < reass->total_len) {
 		reassembly_info("Reassembly nth pkt", reass);
 
 		LOG_DBG("More fragments to be received");
@@ -413,7 +485,7 @@ accept:
 
 drop:
 	if (reass) {
-		if (reassembly_cancel(reass->id, &reass->src, &reass->dst)) {
+		if (reassembly_cancel(reass)) {
 			return NET_OK;
 		}
 	}
@@ -484,7 +556,10 @@ static int send_ipv4_fragment(struct net_pkt *pkt, uint16_t rand_id, uint16_t fi
 	ipv4_hdr->len = htons((fit_len + net_pkt_ip_hdr_len(pkt)));
 
 	ipv4_hdr->chksum = 0;
-	ipv4_hdr->chksum = net_calc_chksum_ipv4(frag_pkt);
+
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(frag_pkt), NET_IF_CHECKSUM_IPV4_HEADER)) {
+		ipv4_hdr->chksum = net_calc_chksum_ipv4(frag_pkt);
+	}
 
 	net_pkt_set_chksum_done(frag_pkt, true);
 
@@ -687,5 +762,6 @@ void net_ipv4_setup_fragment_buffers(void)
 	 */
 	for (int i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
 		k_work_init_delayable(&reassembly[i].timer, reassembly_timeout);
+		sys_slist_append(&reassembly_free, &reassembly[i].node);
 	}
 }
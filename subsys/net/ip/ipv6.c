@@ -322,6 +322,13 @@ static enum net_verdict ipv6_route_packet(struct net_pkt *pkt,
 	struct net_route_entry *route;
 	struct in6_addr *nexthop;
 	bool found;
+	int ret;
+
+	/* Fast path for the packets of the flows already forwarded */
+	ret = net_route_flow_packet(pkt, hdr);
+	if (ret != -ENOENT) {
+		return ret < 0 ? NET_DROP : NET_OK;
+	}
 
 	/* Check if the packet can be routed */
 	if (IS_ENABLED(CONFIG_NET_ROUTING)) {
@@ -334,8 +341,6 @@ static enum net_verdict ipv6_route_packet(struct net_pkt *pkt,
 	}
 
 	if (found) {
-		int ret;
-
 		if (IS_ENABLED(CONFIG_NET_ROUTING) &&
 		    (net_ipv6_is_ll_addr((struct in6_addr *)hdr->src) ||
 		     net_ipv6_is_ll_addr((struct in6_addr *)hdr->dst))) {
@@ -380,7 +385,6 @@ static enum net_verdict ipv6_route_packet(struct net_pkt *pkt,
 		}
 	} else {
 		struct net_if *iface = NULL;
-		int ret;
 
 		if (net_if_ipv6_addr_onlink(&iface, (struct in6_addr *)hdr->dst)) {
 			ret = net_route_packet_if(pkt, iface);
@@ -436,9 +436,21 @@ struct net_ipv6_reassembly {
 	 */
 	struct k_work_delayable timer;
 
-	/** Pointers to pending fragments */
+	/** Node in the hash table of pending reassemblies, or in the free list */
+	sys_snode_t node;
+
+	/** Pointers to pending fragments, sorted by offset */
 	struct net_pkt *pkt[CONFIG_NET_IPV6_FRAGMENT_MAX_PKT];
 
+	/** Payload bytes received in the pending fragments */
+	uint32_t received;
+
+	/** Payload length of the packet, zero until the last fragment is received */
+	uint32_t total_len;
+
+	/** Bytes held by the pending fragments */
+	uint32_t mem;
+
 	/** IPv6 fragment identification */
 	uint32_t id;
 };
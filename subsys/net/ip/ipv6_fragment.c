@@ -46,6 +46,15 @@ static bool reassembly_init_done;
 static struct net_ipv6_reassembly
 reassembly[CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
 
+/* Pending reassemblies are hashed on their identification and source address,
+ * the unused ones are kept in a free list.
+ */
+static sys_slist_t reassembly_hash_table[CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
+static sys_slist_t reassembly_free;
+
+/* Bytes held by the fragments of all the pending reassemblies */
+static size_t reassembly_mem;
+
 int net_ipv6_find_last_ext_hdr(struct net_pkt *pkt, uint16_t *next_hdr_off,
 			       uint16_t *last_hdr_off)
 {
@@ -120,86 +129,89 @@ fail:
 	return -EINVAL;
 }
 
+static sys_slist_t *reassembly_bucket(uint32_t id, const struct in6_addr *src)
+{
+	uint32_t hash = (id ^ UNALIGNED_GET(&src->s6_addr32[3])) * 2654435761U;
+
+	return &reassembly_hash_table[(hash >> 16) % CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
+}
+
 static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 						  struct in6_addr *src,
 						  struct in6_addr *dst)
 {
-	int i, avail = -1;
-
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		if (k_work_delayable_remaining_get(&reassembly[i].timer) &&
-		    reassembly[i].id == id &&
-		    net_ipv6_addr_cmp(src, &reassembly[i].src) &&
-		    net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
-			return &reassembly[i];
-		}
-
-		if (k_work_delayable_remaining_get(&reassembly[i].timer)) {
-			continue;
-		}
-
-		if (avail < 0) {
-			avail = i;
+	sys_slist_t *bucket = reassembly_bucket(id, src);
+	struct net_ipv6_reassembly *reass;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, reass, node) {
+		if (reass->id == id &&
+		    net_ipv6_addr_cmp(src, &reass->src) &&
+		    net_ipv6_addr_cmp(dst, &reass->dst)) {
+			return reass;
 		}
 	}
 
-	if (avail < 0) {
+	node = sys_slist_get(&reassembly_free);
+	if (node == NULL) {
 		return NULL;
 	}
 
-	k_work_reschedule(&reassembly[avail].timer, IPV6_REASSEMBLY_TIMEOUT);
+	reass = CONTAINER_OF(node, struct net_ipv6_reassembly, node);
+	sys_slist_prepend(bucket, &reass->node);
+
+	k_work_reschedule(&reass->timer, IPV6_REASSEMBLY_TIMEOUT);
 
-	net_ipaddr_copy(&reassembly[avail].src, src);
-	net_ipaddr_copy(&reassembly[avail].dst, dst);
+	net_ipaddr_copy(&reass->src, src);
+	net_ipaddr_copy(&reass->dst, dst);
 
-	reassembly[avail].id = id;
+	reass->id = id;
+	reass->received = 0U;
+	reass->total_len = 0U;
+	reass->mem = 0U;
 
-	return &reassembly[avail];
+	return reass;
 }
 
-static bool reassembly_cancel(uint32_t id,
-			      struct in6_addr *src,
-			      struct in6_addr *dst)
+static bool reassembly_cancel(struct net_ipv6_reassembly *reass)
 {
-	int i, j;
+	int32_t remaining;
+	int j;
 
-	NET_DBG("Cancel 0x%x", id);
+	NET_DBG("Cancel 0x%x", reass->id);
 
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		int32_t remaining;
-
-		if (reassembly[i].id != id ||
-		    !net_ipv6_addr_cmp(src, &reassembly[i].src) ||
-		    !net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
-			continue;
-		}
+	if (!sys_slist_find_and_remove(reassembly_bucket(reass->id, &reass->src),
+				       &reass->node)) {
+		/* Already reassembled or cancelled */
+		return false;
+	}
 
-		remaining = k_ticks_to_ms_ceil32(
-			k_work_delayable_remaining_get(&reassembly[i].timer));
-		k_work_cancel_delayable(&reassembly[i].timer);
+	remaining = k_ticks_to_ms_ceil32(
+		k_work_delayable_remaining_get(&reass->timer));
+	k_work_cancel_delayable(&reass->timer);
 
-		NET_DBG("IPv6 reassembly id 0x%x remaining %d ms",
-			reassembly[i].id, remaining);
+	NET_DBG("IPv6 reassembly id 0x%x remaining %d ms",
+		reass->id, remaining);
 
-		reassembly[i].id = 0U;
+	for (j = 0; j < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; j++) {
+		if (!reass->pkt[j]) {
+			continue;
+		}
 
-		for (j = 0; j < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; j++) {
-			if (!reassembly[i].pkt[j]) {
-				continue;
-			}
+		NET_DBG("[%d] IPv6 reassembly pkt %p %zd bytes data",
+			j, reass->pkt[j], net_pkt_get_len(reass->pkt[j]));
 
-			NET_DBG("[%d] IPv6 reassembly pkt %p %zd bytes data",
-				j, reassembly[i].pkt[j],
-				net_pkt_get_len(reassembly[i].pkt[j]));
+		net_pkt_unref(reass->pkt[j]);
+		reass->pkt[j] = NULL;
+	}
 
-			net_pkt_unref(reassembly[i].pkt[j]);
-			reassembly[i].pkt[j] = NULL;
-		}
+	reassembly_mem -= reass->mem;
+	reass->mem = 0U;
+	reass->id = 0U;
 
-		return true;
-	}
+	sys_slist_append(&reassembly_free, &reass->node);
 
-	return false;
+	return true;
 }
 
 static void reassembly_info(char *str, struct net_ipv6_reassembly *reass)
@@ -224,7 +236,47 @@ static void reassembly_timeout(struct k_work *work)
 		net_icmpv6_send_error(reass->pkt[0], NET_ICMPV6_TIME_EXCEEDED, 1, 0);
 	}
 
-	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+	reassembly_cancel(reass);
+}
+
+/* Make room for len more bytes of fragments under
+ * CONFIG_NET_IPV6_FRAGMENT_MAX_MEM by cancelling the oldest pending
+ * reassemblies, other than the one the fragment belongs to.
+ */
+static bool reassembly_reclaim(struct net_ipv6_reassembly *keep, size_t len)
+{
+	if (CONFIG_NET_IPV6_FRAGMENT_MAX_MEM == 0) {
+		return true;
+	}
+
+	while (reassembly_mem + len > CONFIG_NET_IPV6_FRAGMENT_MAX_MEM) {
+		struct net_ipv6_reassembly *oldest = NULL;
+		k_ticks_t oldest_remaining = 0;
+
+		for (int i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+			k_ticks_t remaining;
+
+			if (&reassembly[i] == keep || reassembly[i].mem == 0U) {
+				continue;
+			}
+
+			remaining = k_work_delayable_remaining_get(
+						&reassembly[i].timer);
+			if (oldest == NULL || remaining < oldest_remaining) {
+				oldest = &reassembly[i];
+				oldest_remaining = remaining;
+			}
+		}
+
+		if (oldest == NULL) {
+			return false;
+		}
+
+		reassembly_info("Reassembly evicted", oldest);
+		reassembly_cancel(oldest);
+	}
+
+	return true;
 }
 
 static void reassemble_packet(struct net_ipv6_reassembly *reass)
@@ -241,14 +293,13 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 	uint8_t next_hdr;
 	int i, len;
 
-	k_work_cancel_delayable(&reass->timer);
-
 	NET_ASSERT(reass->pkt[0]);
 
 	last = net_buf_frag_last(reass->pkt[0]->buffer);
 
 	/* We start from 2nd packet which is then appended to
-	 * the first one.
+	 * the first one. The fragments are stored sorted by offset,
+	 * so their buffers are chained in place without copying.
 	 */
 	for (i = 1; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
 		int removed_len;
@@ -271,7 +322,7 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 
 		if (net_pkt_pull(pkt, removed_len)) {
 			NET_ERR("Failed to pull headers");
-			reassembly_cancel(reass->id, &reass->src, &reass->dst);
+			reassembly_cancel(reass);
 			return;
 		}
 
@@ -288,6 +339,9 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 	pkt = reass->pkt[0];
 	reass->pkt[0] = NULL;
 
+	/* Release the slot, the packet now owns all the fragment buffers */
+	reassembly_cancel(reass);
+
 	/* Next we need to strip away the fragment header from the first packet
 	 * and set the various pointers and values in packet.
 	 */
@@ -370,63 +424,15 @@ void net_ipv6_frag_foreach(net_ipv6_frag_cb_t cb, void *user_data)
 	}
 }
 
-/* Verify that we have all the fragments received and in correct order.
- * Return:
- * - a negative value if the fragments are erroneous and must be dropped
- * - zero if we are expecting more fragments
- * - a positive value if we can proceed with the reassembly
- */
-static int fragments_are_ready(struct net_ipv6_reassembly *reass)
+static inline int fragment_payload_len(struct net_pkt *pkt)
 {
-	unsigned int expected_offset = 0;
-	bool more = true;
-	int i;
-
-	/* Fragments can arrive in any order, for example in reverse order:
-	 *   1 -> Fragment3(M=0, offset=x2)
-	 *   2 -> Fragment2(M=1, offset=x1)
-	 *   3 -> Fragment1(M=1, offset=0)
-	 * We have to test several requirements before proceeding with the reassembly:
-	 * - We received the first fragment (Fragment Offset is 0)
-	 * - All intermediate fragments are contiguous
-	 * - The More bit of the last fragment is 0
-	 */
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		struct net_pkt *pkt = reass->pkt[i];
-		unsigned int offset;
-		int payload_len;
-
-		if (!pkt) {
-			break;
-		}
-
-		offset = net_pkt_ipv6_fragment_offset(pkt);
-
-		if (offset < expected_offset) {
-			/* Overlapping or duplicated
-			 * According to RFC8200 we can drop it
-			 */
-			return -EBADMSG;
-		} else if (offset != expected_offset) {
-			/* Not contiguous, let's wait for fragments */
-			return 0;
-		}
-
-		payload_len = net_pkt_get_len(pkt) - net_pkt_ipv6_fragment_start(pkt);
-		payload_len -= sizeof(struct net_ipv6_frag_hdr);
-		if (payload_len < 0) {
-			return -EBADMSG;
-		}
-
-		expected_offset += payload_len;
-		more = net_pkt_ipv6_fragment_more(pkt);
-	}
-
-	if (more) {
-		return 0;
-	}
+	return net_pkt_get_len(pkt) - net_pkt_ipv6_fragment_start(pkt) -
+	       sizeof(struct net_ipv6_frag_hdr);
+}
 
-	return 1;
+static inline unsigned int fragment_end(struct net_pkt *pkt)
+{
+	return net_pkt_ipv6_fragment_offset(pkt) + fragment_payload_len(pkt);
 }
 
 static int shift_packets(struct net_ipv6_reassembly *reass, int pos)
@@ -457,15 +463,102 @@ static int shift_packets(struct net_ipv6_reassembly *reass, int pos)
 	return -ENOMEM;
 }
 
+/* Store a fragment in the reassembly, keeping the fragments sorted by offset.
+ *
+ * The stored fragments never overlap, so the received payload covers the
+ * whole packet once it equals the total length given by the last fragment
+ * (M flag is 0), whatever the order the fragments arrived in.
+ *
+ * Return:
+ * - zero if the fragment was stored
+ * - -EALREADY if the fragment duplicates a stored one and must be dropped alone
+ * - -EBADMSG if the fragment overlaps or contradicts the stored ones
+ * - -ENOMEM if there is no room left for the fragment
+ */
+static int fragment_insert(struct net_ipv6_reassembly *reass,
+			   struct net_pkt *pkt)
+{
+	unsigned int offset = net_pkt_ipv6_fragment_offset(pkt);
+	bool more = net_pkt_ipv6_fragment_more(pkt);
+	int payload_len = fragment_payload_len(pkt);
+	unsigned int total_len = reass->total_len;
+	unsigned int end;
+	int i;
+
+	if (payload_len < 0) {
+		return -EBADMSG;
+	}
+
+	end = offset + payload_len;
+
+	if (!more) {
+		if (total_len != 0U && total_len != end) {
+			return -EBADMSG;
+		}
+
+		total_len = end;
+	}
+
+	if ((total_len != 0U && end > total_len) || end > UINT16_MAX) {
+		return -EBADMSG;
+	}
+
+	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT && reass->pkt[i]; i++) {
+		if (net_pkt_ipv6_fragment_offset(reass->pkt[i]) >= offset) {
+			break;
+		}
+	}
+
+	if (i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT && reass->pkt[i] &&
+	    net_pkt_ipv6_fragment_offset(reass->pkt[i]) == offset &&
+	    fragment_end(reass->pkt[i]) == end) {
+		return -EALREADY;
+	}
+
+	/* Overlapping fragments, according to RFC 8200 the whole
+	 * reassembly must be abandoned.
+	 */
+	if (i > 0 && fragment_end(reass->pkt[i - 1]) > offset) {
+		return -EBADMSG;
+	}
+
+	if (i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT && reass->pkt[i] &&
+	    net_pkt_ipv6_fragment_offset(reass->pkt[i]) < end) {
+		return -EBADMSG;
+	}
+
+	/* The last fragment must not be followed by stored ones */
+	if (!more && i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT && reass->pkt[i]) {
+		return -EBADMSG;
+	}
+
+	if (i == CONFIG_NET_IPV6_FRAGMENT_MAX_PKT) {
+		return -ENOMEM;
+	}
+
+	/* Make room for this fragment */
+	if (reass->pkt[i] && shift_packets(reass, i)) {
+		return -ENOMEM;
+	}
+
+	NET_DBG("Storing pkt %p to slot %d offset %d", pkt, i, offset);
+
+	reass->pkt[i] = pkt;
+	reass->received += payload_len;
+	reass->total_len = total_len;
+
+	return 0;
+}
+
 enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 					      struct net_ipv6_hdr *hdr,
 					      uint8_t nexthdr)
 {
 	struct net_ipv6_reassembly *reass = NULL;
 	uint16_t flag;
-	bool found;
 	uint8_t more;
 	uint32_t id;
+	size_t len;
 	int ret;
 	int i;
 
@@ -476,6 +569,8 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
 			k_work_init_delayable(&reassembly[i].timer,
 					      reassembly_timeout);
+			sys_slist_append(&reassembly_free,
+					 &reassembly[i].node);
 		}
 
 		reassembly_init_done = true;
@@ -509,57 +604,43 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		 */
 		net_icmpv6_send_error(pkt, NET_ICMPV6_PARAM_PROBLEM,
 				      NET_ICMPV6_PARAM_PROB_HEADER, NET_IPV6H_LENGTH_OFFSET);
+		net_pkt_unref(pkt);
 		goto drop;
 	}
 
-	/* The fragments might come in wrong order so place them
-	 * in reassembly chain in correct order.
-	 */
-	for (i = 0, found = false; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv6_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv6_fragment_offset(pkt)) {
-				continue;
-			}
-
-			/* Make room for this fragment. If there is no room,
-			 * then it will discard the whole reassembly.
-			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
-		}
-
-		NET_DBG("Storing pkt %p to slot %d offset %d",
-			pkt, i, net_pkt_ipv6_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
+	len = net_pkt_get_len(pkt);
 
-		break;
+	if (!reassembly_reclaim(reass, len)) {
+		NET_DBG("Fragment memory limit reached, dropping id %u",
+			reass->id);
+		net_pkt_unref(pkt);
+		goto drop;
 	}
 
-	if (!found) {
+	ret = fragment_insert(reass, pkt);
+	if (ret == -EALREADY) {
+		NET_DBG("Duplicate fragment offset %d for 0x%x, dropping pkt %p",
+			net_pkt_ipv6_fragment_offset(pkt), reass->id, pkt);
+		net_pkt_unref(pkt);
+		goto accept;
+	} else if (ret == -ENOMEM) {
 		/* We could not add this fragment into our saved fragment
 		 * list. We must discard the whole packet at this point.
 		 */
 		NET_DBG("No slots available for 0x%x", reass->id);
 		net_pkt_unref(pkt);
 		goto drop;
-	}
-
-	ret = fragments_are_ready(reass);
-	if (ret < 0) {
+	} else if (ret < 0) {
 		NET_DBG("Reassembled IPv6 verify failed, dropping id %u",
 			reass->id);
-
-		/* Let the caller release the already inserted pkt */
-		if (i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
-
 		net_pkt_unref(pkt);
 		goto drop;
-	} else if (ret == 0) {
+	}
+
+	reass->mem += len;
+	reassembly_mem += len;
+
+	if (reass->total_len == 0U || reass->received < reass->total_len) {
 		reassembly_info("Reassembly nth pkt", reass);
 
 		NET_DBG("More fragments to be received");
@@ -576,7 +657,7 @@ accept:
 
 drop:
 	if (reass) {
-		if (reassembly_cancel(reass->id, &reass->src, &reass->dst)) {
+		if (reassembly_cancel(reass)) {
 			return NET_OK;
 		}
 	}
@@ -404,6 +404,13 @@ int net_try_send_data(struct net_pkt *pkt, k_timeout_t timeout)
 		goto err;
 	}
 
+#if defined(CONFIG_NET_TCP_GSO)
+	if (net_gso_needed(pkt)) {
+		ret = net_gso_send(pkt, timeout);
+		goto err;
+	}
+#endif
+
 	net_pkt_trim_buffer(pkt);
 	net_pkt_cursor_init(pkt);
 
@@ -0,0 +1,218 @@
+/** @file
+ * @brief Generic receive offload for TCP
+ *
+ * Consecutive in-order TCP segments of a connection waiting in an RX
+ * traffic class queue are merged into a single packet, so that the
+ * stack and the application process them only once.
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tc, CONFIG_NET_TC_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "net_private.h"
+
+#define GRO_TCP_PSH BIT(3)
+#define GRO_TCP_ACK BIT(4)
+
+/* More fragments flag and fragment offset of the IPv4 header */
+#define GRO_IPV4_FRAG_MASK 0x3fff
+
+struct gro_hdrs {
+	struct net_eth_hdr *eth;
+	struct net_ipv4_hdr *ipv4;
+	struct net_ipv6_hdr *ipv6;
+	struct net_tcp_hdr *tcp;
+	/* Length of the IP packet, headers included */
+	size_t ip_len;
+	/* Length of the headers, from the Ethernet one to the TCP one */
+	size_t hdr_len;
+	size_t tcp_hdr_len;
+	size_t payload_len;
+};
+
+/* Locate the headers of a plain TCP data segment in the first buffer of
+ * pkt, the checksums of which were verified by the network device.
+ */
+static bool gro_parse(struct net_pkt *pkt, struct gro_hdrs *h)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+	struct net_buf *buf = pkt->buffer;
+	size_t l3_len;
+
+	if (buf == NULL || net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    buf->len < sizeof(struct net_eth_hdr)) {
+		return false;
+	}
+
+	memset(h, 0, sizeof(*h));
+	h->eth = (struct net_eth_hdr *)buf->data;
+
+	switch (ntohs(h->eth->type)) {
+	case NET_ETH_PTYPE_IP:
+		if (!IS_ENABLED(CONFIG_NET_IPV4) ||
+		    net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV4_TCP)) {
+			return false;
+		}
+
+		l3_len = sizeof(struct net_ipv4_hdr);
+		if (buf->len < sizeof(struct net_eth_hdr) + l3_len) {
+			return false;
+		}
+
+		h->ipv4 = (struct net_ipv4_hdr *)(h->eth + 1);
+		if (h->ipv4->vhl != 0x45 || h->ipv4->proto != IPPROTO_TCP ||
+		    (sys_get_be16(h->ipv4->offset) & GRO_IPV4_FRAG_MASK) != 0) {
+			return false;
+		}
+
+		h->ip_len = ntohs(h->ipv4->len);
+		break;
+	case NET_ETH_PTYPE_IPV6:
+		if (!IS_ENABLED(CONFIG_NET_IPV6) ||
+		    net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV6_TCP)) {
+			return false;
+		}
+
+		l3_len = sizeof(struct net_ipv6_hdr);
+		if (buf->len < sizeof(struct net_eth_hdr) + l3_len) {
+			return false;
+		}
+
+		h->ipv6 = (struct net_ipv6_hdr *)(h->eth + 1);
+		if ((h->ipv6->vtc & 0xf0) != 0x60 || h->ipv6->nexthdr != IPPROTO_TCP) {
+			return false;
+		}
+
+		h->ip_len = l3_len + ntohs(h->ipv6->len);
+		break;
+	default:
+		return false;
+	}
+
+	if (buf->len < sizeof(struct net_eth_hdr) + l3_len + sizeof(struct net_tcp_hdr)) {
+		return false;
+	}
+
+	h->tcp = (struct net_tcp_hdr *)(buf->data + sizeof(struct net_eth_hdr) + l3_len);
+	h->tcp_hdr_len = (h->tcp->offset >> 4) * 4U;
+	h->hdr_len = sizeof(struct net_eth_hdr) + l3_len + h->tcp_hdr_len;
+
+	/* Frames padded by the link layer are left alone */
+	if (h->tcp_hdr_len < sizeof(struct net_tcp_hdr) || buf->len < h->hdr_len ||
+	    h->ip_len <= l3_len + h->tcp_hdr_len ||
+	    net_pkt_get_len(pkt) != sizeof(struct net_eth_hdr) + h->ip_len) {
+		return false;
+	}
+
+	if ((h->tcp->flags & ~GRO_TCP_PSH) != GRO_TCP_ACK) {
+		return false;
+	}
+
+	h->payload_len = h->ip_len - l3_len - h->tcp_hdr_len;
+
+	return true;
+}
+
+static bool gro_same_flow(const struct gro_hdrs *a, const struct gro_hdrs *b)
+{
+	if (memcmp(a->eth, b->eth, sizeof(struct net_eth_hdr)) != 0) {
+		return false;
+	}
+
+	if (a->ipv4 != NULL) {
+		if (a->ipv4->tos != b->ipv4->tos || a->ipv4->ttl != b->ipv4->ttl ||
+		    memcmp(a->ipv4->src, b->ipv4->src, sizeof(a->ipv4->src)) != 0 ||
+		    memcmp(a->ipv4->dst, b->ipv4->dst, sizeof(a->ipv4->dst)) != 0) {
+			return false;
+		}
+	} else {
+		/* Traffic class and flow label */
+		if (memcmp(a->ipv6, b->ipv6, 4) != 0 ||
+		    a->ipv6->hop_limit != b->ipv6->hop_limit ||
+		    memcmp(a->ipv6->src, b->ipv6->src, sizeof(a->ipv6->src)) != 0 ||
+		    memcmp(a->ipv6->dst, b->ipv6->dst, sizeof(a->ipv6->dst)) != 0) {
+			return false;
+		}
+	}
+
+	return a->tcp->src_port == b->tcp->src_port &&
+	       a->tcp->dst_port == b->tcp->dst_port;
+}
+
+bool net_gro_can_merge(struct net_pkt *head, struct net_pkt *next)
+{
+	struct gro_hdrs h;
+	struct gro_hdrs n;
+
+	if (net_pkt_iface(head) != net_pkt_iface(next) ||
+	    !gro_parse(head, &h) || !gro_parse(next, &n) || !gro_same_flow(&h, &n)) {
+		return false;
+	}
+
+	/* A pushed segment ends the merge, as would a new acknowledgment,
+	 * window or set of options.
+	 */
+	if ((h.tcp->flags & GRO_TCP_PSH) != 0U || h.tcp_hdr_len != n.tcp_hdr_len ||
+	    memcmp(h.tcp->ack, n.tcp->ack, sizeof(h.tcp->ack)) != 0 ||
+	    memcmp(h.tcp->wnd, n.tcp->wnd, sizeof(h.tcp->wnd)) != 0 ||
+	    memcmp(h.tcp->optdata, n.tcp->optdata,
+		   h.tcp_hdr_len - sizeof(struct net_tcp_hdr)) != 0) {
+		return false;
+	}
+
+	if (sys_get_be32(n.tcp->seq) != sys_get_be32(h.tcp->seq) + h.payload_len) {
+		return false;
+	}
+
+	/* The IPv4 total length and the IPv6 payload length are 16 bits */
+	return h.ip_len + n.payload_len <= UINT16_MAX;
+}
+
+void net_gro_merge(struct net_pkt *head, struct net_pkt *next)
+{
+	struct net_buf *frags = next->buffer;
+	struct gro_hdrs h;
+	struct gro_hdrs n;
+	uint16_t len;
+
+	(void)gro_parse(head, &h);
+	(void)gro_parse(next, &n);
+
+	if (h.ipv4 != NULL) {
+		len = h.ipv4->len;
+		h.ipv4->len = htons(h.ip_len + n.payload_len);
+		h.ipv4->chksum = net_chksum_update_u16(h.ipv4->chksum, len, h.ipv4->len);
+	} else {
+		h.ipv6->len = htons(h.ip_len - sizeof(struct net_ipv6_hdr) + n.payload_len);
+	}
+
+	h.tcp->flags |= n.tcp->flags & GRO_TCP_PSH;
+
+	/* Only the payload of the segment is kept */
+	next->buffer = NULL;
+	net_buf_pull(frags, n.hdr_len);
+	if (frags->len == 0U) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	if (frags != NULL) {
+		net_pkt_append_buffer(head, frags);
+	}
+
+	net_pkt_unref(next);
+
+	NET_DBG("Merged %zu bytes into pkt %p", n.payload_len, head);
+}
@@ -0,0 +1,204 @@
+/** @file
+ * @brief Generic segmentation offload for TCP
+ *
+ * TCP hands down packets carrying several segments worth of data. Unless
+ * the network device splits them itself, they are split here just before
+ * being sent.
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_core, CONFIG_NET_CORE_LOG_LEVEL);
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+
+#define GSO_TCP_FIN BIT(0)
+#define GSO_TCP_PSH BIT(3)
+
+bool net_gso_needed(struct net_pkt *pkt)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+
+	if (net_pkt_gso_size(pkt) == 0U) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_L2_ETHERNET) &&
+	    net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET) &&
+	    (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO)) {
+		return false;
+	}
+
+	return true;
+}
+
+/* Build the segment made of the headers of pkt followed by len bytes of
+ * its payload, starting at offset.
+ */
+static struct net_pkt *gso_segment(struct net_pkt *pkt, size_t hdr_len,
+				   size_t offset, size_t len, k_timeout_t timeout)
+{
+	struct net_pkt *seg;
+
+	/* The segment inherits the attributes of pkt, but not its data */
+	seg = net_pkt_shallow_clone(pkt, timeout);
+	if (seg == NULL) {
+		return NULL;
+	}
+
+	net_pkt_frag_unref(seg->buffer);
+	seg->buffer = NULL;
+	net_pkt_set_gso_size(seg, 0U);
+
+	if (net_pkt_alloc_buffer_raw(seg, hdr_len + len, timeout) < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) < 0) {
+		goto fail;
+	}
+
+	if (net_pkt_skip(pkt, offset) < 0 || net_pkt_copy(seg, pkt, len) < 0) {
+		goto fail;
+	}
+
+	return seg;
+
+fail:
+	net_pkt_unref(seg);
+
+	return NULL;
+}
+
+static int gso_finalize(struct net_pkt *seg, size_t ip_len, uint32_t seq,
+			bool last)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp;
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, ip_len) < 0) {
+		return -ENOBUFS;
+	}
+
+	tcp = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (tcp == NULL) {
+		return -ENOBUFS;
+	}
+
+	sys_put_be32(seq, tcp->seq);
+
+	/* Only the last segment ends the data pushed by TCP */
+	if (!last) {
+		tcp->flags &= ~(GSO_TCP_PSH | GSO_TCP_FIN);
+	}
+
+	if (net_pkt_set_data(seg, &tcp_access) < 0) {
+		return -ENOBUFS;
+	}
+
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		return net_ipv4_finalize(seg, IPPROTO_TCP);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(seg) == AF_INET6) {
+		return net_ipv6_finalize(seg, IPPROTO_TCP);
+	}
+
+	return -EINVAL;
+}
+
+int net_gso_send(struct net_pkt *pkt, k_timeout_t timeout)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	size_t mss = net_pkt_gso_size(pkt);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	struct net_tcp_hdr *tcp;
+	struct net_pkt *seg;
+	size_t hdr_len;
+	size_t payload_len;
+	size_t offset;
+	size_t len;
+	uint32_t seq;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, ip_len) < 0) {
+		return -EINVAL;
+	}
+
+	tcp = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (tcp == NULL) {
+		return -ENOBUFS;
+	}
+
+	hdr_len = ip_len + (tcp->offset >> 4) * 4U;
+	seq = sys_get_be32(tcp->seq);
+
+	if (net_pkt_get_len(pkt) <= hdr_len) {
+		return -EINVAL;
+	}
+
+	payload_len = net_pkt_get_len(pkt) - hdr_len;
+
+	for (offset = 0U; offset < payload_len; offset += len) {
+		len = MIN(mss, payload_len - offset);
+
+		seg = gso_segment(pkt, hdr_len, offset, len, timeout);
+		if (seg == NULL) {
+			ret = -ENOBUFS;
+			goto fail;
+		}
+
+		ret = gso_finalize(seg, ip_len, seq + offset,
+				   offset + len == payload_len);
+		if (ret == 0) {
+			ret = net_try_send_data(seg, timeout);
+		}
+
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			goto fail;
+		}
+	}
+
+	NET_DBG("Sent pkt %p as %zu segments", pkt, DIV_ROUND_UP(payload_len, mss));
+
+	net_pkt_unref(pkt);
+
+	return 0;
+
+fail:
+	if (offset == 0U) {
+		/* Nothing was sent, the caller still owns pkt */
+		return ret;
+	}
+
+	/* The remaining segments are lost, as if dropped on the way */
+	NET_DBG("Dropped %zu bytes of pkt %p (%d)", payload_len - offset, pkt, ret);
+	net_pkt_unref(pkt);
+
+	return 0;
+}
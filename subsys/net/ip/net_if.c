@@ -6204,8 +6204,14 @@ void net_if_call_timestamp_cb(struct net_pkt *pkt)
 
 void net_if_add_tx_timestamp(struct net_pkt *pkt)
 {
-	k_fifo_put(&tx_ts_queue, pkt);
+	if (IS_ENABLED(CONFIG_NET_PKT_TIMESTAMP_DIRECT) && !k_is_in_isr()) {
+		net_if_call_timestamp_cb(pkt);
+		return;
+	}
+
+	/* The driver may release the packet as soon as it is queued */
 	net_pkt_ref(pkt);
+	k_fifo_put(&tx_ts_queue, pkt);
 }
 #endif /* CONFIG_NET_PKT_TIMESTAMP_THREAD */
 
@@ -941,26 +941,25 @@ static struct net_buf *pkt_alloc_buffer(struct net_pkt *pkt,
 	ARG_UNUSED(pkt);
 #endif
 
-	k_timepoint_t end = sys_timepoint_calc(timeout);
-	struct net_buf *first = NULL;
-	struct net_buf *current = NULL;
+	size_t frag_size = pool->alloc->max_alloc_size;
+	struct net_buf *first;
+	struct net_buf *current;
+	size_t count;
 
-	do {
-		struct net_buf *new;
+	/* All the fragments are taken from the pool at once */
+	count = MAX(DIV_ROUND_UP(size + headroom, frag_size), 1);
 
-		new = net_buf_alloc_fixed(pool, timeout);
-		if (!new) {
-			goto error;
-		}
-
-		if (!first && !current) {
-			first = new;
-		} else {
-			current->frags = new;
+	first = net_buf_alloc_bulk(pool, frag_size, count, timeout);
+	if (!first) {
+#if defined(CONFIG_NET_PKT_ALLOC_STATS)
+		if (NET_PKT_ALLOC_STATS_FAIL(pkt, total_size, start_time) == 0) {
+			NET_DBG("pkt %p %s stats rollover", pkt, "fail");
 		}
+#endif
+		return NULL;
+	}
 
-		current = new;
-
+	for (current = first; current; current = current->frags) {
 		/* If there is headroom reserved, then allocate that to the
 		 * first buf.
 		 */
@@ -980,18 +979,16 @@ static struct net_buf *pkt_alloc_buffer(struct net_pkt *pkt,
 			size -= current->size;
 		}
 
-		timeout = sys_timepoint_timeout(end);
-
 #if CONFIG_NET_PKT_LOG_LEVEL >= LOG_LEVEL_DBG
-		NET_FRAG_CHECK_IF_NOT_IN_USE(new, new->ref + 1);
+		NET_FRAG_CHECK_IF_NOT_IN_USE(current, current->ref + 1);
 
-		net_pkt_alloc_add(new, false, caller, line);
+		net_pkt_alloc_add(current, false, caller, line);
 
 		NET_DBG("%s (%s) [%d] frag %p ref %d (%s():%d)",
 			pool2str(pool), get_name(pool), get_frees(pool),
-			new, new->ref, caller, line);
+			current, current->ref, caller, line);
 #endif
-	} while (size);
+	}
 
 #if defined(CONFIG_NET_PKT_ALLOC_STATS)
 	if (NET_PKT_ALLOC_STATS_UPDATE(pkt, total_size, start_time) == 0) {
@@ -1000,18 +997,6 @@ static struct net_buf *pkt_alloc_buffer(struct net_pkt *pkt,
 #endif
 
 	return first;
-error:
-	if (first) {
-		net_buf_unref(first);
-	}
-
-#if defined(CONFIG_NET_PKT_ALLOC_STATS)
-	if (NET_PKT_ALLOC_STATS_FAIL(pkt, total_size, start_time) == 0) {
-		NET_DBG("pkt %p %s stats rollover", pkt, "fail");
-	}
-#endif
-
-	return NULL;
 }
 
 #else /* !CONFIG_NET_BUF_FIXED_DATA_SIZE */
@@ -1460,34 +1445,9 @@ int net_pkt_alloc_buffer_raw(struct net_pkt *pkt, size_t size,
 	return 0;
 }
 
-#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
-static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout,
-				 const char *caller, int line)
-#else
-static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
-#endif
+static void pkt_setup(struct net_pkt *pkt, struct k_mem_slab *slab,
+		      uint32_t create_time)
 {
-	struct net_pkt *pkt;
-	uint32_t create_time;
-	int ret;
-
-	if (k_is_in_isr()) {
-		timeout = K_NO_WAIT;
-	}
-
-	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
-	    IS_ENABLED(CONFIG_NET_PKT_TXTIME_STATS) ||
-	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
-		create_time = k_cycle_get_32();
-	} else {
-		ARG_UNUSED(create_time);
-	}
-
-	ret = k_mem_slab_alloc(slab, (void **)&pkt, timeout);
-	if (ret) {
-		return NULL;
-	}
-
 	memset(pkt, 0, sizeof(struct net_pkt));
 
 	pkt->atomic_ref = ATOMIC_INIT(1);
@@ -1522,6 +1482,37 @@ static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
 	}
 
 	net_pkt_set_vlan_tag(pkt, NET_VLAN_TAG_UNSPEC);
+}
+
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
+static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout,
+				 const char *caller, int line)
+#else
+static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
+#endif
+{
+	struct net_pkt *pkt;
+	uint32_t create_time;
+	int ret;
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_NET_PKT_TXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		create_time = k_cycle_get_32();
+	} else {
+		create_time = 0U;
+	}
+
+	ret = k_mem_slab_alloc(slab, (void **)&pkt, timeout);
+	if (ret) {
+		return NULL;
+	}
+
+	pkt_setup(pkt, slab, create_time);
 
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 	net_pkt_alloc_add(pkt, true, caller, line);
@@ -1641,6 +1632,153 @@ struct net_pkt *net_pkt_rx_alloc_on_iface(struct net_if *iface,
 #endif
 }
 
+#if defined(CONFIG_NET_PKT_RX_CACHE)
+/* RX packets paired with a data buffer, owned by a single thread. Only
+ * the owner touches the pairs, so taking one needs no lock.
+ */
+struct pkt_rx_cache {
+	atomic_ptr_t owner;
+	uint8_t count;
+	struct {
+		struct net_pkt *pkt;
+		struct net_buf *buf;
+	} pairs[CONFIG_NET_PKT_RX_CACHE_SIZE];
+};
+
+static struct pkt_rx_cache pkt_rx_caches[CONFIG_NET_PKT_RX_CACHE_THREADS];
+
+#if defined(CONFIG_NET_PKT_ALLOC_STATS)
+#define PKT_RX_CACHE_STATS_INC(field) ({				\
+	static struct net_pkt_alloc_stats_slab *stats;			\
+	if (stats == NULL) {						\
+		stats = find_alloc_stats(&rx_pkts);			\
+	}								\
+	stats->field++;							\
+})
+#else
+#define PKT_RX_CACHE_STATS_INC(field)
+#endif
+
+static struct pkt_rx_cache *pkt_rx_cache_get(void)
+{
+	k_tid_t current = k_current_get();
+
+	/* Caches are never released, so a thread owning one has no
+	 * free cache before it.
+	 */
+	ARRAY_FOR_EACH_PTR(pkt_rx_caches, cache) {
+		if (atomic_ptr_get(&cache->owner) == current ||
+		    atomic_ptr_cas(&cache->owner, NULL, current)) {
+			return cache;
+		}
+	}
+
+	return NULL;
+}
+
+static void pkt_rx_cache_refill(struct pkt_rx_cache *cache)
+{
+	while (cache->count < ARRAY_SIZE(cache->pairs)) {
+		struct net_pkt *pkt;
+		struct net_buf *buf;
+
+		if (k_mem_slab_alloc(&rx_pkts, (void **)&pkt, K_NO_WAIT) < 0) {
+			break;
+		}
+
+		buf = net_buf_alloc_fixed(&rx_bufs, K_NO_WAIT);
+		if (buf == NULL) {
+			k_mem_slab_free(&rx_pkts, pkt);
+			break;
+		}
+
+		cache->pairs[cache->count].pkt = pkt;
+		cache->pairs[cache->count].buf = buf;
+		cache->count++;
+	}
+
+	if (cache->count > 0U) {
+		PKT_RX_CACHE_STATS_INC(cache_refills);
+	}
+}
+
+/* Allocate an RX packet and its buffer from the cache of the current
+ * thread. Returns -ENOENT if the cache cannot be used.
+ */
+static int pkt_rx_cache_alloc(struct net_pkt **ret_pkt, struct net_if *iface,
+			      size_t size, sa_family_t family,
+			      enum net_ip_protocol proto, k_timeout_t timeout)
+{
+	struct pkt_rx_cache *cache;
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+	uint32_t start_time;
+	size_t len;
+
+	/* Packets without buffer are not cached */
+	if (k_is_in_isr() || (!size && proto == 0 && family == AF_UNSPEC)) {
+		return -ENOENT;
+	}
+
+	cache = pkt_rx_cache_get();
+	if (cache == NULL) {
+		return -ENOENT;
+	}
+
+	if (cache->count == 0U) {
+		pkt_rx_cache_refill(cache);
+		if (cache->count == 0U) {
+			return -ENOENT;
+		}
+	}
+
+	start_time = k_cycle_get_32();
+
+	cache->count--;
+	pkt = cache->pairs[cache->count].pkt;
+	buf = cache->pairs[cache->count].buf;
+
+	pkt_setup(pkt, &rx_pkts, start_time);
+	net_pkt_set_iface(pkt, iface);
+	net_pkt_set_family(pkt, family);
+	net_pkt_cursor_init(pkt);
+
+	/* Same length as net_pkt_alloc_buffer() would allocate */
+	len = pkt_buffer_length(pkt, size + pkt_estimate_headers_length(pkt, family, proto),
+				proto, 0);
+
+	if (buf->size > len) {
+		buf->size = len;
+	}
+
+	len -= buf->size;
+	net_pkt_append_buffer(pkt, buf);
+
+	if (len > 0U) {
+		buf = pkt_alloc_buffer(pkt, &rx_bufs, len, 0U, timeout);
+		if (buf == NULL) {
+			net_pkt_unref(pkt);
+			return -ENOMEM;
+		}
+
+		/* The stats were updated by pkt_alloc_buffer() */
+		net_pkt_append_buffer(pkt, buf);
+	} else {
+#if defined(CONFIG_NET_PKT_ALLOC_STATS)
+		if (NET_PKT_ALLOC_STATS_UPDATE(pkt, buf->size, start_time) == 0) {
+			NET_DBG("pkt %p %s stats rollover", pkt, "ok");
+		}
+#endif
+	}
+
+	PKT_RX_CACHE_STATS_INC(cache_hits);
+
+	*ret_pkt = pkt;
+
+	return 0;
+}
+#endif /* CONFIG_NET_PKT_RX_CACHE */
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 static struct net_pkt *
 pkt_alloc_with_buffer(struct k_mem_slab *slab,
@@ -1672,6 +1810,15 @@ pkt_alloc_with_buffer(struct k_mem_slab *slab,
 	NET_DBG("On iface %d (%p) size %zu", net_if_get_by_iface(iface), iface, size);
 #endif /* CONFIG_NET_RAW_MODE */
 
+#if defined(CONFIG_NET_PKT_RX_CACHE)
+	if (slab == &rx_pkts) {
+		ret = pkt_rx_cache_alloc(&pkt, iface, size, family, proto, timeout);
+		if (ret != -ENOENT) {
+			return ret == 0 ? pkt : NULL;
+		}
+	}
+#endif
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 	pkt = pkt_alloc_on_iface(slab, iface, timeout, caller, line);
 #else
@@ -2052,6 +2199,11 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
 	net_pkt_set_ll_proto_type(clone_pkt, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
+
+	if (net_pkt_rx_queue(pkt) >= 0) {
+		net_pkt_set_rx_queue(clone_pkt, net_pkt_rx_queue(pkt));
+	}
 
 #if defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_L2_IPIP)
 	net_pkt_set_remote_address(clone_pkt, net_pkt_remote_address(pkt),
@@ -281,6 +281,59 @@ extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
 
+/* Incremental update of an Internet checksum after a 16-bit field of the
+ * covered data changed from old_val to new_val (RFC 1624, eqn. 3). The
+ * checksum and the values are taken as stored in the packet, no byte order
+ * conversion is needed.
+ */
+static inline uint16_t net_chksum_update_u16(uint16_t chksum, uint16_t old_val,
+					     uint16_t new_val)
+{
+	uint32_t sum = (uint16_t)~chksum + (uint16_t)~old_val + new_val;
+
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+
+	return ~sum;
+}
+
+/* Same as net_chksum_update_u16() for a 32-bit field, e.g. an IPv4 address */
+static inline uint16_t net_chksum_update_u32(uint16_t chksum, uint32_t old_val,
+					     uint32_t new_val)
+{
+	chksum = net_chksum_update_u16(chksum, old_val >> 16, new_val >> 16);
+
+	return net_chksum_update_u16(chksum, old_val & 0xffff, new_val & 0xffff);
+}
+
+/* Received checksums are verified in software unless the interface offloads
+ * them. Reassembled packets were never seen whole by the hardware, so their
+ * checksums are always verified.
+ */
+static inline bool net_pkt_need_calc_rx_chksum(struct net_pkt *pkt,
+					       enum net_if_checksum_type type)
+{
+	return net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
+	       net_pkt_is_ip_reassembled(pkt);
+}
+
+#if defined(CONFIG_NET_TCP_GRO)
+/* Tells if the received TCP segment in next directly follows the one of
+ * head, in which case net_gro_merge() appends its payload to head and
+ * releases next.
+ */
+bool net_gro_can_merge(struct net_pkt *head, struct net_pkt *next);
+void net_gro_merge(struct net_pkt *head, struct net_pkt *next);
+#endif
+
+#if defined(CONFIG_NET_TCP_GSO)
+/* Tells if pkt carries several TCP segments which are to be split in
+ * software, in which case net_gso_send() sends them one by one.
+ */
+bool net_gso_needed(struct net_pkt *pkt);
+int net_gso_send(struct net_pkt *pkt, k_timeout_t timeout);
+#endif
+
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
  *        to the upper layers
@@ -13,16 +13,27 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/byteorder.h>
 
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
 
+#if defined(CONFIG_NET_TC_RX_QUEUES)
+#define NET_TC_RX_QUEUES CONFIG_NET_TC_RX_QUEUES
+#else
+#define NET_TC_RX_QUEUES 1
+#endif
+
+/* Each RX traffic class has NET_TC_RX_QUEUES queues, with a thread each */
+#define NET_TC_RX_THREADS (NET_TC_RX_COUNT * NET_TC_RX_QUEUES)
+
 #define TC_RX_PSEUDO_QUEUE (COND_CODE_1(CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO, (1), (0)))
 #define NET_TC_RX_EFFECTIVE_COUNT (NET_TC_RX_COUNT + TC_RX_PSEUDO_QUEUE)
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
-#define NET_TC_RX_SLOTS (CONFIG_NET_PKT_RX_COUNT / NET_TC_RX_EFFECTIVE_COUNT)
+#define NET_TC_RX_SLOTS (CONFIG_NET_PKT_RX_COUNT / (NET_TC_RX_THREADS + TC_RX_PSEUDO_QUEUE))
 BUILD_ASSERT(NET_TC_RX_SLOTS > 0,
 		"Misconfiguration: There are more traffic classes then packets, "
 		"either increase CONFIG_NET_PKT_RX_COUNT or decrease "
@@ -46,15 +57,16 @@ BUILD_ASSERT(NET_TC_TX_SLOTS > 0,
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * If a RX traffic class has several queues, "q[y.z]" denotes its queue z.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[y.z]")
 
 /* Stacks for TX work queue */
 K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_THREADS,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
@@ -62,8 +74,150 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_THREADS];
+#endif
+
+#if defined(CONFIG_NET_TC_TX_SHAPER)
+/* The credit is kept in bytes times ticks per second, so that refilling it
+ * with the elapsed ticks does not lose any rounding.
+ */
+struct tc_tx_shaper {
+	struct k_spinlock lock;
+	uint32_t rate;
+	int64_t credit;
+	int64_t hi_credit;
+	int64_t last;
+	struct net_tc_tx_shaper_stats stats;
+};
+
+static struct tc_tx_shaper tx_shapers[NET_TC_TX_COUNT];
+
+/* Must be called with the shaper lock held */
+static void tc_tx_shaper_refill(struct tc_tx_shaper *shaper)
+{
+	int64_t now = k_uptime_ticks();
+	int64_t elapsed = now - shaper->last;
+
+	shaper->last = now;
+
+	if (shaper->credit >= shaper->hi_credit) {
+		return;
+	}
+
+	if (elapsed > (shaper->hi_credit - shaper->credit) / shaper->rate) {
+		shaper->credit = shaper->hi_credit;
+	} else {
+		shaper->credit += elapsed * shaper->rate;
+	}
+}
+
+static void tc_tx_shape(uint8_t tc, struct net_pkt *pkt)
+{
+	struct tc_tx_shaper *shaper = &tx_shapers[tc];
+	size_t len = net_pkt_get_len(pkt);
+	k_spinlock_key_t key;
+	int64_t start;
+	int64_t wait;
+
+	key = k_spin_lock(&shaper->lock);
+
+	if (shaper->rate > 0U) {
+		tc_tx_shaper_refill(shaper);
+
+		if (shaper->credit < 0) {
+			start = k_uptime_get();
+			shaper->stats.delayed++;
+
+			/* Other classes are served while this one sleeps */
+			do {
+				wait = DIV_ROUND_UP(-shaper->credit, shaper->rate);
+				k_spin_unlock(&shaper->lock, key);
+
+				k_sleep(K_TICKS(wait));
+
+				key = k_spin_lock(&shaper->lock);
+				if (shaper->rate == 0U) {
+					break;
+				}
+
+				tc_tx_shaper_refill(shaper);
+			} while (shaper->credit < 0);
+
+			shaper->stats.delay_ms += (uint32_t)(k_uptime_get() - start);
+		}
+
+		shaper->credit -= (int64_t)len * CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+	}
+
+	shaper->stats.pkts++;
+	shaper->stats.bytes += len;
+
+	k_spin_unlock(&shaper->lock, key);
+}
+
+static void tc_tx_shaper_dropped(uint8_t tc)
+{
+	k_spinlock_key_t key = k_spin_lock(&tx_shapers[tc].lock);
+
+	tx_shapers[tc].stats.dropped++;
+	k_spin_unlock(&tx_shapers[tc].lock, key);
+}
+#else
+#define tc_tx_shape(...)
+#define tc_tx_shaper_dropped(...)
+#endif /* CONFIG_NET_TC_TX_SHAPER */
+
+int net_tc_tx_shaper_set(uint8_t tc, uint32_t rate, uint32_t burst)
+{
+#if defined(CONFIG_NET_TC_TX_SHAPER)
+	struct tc_tx_shaper *shaper;
+	k_spinlock_key_t key;
+
+	if (tc >= NET_TC_TX_COUNT) {
+		return -EINVAL;
+	}
+
+	shaper = &tx_shapers[tc];
+	key = k_spin_lock(&shaper->lock);
+
+	shaper->rate = rate;
+	shaper->hi_credit = (int64_t)burst * CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+	shaper->credit = shaper->hi_credit;
+	shaper->last = k_uptime_ticks();
+
+	k_spin_unlock(&shaper->lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(tc);
+	ARG_UNUSED(rate);
+	ARG_UNUSED(burst);
+
+	return -ENOTSUP;
 #endif
+}
+
+int net_tc_tx_shaper_stats_get(uint8_t tc, struct net_tc_tx_shaper_stats *stats)
+{
+#if defined(CONFIG_NET_TC_TX_SHAPER)
+	k_spinlock_key_t key;
+
+	if (tc >= NET_TC_TX_COUNT) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&tx_shapers[tc].lock);
+	*stats = tx_shapers[tc].stats;
+	k_spin_unlock(&tx_shapers[tc].lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(tc);
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+#endif
+}
 
 enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 					       k_timeout_t timeout)
@@ -73,6 +227,7 @@ enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 
 #if NET_TC_TX_EFFECTIVE_COUNT > 1
 	if (k_sem_take(&tx_classes[tc].fifo_slot, timeout) != 0) {
+		tc_tx_shaper_dropped(tc);
 		return NET_DROP;
 	}
 #endif
@@ -86,6 +241,106 @@ enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 #endif
 }
 
+#if NET_TC_RX_QUEUES > 1
+/* Hash of the addresses and ports of a received packet, which is not
+ * parsed yet, so they are only looked for in its first buffer.
+ */
+static uint32_t tc_rx_flow_hash(struct net_pkt *pkt)
+{
+	struct net_buf *buf = pkt->buffer;
+	uint32_t hash = 2166136261U;
+	size_t addr_len;
+	size_t l4_off;
+	uint8_t *addr;
+	uint8_t *data;
+	uint8_t proto;
+	size_t len;
+
+	if (buf == NULL) {
+		return 0U;
+	}
+
+	data = buf->data;
+	len = buf->len;
+
+	if (IS_ENABLED(CONFIG_NET_L2_ETHERNET) &&
+	    net_if_l2(net_pkt_iface(pkt)) == &NET_L2_GET_NAME(ETHERNET)) {
+		if (len < sizeof(struct net_eth_hdr)) {
+			return 0U;
+		}
+
+		if (ntohs(((struct net_eth_hdr *)data)->type) == NET_ETH_PTYPE_VLAN) {
+			data += sizeof(struct net_eth_vlan_hdr);
+			len -= MIN(len, sizeof(struct net_eth_vlan_hdr));
+		} else {
+			data += sizeof(struct net_eth_hdr);
+			len -= sizeof(struct net_eth_hdr);
+		}
+	}
+
+	if (len == 0U) {
+		return 0U;
+	}
+
+	switch (data[0] >> 4) {
+	case 4:
+		if (len < sizeof(struct net_ipv4_hdr)) {
+			return 0U;
+		}
+
+		addr = ((struct net_ipv4_hdr *)data)->src;
+		addr_len = 2 * sizeof(struct in_addr);
+		l4_off = (data[0] & 0x0f) * 4U;
+		proto = ((struct net_ipv4_hdr *)data)->proto;
+
+		/* Only the first fragment has the ports */
+		if ((sys_get_be16(((struct net_ipv4_hdr *)data)->offset) & 0x3fff) != 0U) {
+			proto = 0U;
+		}
+
+		break;
+	case 6:
+		if (len < sizeof(struct net_ipv6_hdr)) {
+			return 0U;
+		}
+
+		addr = ((struct net_ipv6_hdr *)data)->src;
+		addr_len = 2 * sizeof(struct in6_addr);
+		l4_off = sizeof(struct net_ipv6_hdr);
+		proto = ((struct net_ipv6_hdr *)data)->nexthdr;
+		break;
+	default:
+		return 0U;
+	}
+
+	/* FNV-1a over the addresses, and the ports if any */
+	for (size_t i = 0; i < addr_len; i++) {
+		hash = (hash ^ addr[i]) * 16777619U;
+	}
+
+	if ((proto == IPPROTO_TCP || proto == IPPROTO_UDP) && len >= l4_off + 4U) {
+		for (size_t i = 0; i < 4U; i++) {
+			hash = (hash ^ data[l4_off + i]) * 16777619U;
+		}
+	}
+
+	return hash;
+}
+
+static uint8_t tc_rx_queue(struct net_pkt *pkt)
+{
+	int queue = net_pkt_rx_queue(pkt);
+
+	if (queue < 0) {
+		return tc_rx_flow_hash(pkt) % NET_TC_RX_QUEUES;
+	}
+
+	return queue % NET_TC_RX_QUEUES;
+}
+#else
+#define tc_rx_queue(pkt) 0
+#endif /* NET_TC_RX_QUEUES > 1 */
+
 enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
@@ -94,6 +349,8 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
+	tc = tc * NET_TC_RX_QUEUES + tc_rx_queue(pkt);
+
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	while (k_sem_take(&rx_classes[tc].fifo_slot, K_NO_WAIT) != 0) {
 		if (k_is_in_isr() || retry_cnt == 0) {
@@ -285,6 +542,36 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #endif
 
 #if NET_TC_RX_COUNT > 0
+#if defined(CONFIG_NET_TCP_GRO)
+/* Merge the TCP segments queued right behind pkt into it, stopping at the
+ * first packet which does not follow so that the ordering is kept.
+ */
+static void tc_rx_gro(struct net_pkt *pkt, struct k_fifo *fifo, struct k_sem *fifo_slot)
+{
+	struct net_pkt *next;
+
+#if NET_TC_RX_EFFECTIVE_COUNT == 1
+	ARG_UNUSED(fifo_slot);
+#endif
+
+	for (int i = 1; i < CONFIG_NET_TCP_GRO_MAX_SEGMENTS; i++) {
+		next = k_fifo_peek_head(fifo);
+		if (next == NULL || !net_gro_can_merge(pkt, next)) {
+			break;
+		}
+
+		/* This thread is the only consumer of the queue */
+		next = k_fifo_get(fifo, K_NO_WAIT);
+
+#if NET_TC_RX_EFFECTIVE_COUNT > 1
+		k_sem_give(fifo_slot);
+#endif
+
+		net_gro_merge(pkt, next);
+	}
+}
+#endif /* CONFIG_NET_TCP_GRO */
+
 static void tc_rx_handler(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p3);
@@ -307,6 +594,10 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 		k_sem_give(fifo_slot);
 #endif
 
+#if defined(CONFIG_NET_TCP_GRO)
+		tc_rx_gro(pkt, fifo, p2);
+#endif
+
 		net_process_rx_packet(pkt);
 	}
 }
@@ -315,16 +606,17 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 #if NET_TC_TX_COUNT > 0
 static void tc_tx_handler(void *p1, void *p2, void *p3)
 {
-	ARG_UNUSED(p3);
-
 	struct k_fifo *fifo = p1;
 #if NET_TC_TX_EFFECTIVE_COUNT > 1
 	struct k_sem *fifo_slot = p2;
 #else
 	ARG_UNUSED(p2);
 #endif
+	uint8_t tc = POINTER_TO_UINT(p3);
 	struct net_pkt *pkt;
 
+	ARG_UNUSED(tc);
+
 	while (1) {
 		pkt = k_fifo_get(fifo, K_FOREVER);
 		if (pkt == NULL) {
@@ -335,6 +627,8 @@ static void tc_tx_handler(void *p1, void *p2, void *p3)
 		k_sem_give(fifo_slot);
 #endif
 
+		tc_tx_shape(tc, pkt);
+
 		net_process_tx_packet(pkt);
 	}
 }
@@ -392,7 +686,7 @@ void net_tc_tx_init(void)
 #else
 				      NULL,
 #endif
-				      NULL,
+				      UINT_TO_POINTER(i),
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
@@ -425,12 +719,12 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_THREADS; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		thread_priority = rx_tc2thread(i / NET_TC_RX_QUEUES);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -460,7 +754,7 @@ void net_tc_rx_init(void)
 #else
 				      NULL,
 #endif
-				      NULL,
+				      UINT_TO_POINTER(i),
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
@@ -470,10 +764,21 @@ void net_tc_rx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "rx_q[%d]", i);
+			if (NET_TC_RX_QUEUES > 1) {
+				snprintk(name, sizeof(name), "rx_q[%d.%d]",
+					 i / NET_TC_RX_QUEUES, i % NET_TC_RX_QUEUES);
+			} else {
+				snprintk(name, sizeof(name), "rx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_SCHED_CPU_MASK) && NET_TC_RX_QUEUES > 1
+		/* Spread the queues of a traffic class over the CPUs */
+		(void)k_thread_cpu_pin(tid, (i % NET_TC_RX_QUEUES) % arch_num_cpus());
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -267,15 +267,207 @@ static inline void update_route_access(struct net_route_entry *route)
 	sys_slist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct in6_addr *dst)
+#if defined(CONFIG_NET_ROUTE_TRIE)
+/* Node of the route trie. The trie is path compressed, a node without
+ * routes has two children, so there are less than twice as many nodes as
+ * routes.
+ */
+struct route_trie_node {
+	struct route_trie_node *parent;
+	struct route_trie_node *child[2];
+
+	/* Routes to the prefix, chained through trie_next */
+	struct net_route_entry *routes;
+
+	struct in6_addr prefix;
+	uint8_t prefix_len;
+	bool in_use;
+};
+
+static struct route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node *route_trie_root;
+
+static inline uint8_t route_trie_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8U] >> (7U - bit % 8U)) & 1U;
+}
+
+static uint8_t route_trie_common_len(const struct in6_addr *a,
+				     const struct in6_addr *b, uint8_t max)
+{
+	uint8_t len = 0U;
+
+	while (len < max && route_trie_bit(a, len) == route_trie_bit(b, len)) {
+		len++;
+	}
+
+	return len;
+}
+
+static struct route_trie_node *route_trie_node_alloc(const struct in6_addr *prefix,
+						     uint8_t prefix_len,
+						     struct route_trie_node *parent)
+{
+	ARRAY_FOR_EACH_PTR(route_trie_nodes, node) {
+		if (node->in_use) {
+			continue;
+		}
+
+		memset(node, 0, sizeof(*node));
+		net_ipaddr_copy(&node->prefix, prefix);
+		node->prefix_len = prefix_len;
+		node->parent = parent;
+		node->in_use = true;
+
+		return node;
+	}
+
+	return NULL;
+}
+
+static void route_trie_insert(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node *parent = NULL;
+	struct route_trie_node *node;
+	uint8_t len = route->prefix_len;
+
+	while ((node = *link) != NULL) {
+		struct route_trie_node *branch;
+		uint8_t common;
+
+		common = route_trie_common_len(&route->addr, &node->prefix,
+					       MIN(len, node->prefix_len));
+		if (common == node->prefix_len) {
+			if (common == len) {
+				goto found;
+			}
+
+			parent = node;
+			link = &node->child[route_trie_bit(&route->addr, common)];
+			continue;
+		}
+
+		/* The prefix is shorter than, or diverges from, the one
+		 * of the node, which moves below a new node.
+		 */
+		branch = route_trie_node_alloc(&route->addr, common, parent);
+		if (branch == NULL) {
+			goto fail;
+		}
+
+		branch->child[route_trie_bit(&node->prefix, common)] = node;
+		node->parent = branch;
+		*link = branch;
+
+		if (common == len) {
+			node = branch;
+			goto found;
+		}
+
+		parent = branch;
+		link = &branch->child[route_trie_bit(&route->addr, common)];
+		break;
+	}
+
+	node = route_trie_node_alloc(&route->addr, len, parent);
+	if (node == NULL) {
+		goto fail;
+	}
+
+	*link = node;
+
+found:
+	route->trie_next = node->routes;
+	node->routes = route;
+
+	return;
+
+fail:
+	/* Cannot happen as long as the trie stays path compressed */
+	NET_ERR("No route trie node available!");
+}
+
+static void route_trie_remove(struct net_route_entry *route)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry **prev;
+
+	while (node != NULL && node->prefix_len < route->prefix_len) {
+		node = node->child[route_trie_bit(&route->addr, node->prefix_len)];
+	}
+
+	if (node == NULL || node->prefix_len != route->prefix_len) {
+		return;
+	}
+
+	for (prev = &node->routes; *prev != NULL; prev = &(*prev)->trie_next) {
+		if (*prev == route) {
+			*prev = route->trie_next;
+			route->trie_next = NULL;
+			break;
+		}
+	}
+
+	/* Remove the nodes left without routes and with a single child */
+	while (node != NULL && node->routes == NULL &&
+	       (node->child[0] == NULL || node->child[1] == NULL)) {
+		struct route_trie_node *child = node->child[0] != NULL ?
+						node->child[0] : node->child[1];
+		struct route_trie_node *parent = node->parent;
+
+		if (parent == NULL) {
+			route_trie_root = child;
+		} else {
+			parent->child[parent->child[1] == node] = child;
+		}
+
+		if (child != NULL) {
+			child->parent = parent;
+		}
+
+		node->in_use = false;
+		node = parent;
+	}
+}
+
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *found = NULL;
+
+	while (node != NULL &&
+	       net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr,
+				  node->prefix_len)) {
+		for (struct net_route_entry *route = node->routes; route != NULL;
+		     route = route->trie_next) {
+			if (iface == NULL || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[route_trie_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+#else
+#define route_trie_insert(...)
+#define route_trie_remove(...)
+
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
 {
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
 
-	net_ipv6_nbr_lock();
-
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -298,6 +490,106 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		}
 	}
 
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
+#if CONFIG_NET_ROUTE_DEST_CACHE_SIZE > 0
+/* Route found for a destination through an interface, or through any of
+ * them if iface is NULL. A NULL route tells there is none.
+ */
+struct route_dest_cache_entry {
+	struct net_if *iface;
+	struct net_route_entry *route;
+	struct in6_addr dst;
+	bool valid;
+};
+
+static struct route_dest_cache_entry route_dest_cache[CONFIG_NET_ROUTE_DEST_CACHE_SIZE];
+
+static struct route_dest_cache_entry *route_dest_cache_get(struct net_if *iface,
+							   struct in6_addr *dst)
+{
+	uint32_t hash = (uint32_t)(uintptr_t)iface;
+
+	for (int i = 0; i < ARRAY_SIZE(dst->s6_addr32); i++) {
+		hash = (hash ^ UNALIGNED_GET(&dst->s6_addr32[i])) * 0x9e3779b1U;
+	}
+
+	return &route_dest_cache[(hash >> 16) % CONFIG_NET_ROUTE_DEST_CACHE_SIZE];
+}
+
+static void route_dest_cache_flush(void)
+{
+	memset(route_dest_cache, 0, sizeof(route_dest_cache));
+}
+
+static struct net_route_entry *route_lookup(struct net_if *iface,
+					    struct in6_addr *dst)
+{
+	struct route_dest_cache_entry *entry = route_dest_cache_get(iface, dst);
+
+	if (!entry->valid || entry->iface != iface ||
+	    !net_ipv6_addr_cmp(&entry->dst, dst)) {
+		entry->route = route_find(iface, dst);
+		entry->iface = iface;
+		net_ipaddr_copy(&entry->dst, dst);
+		entry->valid = true;
+	}
+
+	return entry->route;
+}
+#else
+#define route_dest_cache_flush(...)
+#define route_lookup route_find
+#endif /* CONFIG_NET_ROUTE_DEST_CACHE_SIZE > 0 */
+
+#if CONFIG_NET_ROUTE_FLOW_CACHE_SIZE > 0
+/* Neighbor the packets from src to dst received on iface were last
+ * forwarded to.
+ */
+struct route_flow_cache_entry {
+	struct net_if *iface;
+	struct net_nbr *nbr;
+	struct in6_addr src;
+	struct in6_addr dst;
+	struct in6_addr nexthop;
+	bool valid;
+};
+
+static struct route_flow_cache_entry route_flow_cache[CONFIG_NET_ROUTE_FLOW_CACHE_SIZE];
+
+static struct route_flow_cache_entry *route_flow_cache_get(struct net_if *iface,
+							   const struct in6_addr *src,
+							   const struct in6_addr *dst)
+{
+	uint32_t hash = (uint32_t)(uintptr_t)iface;
+
+	for (int i = 0; i < ARRAY_SIZE(dst->s6_addr32); i++) {
+		hash = (hash ^ UNALIGNED_GET(&dst->s6_addr32[i])) * 0x9e3779b1U;
+	}
+
+	hash = (hash ^ UNALIGNED_GET(&src->s6_addr32[3])) * 0x9e3779b1U;
+
+	return &route_flow_cache[(hash >> 16) % CONFIG_NET_ROUTE_FLOW_CACHE_SIZE];
+}
+
+static void route_flow_cache_flush(void)
+{
+	memset(route_flow_cache, 0, sizeof(route_flow_cache));
+}
+#else
+#define route_flow_cache_flush(...)
+#endif /* CONFIG_NET_ROUTE_FLOW_CACHE_SIZE > 0 */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	net_ipv6_nbr_lock();
+
+	found = route_lookup(iface, dst);
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -308,6 +600,26 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 	return found;
 }
 
+/* Route to exactly the given prefix through iface */
+static struct net_route_entry *route_lookup_prefix(struct net_if *iface,
+						   struct in6_addr *addr,
+						   uint8_t prefix_len)
+{
+	for (int i = 0; i < CONFIG_NET_MAX_ROUTES; i++) {
+		struct net_nbr *nbr = get_nbr(i);
+		struct net_route_entry *route = net_route_data(nbr);
+
+		if (nbr->ref && nbr->iface == iface &&
+		    route->prefix_len == prefix_len &&
+		    net_ipv6_is_prefix(addr->s6_addr, route->addr.s6_addr,
+				       prefix_len)) {
+			return route;
+		}
+	}
+
+	return NULL;
+}
+
 static inline bool route_preference_is_lower(uint8_t old, uint8_t new)
 {
 	if (new == NET_ROUTE_PREFERENCE_RESERVED || (new & 0xfc) != 0) {
@@ -361,7 +673,8 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 			net_sprint_ll_addr(nexthop_lladdr->addr, nexthop_lladdr->len));
 	}
 
-	route = net_route_lookup(iface, addr);
+	/* A longer or shorter prefix containing addr is another route */
+	route = route_lookup_prefix(iface, addr, prefix_len);
 	if (route) {
 		/* Update nexthop if not the same */
 		struct in6_addr *nexthop_addr;
@@ -446,6 +759,10 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	sys_slist_prepend(&routes, &route->node);
 
+	route_trie_insert(route);
+	route_dest_cache_flush();
+	route_flow_cache_flush();
+
 	tmp = nbr_nexthop_get(iface, nexthop);
 
 	NET_ASSERT(tmp == nbr_nexthop);
@@ -596,6 +913,10 @@ int net_route_del(struct net_route_entry *route)
 
 	net_route_info("Deleted", route, &route->addr);
 
+	route_trie_remove(route);
+	route_dest_cache_flush();
+	route_flow_cache_flush();
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&route->nexthop, nexthop_route, node) {
 		if (!nexthop_route->nbr) {
 			continue;
@@ -1029,22 +1350,13 @@ static bool is_ll_addr_supported(struct net_if *iface)
 	return true;
 }
 
-int net_route_packet(struct net_pkt *pkt, struct in6_addr *nexthop)
+/* Called with the neighbor lock held, which is released */
+static int route_packet_via(struct net_pkt *pkt, struct net_nbr *nbr,
+			    struct in6_addr *nexthop)
 {
 	struct net_linkaddr *lladdr = NULL;
-	struct net_nbr *nbr;
 	int err;
 
-	net_ipv6_nbr_lock();
-
-	nbr = net_ipv6_nbr_lookup(NULL, nexthop);
-	if (!nbr) {
-		NET_DBG("Cannot find %s neighbor",
-			net_sprint_ipv6_addr(nexthop));
-		err = -ENOENT;
-		goto error;
-	}
-
 	if (is_ll_addr_supported(nbr->iface) && is_ll_addr_supported(net_pkt_iface(pkt)) &&
 	    is_ll_addr_supported(net_pkt_orig_iface(pkt))) {
 		lladdr = net_nbr_get_lladdr(nbr->idx);
@@ -1098,6 +1410,88 @@ error:
 	return err;
 }
 
+#if CONFIG_NET_ROUTE_FLOW_CACHE_SIZE > 0
+/* Called with the neighbor lock held */
+static void route_flow_cache_add(struct net_pkt *pkt, struct net_nbr *nbr,
+				 struct in6_addr *nexthop)
+{
+	struct net_ipv6_hdr *hdr = NET_IPV6_HDR(pkt);
+	struct route_flow_cache_entry *entry;
+
+	if (hdr == NULL) {
+		return;
+	}
+
+	entry = route_flow_cache_get(net_pkt_orig_iface(pkt),
+				     (struct in6_addr *)hdr->src,
+				     (struct in6_addr *)hdr->dst);
+
+	entry->iface = net_pkt_orig_iface(pkt);
+	entry->nbr = nbr;
+	net_ipv6_addr_copy_raw(entry->src.s6_addr, hdr->src);
+	net_ipv6_addr_copy_raw(entry->dst.s6_addr, hdr->dst);
+	net_ipaddr_copy(&entry->nexthop, nexthop);
+	entry->valid = true;
+}
+
+int net_route_flow_packet(struct net_pkt *pkt, struct net_ipv6_hdr *hdr)
+{
+	struct route_flow_cache_entry *entry;
+	struct in6_addr nexthop;
+	struct net_nbr *nbr;
+
+	net_ipv6_nbr_lock();
+
+	entry = route_flow_cache_get(net_pkt_iface(pkt),
+				     (struct in6_addr *)hdr->src,
+				     (struct in6_addr *)hdr->dst);
+
+	if (!entry->valid || entry->iface != net_pkt_iface(pkt) ||
+	    !net_ipv6_addr_cmp_raw(entry->src.s6_addr, hdr->src) ||
+	    !net_ipv6_addr_cmp_raw(entry->dst.s6_addr, hdr->dst)) {
+		net_ipv6_nbr_unlock();
+		return -ENOENT;
+	}
+
+	/* The neighbor might have been released or reused since */
+	nbr = entry->nbr;
+	if (!nbr->ref ||
+	    !net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, &entry->nexthop)) {
+		entry->valid = false;
+		net_ipv6_nbr_unlock();
+		return -ENOENT;
+	}
+
+	net_ipaddr_copy(&nexthop, &entry->nexthop);
+
+	net_pkt_set_orig_iface(pkt, net_pkt_iface(pkt));
+	net_pkt_set_iface(pkt, nbr->iface);
+
+	return route_packet_via(pkt, nbr, &nexthop);
+}
+#else
+#define route_flow_cache_add(...)
+#endif /* CONFIG_NET_ROUTE_FLOW_CACHE_SIZE > 0 */
+
+int net_route_packet(struct net_pkt *pkt, struct in6_addr *nexthop)
+{
+	struct net_nbr *nbr;
+
+	net_ipv6_nbr_lock();
+
+	nbr = net_ipv6_nbr_lookup(NULL, nexthop);
+	if (!nbr) {
+		NET_DBG("Cannot find %s neighbor",
+			net_sprint_ipv6_addr(nexthop));
+		net_ipv6_nbr_unlock();
+		return -ENOENT;
+	}
+
+	route_flow_cache_add(pkt, nbr, nexthop);
+
+	return route_packet_via(pkt, nbr, nexthop);
+}
+
 int net_route_packet_if(struct net_pkt *pkt, struct net_if *iface)
 {
 	/* The destination is reachable via iface. But since no valid nexthop
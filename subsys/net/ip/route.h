@@ -55,6 +55,11 @@ struct net_route_entry {
 	/** Network interface for the route. */
 	struct net_if *iface;
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	/** Next route to the same prefix, through another interface. */
+	struct net_route_entry *trie_next;
+#endif
+
 	/** Route lifetime timer. */
 	struct net_timeout lifetime;
 
@@ -318,6 +323,34 @@ bool net_route_get_info(struct net_if *iface,
  */
 int net_route_packet(struct net_pkt *pkt, struct in6_addr *nexthop);
 
+/**
+ * @brief Forward the network packet to the neighbor the previous packets
+ * of the same flow were forwarded to.
+ *
+ * @details A flow is identified by the source and destination addresses
+ * of the packet and the interface it was received on. The flow is
+ * remembered by net_route_packet() when CONFIG_NET_ROUTE_FLOW_CACHE_SIZE
+ * is not 0.
+ *
+ * @param pkt Network packet to forward.
+ * @param hdr IPv6 header of the packet.
+ *
+ * @return 0 if the packet was sent, -ENOENT if the flow is not known,
+ * <0 if the packet could not be sent.
+ */
+#if CONFIG_NET_ROUTE_FLOW_CACHE_SIZE > 0
+int net_route_flow_packet(struct net_pkt *pkt, struct net_ipv6_hdr *hdr);
+#else
+static inline int net_route_flow_packet(struct net_pkt *pkt,
+					struct net_ipv6_hdr *hdr)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(hdr);
+
+	return -ENOENT;
+}
+#endif
+
 /**
  * @brief Send the network packet to network via the given interface.
  *
@@ -73,6 +73,12 @@ static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
 
+/* Buffers held by the receive queues of all the connections */
+static atomic_t tcp_recv_queue_bufs;
+
+#define TCP_RECV_QUEUE_TOTAL_BUFS \
+	(CONFIG_NET_BUF_RX_COUNT * CONFIG_NET_TCP_RECV_QUEUE_TOTAL_PERCENT / 100)
+
 K_MEM_SLAB_DEFINE_STATIC(tcp_conns_slab, sizeof(struct tcp),
 				CONFIG_NET_MAX_CONTEXTS, 4);
 
@@ -447,8 +453,8 @@ static void tcp_derive_rto(struct tcp *conn)
 
 static void tcp_new_reno_log(struct tcp *conn, char *step)
 {
-	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
-		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+	NET_DBG("conn: %p, ca %s %s, cwnd=%d, ssthres=%d, fast_pend=%i",
+		conn, conn->ca.ops->name, step, conn->ca.cwnd, conn->ca.ssthresh,
 		conn->ca.pending_fast_retransmit_bytes);
 }
 
@@ -488,12 +494,32 @@ static void tcp_new_reno_dup_ack(struct tcp *conn)
 	tcp_new_reno_log(conn, "dup_ack");
 }
 
+/* Leave the fast recovery once all the data sent before it is acknowledged,
+ * returns false if not in fast recovery.
+ */
+static bool tcp_new_reno_recovery_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		return false;
+	}
+
+	if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+		conn->ca.pending_fast_retransmit_bytes = 0;
+		conn->ca.cwnd = conn->ca.ssthresh;
+	} else {
+		conn->ca.pending_fast_retransmit_bytes -= acked_len;
+		conn->ca.cwnd -= acked_len;
+	}
+
+	return true;
+}
+
 static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
 	int32_t new_win = conn->ca.cwnd;
 	int32_t win_inc = MIN(acked_len, conn_mss(conn));
 
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+	if (!tcp_new_reno_recovery_acked(conn, acked_len)) {
 		if (conn->ca.cwnd < conn->ca.ssthresh) {
 			new_win += win_inc;
 		} else {
@@ -501,42 +527,190 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
 		}
 		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	}
+	tcp_new_reno_log(conn, "pkts_acked");
+}
+
+static const struct tcp_ca_ops tcp_ca_new_reno = {
+	.name = "NewReno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+
+/* Implementation according to RFC9438, the window reduction factor and the
+ * scaling constant are 0.7 and 0.4. The window after an RTT is not
+ * anticipated, as no RTT is measured.
+ */
+#define TCP_CUBIC_BETA 717 /* 0.7 scaled by 1024 */
+#define TCP_CUBIC_ALPHA 542 /* 3 * (1 - 0.7) / (1 + 0.7) scaled by 1024 */
+/* Limit on the time since the start of the epoch, in milliseconds */
+#define TCP_CUBIC_MAX_T 100000
+
+static uint32_t tcp_cubic_cbrt(uint64_t x)
+{
+	uint64_t y = 0U;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		y <<= 1;
+		if ((x >> s) >= 3U * y * (y + 1U) + 1U) {
+			x -= (3U * y * (y + 1U) + 1U) << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca.cubic;
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence, leave room to newer flows */
+	if (cwnd < cubic->w_max) {
+		cubic->w_max = (cwnd * (1024U + TCP_CUBIC_BETA)) / 2048U;
 	} else {
-		/* Check if it is still in fast recovery mode */
-		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
-			conn->ca.pending_fast_retransmit_bytes = 0;
-			conn->ca.cwnd = conn->ca.ssthresh;
+		cubic->w_max = cwnd;
+	}
+
+	cubic->epoch_start = 0U;
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, (cwnd * TCP_CUBIC_BETA) / 1024U);
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	tcp_new_reno_init(conn);
+	memset(&conn->ca.cubic, 0, sizeof(conn->ca.cubic));
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh, UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_new_reno_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_new_reno_log(conn, "timeout");
+}
+
+/* Window the cubic function gives at the current time */
+static uint32_t tcp_cubic_target(struct tcp *conn)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca.cubic;
+	uint32_t mss = conn_mss(conn);
+	int64_t t = k_uptime_get_32() - cubic->epoch_start;
+	int64_t delta;
+	int64_t target;
+
+	t = MIN(t, TCP_CUBIC_MAX_T) - cubic->k;
+
+	/* 0.4 * (t / 1000)^3 segments */
+	delta = (t * t * t) / 1000000;
+	delta = (delta * 4 * mss) / 10000;
+	target = (int64_t)cubic->origin + delta;
+
+	return CLAMP(target, mss, UINT16_MAX);
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca.cubic;
+	uint32_t win_inc = MIN(acked_len, conn_mss(conn));
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t target;
+
+	if (tcp_new_reno_recovery_acked(conn, acked_len)) {
+		goto out;
+	}
+
+	if (cwnd < conn->ca.ssthresh) {
+		conn->ca.cwnd = MIN(cwnd + win_inc, UINT16_MAX);
+		goto out;
+	}
+
+	if (cubic->epoch_start == 0U) {
+		/* 0 marks the absence of epoch */
+		cubic->epoch_start = k_uptime_get_32() | 1U;
+		cubic->w_est = cwnd;
+
+		if (cwnd < cubic->w_max) {
+			/* (w_max - cwnd) / 0.4 segments to recover, in ms^3 */
+			cubic->k = tcp_cubic_cbrt(((uint64_t)(cubic->w_max - cwnd) *
+						   2500000000ULL) / conn_mss(conn));
+			cubic->origin = cubic->w_max;
 		} else {
-			conn->ca.pending_fast_retransmit_bytes -= acked_len;
-			conn->ca.cwnd -= acked_len;
+			cubic->k = 0U;
+			cubic->origin = cwnd;
 		}
 	}
+
+	/* Do not grow slower than NewReno would */
+	cubic->w_est += DIV_ROUND_UP((uint64_t)TCP_CUBIC_ALPHA * win_inc * win_inc,
+				     1024U * cwnd);
+	target = MAX(tcp_cubic_target(conn), cubic->w_est);
+
+	if (target > cwnd) {
+		cwnd += DIV_ROUND_UP((target - cwnd) * win_inc, cwnd);
+		conn->ca.cwnd = MIN(cwnd, UINT16_MAX);
+	}
+
+out:
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+static const struct tcp_ca_ops tcp_ca_cubic = {
+	.name = "CUBIC",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+};
+#endif /* CONFIG_NET_TCP_CONGESTION_CUBIC */
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+#define TCP_CA_DEFAULT (&tcp_ca_cubic)
+#else
+#define TCP_CA_DEFAULT (&tcp_ca_new_reno)
+#endif
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca.ops = TCP_CA_DEFAULT;
+	conn->ca.ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca.ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca.ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca.ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca.ops->pkts_acked(conn, acked_len);
 }
 #else
 
@@ -752,6 +926,26 @@ static void tcp_send_queue_flush(struct tcp *conn)
 	}
 }
 
+/* Account for buffers added to, or removed from if negative, the receive
+ * queue of a connection.
+ */
+static void tcp_recv_queue_account(struct tcp *conn, int bufs)
+{
+	conn->queue_recv_bufs += bufs;
+	(void)atomic_add(&tcp_recv_queue_bufs, bufs);
+}
+
+static void tcp_recv_queue_flush(struct tcp *conn)
+{
+	if (conn->queue_recv_data->buffer == NULL) {
+		return;
+	}
+
+	net_buf_unref(conn->queue_recv_data->buffer);
+	conn->queue_recv_data->buffer = NULL;
+	tcp_recv_queue_account(conn, -conn->queue_recv_bufs);
+}
+
 static void tcp_conn_release(struct k_work *work)
 {
 	struct tcp *conn = CONTAINER_OF(work, struct tcp, conn_release);
@@ -797,6 +991,7 @@ static void tcp_conn_release(struct k_work *work)
 	tcp_pkt_unref(conn->send_data);
 
 	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT) {
+		tcp_recv_queue_flush(conn);
 		tcp_pkt_unref(conn->queue_recv_data);
 	}
 
@@ -1059,6 +1254,35 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE != 0 ||
+			    opt_len == 2) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_blocks = MIN((opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE,
+							NET_TCP_SACK_MAX_BLOCKS);
+
+			for (int i = 0; i < recv_options->sack_blocks; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1131,63 +1355,53 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 	return 0;
 }
 
+/* Append to pkt the queued data following it, up to the first hole */
 static size_t tcp_check_pending_data(struct tcp *conn, struct net_pkt *pkt,
 				     size_t len)
 {
 	size_t pending_len = 0;
+	uint32_t expected_seq;
+	struct net_buf *buf;
 
-	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT &&
-	    !net_pkt_is_empty(conn->queue_recv_data)) {
-		/* Some potentential cases:
-		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off   | Gap size | Required handling
-		 * Seq|Len|Seq|Len|           |          |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | 6-3-3=0  | Append
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | 6-3-4=-1 | Append, pull from queue
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3-7=-4 | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3-8=-5 | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6-5=-5 | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6-4=-4 | Drop queued data / packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10-2=-6| Should not happen, dropping queue
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7-4=-5 | Should not happen, dropping queue
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11-2=-7| Should not happen, dropping queue
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2-3=1  | Keep queued data
-		 */
-		struct tcphdr *th = th_get(pkt);
-		uint32_t expected_seq = th_seq(th) + len;
-		uint32_t pending_seq;
-		int32_t gap_size;
-		uint32_t end_offset;
-
-		pending_seq = tcp_get_seq(conn->queue_recv_data->buffer);
-		end_offset = expected_seq - pending_seq;
-		gap_size = (int32_t)(pending_seq - th_seq(th) - ((uint32_t)len));
-		pending_len = net_pkt_get_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
-			if (end_offset) {
-				net_pkt_remove_tail(pkt, end_offset);
-				pending_len -= end_offset;
-			}
+	if (!CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return 0;
+	}
 
-			NET_DBG("Found pending data seq %u len %zd",
-				expected_seq, pending_len);
+	expected_seq = th_seq(th_get(pkt)) + len;
 
-			net_buf_frag_add(pkt->buffer,
-					 conn->queue_recv_data->buffer);
-			conn->queue_recv_data->buffer = NULL;
+	while ((buf = conn->queue_recv_data->buffer) != NULL) {
+		uint32_t buf_seq = tcp_get_seq(buf);
+		uint32_t overlap = expected_seq - buf_seq;
 
-			k_work_cancel_delayable(&conn->recv_queue_timer);
-		} else {
-			/* Check if the queued data is just a section of the incoming data */
-			if (gap_size <= 0) {
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = NULL;
+		if (net_tcp_seq_cmp(buf_seq, expected_seq) > 0) {
+			break;
+		}
 
-				k_work_cancel_delayable(&conn->recv_queue_timer);
-			}
+		conn->queue_recv_data->buffer = buf->frags;
+		buf->frags = NULL;
+		tcp_recv_queue_account(conn, -1);
 
-			pending_len = 0;
+		if (overlap >= buf->len) {
+			/* Already received along with pkt */
+			net_buf_unref(buf);
+			continue;
 		}
+
+		net_buf_pull(buf, overlap);
+		net_buf_frag_add(pkt->buffer, buf);
+
+		pending_len += buf->len;
+		expected_seq += buf->len;
+	}
+
+	if (pending_len > 0) {
+		NET_DBG("Found pending data seq %u len %zd",
+			expected_seq - pending_len, pending_len);
+	}
+
+	if (net_pkt_is_empty(conn->queue_recv_data)) {
+		k_work_cancel_delayable(&conn->recv_queue_timer);
 	}
 
 	return pending_len;
@@ -1249,6 +1463,82 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+#define TCP_SACK_OPT_MAX_LEN \
+	(2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE)
+
+/* Build the SACK related option sent along with a segment, if any, padded
+ * to a multiple of 4 bytes. Each range of data in the receive queue is
+ * reported as a block, from the lowest one.
+ */
+static size_t tcp_sack_opt(struct tcp *conn, uint8_t flags, uint8_t *opt)
+{
+	struct net_buf *buf;
+	uint32_t start;
+	uint32_t end;
+	int blocks = 0;
+
+	if (!conn->sack_ok) {
+		return 0;
+	}
+
+	opt[0] = NET_TCP_NOP_OPT;
+	opt[1] = NET_TCP_NOP_OPT;
+
+	if (flags & SYN) {
+		opt[2] = NET_TCP_SACK_PERM_OPT;
+		opt[3] = NET_TCP_SACK_PERM_SIZE;
+
+		return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if (!(flags & ACK) || !CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return 0;
+	}
+
+	buf = conn->queue_recv_data->buffer;
+
+	while (buf != NULL && blocks < NET_TCP_SACK_MAX_BLOCKS) {
+		uint8_t *block = opt + 4 + blocks * NET_TCP_SACK_BLOCK_SIZE;
+
+		start = tcp_get_seq(buf);
+		end = start;
+
+		while (buf != NULL && tcp_get_seq(buf) == end) {
+			end += buf->len;
+			buf = buf->frags;
+		}
+
+		UNALIGNED_PUT(htonl(start), (uint32_t *)block);
+		UNALIGNED_PUT(htonl(end), (uint32_t *)(block + 4));
+		blocks++;
+	}
+
+	opt[2] = NET_TCP_SACK_OPT;
+	opt[3] = 2 + blocks * NET_TCP_SACK_BLOCK_SIZE;
+
+	return 2 * NET_TCP_NOP_SIZE + opt[3];
+}
+#endif
+
+/* Length of the options sent along with a segment */
+static size_t tcp_options_len(struct tcp *conn, uint8_t flags)
+{
+	size_t len = 0;
+#if defined(CONFIG_NET_TCP_SACK)
+	uint8_t sack_opt[TCP_SACK_OPT_MAX_LEN];
+
+	len += tcp_sack_opt(conn, flags, sack_opt);
+#endif
+
+	if (conn->send_options.mss_found) {
+		len += NET_TCP_MSS_SIZE;
+	}
+
+	return len;
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -1264,11 +1554,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + tcp_options_len(conn, flags) / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1348,6 +1634,20 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+static int tcp_sack_opt_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags)
+{
+	uint8_t opt[TCP_SACK_OPT_MAX_LEN];
+	size_t len = tcp_sack_opt(conn, flags, opt);
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return net_pkt_write(pkt, opt, len);
+}
+#endif
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1456,14 +1756,10 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	size_t alloc_len = sizeof(struct tcphdr) + tcp_options_len(conn, flags);
 	struct net_pkt *pkt;
 	int ret = 0;
 
-	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
-	}
-
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1488,6 +1784,11 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
+	/* Data looped back to us is not split into segments */
+	if (data && !is_destination_local(pkt)) {
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
+	}
+
 	if (conn->send_options.mss_found) {
 		ret = net_tcp_set_mss_opt(conn, pkt);
 		if (ret < 0) {
@@ -1496,6 +1797,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	ret = tcp_sack_opt_add(conn, pkt, flags);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+#endif
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1659,13 +1968,183 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_ok = conn->recv_options.sack_perm_found;
+	conn->sack_board_len = 0U;
+	conn->sack_recovery = false;
+}
+
+/* Add a block to the scoreboard, which is kept sorted and made of blocks
+ * neither overlapping nor touching each other. The highest blocks are
+ * dropped once it is full.
+ */
+static void tcp_sack_insert(struct tcp *conn, struct tcp_sack_block block)
+{
+	struct tcp_sack_block *board = conn->sack_board;
+	int len = conn->sack_board_len;
+	int i = 0;
+
+	while (i < len) {
+		if (net_tcp_seq_cmp(block.start, board[i].end) <= 0 &&
+		    net_tcp_seq_cmp(board[i].start, block.end) <= 0) {
+			if (net_tcp_seq_cmp(board[i].start, block.start) < 0) {
+				block.start = board[i].start;
+			}
+
+			if (net_tcp_seq_cmp(board[i].end, block.end) > 0) {
+				block.end = board[i].end;
+			}
+
+			memmove(&board[i], &board[i + 1], (len - i - 1) * sizeof(*board));
+			len--;
+		} else {
+			i++;
+		}
+	}
+
+	for (i = 0; i < len && net_tcp_seq_cmp(board[i].start, block.start) < 0; i++) {
+	}
+
+	if (i < NET_TCP_SACK_MAX_BLOCKS) {
+		if (len == NET_TCP_SACK_MAX_BLOCKS) {
+			len--;
+		}
+
+		memmove(&board[i + 1], &board[i], (len - i) * sizeof(*board));
+		board[i] = block;
+		len++;
+	}
+
+	conn->sack_board_len = len;
+}
+
+/* Forget the acknowledged data and add the blocks reported by the peer,
+ * the blocks outside of the data sent are ignored.
+ */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	struct tcp_sack_block *board = conn->sack_board;
+	uint32_t high = conn->seq + conn->send_data_total;
+	int len = 0;
+
+	if (!conn->sack_ok) {
+		return;
+	}
+
+	for (int i = 0; i < conn->sack_board_len; i++) {
+		if (net_tcp_seq_cmp(board[i].end, ack) > 0) {
+			board[len] = board[i];
+			if (net_tcp_seq_cmp(board[len].start, ack) < 0) {
+				board[len].start = ack;
+			}
+
+			len++;
+		}
+	}
+
+	conn->sack_board_len = len;
+
+	for (int i = 0; i < conn->recv_options.sack_blocks; i++) {
+		struct tcp_sack_block block = conn->recv_options.sack[i];
+
+		if (net_tcp_seq_cmp(block.start, ack) < 0) {
+			block.start = ack;
+		}
+
+		if (net_tcp_seq_cmp(block.start, block.end) >= 0 ||
+		    net_tcp_seq_cmp(block.end, high) > 0) {
+			continue;
+		}
+
+		tcp_sack_insert(conn, block);
+	}
+}
+
+/* Move the offset of the data to send past the data the peer has */
+static void tcp_sack_skip(struct tcp *conn)
+{
+	for (int i = 0; i < conn->sack_board_len; i++) {
+		int32_t start = conn->sack_board[i].start - conn->seq;
+		int32_t end = conn->sack_board[i].end - conn->seq;
+
+		if (conn->unacked_len >= start && conn->unacked_len < end) {
+			conn->unacked_len = end;
+		}
+	}
+}
+
+/* Limit the data to send to the hole it starts in */
+static int tcp_sack_clip(struct tcp *conn, int len)
+{
+	for (int i = 0; i < conn->sack_board_len; i++) {
+		int32_t start = conn->sack_board[i].start - conn->seq;
+
+		if (start > conn->unacked_len) {
+			return MIN(len, start - conn->unacked_len);
+		}
+	}
+
+	return len;
+}
+
+static void tcp_sack_recovery_start(struct tcp *conn, int unacked_len)
+{
+	conn->sack_recovery = conn->sack_ok;
+	/* The first hole was just retransmitted */
+	conn->sack_rexmit = conn->seq + conn->unacked_len;
+	conn->sack_recovery_point = conn->seq + unacked_len;
+}
+
+/* After a retransmission timeout the peer may have dropped the data it
+ * reported, RFC 2018 ch. 8.
+ */
+static void tcp_sack_timeout(struct tcp *conn)
+{
+	conn->sack_board_len = 0U;
+	conn->sack_recovery = false;
+}
+
+#else
+
+static void tcp_sack_negotiate(struct tcp *conn) { }
+
+static void tcp_sack_update(struct tcp *conn, uint32_t ack) { }
+
+static void tcp_sack_skip(struct tcp *conn) { }
+
+static int tcp_sack_clip(struct tcp *conn, int len) { return len; }
+
+static void tcp_sack_recovery_start(struct tcp *conn, int unacked_len) { }
+
+static void tcp_sack_timeout(struct tcp *conn) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Largest amount of data sent in a single packet */
+static int tcp_send_data_max(struct tcp *conn)
+{
+#if defined(CONFIG_NET_TCP_GSO)
+	/* The IP length of the packet is 16 bits, room is left for an IP
+	 * and a TCP header of at most 60 bytes each.
+	 */
+	return MIN(conn_mss(conn) * CONFIG_NET_TCP_GSO_MAX_SEGMENTS, UINT16_MAX - 120);
+#else
+	return conn_mss(conn);
+#endif
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	tcp_sack_skip(conn);
+
+	len = MIN(tcp_unsent_len(conn), tcp_send_data_max(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1676,6 +2155,8 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
+	len = tcp_sack_clip(conn, len);
+
 	pkt = tcp_pkt_alloc(conn, len);
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
@@ -1690,16 +2171,28 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
+	if (len > conn_mss(conn)) {
+		net_pkt_set_gso_size(pkt, conn_mss(conn));
+	}
+
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
+		int segs = DIV_ROUND_UP(len, conn_mss(conn));
+
 		conn->unacked_len += len;
 
+		for (int i = 0; i < segs; i++) {
+			if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+				net_stats_update_tcp_seg_rexmit(conn->iface);
+			} else {
+				net_stats_update_tcp_seg_sent(conn->iface);
+			}
+		}
+
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 			net_stats_update_tcp_resent(conn->iface, len);
-			net_stats_update_tcp_seg_rexmit(conn->iface);
 		} else {
 			net_stats_update_tcp_sent(conn->iface, len);
-			net_stats_update_tcp_seg_sent(conn->iface);
 		}
 	}
 
@@ -1715,6 +2208,53 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* Retransmit the next segment of the data the peer did not report, below
+ * the highest data it reported, RFC 6675 ch. 4.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	int unacked_len = conn->unacked_len;
+	int32_t high;
+
+	if (!conn->sack_recovery || conn->sack_board_len == 0U) {
+		return;
+	}
+
+	high = conn->sack_board[conn->sack_board_len - 1].end - conn->seq;
+
+	conn->unacked_len = MAX((int32_t)(conn->sack_rexmit - conn->seq), 0);
+	tcp_sack_skip(conn);
+
+	if (conn->unacked_len < high && tcp_send_data(conn) == 0) {
+		conn->sack_rexmit = conn->seq + conn->unacked_len;
+	}
+
+	conn->unacked_len = unacked_len;
+}
+
+/* An acknowledgment ending below the data sent when the recovery started
+ * tells the next hole is lost too.
+ */
+static void tcp_sack_partial_ack(struct tcp *conn)
+{
+	if (!conn->sack_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, conn->sack_recovery_point) >= 0) {
+		conn->sack_recovery = false;
+		return;
+	}
+
+	tcp_sack_retransmit(conn);
+}
+#else
+static void tcp_sack_retransmit(struct tcp *conn) { }
+
+static void tcp_sack_partial_ack(struct tcp *conn) { }
+#endif
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1768,12 +2308,13 @@ static void tcp_cleanup_recv_queue(struct k_work *work)
 
 	k_mutex_lock(&conn->lock, K_FOREVER);
 
-	NET_DBG("Cleanup recv queue conn %p len %zd seq %u", conn,
-		net_pkt_get_len(conn->queue_recv_data),
-		tcp_get_seq(conn->queue_recv_data->buffer));
+	if (!net_pkt_is_empty(conn->queue_recv_data)) {
+		NET_DBG("Cleanup recv queue conn %p len %zd seq %u", conn,
+			net_pkt_get_len(conn->queue_recv_data),
+			tcp_get_seq(conn->queue_recv_data->buffer));
+	}
 
-	net_buf_unref(conn->queue_recv_data->buffer);
-	conn->queue_recv_data->buffer = NULL;
+	tcp_recv_queue_flush(conn);
 
 	k_mutex_unlock(&conn->lock);
 }
@@ -1815,6 +2356,7 @@ static void tcp_resend_data(struct k_work *work)
 
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
+		tcp_sack_timeout(conn);
 
 		ret = tcp_send_data(conn);
 		if (ret == -ENODATA) {
@@ -2050,6 +2592,10 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->send_win = conn->send_win_max;
 	conn->tcp_nodelay = false;
 	conn->addr_ref_done = false;
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Offered in our SYN, cleared if the peer does not offer it */
+	conn->sack_ok = true;
+#endif
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
@@ -2058,6 +2604,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2493,165 +3040,116 @@ static enum tcp_state tcp_enter_time_wait(struct tcp *conn)
 	return TCP_TIME_WAIT;
 }
 
-static bool check_seq_list(struct net_buf *buf)
-{
-	struct net_buf *last = NULL;
-	struct net_buf *tmp = buf;
-	uint32_t seq;
-	uint32_t next_seq = 0;
-	bool result = true;
-
-	while (tmp) {
-		seq = tcp_get_seq(tmp);
-
-		NET_DBG("buf %p seq %u len %d", tmp, seq, tmp->len);
-
-		if (last != NULL) {
-			if (next_seq != seq) {
-				result = false;
-			}
-		}
-
-		next_seq = seq + tmp->len;
-		last = tmp;
-		tmp = tmp->frags;
-	}
-	return result;
-}
-
+/* Insert out-of-order data into the receive queue, which is kept sorted and
+ * free of overlaps. Each buffer is tagged with the sequence number of its
+ * first byte. The data already queued is kept, the new data being trimmed
+ * around it, unless the new data covers it.
+ */
 static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 				size_t len, uint32_t seq)
 {
-	uint32_t seq_start = seq;
-	bool inserted = false;
+	struct net_buf *prev = NULL;
+	struct net_buf *next;
 	struct net_buf *tmp;
+	uint32_t end = seq + len;
+	int bufs = 0;
 
 	NET_DBG("conn: %p len %zd seq %u ack %u", conn, len, seq, conn->ack);
 
-	tmp = pkt->buffer;
-
-	tcp_set_seq(tmp, seq);
-	seq += tmp->len;
-	tmp = tmp->frags;
-
-	while (tmp) {
-		tcp_set_seq(tmp, seq);
-		seq += tmp->len;
-		tmp = tmp->frags;
+	for (tmp = pkt->buffer; tmp != NULL; tmp = tmp->frags) {
+		bufs++;
 	}
 
-	if (IS_ENABLED(CONFIG_NET_TCP_LOG_LEVEL_DBG)) {
-		NET_DBG("Queuing data: conn %p", conn);
+	if (conn->queue_recv_bufs + bufs > CONFIG_NET_TCP_RECV_QUEUE_CONN_BUFS ||
+	    atomic_get(&tcp_recv_queue_bufs) + bufs > TCP_RECV_QUEUE_TOTAL_BUFS) {
+		NET_DBG("conn: %p recv queue full (%u/%ld bufs)", conn,
+			conn->queue_recv_bufs, (long)atomic_get(&tcp_recv_queue_bufs));
+		net_stats_update_tcp_seg_drop(conn->iface);
+		return;
 	}
 
-	if (!net_pkt_is_empty(conn->queue_recv_data)) {
-		/* Place the data to correct place in the list. If the data
-		 * would not be sequential, then drop this packet.
-		 *
-		 * Only work with subtractions between sequence numbers in uint32_t format
-		 * to proper handle cases that are around the wrapping point.
-		 */
+	next = conn->queue_recv_data->buffer;
 
-		/* Some potentential cases:
-		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off1  | Start off| End off2    | Required handling
-		 * Seq|Len|Seq|Len|           |          |             |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | NA       | NA          | Prepend
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | NA       | NA          | Prepend, pull from buffer
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6=0    | 6+4-6=4     | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6=0    | 6+4-6=4     | Drop queued data / packet
-		 *  7 | 2 | 6 | 4 | 7+2-6 = 3 | 6-7=MI   | 6+4-7=3     | Drop packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10=MI-3| 6+4-10=0    | Append
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7 =MI  | 6+4-7 =3    | Append, pull from packet
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11=MI-6| 6+4-11=MI-1 | Drop incoming packet
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2=4    | 6+4-2=8     | Drop incoming packet
-		 */
+	while (next != NULL) {
+		uint32_t buf_seq = tcp_get_seq(next);
+		uint32_t buf_end = buf_seq + next->len;
 
-		uint32_t pending_seq;
-		uint32_t start_offset;
-		uint32_t end_offset;
-		size_t pending_len;
-
-		pending_seq = tcp_get_seq(conn->queue_recv_data->buffer);
-		end_offset = seq - pending_seq;
-		pending_len = net_pkt_get_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
-			if (end_offset < len) {
-				if (end_offset) {
-					net_pkt_remove_tail(pkt, end_offset);
-				}
+		if (net_tcp_seq_cmp(buf_end, seq) <= 0) {
+			/* Queued before the new data */
+			prev = next;
+			next = next->frags;
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(buf_seq, end) >= 0) {
+			/* Queued after the new data */
+			break;
+		}
 
-				/* Put new data before the pending data */
-				net_buf_frag_add(pkt->buffer,
-						 conn->queue_recv_data->buffer);
-				NET_DBG("Adding at before queue, end_offset %i, pending_len %zu",
-					end_offset, pending_len);
-				conn->queue_recv_data->buffer = pkt->buffer;
-				inserted = true;
+		if (net_tcp_seq_cmp(buf_seq, seq) <= 0) {
+			if (net_tcp_seq_cmp(buf_end, end) >= 0) {
+				NET_DBG("conn: %p data already queued", conn);
+				return;
 			}
-		} else {
-			struct net_buf *last;
 
-			last = net_buf_frag_last(conn->queue_recv_data->buffer);
-			pending_seq = tcp_get_seq(last);
+			/* Drop the head of the new data, already queued */
+			(void)tcp_pkt_pull(pkt, buf_end - seq);
+			len -= buf_end - seq;
+			seq = buf_end;
 
-			start_offset = pending_seq - seq_start;
-			/* Compute the offset w.r.t. the start point of the new packet */
-			end_offset = (pending_seq + last->len) - seq_start;
+			prev = next;
+			next = next->frags;
+			continue;
+		}
 
-			/* Check if queue start with within the within the new packet */
-			if ((start_offset < len) && (end_offset <= len)) {
-				/* The queued data is irrelevant since the new packet overlaps the
-				 * new packet, take the new packet as contents
-				 */
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = pkt->buffer;
-				inserted = true;
-			} else {
-				if (end_offset < len) {
-					if (end_offset) {
-						net_pkt_remove_tail(conn->queue_recv_data,
-								    end_offset);
-					}
-
-					/* Put new data after pending data */
-					NET_DBG("Adding at end of queue, start %i, end %i, len %zu",
-						start_offset, end_offset, len);
-					net_buf_frag_add(conn->queue_recv_data->buffer,
-							 pkt->buffer);
-					inserted = true;
-				}
+		if (net_tcp_seq_cmp(buf_end, end) <= 0) {
+			/* Queued data covered by the new data */
+			next = net_buf_frag_del(prev, next);
+			if (prev == NULL) {
+				conn->queue_recv_data->buffer = next;
 			}
+
+			tcp_recv_queue_account(conn, -1);
+			continue;
 		}
 
-		if (inserted) {
-			NET_DBG("All pending data: conn %p", conn);
-			if (check_seq_list(conn->queue_recv_data->buffer) == false) {
-				NET_ERR("Incorrect order in out of order sequence for conn %p",
-					conn);
-				/* error in sequence list, drop it */
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = NULL;
-			}
-		} else {
-			NET_DBG("Cannot add new data to queue");
+		/* Drop the tail of the new data, already queued */
+		net_pkt_remove_tail(pkt, end - buf_seq);
+		len -= end - buf_seq;
+		end = buf_seq;
+		break;
+	}
+
+	bufs = 0;
+
+	for (tmp = pkt->buffer; tmp != NULL; tmp = tmp->frags) {
+		tcp_set_seq(tmp, seq);
+		seq += tmp->len;
+		bufs++;
+	}
+
+	if (prev == NULL) {
+		if (next != NULL) {
+			net_buf_frag_add(pkt->buffer, next);
 		}
+
+		conn->queue_recv_data->buffer = pkt->buffer;
 	} else {
-		net_pkt_append_buffer(conn->queue_recv_data, pkt->buffer);
-		inserted = true;
+		net_buf_frag_insert(prev, pkt->buffer);
 	}
 
-	if (inserted) {
-		/* We need to keep the received data but free the pkt */
-		pkt->buffer = NULL;
+	tcp_recv_queue_account(conn, bufs);
 
-		if (!k_work_delayable_is_pending(&conn->recv_queue_timer)) {
-			k_work_reschedule_for_queue(
-				&tcp_work_q, &conn->recv_queue_timer,
-				K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
-		}
+	NET_DBG("conn: %p queued %zd bytes, %zd pending", conn, len,
+		net_pkt_get_len(conn->queue_recv_data));
+
+	/* We need to keep the received data but free the pkt */
+	pkt->buffer = NULL;
+
+	if (!k_work_delayable_is_pending(&conn->recv_queue_timer)) {
+		k_work_reschedule_for_queue(
+			&tcp_work_q, &conn->recv_queue_timer,
+			K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
 	}
 }
 
@@ -2840,6 +3338,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	/* The SACK options only describe the segment carrying them */
+	conn->recv_options.sack_perm_found = false;
+	conn->recv_options.sack_blocks = 0U;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
 						  tcp_options_len)) {
 		NET_DBG("DROP: Invalid TCP option list");
@@ -2890,6 +3394,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
@@ -3006,6 +3511,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3079,6 +3585,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		keep_alive_timer_restart(conn);
 
+		tcp_sack_update(conn, th_ack(th));
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3105,6 +3613,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				conn->unacked_len = 0;
 
 				(void)tcp_send_data(conn);
+				tcp_sack_recovery_start(conn, temp_unacked_len);
 
 				/* Restore the current transmission */
 				conn->unacked_len = temp_unacked_len;
@@ -3113,6 +3622,13 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt > DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+				   (len == 0)) {
+				/* Every further duplicate ACK tells a segment left the
+				 * network, fill the next hole reported by the peer.
+				 */
+				tcp_sack_retransmit(conn);
 			}
 		}
 #endif
@@ -3170,6 +3686,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 				conn->unacked_len = 0;
 				tcp_derive_rto(conn);
+			} else {
+				tcp_sack_partial_ack(conn);
 			}
 			conn->data_mode = TCP_DATA_MODE_SEND;
 			if (conn->send_data_total > 0) {
@@ -3986,7 +4504,11 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
+	/* The checksums of a packet sent in several segments are those of
+	 * the segments.
+	 */
+	if ((net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) &&
+	     net_pkt_gso_size(pkt) == 0U) || force_chksum) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
 	}
@@ -4002,8 +4524,7 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
-	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
-	     net_pkt_is_ip_reassembled(pkt)) &&
+	    net_pkt_need_calc_rx_chksum(pkt, type) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
 		goto drop;
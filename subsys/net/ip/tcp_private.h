@@ -227,26 +227,74 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Maximum number of blocks in a SACK option, and in the scoreboard */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_blocks;
+	bool sack_perm_found : 1;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
+struct tcp;
+
+/* Congestion avoidance algorithm */
+struct tcp_ca_ops {
+	const char *name;
+	void (*init)(struct tcp *conn);
+	void (*fast_retransmit)(struct tcp *conn);
+	void (*timeout)(struct tcp *conn);
+	void (*dup_ack)(struct tcp *conn);
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+struct tcp_ca_cubic {
+	/* Start of the current congestion avoidance epoch, 0 if none */
+	uint32_t epoch_start;
+	/* Time for the window to grow back to origin, in milliseconds */
+	uint32_t k;
+	/* Window before the last reduction */
+	uint32_t w_max;
+	/* Window the cubic function is centered on */
+	uint32_t origin;
+	/* Window NewReno would have */
+	uint32_t w_est;
+};
+#endif
+
 struct tcp_collision_avoidance_reno {
+	const struct tcp_ca_ops *ops;
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+	struct tcp_ca_cubic cubic;
+#endif
 };
 #endif
 
@@ -318,6 +366,8 @@ struct tcp { /* TCP connection */
 	uint16_t recv_win;
 	uint16_t send_win_max;
 	uint16_t send_win;
+	/* Buffers held by queue_recv_data */
+	uint16_t queue_recv_bufs;
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
 #endif
@@ -325,6 +375,15 @@ struct tcp { /* TCP connection */
 	struct tcp_collision_avoidance_reno ca;
 #endif
 	uint8_t send_data_retries;
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Data received by the peer beyond the acknowledged one */
+	struct tcp_sack_block sack_board[NET_TCP_SACK_MAX_BLOCKS];
+	/* End of the data retransmitted in the current recovery */
+	uint32_t sack_rexmit;
+	/* Data sent when the current recovery started */
+	uint32_t sack_recovery_point;
+	uint8_t sack_board_len;
+#endif
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	uint8_t dup_ack_cnt;
 #endif
@@ -337,6 +396,10 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#if defined(CONFIG_NET_TCP_SACK)
+	bool sack_ok : 1;
+	bool sack_recovery : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
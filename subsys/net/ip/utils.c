@@ -594,6 +594,35 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 		sum = sum + *((uint16_t *)data);
 		data += sizeof(uint16_t);
 	}
+
+#if defined(CONFIG_64BIT)
+	/* On 64-bit targets add whole 64-bit words with an end-around carry, then fold the
+	 * sum to 32 bits so the rest of the data can be added as below.
+	 */
+	if ((((uintptr_t)data & 0x04) != 0) && (pending >= sizeof(uint32_t))) {
+		pending -= sizeof(uint32_t);
+		sum = sum + *((uint32_t *)data);
+		data += sizeof(uint32_t);
+	}
+
+	{
+		const uint64_t *p64 = (const uint64_t *)data;
+
+		while (pending >= sizeof(uint64_t)) {
+			uint64_t word = *p64++;
+
+			pending -= sizeof(uint64_t);
+			sum += word;
+			sum += (sum < word);
+		}
+
+		data = (const uint8_t *)p64;
+	}
+
+	sum = (sum & 0xffffffff) + (sum >> 32);
+	sum = (sum & 0xffffffff) + (sum >> 32);
+#endif /* CONFIG_64BIT */
+
 	p = (uint32_t *)data;
 
 	/* Do loop unrolling for the very large data sets */
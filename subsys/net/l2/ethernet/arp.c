@@ -28,9 +28,13 @@ LOG_MODULE_REGISTER(net_arp, CONFIG_NET_ARP_LOG_LEVEL);
 static bool arp_cache_initialized;
 static struct arp_entry arp_entries[CONFIG_NET_ARP_TABLE_SIZE];
 
-static sys_slist_t arp_free_entries;
-static sys_slist_t arp_pending_entries;
-static sys_slist_t arp_table;
+static sys_dlist_t arp_free_entries;
+static sys_dlist_t arp_pending_entries;
+static sys_dlist_t arp_table;
+
+/* Entries of arp_table, hashed by IP address */
+static sys_slist_t arp_hash_table[CONFIG_NET_ARP_TABLE_HASH_SIZE];
+static struct arp_entry *arp_last_hit;
 
 static struct k_work_delayable arp_request_timer;
 
@@ -56,6 +60,8 @@ static void arp_entry_cleanup(struct arp_entry *entry, bool pending)
 				atomic_get(&pkt->atomic_ref) - 1);
 			net_pkt_unref(pkt);
 		}
+
+		entry->pending_count = 0U;
 	}
 
 	entry->iface = NULL;
@@ -64,14 +70,20 @@ static void arp_entry_cleanup(struct arp_entry *entry, bool pending)
 	(void)memset(&entry->eth, 0, sizeof(struct net_eth_addr));
 }
 
-static struct arp_entry *arp_entry_find(sys_slist_t *list,
+static inline sys_slist_t *arp_hash_bucket(struct in_addr *addr)
+{
+	uint32_t hash = UNALIGNED_GET(&addr->s_addr) * 2654435761U;
+
+	return &arp_hash_table[(hash >> 16) % CONFIG_NET_ARP_TABLE_HASH_SIZE];
+}
+
+static struct arp_entry *arp_entry_find(sys_dlist_t *list,
 					struct net_if *iface,
-					struct in_addr *dst,
-					sys_snode_t **previous)
+					struct in_addr *dst)
 {
 	struct arp_entry *entry;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(list, entry, node) {
+	SYS_DLIST_FOR_EACH_CONTAINER(list, entry, node) {
 		NET_DBG("iface %d (%p) dst %s",
 			net_if_get_by_iface(iface), iface,
 			net_sprint_ipv4_addr(&entry->ip));
@@ -83,33 +95,70 @@ static struct arp_entry *arp_entry_find(sys_slist_t *list,
 
 			return entry;
 		}
+	}
+
+	return NULL;
+}
+
+static struct arp_entry *arp_table_find(struct net_if *iface,
+					struct in_addr *dst)
+{
+	struct arp_entry *entry;
+
+	if (arp_last_hit != NULL && arp_last_hit->iface == iface &&
+	    net_ipv4_addr_cmp(&arp_last_hit->ip, dst)) {
+		return arp_last_hit;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(arp_hash_bucket(dst), entry, hash_node) {
+		if (entry->iface == iface &&
+		    net_ipv4_addr_cmp(&entry->ip, dst)) {
+			NET_DBG("found dst %s",
+				net_sprint_ipv4_addr(dst));
 
-		if (previous) {
-			*previous = &entry->node;
+			arp_last_hit = entry;
+			return entry;
 		}
 	}
 
 	return NULL;
 }
 
+static void arp_table_add(struct arp_entry *entry)
+{
+	sys_dlist_prepend(&arp_table, &entry->node);
+	sys_slist_prepend(arp_hash_bucket(&entry->ip), &entry->hash_node);
+}
+
+static void arp_table_remove(struct arp_entry *entry)
+{
+	sys_dlist_remove(&entry->node);
+	(void)sys_slist_find_and_remove(arp_hash_bucket(&entry->ip),
+					&entry->hash_node);
+
+	if (arp_last_hit == entry) {
+		arp_last_hit = NULL;
+	}
+}
+
 static inline struct arp_entry *arp_entry_find_move_first(struct net_if *iface,
 							  struct in_addr *dst)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
 	NET_DBG("dst %s", net_sprint_ipv4_addr(dst));
 
-	entry = arp_entry_find(&arp_table, iface, dst, &prev);
+	entry = arp_table_find(iface, dst);
 	if (entry) {
 		/* Let's assume the target is going to be accessed
 		 * more than once here in a short time frame. So we
-		 * place the entry first in position into the table
-		 * in order to reduce subsequent find.
+		 * place the entry first in position into the table,
+		 * the last one being the oldest one when an entry
+		 * has to be taken out.
 		 */
-		if (&entry->node != sys_slist_peek_head(&arp_table)) {
-			sys_slist_remove(&arp_table, prev, &entry->node);
-			sys_slist_prepend(&arp_table, &entry->node);
+		if (!sys_dlist_is_head(&arp_table, &entry->node)) {
+			sys_dlist_remove(&entry->node);
+			sys_dlist_prepend(&arp_table, &entry->node);
 		}
 	}
 
@@ -122,24 +171,23 @@ struct arp_entry *arp_entry_find_pending(struct net_if *iface,
 {
 	NET_DBG("dst %s", net_sprint_ipv4_addr(dst));
 
-	return arp_entry_find(&arp_pending_entries, iface, dst, NULL);
+	return arp_entry_find(&arp_pending_entries, iface, dst);
 }
 
 static struct arp_entry *arp_entry_get_pending(struct net_if *iface,
 					       struct in_addr *dst)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
 	NET_DBG("dst %s", net_sprint_ipv4_addr(dst));
 
-	entry = arp_entry_find(&arp_pending_entries, iface, dst, &prev);
+	entry = arp_entry_find(&arp_pending_entries, iface, dst);
 	if (entry) {
 		/* We remove the entry from the pending list */
-		sys_slist_remove(&arp_pending_entries, prev, &entry->node);
+		sys_dlist_remove(&entry->node);
 	}
 
-	if (sys_slist_is_empty(&arp_pending_entries)) {
+	if (sys_dlist_is_empty(&arp_pending_entries)) {
 		k_work_cancel_delayable(&arp_request_timer);
 	}
 
@@ -148,35 +196,37 @@ static struct arp_entry *arp_entry_get_pending(struct net_if *iface,
 
 static struct arp_entry *arp_entry_get_free(void)
 {
-	sys_snode_t *node;
+	sys_dnode_t *node;
 
-	node = sys_slist_peek_head(&arp_free_entries);
+	node = sys_dlist_peek_head(&arp_free_entries);
 	if (!node) {
 		return NULL;
 	}
 
 	/* We remove the node from the free list */
-	sys_slist_remove(&arp_free_entries, NULL, node);
+	sys_dlist_remove(node);
 
 	return CONTAINER_OF(node, struct arp_entry, node);
 }
 
 static struct arp_entry *arp_entry_get_last_from_table(void)
 {
-	sys_snode_t *node;
+	struct arp_entry *entry;
+	sys_dnode_t *node;
 
 	/* We assume last entry is the oldest one,
 	 * so is the preferred one to be taken out.
 	 */
 
-	node = sys_slist_peek_tail(&arp_table);
+	node = sys_dlist_peek_tail(&arp_table);
 	if (!node) {
 		return NULL;
 	}
 
-	sys_slist_find_and_remove(&arp_table, node);
+	entry = CONTAINER_OF(node, struct arp_entry, node);
+	arp_table_remove(entry);
 
-	return CONTAINER_OF(node, struct arp_entry, node);
+	return entry;
 }
 
 
@@ -184,7 +234,7 @@ static void arp_entry_register_pending(struct arp_entry *entry)
 {
 	NET_DBG("dst %s", net_sprint_ipv4_addr(&entry->ip));
 
-	sys_slist_append(&arp_pending_entries, &entry->node);
+	sys_dlist_append(&arp_pending_entries, &entry->node);
 
 	entry->req_start = k_uptime_get_32();
 
@@ -204,7 +254,7 @@ static void arp_request_timeout(struct k_work *work)
 
 	k_mutex_lock(&arp_mutex, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_pending_entries,
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&arp_pending_entries,
 					  entry, next, node) {
 		if ((int32_t)(entry->req_start +
 			    ARP_REQUEST_TIMEOUT - current) > 0) {
@@ -213,8 +263,8 @@ static void arp_request_timeout(struct k_work *work)
 
 		arp_entry_cleanup(entry, true);
 
-		sys_slist_remove(&arp_pending_entries, NULL, &entry->node);
-		sys_slist_append(&arp_free_entries, &entry->node);
+		sys_dlist_remove(&entry->node);
+		sys_dlist_append(&arp_free_entries, &entry->node);
 
 		entry = NULL;
 	}
@@ -300,6 +350,7 @@ static inline struct net_pkt *arp_prepare(struct net_if *iface,
 		if (!net_pkt_ipv4_acd(pkt)) {
 			net_pkt_ref(pending);
 			k_fifo_put(&entry->pending_queue, pending);
+			entry->pending_count = 1U;
 		}
 
 		entry->iface = net_pkt_iface(pkt);
@@ -352,6 +403,29 @@ static inline struct net_pkt *arp_prepare(struct net_if *iface,
 	return pkt;
 }
 
+/* Drop the oldest packet waiting for the resolution of the entry,
+ * if too many are queued.
+ */
+static void arp_entry_pending_limit(struct arp_entry *entry)
+{
+	struct net_pkt *pkt;
+
+	entry->pending_count++;
+
+	if (CONFIG_NET_ARP_PENDING_QUEUE_SIZE == 0 ||
+	    entry->pending_count <= CONFIG_NET_ARP_PENDING_QUEUE_SIZE) {
+		return;
+	}
+
+	pkt = k_fifo_get(&entry->pending_queue, K_NO_WAIT);
+	if (pkt) {
+		NET_DBG("Dropping pending pkt %p for %s", pkt,
+			net_sprint_ipv4_addr(&entry->ip));
+		net_pkt_unref(pkt);
+		entry->pending_count--;
+	}
+}
+
 int net_arp_prepare(struct net_pkt *pkt,
 		    struct in_addr *request_ip,
 		    struct in_addr *current_ip,
@@ -430,6 +504,7 @@ int net_arp_prepare(struct net_pkt *pkt,
 			if (k_queue_unique_append(&entry->pending_queue._queue, pkt)) {
 				NET_DBG("Pending ARP request for %s, queuing pkt %p",
 					net_sprint_ipv4_addr(addr), pkt);
+				arp_entry_pending_limit(entry);
 				k_mutex_unlock(&arp_mutex);
 				return NET_ARP_PKT_QUEUED;
 			}
@@ -454,7 +529,7 @@ int net_arp_prepare(struct net_pkt *pkt,
 			/* Add the arp entry back to arp_free_entries, to avoid the
 			 * arp entry is leak due to ARP packet allocated failed.
 			 */
-			sys_slist_prepend(&arp_free_entries, &entry->node);
+			sys_dlist_prepend(&arp_free_entries, &entry->node);
 		}
 
 		k_mutex_unlock(&arp_mutex);
@@ -483,10 +558,9 @@ static void arp_gratuitous(struct net_if *iface,
 			   struct in_addr *src,
 			   struct net_eth_addr *hwaddr)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
-	entry = arp_entry_find(&arp_table, iface, src, &prev);
+	entry = arp_table_find(iface, src);
 	if (entry) {
 		NET_DBG("Gratuitous ARP hwaddr %s -> %s",
 			net_sprint_ll_addr((const uint8_t *)&entry->eth,
@@ -660,10 +734,9 @@ void net_arp_update(struct net_if *iface,
 		}
 
 		if (force) {
-			sys_snode_t *prev = NULL;
 			struct arp_entry *arp_ent;
 
-			arp_ent = arp_entry_find(&arp_table, iface, src, &prev);
+			arp_ent = arp_table_find(iface, src);
 			if (arp_ent) {
 				memcpy(&arp_ent->eth, hwaddr,
 				       sizeof(struct net_eth_addr));
@@ -682,7 +755,7 @@ void net_arp_update(struct net_if *iface,
 					arp_ent->iface = iface;
 					net_ipaddr_copy(&arp_ent->ip, src);
 					memcpy(&arp_ent->eth, hwaddr, sizeof(arp_ent->eth));
-					sys_slist_prepend(&arp_table, &arp_ent->node);
+					arp_table_add(arp_ent);
 				}
 			}
 		}
@@ -695,7 +768,8 @@ void net_arp_update(struct net_if *iface,
 	memcpy(&entry->eth, hwaddr, sizeof(struct net_eth_addr));
 
 	/* Inserting entry into the table */
-	sys_slist_prepend(&arp_table, &entry->node);
+	arp_table_add(entry);
+	entry->pending_count = 0U;
 
 	while (!k_fifo_is_empty(&entry->pending_queue)) {
 		int ret;
@@ -917,43 +991,38 @@ enum net_verdict net_arp_input(struct net_pkt *pkt,
 
 void net_arp_clear_cache(struct net_if *iface)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry, *next;
 
 	NET_DBG("Flushing ARP table");
 
 	k_mutex_lock(&arp_mutex, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_table, entry, next, node) {
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&arp_table, entry, next, node) {
 		if (iface && iface != entry->iface) {
-			prev = &entry->node;
 			continue;
 		}
 
+		arp_table_remove(entry);
 		arp_entry_cleanup(entry, false);
 
-		sys_slist_remove(&arp_table, prev, &entry->node);
-		sys_slist_prepend(&arp_free_entries, &entry->node);
+		sys_dlist_prepend(&arp_free_entries, &entry->node);
 	}
 
-	prev = NULL;
-
 	NET_DBG("Flushing ARP pending requests");
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_pending_entries,
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&arp_pending_entries,
 					  entry, next, node) {
 		if (iface && iface != entry->iface) {
-			prev = &entry->node;
 			continue;
 		}
 
 		arp_entry_cleanup(entry, true);
 
-		sys_slist_remove(&arp_pending_entries, prev, &entry->node);
-		sys_slist_prepend(&arp_free_entries, &entry->node);
+		sys_dlist_remove(&entry->node);
+		sys_dlist_prepend(&arp_free_entries, &entry->node);
 	}
 
-	if (sys_slist_is_empty(&arp_pending_entries)) {
+	if (sys_dlist_is_empty(&arp_pending_entries)) {
 		k_work_cancel_delayable(&arp_request_timer);
 	}
 
@@ -980,7 +1049,7 @@ int net_arp_foreach(net_arp_cb_t cb, void *user_data)
 
 	k_mutex_lock(&arp_mutex, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&arp_table, entry, node) {
+	SYS_DLIST_FOR_EACH_CONTAINER(&arp_table, entry, node) {
 		ret++;
 		cb(entry, user_data);
 	}
@@ -998,14 +1067,18 @@ void net_arp_init(void)
 		return;
 	}
 
-	sys_slist_init(&arp_free_entries);
-	sys_slist_init(&arp_pending_entries);
-	sys_slist_init(&arp_table);
+	sys_dlist_init(&arp_free_entries);
+	sys_dlist_init(&arp_pending_entries);
+	sys_dlist_init(&arp_table);
+
+	for (i = 0; i < CONFIG_NET_ARP_TABLE_HASH_SIZE; i++) {
+		sys_slist_init(&arp_hash_table[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_ARP_TABLE_SIZE; i++) {
 		/* Inserting entry as free with initialised packet queue */
 		k_fifo_init(&arp_entries[i].pending_queue);
-		sys_slist_prepend(&arp_free_entries, &arp_entries[i].node);
+		sys_dlist_prepend(&arp_free_entries, &arp_entries[i].node);
 	}
 
 	k_work_init_delayable(&arp_request_timer, arp_request_timeout);
@@ -7,6 +7,7 @@
 #ifndef __ARP_H
 #define __ARP_H
 
+#include <zephyr/sys/dlist.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/net/ethernet.h>
 
@@ -75,11 +76,13 @@ int net_arp_clear_pending(struct net_if *iface,
 				struct in_addr *dst);
 
 struct arp_entry {
-	sys_snode_t node;
+	sys_dnode_t node;
+	sys_snode_t hash_node;
 	uint32_t req_start;
 	struct net_if *iface;
 	struct in_addr ip;
 	struct net_eth_addr eth;
+	uint16_t pending_count;
 	struct k_fifo pending_queue;
 };
 
@@ -15,6 +15,7 @@ LOG_MODULE_REGISTER(net_eth_bridge, CONFIG_NET_ETHERNET_BRIDGE_LOG_LEVEL);
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/ethernet_bridge.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/random/random.h>
 
 #include "net_private.h"
@@ -31,6 +32,9 @@ LOG_MODULE_REGISTER(net_eth_bridge, CONFIG_NET_ETHERNET_BRIDGE_LOG_LEVEL);
 #define MAX_BRIDGE_NAME_LEN MIN(sizeof("bridge##"), CONFIG_NET_INTERFACE_NAME_LEN)
 #define MAX_VIRT_NAME_LEN MIN(sizeof("<no config>"), CONFIG_NET_L2_VIRTUAL_MAX_NAME_LEN)
 
+/* How many consecutive FDB slots an address can be stored in */
+#define FDB_PROBES MIN(4, CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE)
+
 static void lock_bridge(struct eth_bridge_iface_context *ctx)
 {
 	k_mutex_lock(&ctx->lock, K_FOREVER);
@@ -86,6 +90,97 @@ struct net_if *eth_bridge_get_by_index(int index)
 	return net_if_get_by_index(index);
 }
 
+static size_t fdb_hash(const struct net_eth_addr *addr)
+{
+	uint32_t hash = sys_get_be32(&addr->addr[2]) ^ sys_get_be16(&addr->addr[0]);
+
+	return ((hash * 2654435761U) >> 16) % CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE;
+}
+
+static bool fdb_entry_expired(struct eth_bridge_fdb_entry *entry, uint32_t now)
+{
+	return !entry->valid ||
+	       now - entry->seen >= CONFIG_NET_ETHERNET_BRIDGE_FDB_AGEING_TIME;
+}
+
+/* Must be called with the bridge lock held */
+static void fdb_learn(struct eth_bridge_iface_context *ctx,
+		      const struct net_eth_addr *addr, uint8_t port)
+{
+	size_t idx = fdb_hash(addr);
+	uint32_t now = k_uptime_seconds();
+	struct eth_bridge_fdb_entry *victim = NULL;
+
+	for (size_t i = 0; i < FDB_PROBES; i++) {
+		struct eth_bridge_fdb_entry *entry =
+			&ctx->fdb[(idx + i) % CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE];
+
+		if (entry->valid && memcmp(&entry->addr, addr, sizeof(*addr)) == 0) {
+			victim = entry;
+			break;
+		}
+
+		/* Reuse an expired slot, otherwise the oldest entry */
+		if (victim == NULL ||
+		    (!fdb_entry_expired(victim, now) &&
+		     (fdb_entry_expired(entry, now) || entry->seen < victim->seen))) {
+			victim = entry;
+		}
+	}
+
+	if (!victim->valid || victim->port != port ||
+	    memcmp(&victim->addr, addr, sizeof(*addr)) != 0) {
+		NET_DBG("Learned %s on port %d",
+			net_sprint_ll_addr(addr->addr, sizeof(*addr)), port);
+	}
+
+	memcpy(&victim->addr, addr, sizeof(*addr));
+	victim->port = port;
+	victim->seen = now;
+	victim->valid = true;
+}
+
+/* Must be called with the bridge lock held */
+static int fdb_lookup(struct eth_bridge_iface_context *ctx,
+		      const struct net_eth_addr *addr)
+{
+	size_t idx = fdb_hash(addr);
+	uint32_t now = k_uptime_seconds();
+
+	for (size_t i = 0; i < FDB_PROBES; i++) {
+		struct eth_bridge_fdb_entry *entry =
+			&ctx->fdb[(idx + i) % CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE];
+
+		if (!fdb_entry_expired(entry, now) &&
+		    memcmp(&entry->addr, addr, sizeof(*addr)) == 0) {
+			return entry->port;
+		}
+	}
+
+	return -ENOENT;
+}
+
+/* Must be called with the bridge lock held */
+static void fdb_flush_port(struct eth_bridge_iface_context *ctx, uint8_t port)
+{
+	ARRAY_FOR_EACH(ctx->fdb, i) {
+		if (ctx->fdb[i].port == port) {
+			ctx->fdb[i].valid = false;
+		}
+	}
+}
+
+static int bridge_port_get(struct eth_bridge_iface_context *ctx, struct net_if *iface)
+{
+	ARRAY_FOR_EACH(ctx->eth_iface, i) {
+		if (iface != NULL && ctx->eth_iface[i] == iface) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
 int eth_bridge_iface_add(struct net_if *br, struct net_if *iface)
 {
 	struct eth_bridge_iface_context *ctx = net_if_get_device(br)->data;
@@ -116,6 +211,8 @@ int eth_bridge_iface_add(struct net_if *br, struct net_if *iface)
 			ctx->eth_iface[i] = iface;
 			eth_ctx->bridge = br;
 			found = true;
+
+			memset(&ctx->stats[i], 0, sizeof(ctx->stats[i]));
 		}
 
 		/* Calculate how many interfaces are added to this bridge */
@@ -187,6 +284,8 @@ int eth_bridge_iface_remove(struct net_if *br, struct net_if *iface)
 			ctx->eth_iface[i] = NULL;
 			eth_ctx->bridge = NULL;
 			found = true;
+
+			fdb_flush_port(ctx, i);
 		}
 
 		/* Calculate how many interfaces are added to this bridge */
@@ -333,13 +432,51 @@ static int bridge_iface_stop(const struct device *dev)
 	return 0;
 }
 
+/* Must be called with the bridge lock held */
+static void bridge_port_send(struct eth_bridge_iface_context *ctx, size_t port,
+			     struct net_pkt *pkt, bool shared, bool is_send)
+{
+	struct net_pkt *send_pkt;
+
+	/* Only the packet metadata is cloned if the frame is sent to more than
+	 * one port, the frame data is referenced by all the copies and is not
+	 * modified when sent.
+	 */
+	if (shared) {
+		send_pkt = net_pkt_shallow_clone(pkt, K_NO_WAIT);
+		if (send_pkt == NULL) {
+			NET_DBG("DROP: clone failed");
+			ctx->stats[port].dropped++;
+			return;
+		}
+
+		net_pkt_ref(send_pkt);
+	} else {
+		send_pkt = net_pkt_ref(pkt);
+	}
+
+	net_pkt_set_family(send_pkt, AF_UNSPEC);
+	net_pkt_set_iface(send_pkt, ctx->eth_iface[port]);
+	net_if_queue_tx(ctx->eth_iface[port], send_pkt);
+
+	ctx->stats[port].tx++;
+
+	NET_DBG("%s iface %d pkt %p (ref %d)",
+		is_send ? "Send" : "Recv",
+		net_if_get_by_iface(ctx->eth_iface[port]),
+		send_pkt, (int)atomic_get(&send_pkt->atomic_ref));
+
+	net_pkt_unref(send_pkt);
+}
+
 static enum net_verdict bridge_iface_process(struct net_if *iface,
 					     struct net_pkt *pkt,
 					     bool is_send)
 {
 	struct eth_bridge_iface_context *ctx = net_if_get_device(iface)->data;
+	struct net_eth_hdr *hdr = NULL;
 	struct net_if *orig_iface;
-	struct net_pkt *send_pkt;
+	int in_port, out_port = -ENOENT;
 	size_t count;
 
 	/* Drop all link-local packets for now. */
@@ -348,12 +485,46 @@ static enum net_verdict bridge_iface_process(struct net_if *iface,
 		goto out;
 	}
 
+	if (pkt->buffer != NULL && pkt->buffer->len >= sizeof(struct net_eth_hdr)) {
+		hdr = NET_ETH_HDR(pkt);
+	}
+
 	lock_bridge(ctx);
 
 	/* Keep the original packet interface so that we can send to each
 	 * bridged interface.
 	 */
 	orig_iface = net_pkt_orig_iface(pkt);
+	in_port = bridge_port_get(ctx, orig_iface);
+
+	if (in_port >= 0) {
+		ctx->stats[in_port].rx++;
+
+		if (hdr != NULL && !net_eth_is_addr_group(&hdr->src)) {
+			fdb_learn(ctx, &hdr->src, in_port);
+		}
+	}
+
+	if (hdr != NULL && !net_eth_is_addr_group(&hdr->dst)) {
+		out_port = fdb_lookup(ctx, &hdr->dst);
+	}
+
+	if (out_port >= 0 && out_port == in_port) {
+		/* The destination is on the port the frame came from */
+		NET_DBG("DROP: destination on the same port");
+		ctx->stats[in_port].filtered++;
+		goto unlock;
+	}
+
+	if (out_port >= 0 && ctx->eth_iface[out_port] != NULL &&
+	    net_if_flag_is_set(ctx->eth_iface[out_port], NET_IF_UP)) {
+		bridge_port_send(ctx, out_port, pkt, false, is_send);
+		goto unlock;
+	}
+
+	if (in_port >= 0) {
+		ctx->stats[in_port].flooded++;
+	}
 
 	count = ctx->count;
 
@@ -367,34 +538,11 @@ static enum net_verdict bridge_iface_process(struct net_if *iface,
 				continue;
 			}
 
-			/* Clone the packet if we have more than two interfaces in the bridge
-			 * because the first send might mess the data part of the message.
-			 */
-			if (count > 2) {
-				send_pkt = net_pkt_clone(pkt, K_NO_WAIT);
-				if (send_pkt == NULL) {
-					NET_DBG("DROP: clone failed");
-					break;
-				}
-
-				net_pkt_ref(send_pkt);
-			} else {
-				send_pkt = net_pkt_ref(pkt);
-			}
-
-			net_pkt_set_family(send_pkt, AF_UNSPEC);
-			net_pkt_set_iface(send_pkt, ctx->eth_iface[i]);
-			net_if_queue_tx(ctx->eth_iface[i], send_pkt);
-
-			NET_DBG("%s iface %d pkt %p (ref %d)",
-				is_send ? "Send" : "Recv",
-				net_if_get_by_iface(ctx->eth_iface[i]),
-				send_pkt, (int)atomic_get(&send_pkt->atomic_ref));
-
-			net_pkt_unref(send_pkt);
+			bridge_port_send(ctx, i, pkt, count > 2, is_send);
 		}
 	}
 
+unlock:
 	unlock_bridge(ctx);
 
 out:
@@ -404,6 +552,31 @@ out:
 	return NET_OK;
 }
 
+int eth_bridge_port_stats_get(struct net_if *br, struct net_if *iface,
+			      struct eth_bridge_port_stats *stats)
+{
+	struct eth_bridge_iface_context *ctx;
+	int port;
+
+	if (net_if_l2(br) != &NET_L2_GET_NAME(VIRTUAL) ||
+	    !(net_virtual_get_iface_capabilities(br) & VIRTUAL_INTERFACE_BRIDGE)) {
+		return -EINVAL;
+	}
+
+	ctx = net_if_get_device(br)->data;
+
+	lock_bridge(ctx);
+
+	port = bridge_port_get(ctx, iface);
+	if (port >= 0) {
+		*stats = ctx->stats[port];
+	}
+
+	unlock_bridge(ctx);
+
+	return port < 0 ? port : 0;
+}
+
 int bridge_iface_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	if (DEBUG_TX) {
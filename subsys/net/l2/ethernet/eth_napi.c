@@ -0,0 +1,70 @@
+/** @file
+ * @brief Reception of Ethernet frames by polling
+ *
+ * The network devices are polled from a single work queue, each for up
+ * to a budget of frames at a time, until they have no frame left.
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/net/ethernet.h>
+
+static K_KERNEL_STACK_DEFINE(eth_napi_stack, CONFIG_NET_ETH_NAPI_STACK_SIZE);
+static struct k_work_q eth_napi_work_q;
+
+static void eth_napi_poll(struct k_work *work)
+{
+	struct net_eth_napi *napi = CONTAINER_OF(work, struct net_eth_napi, work);
+	int count;
+
+	count = napi->poll(napi, CONFIG_NET_ETH_NAPI_BUDGET);
+	if (count >= CONFIG_NET_ETH_NAPI_BUDGET) {
+		/* More frames are likely waiting, poll the other devices
+		 * first.
+		 */
+		k_work_submit_to_queue(&eth_napi_work_q, work);
+		return;
+	}
+
+	/* A frame received in the meantime raises an interrupt again */
+	napi->irq_enable(napi);
+}
+
+void net_eth_napi_init(struct net_eth_napi *napi, net_eth_napi_poll_t poll,
+		       net_eth_napi_irq_enable_t irq_enable)
+{
+	k_work_init(&napi->work, eth_napi_poll);
+	napi->poll = poll;
+	napi->irq_enable = irq_enable;
+}
+
+void net_eth_napi_schedule(struct net_eth_napi *napi)
+{
+	k_work_submit_to_queue(&eth_napi_work_q, &napi->work);
+}
+
+static int eth_napi_work_q_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "eth_napi",
+		.no_yield = false,
+	};
+
+	k_work_queue_init(&eth_napi_work_q);
+	k_work_queue_start(&eth_napi_work_q, eth_napi_stack,
+			   K_KERNEL_STACK_SIZEOF(eth_napi_stack),
+			   K_PRIO_COOP(CONFIG_NET_ETH_NAPI_THREAD_PRIO), &cfg);
+
+	return 0;
+}
+
+SYS_INIT(eth_napi_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
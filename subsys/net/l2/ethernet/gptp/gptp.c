@@ -553,6 +553,12 @@ static void gptp_state_machine(void)
 	gptp_mi_state_machines();
 }
 
+void gptp_state_machine_trigger(void)
+{
+	/* Makes the gPTP thread return from its wait with no packet */
+	k_fifo_cancel_wait(&gptp_rx_queue);
+}
+
 static void gptp_thread(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1);
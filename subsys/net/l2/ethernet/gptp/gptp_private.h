@@ -62,6 +62,14 @@ bool gptp_is_slave_port(int port);
  */
 int gptp_get_port_number(struct net_if *iface);
 
+/**
+ * @brief Run the state machines without waiting for the next poll.
+ *
+ * Used when an event the state machines poll for, like a TX timestamp,
+ * becomes available.
+ */
+void gptp_state_machine_trigger(void);
+
 /**
  * @brief Calculate a logInterval and store in Uscaled ns structure.
  *
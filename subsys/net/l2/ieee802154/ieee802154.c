@@ -16,6 +16,7 @@ LOG_MODULE_REGISTER(net_ieee802154, CONFIG_NET_L2_IEEE802154_LOG_LEVEL);
 
 #include <errno.h>
 
+#include <zephyr/init.h>
 #include <zephyr/net/capture.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_core.h>
@@ -43,7 +44,13 @@ LOG_MODULE_REGISTER(net_ieee802154, CONFIG_NET_L2_IEEE802154_LOG_LEVEL);
 
 #define BUF_TIMEOUT K_MSEC(50)
 
-NET_BUF_POOL_DEFINE(tx_frame_buf_pool, 1, IEEE802154_MTU, 8, NULL);
+#if defined(CONFIG_NET_L2_IEEE802154_TX_PIPELINE)
+#define TX_FRAME_BUF_COUNT 2
+#else
+#define TX_FRAME_BUF_COUNT 1
+#endif
+
+NET_BUF_POOL_DEFINE(tx_frame_buf_pool, TX_FRAME_BUF_COUNT, IEEE802154_MTU, 8, NULL);
 
 #define PKT_TITLE    "IEEE 802.15.4 packet content:"
 #define TX_PKT_TITLE "> " PKT_TITLE
@@ -247,6 +254,80 @@ int ieee802154_radio_send(struct net_if *iface, struct net_pkt *pkt, struct net_
 	return -EIO;
 }
 
+#if defined(CONFIG_NET_L2_IEEE802154_TX_PIPELINE)
+/* Frame of a fragmented packet, sent by the TX pipeline thread while the
+ * sending thread prepares the next one.
+ */
+static struct {
+	struct k_sem start;
+	struct k_sem done;
+	struct net_if *iface;
+	struct net_pkt *pkt;
+	struct net_buf *frame;
+	int ret;
+	bool busy;
+} tx_pipeline;
+
+static K_KERNEL_STACK_DEFINE(tx_pipeline_stack, CONFIG_NET_L2_IEEE802154_TX_PIPELINE_STACK_SIZE);
+static struct k_thread tx_pipeline_thread;
+
+static void tx_pipeline_run(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&tx_pipeline.start, K_FOREVER);
+
+		tx_pipeline.ret = ieee802154_radio_send(tx_pipeline.iface, tx_pipeline.pkt,
+							tx_pipeline.frame);
+
+		k_sem_give(&tx_pipeline.done);
+	}
+}
+
+static void tx_pipeline_submit(struct net_if *iface, struct net_pkt *pkt, struct net_buf *frame)
+{
+	tx_pipeline.iface = iface;
+	tx_pipeline.pkt = pkt;
+	tx_pipeline.frame = frame;
+	tx_pipeline.busy = true;
+
+	k_sem_give(&tx_pipeline.start);
+}
+
+/* Wait for the frame being sent, if any, and return its result */
+static int tx_pipeline_wait(void)
+{
+	if (!tx_pipeline.busy) {
+		return 0;
+	}
+
+	k_sem_take(&tx_pipeline.done, K_FOREVER);
+	tx_pipeline.busy = false;
+
+	return tx_pipeline.ret;
+}
+
+static int tx_pipeline_init(void)
+{
+	k_sem_init(&tx_pipeline.start, 0, 1);
+	k_sem_init(&tx_pipeline.done, 0, 1);
+
+	k_thread_create(&tx_pipeline_thread, tx_pipeline_stack,
+			K_KERNEL_STACK_SIZEOF(tx_pipeline_stack), tx_pipeline_run,
+			NULL, NULL, NULL,
+			K_PRIO_COOP(CONFIG_NET_L2_IEEE802154_TX_PIPELINE_THREAD_PRIO), 0,
+			K_NO_WAIT);
+	k_thread_name_set(&tx_pipeline_thread, "ieee802154_tx");
+
+	return 0;
+}
+
+SYS_INIT(tx_pipeline_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_NET_L2_IEEE802154_TX_PIPELINE */
+
 static inline void swap_and_set_pkt_ll_addr(struct net_linkaddr *addr, bool has_pan_id,
 					    enum ieee802154_addressing_mode mode,
 					    struct ieee802154_address_field *ll)
@@ -476,17 +557,21 @@ static int ieee802154_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct ieee802154_context *ctx = net_if_l2_data(iface);
 	uint8_t ll_hdr_len = 0, authtag_len = 0;
-	static struct net_buf *frame_buf;
+	static struct net_buf *frame_bufs[TX_FRAME_BUF_COUNT];
 	static struct net_buf *pkt_buf;
+	struct net_buf *frame_buf;
+	uint8_t frame_idx = 0U;
 	bool send_raw = false;
-	int len;
+	int len, ret = 0;
 #ifdef CONFIG_NET_L2_IEEE802154_FRAGMENT
 	struct ieee802154_6lo_fragment_ctx frag_ctx;
 	int requires_fragmentation = 0;
 #endif
 
-	if (frame_buf == NULL) {
-		frame_buf = net_buf_alloc(&tx_frame_buf_pool, K_FOREVER);
+	for (uint8_t i = 0U; i < TX_FRAME_BUF_COUNT; i++) {
+		if (frame_bufs[i] == NULL) {
+			frame_bufs[i] = net_buf_alloc(&tx_frame_buf_pool, K_FOREVER);
+		}
 	}
 
 	if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && net_pkt_family(pkt) == AF_PACKET) {
@@ -542,7 +627,9 @@ static int ieee802154_send(struct net_if *iface, struct net_pkt *pkt)
 	len = 0;
 	pkt_buf = pkt->buffer;
 	while (pkt_buf) {
-		int ret;
+		/* With the TX pipeline, the other buffer may be in flight */
+		frame_buf = frame_bufs[frame_idx];
+		frame_idx = (frame_idx + 1U) % TX_FRAME_BUF_COUNT;
 
 		/* Reinitializing frame_buf */
 		net_buf_reset(frame_buf);
@@ -558,7 +645,8 @@ static int ieee802154_send(struct net_if *iface, struct net_pkt *pkt)
 #else
 		if (ll_hdr_len + pkt_buf->len + authtag_len > IEEE802154_MTU) {
 			NET_ERR("Frame too long: %d", pkt_buf->len);
-			return -EINVAL;
+			ret = -EINVAL;
+			break;
 		}
 		net_buf_add_mem(frame_buf, pkt_buf->data, pkt_buf->len);
 		pkt_buf = pkt_buf->frags;
@@ -570,17 +658,42 @@ static int ieee802154_send(struct net_if *iface, struct net_pkt *pkt)
 		if (!(send_raw || ieee802154_create_data_frame(ctx, net_pkt_lladdr_dst(pkt),
 							       net_pkt_lladdr_src(pkt),
 							       frame_buf, ll_hdr_len))) {
-			return -EINVAL;
+			ret = -EINVAL;
+			break;
+		}
+
+#if defined(CONFIG_NET_L2_IEEE802154_TX_PIPELINE)
+		/* The previous frame is sent, or failed, by the time this one is ready */
+		ret = tx_pipeline_wait();
+		if (ret) {
+			break;
+		}
+
+		if (pkt_buf) {
+			/* More frames follow, prepare the next one while this one is sent */
+			tx_pipeline_submit(iface, pkt, frame_buf);
+			len += frame_buf->len;
+			continue;
 		}
+#endif /* CONFIG_NET_L2_IEEE802154_TX_PIPELINE */
 
 		ret = ieee802154_radio_send(iface, pkt, frame_buf);
 		if (ret) {
-			return ret;
+			break;
 		}
 
 		len += frame_buf->len;
 	}
 
+#if defined(CONFIG_NET_L2_IEEE802154_TX_PIPELINE)
+	/* The packet must not be released while one of its frames is sent */
+	(void)tx_pipeline_wait();
+#endif
+
+	if (ret) {
+		return ret;
+	}
+
 	net_pkt_unref(pkt);
 
 	return len;
@@ -42,6 +42,8 @@ struct frag_cache {
 	struct net_pkt *pkt;	       /* Reassemble packet */
 	uint16_t size;		       /* Datagram size */
 	uint16_t tag;		       /* Datagram tag */
+	uint16_t received;	       /* Payload received, without fragment headers */
+	int hdr_diff;		       /* Uncompressed header growth, once FRAG1 is received */
 	bool used;
 };
 
@@ -256,25 +258,29 @@ static void update_protocol_header_lengths(struct net_pkt *pkt, uint16_t size)
 	}
 }
 
-static inline void clear_reass_cache(uint16_t size, uint16_t tag)
+/* First cache slot probed for a datagram */
+static inline uint8_t reass_cache_hash(struct net_linkaddr *src, uint16_t size, uint16_t tag)
 {
-	uint8_t i;
+	uint32_t hash = ((uint32_t)tag << 16) | size;
 
-	for (i = 0U; i < REASS_CACHE_SIZE; i++) {
-		if (!(cache[i].size == size && cache[i].tag == tag)) {
-			continue;
-		}
+	for (uint8_t i = 0U; i < src->len; i++) {
+		hash = hash * 31U + src->addr[i];
+	}
 
-		if (cache[i].pkt) {
-			net_pkt_unref(cache[i].pkt);
-		}
+	return ((hash * 2654435761U) >> 16) % REASS_CACHE_SIZE;
+}
 
-		cache[i].pkt = NULL;
-		cache[i].size = 0U;
-		cache[i].tag = 0U;
-		cache[i].used = false;
-		k_work_cancel_delayable(&cache[i].timer);
+static inline void clear_reass_cache(struct frag_cache *fcache)
+{
+	if (fcache->pkt) {
+		net_pkt_unref(fcache->pkt);
 	}
+
+	fcache->pkt = NULL;
+	fcache->size = 0U;
+	fcache->tag = 0U;
+	fcache->used = false;
+	k_work_cancel_delayable(&fcache->timer);
 }
 
 /**
@@ -303,39 +309,46 @@ static void reass_timeout(struct k_work *work)
  */
 static inline struct frag_cache *set_reass_cache(struct net_pkt *pkt, uint16_t size, uint16_t tag)
 {
-	int i;
+	uint8_t first = reass_cache_hash(net_pkt_lladdr_src(pkt), size, tag);
 
-	for (i = 0; i < REASS_CACHE_SIZE; i++) {
-		if (cache[i].used) {
+	for (uint8_t n = 0U; n < REASS_CACHE_SIZE; n++) {
+		struct frag_cache *fcache = &cache[(first + n) % REASS_CACHE_SIZE];
+
+		if (fcache->used) {
 			continue;
 		}
 
-		cache[i].pkt = pkt;
-		cache[i].size = size;
-		cache[i].tag = tag;
-		cache[i].used = true;
+		fcache->pkt = pkt;
+		fcache->size = size;
+		fcache->tag = tag;
+		fcache->received = 0U;
+		fcache->hdr_diff = INT_MAX;
+		fcache->used = true;
 
-		k_work_init_delayable(&cache[i].timer, reass_timeout);
-		k_work_reschedule(&cache[i].timer, FRAG_REASSEMBLY_TIMEOUT);
-		return &cache[i];
+		k_work_init_delayable(&fcache->timer, reass_timeout);
+		k_work_reschedule(&fcache->timer, FRAG_REASSEMBLY_TIMEOUT);
+		return fcache;
 	}
 
 	return NULL;
 }
 
 /**
- *  Return cache if it matches with size and tag of stored caches,
- *  otherwise return NULL.
+ *  Return cache if it matches with source, size and tag of stored caches,
+ *  otherwise return NULL. The datagrams of different senders may have the
+ *  same size and tag (RFC 4944, section 5.3).
  */
-static inline struct frag_cache *get_reass_cache(uint16_t size, uint16_t tag)
+static inline struct frag_cache *get_reass_cache(struct net_linkaddr *src,
+						 uint16_t size, uint16_t tag)
 {
-	uint8_t i;
+	uint8_t first = reass_cache_hash(src, size, tag);
 
-	for (i = 0U; i < REASS_CACHE_SIZE; i++) {
-		if (cache[i].used) {
-			if (cache[i].size == size && cache[i].tag == tag) {
-				return &cache[i];
-			}
+	for (uint8_t n = 0U; n < REASS_CACHE_SIZE; n++) {
+		struct frag_cache *fcache = &cache[(first + n) % REASS_CACHE_SIZE];
+
+		if (fcache->used && fcache->size == size && fcache->tag == tag &&
+		    net_linkaddr_cmp(net_pkt_lladdr_src(fcache->pkt), src)) {
+			return fcache;
 		}
 	}
 
@@ -355,25 +368,20 @@ static inline void fragment_append(struct net_pkt *pkt, struct net_buf *frag)
 	}
 }
 
-static inline size_t fragment_cached_pkt_len(struct net_pkt *pkt)
+static inline uint16_t fragment_payload_len(struct net_buf *frag)
 {
-	size_t len = 0U;
-	struct net_buf *frag;
-	int hdr_diff;
-	uint8_t *data;
-
-	frag = pkt->buffer;
-	while (frag) {
-		uint16_t frag_hdr_len = NET_6LO_FRAGN_HDR_LEN;
-
-		if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
-			frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
-		}
+	if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
+		return frag->len - NET_6LO_FRAG1_HDR_LEN;
+	}
 
-		len += frag->len - frag_hdr_len;
+	return frag->len - NET_6LO_FRAGN_HDR_LEN;
+}
 
-		frag = frag->frags;
-	}
+/* Header growth of the uncompressed datagram, from its first fragment */
+static inline int fragment_hdr_diff(struct net_pkt *pkt)
+{
+	uint8_t *data;
+	int hdr_diff;
 
 	/* 6lo assumes that fragment header has been removed,
 	 * and in our side we assume first buffer is always the first fragment.
@@ -385,11 +393,7 @@ static inline size_t fragment_cached_pkt_len(struct net_pkt *pkt)
 
 	pkt->buffer->data = data;
 
-	if (hdr_diff == INT_MAX) {
-		return 0;
-	}
-
-	return len + hdr_diff;
+	return hdr_diff;
 }
 
 static inline uint16_t fragment_offset(struct net_buf *frag)
@@ -401,6 +405,20 @@ static inline uint16_t fragment_offset(struct net_buf *frag)
 	return ((uint16_t)frag->data[NET_FRAG_OFFSET_POS] << 3);
 }
 
+/* Is a fragment at the same offset as frag already cached */
+static bool fragment_is_duplicate(struct net_pkt *pkt, struct net_buf *frag)
+{
+	uint16_t offset = fragment_offset(frag);
+
+	for (struct net_buf *cur = pkt->buffer; cur != NULL; cur = cur->frags) {
+		if (fragment_offset(cur) == offset) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 static void fragment_move_back(struct net_pkt *pkt, struct net_buf *frag, struct net_buf *stop)
 {
 	struct net_buf *prev, *current;
@@ -507,7 +525,7 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 	 */
 	pkt->buffer = NULL;
 
-	fcache = get_reass_cache(size, tag);
+	fcache = get_reass_cache(net_pkt_lladdr_src(pkt), size, tag);
 	if (!fcache) {
 		fcache = set_reass_cache(pkt, size, tag);
 		if (!fcache) {
@@ -519,11 +537,22 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 		}
 
 		first_frag = true;
+	} else if (fragment_is_duplicate(fcache->pkt, frag)) {
+		/* Retransmitted fragment, it would break the length accounting */
+		NET_DBG("Duplicate fragment (size %u, tag %u): fragment dropped", size, tag);
+		pkt->buffer = frag;
+		return NET_DROP;
 	}
 
 	fragment_append(fcache->pkt, frag);
 
-	if (fragment_cached_pkt_len(fcache->pkt) == fcache->size) {
+	fcache->received += fragment_payload_len(frag);
+	if (type == NET_6LO_DISPATCH_FRAG1) {
+		fcache->hdr_diff = fragment_hdr_diff(fcache->pkt);
+	}
+
+	if (fcache->hdr_diff != INT_MAX &&
+	    fcache->received + fcache->hdr_diff == fcache->size) {
 		/* All fragments received - reassemble packet. */
 
 		if (!first_frag) {
@@ -537,7 +566,7 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 			fcache->pkt = NULL;
 		}
 
-		clear_reass_cache(size, tag);
+		clear_reass_cache(fcache);
 
 		if (!fragment_packet_valid(pkt)) {
 			NET_ERR("Invalid fragment type: packet dropped");
@@ -381,7 +381,7 @@ static enum net_verdict interface_recv(struct net_if *iface,
 		NET_PKT_DATA_ACCESS_DEFINE(access, struct net_ipv4_hdr);
 		struct net_ipv4_hdr *hdr;
 		struct net_if *iface_test;
-		uint16_t sum;
+		uint16_t ttl_proto;
 
 		net_pkt_cursor_backup(pkt, &hdr_start);
 
@@ -405,15 +405,12 @@ static enum net_verdict interface_recv(struct net_if *iface,
 		}
 
 		/* TTL fields is decremented, RFC2003 chapter 3.1 */
+		ttl_proto = UNALIGNED_GET((uint16_t *)&hdr->ttl);
 		hdr->ttl--;
 
-		/* Recalculate the checksum because TTL was changed */
-		hdr->chksum = 0U;
-
-		sum = calc_chksum(0, access.data, access.size);
-		sum = (sum == 0U) ? 0xffff : htons(sum);
-
-		hdr->chksum = ~sum;
+		/* Update the checksum because TTL was changed */
+		hdr->chksum = net_chksum_update_u16(hdr->chksum, ttl_proto,
+						    UNALIGNED_GET((uint16_t *)&hdr->ttl));
 
 		(void)net_pkt_set_data(pkt, &access);
 
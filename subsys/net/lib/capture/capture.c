@@ -84,6 +84,18 @@ struct net_capture {
 	 */
 	struct sockaddr local;
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	/**
+	 * Filter program, NULL if all the packets are captured.
+	 */
+	const struct net_capture_filter_insn *filter;
+
+	/**
+	 * Maximum captured length of a packet, 0 if there is no limit.
+	 */
+	size_t snaplen;
+#endif
+
 	/**
 	 * Is this context setup already
 	 */
@@ -510,10 +522,452 @@ static int capture_disable(const struct device *dev)
 	return 0;
 }
 
-int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+/* Classic BPF opcode fields */
+#define BPF_CLASS(code) ((code) & 0x07)
+#define BPF_SIZE(code)  ((code) & 0x18)
+#define BPF_MODE(code)  ((code) & 0xe0)
+#define BPF_OP(code)    ((code) & 0xf0)
+#define BPF_SRC(code)   ((code) & 0x08)
+#define BPF_RVAL(code)  ((code) & 0x18)
+#define BPF_MISCOP(code) ((code) & 0xf8)
+
+#define BPF_LD   0x00
+#define BPF_LDX  0x01
+#define BPF_ST   0x02
+#define BPF_STX  0x03
+#define BPF_ALU  0x04
+#define BPF_JMP  0x05
+#define BPF_RET  0x06
+#define BPF_MISC 0x07
+
+#define BPF_W 0x00
+#define BPF_H 0x08
+#define BPF_B 0x10
+
+#define BPF_IMM 0x00
+#define BPF_ABS 0x20
+#define BPF_IND 0x40
+#define BPF_MEM 0x60
+#define BPF_LEN 0x80
+#define BPF_MSH 0xa0
+
+#define BPF_ADD 0x00
+#define BPF_SUB 0x10
+#define BPF_MUL 0x20
+#define BPF_DIV 0x30
+#define BPF_OR  0x40
+#define BPF_AND 0x50
+#define BPF_LSH 0x60
+#define BPF_RSH 0x70
+#define BPF_NEG 0x80
+#define BPF_MOD 0x90
+#define BPF_XOR 0xa0
+
+#define BPF_JA   0x00
+#define BPF_JEQ  0x10
+#define BPF_JGT  0x20
+#define BPF_JGE  0x30
+#define BPF_JSET 0x40
+
+#define BPF_K 0x00
+#define BPF_X 0x08
+#define BPF_A 0x10
+
+#define BPF_TAX 0x00
+#define BPF_TXA 0x80
+
+#define BPF_MEMWORDS 16
+#define BPF_MAXINSNS 4096
+
+static bool filter_insn_is_valid(const struct net_capture_filter_insn *insn,
+				 size_t remaining)
+{
+	uint16_t code = insn->code;
+
+	switch (BPF_CLASS(code)) {
+	case BPF_LD:
+		switch (code) {
+		case BPF_LD | BPF_W | BPF_IMM:
+		case BPF_LD | BPF_W | BPF_LEN:
+		case BPF_LD | BPF_W | BPF_ABS:
+		case BPF_LD | BPF_H | BPF_ABS:
+		case BPF_LD | BPF_B | BPF_ABS:
+		case BPF_LD | BPF_W | BPF_IND:
+		case BPF_LD | BPF_H | BPF_IND:
+		case BPF_LD | BPF_B | BPF_IND:
+			return true;
+		case BPF_LD | BPF_W | BPF_MEM:
+			return insn->k < BPF_MEMWORDS;
+		default:
+			return false;
+		}
+	case BPF_LDX:
+		switch (code) {
+		case BPF_LDX | BPF_W | BPF_IMM:
+		case BPF_LDX | BPF_W | BPF_LEN:
+		case BPF_LDX | BPF_B | BPF_MSH:
+			return true;
+		case BPF_LDX | BPF_W | BPF_MEM:
+			return insn->k < BPF_MEMWORDS;
+		default:
+			return false;
+		}
+	case BPF_ST:
+	case BPF_STX:
+		return (code & ~0x07) == 0 && insn->k < BPF_MEMWORDS;
+	case BPF_ALU:
+		if ((code & 0xff00) != 0) {
+			return false;
+		}
+
+		switch (BPF_OP(code)) {
+		case BPF_NEG:
+			return BPF_SRC(code) == BPF_K;
+		case BPF_DIV:
+		case BPF_MOD:
+			return BPF_SRC(code) == BPF_X || insn->k != 0U;
+		case BPF_ADD:
+		case BPF_SUB:
+		case BPF_MUL:
+		case BPF_OR:
+		case BPF_AND:
+		case BPF_LSH:
+		case BPF_RSH:
+		case BPF_XOR:
+			return true;
+		default:
+			return false;
+		}
+	case BPF_JMP:
+		if ((code & 0xff00) != 0) {
+			return false;
+		}
+
+		/* Jumps are forward only, so the program always terminates */
+		if (BPF_OP(code) == BPF_JA) {
+			return BPF_SRC(code) == BPF_K && insn->k < remaining;
+		}
+
+		return BPF_OP(code) <= BPF_JSET && insn->jt < remaining && insn->jf < remaining;
+	case BPF_RET:
+		return (code & ~0x1f) == 0 && BPF_RVAL(code) != 0x18;
+	case BPF_MISC:
+		return code == (BPF_MISC | BPF_TAX) || code == (BPF_MISC | BPF_TXA);
+	}
+
+	return false;
+}
+
+static bool filter_is_valid(const struct net_capture_filter_insn *prog, size_t count)
+{
+	if (count == 0 || count > BPF_MAXINSNS) {
+		return false;
+	}
+
+	for (size_t pc = 0; pc < count; pc++) {
+		if (!filter_insn_is_valid(&prog[pc], count - pc - 1)) {
+			return false;
+		}
+	}
+
+	return BPF_CLASS(prog[count - 1].code) == BPF_RET;
+}
+
+static bool filter_load(struct net_pkt *pkt, size_t pkt_len, uint32_t offset,
+			uint8_t size, uint32_t *val)
+{
+	struct net_pkt_cursor backup;
+	uint8_t data[sizeof(uint32_t)];
+	int ret;
+
+	if (offset >= pkt_len || size > pkt_len - offset) {
+		return false;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+
+	ret = net_pkt_skip(pkt, offset);
+	if (ret == 0) {
+		ret = net_pkt_read(pkt, data, size);
+	}
+
+	net_pkt_cursor_restore(pkt, &backup);
+
+	if (ret < 0) {
+		return false;
+	}
+
+	if (size == sizeof(uint32_t)) {
+		*val = sys_get_be32(data);
+	} else if (size == sizeof(uint16_t)) {
+		*val = sys_get_be16(data);
+	} else {
+		*val = data[0];
+	}
+
+	return true;
+}
+
+/* Returns how many bytes of the packet to capture */
+static uint32_t filter_run(const struct net_capture_filter_insn *prog, struct net_pkt *pkt)
+{
+	static const uint8_t load_size[] = {
+		[BPF_W >> 3] = sizeof(uint32_t),
+		[BPF_H >> 3] = sizeof(uint16_t),
+		[BPF_B >> 3] = sizeof(uint8_t),
+	};
+	size_t pkt_len = net_pkt_get_len(pkt);
+	uint32_t mem[BPF_MEMWORDS] = { 0 };
+	uint32_t a = 0U;
+	uint32_t x = 0U;
+	uint32_t src;
+
+	for (const struct net_capture_filter_insn *insn = prog; ; insn++) {
+		uint16_t code = insn->code;
+
+		switch (BPF_CLASS(code)) {
+		case BPF_LD:
+			switch (BPF_MODE(code)) {
+			case BPF_IMM:
+				a = insn->k;
+				break;
+			case BPF_LEN:
+				a = pkt_len;
+				break;
+			case BPF_MEM:
+				a = mem[insn->k];
+				break;
+			case BPF_ABS:
+				if (!filter_load(pkt, pkt_len, insn->k,
+						 load_size[BPF_SIZE(code) >> 3], &a)) {
+					return 0U;
+				}
+				break;
+			default: /* BPF_IND */
+				if (!filter_load(pkt, pkt_len, x + insn->k,
+						 load_size[BPF_SIZE(code) >> 3], &a)) {
+					return 0U;
+				}
+				break;
+			}
+			break;
+		case BPF_LDX:
+			switch (BPF_MODE(code)) {
+			case BPF_IMM:
+				x = insn->k;
+				break;
+			case BPF_LEN:
+				x = pkt_len;
+				break;
+			case BPF_MEM:
+				x = mem[insn->k];
+				break;
+			default: /* BPF_MSH */
+				if (!filter_load(pkt, pkt_len, insn->k, sizeof(uint8_t), &x)) {
+					return 0U;
+				}
+
+				x = (x & 0x0f) << 2;
+				break;
+			}
+			break;
+		case BPF_ST:
+			mem[insn->k] = a;
+			break;
+		case BPF_STX:
+			mem[insn->k] = x;
+			break;
+		case BPF_ALU:
+			src = BPF_SRC(code) == BPF_X ? x : insn->k;
+
+			switch (BPF_OP(code)) {
+			case BPF_ADD:
+				a += src;
+				break;
+			case BPF_SUB:
+				a -= src;
+				break;
+			case BPF_MUL:
+				a *= src;
+				break;
+			case BPF_DIV:
+				if (src == 0U) {
+					return 0U;
+				}
+				a /= src;
+				break;
+			case BPF_MOD:
+				if (src == 0U) {
+					return 0U;
+				}
+				a %= src;
+				break;
+			case BPF_OR:
+				a |= src;
+				break;
+			case BPF_AND:
+				a &= src;
+				break;
+			case BPF_LSH:
+				a = src < 32U ? a << src : 0U;
+				break;
+			case BPF_RSH:
+				a = src < 32U ? a >> src : 0U;
+				break;
+			case BPF_XOR:
+				a ^= src;
+				break;
+			default: /* BPF_NEG */
+				a = -a;
+				break;
+			}
+			break;
+		case BPF_JMP:
+			src = BPF_SRC(code) == BPF_X ? x : insn->k;
+
+			switch (BPF_OP(code)) {
+			case BPF_JA:
+				insn += insn->k;
+				break;
+			case BPF_JEQ:
+				insn += (a == src) ? insn->jt : insn->jf;
+				break;
+			case BPF_JGT:
+				insn += (a > src) ? insn->jt : insn->jf;
+				break;
+			case BPF_JGE:
+				insn += (a >= src) ? insn->jt : insn->jf;
+				break;
+			default: /* BPF_JSET */
+				insn += (a & src) ? insn->jt : insn->jf;
+				break;
+			}
+			break;
+		case BPF_RET:
+			switch (BPF_RVAL(code)) {
+			case BPF_K:
+				return insn->k;
+			case BPF_X:
+				return x;
+			default: /* BPF_A */
+				return a;
+			}
+		default: /* BPF_MISC */
+			if (code == (BPF_MISC | BPF_TAX)) {
+				x = a;
+			} else {
+				a = x;
+			}
+			break;
+		}
+	}
+}
+
+/* Copy the first len bytes of the packet to the capture pool */
+static struct net_pkt *capture_clone(struct net_pkt *pkt, size_t len)
+{
+	bool overwrite = net_pkt_is_being_overwritten(pkt);
+	struct net_pkt_cursor backup;
+	struct net_pkt *clone;
+	int ret;
+
+	clone = net_pkt_alloc_from_slab(get_net_pkt(), K_NO_WAIT);
+	if (clone == NULL) {
+		return NULL;
+	}
+
+	ret = net_pkt_alloc_buffer_raw(clone, len, K_NO_WAIT);
+	if (ret < 0) {
+		net_pkt_unref(clone);
+		return NULL;
+	}
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+
+	ret = net_pkt_copy(clone, pkt, len);
+
+	net_pkt_cursor_restore(pkt, &backup);
+	net_pkt_set_overwrite(pkt, overwrite);
+
+	if (ret < 0) {
+		net_pkt_unref(clone);
+		return NULL;
+	}
+
+	net_pkt_set_iface(clone, net_pkt_iface(pkt));
+	net_pkt_cursor_init(clone);
+
+	return clone;
+}
+
+static int capture_set_filter(const struct device *dev,
+			      const struct net_capture_filter_insn *prog,
+			      size_t count, size_t snaplen)
+{
+	struct net_capture *ctx = dev->data;
+
+	if (prog != NULL && !filter_is_valid(prog, count)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	ctx->filter = prog;
+	ctx->snaplen = snaplen;
+
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+
+/* Returns how many bytes of the packet to capture, 0 to not capture it */
+static size_t capture_len(struct net_capture *ctx, struct net_pkt *pkt)
+{
+	size_t len = net_pkt_get_len(pkt);
+
+	if (ctx->filter != NULL) {
+		len = MIN(len, filter_run(ctx->filter, pkt));
+	}
+
+	if (ctx->snaplen > 0) {
+		len = MIN(len, ctx->snaplen);
+	}
+
+	return len;
+}
+#endif /* CONFIG_NET_CAPTURE_FILTER */
+
+static struct net_pkt *capture_pkt_copy(struct net_pkt *pkt, size_t len)
 {
 	struct k_mem_slab *orig_slab;
 	struct net_pkt *captured;
+
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	if (len < net_pkt_get_len(pkt)) {
+		return capture_clone(pkt, len);
+	}
+#else
+	ARG_UNUSED(len);
+#endif
+
+	orig_slab = pkt->slab;
+	pkt->slab = get_net_pkt();
+
+	captured = net_pkt_clone(pkt, K_NO_WAIT);
+
+	pkt->slab = orig_slab;
+
+	return captured;
+}
+
+int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
+{
+	struct net_pkt *captured;
+	size_t len;
 	sys_snode_t *sn, *sns;
 	bool skip_clone = false;
 	int ret = -ENOENT;
@@ -547,13 +1001,17 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 		if (skip_clone) {
 			captured = pkt;
 		} else {
-			orig_slab = pkt->slab;
-			pkt->slab = get_net_pkt();
-
-			captured = net_pkt_clone(pkt, K_NO_WAIT);
-
-			pkt->slab = orig_slab;
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+			len = capture_len(ctx, pkt);
+			if (len == 0) {
+				ret = 0;
+				goto out;
+			}
+#else
+			len = net_pkt_get_len(pkt);
+#endif
 
+			captured = capture_pkt_copy(pkt, len);
 			if (captured == NULL) {
 				NET_DBG("Captured pkt %s", "dropped");
 				net_stats_update_processing_error(ctx->tunnel_iface);
@@ -721,6 +1179,9 @@ static const struct net_capture_interface_api capture_interface_api = {
 	.disable = capture_disable,
 	.is_enabled = capture_is_enabled,
 	.send = capture_send,
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	.set_filter = capture_set_filter,
+#endif
 };
 
 #define DEFINE_NET_CAPTURE_DEV_DATA(x, _)				\
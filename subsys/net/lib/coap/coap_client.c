@@ -32,6 +32,10 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 			   bool response_truncated);
 static struct coap_client_internal_request *get_request_with_mid(struct coap_client *client,
 								 uint16_t mid);
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+static void fail_block2_transfer(struct coap_client *client,
+				 struct coap_client_internal_request *internal_req, int error);
+#endif
 
 static int send_request(int sock, const void *buf, size_t len, int flags,
 			const struct sockaddr *dest_addr, socklen_t addrlen)
@@ -211,6 +215,11 @@ static int coap_client_init_request(struct coap_client *client,
 		internal_req->last_id = coap_next_id();
 		internal_req->request_tkl = COAP_TOKEN_MAX_LEN & 0xf;
 		memcpy(internal_req->request_token, token, internal_req->request_tkl);
+		/* The last byte of the token is the index of the request, responses are
+		 * matched to their request without a search.
+		 */
+		internal_req->request_token[internal_req->request_tkl - 1] =
+			internal_req - client->requests;
 	}
 
 	ret = coap_packet_init(&internal_req->request, client->send_buf, MAX_COAP_MSG_LEN,
@@ -272,6 +281,20 @@ static int coap_client_init_request(struct coap_client *client,
 		}
 	}
 
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	/* Ask for the size of the resource, to request the following blocks in parallel */
+	if (!block2 && req->confirmable && req->payload == NULL &&
+	    internal_req->request.delta <= COAP_OPTION_SIZE2 &&
+	    !coap_request_is_observe(&internal_req->request)) {
+		ret = coap_append_option_int(&internal_req->request, COAP_OPTION_SIZE2, 0);
+
+		if (ret < 0) {
+			LOG_ERR("Failed to append size2 option");
+			goto out;
+		}
+	}
+#endif
+
 	if (req->payload) {
 		uint16_t payload_len;
 		uint16_t offset;
@@ -539,6 +562,12 @@ static void coap_client_resend_handler(struct coap_client *client)
 			}
 
 			ret = resend_request(client, &client->requests[i]);
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+			if (ret < 0 && client->requests[i].parent != NULL) {
+				fail_block2_transfer(client, client->requests[i].parent, ret);
+				continue;
+			}
+#endif
 			if (ret < 0) {
 				report_callback_error(&client->requests[i], ret);
 				release_internal_request(&client->requests[i]);
@@ -725,26 +754,27 @@ static struct coap_client_internal_request *get_request_with_token(
 
 	uint8_t response_token[COAP_TOKEN_MAX_LEN];
 	uint8_t response_tkl;
+	struct coap_client_internal_request *internal_req;
 
 	response_tkl = coap_header_get_token(resp, response_token);
+	if (response_tkl == 0 ||
+	    response_token[response_tkl - 1] >= CONFIG_COAP_CLIENT_MAX_REQUESTS) {
+		return NULL;
+	}
 
-	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
-		if (client->requests[i].request_ongoing ||
-		    !exchange_lifetime_exceeded(&client->requests[i])) {
-			if (client->requests[i].request_tkl == 0) {
-				continue;
-			}
-			if (client->requests[i].request_tkl != response_tkl) {
-				continue;
-			}
-			if (memcmp(&client->requests[i].request_token, &response_token,
-			    response_tkl) == 0) {
-				return &client->requests[i];
-			}
-		}
+	/* The last byte of the token is the index of the request */
+	internal_req = &client->requests[response_token[response_tkl - 1]];
+
+	if (!internal_req->request_ongoing && exchange_lifetime_exceeded(internal_req)) {
+		return NULL;
 	}
 
-	return NULL;
+	if (internal_req->request_tkl != response_tkl ||
+	    memcmp(internal_req->request_token, response_token, response_tkl) != 0) {
+		return NULL;
+	}
+
+	return internal_req;
 }
 
 static struct coap_client_internal_request *get_request_with_mid(struct coap_client *client,
@@ -766,6 +796,230 @@ static bool find_echo_option(const struct coap_packet *response, struct coap_opt
 	return coap_find_options(response, COAP_OPTION_ECHO, option, 1);
 }
 
+static int request_next_block(struct coap_client *client,
+			      struct coap_client_internal_request *internal_req)
+{
+	int ret;
+
+	ret = coap_client_init_request(client, &internal_req->coap_request, internal_req, false);
+	if (ret < 0) {
+		LOG_ERR("Error creating a CoAP request");
+		return ret;
+	}
+
+	struct coap_transmission_parameters params = internal_req->pending.params;
+	ret = coap_pending_init(&internal_req->pending, &internal_req->request,
+				&client->address, &params);
+	if (ret < 0) {
+		LOG_ERR("Error creating pending");
+		return ret;
+	}
+	coap_pending_cycle(&internal_req->pending);
+
+	ret = send_request(client->fd, internal_req->request.data,
+			   internal_req->request.offset, 0, &client->address,
+			   client->socklen);
+	if (ret < 0) {
+		LOG_ERR("Error sending a CoAP request");
+		return ret;
+	}
+
+	return 0;
+}
+
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+/* The request slots of a Block2 transfer other than the transfer request itself, each fetch
+ * one block ahead. They have no callback, errors are reported on the transfer request.
+ */
+static bool block2_pipelined(const struct coap_client_internal_request *internal_req)
+{
+	return internal_req->coap_request.confirmable && !internal_req->is_observe &&
+	       internal_req->send_blk_ctx.total_size == 0 &&
+	       internal_req->recv_blk_ctx.total_size > 0;
+}
+
+static struct coap_client_internal_request *get_block_request(
+	struct coap_client *client, struct coap_client_internal_request *internal_req,
+	uint32_t block_num)
+{
+	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
+		if (client->requests[i].request_ongoing &&
+		    client->requests[i].parent == internal_req &&
+		    client->requests[i].block_num == block_num) {
+			return &client->requests[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void release_block_requests(struct coap_client *client,
+				   struct coap_client_internal_request *internal_req)
+{
+	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
+		if (client->requests[i].parent == internal_req) {
+			reset_internal_request(&client->requests[i]);
+		}
+	}
+}
+
+static void fail_block2_transfer(struct coap_client *client,
+				 struct coap_client_internal_request *internal_req, int error)
+{
+	report_callback_error(internal_req, error);
+	release_block_requests(client, internal_req);
+	release_internal_request(internal_req);
+}
+
+static int request_block(struct coap_client *client,
+			 struct coap_client_internal_request *internal_req,
+			 struct coap_client_internal_request *block_req, uint32_t block_num)
+{
+	size_t block_bytes = coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+	int ret;
+
+	reset_internal_request(block_req);
+	block_req->parent = internal_req;
+	block_req->block_num = block_num;
+	block_req->coap_request = internal_req->coap_request;
+	block_req->coap_request.cb = NULL;
+	block_req->recv_blk_ctx = internal_req->recv_blk_ctx;
+	block_req->recv_blk_ctx.current = block_num * block_bytes;
+
+	ret = coap_client_init_request(client, &block_req->coap_request, block_req, false);
+	if (ret < 0) {
+		LOG_ERR("Error creating a CoAP request");
+		goto fail;
+	}
+
+	ret = coap_pending_init(&block_req->pending, &block_req->request, &client->address,
+				&internal_req->pending.params);
+	if (ret < 0) {
+		LOG_ERR("Error creating pending");
+		goto fail;
+	}
+	coap_pending_cycle(&block_req->pending);
+	block_req->request_ongoing = true;
+
+	ret = send_request(client->fd, block_req->request.data, block_req->request.offset, 0,
+			   &client->address, client->socklen);
+	if (ret < 0) {
+		LOG_ERR("Error sending a CoAP request");
+		goto fail;
+	}
+
+	return 0;
+
+fail:
+	reset_internal_request(block_req);
+	return ret;
+}
+
+/* Give the blocks received ahead to the application in order, then request the next blocks
+ * up to the window size. Returns 0 once the last block is given, 1 while the transfer goes on.
+ */
+static int block2_advance(struct coap_client *client,
+			  struct coap_client_internal_request *internal_req)
+{
+	size_t block_bytes = coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+	uint32_t num_blocks = DIV_ROUND_UP(internal_req->recv_blk_ctx.total_size, block_bytes);
+	uint32_t next = internal_req->recv_blk_ctx.current / block_bytes;
+	struct coap_client_internal_request *block_req;
+	int ret;
+
+	while (next < num_blocks) {
+		bool last_block = next + 1 == num_blocks;
+
+		block_req = get_block_request(client, internal_req, next);
+		if (block_req == NULL || !block_req->block_received) {
+			break;
+		}
+
+		if (internal_req->coap_request.cb &&
+		    !atomic_set(&internal_req->in_callback, 1)) {
+			internal_req->coap_request.cb(COAP_RESPONSE_CODE_CONTENT,
+						      internal_req->offset, block_req->block_buf,
+						      block_req->block_len, last_block,
+						      internal_req->coap_request.user_data);
+			atomic_clear(&internal_req->in_callback);
+		}
+
+		internal_req->offset += block_req->block_len;
+		internal_req->recv_blk_ctx.current += block_req->block_len;
+		reset_internal_request(block_req);
+		next++;
+
+		if (last_block || !internal_req->request_ongoing) {
+			/* Done, or the user callback cancelled the request */
+			return 0;
+		}
+	}
+
+	if (next >= num_blocks) {
+		LOG_ERR("Block %u past the resource size", next);
+		return -EBADMSG;
+	}
+
+	/* The next block is not requested yet, request it from the transfer request */
+	if (block_req == NULL && internal_req->pending.timeout == 0) {
+		ret = request_next_block(client, internal_req);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	internal_req->next_block_num = MAX(internal_req->next_block_num, next + 1);
+
+	while (internal_req->next_block_num <
+	       MIN(num_blocks, next + CONFIG_COAP_CLIENT_BLOCK2_WINDOW)) {
+		block_req = get_free_request(client);
+		if (block_req == NULL) {
+			break;
+		}
+
+		ret = request_block(client, internal_req, block_req, internal_req->next_block_num);
+		if (ret < 0) {
+			return ret;
+		}
+
+		internal_req->next_block_num++;
+	}
+
+	return 1;
+}
+
+static int handle_block_response(struct coap_client *client,
+				 struct coap_client_internal_request *block_req,
+				 const struct coap_packet *response, const uint8_t *payload,
+				 uint16_t payload_len)
+{
+	struct coap_client_internal_request *internal_req = block_req->parent;
+	int block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+	int ret;
+
+	if (coap_header_get_code(response) != COAP_RESPONSE_CODE_CONTENT ||
+	    block_option < 0 || GET_BLOCK_NUM(block_option) != block_req->block_num) {
+		LOG_ERR("Unexpected response for block %u", block_req->block_num);
+		fail_block2_transfer(client, internal_req, -EBADMSG);
+		return -EBADMSG;
+	}
+
+	block_req->block_len = MIN(payload_len, sizeof(block_req->block_buf));
+	memcpy(block_req->block_buf, payload, block_req->block_len);
+	block_req->block_received = true;
+
+	ret = block2_advance(client, internal_req);
+	if (ret < 0) {
+		fail_block2_transfer(client, internal_req, ret);
+	} else if (ret == 0) {
+		release_block_requests(client, internal_req);
+		reset_internal_request(internal_req);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1 */
+
 static int handle_response(struct coap_client *client, const struct coap_packet *response,
 			   bool response_truncated)
 {
@@ -796,6 +1050,12 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 			LOG_WRN("No matching request for RESET");
 			return 0;
 		}
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+		if (internal_req->parent != NULL) {
+			fail_block2_transfer(client, internal_req->parent, -ECONNRESET);
+			return 0;
+		}
+#endif
 		report_callback_error(internal_req, -ECONNRESET);
 		release_internal_request(internal_req);
 		return 0;
@@ -901,6 +1161,12 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 		coap_pending_clear(&internal_req->pending);
 	}
 
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	if (internal_req->parent != NULL) {
+		return handle_block_response(client, internal_req, response, payload, payload_len);
+	}
+#endif
+
 	/* Check if block2 exists */
 	block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
 	if (block_option > 0 || response_truncated) {
@@ -963,34 +1229,31 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 
 	/* If this wasn't last block, send the next request */
 	if (blockwise_transfer && !last_block) {
-		ret = coap_client_init_request(client, &internal_req->coap_request, internal_req,
-					       false);
-
-		if (ret < 0) {
-			LOG_ERR("Error creating a CoAP request");
-			goto fail;
-		}
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+		if (!response_truncated && block2_pipelined(internal_req)) {
+			ret = block2_advance(client, internal_req);
+			if (ret > 0) {
+				return 1;
+			}
 
-		struct coap_transmission_parameters params = internal_req->pending.params;
-		ret = coap_pending_init(&internal_req->pending, &internal_req->request,
-					&client->address, &params);
-		if (ret < 0) {
-			LOG_ERR("Error creating pending");
 			goto fail;
 		}
-		coap_pending_cycle(&internal_req->pending);
-
-		ret = send_request(client->fd, internal_req->request.data,
-				   internal_req->request.offset, 0, &client->address,
-				   client->socklen);
+#endif
+		ret = request_next_block(client, internal_req);
 		if (ret < 0) {
-			LOG_ERR("Error sending a CoAP request");
 			goto fail;
 		} else {
 			return 1;
 		}
 	}
 fail:
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	if (internal_req->parent != NULL) {
+		fail_block2_transfer(client, internal_req->parent, ret);
+		return ret;
+	}
+	release_block_requests(client, internal_req);
+#endif
 	if (ret < 0) {
 		report_callback_error(internal_req, ret);
 	}
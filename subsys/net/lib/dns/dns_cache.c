@@ -6,47 +6,57 @@
 
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/sys/crc.h>
 #include "dns_cache.h"
 
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
 
-int dns_cache_flush(struct dns_cache *cache)
+static uint16_t dns_cache_hash(char const *query)
 {
-	k_mutex_lock(cache->lock, K_FOREVER);
-	for (size_t i = 0; i < cache->size; i++) {
-		cache->entries[i].in_use = false;
+	return crc16_ansi(query, strlen(query));
+}
+
+static int dns_cache_family(enum dns_query_type type, sa_family_t *family)
+{
+	if (type == DNS_QUERY_TYPE_A) {
+		*family = AF_INET;
+	} else if (type == DNS_QUERY_TYPE_AAAA) {
+		*family = AF_INET6;
+	} else {
+		return -EINVAL;
 	}
-	k_mutex_unlock(cache->lock);
 
 	return 0;
 }
 
-int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
-		  uint32_t ttl)
+static bool dns_cache_match(struct dns_cache_entry const *entry, char const *query, uint16_t hash,
+			    sa_family_t family)
+{
+	return entry->in_use && entry->hash == hash && entry->data.ai_family == family &&
+	       strcmp(entry->query, query) == 0;
+}
+
+/* Needs to be called when lock is already acquired */
+static void dns_cache_insert(struct dns_cache *cache, char const *query,
+			     struct dns_addrinfo const *addrinfo, uint32_t ttl, bool negative)
 {
 	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
+	uint16_t hash = dns_cache_hash(query);
 	size_t index_to_replace = 0;
 	bool found_empty = false;
 
-	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
-		return -EINVAL;
-	}
+	dns_cache_clean(cache);
 
-	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
-		NET_WARN("Query string to big to be processed %u >= "
-			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
-			 strlen(query));
-		return -EINVAL;
+	for (size_t i = 0; i < cache->size; i++) {
+		/* A new answer replaces the negative entry of the query */
+		if (cache->entries[i].negative &&
+		    dns_cache_match(&cache->entries[i], query, hash, addrinfo->ai_family)) {
+			cache->entries[i].in_use = false;
+		}
 	}
 
-	k_mutex_lock(cache->lock, K_FOREVER);
-
-	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
-
-	dns_cache_clean(cache);
-
 	for (size_t i = 0; i < cache->size; i++) {
 		if (!cache->entries[i].in_use) {
 			index_to_replace = i;
@@ -64,9 +74,115 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 	strncpy(cache->entries[index_to_replace].query, query,
 		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	cache->entries[index_to_replace].hash = hash;
 	cache->entries[index_to_replace].data = *addrinfo;
 	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	cache->entries[index_to_replace].prefetch = sys_timepoint_calc(
+		K_MSEC((uint64_t)ttl * MSEC_PER_SEC *
+		       (100 - CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT) / 100));
 	cache->entries[index_to_replace].in_use = true;
+	cache->entries[index_to_replace].negative = negative;
+	cache->entries[index_to_replace].prefetched = false;
+}
+
+int dns_cache_flush(struct dns_cache *cache)
+{
+	k_mutex_lock(cache->lock, K_FOREVER);
+	for (size_t i = 0; i < cache->size; i++) {
+		cache->entries[i].in_use = false;
+	}
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
+		  uint32_t ttl)
+{
+	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
+		return -EINVAL;
+	}
+
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		NET_WARN("Query string to big to be processed %u >= "
+			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
+			 strlen(query));
+		return -EINVAL;
+	}
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
+
+	dns_cache_insert(cache, query, addrinfo, ttl, false);
+
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl)
+{
+	struct dns_addrinfo addrinfo = {0};
+	sa_family_t family;
+
+	if (cache == NULL || query == NULL || ttl == 0) {
+		return -EINVAL;
+	}
+
+	if (dns_cache_family(type, &family) < 0) {
+		return -EINVAL;
+	}
+
+	addrinfo.ai_family = family;
+
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		NET_WARN("Query string to big to be processed %u >= "
+			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
+			 strlen(query));
+		return -EINVAL;
+	}
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	NET_DBG("Add negative \"%s\" with TTL %" PRIu32, query, ttl);
+
+	dns_cache_insert(cache, query, &addrinfo, ttl, true);
+
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_remove_type(struct dns_cache *cache, char const *query, enum dns_query_type type)
+{
+	sa_family_t family;
+	uint16_t hash;
+
+	if (dns_cache_family(type, &family) < 0) {
+		return -EINVAL;
+	}
+
+	NET_DBG("Remove entries of type %d with query \"%s\"", type, query);
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		NET_WARN("Query string to big to be processed %u >= "
+			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
+			 strlen(query));
+		return -EINVAL;
+	}
+
+	hash = dns_cache_hash(query);
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	dns_cache_clean(cache);
+
+	for (size_t i = 0; i < cache->size; i++) {
+		if (dns_cache_match(&cache->entries[i], query, hash, family)) {
+			cache->entries[i].in_use = false;
+		}
+	}
 
 	k_mutex_unlock(cache->lock);
 
@@ -75,6 +191,8 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 int dns_cache_remove(struct dns_cache *cache, char const *query)
 {
+	uint16_t hash;
+
 	NET_DBG("Remove all entries with query \"%s\"", query);
 	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
 		NET_WARN("Query string to big to be processed %u >= "
@@ -83,12 +201,15 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (cache->entries[i].in_use && strcmp(cache->entries[i].query, query) == 0) {
+		if (cache->entries[i].in_use && cache->entries[i].hash == hash &&
+		    strcmp(cache->entries[i].query, query) == 0) {
 			cache->entries[i].in_use = false;
 		}
 	}
@@ -102,17 +223,15 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len)
 {
 	size_t found = 0;
+	bool negative = false;
 	sa_family_t family;
+	uint16_t hash;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
 		return -EINVAL;
 	}
-	if (type == DNS_QUERY_TYPE_A) {
-		family = AF_INET;
-	} else if (type == DNS_QUERY_TYPE_AAAA) {
-		family = AF_INET6;
-	} else {
+	if (dns_cache_family(type, &family) < 0) {
 		return -EINVAL;
 	}
 	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
@@ -122,18 +241,18 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
-			continue;
-		}
-		if (strcmp(cache->entries[i].query, query) != 0) {
+		if (!dns_cache_match(&cache->entries[i], query, hash, family)) {
 			continue;
 		}
-		if (cache->entries[i].data.ai_family != family) {
+		if (cache->entries[i].negative) {
+			negative = true;
 			continue;
 		}
 		if (found >= addrinfo_array_len) {
@@ -152,12 +271,62 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -ENOSR;
 	}
 
+	if (found == 0 && negative) {
+		NET_DBG("\"%s\" does not exist", query);
+		return -ENODATA;
+	}
+
 	if (found == 0) {
 		NET_DBG("Could not find \"%s\"", query);
 	}
 	return found;
 }
 
+bool dns_cache_prefetch_due(struct dns_cache *cache, const char *query, enum dns_query_type type)
+{
+	bool due = false;
+	sa_family_t family;
+	uint16_t hash;
+
+	if (CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT == 0) {
+		return false;
+	}
+
+	if (cache == NULL || query == NULL || dns_cache_family(type, &family) < 0) {
+		return false;
+	}
+
+	hash = dns_cache_hash(query);
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	for (size_t i = 0; i < cache->size; i++) {
+		if (!dns_cache_match(&cache->entries[i], query, hash, family) ||
+		    cache->entries[i].negative || cache->entries[i].prefetched) {
+			continue;
+		}
+
+		if (sys_timepoint_expired(cache->entries[i].prefetch)) {
+			due = true;
+		}
+	}
+
+	/* Report the query once, until it has been resolved again */
+	for (size_t i = 0; due && i < cache->size; i++) {
+		if (dns_cache_match(&cache->entries[i], query, hash, family)) {
+			cache->entries[i].prefetched = true;
+		}
+	}
+
+	k_mutex_unlock(cache->lock);
+
+	if (due) {
+		NET_DBG("Prefetch \"%s\"", query);
+	}
+
+	return due;
+}
+
 /* Needs to be called when lock is already acquired */
 static void dns_cache_clean(struct dns_cache const *cache)
 {
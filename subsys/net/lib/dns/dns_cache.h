@@ -22,7 +22,14 @@ struct dns_cache_entry {
 	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
+	/* Hits after this point request a refresh of the entry */
+	k_timepoint_t prefetch;
+	/* Hash of the query, compared before the query itself */
+	uint16_t hash;
 	bool in_use;
+	/* The name does not exist, data only holds the address family */
+	bool negative;
+	bool prefetched;
 };
 
 struct dns_cache {
@@ -71,6 +78,34 @@ int dns_cache_flush(struct dns_cache *cache);
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl);
 
+/**
+ * @brief Adds a negative entry to the dns cache, recording that the queried
+ * name does not exist.
+ *
+ * Positive entries with the same query and type are added in its place when
+ * the name is resolved later.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which should be persisted in the cache.
+ * @param type Query type of the query, A or AAAA.
+ * @param ttl Time to live for the entry in seconds.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl);
+
+/**
+ * @brief Removes all entries with the given query and type
+ *
+ * @param cache Cache where the entries should be removed.
+ * @param query Query which should be searched for.
+ * @param type Query type of the entries, A or AAAA.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_remove_type(struct dns_cache *cache, char const *query, enum dns_query_type type);
+
 /**
  * @brief Removes all entries with the given query
  *
@@ -94,8 +129,25 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
  * @retval On error a negative value is returned.
  * -ENOSR means there was not enough space in the addrinfo array to accommodate all cache hits the
  * array will however be filled with valid data.
+ * -ENODATA means a negative entry was found, the queried name does not exist.
  */
 int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len);
 
+/**
+ * @brief Checks if the cached entries of a query are close to expiry and
+ * should be refreshed.
+ *
+ * An entry is due for a refresh in the last
+ * CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT percent of its TTL, and is
+ * reported only once.
+ *
+ * @param cache Cache where the entry should be searched.
+ * @param query Query which should be searched for.
+ * @param type Query type of the entries.
+ * @retval true if the query should be resolved again.
+ * @retval false otherwise.
+ */
+bool dns_cache_prefetch_due(struct dns_cache *cache, const char *query, enum dns_query_type type);
+
 #endif /* ZEPHYR_INCLUDE_NET_DNS_CACHE_H_ */
@@ -1231,6 +1231,13 @@ rr_qtype_aaaa:
 			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
 					      &ctx->queries[*query_idx]);
 #ifdef CONFIG_DNS_RESOLVER_CACHE
+			if (items == 0) {
+				/* The answer replaces the cached one */
+				(void)dns_cache_remove_type(&dns_cache,
+					ctx->queries[*query_idx].query,
+					ctx->queries[*query_idx].query_type);
+			}
+
 			dns_cache_add(&dns_cache,
 				ctx->queries[*query_idx].query, &info, ttl);
 #endif /* CONFIG_DNS_RESOLVER_CACHE */
@@ -1302,6 +1309,15 @@ rr_qtype_aaaa:
 	}
 
 	if (items == 0) {
+#ifdef CONFIG_DNS_RESOLVER_CACHE
+		if (CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL > 0 &&
+		    dns_header_rcode(dns_msg->msg) == DNS_HEADER_NAMEERROR) {
+			(void)dns_cache_add_negative(&dns_cache,
+				ctx->queries[*query_idx].query,
+				ctx->queries[*query_idx].query_type,
+				CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL);
+		}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
 		ret = DNS_EAI_NODATA;
 	} else {
 		ret = DNS_EAI_ALLDONE;
@@ -1647,6 +1663,43 @@ static void query_timeout(struct k_work *work)
 	k_mutex_unlock(&pending_query->ctx->lock);
 }
 
+#ifdef CONFIG_DNS_RESOLVER_CACHE
+/* One background refresh of a cached name at a time */
+static char prefetch_query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
+static atomic_t prefetch_busy;
+
+static void dns_cache_prefetch_cb(enum dns_resolve_status status,
+				  struct dns_addrinfo *info, void *user_data)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	/* The answers are added to the cache as they are received */
+	if (status != DNS_EAI_INPROGRESS) {
+		atomic_clear(&prefetch_busy);
+	}
+}
+
+static void dns_cache_prefetch(struct dns_resolve_context *ctx, const char *query,
+			       enum dns_query_type type, int32_t timeout)
+{
+	int ret;
+
+	if (!atomic_cas(&prefetch_busy, 0, 1)) {
+		return;
+	}
+
+	strncpy(prefetch_query, query, sizeof(prefetch_query) - 1);
+
+	ret = dns_resolve_name_internal(ctx, prefetch_query, type, NULL,
+					dns_cache_prefetch_cb, NULL, timeout, false);
+	if (ret < 0) {
+		NET_DBG("Cannot prefetch \"%s\" (%d)", query, ret);
+		atomic_clear(&prefetch_busy);
+	}
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 int dns_resolve_name_internal(struct dns_resolve_context *ctx,
 			      const char *query,
 			      enum dns_query_type type,
@@ -1742,6 +1795,15 @@ try_resolve:
 
 			cb(DNS_EAI_ALLDONE, NULL, user_data);
 
+			if (dns_cache_prefetch_due(&dns_cache, query, type)) {
+				dns_cache_prefetch(ctx, query, type, timeout);
+			}
+
+			return 0;
+		} else if (ret == -ENODATA) {
+			/* The name is known not to exist */
+			cb(DNS_EAI_NODATA, NULL, user_data);
+
 			return 0;
 		}
 	}
@@ -23,6 +23,7 @@ int handle_http_frame_settings(struct http_client_ctx *client);
 int handle_http_frame_priority(struct http_client_ctx *client);
 int handle_http_frame_continuation(struct http_client_ctx *client);
 int handle_http_frame_window_update(struct http_client_ctx *client);
+int handle_http2_pending_data(struct http_client_ctx *client);
 int handle_http_frame_header(struct http_client_ctx *client);
 int handle_http_frame_headers(struct http_client_ctx *client);
 int handle_http_frame_data(struct http_client_ctx *client);
@@ -31,6 +32,9 @@ int handle_http1_request(struct http_client_ctx *client);
 int handle_http1_to_http2_upgrade(struct http_client_ctx *client);
 int handle_http1_to_websocket_upgrade(struct http_client_ctx *client);
 void http_server_release_client(struct http_client_ctx *client);
+bool http_server_claim_resource(struct http_resource_detail_dynamic *detail,
+				struct http_client_ctx *client);
+void http_server_resource_index_build(void);
 
 int enter_http1_request(struct http_client_ctx *client);
 int enter_http2_request(struct http_client_ctx *client);
@@ -52,6 +56,8 @@ void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size);
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size,
 			  uint8_t supported_compression, enum http_compression *chosen_compression);
+void http_server_etag_store(struct http_client_ctx *client, const char *value, size_t len);
+bool http_server_etag_match(struct http_client_ctx *client, const char *etag);
 void http_client_timer_restart(struct http_client_ctx *client);
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status);
 bool http_response_is_provided(struct http_response_ctx *rsp);
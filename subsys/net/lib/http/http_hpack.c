@@ -465,7 +465,7 @@ static int hpack_integer_encode(uint8_t *buf, size_t buflen, int value,
 			return -ENOBUFS;
 		}
 
-		*buf = (uint8_t)((value % 128) + 128);
+		*buf++ = (uint8_t)((value % 128) + 128);
 		len++;
 		value /= 128;
 	}
@@ -596,8 +596,142 @@ static int hpack_encode_indexed(uint8_t *buf, size_t buflen, int index)
 				    HPACK_PREFIX_LEN_INDEXED);
 }
 
-int http_hpack_encode_header(uint8_t *buf, size_t buflen,
-			     struct http_hpack_header_buf *header)
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+static size_t hpack_entry_size(size_t name_len, size_t value_len)
+{
+	return name_len + value_len + HTTP_HPACK_ENTRY_OVERHEAD;
+}
+
+static int hpack_dynamic_find_index(struct http_hpack_encoder *encoder,
+				    struct http_hpack_header_buf *header,
+				    bool *name_only)
+{
+	size_t offset = encoder->data_len;
+	int candidate = -1;
+
+	/* Index HTTP_SERVER_HPACK_WWW_AUTHENTICATE + 1 is the newest entry. */
+	for (int i = encoder->count - 1; i >= 0; i--) {
+		const uint8_t *name;
+		int index = HTTP_SERVER_HPACK_WWW_AUTHENTICATE + encoder->count - i;
+
+		offset -= encoder->entries[i].name_len + encoder->entries[i].value_len;
+		name = &encoder->data[offset];
+
+		if (encoder->entries[i].name_len != header->name_len ||
+		    memcmp(name, header->name, header->name_len) != 0) {
+			continue;
+		}
+
+		if (encoder->entries[i].value_len == header->value_len &&
+		    memcmp(name + header->name_len, header->value, header->value_len) == 0) {
+			*name_only = false;
+			return index;
+		}
+
+		if (candidate < 0) {
+			candidate = index;
+		}
+	}
+
+	if (candidate > 0) {
+		*name_only = true;
+		return candidate;
+	}
+
+	return -ENOENT;
+}
+
+static void hpack_dynamic_evict(struct http_hpack_encoder *encoder, size_t max_size)
+{
+	size_t evicted_len = 0;
+	int evicted = 0;
+
+	while (encoder->size > max_size) {
+		size_t len = encoder->entries[evicted].name_len +
+			     encoder->entries[evicted].value_len;
+
+		encoder->size -= hpack_entry_size(encoder->entries[evicted].name_len,
+						  encoder->entries[evicted].value_len);
+		evicted_len += len;
+		evicted++;
+	}
+
+	if (evicted == 0) {
+		return;
+	}
+
+	encoder->count -= evicted;
+	encoder->data_len -= evicted_len;
+	memmove(encoder->data, &encoder->data[evicted_len], encoder->data_len);
+	memmove(encoder->entries, &encoder->entries[evicted],
+		encoder->count * sizeof(encoder->entries[0]));
+}
+
+static void hpack_dynamic_insert(struct http_hpack_encoder *encoder,
+				 struct http_hpack_header_buf *header)
+{
+	size_t size = hpack_entry_size(header->name_len, header->value_len);
+
+	hpack_dynamic_evict(encoder, encoder->max_size - size);
+
+	memcpy(&encoder->data[encoder->data_len], header->name, header->name_len);
+	encoder->data_len += header->name_len;
+	memcpy(&encoder->data[encoder->data_len], header->value, header->value_len);
+	encoder->data_len += header->value_len;
+
+	encoder->entries[encoder->count].name_len = header->name_len;
+	encoder->entries[encoder->count].value_len = header->value_len;
+	encoder->count++;
+	encoder->size += size;
+}
+
+static int hpack_encode_size_update(uint8_t *buf, size_t buflen, int max_size)
+{
+	return hpack_integer_encode(buf, buflen, max_size,
+				    HPACK_PREFIX_DYNAMIC_TABLE_SIZE_UPDATE,
+				    HPACK_PREFIX_LEN_DYNAMIC_TABLE_SIZE_UPDATE);
+}
+
+static int hpack_encode_literal_indexing(uint8_t *buf, size_t buflen, int index,
+					 struct http_hpack_header_buf *header)
+{
+	int ret, len = 0;
+
+	ret = hpack_integer_encode(buf, buflen, index,
+				   HPACK_PREFIX_LITERAL_INDEXING,
+				   HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	if (ret < 0) {
+		return ret;
+	}
+
+	buf += ret;
+	buflen -= ret;
+	len += ret;
+
+	if (index == 0) {
+		ret = hpack_string_encode(buf, buflen, HPACK_HEADER_NAME, header);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	ret = hpack_string_encode(buf, buflen, HPACK_HEADER_VALUE, header);
+	if (ret < 0) {
+		return ret;
+	}
+
+	len += ret;
+
+	return len;
+}
+#endif /* HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0 */
+
+static int hpack_encode_header(struct http_hpack_encoder *encoder, uint8_t *buf,
+			       size_t buflen, struct http_hpack_header_buf *header)
 {
 	int ret, len = 0;
 	bool name_only;
@@ -613,6 +747,37 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 	}
 
 	ret = http_hpack_find_index(header, &name_only);
+
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+	if (encoder != NULL && (ret < 0 || name_only)) {
+		int static_name = ret;
+		bool dynamic_name_only;
+
+		ret = hpack_dynamic_find_index(encoder, header, &dynamic_name_only);
+		if (ret > 0 && !dynamic_name_only) {
+			/* Indexed, from the dynamic table */
+			return hpack_encode_indexed(buf, buflen, ret);
+		}
+
+		if (hpack_entry_size(header->name_len, header->value_len) <= encoder->max_size) {
+			/* Literal with incremental indexing, prefer the static name */
+			len = hpack_encode_literal_indexing(buf, buflen,
+							    static_name > 0 ? static_name :
+							    MAX(ret, 0), header);
+			if (len > 0) {
+				hpack_dynamic_insert(encoder, header);
+			}
+
+			return len;
+		}
+
+		ret = static_name > 0 ? static_name : ret;
+		name_only = true;
+	}
+#else
+	ARG_UNUSED(encoder);
+#endif
+
 	if (ret < 0) {
 		/* All literal */
 		len = hpack_encode_literal(buf, buflen, header);
@@ -626,3 +791,89 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 
 	return len;
 }
+
+int http_hpack_encode_header(uint8_t *buf, size_t buflen,
+			     struct http_hpack_header_buf *header)
+{
+	return hpack_encode_header(NULL, buf, buflen, header);
+}
+
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+void http_hpack_encoder_init(struct http_hpack_encoder *encoder)
+{
+	encoder->count = 0;
+	encoder->data_len = 0;
+	encoder->size = 0;
+	/* Smaller than the default decoder table size of the peer (4096),
+	 * no size update is needed.
+	 */
+	encoder->max_size = HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE;
+	encoder->clear_pending = false;
+	encoder->size_update_pending = false;
+}
+
+void http_hpack_encoder_set_max_size(struct http_hpack_encoder *encoder, uint32_t max_size)
+{
+	max_size = MIN(max_size, HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE);
+	if (max_size == encoder->max_size) {
+		return;
+	}
+
+	hpack_dynamic_evict(encoder, max_size);
+	encoder->max_size = max_size;
+	encoder->size_update_pending = true;
+}
+
+void http_hpack_encoder_reset(struct http_hpack_encoder *encoder)
+{
+	/* The peer table may not match this one anymore, have the peer clear
+	 * it with a size update to 0, followed by one to the current size.
+	 */
+	hpack_dynamic_evict(encoder, 0);
+	encoder->clear_pending = true;
+	encoder->size_update_pending = true;
+}
+
+int http_hpack_encoder_encode_header(struct http_hpack_encoder *encoder, uint8_t *buf,
+				     size_t buflen, struct http_hpack_header_buf *header)
+{
+	int ret, len = 0;
+
+	if (encoder == NULL || buf == NULL) {
+		return -EINVAL;
+	}
+
+	/* Size updates must be at the beginning of a header block */
+	if (encoder->clear_pending) {
+		ret = hpack_encode_size_update(buf, buflen, 0);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	if (encoder->size_update_pending) {
+		ret = hpack_encode_size_update(buf, buflen, encoder->max_size);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	ret = hpack_encode_header(encoder, buf, buflen, header);
+	if (ret < 0) {
+		return ret;
+	}
+
+	encoder->clear_pending = false;
+	encoder->size_update_pending = false;
+
+	return len + ret;
+}
+#endif /* HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0 */
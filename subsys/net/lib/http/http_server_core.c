@@ -42,6 +42,15 @@ LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
 #define HTTP_SERVER_MAX_SERVICES CONFIG_HTTP_SERVER_NUM_SERVICES
 #define HTTP_SERVER_MAX_CLIENTS  CONFIG_HTTP_SERVER_MAX_CLIENTS
 #define HTTP_SERVER_SOCK_COUNT (1 + HTTP_SERVER_MAX_SERVICES + HTTP_SERVER_MAX_CLIENTS)
+#define HTTP_SERVER_WORKERS CONFIG_HTTP_SERVER_WORKERS
+
+#if HTTP_SERVER_WORKERS > 0
+#define HTTP_SERVER_CLIENTS_PER_WORKER DIV_ROUND_UP(HTTP_SERVER_MAX_CLIENTS, HTTP_SERVER_WORKERS)
+/* Client slots are interleaved between workers */
+#define HTTP_SERVER_CLIENT_SLOTS (HTTP_SERVER_WORKERS * HTTP_SERVER_CLIENTS_PER_WORKER)
+#else
+#define HTTP_SERVER_CLIENT_SLOTS HTTP_SERVER_MAX_CLIENTS
+#endif
 
 struct http_server_ctx {
 	int listen_fds; /* max value of 1 + MAX_SERVICES */
@@ -57,6 +66,34 @@ struct http_server_ctx {
 static struct http_server_ctx server_ctx;
 static K_SEM_DEFINE(server_start, 0, 1);
 static bool server_running;
+static ATOMIC_DEFINE(clients_used, HTTP_SERVER_MAX_CLIENTS);
+/* Protects the number of clients of the services and the listen socket events */
+static struct k_spinlock clients_lock;
+/* Protects the holders of the dynamic resources */
+static struct k_spinlock resource_lock;
+
+#if HTTP_SERVER_WORKERS > 0
+/* Worker thread handling the connections of some of the clients */
+struct http_server_worker {
+	/* First pollfd is eventfd that can be used to wake up or stop the
+	 * worker, then we have the sockets of the clients of the worker.
+	 */
+	struct zsock_pollfd fds[1 + HTTP_SERVER_CLIENTS_PER_WORKER];
+	/* Indexes of the clients dispatched to the worker, not polled yet */
+	struct k_msgq queue;
+	int queue_buf[HTTP_SERVER_CLIENTS_PER_WORKER];
+	struct k_sem start;
+	struct k_sem done;
+	bool running;
+	bool stop;
+	struct k_thread thread;
+};
+
+static struct http_server_worker workers[HTTP_SERVER_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, HTTP_SERVER_WORKERS,
+				   CONFIG_HTTP_SERVER_WORKER_STACK_SIZE);
+static atomic_t workers_failed;
+#endif /* HTTP_SERVER_WORKERS > 0 */
 
 #if defined(CONFIG_HTTP_SERVER_TLS_USE_ALPN)
 static const char *const alpn_list[] = {"h2", "http/1.1"};
@@ -64,6 +101,7 @@ static const char *const alpn_list[] = {"h2", "http/1.1"};
 
 static void close_client_connection(struct http_client_ctx *client);
 
+
 HTTP_SERVER_CONTENT_TYPE(html, "text/html")
 HTTP_SERVER_CONTENT_TYPE(css, "text/css")
 HTTP_SERVER_CONTENT_TYPE(js, "text/javascript")
@@ -89,10 +127,18 @@ int http_server_init(struct http_server_ctx *ctx)
 
 	HTTP_SERVICE_COUNT(&svc_count);
 
+#if CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0
+	http_server_resource_index_build();
+#endif
+
 	/* Initialize fds */
 	memset(ctx->fds, 0, sizeof(ctx->fds));
 	memset(ctx->clients, 0, sizeof(ctx->clients));
 
+	for (i = 0; i < HTTP_SERVER_MAX_CLIENTS; i++) {
+		atomic_clear_bit(clients_used, i);
+	}
+
 	for (i = 0; i < ARRAY_SIZE(ctx->fds); i++) {
 		ctx->fds[i].fd = INVALID_SOCK;
 	}
@@ -279,8 +325,17 @@ static int accept_new_client(int server_fd)
 	return new_socket;
 }
 
+#if HTTP_SERVER_WORKERS > 0
+static void workers_stop(void);
+#endif
+
 static void close_all_sockets(struct http_server_ctx *ctx)
 {
+#if HTTP_SERVER_WORKERS > 0
+	/* The workers close the connections of their clients */
+	workers_stop();
+#endif
+
 	zsock_close(ctx->fds[0].fd); /* close eventfd */
 	ctx->fds[0].fd = -1;
 
@@ -345,33 +400,94 @@ static void client_release_resources(struct http_client_ctx *client)
 	}
 }
 
+static struct zsock_pollfd *client_pollfd(struct http_client_ctx *client)
+{
+	int idx = ARRAY_INDEX(server_ctx.clients, client);
+
+#if HTTP_SERVER_WORKERS > 0
+	return &workers[idx / HTTP_SERVER_CLIENTS_PER_WORKER]
+			.fds[1 + idx % HTTP_SERVER_CLIENTS_PER_WORKER];
+#else
+	return &server_ctx.fds[server_ctx.listen_fds + idx];
+#endif
+}
+
+static struct http_client_ctx *client_slot_alloc(void)
+{
+	int idx;
+
+	for (int i = 0; i < HTTP_SERVER_CLIENT_SLOTS; i++) {
+#if HTTP_SERVER_WORKERS > 0
+		/* Spread the clients between the workers */
+		idx = (i % HTTP_SERVER_WORKERS) * HTTP_SERVER_CLIENTS_PER_WORKER +
+		      i / HTTP_SERVER_WORKERS;
+		if (idx >= HTTP_SERVER_MAX_CLIENTS) {
+			continue;
+		}
+#else
+		idx = i;
+#endif
+
+		if (!atomic_test_and_set_bit(clients_used, idx)) {
+			return &server_ctx.clients[idx];
+		}
+	}
+
+	return NULL;
+}
+
 void http_server_release_client(struct http_client_ctx *client)
 {
 	int i;
 	struct k_work_sync sync;
+	k_spinlock_key_t key;
+	bool wake_server = false;
 
 	__ASSERT_NO_MSG(IS_ARRAY_ELEMENT(server_ctx.clients, client));
 
 	k_work_cancel_delayable_sync(&client->inactivity_timer, &sync);
 	client_release_resources(client);
 
+	key = k_spin_lock(&clients_lock);
+
 	client->service->data->num_clients--;
 
 	for (i = 0; i < server_ctx.listen_fds; i++) {
 		if (server_ctx.fds[i].fd == *client->service->fd) {
+			wake_server = server_ctx.fds[i].events == 0;
 			server_ctx.fds[i].events = ZSOCK_POLLIN;
 			break;
 		}
 	}
-	for (i = server_ctx.listen_fds; i < ARRAY_SIZE(server_ctx.fds); i++) {
-		if (server_ctx.fds[i].fd == client->fd) {
-			server_ctx.fds[i].fd = INVALID_SOCK;
-			break;
-		}
+
+	k_spin_unlock(&clients_lock, key);
+
+	if (HTTP_SERVER_WORKERS > 0 && wake_server) {
+		/* Have the server thread accept clients of the service again */
+		eventfd_write(server_ctx.fds[0].fd, 1);
 	}
 
+	client_pollfd(client)->fd = INVALID_SOCK;
+
 	memset(client, 0, sizeof(struct http_client_ctx));
 	client->fd = INVALID_SOCK;
+
+	atomic_clear_bit(clients_used, ARRAY_INDEX(server_ctx.clients, client));
+}
+
+bool http_server_claim_resource(struct http_resource_detail_dynamic *detail,
+				struct http_client_ctx *client)
+{
+	k_spinlock_key_t key = k_spin_lock(&resource_lock);
+	bool claimed = detail->holder == NULL || detail->holder == client;
+
+	if (claimed) {
+		detail->holder = client;
+	}
+
+	k_spin_unlock(&resource_lock, key);
+
+	return claimed;
 }
 
 static void close_client_connection(struct http_client_ctx *client)
@@ -426,6 +542,16 @@ static void init_client_ctx(struct http_client_ctx *client, const struct http_se
 	client->preface_sent = false;
 	client->window_size = HTTP_SERVER_INITIAL_WINDOW_SIZE;
 
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+	http_hpack_encoder_init(&client->hpack_encoder);
+#endif
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	client->send_window = HTTP_SERVER_DEFAULT_SEND_WINDOW_SIZE;
+	client->initial_send_window = HTTP_SERVER_DEFAULT_SEND_WINDOW_SIZE;
+	client->next_stream = 0;
+#endif
+
 	memset(client->buffer, 0, sizeof(client->buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
 	k_work_init_delayable(&client->inactivity_timer, client_timeout);
@@ -544,21 +670,293 @@ static int handle_http_request(struct http_client_ctx *client)
 	return 0;
 }
 
+static void client_send_pending_data(struct http_client_ctx *client)
+{
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	int ret;
+
+	ret = handle_http2_pending_data(client);
+	if (ret < 0) {
+		LOG_DBG("Cannot send pending data (%d)", ret);
+		close_client_connection(client);
+		return;
+	}
+
+	/* Wait for the socket to be writable only while data can be sent */
+	client_pollfd(client)->events = ZSOCK_POLLIN | (ret > 0 ? ZSOCK_POLLOUT : 0);
+#else
+	ARG_UNUSED(client);
+#endif
+}
+
+static void handle_client_events(struct http_client_ctx *client, short revents)
+{
+	int idx = ARRAY_INDEX(server_ctx.clients, client);
+	int ret;
+	int sock_error;
+	socklen_t optlen = sizeof(int);
+
+	if (revents & ZSOCK_POLLHUP) {
+		LOG_DBG("Client #%d has disconnected", idx);
+		close_client_connection(client);
+		return;
+	}
+
+	if (revents & ZSOCK_POLLERR) {
+		(void)zsock_getsockopt(client->fd, SOL_SOCKET, SO_ERROR, &sock_error, &optlen);
+		LOG_DBG("Error on fd %d %d", client->fd, sock_error);
+		close_client_connection(client);
+		return;
+	}
+
+	if (!(revents & ZSOCK_POLLIN)) {
+		if (revents & ZSOCK_POLLOUT) {
+			client_send_pending_data(client);
+		}
+
+		return;
+	}
+
+	ret = zsock_recv(client->fd, client->buffer + client->data_len,
+			 sizeof(client->buffer) - client->data_len, 0);
+	if (ret <= 0) {
+		if (ret == 0) {
+			LOG_DBG("Connection closed by peer for client #%d", idx);
+		} else {
+			ret = -errno;
+			LOG_DBG("ERROR reading from socket (%d)", ret);
+		}
+
+		close_client_connection(client);
+		return;
+	}
+
+	client->data_len += ret;
+
+	http_client_timer_restart(client);
+
+	ret = handle_http_request(client);
+	if (ret < 0 && ret != -EAGAIN) {
+		if (ret == -ENOTCONN) {
+			LOG_DBG("Client closed connection while handling request");
+		} else {
+			LOG_ERR("HTTP request handling error (%d)", ret);
+		}
+		close_client_connection(client);
+	} else if (client->data_len == sizeof(client->buffer)) {
+		/* If the RX buffer is still full after parsing,
+		 * it means we won't be able to handle this request
+		 * with the current buffer size.
+		 */
+		LOG_ERR("RX buffer too small to handle request");
+		close_client_connection(client);
+	} else {
+		client_send_pending_data(client);
+	}
+}
+
+#if HTTP_SERVER_WORKERS > 0
+static struct http_server_worker *client_worker(struct http_client_ctx *client)
+{
+	return &workers[ARRAY_INDEX(server_ctx.clients, client) / HTTP_SERVER_CLIENTS_PER_WORKER];
+}
+
+/* Start polling the sockets of the clients dispatched to the worker */
+static void worker_add_clients(struct http_server_worker *worker)
+{
+	struct http_client_ctx *client;
+	struct zsock_pollfd *pfd;
+	int idx;
+
+	while (k_msgq_get(&worker->queue, &idx, K_NO_WAIT) == 0) {
+		client = &server_ctx.clients[idx];
+		pfd = client_pollfd(client);
+
+		pfd->events = ZSOCK_POLLIN;
+		pfd->revents = 0;
+		pfd->fd = client->fd;
+	}
+}
+
+static int worker_run(struct http_server_worker *worker)
+{
+	int first = (worker - workers) * HTTP_SERVER_CLIENTS_PER_WORKER;
+	eventfd_t value;
+	int ret, i;
+
+	while (1) {
+		ret = zsock_poll(worker->fds, ARRAY_SIZE(worker->fds), -1);
+		if (ret < 0) {
+			ret = -errno;
+			LOG_DBG("poll failed (%d)", ret);
+			goto closing;
+		}
+
+		if (worker->fds[0].revents) {
+			eventfd_read(worker->fds[0].fd, &value);
+			worker_add_clients(worker);
+
+			if (worker->stop) {
+				ret = 0;
+				goto closing;
+			}
+		}
+
+		for (i = 1; i < ARRAY_SIZE(worker->fds); i++) {
+			if (worker->fds[i].fd < 0) {
+				continue;
+			}
+
+			handle_client_events(&server_ctx.clients[first + i - 1],
+					     worker->fds[i].revents);
+		}
+	}
+
+closing:
+	for (i = 1; i < ARRAY_SIZE(worker->fds); i++) {
+		if (worker->fds[i].fd >= 0) {
+			close_client_connection(&server_ctx.clients[first + i - 1]);
+		}
+	}
+
+	zsock_close(worker->fds[0].fd); /* close eventfd */
+	worker->fds[0].fd = INVALID_SOCK;
+
+	return ret;
+}
+
+static void http_server_worker_thread(void *p1, void *p2, void *p3)
+{
+	struct http_server_worker *worker = p1;
+	int ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&worker->start, K_FOREVER);
+
+		ret = worker_run(worker);
+		if (ret < 0) {
+			/* Have the server thread restart the server */
+			atomic_set(&workers_failed, 1);
+			eventfd_write(server_ctx.fds[0].fd, 1);
+		}
+
+		k_sem_give(&worker->done);
+	}
+}
+
+static int workers_start(void)
+{
+	struct http_server_worker *worker;
+	int fd;
+
+	atomic_clear(&workers_failed);
+
+	ARRAY_FOR_EACH_PTR(workers, worker) {
+		/* Create an eventfd that can be used to wake up the worker */
+		fd = eventfd(0, 0);
+		if (fd < 0) {
+			fd = -errno;
+			LOG_ERR("eventfd failed (%d)", fd);
+			return fd;
+		}
+
+		ARRAY_FOR_EACH(worker->fds, i) {
+			worker->fds[i].fd = INVALID_SOCK;
+		}
+
+		worker->fds[0].fd = fd;
+		worker->fds[0].events = ZSOCK_POLLIN;
+		k_msgq_purge(&worker->queue);
+		worker->stop = false;
+		worker->running = true;
+		k_sem_give(&worker->start);
+	}
+
+	return 0;
+}
+
+static void workers_stop(void)
+{
+	struct http_server_worker *worker;
+
+	ARRAY_FOR_EACH_PTR(workers, worker) {
+		if (!worker->running) {
+			continue;
+		}
+
+		worker->stop = true;
+		eventfd_write(worker->fds[0].fd, 1);
+		k_sem_take(&worker->done, K_FOREVER);
+		worker->running = false;
+	}
+}
+
+static void workers_init(void)
+{
+	struct http_server_worker *worker;
+	int i = 0;
+
+	ARRAY_FOR_EACH_PTR(workers, worker) {
+		k_msgq_init(&worker->queue, (char *)worker->queue_buf, sizeof(int),
+			    ARRAY_SIZE(worker->queue_buf));
+		k_sem_init(&worker->start, 0, 1);
+		k_sem_init(&worker->done, 0, 1);
+
+		k_thread_create(&worker->thread, worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+				http_server_worker_thread, worker, NULL, NULL,
+				THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&worker->thread, "http_server_worker");
+		i++;
+	}
+}
+#endif /* HTTP_SERVER_WORKERS > 0 */
+
+/* Start polling the socket of a newly accepted client */
+static void client_dispatch(struct http_client_ctx *client)
+{
+#if HTTP_SERVER_WORKERS > 0
+	struct http_server_worker *worker = client_worker(client);
+	int idx = ARRAY_INDEX(server_ctx.clients, client);
+
+	(void)k_msgq_put(&worker->queue, &idx, K_NO_WAIT);
+	eventfd_write(worker->fds[0].fd, 1);
+#else
+	struct zsock_pollfd *pfd = client_pollfd(client);
+
+	pfd->fd = client->fd;
+	pfd->events = ZSOCK_POLLIN;
+	pfd->revents = 0;
+#endif
+}
+
 static int http_server_run(struct http_server_ctx *ctx)
 {
 	struct http_client_ctx *client;
 	const struct http_service_desc *service;
+	k_spinlock_key_t key;
 	eventfd_t value;
-	bool found_slot;
 	int new_socket;
-	int ret, i, j;
+	int ret, i;
 	int sock_error;
 	socklen_t optlen = sizeof(int);
+	/* With workers the server thread only polls the listen sockets */
+	int nfds = HTTP_SERVER_WORKERS > 0 ? ctx->listen_fds : HTTP_SERVER_SOCK_COUNT;
 
 	value = 0;
 
+#if HTTP_SERVER_WORKERS > 0
+	ret = workers_start();
+	if (ret < 0) {
+		goto closing;
+	}
+#endif
+
 	while (1) {
-		ret = zsock_poll(ctx->fds, HTTP_SERVER_SOCK_COUNT, -1);
+		ret = zsock_poll(ctx->fds, nfds, -1);
 		if (ret < 0) {
 			ret = -errno;
 			LOG_DBG("poll failed (%d)", ret);
@@ -572,25 +970,36 @@ static int http_server_run(struct http_server_ctx *ctx)
 
 		if (ret == 1 && ctx->fds[0].revents) {
 			eventfd_read(ctx->fds[0].fd, &value);
+#if HTTP_SERVER_WORKERS > 0
+			if (atomic_get(&workers_failed)) {
+				LOG_ERR("Worker failure, aborting.");
+				ret = -EIO;
+				goto closing;
+			}
+
+			if (server_running) {
+				/* Woken up by a worker releasing a client */
+				continue;
+			}
+#endif
 			LOG_DBG("Received stop event. exiting ..");
 			ret = 0;
 			goto closing;
 		}
 
-		for (i = 1; i < ARRAY_SIZE(ctx->fds); i++) {
+		for (i = 1; i < nfds; i++) {
 			if (ctx->fds[i].fd < 0) {
 				continue;
 			}
 
-			if (ctx->fds[i].revents & ZSOCK_POLLHUP) {
-				if (i >= ctx->listen_fds) {
-					LOG_DBG("Client #%d has disconnected",
-						i - ctx->listen_fds);
-
-					client = &ctx->clients[i - ctx->listen_fds];
-					close_client_connection(client);
-				}
+			if (i >= ctx->listen_fds) {
+				/* Client sock */
+				handle_client_events(&ctx->clients[i - ctx->listen_fds],
+						     ctx->fds[i].revents);
+				continue;
+			}
 
+			if (ctx->fds[i].revents & ZSOCK_POLLHUP) {
 				continue;
 			}
 
@@ -599,12 +1008,6 @@ static int http_server_run(struct http_server_ctx *ctx)
 						       SO_ERROR, &sock_error, &optlen);
 				LOG_DBG("Error on fd %d %d", ctx->fds[i].fd, sock_error);
 
-				if (i >= ctx->listen_fds) {
-					client = &ctx->clients[i - ctx->listen_fds];
-					close_client_connection(client);
-					continue;
-				}
-
 				/* Listening socket error, abort. */
 				LOG_ERR("Listening socket error, aborting.");
 				ret = -sock_error;
@@ -616,90 +1019,42 @@ static int http_server_run(struct http_server_ctx *ctx)
 				continue;
 			}
 
-			/* First check if we have something to accept */
-			if (i < ctx->listen_fds) {
-				service = lookup_service(ctx->fds[i].fd);
-				__ASSERT(NULL != service, "fd not associated with a service");
-
-				if (service->data->num_clients >= service->concurrent) {
-					ctx->fds[i].events = 0;
-					continue;
-				}
-
-				new_socket = accept_new_client(ctx->fds[i].fd);
-				if (new_socket < 0) {
-					ret = -errno;
-					LOG_DBG("accept: %d", ret);
-					continue;
-				}
+			/* Something to accept */
+			service = lookup_service(ctx->fds[i].fd);
+			__ASSERT(NULL != service, "fd not associated with a service");
 
-				found_slot = false;
+			key = k_spin_lock(&clients_lock);
 
-				for (j = ctx->listen_fds; j < ARRAY_SIZE(ctx->fds); j++) {
-					if (ctx->fds[j].fd != INVALID_SOCK) {
-						continue;
-					}
-
-					ctx->fds[j].fd = new_socket;
-					ctx->fds[j].events = ZSOCK_POLLIN;
-					ctx->fds[j].revents = 0;
-
-					service->data->num_clients++;
-
-					LOG_DBG("Init client #%d", j - ctx->listen_fds);
-
-					init_client_ctx(&ctx->clients[j - ctx->listen_fds], service,
-							new_socket);
-					found_slot = true;
-					break;
-				}
+			if (service->data->num_clients >= service->concurrent) {
+				ctx->fds[i].events = 0;
+				k_spin_unlock(&clients_lock, key);
+				continue;
+			}
 
-				if (!found_slot) {
-					LOG_DBG("No free slot found.");
-					zsock_close(new_socket);
-				}
+			k_spin_unlock(&clients_lock, key);
 
+			new_socket = accept_new_client(ctx->fds[i].fd);
+			if (new_socket < 0) {
+				ret = -errno;
+				LOG_DBG("accept: %d", ret);
 				continue;
 			}
 
-			/* Client sock */
-			client = &ctx->clients[i - ctx->listen_fds];
-
-			ret = zsock_recv(client->fd, client->buffer + client->data_len,
-					 sizeof(client->buffer) - client->data_len, 0);
-			if (ret <= 0) {
-				if (ret == 0) {
-					LOG_DBG("Connection closed by peer for client #%d",
-						i - ctx->listen_fds);
-				} else {
-					ret = -errno;
-					LOG_DBG("ERROR reading from socket (%d)", ret);
-				}
-
-				close_client_connection(client);
+			client = client_slot_alloc();
+			if (client == NULL) {
+				LOG_DBG("No free slot found.");
+				zsock_close(new_socket);
 				continue;
 			}
 
-			client->data_len += ret;
-
-			http_client_timer_restart(client);
-
-			ret = handle_http_request(client);
-			if (ret < 0 && ret != -EAGAIN) {
-				if (ret == -ENOTCONN) {
-					LOG_DBG("Client closed connection while handling request");
-				} else {
-					LOG_ERR("HTTP request handling error (%d)", ret);
-				}
-				close_client_connection(client);
-			} else if (client->data_len == sizeof(client->buffer)) {
-				/* If the RX buffer is still full after parsing,
-				 * it means we won't be able to handle this request
-				 * with the current buffer size.
-				 */
-				LOG_ERR("RX buffer too small to handle request");
-				close_client_connection(client);
-			}
+			key = k_spin_lock(&clients_lock);
+			service->data->num_clients++;
+			k_spin_unlock(&clients_lock, key);
+
+			LOG_DBG("Init client #%d", ARRAY_INDEX(ctx->clients, client));
+
+			init_client_ctx(client, service, new_socket);
+			client_dispatch(client);
 		}
 	}
 
@@ -760,9 +1115,170 @@ static bool skip_this(struct http_resource_desc *resource, bool is_websocket)
 	return false;
 }
 
+#if CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0
+#define RESOURCE_INDEX_SIZE CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE
+
+/* Open addressing hash table of the resources of all services, by path */
+static struct http_resource_desc *resource_index[RESOURCE_INDEX_SIZE];
+
+static uint32_t resource_hash(const struct http_service_desc *service, const char *path,
+			      size_t len)
+{
+	/* FNV-1a, seeded with the service */
+	uint32_t hash = 2166136261U ^ (uint32_t)(uintptr_t)service;
+
+	for (size_t i = 0; i < len; i++) {
+		hash ^= (uint8_t)path[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static bool resource_is_glob(const char *resource)
+{
+	return IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD) &&
+	       strpbrk(resource, "*?[\\") != NULL;
+}
+
+static bool resource_index_add(const struct http_service_desc *service,
+			       struct http_resource_desc *resource)
+{
+	size_t slot = resource_hash(service, resource->resource, strlen(resource->resource)) %
+		      RESOURCE_INDEX_SIZE;
+
+	for (size_t n = 0; n < RESOURCE_INDEX_SIZE; n++) {
+		if (resource_index[slot] == NULL) {
+			resource_index[slot] = resource;
+			return true;
+		}
+
+		slot = (slot + 1) % RESOURCE_INDEX_SIZE;
+	}
+
+	return false;
+}
+
+void http_server_resource_index_build(void)
+{
+	memset(resource_index, 0, sizeof(resource_index));
+
+	HTTP_SERVICE_FOREACH(service) {
+		service->data->indexed = true;
+		service->data->num_globs = 0;
+
+		HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
+			if (resource_is_glob(resource->resource)) {
+				service->data->num_globs++;
+				continue;
+			}
+
+			if (!resource_index_add(service, resource)) {
+				LOG_WRN("Resource index full, increase "
+					"CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE");
+				service->data->indexed = false;
+				break;
+			}
+		}
+	}
+}
+
+/* Return the first resource between best and the ones of the service that are exactly
+ * the len first characters of path.
+ */
+static struct http_resource_desc *resource_index_find(const struct http_service_desc *service,
+						      const char *path, size_t len,
+						      bool is_websocket,
+						      struct http_resource_desc *best)
+{
+	size_t slot = resource_hash(service, path, len) % RESOURCE_INDEX_SIZE;
+	struct http_resource_desc *resource;
+
+	for (size_t n = 0; n < RESOURCE_INDEX_SIZE && resource_index[slot] != NULL; n++) {
+		resource = resource_index[slot];
+		slot = (slot + 1) % RESOURCE_INDEX_SIZE;
+
+		if (resource < service->res_begin || resource >= service->res_end ||
+		    (best != NULL && resource > best) || skip_this(resource, is_websocket)) {
+			continue;
+		}
+
+		if (strncmp(resource->resource, path, len) == 0 &&
+		    resource->resource[len] == '\0') {
+			best = resource;
+		}
+	}
+
+	return best;
+}
+
+/* Same result as matching the resources one by one, in their section order */
+static struct http_resource_desc *resource_index_lookup(const struct http_service_desc *service,
+							 const char *path, bool is_websocket)
+{
+	struct http_resource_desc *best;
+	size_t len;
+
+	best = resource_index_find(service, path, path_len_without_query(path), is_websocket,
+				   NULL);
+
+	if (!IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD)) {
+		return best;
+	}
+
+	/* fnmatch() with FNM_LEADING_DIR also matches the resources without wildcards
+	 * that are the full path or one of its leading directories.
+	 */
+	len = strlen(path);
+	best = resource_index_find(service, path, len, is_websocket, best);
+
+	for (size_t i = 0; i < len; i++) {
+		if (path[i] == '/') {
+			best = resource_index_find(service, path, i, is_websocket, best);
+		}
+	}
+
+	if (service->data->num_globs == 0) {
+		return best;
+	}
+
+	HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
+		if (best != NULL && resource >= best) {
+			break;
+		}
+
+		if (!resource_is_glob(resource->resource) || skip_this(resource, is_websocket)) {
+			continue;
+		}
+
+		if (fnmatch(resource->resource, path, (FNM_PATHNAME | FNM_LEADING_DIR)) == 0) {
+			return resource;
+		}
+	}
+
+	return best;
+}
+#endif /* CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0 */
+
 struct http_resource_detail *get_resource_detail(const struct http_service_desc *service,
 						 const char *path, int *path_len, bool is_websocket)
 {
+#if CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0
+	if (service->data->indexed) {
+		struct http_resource_desc *resource;
+
+		resource = resource_index_lookup(service, path, is_websocket);
+		if (resource != NULL) {
+			NET_DBG("Got match for %s", resource->resource);
+
+			*path_len = path_len_without_query(path);
+			return resource->detail;
+		}
+
+		goto fallback;
+	}
+#endif /* CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0 */
+
 	HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
 		if (skip_this(resource, is_websocket)) {
 			continue;
@@ -786,6 +1302,9 @@ struct http_resource_detail *get_resource_detail(const struct http_service_desc
 		}
 	}
 
+#if CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0
+fallback:
+#endif
 	if (service->res_fallback != NULL) {
 		*path_len = path_len_without_query(path);
 		return service->res_fallback;
@@ -857,6 +1376,71 @@ return_filename:
 	return ret;
 }
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+void http_server_etag_store(struct http_client_ctx *client, const char *value, size_t len)
+{
+	if (len >= sizeof(client->if_none_match)) {
+		/* Cannot be matched, the resource will be sent in full */
+		client->if_none_match[0] = '\0';
+		return;
+	}
+
+	memcpy(client->if_none_match, value, len);
+	client->if_none_match[len] = '\0';
+}
+
+static const char *etag_opaque(const char *etag)
+{
+	/* If-None-Match uses the weak comparison, ignore the weakness indicator */
+	return strncmp(etag, "W/", 2) == 0 ? etag + 2 : etag;
+}
+
+bool http_server_etag_match(struct http_client_ctx *client, const char *etag)
+{
+	const char *cursor = client->if_none_match;
+	const char *end;
+	size_t etag_len;
+
+	if (etag == NULL || cursor[0] == '\0') {
+		return false;
+	}
+
+	etag = etag_opaque(etag);
+	etag_len = strlen(etag);
+
+	/* The header value is either "*" or a comma separated list of tags */
+	while (*cursor != '\0') {
+		if (*cursor == ' ' || *cursor == '\t' || *cursor == ',') {
+			cursor++;
+			continue;
+		}
+
+		if (*cursor == '*') {
+			return true;
+		}
+
+		cursor = etag_opaque(cursor);
+		if (*cursor != '"') {
+			return false;
+		}
+
+		end = strchr(cursor + 1, '"');
+		if (end == NULL) {
+			return false;
+		}
+
+		end++;
+		if ((size_t)(end - cursor) == etag_len && strncmp(cursor, etag, etag_len) == 0) {
+			return true;
+		}
+
+		cursor = end;
+	}
+
+	return false;
+}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size)
 {
@@ -975,6 +1559,10 @@ static void http_server_thread(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
+#if HTTP_SERVER_WORKERS > 0
+	workers_init();
+#endif
+
 	while (true) {
 		k_sem_take(&server_start, K_FOREVER);
 
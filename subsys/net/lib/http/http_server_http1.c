@@ -72,6 +72,25 @@ static int send_http1_409(struct http_client_ctx *client)
 				       sizeof(conflict_response) - 1);
 }
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+static int send_http1_304(struct http_client_ctx *client, const char *etag)
+{
+#define HTTP_304_RESPONSE_TEMPLATE			\
+	"HTTP/1.1 304 Not Modified\r\n"		\
+	"ETag: %s\r\n\r\n"
+
+	char http_response[sizeof(HTTP_304_RESPONSE_TEMPLATE) +
+			   CONFIG_HTTP_SERVER_MAX_ETAG_LEN];
+	int len;
+
+	len = snprintk(http_response, sizeof(http_response),
+		       HTTP_304_RESPONSE_TEMPLATE, etag);
+
+	return send_http1_error_common(client, http_response,
+				       MIN(len, sizeof(http_response) - 1));
+}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
 static void send_http1_500(struct http_client_ctx *client, int error_code)
 {
 #define HTTP_500_RESPONSE_TEMPLATE			\
@@ -126,12 +145,22 @@ static int handle_http1_static_resource(
 	"%s%s\r\n"				\
 	"Content-Length: %d\r\n"
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+#define ETAG_HEADER_SIZE (sizeof("ETag: \r\n") + CONFIG_HTTP_SERVER_MAX_ETAG_LEN)
+#else
+#define ETAG_HEADER_SIZE 0
+#endif
+
 	/* Add couple of bytes to total response */
 	char http_response[sizeof(RESPONSE_TEMPLATE) +
 			   sizeof("Content-Encoding: 01234567890123456789\r\n") +
 			   sizeof("Content-Type: \r\n") + HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
+			   ETAG_HEADER_SIZE +
 			   sizeof("xxxx") +
 			   sizeof("\r\n")];
+	const char *etag_header = "";
+	const char *etag = "";
+	const char *etag_end = "";
 	const char *data;
 	int len;
 	int ret;
@@ -140,24 +169,37 @@ static int handle_http1_static_resource(
 		return send_http1_405(client);
 	}
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	if (static_detail->etag != NULL) {
+		if (http_server_etag_match(client, static_detail->etag)) {
+			return send_http1_304(client, static_detail->etag);
+		}
+
+		etag_header = "ETag: ";
+		etag = static_detail->etag;
+		etag_end = "\r\n";
+	}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
 	data = static_detail->static_data;
 	len = static_detail->static_data_len;
 
 	if (static_detail->common.content_encoding != NULL &&
 	    static_detail->common.content_encoding[0] != '\0') {
 		snprintk(http_response, sizeof(http_response),
-			 RESPONSE_TEMPLATE "Content-Encoding: %s\r\n\r\n",
+			 RESPONSE_TEMPLATE "%s%s%s" "Content-Encoding: %s\r\n\r\n",
 			 "Content-Type: ",
 			 static_detail->common.content_type == NULL ?
 			 "text/html" : static_detail->common.content_type,
-			 len, static_detail->common.content_encoding);
+			 len, etag_header, etag, etag_end,
+			 static_detail->common.content_encoding);
 	} else {
 		snprintk(http_response, sizeof(http_response),
-			 RESPONSE_TEMPLATE "\r\n",
+			 RESPONSE_TEMPLATE "%s%s%s" "\r\n",
 			 "Content-Type: ",
 			 static_detail->common.content_type == NULL ?
 			 "text/html" : static_detail->common.content_type,
-			 len);
+			 len, etag_header, etag, etag_end);
 	}
 
 	ret = http_server_sendall(client, http_response, strlen(http_response));
@@ -496,7 +538,7 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 	struct fs_file_t file;
 	char fname[HTTP_SERVER_MAX_URL_LENGTH];
 	char content_type[HTTP_SERVER_MAX_CONTENT_TYPE_LEN] = "text/html";
-	char http_response[STATIC_FS_RESPONSE_SIZE];
+	char http_response[MAX(STATIC_FS_RESPONSE_SIZE, CONFIG_HTTP_SERVER_STATIC_FS_CHUNK_SIZE)];
 
 	if (client->method != HTTP_GET) {
 		return send_http1_405(client);
@@ -595,7 +637,7 @@ static int handle_http1_dynamic_resource(
 		return send_http1_405(client);
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_claim_resource(dynamic_detail, client)) {
 		ret = send_http1_409(client);
 		if (ret < 0) {
 			return ret;
@@ -604,8 +646,6 @@ static int handle_http1_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_HEAD:
 		if (user_method & BIT(HTTP_HEAD)) {
@@ -724,6 +764,11 @@ static int on_header_field(struct http_parser *parser, const char *at,
 				ctx->accept_encoding_next = true;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+			else if (strcasecmp(ctx->header_buffer, "If-None-Match") == 0) {
+				ctx->if_none_match_next = true;
+			}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -816,6 +861,12 @@ static int on_header_value(struct http_parser *parser,
 				ctx->accept_encoding_next = false;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+			if (ctx->if_none_match_next) {
+				http_server_etag_store(ctx, ctx->header_buffer, offset);
+				ctx->if_none_match_next = false;
+			}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -903,6 +954,10 @@ int enter_http1_request(struct http_client_ctx *client)
 	memset(client->header_buffer, 0, sizeof(client->header_buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	client->if_none_match[0] = '\0';
+#endif
+
 	return 0;
 }
 
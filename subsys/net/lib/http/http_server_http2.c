@@ -87,6 +87,10 @@ static struct http2_stream_ctx *allocate_http_stream_context(
 				HTTP_SERVER_INITIAL_WINDOW_SIZE;
 			client->streams[i].headers_sent = false;
 			client->streams[i].end_stream_sent = false;
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+			client->streams[i].send_window = client->initial_send_window;
+			client->streams[i].pending_len = 0;
+#endif
 			return &client->streams[i];
 		}
 	}
@@ -102,11 +106,32 @@ static void release_http_stream_context(struct http_client_ctx *client,
 			client->streams[i].stream_id = 0;
 			client->streams[i].stream_state = HTTP2_STREAM_IDLE;
 			client->streams[i].current_detail = NULL;
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+			client->streams[i].pending_data = NULL;
+			client->streams[i].pending_len = 0;
+#endif
 			break;
 		}
 	}
 }
 
+/* Release a stream ended by the client, once its response is sent. */
+static void end_http_stream_context(struct http_client_ctx *client,
+				    uint32_t stream_id)
+{
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	struct http2_stream_ctx *stream = find_http_stream_context(client, stream_id);
+
+	if (stream != NULL && stream->pending_len > 0) {
+		/* Released by handle_http2_pending_data() */
+		stream->stream_state = HTTP2_STREAM_HALF_CLOSED_REMOTE;
+		return;
+	}
+#endif
+
+	release_http_stream_context(client, stream_id);
+}
+
 static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 			    size_t *buflen, const char *name, const char *value)
 {
@@ -117,7 +142,12 @@ static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 	client->header_field.value = value;
 	client->header_field.value_len = strlen(value);
 
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+	ret = http_hpack_encoder_encode_header(&client->hpack_encoder, *buf, *buflen,
+					       &client->header_field);
+#else
 	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field);
+#endif
 	if (ret < 0) {
 		LOG_DBG("Failed to encode header, err %d", ret);
 		return ret;
@@ -160,7 +190,7 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 
 	ret = add_header_field(client, &buf, &buflen, ":status", status_str);
 	if (ret < 0) {
-		return ret;
+		goto encode_error;
 	}
 
 	for (size_t i = 0; i < extra_headers_count; i++) {
@@ -176,7 +206,7 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 
 		ret = add_header_field(client, &buf, &buflen, hdr->name, hdr->value);
 		if (ret < 0) {
-			return ret;
+			goto encode_error;
 		}
 	}
 
@@ -184,7 +214,7 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 		ret = add_header_field(client, &buf, &buflen, "content-encoding",
 				       detail_common->content_encoding);
 		if (ret < 0) {
-			return ret;
+			goto encode_error;
 		}
 	}
 
@@ -192,7 +222,7 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 		ret = add_header_field(client, &buf, &buflen, "content-type",
 				       detail_common->content_type);
 		if (ret < 0) {
-			return ret;
+			goto encode_error;
 		}
 	}
 
@@ -212,6 +242,16 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 	client->current_stream->headers_sent = true;
 
 	return 0;
+
+encode_error:
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+	/* The header block is dropped, the insertions already made to the
+	 * dynamic table will never reach the peer.
+	 */
+	http_hpack_encoder_reset(&client->hpack_encoder);
+#endif
+
+	return ret;
 }
 
 static int send_data_frame(struct http_client_ctx *client, const char *payload,
@@ -220,6 +260,18 @@ static int send_data_frame(struct http_client_ctx *client, const char *payload,
 	uint8_t frame_header[HTTP2_FRAME_HEADER_SIZE];
 	int ret;
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	struct http2_stream_ctx *stream = find_http_stream_context(client, stream_id);
+
+	/* Responses that are not scheduled may exceed the windows, the
+	 * scheduled ones then wait for the client to grant more.
+	 */
+	client->send_window -= length;
+	if (stream != NULL) {
+		stream->send_window -= length;
+	}
+#endif
+
 	encode_frame_header(frame_header, length, HTTP2_DATA_FRAME,
 			    is_header_flag_set(flags, HTTP2_FLAG_END_STREAM) ?
 			    HTTP2_FLAG_END_STREAM : 0,
@@ -416,6 +468,13 @@ static int handle_http2_static_resource(
 {
 	const char *content_200;
 	size_t content_len;
+	const struct http_header *extra_headers = NULL;
+	size_t extra_headers_count = 0;
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	struct http_header etag_header = {
+		.name = "etag",
+	};
+#endif
 	int ret;
 
 	if (client->method != HTTP_GET) {
@@ -429,13 +488,45 @@ static int handle_http2_static_resource(
 	content_200 = static_detail->static_data;
 	content_len = static_detail->static_data_len;
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	if (static_detail->etag != NULL) {
+		etag_header.value = static_detail->etag;
+		extra_headers = &etag_header;
+		extra_headers_count = 1;
+
+		if (http_server_etag_match(client, static_detail->etag)) {
+			ret = send_headers_frame(client, HTTP_304_NOT_MODIFIED,
+						 frame->stream_identifier, NULL,
+						 HTTP2_FLAG_END_STREAM, extra_headers,
+						 extra_headers_count);
+			if (ret < 0) {
+				LOG_DBG("Cannot write to socket (%d)", ret);
+				goto out;
+			}
+
+			client->current_stream->end_stream_sent = true;
+			goto out;
+		}
+	}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
 	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier,
-				 &static_detail->common, 0, NULL, 0);
+				 &static_detail->common, 0, extra_headers,
+				 extra_headers_count);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		goto out;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	if (content_len > 0) {
+		/* Sent by handle_http2_pending_data(), in turn with the other streams */
+		client->current_stream->pending_data = content_200;
+		client->current_stream->pending_len = content_len;
+		goto out;
+	}
+#endif
+
 	ret = send_data_frame(client, content_200, content_len,
 			      frame->stream_identifier,
 			      HTTP2_FLAG_END_STREAM);
@@ -469,7 +560,7 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 	enum http_compression chosen_compression = 0;
 	int len;
 	int remaining;
-	char tmp[64];
+	char tmp[CONFIG_HTTP_SERVER_STATIC_FS_CHUNK_SIZE];
 
 	if (client->method != HTTP_GET) {
 		return send_http2_405(client, frame);
@@ -782,7 +873,7 @@ static int handle_http2_dynamic_resource(
 		return send_http2_405(client, frame);
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_claim_resource(dynamic_detail, client)) {
 		ret = send_http2_409(client, frame);
 		if (ret < 0) {
 			return ret;
@@ -791,8 +882,6 @@ static int handle_http2_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_GET:
 	case HTTP_DELETE:
@@ -926,6 +1015,10 @@ static int enter_http_frame_headers_state(struct http_client_ctx *client)
 		client->expect_continuation = false;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	client->if_none_match[0] = '\0';
+#endif
+
 	if (IS_ENABLED(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)) {
 		/* Reset header capture state for new headers frame */
 		client->header_capture_ctx.count = 0;
@@ -1141,7 +1234,7 @@ int handle_http1_to_http2_upgrade(struct http_client_ctx *client)
 	 * to HTTP2.
 	 */
 	if (client->parser_state == HTTP1_MESSAGE_COMPLETE_STATE) {
-		release_http_stream_context(client, frame->stream_identifier);
+		end_http_stream_context(client, frame->stream_identifier);
 		client->current_detail = NULL;
 		client->server_state = HTTP_SERVER_PREFACE_STATE;
 		client->cursor += client->data_len;
@@ -1269,7 +1362,7 @@ int handle_http_frame_data(struct http_client_ctx *client)
 
 		if (is_header_flag_set(frame->flags, HTTP2_FLAG_END_STREAM)) {
 			client->current_stream->current_detail = NULL;
-			release_http_stream_context(client, frame->stream_identifier);
+			end_http_stream_context(client, frame->stream_identifier);
 		}
 
 		/* Whole frame consumed, expect next one. */
@@ -1405,6 +1498,12 @@ static int process_header(struct http_client_ctx *client,
 						       &client->supported_compression);
 	}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+	else if (header->name_len == (sizeof("if-none-match") - 1) &&
+		 memcmp(header->name, "if-none-match", header->name_len) == 0) {
+		http_server_etag_store(client, header->value, header->value_len);
+	}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 	else {
 		/* Just ignore for now. */
 		LOG_DBG("Ignoring field %.*s", (int)header->name_len, header->name);
@@ -1530,7 +1629,7 @@ static int handle_http_frame_headers_end_stream(struct http_client_ctx *client)
 	client->current_stream->current_detail = NULL;
 
 out:
-	release_http_stream_context(client, frame->stream_identifier);
+	end_http_stream_context(client, frame->stream_identifier);
 
 	return ret;
 }
@@ -1736,6 +1835,33 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 		return -EAGAIN;
 	}
 
+	if (!is_header_flag_set(frame->flags, HTTP2_FLAG_SETTINGS_ACK)) {
+		const struct http2_settings_field *setting =
+			(const struct http2_settings_field *)client->cursor;
+
+		for (size_t i = 0; i < frame->length / sizeof(*setting); i++, setting++) {
+			uint32_t value = ntohl(UNALIGNED_GET(&setting->value));
+
+			ARG_UNUSED(value);
+
+			switch (ntohs(UNALIGNED_GET(&setting->id))) {
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE > 0
+			case HTTP2_SETTINGS_HEADER_TABLE_SIZE:
+				/* Maximum size of the peer decoder dynamic table */
+				http_hpack_encoder_set_max_size(&client->hpack_encoder, value);
+				break;
+#endif
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+			case HTTP2_SETTINGS_INITIAL_WINDOW_SIZE:
+				handle_initial_window_size(client, value);
+				break;
+#endif
+			default:
+				break;
+			}
+		}
+	}
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
@@ -1770,11 +1896,101 @@ int handle_http_frame_goaway(struct http_client_ctx *client)
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	/* Send what the peer windows still allow before closing */
+	while (handle_http2_pending_data(client) > 0) {
+	}
+#endif
+
 	enter_http_done_state(client);
 
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+static int update_send_window(int *window, uint32_t increment)
+{
+	/* RFC 9113 ch 6.9.1, a window cannot exceed 2^31 - 1 */
+	if (increment > INT32_MAX - MAX(*window, 0)) {
+		return -EBADMSG;
+	}
+
+	*window += increment;
+
+	return 0;
+}
+
+static void handle_initial_window_size(struct http_client_ctx *client, uint32_t size)
+{
+	int delta;
+
+	if (size > INT32_MAX) {
+		return;
+	}
+
+	/* RFC 9113 ch 6.9.2, the change applies to all the open streams */
+	delta = (int)size - client->initial_send_window;
+	client->initial_send_window = size;
+
+	ARRAY_FOR_EACH(client->streams, i) {
+		if (client->streams[i].stream_state != HTTP2_STREAM_IDLE) {
+			client->streams[i].send_window += delta;
+		}
+	}
+}
+
+int handle_http2_pending_data(struct http_client_ctx *client)
+{
+	size_t num_streams = ARRAY_SIZE(client->streams);
+	bool more = false;
+	int ret;
+
+	/* One data frame per stream, the first stream served changes on each
+	 * call, so that all the responses progress at the same pace.
+	 */
+	for (size_t n = 0; n < num_streams && client->send_window > 0; n++) {
+		struct http2_stream_ctx *stream =
+			&client->streams[(client->next_stream + n) % num_streams];
+		const uint8_t *data = stream->pending_data;
+		size_t len;
+
+		if (stream->stream_state == HTTP2_STREAM_IDLE ||
+		    stream->pending_len == 0 || stream->send_window <= 0) {
+			continue;
+		}
+
+		len = MIN(stream->pending_len, CONFIG_HTTP_SERVER_HTTP2_SEND_SLICE_SIZE);
+		len = MIN(len, (size_t)stream->send_window);
+		len = MIN(len, (size_t)client->send_window);
+
+		stream->pending_data += len;
+		stream->pending_len -= len;
+
+		ret = send_data_frame(client, data, len, stream->stream_id,
+				      stream->pending_len > 0 ? 0 : HTTP2_FLAG_END_STREAM);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			return ret;
+		}
+
+		if (stream->pending_len > 0) {
+			more = more || stream->send_window > 0;
+			continue;
+		}
+
+		stream->end_stream_sent = true;
+
+		if (stream->stream_state == HTTP2_STREAM_HALF_CLOSED_REMOTE) {
+			release_http_stream_context(client, stream->stream_id);
+		}
+	}
+
+	client->next_stream = (client->next_stream + 1) % num_streams;
+
+	return more && client->send_window > 0 ? 1 : 0;
+}
+#endif /* CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL */
+
 int handle_http_frame_window_update(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1782,12 +1998,33 @@ int handle_http_frame_window_update(struct http_client_ctx *client)
 
 	LOG_DBG("HTTP_SERVER_FRAME_WINDOW_UPDATE");
 
-	/* TODO Implement flow control, for now just ignore. */
-
 	if (client->data_len < frame->length) {
 		return -EAGAIN;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	if (frame->length == sizeof(uint32_t)) {
+		uint32_t increment = sys_get_be32(client->cursor) & 0x7FFFFFFF;
+		struct http2_stream_ctx *stream;
+
+		if (frame->stream_identifier == 0) {
+			if (update_send_window(&client->send_window, increment) < 0) {
+				LOG_DBG("Connection send window overflow");
+				return -EBADMSG;
+			}
+		} else {
+			stream = find_http_stream_context(client, frame->stream_identifier);
+			if (stream != NULL &&
+			    update_send_window(&stream->send_window, increment) < 0) {
+				LOG_DBG("Stream %u send window overflow", stream->stream_id);
+				return -EBADMSG;
+			}
+		}
+	}
+#else
+	/* Flow control not enabled, just ignore. */
+#endif
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
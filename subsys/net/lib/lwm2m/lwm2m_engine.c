@@ -596,6 +596,7 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 {
 	struct observe_node *obs;
 	int rc;
+	int sent = 0;
 	int64_t next = INT64_MAX;
 
 	lwm2m_registry_lock();
@@ -625,8 +626,8 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 			engine_observe_shedule_next_event(obs, ctx->srv_obj_inst, timestamp);
 		obs->last_timestamp = timestamp;
 
-		if (!rc) {
-			/* create at most one notification */
+		if (!rc && ++sent >= CONFIG_LWM2M_ENGINE_NOTIFY_BATCH) {
+			/* create at most CONFIG_LWM2M_ENGINE_NOTIFY_BATCH notifications */
 			goto cleanup;
 		}
 	}
@@ -65,6 +65,16 @@ static sys_slist_t obs_obj_path_list;
 
 static struct observe_node observe_node_data[CONFIG_LWM2M_ENGINE_MAX_OBSERVER];
 
+/* Index of the observed paths, used to reject notifications of unobserved
+ * resources without walking the observers. It is a bitmap of hashed path
+ * prefixes, so it may report false positives but never false negatives, and
+ * is rebuilt from observe_node_data[] when observers are added or removed.
+ */
+#define OBSERVATION_INDEX_BITS 256
+
+static uint32_t observation_index[OBSERVATION_INDEX_BITS / 32];
+static bool observation_index_stale;
+
 /* External resources */
 struct lwm2m_ctx **lwm2m_sock_ctx(void);
 
@@ -190,6 +200,72 @@ static bool lwm2m_observer_path_compare(const struct lwm2m_obj_path *o_p,
 	return true;
 }
 
+static uint32_t observation_index_hash(const struct lwm2m_obj_path *path, uint8_t level)
+{
+	uint32_t hash = level;
+
+	hash = hash * 31U + path->obj_id;
+	if (level >= LWM2M_PATH_LEVEL_OBJECT_INST) {
+		hash = hash * 31U + path->obj_inst_id;
+	}
+	if (level >= LWM2M_PATH_LEVEL_RESOURCE) {
+		hash = hash * 31U + path->res_id;
+	}
+
+	return ((hash * 2654435761U) >> 16) % OBSERVATION_INDEX_BITS;
+}
+
+static void observation_index_rebuild(void)
+{
+	struct lwm2m_obj_path_list *o_p;
+	uint8_t level;
+	uint32_t hash;
+	int i;
+
+	memset(observation_index, 0, sizeof(observation_index));
+
+	for (i = 0; i < CONFIG_LWM2M_ENGINE_MAX_OBSERVER; i++) {
+		if (!observe_node_data[i].tkl) {
+			continue;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&observe_node_data[i].path_list, o_p, node) {
+			/* Resource instances are indexed with their resource */
+			level = MIN(o_p->path.level, LWM2M_PATH_LEVEL_RESOURCE);
+			hash = observation_index_hash(&o_p->path, level);
+			observation_index[hash / 32] |= BIT(hash % 32);
+		}
+	}
+
+	observation_index_stale = false;
+}
+
+/* Return false if no observation can match the path */
+static bool observation_index_lookup(const struct lwm2m_obj_path *path)
+{
+	uint32_t hash;
+	uint8_t level;
+
+	/* Coarser paths also match deeper observations, walk the observers */
+	if (path->level < LWM2M_PATH_LEVEL_RESOURCE) {
+		return true;
+	}
+
+	if (observation_index_stale) {
+		observation_index_rebuild();
+	}
+
+	/* Any observation of a prefix of the path matches it */
+	for (level = LWM2M_PATH_LEVEL_OBJECT; level <= LWM2M_PATH_LEVEL_RESOURCE; level++) {
+		hash = observation_index_hash(path, level);
+		if (observation_index[hash / 32] & BIT(hash % 32)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 static bool lwm2m_notify_observer_list(sys_slist_t *path_list, const struct lwm2m_obj_path *path)
 {
 	struct lwm2m_obj_path_list *o_p;
@@ -364,10 +440,21 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 		return 0;
 	}
 
+	if (!observation_index_lookup(path)) {
+		return 0;
+	}
+
 	/* look for observers which match our resource */
 	for (i = 0; i < lwm2m_sock_nfds(); ++i) {
 		SYS_SLIST_FOR_EACH_CONTAINER(&sock_ctx[i]->observer, obs, node) {
 			if (lwm2m_notify_observer_list(&obs->path_list, path)) {
+				if (obs->resource_update && obs->event_timestamp &&
+				    obs->event_timestamp <= k_uptime_get()) {
+					/* Already due, coalesce into the pending notification */
+					ret++;
+					continue;
+				}
+
 				/* update the event time for this observer */
 				ret = engine_observe_attribute_list_get(&obs->path_list, &nattrs,
 									sock_ctx[i]->srv_obj_inst);
@@ -460,6 +547,7 @@ static void engine_observe_node_init(struct observe_node *obs, const uint8_t *to
 	obs->format = format;
 	obs->counter = OBSERVE_COUNTER_START;
 	sys_slist_append(&ctx->observer, &obs->node);
+	observation_index_stale = true;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&obs->path_list, tmp, node) {
 		LOG_DBG("OBSERVER ADDED %u/%u/%u/%u(%u)", tmp->path.obj_id, tmp->path.obj_inst_id,
@@ -486,6 +574,7 @@ static void remove_observer_path_from_list(struct lwm2m_ctx *ctx, struct observe
 	/* Remove from the list and add to free list */
 	sys_slist_remove(&obs->path_list, prev_node, &o_p->node);
 	sys_slist_append(&obs_obj_path_list, &o_p->node);
+	observation_index_stale = true;
 }
 
 static void engine_observe_single_path_id_remove(struct lwm2m_ctx *ctx, struct observe_node *obs,
@@ -1372,6 +1461,10 @@ bool lwm2m_path_is_observed(const struct lwm2m_obj_path *path)
 	struct observe_node *obs;
 	struct lwm2m_ctx **sock_ctx = lwm2m_sock_ctx();
 
+	if (!observation_index_lookup(path)) {
+		return false;
+	}
+
 	for (i = 0; i < lwm2m_sock_nfds(); ++i) {
 		SYS_SLIST_FOR_EACH_CONTAINER(&sock_ctx[i]->observer, obs, node) {
 
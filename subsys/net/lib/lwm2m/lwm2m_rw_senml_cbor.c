@@ -35,26 +35,26 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 #define SENML_MAX_NAME_SIZE sizeof("/65535/65535/")
 
+/* Header of the pack array while it is being encoded, see put_record() */
+#define SENML_CBOR_MAX_RECORDS UINT16_MAX
+
 struct cbor_out_fmt_data {
-	/* Data */
-	struct lwm2m_senml input;
+	/* Record being formed, encoded into the message when its value is put */
+	struct record rec;
+
+	/* Encoder state of the pack, written directly into the message */
+	zcbor_state_t states[5];
+	bool started;
 
-	/* Storage for basenames and names ~ sizeof("/65535/65535/") */
-	struct {
-		char names[CONFIG_LWM2M_RW_SENML_CBOR_RECORDS][SENML_MAX_NAME_SIZE];
-		size_t name_sz; /* Name buff size */
-		uint8_t name_cnt;
-	};
+	/* Storage for basename and name ~ sizeof("/65535/65535/") */
+	char basename[SENML_MAX_NAME_SIZE];
+	char name[SENML_MAX_NAME_SIZE];
 
 	/* Basetime for Cached data timestamp */
 	time_t basetime;
 
-	/* Storage for object links */
-	struct {
-		char objlnk[CONFIG_LWM2M_RW_SENML_CBOR_RECORDS][sizeof("65535:65535")];
-		size_t objlnk_sz; /* Object link buff size */
-		uint8_t objlnk_cnt;
-	};
+	/* Storage for object link */
+	char objlnk[sizeof("65535:65535")];
 };
 
 struct cbor_in_fmt_data {
@@ -78,15 +78,8 @@ static int path_to_string(char *buf, size_t buf_size, const struct lwm2m_obj_pat
  */
 K_MUTEX_DEFINE(fd_mtx);
 
-#define GET_CBOR_FD_NAME(fd) ((fd)->names[(fd)->name_cnt])
-/* Get the current record */
-#define GET_CBOR_FD_REC(fd) \
-	&((fd)->input.lwm2m_senml_record_m[(fd)->input.lwm2m_senml_record_m_count])
 /* Get a record */
 #define GET_IN_FD_REC_I(fd, i) &((fd)->dcd.lwm2m_senml_record_m[i])
-/* Consume the current record */
-#define CONSUME_CBOR_FD_REC(fd) \
-	&((fd)->input.lwm2m_senml_record_m[(fd)->input.lwm2m_senml_record_m_count++])
 /* Get CBOR output formatter data */
 #define LWM2M_OFD_CBOR(octx) ((struct cbor_out_fmt_data *)engine_get_out_user_data(octx))
 
@@ -98,9 +91,7 @@ static void setup_out_fmt_data(struct lwm2m_message *msg)
 
 	(void)memset(fd, 0, sizeof(*fd));
 	engine_set_out_user_data(&msg->out, fd);
-	fd->name_sz = SENML_MAX_NAME_SIZE;
 	fd->basetime = 0;
-	fd->objlnk_sz = sizeof("65535:65535");
 }
 
 static void clear_out_fmt_data(struct lwm2m_message *msg)
@@ -127,15 +118,36 @@ static void clear_in_fmt_data(struct lwm2m_message *msg)
 	k_mutex_unlock(&fd_mtx);
 }
 
-static int fmt_range_check(struct cbor_out_fmt_data *fd)
+/*
+ * Records are encoded into the message as soon as their value is put, after the
+ * array header of the pack. The header is encoded for SENML_CBOR_MAX_RECORDS
+ * records and shrunk to the actual count by the canonical encoder in put_end().
+ * The message offset is only advanced by put_end().
+ */
+static int put_record(struct lwm2m_output_context *out)
 {
-	if (fd->name_cnt >= CONFIG_LWM2M_RW_SENML_CBOR_RECORDS ||
-	    fd->objlnk_cnt >= CONFIG_LWM2M_RW_SENML_CBOR_RECORDS ||
-	    fd->input.lwm2m_senml_record_m_count >= CONFIG_LWM2M_RW_SENML_CBOR_RECORDS) {
-		LOG_ERR("CONFIG_LWM2M_RW_SENML_CBOR_RECORDS too small");
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+
+	if (!fd->started) {
+		zcbor_new_encode_state(fd->states, ARRAY_SIZE(fd->states),
+				       CPKT_BUF_W_REGION(out->out_cpkt), 1);
+
+		if (!zcbor_list_start_encode(fd->states, SENML_CBOR_MAX_RECORDS)) {
+			LOG_DBG("no space for senml cbor pack");
+			return -ENOMEM;
+		}
+
+		fd->started = true;
+	}
+
+	if (!cbor_encode_lwm2m_senml_record(fd->states, &fd->rec)) {
+		LOG_DBG("no space for senml cbor record");
 		return -ENOMEM;
 	}
 
+	/* The next record starts empty */
+	(void)memset(&fd->rec, 0, sizeof(fd->rec));
+
 	return 0;
 }
 
@@ -143,23 +155,17 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 {
 	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
 	int len;
-	int ret;
-
-	ret = fmt_range_check(fd);
-	if (ret < 0) {
-		return ret;
-	}
 
-	char *basename = GET_CBOR_FD_NAME(fd);
+	char *basename = fd->basename;
 
-	len = path_to_string(basename, fd->name_sz, path, LWM2M_PATH_LEVEL_OBJECT_INST);
+	len = path_to_string(basename, sizeof(fd->basename), path, LWM2M_PATH_LEVEL_OBJECT_INST);
 
 	if (len < 0) {
 		return len;
 	}
 
 	/* Tell CBOR encoder where to find the name */
-	struct record *record = GET_CBOR_FD_REC(fd);
+	struct record *record = &fd->rec;
 
 	record->record_bn.record_bn.value = basename;
 	record->record_bn.record_bn.len = len;
@@ -170,8 +176,6 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 		return -EINVAL;
 	}
 
-	fd->name_cnt++;
-
 	return 0;
 }
 
@@ -188,23 +192,21 @@ static int put_empty_array(struct lwm2m_output_context *out)
 static int put_end(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
 {
 	size_t len;
-	struct lwm2m_senml *input = &(LWM2M_OFD_CBOR(out)->input);
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
 
-	if (!input->lwm2m_senml_record_m_count) {
+	if (!fd->started) {
 		len = put_empty_array(out);
 
 		return len;
 	}
 
-	uint_fast8_t ret =
-		cbor_encode_lwm2m_senml(CPKT_BUF_W_REGION(out->out_cpkt), input, &len);
-
-	if (ret != ZCBOR_SUCCESS) {
+	if (!zcbor_list_end_encode(fd->states, SENML_CBOR_MAX_RECORDS)) {
 		LOG_ERR("unable to encode senml cbor msg");
 
 		return -E2BIG;
 	}
 
+	len = fd->states[0].payload - CPKT_BUF_W_PTR(out->out_cpkt);
 	out->out_cpkt->offset += len;
 
 	return len;
@@ -228,14 +230,8 @@ static int put_begin_r(struct lwm2m_output_context *out, struct lwm2m_obj_path *
 {
 	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
 	int len;
-	int ret;
-
-	ret = fmt_range_check(fd);
-	if (ret < 0) {
-		return ret;
-	}
 
-	char *name = GET_CBOR_FD_NAME(fd);
+	char *name = fd->name;
 
 	/* Write resource name */
 	len = snprintk(name, sizeof("65535"), "%" PRIu16 "", path->res_id);
@@ -245,30 +241,13 @@ static int put_begin_r(struct lwm2m_output_context *out, struct lwm2m_obj_path *
 		return -EINVAL;
 	}
 
-	/* Check if we could use an already existing name
-	 * -> latest name slot is used as a scratchpad
-	 */
-	for (int idx = 0; idx < fd->name_cnt; idx++) {
-		if (strncmp(name, fd->names[idx], len) == 0) {
-			name = fd->names[idx];
-			break;
-		}
-	}
-
 	/* Tell CBOR encoder where to find the name */
-	struct record *record = GET_CBOR_FD_REC(fd);
+	struct record *record = &fd->rec;
 
 	record->record_n.record_n.value = name;
 	record->record_n.record_n.len = len;
 	record->record_n_present = 1;
 
-	/* Makes possible to use same slot for storing r/ri name combination.
-	 * No need to increase the name count if an existing name has been used
-	 */
-	if (path->level < LWM2M_PATH_LEVEL_RESOURCE_INST && name == GET_CBOR_FD_NAME(fd)) {
-		fd->name_cnt++;
-	}
-
 	return 0;
 }
 
@@ -276,15 +255,9 @@ static int put_data_timestamp(struct lwm2m_output_context *out, time_t value)
 {
 	struct record *out_record;
 	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
-	int ret;
-
-	ret = fmt_range_check(fd);
-	if (ret < 0) {
-		return ret;
-	}
 
 	/* Tell CBOR encoder where to find the name */
-	out_record = GET_CBOR_FD_REC(fd);
+	out_record = &fd->rec;
 
 	if (fd->basetime) {
 		out_record->record_t.record_t = value - fd->basetime;
@@ -302,14 +275,8 @@ static int put_data_timestamp(struct lwm2m_output_context *out, time_t value)
 static int put_begin_ri(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
 {
 	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
-	char *name = GET_CBOR_FD_NAME(fd);
-	struct record *record = GET_CBOR_FD_REC(fd);
-	int ret;
-
-	ret = fmt_range_check(fd);
-	if (ret < 0) {
-		return ret;
-	}
+	char *name = fd->name;
+	struct record *record = &fd->rec;
 
 	/* Forms name from resource id and resource instance id */
 	int len = snprintk(name, SENML_MAX_NAME_SIZE,
@@ -321,26 +288,11 @@ static int put_begin_ri(struct lwm2m_output_context *out, struct lwm2m_obj_path
 		return -EINVAL;
 	}
 
-	/* Check if we could use an already existing name
-	 * -> latest name slot is used as a scratchpad
-	 */
-	for (int idx = 0; idx < fd->name_cnt; idx++) {
-		if (strncmp(name, fd->names[idx], len) == 0) {
-			name = fd->names[idx];
-			break;
-		}
-	}
-
 	/* Tell CBOR encoder where to find the name */
 	record->record_n.record_n.value = name;
 	record->record_n.record_n.len = len;
 	record->record_n_present = 1;
 
-	/* No need to increase the name count if an existing name has been used */
-	if (name == GET_CBOR_FD_NAME(fd)) {
-		fd->name_cnt++;
-	}
-
 	return 0;
 }
 
@@ -348,12 +300,12 @@ static int put_name_nth_ri(struct lwm2m_output_context *out, struct lwm2m_obj_pa
 {
 	int ret = 0;
 	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
-	struct record *record = GET_CBOR_FD_REC(fd);
+	struct record *record = &fd->rec;
 
 	/* With the first ri the resource name (and ri name) are already in place*/
 	if (path->res_inst_id > 0) {
 		ret = put_begin_ri(out, path);
-	} else if (record && record->record_t_present) {
+	} else if (record->record_t_present) {
 		/* Name need to be add for each time serialized record */
 		ret = put_begin_r(out, path);
 	}
@@ -369,14 +321,14 @@ static int put_value(struct lwm2m_output_context *out, struct lwm2m_obj_path *pa
 		return ret;
 	}
 
-	struct record *record = CONSUME_CBOR_FD_REC(LWM2M_OFD_CBOR(out));
+	struct record *record = &LWM2M_OFD_CBOR(out)->rec;
 
 	/* Write the value */
 	record->record_union.record_union_choice = union_vi_c;
 	record->record_union.union_vi = value;
 	record->record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_s8(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, int8_t value)
@@ -407,14 +359,14 @@ static int put_time(struct lwm2m_output_context *out, struct lwm2m_obj_path *pat
 		return ret;
 	}
 
-	struct record *record = CONSUME_CBOR_FD_REC(LWM2M_OFD_CBOR(out));
+	struct record *record = &LWM2M_OFD_CBOR(out)->rec;
 
 	/* Write the value */
 	record->record_union.record_union_choice = union_vi_c;
 	record->record_union.union_vi = (int64_t)value;
 	record->record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_float(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, double *value)
@@ -425,14 +377,14 @@ static int put_float(struct lwm2m_output_context *out, struct lwm2m_obj_path *pa
 		return ret;
 	}
 
-	struct record *record = CONSUME_CBOR_FD_REC(LWM2M_OFD_CBOR(out));
+	struct record *record = &LWM2M_OFD_CBOR(out)->rec;
 
 	/* Write the value */
 	record->record_union.record_union_choice = union_vf_c;
 	record->record_union.union_vf = *value;
 	record->record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
@@ -444,7 +396,7 @@ static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 		return ret;
 	}
 
-	struct record *record = CONSUME_CBOR_FD_REC(LWM2M_OFD_CBOR(out));
+	struct record *record = &LWM2M_OFD_CBOR(out)->rec;
 
 	/* Write the value */
 	record->record_union.record_union_choice = union_vs_c;
@@ -452,7 +404,7 @@ static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	record->record_union.union_vs.len = buflen;
 	record->record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_bool(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, bool value)
@@ -463,14 +415,14 @@ static int put_bool(struct lwm2m_output_context *out, struct lwm2m_obj_path *pat
 		return ret;
 	}
 
-	struct record *record = CONSUME_CBOR_FD_REC(LWM2M_OFD_CBOR(out));
+	struct record *record = &LWM2M_OFD_CBOR(out)->rec;
 
 	/* Write the value */
 	record->record_union.record_union_choice = union_vb_c;
 	record->record_union.union_vb = value;
 	record->record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
@@ -482,7 +434,7 @@ static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 		return ret;
 	}
 
-	struct record *record = CONSUME_CBOR_FD_REC(LWM2M_OFD_CBOR(out));
+	struct record *record = &LWM2M_OFD_CBOR(out)->rec;
 
 	/* Write the value */
 	record->record_union.record_union_choice = union_vd_c;
@@ -490,7 +442,7 @@ static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	record->record_union.union_vd.len = buflen;
 	record->record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *path,
@@ -499,16 +451,10 @@ static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	int ret = 0;
 	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
 
-	ret = fmt_range_check(fd);
-	if (ret < 0) {
-		return ret;
-	}
-
 	/* Format object link */
-	int objlnk_idx = fd->objlnk_cnt;
-	char *objlink_buf = fd->objlnk[objlnk_idx];
+	char *objlink_buf = fd->objlnk;
 	int objlnk_len =
-		snprintk(objlink_buf, fd->objlnk_sz, "%u:%u", value->obj_id, value->obj_inst);
+		snprintk(objlink_buf, sizeof(fd->objlnk), "%u:%u", value->obj_id, value->obj_inst);
 	if (objlnk_len < 0) {
 		return -EINVAL;
 	}
@@ -519,7 +465,7 @@ static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 		return ret;
 	}
 
-	struct record *record = CONSUME_CBOR_FD_REC(LWM2M_OFD_CBOR(out));
+	struct record *record = &fd->rec;
 
 	/* Write the value */
 	record->record_union.record_union_choice = union_vlo_c;
@@ -527,9 +473,7 @@ static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	record->record_union.union_vlo.len = objlnk_len;
 	record->record_union_present = 1;
 
-	fd->objlnk_cnt++;
-
-	return 0;
+	return put_record(out);
 }
 
 static int get_opaque(struct lwm2m_input_context *in,
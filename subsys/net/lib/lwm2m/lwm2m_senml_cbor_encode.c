@@ -229,3 +229,8 @@ int cbor_encode_lwm2m_senml(uint8_t *payload, size_t payload_len, const struct l
 				    (zcbor_decoder_t *)encode_lwm2m_senml,
 				    sizeof(states) / sizeof(zcbor_state_t), 1);
 }
+
+bool cbor_encode_lwm2m_senml_record(zcbor_state_t *state, const struct record *input)
+{
+	return encode_record(state, input);
+}
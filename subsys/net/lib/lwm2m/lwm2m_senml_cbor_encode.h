@@ -24,6 +24,9 @@ extern "C" {
 int cbor_encode_lwm2m_senml(uint8_t *payload, size_t payload_len, const struct lwm2m_senml *input,
 			    size_t *payload_len_out);
 
+/* Encode one record into an ongoing encoding, used to stream a pack */
+bool cbor_encode_lwm2m_senml_record(zcbor_state_t *state, const struct record *input);
+
 #ifdef __cplusplus
 }
 #endif
@@ -293,13 +293,204 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
+/** @brief Encode a publish message, the payload is referenced by @p msg. */
+static int publish_msg_prepare(struct mqtt_client *client,
+			       const struct mqtt_publish_param *param,
+			       struct iovec io_vector[2], struct msghdr *msg)
+{
+	int err_code;
+	struct buf_ctx packet;
+
+	tx_buf_init(client, &packet);
+
+	err_code = publish_encode(client, param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	io_vector[0].iov_base = packet.cur;
+	io_vector[0].iov_len = packet.end - packet.cur;
+	io_vector[1].iov_base = param->message.payload.data;
+	io_vector[1].iov_len = param->message.payload.len;
+
+	memset(msg, 0, sizeof(*msg));
+
+	msg->msg_iov = io_vector;
+	msg->msg_iovlen = 2;
+
+	return 0;
+}
+
+#if defined(CONFIG_MQTT_INFLIGHT)
+static struct mqtt_inflight *inflight_find(struct mqtt_client *client,
+					   uint16_t message_id)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight *entry = &client->internal.inflight[i];
+
+		if (entry->awaited != 0U &&
+		    entry->param.message_id == message_id) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static struct mqtt_inflight *inflight_alloc(struct mqtt_client *client,
+					    uint16_t message_id)
+{
+	struct mqtt_inflight *entry;
+
+	/* The application may publish a message again itself. */
+	entry = inflight_find(client, message_id);
+	if (entry != NULL) {
+		return entry;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		entry = &client->internal.inflight[i];
+
+		if (entry->awaited == 0U) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* The transport is not disconnected on error, it is left to the caller. */
+static int inflight_retransmit(struct mqtt_client *client,
+			       struct mqtt_inflight *entry)
+{
+	int err_code;
+
+	if (entry->awaited == MQTT_PKT_TYPE_PUBCOMP) {
+		const struct mqtt_pubrel_param param = {
+			.message_id = entry->param.message_id,
+		};
+		struct buf_ctx packet;
+
+		tx_buf_init(client, &packet);
+
+		err_code = publish_release_encode(client, &param, &packet);
+		if (err_code < 0) {
+			return err_code;
+		}
+
+		err_code = mqtt_transport_write(client, packet.cur,
+						packet.end - packet.cur);
+	} else {
+		struct iovec io_vector[2];
+		struct msghdr msg;
+
+		entry->param.dup_flag = 1U;
+
+		err_code = publish_msg_prepare(client, &entry->param,
+					       io_vector, &msg);
+		if (err_code < 0) {
+			return err_code;
+		}
+
+		err_code = mqtt_transport_write_msg(client, &msg);
+	}
+
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	NET_DBG("[CID %p]: Retransmitted message id 0x%04x", client,
+		entry->param.message_id);
+
+	entry->sent_time = mqtt_sys_tick_in_ms_get();
+	client->internal.last_activity = entry->sent_time;
+
+	return 0;
+}
+
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id)
+{
+	struct mqtt_inflight *entry = inflight_find(client, message_id);
+
+	if (entry == NULL || entry->awaited != type) {
+		return;
+	}
+
+	if (type == MQTT_PKT_TYPE_PUBREC) {
+		/* The application releases the message, wait for completion. */
+		entry->awaited = MQTT_PKT_TYPE_PUBCOMP;
+		entry->sent_time = mqtt_sys_tick_in_ms_get();
+	} else {
+		entry->awaited = 0U;
+	}
+}
+
+int mqtt_inflight_connected(struct mqtt_client *client, bool session_present)
+{
+	int err_code;
+
+	for (size_t i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight *entry = &client->internal.inflight[i];
+
+		if (entry->awaited == 0U) {
+			continue;
+		}
+
+		if (!session_present) {
+			entry->awaited = 0U;
+			continue;
+		}
+
+		err_code = inflight_retransmit(client, entry);
+		if (err_code < 0) {
+			return err_code;
+		}
+	}
+
+	return 0;
+}
+
+static int inflight_retransmit_expired(struct mqtt_client *client)
+{
+	int err_code;
+
+	if (CONFIG_MQTT_INFLIGHT_RETRANSMIT_TIMEOUT == 0 ||
+	    mqtt_is_version_5_0(client)) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight *entry = &client->internal.inflight[i];
+
+		if (entry->awaited == 0U ||
+		    mqtt_elapsed_time_in_ms_get(entry->sent_time) <
+		    CONFIG_MQTT_INFLIGHT_RETRANSMIT_TIMEOUT * MSEC_PER_SEC) {
+			continue;
+		}
+
+		err_code = inflight_retransmit(client, entry);
+		if (err_code < 0) {
+			NET_ERR("Transport write failed, err_code = %d, "
+				"closing connection", err_code);
+			mqtt_client_disconnect(client, err_code, true);
+			return err_code;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_MQTT_INFLIGHT */
+
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param)
 {
 	int err_code;
-	struct buf_ctx packet;
 	struct iovec io_vector[2];
 	struct msghdr msg;
+#if defined(CONFIG_MQTT_INFLIGHT)
+	struct mqtt_inflight *entry = NULL;
+#endif
 
 	NULL_PARAM_CHECK(client);
 	NULL_PARAM_CHECK(param);
@@ -311,30 +502,37 @@ int mqtt_publish(struct mqtt_client *client,
 
 	mqtt_mutex_lock(client);
 
-	tx_buf_init(client, &packet);
-
 	err_code = verify_tx_state(client);
 	if (err_code < 0) {
 		goto error;
 	}
 
-	err_code = publish_encode(client, param, &packet);
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE) {
+		entry = inflight_alloc(client, param->message_id);
+		if (entry == NULL) {
+			err_code = -ENOBUFS;
+			goto error;
+		}
+	}
+#endif
+
+	err_code = publish_msg_prepare(client, param, io_vector, &msg);
 	if (err_code < 0) {
 		goto error;
 	}
 
-	io_vector[0].iov_base = packet.cur;
-	io_vector[0].iov_len = packet.end - packet.cur;
-	io_vector[1].iov_base = param->message.payload.data;
-	io_vector[1].iov_len = param->message.payload.len;
-
-	memset(&msg, 0, sizeof(msg));
-
-	msg.msg_iov = io_vector;
-	msg.msg_iovlen = ARRAY_SIZE(io_vector);
-
 	err_code = client_write_msg(client, &msg);
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (err_code == 0 && entry != NULL) {
+		entry->param = *param;
+		entry->awaited = param->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE ?
+				 MQTT_PKT_TYPE_PUBACK : MQTT_PKT_TYPE_PUBREC;
+		entry->sent_time = client->internal.last_activity;
+	}
+#endif
+
 error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
 			 client, client->internal.state, err_code);
@@ -719,6 +917,17 @@ int mqtt_live(struct mqtt_client *client)
 		ping_sent = true;
 	}
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (err_code == 0 && MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+		int ret = inflight_retransmit_expired(client);
+
+		if (ret < 0) {
+			mqtt_mutex_unlock(client);
+			return ret;
+		}
+	}
+#endif
+
 	mqtt_mutex_unlock(client);
 
 	if (ping_sent) {
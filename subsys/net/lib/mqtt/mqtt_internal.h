@@ -208,6 +208,27 @@ int mqtt_handle_rx(struct mqtt_client *client);
  */
 void mqtt_client_disconnect(struct mqtt_client *client, int result, bool notify);
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+/**@brief Update the in-flight publications on an acknowledgment.
+ *
+ * @param[in] client Identifies the client which received the acknowledgment.
+ * @param[in] type Type of the acknowledgment packet, PUBACK, PUBREC or
+ *                 PUBCOMP.
+ * @param[in] message_id Message id of the acknowledgment.
+ */
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id);
+
+/**@brief Resume or drop the in-flight publications on connection.
+ *
+ * @param[in] client Identifies the client which got connected.
+ * @param[in] session_present Whether the broker resumed the session.
+
+ * @return 0 if the procedure is successful, an error code otherwise.
+ */
+int mqtt_inflight_connected(struct mqtt_client *client, bool session_present);
+#endif /* CONFIG_MQTT_INFLIGHT */
+
 /**@brief Constructs/encodes Connect packet.
  *
  * @param[in] client Identifies the client for which the procedure is requested.
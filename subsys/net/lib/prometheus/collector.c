@@ -164,7 +164,7 @@ int prometheus_collector_walk_metrics(struct prometheus_collector_walk_context *
 {
 	int ret = 0;
 
-	if (ctx->collector == NULL) {
+	if (ctx->collector == NULL || buffer == NULL || buffer_size == 0) {
 		LOG_ERR("Invalid arguments");
 		return -EINVAL;
 	}
@@ -173,61 +173,56 @@ int prometheus_collector_walk_metrics(struct prometheus_collector_walk_context *
 		k_mutex_lock(&ctx->collector->lock, K_FOREVER);
 		ctx->state = PROMETHEUS_WALK_CONTINUE;
 
-		/* Start of the loop is taken from
-		 * SYS_SLIST_FOR_EACH_CONTAINER_SAFE macro to simulate
-		 * a loop.
-		 */
-
-		ctx->metric = Z_GENLIST_PEEK_HEAD_CONTAINER(slist,
-							    &ctx->collector->metrics,
-							    ctx->metric,
-							    node);
-		ctx->tmp = Z_GENLIST_PEEK_NEXT_CONTAINER(slist,
-							 ctx->metric,
-							 node);
+		ctx->metric = SYS_SLIST_PEEK_HEAD_CONTAINER(&ctx->collector->metrics,
+							    ctx->metric, node);
 	}
 
 	if (ctx->state == PROMETHEUS_WALK_CONTINUE) {
 		int len = 0;
 
-		ctx->metric = ctx->tmp;
-		ctx->tmp = Z_GENLIST_PEEK_NEXT_CONTAINER(slist,
-							 ctx->metric,
-							 node);
+		buffer[0] = '\0';
 
-		if (ctx->metric == NULL) {
-			ctx->state = PROMETHEUS_WALK_STOP;
-			goto out;
-		}
+		/* Format as many metrics as fit in the buffer */
+		while (ctx->metric != NULL) {
+			int prev_len = len;
 
-		/* If there is a user callback, use it to update the metric data. */
-		if (ctx->collector->user_cb) {
-			ret = ctx->collector->user_cb(ctx->collector, ctx->metric,
-						      ctx->collector->user_data);
-			if (ret < 0) {
-				if (ret != -EAGAIN) {
+			/* If there is a user callback, use it to update the metric data. */
+			if (ctx->collector->user_cb) {
+				ret = ctx->collector->user_cb(ctx->collector, ctx->metric,
+							      ctx->collector->user_data);
+				if (ret < 0 && ret != -EAGAIN) {
 					ctx->state = PROMETHEUS_WALK_STOP;
 					goto out;
 				}
+			}
+
+			/* -EAGAIN from the user callback skips this metric for now */
+			if (ret != -EAGAIN) {
+				ret = prometheus_format_one_metric(ctx->metric, buffer,
+								   buffer_size, &len);
+				if (ret == -ENOMEM && prev_len > 0) {
+					/* Does not fit, format it in the next call */
+					buffer[prev_len] = '\0';
+					ret = -EAGAIN;
+					goto out;
+				}
 
-				/* Skip this metric for now */
-				goto out;
+				if (ret < 0) {
+					ctx->state = PROMETHEUS_WALK_STOP;
+					goto out;
+				}
 			}
-		}
 
-		ret = prometheus_format_one_metric(ctx->metric, buffer, buffer_size, &len);
-		if (ret < 0) {
-			ctx->state = PROMETHEUS_WALK_STOP;
-			goto out;
+			ret = 0;
+			ctx->metric = SYS_SLIST_PEEK_NEXT_CONTAINER(ctx->metric, node);
 		}
 
-		ret = -EAGAIN;
+		ctx->state = PROMETHEUS_WALK_STOP;
 	}
 
 out:
 	if (ctx->state == PROMETHEUS_WALK_STOP) {
 		k_mutex_unlock(&ctx->collector->lock);
-		ret = 0;
 	}
 
 	return ret;
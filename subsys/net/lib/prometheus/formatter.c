@@ -24,25 +24,31 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_formatter, CONFIG_PROMETHEUS_LOG_LEVEL);
 
-static int write_metric_to_buffer(char *buffer, size_t buffer_size, const char *format, ...)
+static int write_metric_to_buffer(char *buffer, size_t buffer_size, int *written,
+				  const char *format, ...)
 {
-	/* helper function to write formatted metric to buffer */
+	/* helper function to append formatted metric to buffer */
 	va_list args;
-	size_t len = strlen(buffer);
+	size_t space;
+	int len;
 
-	if (len >= buffer_size) {
+	if (*written < 0 || (size_t)*written >= buffer_size) {
 		return -ENOMEM;
 	}
-	buffer += len;
-	buffer_size -= len;
+
+	space = buffer_size - *written;
 
 	va_start(args, format);
-	len = vsnprintf(buffer, buffer_size, format, args);
+	len = vsnprintf(buffer + *written, space, format, args);
 	va_end(args);
-	if (len >= buffer_size) {
+	if (len < 0 || (size_t)len >= space) {
+		/* Do not leave a truncated line behind */
+		buffer[*written] = '\0';
 		return -ENOMEM;
 	}
 
+	*written += len;
+
 	return 0;
 }
 
@@ -51,13 +57,18 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 {
 	int ret = 0;
 
+	/* Append to what the buffer already holds */
+	if (*written >= 0 && (size_t)*written < buffer_size) {
+		*written += strnlen(buffer + *written, buffer_size - *written);
+	}
+
 	/* write HELP line if available */
 	if (metric->description[0] != '\0') {
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# HELP %s %s\n", metric->name,
 					     metric->description);
 		if (ret < 0) {
-			LOG_ERR("Error writing to buffer");
+			LOG_DBG("Error writing to buffer");
 			goto out;
 		}
 	}
@@ -65,50 +76,50 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 	/* write TYPE line */
 	switch (metric->type) {
 	case PROMETHEUS_COUNTER:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s counter\n", metric->name);
 		if (ret < 0) {
-			LOG_ERR("Error writing counter");
+			LOG_DBG("Error writing counter");
 			goto out;
 		}
 
 		break;
 
 	case PROMETHEUS_GAUGE:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s gauge\n", metric->name);
 		if (ret < 0) {
-			LOG_ERR("Error writing gauge");
+			LOG_DBG("Error writing gauge");
 			goto out;
 		}
 
 		break;
 
 	case PROMETHEUS_HISTOGRAM:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s histogram\n", metric->name);
 		if (ret < 0) {
-			LOG_ERR("Error writing histogram");
+			LOG_DBG("Error writing histogram");
 			goto out;
 		}
 
 		break;
 
 	case PROMETHEUS_SUMMARY:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s summary\n", metric->name);
 		if (ret < 0) {
-			LOG_ERR("Error writing summary");
+			LOG_DBG("Error writing summary");
 			goto out;
 		}
 
 		break;
 
 	default:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s untyped\n", metric->name);
 		if (ret < 0) {
-			LOG_ERR("Error writing untyped");
+			LOG_DBG("Error writing untyped");
 			goto out;
 		}
 
@@ -125,11 +136,11 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < metric->num_labels; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s{%s=\"%s\"} %llu\n", metric->name, metric->labels[i].key,
 				metric->labels[i].value, counter->value);
 			if (ret < 0) {
-				LOG_ERR("Error writing counter");
+				LOG_DBG("Error writing counter");
 				goto out;
 			}
 		}
@@ -145,11 +156,11 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < metric->num_labels; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s{%s=\"%s\"} %f\n", metric->name, metric->labels[i].key,
 				metric->labels[i].value, gauge->value);
 			if (ret < 0) {
-				LOG_ERR("Error writing gauge");
+				LOG_DBG("Error writing gauge");
 				goto out;
 			}
 		}
@@ -165,28 +176,28 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < histogram->num_buckets; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s_bucket{le=\"%f\"} %lu\n", metric->name,
 				histogram->buckets[i].upper_bound,
 				histogram->buckets[i].count);
 			if (ret < 0) {
-				LOG_ERR("Error writing histogram");
+				LOG_DBG("Error writing histogram");
 				goto out;
 			}
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_sum %f\n", metric->name, histogram->sum);
 		if (ret < 0) {
-			LOG_ERR("Error writing histogram");
+			LOG_DBG("Error writing histogram");
 			goto out;
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_count %lu\n", metric->name,
 					     histogram->count);
 		if (ret < 0) {
-			LOG_ERR("Error writing histogram");
+			LOG_DBG("Error writing histogram");
 			goto out;
 		}
 
@@ -201,28 +212,28 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < summary->num_quantiles; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s{%s=\"%f\"} %f\n", metric->name, "quantile",
 				summary->quantiles[i].quantile,
 				summary->quantiles[i].value);
 			if (ret < 0) {
-				LOG_ERR("Error writing summary");
+				LOG_DBG("Error writing summary");
 				goto out;
 			}
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_sum %f\n", metric->name, summary->sum);
 		if (ret < 0) {
-			LOG_ERR("Error writing summary");
+			LOG_DBG("Error writing summary");
 			goto out;
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_count %lu\n", metric->name,
 					     summary->count);
 		if (ret < 0) {
-			LOG_ERR("Error writing summary");
+			LOG_DBG("Error writing summary");
 			goto out;
 		}
 
@@ -253,6 +264,8 @@ int prometheus_format_exposition(struct prometheus_collector *collector, char *b
 		return -EINVAL;
 	}
 
+	buffer[0] = '\0';
+
 	k_mutex_lock(&collector->lock, K_FOREVER);
 
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&collector->metrics, metric, tmp, node) {
@@ -273,6 +286,7 @@ int prometheus_format_exposition(struct prometheus_collector *collector, char *b
 
 		ret = prometheus_format_one_metric(metric, buffer, buffer_size, &written);
 		if (ret < 0) {
+			LOG_ERR("Cannot format metric %s (%d)", metric->name, ret);
 			goto out;
 		}
 	}
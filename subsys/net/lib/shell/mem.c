@@ -178,6 +178,13 @@ static int cmd_net_mem(const struct shell *sh, size_t argc, char *argv[])
 			   k_cyc_to_us_ceil64(stats->fail.time_sum /
 					      (uint64_t)stats->fail.count));
 		}
+
+#if defined(CONFIG_NET_PKT_RX_CACHE)
+		if (stats->cache_hits) {
+			PR("%p\tCACHE\t%u\t(%u refills)\n", stats->slab,
+			   stats->cache_hits, stats->cache_refills);
+		}
+#endif
 	}
 #endif /* CONFIG_NET_PKT_ALLOC_STATS */
 
@@ -46,18 +46,29 @@ LOG_MODULE_REGISTER(net_sock_addr, CONFIG_NET_SOCKETS_LOG_LEVEL);
 
 struct getaddrinfo_state {
 	const struct zsock_addrinfo *hints;
-	struct k_sem sem;
-	int status;
+	/* Protects the results when the queries run in parallel */
+	struct k_mutex lock;
 	uint16_t idx;
 	uint16_t port;
-	uint16_t dns_id;
 	struct zsock_addrinfo *ai_arr;
 };
 
+/* A or AAAA query of a getaddrinfo() call */
+struct getaddrinfo_query {
+	struct getaddrinfo_state *state;
+	struct k_sem sem;
+	int status;
+	uint16_t dns_id;
+	enum dns_query_type qtype;
+	k_timepoint_t end;
+	k_timeout_t timeout;
+};
+
 static void dns_resolve_cb(enum dns_resolve_status status,
 			   struct dns_addrinfo *info, void *user_data)
 {
-	struct getaddrinfo_state *state = user_data;
+	struct getaddrinfo_query *query = user_data;
+	struct getaddrinfo_state *state = query->state;
 	struct zsock_addrinfo *ai;
 	int socktype = SOCK_STREAM;
 
@@ -67,14 +78,16 @@ static void dns_resolve_cb(enum dns_resolve_status status,
 		if (status == DNS_EAI_ALLDONE) {
 			status = 0;
 		}
-		state->status = status;
-		k_sem_give(&state->sem);
+		query->status = status;
+		k_sem_give(&query->sem);
 		return;
 	}
 
+	k_mutex_lock(&state->lock, K_FOREVER);
+
 	if (state->idx >= AI_ARR_MAX) {
 		NET_DBG("getaddrinfo entries overflow");
-		return;
+		goto out;
 	}
 
 	ai = &state->ai_arr[state->idx];
@@ -101,6 +114,9 @@ static void dns_resolve_cb(enum dns_resolve_status status,
 	ai->ai_protocol = (socktype == SOCK_DGRAM) ? IPPROTO_UDP : IPPROTO_TCP;
 
 	state->idx++;
+
+out:
+	k_mutex_unlock(&state->lock);
 }
 
 static k_timeout_t recalc_timeout(k_timepoint_t end, k_timeout_t timeout)
@@ -118,67 +134,157 @@ static k_timeout_t recalc_timeout(k_timepoint_t end, k_timeout_t timeout)
 	return timeout;
 }
 
-static int exec_query(const char *host, int family,
-		      struct getaddrinfo_state *ai_state)
+static void query_init(struct getaddrinfo_query *query, int family,
+		       struct getaddrinfo_state *ai_state)
 {
-	enum dns_query_type qtype = DNS_QUERY_TYPE_A;
-	k_timepoint_t end = sys_timepoint_calc(K_MSEC(CONFIG_NET_SOCKETS_DNS_TIMEOUT));
-	k_timeout_t timeout = K_MSEC(MIN(CONFIG_NET_SOCKETS_DNS_TIMEOUT,
-					 CONFIG_NET_SOCKETS_DNS_BACKOFF_INTERVAL));
-	int timeout_ms;
-	int st, ret;
-
-	if (family == AF_INET6) {
-		qtype = DNS_QUERY_TYPE_AAAA;
-	}
+	query->state = ai_state;
+	query->status = 0;
+	query->dns_id = 0;
+	query->qtype = (family == AF_INET6) ? DNS_QUERY_TYPE_AAAA : DNS_QUERY_TYPE_A;
+	query->end = sys_timepoint_calc(K_MSEC(CONFIG_NET_SOCKETS_DNS_TIMEOUT));
+	query->timeout = K_MSEC(MIN(CONFIG_NET_SOCKETS_DNS_TIMEOUT,
+				    CONFIG_NET_SOCKETS_DNS_BACKOFF_INTERVAL));
+	k_sem_init(&query->sem, 0, K_SEM_MAX_LIMIT);
+}
 
-again:
-	timeout_ms = k_ticks_to_ms_ceil32(timeout.ticks);
+/* Send the query, return 0 or the error status of the query */
+static int query_start(const char *host, struct getaddrinfo_query *query)
+{
+	int timeout_ms = k_ticks_to_ms_ceil32(query->timeout.ticks);
+	int ret;
 
 	NET_DBG("Timeout %d", timeout_ms);
 
-	ret = dns_get_addr_info(host, qtype, &ai_state->dns_id,
-				dns_resolve_cb, ai_state, timeout_ms);
+	ret = dns_get_addr_info(host, query->qtype, &query->dns_id,
+				dns_resolve_cb, query, timeout_ms);
 	if (ret == 0) {
+		return 0;
+	} else if (ret == -EPFNOSUPPORT) {
+		/* If we are returned -EPFNOSUPPORT then that will indicate
+		 * wrong address family type queried. Check that and return
+		 * DNS_EAI_ADDRFAMILY.
+		 */
+		return DNS_EAI_ADDRFAMILY;
+	}
+
+	errno = -ret;
+	return DNS_EAI_SYSTEM;
+}
+
+/* Wait for the results of a started query, retrying it until it times out */
+static int query_wait(const char *host, struct getaddrinfo_query *query)
+{
+	int timeout_ms;
+	int st, ret;
+
+	do {
+		timeout_ms = k_ticks_to_ms_ceil32(query->timeout.ticks);
+
 		/* If the DNS query for reason fails so that the
 		 * dns_resolve_cb() would not be called, then we want the
 		 * semaphore to timeout so that we will not hang forever.
 		 * So make the sem timeout longer than the DNS timeout so that
 		 * we do not need to start to cancel any pending DNS queries.
 		 */
-		ret = k_sem_take(&ai_state->sem, K_MSEC(timeout_ms + 100));
+		ret = k_sem_take(&query->sem, K_MSEC(timeout_ms + 100));
 		if (ret == -EAGAIN) {
-			if (!sys_timepoint_expired(end)) {
-				timeout = recalc_timeout(end, timeout);
-				goto again;
+			if (sys_timepoint_expired(query->end)) {
+				(void)dns_cancel_addr_info(query->dns_id);
+				return DNS_EAI_AGAIN;
 			}
+		} else if (query->status != DNS_EAI_CANCELED ||
+			   sys_timepoint_expired(query->end)) {
+			return query->status;
+		}
 
-			(void)dns_cancel_addr_info(ai_state->dns_id);
-			st = DNS_EAI_AGAIN;
-		} else {
-			if (ai_state->status == DNS_EAI_CANCELED) {
-				if (!sys_timepoint_expired(end)) {
-					timeout = recalc_timeout(end, timeout);
-					goto again;
-				}
-			}
+		query->timeout = recalc_timeout(query->end, query->timeout);
+		st = query_start(host, query);
+	} while (st == 0);
 
-			st = ai_state->status;
-		}
-	} else if (ret == -EPFNOSUPPORT) {
-		/* If we are returned -EPFNOSUPPORT then that will indicate
-		 * wrong address family type queried. Check that and return
-		 * DNS_EAI_ADDRFAMILY.
-		 */
-		st = DNS_EAI_ADDRFAMILY;
-	} else {
-		errno = -ret;
-		st = DNS_EAI_SYSTEM;
+	return st;
+}
+
+static int exec_query(const char *host, int family,
+		      struct getaddrinfo_state *ai_state)
+{
+	struct getaddrinfo_query query;
+	int st;
+
+	query_init(&query, family, ai_state);
+
+	st = query_start(host, &query);
+	if (st == 0) {
+		st = query_wait(host, &query);
 	}
 
 	return st;
 }
 
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+/* Run the A and AAAA queries at the same time */
+static void exec_query_parallel(const char *host, struct getaddrinfo_state *ai_state,
+				int *st4, int *st6)
+{
+	struct getaddrinfo_query query4, query6;
+	bool no_slot;
+
+	query_init(&query4, AF_INET, ai_state);
+	query_init(&query6, AF_INET6, ai_state);
+
+	*st4 = query_start(host, &query4);
+	*st6 = query_start(host, &query6);
+	no_slot = (*st6 == DNS_EAI_SYSTEM && errno == EAGAIN);
+
+	if (*st4 == 0) {
+		*st4 = query_wait(host, &query4);
+	}
+
+	if (no_slot) {
+		/* No free query slot, now that the A query is done */
+		*st6 = query_start(host, &query6);
+	}
+
+	if (*st6 == 0) {
+		*st6 = query_wait(host, &query6);
+	}
+}
+
+/* Interleave the address families of the results, IPv6 first, as
+ * recommended by RFC 8305 chapter 4.
+ */
+static void sort_results(struct getaddrinfo_state *ai_state)
+{
+	struct zsock_addrinfo tmp;
+	int family = AF_INET6;
+
+	for (uint16_t idx = 0; idx < ai_state->idx; idx++) {
+		uint16_t next = idx;
+
+		while (next < ai_state->idx && ai_state->ai_arr[next].ai_family != family) {
+			next++;
+		}
+
+		/* Move the next result of the wanted family to this position */
+		if (next < ai_state->idx && next != idx) {
+			tmp = ai_state->ai_arr[next];
+			memmove(&ai_state->ai_arr[idx + 1], &ai_state->ai_arr[idx],
+				(next - idx) * sizeof(tmp));
+			ai_state->ai_arr[idx] = tmp;
+		}
+
+		family = (ai_state->ai_arr[idx].ai_family == AF_INET6) ? AF_INET : AF_INET6;
+	}
+
+	for (uint16_t idx = 0; idx < ai_state->idx; idx++) {
+		struct zsock_addrinfo *ai = &ai_state->ai_arr[idx];
+
+		ai->ai_addr = &ai->_ai_addr;
+		ai->ai_canonname = ai->_ai_canonname;
+		ai->ai_next = (idx + 1 < ai_state->idx) ? &ai_state->ai_arr[idx + 1] : NULL;
+	}
+}
+#endif /* defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES) */
+
 static int getaddrinfo_null_host(int port, const struct zsock_addrinfo *hints,
 				struct zsock_addrinfo *res)
 {
@@ -263,8 +369,19 @@ int z_impl_z_zsock_getaddrinfo_internal(const char *host, const char *service,
 	ai_state.idx = 0U;
 	ai_state.port = htons(port);
 	ai_state.ai_arr = res;
-	ai_state.dns_id = 0;
-	k_sem_init(&ai_state.sem, 0, K_SEM_MAX_LIMIT);
+	k_mutex_init(&ai_state.lock);
+
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+	if (family == AF_UNSPEC) {
+		exec_query_parallel(host, &ai_state, &st1, &st2);
+		if (st1 == DNS_EAI_AGAIN && st2 == DNS_EAI_AGAIN) {
+			return st1;
+		}
+
+		sort_results(&ai_state);
+		goto done;
+	}
+#endif /* defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES) */
 
 	/* If family is AF_UNSPEC, then we query IPv4 address first
 	 * if IPv4 is enabled in the config.
@@ -286,6 +403,10 @@ int z_impl_z_zsock_getaddrinfo_internal(const char *host, const char *service,
 		}
 	}
 
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+done:
+#endif
+
 	for (uint16_t idx = 0; idx < ai_state.idx; idx++) {
 		ai_addr = &ai_state.ai_arr[idx]._ai_addr;
 		net_sin(ai_addr)->sin_port = htons(port);
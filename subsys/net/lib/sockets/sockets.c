@@ -710,6 +710,127 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* Send or receive a batch of messages with a single socket lookup */
+static int sock_mmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+		     int flags, bool recv)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int i;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if ((recv && vtable->recvmsg == NULL) ||
+	    (!recv && vtable->sendmsg == NULL)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t len;
+
+		if (recv) {
+			len = vtable->recvmsg(obj, &msgvec[i].msg_hdr, flags);
+			sock_obj_core_update_recv_stats(sock, len);
+			/* Only the first message is waited for */
+			flags |= ZSOCK_MSG_DONTWAIT;
+		} else {
+			len = vtable->sendmsg(obj, &msgvec[i].msg_hdr, flags);
+			sock_obj_core_update_send_stats(sock, len);
+		}
+
+		if (len < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = len;
+	}
+
+	k_mutex_unlock(lock);
+
+	/* An error after the first message only ends the batch, it is not
+	 * reported. The caller gets it when passing the remaining messages.
+	 */
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	return sock_mmsg(sock, msgvec, vlen, flags, false);
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	return sock_mmsg(sock, msgvec, vlen, flags, true);
+}
+
+#ifdef CONFIG_USERSPACE
+/* Every message is copied from and to user mode on its own */
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int i;
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t len = z_vrfy_zsock_sendmsg(sock, &msgvec[i].msg_hdr, flags);
+		unsigned int msg_len = len;
+
+		if (len < 0) {
+			break;
+		}
+
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &msg_len,
+					  sizeof(msg_len)));
+	}
+
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int i;
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t len = z_vrfy_zsock_recvmsg(sock, &msgvec[i].msg_hdr, flags);
+		unsigned int msg_len = len;
+
+		if (len < 0) {
+			break;
+		}
+
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &msg_len,
+					  sizeof(msg_len)));
+		flags |= ZSOCK_MSG_DONTWAIT;
+	}
+
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
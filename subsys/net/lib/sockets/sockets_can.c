@@ -272,12 +272,10 @@ ssize_t zcan_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	return len;
 }
 
-static ssize_t zcan_recvfrom_ctx(struct net_context *ctx, void *buf,
-				 size_t max_len, int flags,
-				 struct sockaddr *src_addr,
-				 socklen_t *addrlen)
+/* Get the next frame of the receive queue, returns the length of the frame */
+static ssize_t zcan_recv_frame(struct net_context *ctx, struct can_frame *zframe,
+			       int flags)
 {
-	struct can_frame zframe;
 	size_t recv_len = 0;
 	k_timeout_t timeout = K_FOREVER;
 	struct net_pkt *pkt;
@@ -324,26 +322,116 @@ static ssize_t zcan_recvfrom_ctx(struct net_context *ctx, void *buf,
 	 * the caller.
 	 */
 	recv_len = net_pkt_get_len(pkt);
-	if (recv_len > max_len) {
-		recv_len = max_len;
-	}
 
-	if (net_pkt_read(pkt, (void *)&zframe, sizeof(zframe))) {
+	if (net_pkt_read(pkt, (void *)zframe, sizeof(*zframe))) {
 		net_pkt_unref(pkt);
 
 		errno = EIO;
 		return -1;
 	}
 
+	net_pkt_unref(pkt);
+
+	return recv_len;
+}
+
+static ssize_t zcan_recvfrom_ctx(struct net_context *ctx, void *buf,
+				 size_t max_len, int flags,
+				 struct sockaddr *src_addr,
+				 socklen_t *addrlen)
+{
+	struct can_frame zframe;
+	ssize_t recv_len;
+
+	recv_len = zcan_recv_frame(ctx, &zframe, flags);
+	if (recv_len < 0) {
+		return -1;
+	}
+
+	if (recv_len > max_len) {
+		recv_len = max_len;
+	}
+
 	NET_ASSERT(recv_len == sizeof(struct socketcan_frame));
 
 	socketcan_from_can_frame(&zframe, (struct socketcan_frame *)buf);
 
-	net_pkt_unref(pkt);
-
 	return recv_len;
 }
 
+/*
+ * Receive one frame into the I/O vector of the message. Together with
+ * zsock_recvmmsg() this lets a reader drain a batch of frames per call.
+ */
+static ssize_t zcan_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
+				int flags)
+{
+	struct socketcan_frame sframe;
+	struct can_frame zframe;
+	size_t copied = 0;
+	ssize_t recv_len;
+
+	if (msg == NULL || (msg->msg_iovlen > 0 && msg->msg_iov == NULL)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	recv_len = zcan_recv_frame(ctx, &zframe, flags);
+	if (recv_len < 0) {
+		return -1;
+	}
+
+	socketcan_from_can_frame(&zframe, &sframe);
+	recv_len = MIN(recv_len, sizeof(sframe));
+
+	msg->msg_flags = 0;
+
+	for (size_t i = 0; i < msg->msg_iovlen && copied < recv_len; i++) {
+		size_t len = MIN(msg->msg_iov[i].iov_len, recv_len - copied);
+
+		memcpy(msg->msg_iov[i].iov_base, (uint8_t *)&sframe + copied, len);
+		copied += len;
+	}
+
+	if (copied < recv_len) {
+		msg->msg_flags |= ZSOCK_MSG_TRUNC;
+	}
+
+	if (msg->msg_name != NULL) {
+		struct sockaddr_can *can_addr = msg->msg_name;
+
+		if (msg->msg_namelen >= sizeof(struct sockaddr_can)) {
+			can_addr->can_family = AF_CAN;
+			can_addr->can_ifindex = net_if_get_by_iface(net_context_get_iface(ctx));
+			msg->msg_namelen = sizeof(struct sockaddr_can);
+		} else {
+			msg->msg_namelen = 0;
+		}
+	}
+
+	if (msg->msg_control != NULL) {
+#if defined(CONFIG_CAN_RX_TIMESTAMP)
+		if (msg->msg_controllen >= CMSG_SPACE(sizeof(zframe.timestamp))) {
+			struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg);
+
+			cmsg->cmsg_len = CMSG_LEN(sizeof(zframe.timestamp));
+			cmsg->cmsg_level = SOL_CAN_RAW;
+			cmsg->cmsg_type = CAN_RAW_RX_TIMESTAMP;
+			memcpy(CMSG_DATA(cmsg), &zframe.timestamp, sizeof(zframe.timestamp));
+
+			msg->msg_controllen = CMSG_SPACE(sizeof(zframe.timestamp));
+		} else {
+			msg->msg_flags |= ZSOCK_MSG_CTRUNC;
+			msg->msg_controllen = 0;
+		}
+#else
+		msg->msg_controllen = 0;
+#endif
+	}
+
+	return copied;
+}
+
 static int zcan_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 			       void *optval, socklen_t *optlen)
 {
@@ -363,6 +451,37 @@ static int zcan_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 					    optval, optlen);
 }
 
+static ssize_t zcan_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
+				int flags)
+{
+	struct socketcan_frame sframe;
+	size_t len = 0;
+
+	if (msg == NULL || (msg->msg_iovlen > 0 && msg->msg_iov == NULL)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* The frame may be split across the I/O vector */
+	for (size_t i = 0; i < msg->msg_iovlen; i++) {
+		if (msg->msg_iov[i].iov_len > sizeof(sframe) - len) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		memcpy((uint8_t *)&sframe + len, msg->msg_iov[i].iov_base,
+		       msg->msg_iov[i].iov_len);
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	if (len != sizeof(sframe)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return zcan_sendto_ctx(ctx, &sframe, len, flags, msg->msg_name, msg->msg_namelen);
+}
+
 static ssize_t can_sock_read_vmeth(void *obj, void *buffer, size_t count)
 {
 	return zcan_recvfrom_ctx(obj, buffer, count, 0, NULL, 0);
@@ -511,6 +630,17 @@ static ssize_t can_sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				 src_addr, addrlen);
 }
 
+static ssize_t can_sock_sendmsg_vmeth(void *obj, const struct msghdr *msg,
+				      int flags)
+{
+	return zcan_sendmsg_ctx(obj, msg, flags);
+}
+
+static ssize_t can_sock_recvmsg_vmeth(void *obj, struct msghdr *msg, int flags)
+{
+	return zcan_recvmsg_ctx(obj, msg, flags);
+}
+
 static int can_sock_getsockopt_vmeth(void *obj, int level, int optname,
 				     void *optval, socklen_t *optlen)
 {
@@ -721,6 +851,8 @@ static const struct socket_op_vtable can_sock_fd_op_vtable = {
 	.accept = can_sock_accept_vmeth,
 	.sendto = can_sock_sendto_vmeth,
 	.recvfrom = can_sock_recvfrom_vmeth,
+	.sendmsg = can_sock_sendmsg_vmeth,
+	.recvmsg = can_sock_recvmsg_vmeth,
 	.getsockopt = can_sock_getsockopt_vmeth,
 	.setsockopt = can_sock_setsockopt_vmeth,
 };
@@ -1077,13 +1077,50 @@ static int update_msg_controllen(struct msghdr *msg)
 	return 0;
 }
 
+/* Point the I/O vectors of msg to the payload of pkt, from its cursor on */
+static size_t zc_reference_payload(struct net_pkt *pkt, struct msghdr *msg,
+				   size_t len)
+{
+	struct net_buf *frag = pkt->cursor.buf;
+	uint8_t *pos = pkt->cursor.pos;
+	size_t ref_len = 0;
+	size_t iovec = 0;
+
+	while (frag != NULL && ref_len < len) {
+		size_t frag_len = MIN((size_t)(frag->len - (pos - frag->data)),
+				      len - ref_len);
+
+		if (frag_len > 0) {
+			if (iovec == msg->msg_iovlen) {
+				break;
+			}
+
+			msg->msg_iov[iovec].iov_base = pos;
+			msg->msg_iov[iovec].iov_len = frag_len;
+			ref_len += frag_len;
+			iovec++;
+		}
+
+		frag = frag->frags;
+		pos = (frag != NULL) ? frag->data : NULL;
+	}
+
+	msg->msg_iovlen = iovec;
+
+	return ref_len;
+}
+
+/* With zc_pkt set, the payload is referenced from msg instead of being
+ * copied, and the packet handed over to the caller.
+ */
 static ssize_t zsock_recv_dgram(struct net_context *ctx,
 				struct msghdr *msg,
 				void *buf,
 				size_t max_len,
 				int flags,
 				struct sockaddr *src_addr,
-				socklen_t *addrlen)
+				socklen_t *addrlen,
+				struct net_pkt **zc_pkt)
 {
 	k_timeout_t timeout = K_FOREVER;
 	size_t recv_len = 0;
@@ -1163,7 +1200,14 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 		}
 	}
 
-	if (msg != NULL) {
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_RECV_ZEROCOPY) && zc_pkt != NULL) {
+		recv_len = net_pkt_remaining_data(pkt);
+		read_len = zc_reference_payload(pkt, msg, recv_len);
+
+		if (recv_len != read_len) {
+			msg->msg_flags |= ZSOCK_MSG_TRUNC;
+		}
+	} else if (msg != NULL) {
 		int iovec = 0;
 		size_t tmp_read_len;
 
@@ -1249,7 +1293,9 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
 	}
 
-	if (!(flags & ZSOCK_MSG_PEEK)) {
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_RECV_ZEROCOPY) && zc_pkt != NULL) {
+		*zc_pkt = (flags & ZSOCK_MSG_PEEK) ? net_pkt_ref(pkt) : pkt;
+	} else if (!(flags & ZSOCK_MSG_PEEK)) {
 		net_pkt_unref(pkt);
 	} else {
 		net_pkt_cursor_restore(pkt, &backup);
@@ -1484,7 +1530,8 @@ ssize_t zsock_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 	}
 
 	if (sock_type == SOCK_DGRAM || sock_type == SOCK_RAW) {
-		return zsock_recv_dgram(ctx, NULL, buf, max_len, flags, src_addr, addrlen);
+		return zsock_recv_dgram(ctx, NULL, buf, max_len, flags, src_addr, addrlen,
+					NULL);
 	} else if (sock_type == SOCK_STREAM) {
 		return zsock_recv_stream(ctx, NULL, buf, max_len, flags);
 	}
@@ -1518,7 +1565,7 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 
 	if (sock_type == SOCK_DGRAM || sock_type == SOCK_RAW) {
 		return zsock_recv_dgram(ctx, msg, NULL, max_len, flags,
-					msg->msg_name, &msg->msg_namelen);
+					msg->msg_name, &msg->msg_namelen, NULL);
 	} else if (sock_type == SOCK_STREAM) {
 		return zsock_recv_stream(ctx, msg, NULL, max_len, flags);
 	}
@@ -3107,6 +3154,58 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.getsockname = sock_getsockname_vmeth,
 };
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+ssize_t zsock_recvmsg_zc(int sock, struct msghdr *msg, int flags, void **ref)
+{
+	const struct fd_op_vtable *vtable;
+	enum net_sock_type sock_type;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (msg == NULL || ref == NULL ||
+	    (flags & ~(ZSOCK_MSG_DONTWAIT | ZSOCK_MSG_PEEK)) != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (msg->msg_iov == NULL || msg->msg_iovlen < 1) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ctx = zvfs_get_fd_obj_and_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	/* Offloaded and TLS sockets have their own vtable */
+	sock_type = net_context_get_type(ctx);
+	if (vtable != &sock_fd_op_vtable.fd_vtable ||
+	    (sock_type != SOCK_DGRAM && sock_type != SOCK_RAW)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_recv_dgram(ctx, msg, NULL, 0, flags, msg->msg_name,
+			       &msg->msg_namelen, (struct net_pkt **)ref);
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_recv_stats(sock, ret);
+
+	return ret;
+}
+
+void zsock_recv_zc_release(void *ref)
+{
+	net_pkt_unref(ref);
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZEROCOPY */
+
 static bool inet_is_supported(int family, int type, int proto)
 {
 	if (family != AF_INET && family != AF_INET6) {
@@ -10,7 +10,7 @@ LOG_MODULE_REGISTER(net_sock_svc, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/net/socket_service.h>
-#include <zephyr/zvfs/eventfd.h>
+#include <zephyr/zvfs/epoll.h>
 
 static int init_socket_service(void);
 
@@ -28,12 +28,24 @@ static K_CONDVAR_DEFINE(wait_start);
 STRUCT_SECTION_START_EXTERN(net_socket_service_desc);
 STRUCT_SECTION_END_EXTERN(net_socket_service_desc);
 
+#define MAX_NAME_LEN sizeof("net_socket_service[x]")
+
+/* Dispatcher thread, handling every CONFIG_NET_SOCKETS_SERVICE_THREADS-th service */
 static struct service {
-	struct zsock_pollfd events[CONFIG_ZVFS_POLL_MAX];
-	int count;
-} ctx;
+	/* Set of the sockets of the services of the thread */
+	int epfd;
+	struct zvfs_epoll_event events[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	struct k_thread thread;
+} ctx[CONFIG_NET_SOCKETS_SERVICE_THREADS];
+
+/* Dispatcher threads actually started, there are no more than services */
+static int thread_count;
+static int threads_running;
 
-#define get_idx(svc) (*(svc->idx))
+static struct service *get_dispatcher(const struct net_socket_service_desc *svc)
+{
+	return &ctx[(svc - STRUCT_SECTION_START(net_socket_service_desc)) % thread_count];
+}
 
 void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 {
@@ -44,12 +56,42 @@ void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 
 static void cleanup_svc_events(const struct net_socket_service_desc *svc)
 {
+	struct service *dispatcher = get_dispatcher(svc);
+
 	for (int i = 0; i < svc->pev_len; i++) {
+		if (svc->pev[i].event.fd >= 0) {
+			(void)zvfs_epoll_ctl(dispatcher->epfd, ZVFS_EPOLL_CTL_DEL,
+					     svc->pev[i].event.fd, NULL);
+		}
+
 		svc->pev[i].event.fd = -1;
 		svc->pev[i].event.events = 0;
 	}
 }
 
+static int add_svc_event(struct service *dispatcher, struct net_socket_service_event *pev)
+{
+	struct zvfs_epoll_event event = {
+		.events = pev->event.events,
+		.data.ptr = pev,
+	};
+
+	if (pev->event.fd < 0) {
+		return 0;
+	}
+
+	if (zvfs_epoll_ctl(dispatcher->epfd, ZVFS_EPOLL_CTL_ADD, pev->event.fd, &event) < 0) {
+		/* The socket is already monitored by another service */
+		if (errno == EEXIST) {
+			return 0;
+		}
+
+		return -errno;
+	}
+
+	return 0;
+}
+
 int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc,
 				       struct zsock_pollfd *fds, int len,
 				       void *user_data)
@@ -60,7 +102,9 @@ int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc
 
 	if (thread_status == SOCKET_SERVICE_THREAD_UNINITIALIZED) {
 		(void)k_condvar_wait(&wait_start, &lock, K_FOREVER);
-	} else if (thread_status != SOCKET_SERVICE_THREAD_RUNNING) {
+	}
+
+	if (thread_status != SOCKET_SERVICE_THREAD_RUNNING) {
 		NET_ERR("Socket service thread not running, service %p register fails.", svc);
 		ret = -EIO;
 		goto out;
@@ -85,11 +129,19 @@ int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc
 		for (i = 0; i < len; i++) {
 			svc->pev[i].event = fds[i];
 			svc->pev[i].user_data = user_data;
+			svc->pev[i].svc = (struct net_socket_service_desc *)svc;
+
+			/* The thread is woken up to wait for the new socket */
+			ret = add_svc_event(get_dispatcher(svc), &svc->pev[i]);
+			if (ret < 0) {
+				NET_DBG("Cannot monitor socket %d of service %p (%d)",
+					fds[i].fd, svc, ret);
+				cleanup_svc_events(svc);
+				goto out;
+			}
 		}
 	}
 
-	/* Tell the thread to re-read the variables */
-	zvfs_eventfd_write(ctx.events[0].fd, 1);
 	ret = 0;
 
 out:
@@ -98,26 +150,8 @@ out:
 	return ret;
 }
 
-static struct net_socket_service_desc *find_svc_and_event(
-	struct zsock_pollfd *pev,
-	struct net_socket_service_event **event)
-{
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int i = 0; i < svc->pev_len; i++) {
-			if (svc->pev[i].event.fd == pev->fd) {
-				*event = &svc->pev[i];
-				return svc;
-			}
-		}
-	}
-
-	return NULL;
-}
-
-/* We do not set the user callback to our work struct because we need to
- * hook into the flow and restore the global poll array so that the next poll
- * round will not notice it and call the callback again while we are
- * servicing the callback.
+/* The callback is given a copy of the event, so that it can register the
+ * service again, and so change the event, while being called.
  */
 void net_socket_service_callback(struct net_socket_service_event *pev)
 {
@@ -126,141 +160,87 @@ void net_socket_service_callback(struct net_socket_service_event *pev)
 	ev.callback(&ev);
 }
 
-static int call_work(struct zsock_pollfd *pev, struct net_socket_service_event *event)
+static void trigger_work(struct net_socket_service_event *event, uint32_t revents)
 {
-	int ret = 0;
-	int fd = pev->fd;
-
-	/* Mark the global fd non pollable so that we do not
-	 * call the callback second time.
-	 */
-	pev->fd = -1;
-
-	/* Synchronous call */
-	net_socket_service_callback(event);
-
-	/* Restore the fd so that new data can be re-triggered */
-	pev->fd = fd;
-
-	return ret;
-}
-
-static int trigger_work(struct zsock_pollfd *pev)
-{
-	struct net_socket_service_event *event;
-	struct net_socket_service_desc *svc;
-
-	svc = find_svc_and_event(pev, &event);
-	if (svc == NULL) {
-		return -ENOENT;
+	/* The service might have been unregistered meanwhile */
+	if (event->event.fd < 0) {
+		return;
 	}
 
-	event->svc = svc;
-
 	/* Copy the triggered event to our event so that we know what
 	 * was actually causing the event.
 	 */
-	event->event = *pev;
+	event->event.revents = revents;
 
-	return call_work(pev, event);
+	/* Synchronous call */
+	net_socket_service_callback(event);
 }
 
-static void socket_service_thread(void)
+static void socket_service_thread(void *p1, void *p2, void *p3)
 {
-	int ret, i, fd, count = 0;
-	zvfs_eventfd_t value;
+	struct service *dispatcher = p1;
+	int ret, fd, count = 0;
 
-	STRUCT_SECTION_COUNT(net_socket_service_desc, &ret);
-	if (ret == 0) {
-		NET_INFO("No socket services found, service disabled.");
-		goto fail;
-	}
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
 
-	/* Create contiguous poll event array to enable socket polling */
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
+		if (get_dispatcher(svc) != dispatcher) {
+			continue;
+		}
+
 		NET_DBG("Service %s has %d pollable sockets",
 			COND_CODE_1(CONFIG_NET_SOCKETS_LOG_LEVEL_DBG,
 				    (svc->owner), ("")),
 			svc->pev_len);
-		get_idx(svc) = count + 1;
 		count += svc->pev_len;
 	}
 
-	if ((count + 1) > ARRAY_SIZE(ctx.events)) {
+	if (count > CONFIG_ZVFS_EPOLL_MAX_FDS) {
 		NET_ERR("You have %d services to monitor but "
-			"%zd poll entries configured.",
-			count + 1, ARRAY_SIZE(ctx.events));
+			"%d epoll entries configured.",
+			count, CONFIG_ZVFS_EPOLL_MAX_FDS);
 		NET_ERR("Please increase value of %s to at least %d",
-			"CONFIG_ZVFS_POLL_MAX", count + 1);
+			"CONFIG_ZVFS_EPOLL_MAX_FDS", count);
 		goto fail;
 	}
 
 	NET_DBG("Monitoring %d socket entries", count);
 
-	ctx.count = count + 1;
-
-	/* Create an zvfs_eventfd that can be used to trigger events during polling */
-	fd = zvfs_eventfd(0, 0);
+	/* The services add their sockets to this set when registering */
+	fd = zvfs_epoll_create();
 	if (fd < 0) {
 		fd = -errno;
-		NET_ERR("zvfs_eventfd failed (%d)", fd);
-		goto out;
+		NET_ERR("zvfs_epoll_create failed (%d)", fd);
+		goto fail;
 	}
 
-	thread_status = SOCKET_SERVICE_THREAD_RUNNING;
-	k_condvar_broadcast(&wait_start);
-
-	ctx.events[0].fd = fd;
-	ctx.events[0].events = ZSOCK_POLLIN;
-
-restart:
-	i = 1;
+	dispatcher->epfd = fd;
 
 	k_mutex_lock(&lock, K_FOREVER);
 
-	/* Copy individual events to the big array */
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int j = 0; j < svc->pev_len; j++) {
-			ctx.events[get_idx(svc) + j] = svc->pev[j].event;
-		}
+	/* The services can register once all the threads are ready */
+	if (++threads_running == thread_count &&
+	    thread_status == SOCKET_SERVICE_THREAD_UNINITIALIZED) {
+		thread_status = SOCKET_SERVICE_THREAD_RUNNING;
+		k_condvar_broadcast(&wait_start);
 	}
 
 	k_mutex_unlock(&lock);
 
 	while (true) {
-		ret = zsock_poll(ctx.events, count + 1, -1);
+		ret = zvfs_epoll_wait(dispatcher->epfd, dispatcher->events,
+				      ARRAY_SIZE(dispatcher->events), -1);
 		if (ret < 0) {
 			ret = -errno;
-			NET_ERR("poll failed (%d)", ret);
+			NET_ERR("epoll wait failed (%d)", ret);
 			goto out;
 		}
 
-		if (ret == 0) {
-			/* should not happen because timeout is -1 */
-			break;
-		}
-
-		/* Process work here */
-		for (i = 1; i < (count + 1); i++) {
-			if (ctx.events[i].fd < 0) {
-				continue;
-			}
-
-			if (ctx.events[i].revents > 0) {
-				ret = trigger_work(&ctx.events[i]);
-				if (ret < 0) {
-					NET_DBG("Triggering work failed (%d)", ret);
-					goto restart;
-				}
-			}
-		}
-
-		/* Relocate after trigger work so the work gets done before restarting */
-		if (ret > 0 && ctx.events[0].revents) {
-			zvfs_eventfd_read(ctx.events[0].fd, &value);
-			ctx.events[0].revents = 0;
-			NET_DBG("Received restart event.");
-			goto restart;
+		/* Process work here, only the ready sockets are returned */
+		for (int i = 0; i < ret; i++) {
+			trigger_work(dispatcher->events[i].data.ptr,
+				     dispatcher->events[i].events);
 		}
 	}
 
@@ -271,27 +251,60 @@ out:
 	return;
 
 fail:
+	k_mutex_lock(&lock, K_FOREVER);
 	thread_status = SOCKET_SERVICE_THREAD_FAILED;
 	k_condvar_broadcast(&wait_start);
+	k_mutex_unlock(&lock);
 }
 
 static int init_socket_service(void)
 {
+	static K_THREAD_STACK_ARRAY_DEFINE(service_thread_stack,
+					   CONFIG_NET_SOCKETS_SERVICE_THREADS,
+					   CONFIG_NET_SOCKETS_SERVICE_STACK_SIZE);
 	k_tid_t ssm;
-	static struct k_thread service_thread;
+	int count;
 
-	static K_THREAD_STACK_DEFINE(service_thread_stack,
-				     CONFIG_NET_SOCKETS_SERVICE_STACK_SIZE);
+	STRUCT_SECTION_COUNT(net_socket_service_desc, &count);
+	if (count == 0) {
+		NET_INFO("No socket services found, service disabled.");
+		thread_status = SOCKET_SERVICE_THREAD_FAILED;
+		k_condvar_broadcast(&wait_start);
+		return 0;
+	}
 
-	ssm = k_thread_create(&service_thread,
-			      service_thread_stack,
-			      K_THREAD_STACK_SIZEOF(service_thread_stack),
-			      (k_thread_entry_t)socket_service_thread, NULL, NULL, NULL,
-			      CLAMP(CONFIG_NET_SOCKETS_SERVICE_THREAD_PRIO,
-				    K_HIGHEST_APPLICATION_THREAD_PRIO,
-				    K_LOWEST_APPLICATION_THREAD_PRIO), 0, K_NO_WAIT);
+	thread_count = MIN(count, CONFIG_NET_SOCKETS_SERVICE_THREADS);
 
-	k_thread_name_set(ssm, "net_socket_service");
+	for (int i = 0; i < thread_count; i++) {
+		ssm = k_thread_create(&ctx[i].thread,
+				      service_thread_stack[i],
+				      K_THREAD_STACK_SIZEOF(service_thread_stack[i]),
+				      socket_service_thread, &ctx[i], NULL, NULL,
+				      CLAMP(CONFIG_NET_SOCKETS_SERVICE_THREAD_PRIO,
+					    K_HIGHEST_APPLICATION_THREAD_PRIO,
+					    K_LOWEST_APPLICATION_THREAD_PRIO), 0, K_FOREVER);
+
+		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
+			char name[MAX_NAME_LEN];
+
+			if (thread_count > 1) {
+				snprintk(name, sizeof(name), "net_socket_service[%d]", i);
+			} else {
+				snprintk(name, sizeof(name), "net_socket_service");
+			}
+
+			k_thread_name_set(ssm, name);
+		}
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+		/* Spread the dispatcher threads over the CPUs */
+		if (thread_count > 1) {
+			(void)k_thread_cpu_pin(ssm, i % arch_num_cpus());
+		}
+#endif
+
+		k_thread_start(ssm);
+	}
 
 	return 0;
 }
@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 
 #include <zephyr/init.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/random/random.h>
 #include <zephyr/internal/syscall_handler.h>
@@ -68,6 +69,8 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #define DTLS_SENDMSG_BUF_SIZE 0
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#define TLS_SENDMSG_BUF_SIZE (CONFIG_NET_SOCKETS_TLS_SENDMSG_BUF_SIZE)
+
 static const struct socket_op_vtable tls_sock_fd_op_vtable;
 
 #ifndef MBEDTLS_ERR_SSL_PEER_VERIFY_FAILED
@@ -225,6 +228,20 @@ __net_socket struct tls_context {
 
 	/** DTLS peer address length. */
 	socklen_t dtls_peer_addrlen;
+
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	/** New DTLS peer address, used once a record from it is authenticated. */
+	struct sockaddr dtls_pending_addr;
+
+	/** New DTLS peer address length, 0 if none. */
+	socklen_t dtls_pending_addrlen;
+
+	/** Epoch and sequence number of the last received DTLS record. */
+	uint64_t dtls_rx_seq;
+
+	/** Highest epoch and sequence number of an authenticated DTLS record. */
+	uint64_t dtls_auth_seq;
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
 #if defined(CONFIG_MBEDTLS)
@@ -854,6 +871,46 @@ static void dtls_peer_address_get(struct tls_context *context,
 	*addrlen = len;
 }
 
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+/* Record header: type, version, epoch, sequence number, CID, length */
+#define DTLS_CID_RECORD_HDR_MIN_LEN 13
+
+static bool dtls_is_cid_record(const unsigned char *buf, size_t len)
+{
+	return len >= DTLS_CID_RECORD_HDR_MIN_LEN && buf[0] == MBEDTLS_SSL_MSG_CID;
+}
+
+static uint64_t dtls_record_seq(const unsigned char *buf, size_t len)
+{
+	/* 16-bit epoch followed by 48-bit sequence number */
+	if (len < DTLS_CID_RECORD_HDR_MIN_LEN) {
+		return 0;
+	}
+
+	return sys_get_be64(&buf[3]);
+}
+
+/*
+ * Follow the peer to a new address, RFC 9146, section 6. Records with a
+ * connection ID received from another address are passed to mbed TLS, but
+ * the address is only switched to once the record was authenticated, i.e.
+ * mbedtls_ssl_read() returned its data, and if it is newer than any record
+ * authenticated so far.
+ */
+static void dtls_peer_address_update(struct tls_context *context)
+{
+	if (context->dtls_pending_addrlen != 0 &&
+	    context->dtls_rx_seq > context->dtls_auth_seq) {
+		NET_DBG("DTLS peer address changed");
+		dtls_peer_address_set(context, &context->dtls_pending_addr,
+				      context->dtls_pending_addrlen);
+	}
+
+	context->dtls_pending_addrlen = 0;
+	context->dtls_auth_seq = MAX(context->dtls_auth_seq, context->dtls_rx_seq);
+}
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 static int dtls_tx(void *ctx, const unsigned char *buf, size_t len)
 {
 	struct tls_context *tls_ctx = ctx;
@@ -909,9 +966,25 @@ static int dtls_rx(void *ctx, unsigned char *buf, size_t len)
 			return MBEDTLS_ERR_SSL_PEER_VERIFY_FAILED;
 		}
 	} else if (!dtls_is_peer_addr_valid(tls_ctx, &addr, addrlen)) {
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+		if (dtls_is_cid_record(buf, received) && addrlen <= sizeof(addr)) {
+			/* Possibly the same peer behind a new NAT binding */
+			memcpy(&tls_ctx->dtls_pending_addr, &addr, addrlen);
+			tls_ctx->dtls_pending_addrlen = addrlen;
+			tls_ctx->dtls_rx_seq = dtls_record_seq(buf, received);
+
+			return received;
+		}
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 		return MBEDTLS_ERR_SSL_WANT_READ;
 	}
 
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	tls_ctx->dtls_pending_addrlen = 0;
+	tls_ctx->dtls_rx_seq = dtls_record_seq(buf, received);
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 	return received;
 }
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
@@ -1185,6 +1258,12 @@ static int tls_mbedtls_reset(struct tls_context *context)
 			     sizeof(context->dtls_peer_addr));
 		context->dtls_peer_addrlen = 0;
 	}
+
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	context->dtls_pending_addrlen = 0;
+	context->dtls_rx_seq = 0;
+	context->dtls_auth_seq = 0;
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
 #endif
 
 	return 0;
@@ -2558,6 +2637,78 @@ static ssize_t dtls_sendmsg_merge_and_send(struct tls_context *ctx,
 	return len;
 }
 
+static ssize_t tls_sendmsg_merge_and_send(struct tls_context *ctx,
+					  const struct msghdr *msg,
+					  int flags)
+{
+	static K_MUTEX_DEFINE(sendmsg_lock);
+	static uint8_t sendmsg_buf[TLS_SENDMSG_BUF_SIZE];
+	size_t max_len = sizeof(sendmsg_buf);
+	size_t iov_idx = 0;
+	size_t iov_off = 0;
+	ssize_t len = 0;
+	ssize_t ret = 0;
+
+	/* Never exceed one record per write, so that mbedtls_ssl_write() does
+	 * not split the buffer, and a retry after EAGAIN with the remaining data
+	 * rebuilds the same record.
+	 */
+	if (ctx->is_initialized) {
+		int max_payload = mbedtls_ssl_get_max_out_record_payload(&ctx->ssl);
+
+		if (max_payload > 0) {
+			max_len = MIN(max_len, (size_t)max_payload);
+		}
+	}
+
+	k_mutex_lock(&sendmsg_lock, K_FOREVER);
+
+	while (true) {
+		size_t buf_len = 0;
+		size_t sent = 0;
+
+		while (iov_idx < msg->msg_iovlen && buf_len < max_len) {
+			struct iovec *vec = msg->msg_iov + iov_idx;
+			size_t chunk = MIN(vec->iov_len - iov_off, max_len - buf_len);
+
+			memcpy(sendmsg_buf + buf_len, (uint8_t *)vec->iov_base + iov_off, chunk);
+			buf_len += chunk;
+			iov_off += chunk;
+
+			if (iov_off == vec->iov_len) {
+				iov_idx++;
+				iov_off = 0;
+			}
+		}
+
+		if (buf_len == 0) {
+			break;
+		}
+
+		while (sent < buf_len) {
+			ret = ztls_sendto_ctx(ctx, sendmsg_buf + sent, buf_len - sent,
+					      flags, msg->msg_name,
+					      msg->msg_namelen);
+			if (ret < 0) {
+				goto out;
+			}
+
+			sent += ret;
+			len += ret;
+		}
+	}
+
+out:
+	k_mutex_unlock(&sendmsg_lock);
+
+	/* Report partial progress, the error is reported by the next call */
+	if (ret < 0 && len == 0) {
+		return ret;
+	}
+
+	return len;
+}
+
 static ssize_t tls_sendmsg_loop_and_send(struct tls_context *ctx,
 					 const struct msghdr *msg,
 					 int flags)
@@ -2622,6 +2773,11 @@ ssize_t ztls_sendmsg_ctx(struct tls_context *ctx, const struct msghdr *msg,
 		}
 	}
 
+	if (TLS_SENDMSG_BUF_SIZE > 0 && ctx->type == SOCK_STREAM &&
+	    msghdr_non_empty_iov_count(msg) > 1) {
+		return tls_sendmsg_merge_and_send(ctx, msg, flags);
+	}
+
 send_loop:
 	return tls_sendmsg_loop_and_send(ctx, msg, flags);
 }
@@ -2796,6 +2952,10 @@ static ssize_t recvfrom_dtls_common(struct tls_context *ctx, void *buf,
 			}
 		}
 
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+		dtls_peer_address_update(ctx);
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 		if (src_addr && addrlen) {
 			dtls_peer_address_get(ctx, src_addr, addrlen);
 		}
@@ -652,6 +652,38 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* XOR the masking key over data located at offset within the frame payload,
+ * one machine word at a time once the data pointer is aligned.
+ */
+static void websocket_mask(uint8_t *data, size_t len, uint32_t masking_value,
+			   uint64_t offset)
+{
+	uint8_t key[sizeof(uintptr_t)];
+	uintptr_t word_key;
+	size_t i = 0;
+
+	while (i < len && !IS_ALIGNED(&data[i], sizeof(uintptr_t))) {
+		data[i] ^= masking_value >> (8 * (3 - (offset + i) % 4));
+		i++;
+	}
+
+	if (len - i >= sizeof(uintptr_t)) {
+		for (size_t j = 0; j < sizeof(key); j++) {
+			key[j] = masking_value >> (8 * (3 - (offset + i + j) % 4));
+		}
+
+		memcpy(&word_key, key, sizeof(word_key));
+
+		for (; len - i >= sizeof(uintptr_t); i += sizeof(uintptr_t)) {
+			*(uintptr_t *)&data[i] ^= word_key;
+		}
+	}
+
+	for (; i < len; i++) {
+		data[i] ^= masking_value >> (8 * (3 - (offset + i) % 4));
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -721,8 +753,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -737,10 +767,7 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 			}
 
 			memcpy(data_to_send, payload, payload_len);
-
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+			websocket_mask(data_to_send, payload_len, ctx->masking_value, 0);
 		}
 	}
 
@@ -976,16 +1003,27 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 #endif /* CONFIG_NET_TEST */
 
 	do {
-		size_t parsed_count;
+		size_t parsed_count = 0;
+		bool direct = false;
 
 		if (ctx->recv_buf.count == 0) {
+			uint8_t *dst = ctx->recv_buf.buf;
+			size_t dst_len = ctx->recv_buf.size;
+
+			/* Payload needs no parsing, receive it directly into the
+			 * caller buffer instead of copying it from recv_buf.
+			 */
+			if (ctx->parser_state == WEBSOCKET_PARSER_STATE_PAYLOAD) {
+				direct = true;
+				dst = &payload.buf[payload.count];
+				dst_len = MIN(payload.size - payload.count, ctx->parser_remaining);
+			}
 #if defined(CONFIG_NET_TEST)
-			size_t input_len = MIN(ctx->recv_buf.size,
+			size_t input_len = MIN(dst_len,
 					       test_data->input_len - test_data->input_pos);
 
 			if (input_len > 0) {
-				memcpy(ctx->recv_buf.buf,
-				       &test_data->input_buf[test_data->input_pos], input_len);
+				memcpy(dst, &test_data->input_buf[test_data->input_pos], input_len);
 				test_data->input_pos += input_len;
 				ret = input_len;
 			} else {
@@ -997,8 +1035,8 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 			ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
 			if (ret == 0) {
-				ret = zsock_recv(ctx->real_sock, ctx->recv_buf.buf,
-						 ctx->recv_buf.size, ZSOCK_MSG_DONTWAIT);
+				ret = zsock_recv(ctx->real_sock, dst, dst_len,
+						 ZSOCK_MSG_DONTWAIT);
 				if (ret < 0) {
 					ret = -errno;
 				}
@@ -1018,16 +1056,26 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 				return -ENOTCONN;
 			}
 
-			ctx->recv_buf.count = ret;
-
 			NET_DBG("[%p] Received %d bytes", ctx, ret);
+
+			if (direct) {
+				payload.count += ret;
+				ctx->parser_remaining -= ret;
+				if (ctx->parser_remaining == 0) {
+					ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
+				}
+			} else {
+				ctx->recv_buf.count = ret;
+			}
 		}
 
-		ret = websocket_parse(ctx, &payload);
-		if (ret < 0) {
-			return ret;
+		if (!direct) {
+			ret = websocket_parse(ctx, &payload);
+			if (ret < 0) {
+				return ret;
+			}
+			parsed_count = ret;
 		}
-		parsed_count = ret;
 
 		if ((ctx->parser_state == WEBSOCKET_PARSER_STATE_OPCODE) ||
 		    (payload.count >= payload.size)) {
@@ -1053,15 +1101,8 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
-		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
-
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask(payload.buf, payload.count, ctx->masking_value,
+			       ctx->message_len - ctx->parser_remaining - payload.count);
 	}
 
 	return payload.count;
@@ -278,6 +278,34 @@ uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps)
 			  (rate_in_kbps * 1024U));
 }
 
+#if defined(CONFIG_NET_ZPERF_CPU_USAGE)
+void zperf_cpu_usage_start(struct zperf_cpu_usage *usage)
+{
+	k_thread_runtime_stats_t stats;
+
+	(void)k_thread_runtime_stats_all_get(&stats);
+
+	usage->busy_cycles = stats.total_cycles;
+	usage->all_cycles = stats.execution_cycles;
+}
+
+/* Non-idle share of the cycles elapsed since zperf_cpu_usage_start(), in 0.1 % */
+uint32_t zperf_cpu_usage_get(const struct zperf_cpu_usage *usage)
+{
+	k_thread_runtime_stats_t stats;
+	uint64_t all;
+
+	(void)k_thread_runtime_stats_all_get(&stats);
+
+	all = stats.execution_cycles - usage->all_cycles;
+	if (all == 0U) {
+		return 0;
+	}
+
+	return (uint32_t)(((stats.total_cycles - usage->busy_cycles) * 1000U) / all);
+}
+#endif /* CONFIG_NET_ZPERF_CPU_USAGE */
+
 void zperf_async_work_submit(enum session_proto proto, int session_id, struct k_work *work)
 {
 #if defined(CONFIG_ZPERF_SESSION_PER_THREAD)
@@ -133,6 +133,28 @@ int zperf_prepare_upload_sock(const struct sockaddr *peer_addr, uint8_t tos,
 
 uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps);
 
+struct zperf_cpu_usage {
+	uint64_t busy_cycles;
+	uint64_t all_cycles;
+};
+
+#if defined(CONFIG_NET_ZPERF_CPU_USAGE)
+void zperf_cpu_usage_start(struct zperf_cpu_usage *usage);
+uint32_t zperf_cpu_usage_get(const struct zperf_cpu_usage *usage);
+#else
+static inline void zperf_cpu_usage_start(struct zperf_cpu_usage *usage)
+{
+	ARG_UNUSED(usage);
+}
+
+static inline uint32_t zperf_cpu_usage_get(const struct zperf_cpu_usage *usage)
+{
+	ARG_UNUSED(usage);
+
+	return 0;
+}
+#endif /* CONFIG_NET_ZPERF_CPU_USAGE */
+
 void zperf_async_work_submit(enum session_proto proto, int session_id, struct k_work *work);
 void zperf_udp_uploader_init(void);
 void zperf_tcp_uploader_init(void);
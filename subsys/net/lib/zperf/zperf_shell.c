@@ -489,6 +489,15 @@ static int cmd_udp_download(const struct shell *sh, size_t argc,
 
 #endif
 
+static void shell_print_cpu_usage(const struct shell *sh,
+				  const struct zperf_results *results)
+{
+	if (IS_ENABLED(CONFIG_NET_ZPERF_CPU_USAGE)) {
+		shell_fprintf(sh, SHELL_NORMAL, "CPU usage:\t\t%u.%u %%\n",
+			      results->cpu_usage / 10U, results->cpu_usage % 10U);
+	}
+}
+
 static void shell_udp_upload_print_stats(const struct shell *sh,
 					 struct zperf_results *results,
 					 bool is_async)
@@ -551,6 +560,7 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "\t(");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, ")\n");
+		shell_print_cpu_usage(sh, results);
 
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		if (is_async) {
@@ -608,6 +618,7 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t\t");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+		shell_print_cpu_usage(sh, results);
 
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		if (is_async) {
@@ -662,6 +673,7 @@ static void shell_tcp_upload_print_periodic(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "Rate: ");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+		shell_print_cpu_usage(sh, results);
 	}
 }
 
@@ -1574,6 +1586,7 @@ struct zperf_shell_user_data {
 	void *user_data;
 	int in_progress_count;
 	int finalized_count;
+	uint64_t total_kbps;
 	bool active;
 };
 
@@ -1679,6 +1692,13 @@ static void session_all_cb(struct session *ses,
 			shell_tcp_upload_print_stats(sh, &ses->result, true);
 		}
 
+		if (ses->result.client_time_in_us != 0U) {
+			data->total_kbps +=
+				((uint64_t)ses->result.nb_packets_sent *
+				 ses->result.packet_size * 8U * USEC_PER_SEC) /
+				(ses->result.client_time_in_us * 1000U);
+		}
+
 		data->finalized_count++;
 	}
 }
@@ -1758,6 +1778,7 @@ static int cmd_jobs_all(const struct shell *sh, size_t argc, char *argv[])
 	user_data.sh = sh;
 	user_data.in_progress_count = 0;
 	user_data.finalized_count = 0;
+	user_data.total_kbps = 0;
 	user_data.active = false;
 
 	zperf_session_foreach(SESSION_UDP, session_all_cb, &user_data);
@@ -1773,6 +1794,9 @@ static int cmd_jobs_all(const struct shell *sh, size_t argc, char *argv[])
 		shell_fprintf(sh, SHELL_NORMAL,
 			      "Total %d sessions done\n",
 			      user_data.finalized_count);
+		shell_fprintf(sh, SHELL_NORMAL, "Aggregate client rate:\t");
+		print_number(sh, (uint32_t)user_data.total_kbps, KBPS, KBPS_UNIT);
+		shell_fprintf(sh, SHELL_NORMAL, "\n");
 	}
 #else
 	shell_fprintf(sh, SHELL_INFO,
@@ -46,6 +46,7 @@ static int tcp_upload(int sock,
 		      uint64_t *data_offset)
 {
 	k_timepoint_t end = sys_timepoint_calc(K_MSEC(duration_in_ms));
+	struct zperf_cpu_usage cpu_usage;
 	int64_t start_time, end_time;
 	uint32_t nb_packets = 0U, nb_errors = 0U;
 	uint32_t packet_size = param->packet_size;
@@ -58,6 +59,7 @@ static int tcp_upload(int sock,
 	}
 
 	/* Start the loop */
+	zperf_cpu_usage_start(&cpu_usage);
 	start_time = k_uptime_ticks();
 
 	/* Default data payload */
@@ -114,6 +116,7 @@ static int tcp_upload(int sock,
 	} while (!sys_timepoint_expired(end));
 
 	end_time = k_uptime_ticks();
+	results->cpu_usage = zperf_cpu_usage_get(&cpu_usage);
 
 	/* Add result coming from the client */
 	results->nb_packets_sent = nb_packets;
@@ -225,6 +228,9 @@ static void tcp_upload_async_work(struct k_work *work)
 		uint32_t last_round_duration = duration - ((rounds - 1) * report_interval);
 
 		struct zperf_results periodic_result;
+		struct zperf_cpu_usage cpu_usage;
+
+		zperf_cpu_usage_start(&cpu_usage);
 
 		for (; rounds > 0; rounds--) {
 			uint32_t round_duration;
@@ -250,6 +256,7 @@ static void tcp_upload_async_work(struct k_work *work)
 		}
 
 		result->packet_size = periodic_result.packet_size;
+		result->cpu_usage = zperf_cpu_usage_get(&cpu_usage);
 
 	} else {
 		ret = tcp_upload(sock, param.duration_ms, &param, result, &data_offset);
@@ -161,6 +161,7 @@ static int udp_upload(int sock, int port,
 	uint64_t data_offset = 0U;
 	uint32_t nb_packets = 0U;
 	uint64_t usecs64;
+	struct zperf_cpu_usage cpu_usage;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
 	uint32_t print_period;
@@ -176,6 +177,7 @@ static int udp_upload(int sock, int port,
 	}
 
 	/* Start the loop */
+	zperf_cpu_usage_start(&cpu_usage);
 	start_time = k_uptime_ticks();
 	last_loop_time = start_time;
 	end_time = start_time + k_ms_to_ticks_ceil64(duration_in_ms);
@@ -277,6 +279,7 @@ static int udp_upload(int sock, int port,
 
 	end_time = k_uptime_ticks();
 	usecs64 = param->unix_offset_us + k_ticks_to_us_floor64(end_time - start_time);
+	results->cpu_usage = zperf_cpu_usage_get(&cpu_usage);
 
 	if (param->peer_addr.sa_family == AF_INET) {
 		if (net_ipv4_is_addr_mcast(&net_sin(&param->peer_addr)->sin_addr)) {
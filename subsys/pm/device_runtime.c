@@ -331,6 +331,18 @@ static int put_sync_locked(const struct device *dev)
 	return ret;
 }
 
+/* Suspend delay of a device, the suspend is never deferred before the kernel runs */
+static inline uint32_t suspend_delay_ms(const struct device *dev)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+	return k_is_pre_kernel() ? 0U : dev->pm->suspend_delay_ms;
+#else
+	ARG_UNUSED(dev);
+
+	return 0U;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+}
+
 int pm_device_runtime_put(const struct device *dev)
 {
 	int ret;
@@ -348,6 +360,9 @@ int pm_device_runtime_put(const struct device *dev)
 		ret = put_sync_locked(dev);
 
 		k_spin_unlock(&pm_sync->lock, k);
+	} else if (suspend_delay_ms(dev) > 0U) {
+		/* The domain is put by the work item once the device is suspended */
+		ret = runtime_suspend(dev, true, K_MSEC(suspend_delay_ms(dev)));
 	} else {
 		ret = runtime_suspend(dev, false, K_NO_WAIT);
 
@@ -148,6 +148,9 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	k_spinlock_key_t key;
 	int32_t ticks, events_ticks;
 	uint32_t exit_latency_ticks;
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+	uint32_t idle_start;
+#endif
 
 	SYS_PORT_TRACING_FUNC_ENTER(pm, system_suspend, kernel_ticks);
 
@@ -220,9 +223,15 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+	idle_start = k_cycle_get_32();
+#endif
 	pm_state_set(z_cpus_pm_state[id]->state, z_cpus_pm_state[id]->substate_id);
 
 	/* Wake up sequence starts here */
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+	pm_policy_idle_exit(id, k_cyc_to_us_floor32(k_cycle_get_32() - idle_start));
+#endif
 
 	if (IS_ENABLED(CONFIG_PM_STATS)) {
 		pm_stats_stop();
@@ -230,6 +239,10 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	}
 
 	pm_system_resume();
+
+	if (IS_ENABLED(CONFIG_PM_STATS)) {
+		pm_stats_exit_done();
+	}
 	k_sched_unlock();
 	SYS_PORT_TRACING_FUNC_EXIT(pm, system_suspend, ticks,
 				   z_cpus_pm_state[id] ?
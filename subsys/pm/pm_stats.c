@@ -16,12 +16,16 @@ STATS_SECT_START(pm_stats)
 STATS_SECT_ENTRY32(state_count)
 STATS_SECT_ENTRY32(state_last_cycles)
 STATS_SECT_ENTRY32(state_total_cycles)
+STATS_SECT_ENTRY32(state_last_exit_cycles)
+STATS_SECT_ENTRY32(state_max_exit_cycles)
 STATS_SECT_END;
 
 STATS_NAME_START(pm_stats)
 STATS_NAME(pm_stats, state_count)
 STATS_NAME(pm_stats, state_last_cycles)
 STATS_NAME(pm_stats, state_total_cycles)
+STATS_NAME(pm_stats, state_last_exit_cycles)
+STATS_NAME(pm_stats, state_max_exit_cycles)
 STATS_NAME_END(pm_stats);
 
 static STATS_SECT_DECL(pm_stats) stats[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT];
@@ -30,6 +34,7 @@ static STATS_SECT_DECL(pm_stats) stats[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT];
 static char names[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT][PM_STAT_NAME_LEN];
 static uint32_t time_start[CONFIG_MP_MAX_NUM_CPUS];
 static uint32_t time_stop[CONFIG_MP_MAX_NUM_CPUS];
+static enum pm_state last_state[CONFIG_MP_MAX_NUM_CPUS];
 
 static int pm_stats_init(void)
 {
@@ -40,7 +45,7 @@ static int pm_stats_init(void)
 		for (uint8_t j = 0U; j < PM_STATE_COUNT; j++) {
 			snprintk(names[i][j], PM_STAT_NAME_LEN,
 				 "pm_cpu_%03d_state_%1d_stats", i, j);
-			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32, 3U,
+			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32, 5U,
 				   STATS_NAME_INIT_PARMS(pm_stats));
 			stats_register(names[i][j], &(stats[i][j].s_hdr));
 		}
@@ -69,4 +74,18 @@ void pm_stats_update(enum pm_state state)
 	STATS_INC(stats[cpu][state], state_count);
 	STATS_INCN(stats[cpu][state], state_total_cycles, time_total);
 	STATS_SET(stats[cpu][state], state_last_cycles, time_total);
+	last_state[cpu] = state;
+}
+
+void pm_stats_exit_done(void)
+{
+	uint8_t cpu = CPU_ID;
+	enum pm_state state = last_state[cpu];
+	uint32_t time_exit = k_cycle_get_32() - time_stop[cpu];
+
+	/* Time from the wake up to the end of the resume of the devices and the SoC */
+	STATS_SET(stats[cpu][state], state_last_exit_cycles, time_exit);
+	if (time_exit > stats[cpu][state].state_max_exit_cycles) {
+		STATS_SET(stats[cpu][state], state_max_exit_cycles, time_exit);
+	}
 }
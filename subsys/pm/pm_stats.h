@@ -13,5 +13,6 @@
 void pm_stats_start(void);
 void pm_stats_stop(void);
 void pm_stats_update(enum pm_state state);
+void pm_stats_exit_done(void);
 
 #endif /* ZEPHYR_SUBSYS_PM_PM_STATS_H_ */
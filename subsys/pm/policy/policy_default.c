@@ -21,6 +21,10 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 	}
 #endif
 
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+	ticks = pm_policy_predicted_ticks(cpu, ticks);
+#endif
+
 	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
 
 	for (uint32_t i = 0; i < num_cpu_states; i++) {
@@ -0,0 +1,124 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/pm/policy.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys_clock.h>
+#include <zephyr/sys/util.h>
+
+#define HISTORY_LEN CONFIG_PM_POLICY_PREDICTIVE_HISTORY
+
+/* Longer idle periods are clamped, the prediction only matters if short */
+#define IDLE_US_MAX (10U * USEC_PER_SEC)
+
+/* Spread below which a set of idle periods is always considered regular */
+#define VARIANCE_MIN_US2 (20U * 20U)
+
+struct idle_history {
+	uint32_t us[HISTORY_LEN];
+	uint8_t next;
+	uint8_t count;
+};
+
+static struct idle_history history[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_spinlock lock;
+
+void pm_policy_idle_exit(uint8_t cpu, uint32_t idle_us)
+{
+	struct idle_history *h = &history[cpu];
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	h->us[h->next] = MIN(idle_us, IDLE_US_MAX);
+	h->next = (h->next + 1U) % HISTORY_LEN;
+	if (h->count < HISTORY_LEN) {
+		h->count++;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+/*
+ * Get the average of the recent idle periods if they are regular enough,
+ * i.e. if their standard deviation is small compared to the average. The
+ * longest periods are discarded one at a time as outliers, as long as at
+ * least three quarters of the periods are left.
+ */
+static uint32_t typical_idle_us(const struct idle_history *h)
+{
+	uint32_t thresh = UINT32_MAX;
+
+	while (true) {
+		uint64_t sum = 0U;
+		uint64_t variance = 0U;
+		uint32_t max = 0U;
+		uint32_t n = 0U;
+		uint32_t avg;
+
+		for (uint8_t i = 0U; i < h->count; i++) {
+			if (h->us[i] <= thresh) {
+				sum += h->us[i];
+				max = MAX(max, h->us[i]);
+				n++;
+			}
+		}
+
+		if (n == 0U) {
+			return UINT32_MAX;
+		}
+
+		avg = sum / n;
+
+		for (uint8_t i = 0U; i < h->count; i++) {
+			if (h->us[i] <= thresh) {
+				int64_t diff = (int64_t)h->us[i] - avg;
+
+				variance += diff * diff;
+			}
+		}
+
+		variance /= n;
+
+		/* Standard deviation within a sixth of the average */
+		if ((uint64_t)avg * avg > 36U * variance || variance <= VARIANCE_MIN_US2) {
+			return avg;
+		}
+
+		if (n * 4U <= h->count * 3U || max == 0U) {
+			return UINT32_MAX;
+		}
+
+		thresh = max - 1U;
+	}
+}
+
+int32_t pm_policy_predicted_ticks(uint8_t cpu, int32_t ticks)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t typical_us;
+	int32_t predicted;
+
+	/* The history is not full yet after boot, wait for enough samples */
+	if (history[cpu].count < HISTORY_LEN) {
+		k_spin_unlock(&lock, key);
+		return ticks;
+	}
+
+	typical_us = typical_idle_us(&history[cpu]);
+	k_spin_unlock(&lock, key);
+
+	if (typical_us == UINT32_MAX) {
+		return ticks;
+	}
+
+	predicted = (int32_t)k_us_to_ticks_floor32(typical_us);
+
+	if (ticks == K_TICKS_FOREVER || predicted < ticks) {
+		return predicted;
+	}
+
+	return ticks;
+}
@@ -12,6 +12,7 @@
 #include <zephyr/shell/shell_uart.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
@@ -25,6 +26,13 @@ struct perf_data_t {
 	size_t idx;
 	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
 	bool buf_full;
+
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	/* Index + 1 in buf of the record of each hashed stack trace, 0 if free */
+	uint16_t slots[CONFIG_PROFILING_PERF_AGGREGATE_SLOTS];
+	uintptr_t trace[CONFIG_PROFILING_PERF_AGGREGATE_MAX_DEPTH];
+	size_t dropped;
+#endif
 };
 
 static void perf_tracer(struct k_timer *timer);
@@ -34,11 +42,78 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+BUILD_ASSERT(CONFIG_PROFILING_PERF_BUFFER_SIZE < UINT16_MAX);
+
+/*
+ * Each record in the buffer is made of the stack trace length, the number of
+ * samples and the thread, followed by the stack trace.
+ */
+#define RECORD_HDR_LEN 3
+
+static uint32_t perf_hash(uintptr_t thread, const uintptr_t *trace, size_t len)
+{
+	/* FNV-1a over the words */
+	uint32_t hash = 2166136261U ^ (uint32_t)thread;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint32_t)trace[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static void perf_aggregate(struct perf_data_t *perf_data_ptr)
+{
+	uintptr_t thread = (uintptr_t)k_current_get();
+	size_t len = arch_perf_current_stack_trace(perf_data_ptr->trace,
+						   ARRAY_SIZE(perf_data_ptr->trace));
+	uint32_t hash = perf_hash(thread, perf_data_ptr->trace, len);
+	uintptr_t *rec;
+
+	for (size_t n = 0; len != 0 && n < ARRAY_SIZE(perf_data_ptr->slots); n++) {
+		uint16_t *slot = &perf_data_ptr->slots[(hash + n) % ARRAY_SIZE(perf_data_ptr->slots)];
+
+		if (*slot == 0) {
+			if (perf_data_ptr->idx + RECORD_HDR_LEN + len >
+			    CONFIG_PROFILING_PERF_BUFFER_SIZE) {
+				break;
+			}
+
+			rec = &perf_data_ptr->buf[perf_data_ptr->idx];
+			rec[0] = len;
+			rec[1] = 1;
+			rec[2] = thread;
+			memcpy(&rec[RECORD_HDR_LEN], perf_data_ptr->trace, len * sizeof(uintptr_t));
+
+			*slot = perf_data_ptr->idx + 1;
+			perf_data_ptr->idx += RECORD_HDR_LEN + len;
+			return;
+		}
+
+		rec = &perf_data_ptr->buf[*slot - 1];
+		if (rec[0] == len && rec[2] == thread &&
+		    memcmp(&rec[RECORD_HDR_LEN], perf_data_ptr->trace,
+			   len * sizeof(uintptr_t)) == 0) {
+			rec[1]++;
+			return;
+		}
+	}
+
+	/* Keep sampling, identical stack traces can still be counted */
+	perf_data_ptr->dropped++;
+	perf_data_ptr->buf_full = true;
+}
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
+
 static void perf_tracer(struct k_timer *timer)
 {
 	struct perf_data_t *perf_data_ptr =
 		(struct perf_data_t *)k_timer_user_data_get(timer);
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	perf_aggregate(perf_data_ptr);
+#else
 	size_t trace_length = 0;
 
 	if (++perf_data_ptr->idx < CONFIG_PROFILING_PERF_BUFFER_SIZE) {
@@ -55,6 +130,7 @@ static void perf_tracer(struct k_timer *timer)
 		perf_data_ptr->buf_full = true;
 		k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
 	}
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
 }
 
 static void perf_dwork_handler(struct k_work *work)
@@ -63,7 +139,9 @@ static void perf_dwork_handler(struct k_work *work)
 	struct perf_data_t *perf_data_ptr = CONTAINER_OF(dwork, struct perf_data_t, dwork);
 
 	k_timer_stop(&perf_data_ptr->timer);
-	if (perf_data_ptr->buf_full) {
+	if (IS_ENABLED(CONFIG_PROFILING_PERF_AGGREGATE) && perf_data_ptr->buf_full) {
+		shell_warn(perf_data_ptr->sh, "Perf done, some samples were dropped");
+	} else if (perf_data_ptr->buf_full) {
 		shell_error(perf_data_ptr->sh, "Perf buf overflow!");
 	} else {
 		shell_print(perf_data_ptr->sh, "Perf done!");
@@ -77,7 +155,7 @@ static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 		return -EINPROGRESS;
 	}
 
-	if (perf_data.buf_full) {
+	if (!IS_ENABLED(CONFIG_PROFILING_PERF_AGGREGATE) && perf_data.buf_full) {
 		shell_warn(sh, "Perf buffer is full");
 		return -ENOBUFS;
 	}
@@ -109,6 +187,10 @@ static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 
 	perf_data.idx = 0;
 	perf_data.buf_full = false;
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	memset(perf_data.slots, 0, sizeof(perf_data.slots));
+	perf_data.dropped = 0;
+#endif
 
 	return 0;
 }
@@ -121,10 +203,23 @@ static int cmd_perf_info(const struct shell *sh, size_t argc, char **argv)
 
 	shell_print(sh, "Perf buf: %zu/%d %s", perf_data.idx, CONFIG_PROFILING_PERF_BUFFER_SIZE,
 		    perf_data.buf_full ? "(full)" : "");
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	shell_print(sh, "Perf dropped samples: %zu", perf_data.dropped);
+#endif
 
 	return 0;
 }
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static void perf_print_thread(const struct k_thread *thread, void *user_data)
+{
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	shell_print((const struct shell *)user_data, "Perf thread %016lx %s",
+		    (uintptr_t)thread, (name != NULL && name[0] != '\0') ? name : "unknown");
+}
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
+
 static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 {
 	if (k_work_delayable_is_pending(&perf_data.dwork)) {
@@ -132,11 +227,17 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 		return -EINPROGRESS;
 	}
 
-	shell_print(sh, "Perf buf length %zu", perf_data.idx);
+	shell_print(sh, "Perf buf length %zu%s", perf_data.idx,
+		    IS_ENABLED(CONFIG_PROFILING_PERF_AGGREGATE) ? " aggregated" : "");
 	for (size_t i = 0; i < perf_data.idx; i++) {
 		shell_print(sh, "%016lx", perf_data.buf[i]);
 	}
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	/* Names of the sampled threads, for attribution on the host */
+	k_thread_foreach_unlocked(perf_print_thread, (void *)sh);
+#endif
+
 	cmd_perf_clear(NULL, 0, NULL);
 
 	return 0;
@@ -8,6 +8,7 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/entropy.h>
 #include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
 #include <string.h>
 
 #if !defined(CONFIG_MBEDTLS_CFG_FILE)
@@ -16,6 +17,18 @@
 #include CONFIG_MBEDTLS_CFG_FILE
 #endif /* CONFIG_MBEDTLS_CFG_FILE */
 #include <mbedtls/ctr_drbg.h>
+#include <mbedtls/platform_util.h>
+
+#ifdef CONFIG_CS_CTR_DRBG_PER_CPU
+#define DRBG_INSTANCES CONFIG_MP_MAX_NUM_CPUS
+#else
+#define DRBG_INSTANCES 1
+#endif
+
+#define POOL_SIZE CONFIG_CS_CTR_DRBG_ENTROPY_POOL_SIZE
+
+/* Size of the entropy driver reads refilling the pool */
+#define POOL_REFILL_CHUNK 32
 
 /*
  * entropy_dev is initialized at runtime to allow first time initialization
@@ -23,63 +36,187 @@
  */
 static const struct device *entropy_dev;
 static const unsigned char drbg_seed[] = CONFIG_CS_CTR_DRBG_PERSONALIZATION;
-static bool ctr_initialised;
-static K_MUTEX_DEFINE(ctr_lock);
 
-static mbedtls_ctr_drbg_context ctr_ctx;
+struct ctr_drbg {
+	mbedtls_ctr_drbg_context ctx;
+	struct k_mutex lock;
+	bool initialised;
+};
+
+static struct ctr_drbg drbgs[DRBG_INSTANCES];
+
+#if POOL_SIZE > 0
+/*
+ * Entropy read in the background from the driver, in batches, so that the
+ * DRBGs are seeded and reseeded without waiting for it. Bytes are taken from
+ * the end of the pool and are used only once.
+ */
+static uint8_t pool[POOL_SIZE];
+static size_t pool_len;
+static struct k_spinlock pool_lock;
+
+static void pool_refill_handler(struct k_work *work)
+{
+	uint8_t chunk[POOL_REFILL_CHUNK];
+	k_spinlock_key_t key;
+	size_t len;
+
+	while (true) {
+		key = k_spin_lock(&pool_lock);
+		len = MIN(sizeof(chunk), POOL_SIZE - pool_len);
+		k_spin_unlock(&pool_lock, key);
+
+		if (len == 0 || entropy_get_entropy(entropy_dev, chunk, len) != 0) {
+			break;
+		}
+
+		key = k_spin_lock(&pool_lock);
+		/* Consumers only shrink the pool, the room cannot have decreased */
+		memcpy(&pool[pool_len], chunk, len);
+		pool_len += len;
+		k_spin_unlock(&pool_lock, key);
+	}
+
+	mbedtls_platform_zeroize(chunk, sizeof(chunk));
+}
+
+static K_WORK_DEFINE(pool_refill_work, pool_refill_handler);
+
+/* Take len bytes from the pool, all or nothing, never blocks */
+static bool pool_take(void *buf, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+	bool taken = (pool_len >= len);
+	bool refill;
+
+	if (taken) {
+		pool_len -= len;
+		memcpy(buf, &pool[pool_len], len);
+		mbedtls_platform_zeroize(&pool[pool_len], len);
+	}
+
+	refill = (pool_len < POOL_SIZE / 2);
+	k_spin_unlock(&pool_lock, key);
+
+	if (refill) {
+		k_work_submit(&pool_refill_work);
+	}
+
+	return taken;
+}
+
+static int pool_init(void)
+{
+	if (device_is_ready(entropy_dev)) {
+		k_work_submit(&pool_refill_work);
+	}
+
+	return 0;
+}
+
+SYS_INIT(pool_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* POOL_SIZE > 0 */
 
 static int ctr_drbg_entropy_func(void *ctx, unsigned char *buf, size_t len)
 {
+#if POOL_SIZE > 0
+	if (pool_take(buf, len)) {
+		return 0;
+	}
+#endif
+
 	return entropy_get_entropy(entropy_dev, (void *)buf, len);
 }
 
-static int ctr_drbg_initialize(void)
+static int ctr_drbg_initialize(struct ctr_drbg *drbg)
 {
+	/* Each instance is personalized with its index, on top of its own seed */
+	unsigned char custom[sizeof(drbg_seed) + 1];
 	int ret;
 
-	entropy_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
-
-	if (!device_is_ready(entropy_dev)) {
-		__ASSERT(0, "Entropy device %s not ready", entropy_dev->name);
-		return -ENODEV;
-	}
+	memcpy(custom, drbg_seed, sizeof(drbg_seed));
+	custom[sizeof(drbg_seed)] = (unsigned char)(drbg - drbgs);
 
-	mbedtls_ctr_drbg_init(&ctr_ctx);
+	mbedtls_ctr_drbg_init(&drbg->ctx);
 
-	ret = mbedtls_ctr_drbg_seed(&ctr_ctx,
+	ret = mbedtls_ctr_drbg_seed(&drbg->ctx,
 				    ctr_drbg_entropy_func,
 				    NULL,
-				    drbg_seed,
-				    sizeof(drbg_seed));
+				    custom,
+				    sizeof(custom));
 
 	if (ret != 0) {
-		mbedtls_ctr_drbg_free(&ctr_ctx);
+		mbedtls_ctr_drbg_free(&drbg->ctx);
 		return -EIO;
 	}
 
-	ctr_initialised = true;
+	drbg->initialised = true;
+	return 0;
+}
+
+static int ctr_drbg_init(void)
+{
+	entropy_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
+
+	for (size_t i = 0; i < ARRAY_SIZE(drbgs); i++) {
+		k_mutex_init(&drbgs[i].lock);
+	}
+
 	return 0;
 }
 
+SYS_INIT(ctr_drbg_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+/* Get the instance of the current CPU, the thread may still migrate afterwards */
+static struct ctr_drbg *ctr_drbg_get(void)
+{
+#ifdef CONFIG_CS_CTR_DRBG_PER_CPU
+	unsigned int key = arch_irq_lock();
+	uint8_t cpu = arch_curr_cpu()->id;
+
+	arch_irq_unlock(key);
+
+	return &drbgs[cpu];
+#else
+	return &drbgs[0];
+#endif
+}
 
 int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
 {
+	struct ctr_drbg *drbg;
 	int ret;
 
-	k_mutex_lock(&ctr_lock, K_FOREVER);
+	if (k_is_in_isr()) {
+#if POOL_SIZE > 0
+		return pool_take(dst, outlen) ? 0 : -EAGAIN;
+#else
+		return -EAGAIN;
+#endif
+	}
+
+	drbg = ctr_drbg_get();
+
+	k_mutex_lock(&drbg->lock, K_FOREVER);
+
+	if (unlikely(!drbg->initialised)) {
+		if (!device_is_ready(entropy_dev)) {
+			__ASSERT(0, "Entropy device %s not ready", entropy_dev->name);
+			ret = -EIO;
+			goto end;
+		}
 
-	if (unlikely(!ctr_initialised)) {
-		ret = ctr_drbg_initialize();
+		ret = ctr_drbg_initialize(drbg);
 		if (ret != 0) {
 			ret = -EIO;
 			goto end;
 		}
 	}
 
-	ret = mbedtls_ctr_drbg_random(&ctr_ctx, (unsigned char *)dst, outlen);
+	ret = mbedtls_ctr_drbg_random(&drbg->ctx, (unsigned char *)dst, outlen);
 
 end:
-	k_mutex_unlock(&ctr_lock);
+	k_mutex_unlock(&drbg->lock);
 
 	return ret;
 }
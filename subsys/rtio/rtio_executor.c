@@ -56,6 +56,108 @@ static inline void rtio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 	iodev_sqe->sqe.iodev->api->submit(iodev_sqe);
 }
 
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+/**
+ * @brief Queue the submissions acquired by the caller
+ *
+ * The entries acquired by the calling producer are linked in acquisition
+ * order into their chains and transactions, and each chain is pushed to the
+ * submission queue at once, so that chains of several producers never mix.
+ *
+ * @param r RTIO context
+ */
+void rtio_executor_publish(struct rtio *r)
+{
+	struct rtio_sqe_pool *pool = r->sqe_pool;
+	uintptr_t owner = rtio_producer_id();
+	struct rtio_iodev_sqe *first = NULL;
+	struct rtio_iodev_sqe *curr, *head, **prev;
+
+	/* Sort the entries of the producer by acquisition order */
+	for (int i = 0; i < pool->pool_size; i++) {
+		curr = &pool->pool[i];
+
+		if (!atomic_test_bit(pool->used, i) || (curr->owner != owner)) {
+			continue;
+		}
+
+		prev = &first;
+		while ((*prev != NULL) && ((int32_t)(curr->seq - (*prev)->seq) > 0)) {
+			prev = &(*prev)->next;
+		}
+		curr->next = *prev;
+		*prev = curr;
+	}
+
+	curr = first;
+	while (curr != NULL) {
+		head = curr;
+
+		while ((curr->sqe.flags & (RTIO_SQE_TRANSACTION | RTIO_SQE_CHAINED)) &&
+		       (curr->next != NULL)) {
+			curr->owner = 0U;
+			curr->r = r;
+			curr = curr->next;
+		}
+
+		__ASSERT((curr->sqe.flags & (RTIO_SQE_TRANSACTION | RTIO_SQE_CHAINED)) == 0,
+			 "Expected a valid sqe following transaction or chain flag");
+
+		first = curr->next;
+		curr->next = NULL;
+		curr->owner = 0U;
+		curr->r = r;
+		mpsc_push(&r->sq, &head->q);
+		curr = first;
+	}
+}
+
+/**
+ * @brief Submit the chains in the queue to iodevs
+ *
+ * Any producer may call this at any time: the first caller submits the
+ * chains queued by all the callers until none is left, while the others
+ * return at once. The chains are pushed already linked by
+ * rtio_executor_publish().
+ *
+ * @param r RTIO context
+ */
+void rtio_executor_submit(struct rtio *r)
+{
+	const uint16_t cancel_no_response = (RTIO_SQE_CANCELED | RTIO_SQE_NO_RESPONSE);
+	struct mpsc_node *node;
+
+	if (atomic_inc(&r->sq_drain) != 0) {
+		return;
+	}
+
+	do {
+		node = mpsc_pop(&r->sq);
+
+		while (node != NULL) {
+			struct rtio_iodev_sqe *iodev_sqe =
+				CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+
+			/* If a submission was cancelled before submit, then cancel
+			 * the rest of the chain and generate no response
+			 */
+			for (struct rtio_iodev_sqe *curr = iodev_sqe; curr != NULL;
+			     curr = curr->next) {
+				if (curr->sqe.flags & RTIO_SQE_CANCELED) {
+					curr->sqe.flags |= cancel_no_response;
+					if (curr->next != NULL) {
+						curr->next->sqe.flags |= cancel_no_response;
+					}
+				}
+			}
+
+			rtio_iodev_submit(iodev_sqe);
+
+			node = mpsc_pop(&r->sq);
+		}
+	} while (atomic_dec(&r->sq_drain) != 1);
+}
+#else
 /**
  * @brief Submit operations in the queue to iodevs
  *
@@ -118,6 +220,7 @@ void rtio_executor_submit(struct rtio *r)
 		node = mpsc_pop(&r->sq);
 	}
 }
+#endif /* CONFIG_RTIO_MULTI_PRODUCER */
 
 /**
  * @brief Handle common logic when :c:macro:`RTIO_SQE_MULTISHOT` is set
@@ -162,6 +265,13 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 		sqe_flags = curr->sqe.flags;
 		cqe_flags = rtio_cqe_compute_flags(iodev_sqe);
 
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+		if (curr->sqe.op == RTIO_OP_RX && (sqe_flags & RTIO_SQE_MEMPOOL_BUFFER) &&
+		    curr->sqe.rx.buf != NULL) {
+			z_rtio_mempool_stats_complete(r, curr->sqe.rx.buf);
+		}
+#endif
+
 		next = rtio_iodev_sqe_next(curr);
 		if (is_multishot) {
 			rtio_executor_handle_multishot(r, curr, is_canceled);
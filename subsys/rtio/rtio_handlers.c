@@ -92,6 +92,13 @@ static inline int z_vrfy_rtio_sqe_copy_in_get_handles(struct rtio *r, const stru
 
 	for (int i = 0; i < sqe_count; i++) {
 		sqe = rtio_sqe_acquire(r);
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+		/* Another producer may have acquired entries since the check */
+		if (sqe == NULL) {
+			rtio_sqe_drop_all(r);
+			return -ENOMEM;
+		}
+#endif
 		__ASSERT_NO_MSG(sqe != NULL);
 		if (handle != NULL && i == 0) {
 			*handle = sqe;
@@ -16,6 +16,11 @@ K_APPMEM_PARTITION_DEFINE(rtio_partition);
 
 int rtio_init(void)
 {
+	if (IS_ENABLED(CONFIG_RTIO_MULTI_PRODUCER)) {
+		/* Pools are allocated from their bitmaps */
+		return 0;
+	}
+
 	STRUCT_SECTION_FOREACH(rtio_sqe_pool, sqe_pool) {
 		for (int i = 0; i < sqe_pool->pool_size; i++) {
 			mpsc_push(&sqe_pool->free_q, &sqe_pool->pool[i].q);
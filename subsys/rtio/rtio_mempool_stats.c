@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/mem_blocks.h>
+
+static struct rtio_mempool_acct *mempool_acct(struct rtio *r)
+{
+	if (r->block_pool == NULL) {
+		return NULL;
+	}
+
+	return r->block_pool_acct;
+}
+
+static uint32_t mempool_blk_idx(struct rtio *r, void *buf)
+{
+	return ((uint8_t *)buf - r->block_pool->buffer) >> r->block_pool->info.blk_sz_shift;
+}
+
+static struct rtio_mempool_iodev_stats *mempool_iodev(struct rtio_mempool_stats *stats,
+						      const struct rtio_iodev *iodev, bool claim)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(stats->iodevs); i++) {
+		if (stats->iodevs[i].iodev == iodev) {
+			return &stats->iodevs[i];
+		}
+
+		if (stats->iodevs[i].iodev == NULL) {
+			if (!claim) {
+				return NULL;
+			}
+			stats->iodevs[i].iodev = iodev;
+			return &stats->iodevs[i];
+		}
+	}
+
+	return NULL;
+}
+
+void z_rtio_mempool_stats_lend(struct rtio *r, const struct rtio_iodev *iodev, void *buf,
+			       uint32_t buf_len)
+{
+	struct rtio_mempool_acct *acct = mempool_acct(r);
+	uint32_t blocks;
+	struct rtio_mempool_iodev_stats *dev;
+	struct rtio_mempool_lend *lend;
+	k_spinlock_key_t key;
+
+	if (acct == NULL) {
+		return;
+	}
+
+	blocks = buf_len >> r->block_pool->info.blk_sz_shift;
+	key = k_spin_lock(&acct->lock);
+
+	lend = &acct->lends[mempool_blk_idx(r, buf)];
+	lend->iodev = iodev;
+	lend->completed = false;
+
+	acct->stats.blocks += blocks;
+	acct->stats.blocks_max = MAX(acct->stats.blocks_max, acct->stats.blocks);
+
+	dev = mempool_iodev(&acct->stats, iodev, true);
+	if (dev != NULL) {
+		dev->blocks += blocks;
+		dev->blocks_max = MAX(dev->blocks_max, dev->blocks);
+		dev->lent++;
+	} else {
+		acct->stats.untracked_blocks += blocks;
+	}
+
+	k_spin_unlock(&acct->lock, key);
+}
+
+void z_rtio_mempool_stats_alloc_failed(struct rtio *r)
+{
+	struct rtio_mempool_acct *acct = mempool_acct(r);
+	k_spinlock_key_t key;
+
+	if (acct == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&acct->lock);
+	acct->stats.alloc_failures++;
+	k_spin_unlock(&acct->lock, key);
+}
+
+void z_rtio_mempool_stats_complete(struct rtio *r, void *buf)
+{
+	struct rtio_mempool_acct *acct = mempool_acct(r);
+	struct rtio_mempool_lend *lend;
+	k_spinlock_key_t key;
+
+	if (acct == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&acct->lock);
+
+	lend = &acct->lends[mempool_blk_idx(r, buf)];
+	lend->cqe_cycles = k_cycle_get_32();
+	lend->completed = true;
+
+	k_spin_unlock(&acct->lock, key);
+}
+
+void z_rtio_mempool_stats_release(struct rtio *r, void *buf, uint32_t buf_len)
+{
+	struct rtio_mempool_acct *acct = mempool_acct(r);
+	uint32_t blocks;
+	struct rtio_mempool_iodev_stats *dev;
+	struct rtio_mempool_lend *lend;
+	k_spinlock_key_t key;
+	uint32_t latency_us;
+
+	if (acct == NULL) {
+		return;
+	}
+
+	blocks = buf_len >> r->block_pool->info.blk_sz_shift;
+	key = k_spin_lock(&acct->lock);
+
+	lend = &acct->lends[mempool_blk_idx(r, buf)];
+
+	acct->stats.blocks -= MIN(blocks, acct->stats.blocks);
+
+	dev = mempool_iodev(&acct->stats, lend->iodev, false);
+	if (dev != NULL) {
+		dev->blocks -= MIN(blocks, dev->blocks);
+	} else {
+		acct->stats.untracked_blocks -= MIN(blocks, acct->stats.untracked_blocks);
+	}
+
+	if (lend->completed) {
+		latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - lend->cqe_cycles);
+		acct->stats.released++;
+		acct->stats.release_latency_total_us += latency_us;
+		acct->stats.release_latency_max_us =
+			MAX(acct->stats.release_latency_max_us, latency_us);
+	}
+
+	lend->iodev = NULL;
+	lend->completed = false;
+
+	k_spin_unlock(&acct->lock, key);
+}
+
+int rtio_mempool_stats_get(struct rtio *r, struct rtio_mempool_stats *stats)
+{
+	struct rtio_mempool_acct *acct = mempool_acct(r);
+	k_spinlock_key_t key;
+
+	if (acct == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&acct->lock);
+	*stats = acct->stats;
+	k_spin_unlock(&acct->lock, key);
+
+	return 0;
+}
+
+void rtio_mempool_stats_reset(struct rtio *r)
+{
+	struct rtio_mempool_acct *acct = mempool_acct(r);
+	struct rtio_mempool_stats *stats;
+	k_spinlock_key_t key;
+
+	if (acct == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&acct->lock);
+
+	stats = &acct->stats;
+	stats->blocks_max = stats->blocks;
+	stats->alloc_failures = 0U;
+	stats->released = 0U;
+	stats->release_latency_max_us = 0U;
+	stats->release_latency_total_us = 0U;
+
+	for (size_t i = 0; i < ARRAY_SIZE(stats->iodevs); i++) {
+		stats->iodevs[i].blocks_max = stats->iodevs[i].blocks;
+		stats->iodevs[i].lent = 0U;
+	}
+
+	k_spin_unlock(&acct->lock, key);
+}
@@ -579,6 +579,7 @@ int card_read_blocks(struct sd_card *card, uint8_t *rbuf, uint32_t start_block,
 		sector = 0;
 		buf_offset = rbuf;
 		while (sector < num_blocks) {
+			rlen = MIN(rlen, num_blocks - sector);
 			/* Read from disk to card buffer */
 			ret = card_read(card, card->card_buffer, sector + start_block, rlen);
 			if (ret) {
@@ -650,6 +651,37 @@ static int card_query_written(struct sd_card *card, uint32_t *num_written)
 	return 0;
 }
 
+/*
+ * Sends ACMD23 (set write block erase count) so that the card can erase the
+ * blocks of the following multiple block write beforehand
+ */
+static int card_set_pre_erase(struct sd_card *card, uint32_t num_blocks)
+{
+	int ret;
+	struct sdhc_command cmd;
+
+	ret = card_app_command(card, card->relative_addr);
+	if (ret) {
+		LOG_DBG("App CMD for ACMD23 failed");
+		return ret;
+	}
+
+	cmd.opcode = SD_APP_SET_WRITE_BLK_ERASE_CNT;
+	/* The block count is 23 bits wide */
+	cmd.arg = MIN(num_blocks, BIT(23) - 1U);
+	cmd.response_type = (SD_RSP_TYPE_R1 | SD_SPI_RSP_TYPE_R1);
+	cmd.retries = CONFIG_SD_CMD_RETRIES;
+	cmd.timeout_ms = CONFIG_SD_CMD_TIMEOUT;
+
+	ret = sdhc_request(card->sdhc, &cmd, NULL);
+	if (ret) {
+		LOG_DBG("ACMD23 failed: %d", ret);
+		return ret;
+	}
+
+	return sd_check_response(&cmd);
+}
+
 static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_block,
 		      uint32_t num_blocks)
 {
@@ -658,6 +690,15 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 	struct sdhc_command cmd;
 	struct sdhc_data data;
 
+	if (IS_ENABLED(CONFIG_SD_WRITE_PRE_ERASE) && (num_blocks > 1U) &&
+	    (card->type == CARD_SDMMC)) {
+		/* Pre-erasing is an optimization, write anyway if it fails */
+		ret = card_set_pre_erase(card, num_blocks);
+		if (ret) {
+			LOG_DBG("Could not pre-erase %u blocks: %d", num_blocks, ret);
+		}
+	}
+
 	/*
 	 * See the note in card_read() above. We will not issue CMD23
 	 * or CMD12, and expect the host to handle those details.
@@ -744,6 +785,7 @@ int card_write_blocks(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 		sector = 0;
 		buf_offset = wbuf;
 		while (sector < num_blocks) {
+			wlen = MIN(wlen, num_blocks - sector);
 			/* Copy data into card buffer */
 			memcpy(card->card_buffer, buf_offset, wlen * card->block_size);
 			/* Write card buffer to disk */
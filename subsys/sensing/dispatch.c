@@ -34,6 +34,95 @@ static void update_client_consume_time(struct sensing_sensor *sensor,
 	conn->next_consume_time += interval;
 }
 
+#ifdef CONFIG_SENSING_BATCHING
+/* References to the samples of the RTIO mempool, indexed by their first block */
+static atomic_t sample_refs[CONFIG_SENSING_RTIO_BLOCK_COUNT];
+static uint32_t sample_lens[CONFIG_SENSING_RTIO_BLOCK_COUNT];
+
+static int sample_index(const void *buf)
+{
+	const struct sys_mem_blocks *pool = sensing_rtio_ctx.block_pool;
+	const uint8_t *data = buf;
+
+	if (data < pool->buffer ||
+	    data >= pool->buffer + (pool->info.num_blocks << pool->info.blk_sz_shift)) {
+		return -EINVAL;
+	}
+
+	return (data - pool->buffer) >> pool->info.blk_sz_shift;
+}
+
+int sensing_data_hold(const void *buf)
+{
+	int idx = sample_index(buf);
+
+	if (idx < 0 || atomic_get(&sample_refs[idx]) == 0) {
+		return -EINVAL;
+	}
+
+	atomic_inc(&sample_refs[idx]);
+
+	return 0;
+}
+
+void sensing_data_release(const void *buf)
+{
+	const struct sys_mem_blocks *pool = sensing_rtio_ctx.block_pool;
+	int idx = sample_index(buf);
+
+	if (idx < 0) {
+		return;
+	}
+
+	/* The last reference returns the sample to the pool */
+	if (atomic_dec(&sample_refs[idx]) == 1) {
+		rtio_release_buffer(&sensing_rtio_ctx,
+				    pool->buffer + (idx << pool->info.blk_sz_shift),
+				    sample_lens[idx]);
+	}
+}
+
+static void report_batch(struct sensing_connection *conn)
+{
+	conn->callback_list->on_data_batch_event(conn, conn->batch, conn->batch_count,
+						 conn->callback_list->context);
+	discard_batch(conn);
+}
+
+void discard_batch(struct sensing_connection *conn)
+{
+	for (uint16_t i = 0; i < conn->batch_count; i++) {
+		sensing_data_release(conn->batch[i]);
+	}
+
+	conn->batch_count = 0;
+}
+
+/* batch the sample for the client latency, returns false if it was not batched */
+static bool batch_data(struct sensing_connection *conn, void *data, uint64_t cur_time)
+{
+	bool batching = conn->latency != 0 && conn->callback_list != NULL &&
+			conn->callback_list->on_data_batch_event;
+
+	if (batching && sensing_data_hold(data) == 0) {
+		if (conn->batch_count == 0) {
+			conn->batch_start = cur_time;
+		}
+		conn->batch[conn->batch_count++] = data;
+	} else {
+		batching = false;
+	}
+
+	if (conn->batch_count > 0 &&
+	    (!batching || conn->batch_count == ARRAY_SIZE(conn->batch) ||
+	     cur_time - conn->batch_start >= conn->latency)) {
+		report_batch(conn);
+	}
+
+	return batching;
+}
+#endif /* CONFIG_SENSING_BATCHING */
+
 /* send data to clients based on interval and sensitivity */
 static int send_data_to_clients(struct sensing_sensor *sensor,
 				void *data)
@@ -59,6 +148,13 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 
 		update_client_consume_time(sensor, conn);
 
+#ifdef CONFIG_SENSING_BATCHING
+		/* all clients share the sample, batched samples are held until reported */
+		if (batch_data(conn, data, get_us())) {
+			continue;
+		}
+#endif
+
 		if (!conn->callback_list->on_data_event) {
 			LOG_WRN("sensor:%s event callback not registered",
 					conn->source->dev->name);
@@ -113,7 +209,18 @@ static void dispatch_task(void *a, void *b, void *c)
 		    (uintptr_t)cqe.userdata < (uintptr_t)STRUCT_SECTION_END(sensing_sensor)) {
 			struct sensing_sensor *sensor = cqe.userdata;
 
+#ifdef CONFIG_SENSING_BATCHING
+			int idx = sample_index(data);
+
+			/* the dispatcher holds the first reference during the callbacks */
+			atomic_set(&sample_refs[idx], 1);
+			sample_lens[idx] = data_len;
+			send_data_to_clients(sensor, data);
+			sensing_data_release(data);
+			continue;
+#else
 			send_data_to_clients(sensor, data);
+#endif
 		}
 
 		rtio_release_buffer(&sensing_rtio_ctx, data, data_len);
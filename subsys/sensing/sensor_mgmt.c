@@ -275,6 +275,10 @@ static void init_connection(struct sensing_connection *conn,
 
 	conn->interval = 0;
 	memset(conn->sensitivity, 0x00, sizeof(conn->sensitivity));
+#ifdef CONFIG_SENSING_BATCHING
+	conn->latency = 0;
+	conn->batch_count = 0;
+#endif
 	/* link connection to its reporter's client_list */
 	sys_slist_append(&conn->source->client_list, &conn->snode);
 }
@@ -380,6 +384,10 @@ int close_sensor(struct sensing_connection **conn)
 
 	sys_slist_find_and_remove(&tmp_conn->source->client_list, &tmp_conn->snode);
 
+#ifdef CONFIG_SENSING_BATCHING
+	discard_batch(tmp_conn);
+#endif
+
 	save_config_and_notify(tmp_conn->source);
 
 	free(*conn);
@@ -440,6 +448,28 @@ int get_interval(struct sensing_connection *conn, uint32_t *interval)
 	return 0;
 }
 
+#ifdef CONFIG_SENSING_BATCHING
+int set_latency(struct sensing_connection *conn, uint64_t latency)
+{
+	__ASSERT(conn && conn->source, "set latency, connection or reporter not be NULL");
+
+	conn->latency = latency;
+
+	LOG_INF("set latency, sensor:%s, conn:%p, latency:%llu(us)",
+		conn->source->dev->name, conn, latency);
+
+	return 0;
+}
+
+int get_latency(struct sensing_connection *conn, uint64_t *latency)
+{
+	__ASSERT(conn, "get latency, connection not be NULL");
+	*latency = conn->latency;
+
+	return 0;
+}
+#endif /* CONFIG_SENSING_BATCHING */
+
 int set_sensitivity(struct sensing_connection *conn, int8_t index, uint32_t sensitivity)
 {
 	int i;
@@ -14,6 +14,7 @@
 #include <zephyr/settings/settings.h>
 #include "settings/settings_file.h"
 #include <zephyr/kernel.h>
+#include "settings_priv.h"
 
 extern struct k_mutex settings_lock;
 
@@ -37,6 +38,11 @@ int settings_subsys_init(void)
 
 		if (!err) {
 			settings_subsys_initialized = true;
+
+			if (IS_ENABLED(CONFIG_SETTINGS_SNAPSHOT)) {
+				/* Without a snapshot the settings are loaded from the backends */
+				(void)settings_snapshot_init();
+			}
 		}
 	}
 
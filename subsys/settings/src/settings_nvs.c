@@ -30,12 +30,17 @@ struct settings_nvs_read_fn_arg {
 
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
+static ssize_t settings_nvs_load_one(struct settings_store *cs, const char *name,
+				     char *buf, size_t buf_len);
+static ssize_t settings_nvs_get_val_len(struct settings_store *cs, const char *name);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
 static void *settings_nvs_storage_get(struct settings_store *cs);
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
+	.csi_load_one = settings_nvs_load_one,
+	.csi_get_val_len = settings_nvs_get_val_len,
 	.csi_save = settings_nvs_save,
 	.csi_storage_get = settings_nvs_storage_get
 };
@@ -120,6 +125,89 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+/* Search for the NVS ID of the name entry that corresponds to name.
+ * Only name entries are read. If no such entry is found, returns
+ * NVS_NAMECNT_ID.
+ */
+static uint16_t settings_nvs_find_name_id(struct settings_nvs *cf, const char *name)
+{
+	char rdname[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t name_id;
+	ssize_t rc;
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	name_id = settings_nvs_cache_match(cf, name, rdname, sizeof(rdname));
+	if (name_id != NVS_NAMECNT_ID) {
+		return name_id;
+	}
+
+	/* The cache holds all names if it wasn't overflowed since loaded. */
+	if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
+		return NVS_NAMECNT_ID;
+	}
+#endif
+
+	for (name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &rdname, sizeof(rdname) - 1);
+		if ((rc <= 0) || (rc >= sizeof(rdname))) {
+			continue;
+		}
+
+		rdname[rc] = '\0';
+
+		if (!strcmp(name, rdname)) {
+			return name_id;
+		}
+	}
+
+	return NVS_NAMECNT_ID;
+}
+
+static ssize_t settings_nvs_load_one(struct settings_store *cs, const char *name,
+				     char *buf, size_t buf_len)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id;
+	ssize_t rc;
+
+	if (!name || !buf) {
+		return -EINVAL;
+	}
+
+	name_id = settings_nvs_find_name_id(cf, name);
+	if (name_id == NVS_NAMECNT_ID) {
+		return 0;
+	}
+
+	/* nvs_read returns the length of the whole value, even if larger
+	 * than buf_len.
+	 */
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, buf, buf_len);
+
+	return (rc == -ENOENT) ? 0 : rc;
+}
+
+static ssize_t settings_nvs_get_val_len(struct settings_store *cs, const char *name)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id;
+	char buf;
+	ssize_t rc;
+
+	if (!name) {
+		return -EINVAL;
+	}
+
+	name_id = settings_nvs_find_name_id(cf, name);
+	if (name_id == NVS_NAMECNT_ID) {
+		return 0;
+	}
+
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &buf, sizeof(buf));
+
+	return (rc == -ENOENT) ? 0 : rc;
+}
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -155,6 +243,22 @@ static int settings_nvs_load(struct settings_store *cs,
 		 * setting's value.
 		 */
 		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+		if ((rc1 > 0) && (rc1 < sizeof(name)) && arg->subtree) {
+			/* Found a name, this might not include a trailing \0 */
+			name[rc1] = '\0';
+
+			/* Don't look up the value of settings that are not
+			 * part of the subtree.
+			 */
+			if (!settings_name_steq(name, arg->subtree, NULL)) {
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+				settings_nvs_cache_add(cf, name, name_id);
+				cached++;
+#endif
+				continue;
+			}
+		}
+
 		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
 			       &buf, sizeof(buf));
 
@@ -107,6 +107,18 @@ void settings_line_io_init(int (*read_cb)(void *ctx, off_t off, char *buf,
 			  uint8_t io_rwbs);
 
 
+/* Open the settings snapshot, and check whether it is valid */
+int settings_snapshot_init(void);
+
+/*
+ * Load the settings from the snapshot, returns -ENOENT if there is no valid
+ * snapshot and the settings have to be loaded from the backends.
+ */
+int settings_snapshot_load(const struct settings_load_arg *arg);
+
+/* Invalidate the snapshot, before the settings are modified */
+void settings_snapshot_invalidate(void);
+
 extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
 extern struct settings_store *settings_save_dst;
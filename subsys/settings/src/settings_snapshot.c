@@ -0,0 +1,396 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Compacted snapshot of all the settings, so that settings_load() does not
+ * have to walk the storage of the backends.
+ *
+ * The snapshot partition holds a header, the records in arrival order and an
+ * index of the record offsets sorted by name:
+ *
+ *   | header | record | record | ... | offset | offset | ... |
+ *
+ * Each record is a 16-bit little endian value length, the NUL terminated name
+ * and the value. The snapshot is invalidated before any setting is written, so
+ * that a valid snapshot always matches the contents of the backends.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include "settings_priv.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
+
+#if DT_HAS_CHOSEN(zephyr_settings_snapshot_partition)
+#define SNAPSHOT_NODE DT_CHOSEN(zephyr_settings_snapshot_partition)
+#else
+#define SNAPSHOT_NODE DT_NODELABEL(settings_snapshot_partition)
+#endif
+
+BUILD_ASSERT(DT_FIXED_PARTITION_EXISTS(SNAPSHOT_NODE),
+	     "CONFIG_SETTINGS_SNAPSHOT needs a settings_snapshot_partition");
+
+#define SNAPSHOT_PARTITION DT_FIXED_PARTITION_ID(SNAPSHOT_NODE)
+#define SNAPSHOT_SIZE      DT_REG_SIZE(SNAPSHOT_NODE)
+
+#define SNAPSHOT_MAGIC   0x53534e50U /* "PNSS" */
+#define SNAPSHOT_VERSION 1U
+
+/* Length of the value, then the NUL terminated name */
+#define REC_HDR_LEN sizeof(uint16_t)
+
+struct snapshot_hdr {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+	/* Number of entries of the index */
+	uint32_t count;
+	/* Offset of the index */
+	uint32_t index_off;
+	/* CRC32 of everything after the header, up to the end of the index */
+	uint32_t crc;
+	uint32_t padding[3];
+};
+
+/* Large enough for flash devices with a write block of up to 32 bytes */
+BUILD_ASSERT(sizeof(struct snapshot_hdr) == 32);
+
+extern struct k_mutex settings_lock;
+
+static uint8_t snapshot_buf[SNAPSHOT_SIZE] __aligned(4);
+static const uint8_t *snapshot;
+static const struct flash_area *snapshot_fa;
+
+#if CONFIG_SETTINGS_SNAPSHOT_DELAY_MS > 0
+static void snapshot_work_handler(struct k_work *work)
+{
+	int rc = settings_snapshot_save();
+
+	if (rc != 0) {
+		LOG_WRN("settings snapshot not written (err %d)", rc);
+	}
+}
+
+static K_WORK_DELAYABLE_DEFINE(snapshot_work, snapshot_work_handler);
+#endif /* CONFIG_SETTINGS_SNAPSHOT_DELAY_MS > 0 */
+
+static const struct snapshot_hdr *snapshot_hdr(void)
+{
+	return (const struct snapshot_hdr *)snapshot;
+}
+
+static const char *rec_name(const uint8_t *base, uint32_t off)
+{
+	return (const char *)&base[off + REC_HDR_LEN];
+}
+
+static uint32_t snapshot_rec(size_t idx)
+{
+	const uint8_t *index = &snapshot[snapshot_hdr()->index_off];
+
+	return sys_get_le32(&index[idx * sizeof(uint32_t)]);
+}
+
+struct snapshot_read_arg {
+	const uint8_t *val;
+	size_t len;
+};
+
+static ssize_t snapshot_read_cb(void *cb_arg, void *data, size_t len)
+{
+	struct snapshot_read_arg *arg = cb_arg;
+
+	len = MIN(len, arg->len);
+	memcpy(data, arg->val, len);
+
+	return len;
+}
+
+int settings_snapshot_load(const struct settings_load_arg *arg)
+{
+	const char *subtree = (arg != NULL) ? arg->subtree : NULL;
+	size_t subtree_len = (subtree != NULL) ? strlen(subtree) : 0;
+	size_t lo = 0;
+	size_t hi;
+
+	if (snapshot == NULL) {
+		return -ENOENT;
+	}
+
+	hi = snapshot_hdr()->count;
+
+	/* The names of a subtree all start with it, so they are contiguous */
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (strncmp(rec_name(snapshot, snapshot_rec(mid)), subtree ? subtree : "",
+			    subtree_len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	for (size_t i = lo; i < snapshot_hdr()->count; i++) {
+		uint32_t off = snapshot_rec(i);
+		const char *name = rec_name(snapshot, off);
+		struct snapshot_read_arg read_arg;
+		int rc;
+
+		if (subtree_len > 0 && strncmp(name, subtree, subtree_len) != 0) {
+			break;
+		}
+
+		read_arg.len = sys_get_le16(&snapshot[off]);
+		read_arg.val = (const uint8_t *)name + strlen(name) + 1;
+
+		rc = settings_call_set_handler(name, read_arg.len, snapshot_read_cb, &read_arg,
+					       arg);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+void settings_snapshot_invalidate(void)
+{
+#if CONFIG_SETTINGS_SNAPSHOT_DELAY_MS > 0
+	if (snapshot_fa != NULL) {
+		/* Written again once no setting has been saved for a while */
+		(void)k_work_reschedule(&snapshot_work, K_MSEC(CONFIG_SETTINGS_SNAPSHOT_DELAY_MS));
+	}
+#endif /* CONFIG_SETTINGS_SNAPSHOT_DELAY_MS > 0 */
+
+	if (snapshot == NULL) {
+		return;
+	}
+
+	snapshot = NULL;
+
+	if (flash_area_flatten(snapshot_fa, 0, snapshot_fa->fa_size) != 0) {
+		LOG_ERR("failed to invalidate the settings snapshot");
+	}
+}
+
+struct snapshot_build {
+	/* End of the records, growing up */
+	size_t data_end;
+	/* Start of the unsorted index, growing down from the end of the buffer */
+	size_t index_start;
+	int rc;
+};
+
+static int snapshot_add_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			   void *param)
+{
+	struct snapshot_build *build = param;
+	size_t name_len = strlen(key) + 1;
+	size_t rec_len = REC_HDR_LEN + name_len + len;
+	ssize_t rc;
+
+	if (len > UINT16_MAX ||
+	    build->data_end + rec_len + sizeof(uint32_t) > build->index_start) {
+		build->rc = -ENOSPC;
+		return build->rc;
+	}
+
+	sys_put_le16(len, &snapshot_buf[build->data_end]);
+	memcpy(&snapshot_buf[build->data_end + REC_HDR_LEN], key, name_len);
+
+	rc = read_cb(cb_arg, &snapshot_buf[build->data_end + REC_HDR_LEN + name_len], len);
+	if (rc != len) {
+		build->rc = (rc < 0) ? rc : -EIO;
+		return build->rc;
+	}
+
+	build->index_start -= sizeof(uint32_t);
+	sys_put_le32(build->data_end, &snapshot_buf[build->index_start]);
+	build->data_end += rec_len;
+
+	return 0;
+}
+
+/* Sort by name, then by the order the records were loaded in */
+static int snapshot_rec_cmp(const void *a, const void *b)
+{
+	uint32_t off_a = sys_get_le32(a);
+	uint32_t off_b = sys_get_le32(b);
+	int rc = strcmp(rec_name(snapshot_buf, off_a), rec_name(snapshot_buf, off_b));
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	return (off_a > off_b) - (off_a < off_b);
+}
+
+/* Keep the last record of each name, and drop the deleted ones */
+static size_t snapshot_index_compact(uint8_t *index, size_t count)
+{
+	size_t kept = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		uint32_t off = sys_get_le32(&index[i * sizeof(uint32_t)]);
+
+		if (i + 1 < count &&
+		    strcmp(rec_name(snapshot_buf, off),
+			   rec_name(snapshot_buf,
+				    sys_get_le32(&index[(i + 1) * sizeof(uint32_t)]))) == 0) {
+			continue;
+		}
+
+		if (sys_get_le16(&snapshot_buf[off]) == 0) {
+			continue;
+		}
+
+		sys_put_le32(off, &index[kept * sizeof(uint32_t)]);
+		kept++;
+	}
+
+	return kept;
+}
+
+static int snapshot_write(size_t len)
+{
+	size_t align = flash_area_align(snapshot_fa);
+	size_t hdr_len = ROUND_UP(sizeof(struct snapshot_hdr), align);
+	int rc;
+
+	len = ROUND_UP(len, align);
+	if (len > snapshot_fa->fa_size || hdr_len != sizeof(struct snapshot_hdr)) {
+		return -ENOSPC;
+	}
+
+	rc = flash_area_flatten(snapshot_fa, 0, snapshot_fa->fa_size);
+	if (rc != 0) {
+		return rc;
+	}
+
+	/* The header goes last, so that an interrupted write is not valid */
+	rc = flash_area_write(snapshot_fa, hdr_len, &snapshot_buf[hdr_len], len - hdr_len);
+	if (rc != 0) {
+		return rc;
+	}
+
+	return flash_area_write(snapshot_fa, 0, snapshot_buf, hdr_len);
+}
+
+int settings_snapshot_save(void)
+{
+	struct snapshot_hdr *hdr = (struct snapshot_hdr *)snapshot_buf;
+	struct snapshot_build build = {
+		.data_end = sizeof(*hdr),
+		.index_start = sizeof(snapshot_buf),
+	};
+	size_t count;
+	int rc;
+
+	if (snapshot_fa == NULL) {
+		return -ENODEV;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	/* Load from the backends, the buffer holding the snapshot is reused */
+	snapshot = NULL;
+
+	(void)settings_load_subtree_direct(NULL, snapshot_add_cb, &build);
+	rc = build.rc;
+	if (rc != 0) {
+		goto out;
+	}
+
+	count = (sizeof(snapshot_buf) - build.index_start) / sizeof(uint32_t);
+	qsort(&snapshot_buf[build.index_start], count, sizeof(uint32_t), snapshot_rec_cmp);
+	count = snapshot_index_compact(&snapshot_buf[build.index_start], count);
+
+	/* Move the index right after the records */
+	build.data_end = ROUND_UP(build.data_end, sizeof(uint32_t));
+	memmove(&snapshot_buf[build.data_end], &snapshot_buf[build.index_start],
+		count * sizeof(uint32_t));
+
+	*hdr = (struct snapshot_hdr){
+		.magic = SNAPSHOT_MAGIC,
+		.version = SNAPSHOT_VERSION,
+		.count = count,
+		.index_off = build.data_end,
+	};
+	hdr->crc = crc32_ieee(&snapshot_buf[sizeof(*hdr)],
+			      build.data_end + count * sizeof(uint32_t) - sizeof(*hdr));
+
+	rc = snapshot_write(build.data_end + count * sizeof(uint32_t));
+	if (rc != 0) {
+		goto out;
+	}
+
+	snapshot = IS_ENABLED(CONFIG_SETTINGS_SNAPSHOT_XIP)
+			   ? (const uint8_t *)DT_FIXED_PARTITION_ADDR(SNAPSHOT_NODE)
+			   : snapshot_buf;
+
+	LOG_DBG("settings snapshot of %zu entries written", count);
+
+out:
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+static bool snapshot_is_valid(const uint8_t *base)
+{
+	const struct snapshot_hdr *hdr = (const struct snapshot_hdr *)base;
+	size_t end;
+
+	if (hdr->magic != SNAPSHOT_MAGIC || hdr->version != SNAPSHOT_VERSION ||
+	    hdr->index_off < sizeof(*hdr) || hdr->index_off > SNAPSHOT_SIZE ||
+	    hdr->count > (SNAPSHOT_SIZE - hdr->index_off) / sizeof(uint32_t)) {
+		return false;
+	}
+
+	end = hdr->index_off + hdr->count * sizeof(uint32_t);
+
+	return crc32_ieee(&base[sizeof(*hdr)], end - sizeof(*hdr)) == hdr->crc;
+}
+
+int settings_snapshot_init(void)
+{
+	const uint8_t *base = snapshot_buf;
+	int rc;
+
+	rc = flash_area_open(SNAPSHOT_PARTITION, &snapshot_fa);
+	if (rc != 0) {
+		LOG_ERR("failed to open the settings snapshot partition (err %d)", rc);
+		return rc;
+	}
+
+	if (IS_ENABLED(CONFIG_SETTINGS_SNAPSHOT_XIP)) {
+		base = (const uint8_t *)DT_FIXED_PARTITION_ADDR(SNAPSHOT_NODE);
+	} else {
+		/* A single sequential read of the whole snapshot */
+		rc = flash_area_read(snapshot_fa, 0, snapshot_buf, sizeof(snapshot_buf));
+		if (rc != 0) {
+			LOG_ERR("failed to read the settings snapshot (err %d)", rc);
+			return rc;
+		}
+	}
+
+	if (!snapshot_is_valid(base)) {
+		LOG_DBG("no valid settings snapshot");
+		return 0;
+	}
+
+	snapshot = base;
+
+	return 0;
+}
@@ -54,8 +54,10 @@ int settings_load_subtree(const char *subtree)
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
-	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
-		cs->cs_itf->csi_load(cs, &arg);
+	if (!IS_ENABLED(CONFIG_SETTINGS_SNAPSHOT) || settings_snapshot_load(&arg) == -ENOENT) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
+			cs->cs_itf->csi_load(cs, &arg);
+		}
 	}
 	rc = settings_commit_subtree(subtree);
 	k_mutex_unlock(&settings_lock);
@@ -81,8 +83,10 @@ int settings_load_subtree_direct(
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
-	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
-		cs->cs_itf->csi_load(cs, &arg);
+	if (!IS_ENABLED(CONFIG_SETTINGS_SNAPSHOT) || settings_snapshot_load(&arg) == -ENOENT) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
+			cs->cs_itf->csi_load(cs, &arg);
+		}
 	}
 	k_mutex_unlock(&settings_lock);
 	return 0;
@@ -219,6 +223,11 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 
 	k_mutex_lock(&settings_lock, K_FOREVER);
 
+	if (IS_ENABLED(CONFIG_SETTINGS_SNAPSHOT)) {
+		/* The snapshot must not outlive the values it holds */
+		settings_snapshot_invalidate();
+	}
+
 	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
 
 	k_mutex_unlock(&settings_lock);
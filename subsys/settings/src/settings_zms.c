@@ -354,8 +354,6 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		 */
 		rc1 = zms_read(&cf->cf_zms, ZMS_NAME_ID_FROM_LL_NODE(ll_hash_id), &name,
 			       sizeof(name) - 1);
-		/* get the length of data and verify that it exists */
-		rc2 = zms_get_data_length(&cf->cf_zms, ZMS_DATA_ID_FROM_LL_NODE(ll_hash_id));
 
 		/* updated the next linked list node in case the called handler will
 		 * delete this settings entry.
@@ -366,6 +364,21 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 			return ret;
 		}
 
+		if (rc1 > 0) {
+			/* Found a name, this might not include a trailing \0 */
+			name[rc1] = '\0';
+
+			/* Don't look up the data of settings that are not part of the
+			 * subtree.
+			 */
+			if (arg->subtree && !settings_name_steq(name, arg->subtree, NULL)) {
+				continue;
+			}
+		}
+
+		/* get the length of data and verify that it exists */
+		rc2 = zms_get_data_length(&cf->cf_zms, ZMS_DATA_ID_FROM_LL_NODE(prev_ll_hash_id));
+
 		if ((rc1 <= 0) || (rc2 <= 0)) {
 			/* In case we are not updating the linked list, this is an empty mode
 			 * Just continue
@@ -383,8 +396,6 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 			continue;
 		}
 
-		/* Found a name, this might not include a trailing \0 */
-		name[rc1] = '\0';
 		read_fn_arg.fs = &cf->cf_zms;
 		read_fn_arg.id = ZMS_DATA_ID_FROM_LL_NODE(prev_ll_hash_id);
 
@@ -28,13 +28,61 @@ NET_BUF_POOL_DEFINE(smp_shell_rx_pool, CONFIG_MCUMGR_TRANSPORT_SHELL_RX_BUF_COUN
 		    SMP_SHELL_RX_BUF_SIZE, 0, NULL);
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
 
+#define ASYNC_TX_BUFFERED (CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_BUFFER_SIZE > 0)
+
+static void async_tx_start(struct shell_uart_async *sh_uart)
+{
+	uint8_t *data;
+	size_t len;
+	int err;
+
+	while (true) {
+		len = ring_buf_get_claim(&sh_uart->tx_ringbuf, &data,
+					 sizeof(sh_uart->tx_buf));
+		if (len == 0) {
+			atomic_clear(&sh_uart->tx_busy);
+
+			/* Data may have been added before the flag was cleared. */
+			if (ring_buf_is_empty(&sh_uart->tx_ringbuf) ||
+			    atomic_set(&sh_uart->tx_busy, 1) != 0) {
+				return;
+			}
+
+			continue;
+		}
+
+		sh_uart->tx_len = len;
+		err = uart_tx(sh_uart->common.dev, data, len, SYS_FOREVER_US);
+		if (err == 0) {
+			return;
+		}
+
+		/* Drop the data that cannot be sent so that writers do not stall. */
+		ring_buf_get_finish(&sh_uart->tx_ringbuf, len);
+		sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
+	}
+}
+
+static void async_tx_done(struct shell_uart_async *sh_uart)
+{
+	if (!ASYNC_TX_BUFFERED) {
+		k_sem_give(&sh_uart->tx_sem);
+		return;
+	}
+
+	ring_buf_get_finish(&sh_uart->tx_ringbuf, sh_uart->tx_len);
+	sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
+	async_tx_start(sh_uart);
+}
+
 static void async_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	struct shell_uart_async *sh_uart = (struct shell_uart_async *)user_data;
 
 	switch (evt->type) {
 	case  UART_TX_DONE:
-		k_sem_give(&sh_uart->tx_sem);
+	case  UART_TX_ABORTED:
+		async_tx_done(sh_uart);
 		break;
 	case  UART_RX_RDY:
 		uart_async_rx_on_rdy(&sh_uart->async_rx, evt->data.rx.buf, evt->data.rx.len);
@@ -187,7 +235,13 @@ static void uart_tx_handle(const struct device *dev, struct shell_uart_int_drive
 		ARG_UNUSED(err);
 	} else {
 		uart_irq_tx_disable(dev);
-		sh_uart->tx_busy = 0;
+		atomic_clear(&sh_uart->tx_busy);
+
+		/* Data may have been added before the flag was cleared. */
+		if (!ring_buf_is_empty(&sh_uart->tx_ringbuf) &&
+		    atomic_set(&sh_uart->tx_busy, 1) == 0) {
+			uart_irq_tx_enable(dev);
+		}
 	}
 
 	sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
@@ -244,6 +298,10 @@ static void async_init(struct shell_uart_async *sh_uart)
 	};
 
 	k_sem_init(&sh_uart->tx_sem, 0, 1);
+	if (ASYNC_TX_BUFFERED) {
+		ring_buf_init(&sh_uart->tx_ringbuf, sizeof(sh_uart->tx_buf), sh_uart->tx_buf);
+		atomic_clear(&sh_uart->tx_busy);
+	}
 
 	err = uart_async_rx_init(async_rx, &sh_uart->async_rx_config);
 	(void)err;
@@ -389,6 +447,16 @@ static int async_write(struct shell_uart_async *sh_uart,
 {
 	int err;
 
+	if (ASYNC_TX_BUFFERED) {
+		*cnt = ring_buf_put(&sh_uart->tx_ringbuf, data, length);
+
+		if (atomic_set(&sh_uart->tx_busy, 1) == 0) {
+			async_tx_start(sh_uart);
+		}
+
+		return 0;
+	}
+
 	err = uart_tx(sh_uart->common.dev, data, length, SYS_FOREVER_US);
 	if (err < 0) {
 		*cnt = 0;
@@ -0,0 +1,57 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <stdlib.h>
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+struct init_print_data {
+	const struct shell *sh;
+	size_t remaining;
+};
+
+static void init_print_cb(const struct init_time_stat *stat, void *user_data)
+{
+	struct init_print_data *data = user_data;
+
+	if (data->remaining == 0) {
+		return;
+	}
+
+	data->remaining--;
+
+	if (stat->entry->dev != NULL) {
+		shell_print(data->sh, "%10u %-12s %s", k_cyc_to_us_floor32(stat->cycles),
+			    sys_init_level_name(stat->level), stat->entry->dev->name);
+	} else {
+		shell_print(data->sh, "%10u %-12s SYS_INIT %p", k_cyc_to_us_floor32(stat->cycles),
+			    sys_init_level_name(stat->level), (void *)stat->entry->init_fn);
+	}
+}
+
+static int cmd_kernel_init(const struct shell *sh, size_t argc, char **argv)
+{
+	struct init_print_data data = {
+		.sh = sh,
+		.remaining = SIZE_MAX,
+	};
+
+	if (argc > 1) {
+		data.remaining = strtoul(argv[1], NULL, 10);
+	}
+
+	shell_print(sh, "   time us level        entry");
+	sys_init_time_stats_foreach(init_print_cb, &data);
+
+	return 0;
+}
+
+KERNEL_CMD_ARG_ADD(init, NULL, "Init time statistics, longest first. Can be called with a maximum count",
+		   cmd_kernel_init, 1, 1);
@@ -0,0 +1,43 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+static void count_balanced_cb(const struct k_thread *thread, void *user_data)
+{
+	unsigned int *balanced = user_data;
+
+	if (thread->base.balance_mask != 0U) {
+		for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+			if ((thread->base.cpu_mask & BIT(i)) != 0U) {
+				balanced[i]++;
+			}
+		}
+	}
+}
+
+static int cmd_kernel_load(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	unsigned int balanced[CONFIG_MP_MAX_NUM_CPUS] = {0};
+
+	k_thread_foreach(count_balanced_cb, balanced);
+
+	shell_print(sh, "CPU   load  balanced threads");
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		int load = k_sched_cpu_load_get(i);
+
+		shell_print(sh, "%3u %3d.%d%% %u", i, load / 10, load % 10, balanced[i]);
+	}
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(load, NULL, "Per-CPU load over the last balancing period.", cmd_kernel_load);
@@ -48,6 +48,12 @@ static void rt_stats_dump(const struct shell *sh, struct k_thread *thread)
 		shell_print(sh, "\tAverage execution cycles: %u",
 			    (uint32_t)rt_stats_thread.average_cycles);
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+		shell_print(sh, "\tPeak wake latency cycles: %u",
+			    (uint32_t)rt_stats_thread.wake_peak_cycles);
+		shell_print(sh, "\tAverage wake latency cycles: %u",
+			    (uint32_t)rt_stats_thread.wake_average_cycles);
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
 	} else {
 		shell_print(sh, "\tTotal execution cycles: ? (? %%)");
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -55,6 +61,10 @@ static void rt_stats_dump(const struct shell *sh, struct k_thread *thread)
 		shell_print(sh, "\tPeak execution cycles: ?");
 		shell_print(sh, "\tAverage execution cycles: ?");
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+		shell_print(sh, "\tPeak wake latency cycles: ?");
+		shell_print(sh, "\tAverage wake latency cycles: ?");
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
 	}
 }
 #endif /* CONFIG_THREAD_RUNTIME_STATS */
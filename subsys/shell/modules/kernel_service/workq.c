@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/obj_core.h>
+
+struct workq_walk {
+	const struct shell *sh;
+	bool reset;
+};
+
+/* Too large for the shell stack */
+static struct k_work_q_stats workq_stats;
+
+static void workq_print_hist(const struct shell *sh, const char *title, const uint32_t *hist)
+{
+	shell_fprintf(sh, SHELL_NORMAL, "\t%-7s", title);
+
+	for (size_t i = 0; i < CONFIG_OBJ_CORE_STATS_WORK_Q_BUCKETS; i++) {
+		shell_fprintf(sh, SHELL_NORMAL, " %u", hist[i]);
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+}
+
+static int workq_walk(struct k_obj_core *obj_core, void *data)
+{
+	struct workq_walk *walk = data;
+	const struct shell *sh = walk->sh;
+	struct k_work_q *queue = CONTAINER_OF(obj_core, struct k_work_q, obj_core);
+	k_tid_t thread = k_work_queue_thread_get(queue);
+	const char *name = (thread != NULL) ? k_thread_name_get(thread) : NULL;
+
+	if (walk->reset) {
+		(void)k_obj_core_stats_reset(obj_core);
+		return 0;
+	}
+
+	if (k_obj_core_stats_raw(obj_core, &workq_stats, sizeof(workq_stats)) != 0) {
+		return 0;
+	}
+
+	shell_print(sh, "%p %s", queue, ((name != NULL) && (name[0] != '\0')) ? name : "NA");
+
+	for (size_t i = 0; i < ARRAY_SIZE(workq_stats.handlers); i++) {
+		const struct k_work_handler_stats *stats = &workq_stats.handlers[i];
+
+		if (stats->handler == NULL) {
+			break;
+		}
+
+		shell_print(sh, "  handler %p: %u runs, run max %u us avg %llu us, delay max %u us",
+			    stats->handler, stats->count, stats->run_max_us,
+			    stats->run_total_us / MAX(stats->count, 1U), stats->delay_max_us);
+		workq_print_hist(sh, "run", stats->run_hist);
+		workq_print_hist(sh, "delay", stats->delay_hist);
+	}
+
+	if (workq_stats.untracked != 0U) {
+		shell_print(sh, "  %u runs of untracked handlers", workq_stats.untracked);
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_workq(const struct shell *sh, size_t argc, char **argv)
+{
+	struct workq_walk walk = {
+		.sh = sh,
+		.reset = false,
+	};
+	struct k_obj_type *type;
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") != 0) {
+			shell_error(sh, "Unsupported option: %s", argv[1]);
+			return -EINVAL;
+		}
+		walk.reset = true;
+	}
+
+	type = k_obj_type_find(K_OBJ_TYPE_WORK_Q_ID);
+	if (type == NULL) {
+		return -ENOEXEC;
+	}
+
+	if (!walk.reset) {
+		shell_print(sh, "Histogram bucket i > 0 counts durations of 2^(i-1) to 2^i us");
+	}
+
+	/* Work queues are only unlinked when started again */
+	(void)k_obj_type_walk_unlocked(type, workq_walk, &walk);
+
+	return 0;
+}
+
+KERNEL_CMD_ARG_ADD(workq, NULL,
+		   "Work queue statistics per work handler. Call with \"reset\" to clear them.",
+		   cmd_kernel_workq, 1, 1);
@@ -337,10 +337,17 @@ static void find_completion_candidates(const struct shell *sh,
 	size_t incompl_cmd_len;
 	size_t idx = 0;
 
+	bool sorted = (cmd == NULL) && z_shell_root_cmds_sorted();
+
 	incompl_cmd_len = z_shell_strlen(incompl_cmd);
 	*longest = 0U;
 	*cnt = 0;
 
+	if (sorted && incompl_cmd_len > 0) {
+		/* Candidates are adjacent, skip the commands before them. */
+		idx = z_shell_root_cmd_lower_bound(incompl_cmd, true);
+	}
+
 	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
 		bool is_candidate;
 		is_candidate = is_completion_candidate(candidate->syntax,
@@ -351,6 +358,8 @@ static void find_completion_candidates(const struct shell *sh,
 				*first_idx = idx;
 			}
 			(*cnt)++;
+		} else if (sorted && *cnt > 0) {
+			break;
 		}
 
 		idx++;
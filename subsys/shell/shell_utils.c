@@ -266,12 +266,97 @@ static inline uint32_t shell_root_cmd_count(void)
 	return len;
 }
 
+/* Root commands are sorted by the linker by section name, which is the command
+ * syntax followed by '_'. Compare strings in the same order. If @p prefix is
+ * true, 0 is returned when @p str is a prefix of that name.
+ */
+static int root_cmd_cmp(const char *syntax, const char *str, bool prefix)
+{
+	size_t len1 = strlen(syntax);
+	size_t len2 = strlen(str);
+	size_t key1 = len1 + 1;
+	size_t key2 = prefix ? len2 : len2 + 1;
+
+	for (size_t i = 0; i < MIN(key1, key2); i++) {
+		uint8_t c1 = (i < len1) ? (uint8_t)syntax[i] : '_';
+		uint8_t c2 = (i < len2) ? (uint8_t)str[i] : '_';
+
+		if (c1 != c2) {
+			return c1 - c2;
+		}
+	}
+
+	if (prefix && key2 <= key1) {
+		return 0;
+	}
+
+	return (key1 < key2) ? -1 : (key1 > key2);
+}
+
+bool z_shell_root_cmds_sorted(void)
+{
+	static int8_t sorted = -1;
+
+	/* Not all toolchains sort the section, check it once. */
+	if (sorted < 0) {
+		const size_t cmd_count = shell_root_cmd_count();
+		bool res = true;
+
+		for (size_t idx = 1; idx < cmd_count; idx++) {
+			if (root_cmd_cmp(shell_root_cmd_get(idx - 1)->entry->syntax,
+					 shell_root_cmd_get(idx)->entry->syntax, false) > 0) {
+				res = false;
+				break;
+			}
+		}
+
+		sorted = res ? 1 : 0;
+	}
+
+	return sorted == 1;
+}
+
+size_t z_shell_root_cmd_lower_bound(const char *str, bool prefix)
+{
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
+
+	if (str == NULL || !z_shell_root_cmds_sorted()) {
+		return 0;
+	}
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (root_cmd_cmp(shell_root_cmd_get(mid)->entry->syntax, str, prefix) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
 	const size_t cmd_count = shell_root_cmd_count();
 	const union shell_cmd_entry *cmd;
 
+	if (z_shell_root_cmds_sorted()) {
+		size_t cmd_idx = z_shell_root_cmd_lower_bound(syntax, false);
+
+		if (cmd_idx < cmd_count) {
+			cmd = shell_root_cmd_get(cmd_idx);
+			if (strcmp(syntax, cmd->entry->syntax) == 0) {
+				return cmd->entry;
+			}
+		}
+
+		return NULL;
+	}
+
 	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
 		cmd = shell_root_cmd_get(cmd_idx);
 		if (strcmp(syntax, cmd->entry->syntax) == 0) {
@@ -343,16 +428,18 @@ const struct shell_static_entry *z_shell_find_cmd(
 	struct shell_static_entry parent_cpy;
 	size_t idx = 0;
 
+	if (parent == NULL) {
+		return root_cmd_find(cmd_str);
+	}
+
 	/* Dynamic command operates on shared memory. If we are processing two
 	 * dynamic commands at the same time (current and subcommand) they
 	 * will operate on the same memory region what can cause undefined
 	 * behaviour.
 	 * Hence we need a separate memory for each of them.
 	 */
-	if (parent) {
-		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
-		parent = &parent_cpy;
-	}
+	memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
+	parent = &parent_cpy;
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
 		if (strcmp(cmd_str, entry->syntax) == 0) {
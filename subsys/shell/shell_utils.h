@@ -83,6 +83,15 @@ void z_shell_cmd_trim(const struct shell *sh);
 
 const struct shell_static_entry *root_cmd_find(const char *syntax);
 
+/* Returns true if root commands can be looked up with a binary search. */
+bool z_shell_root_cmds_sorted(void);
+
+/* Returns index of the first root command that is not ordered before @p str,
+ * or 0 if root commands are not sorted. If @p prefix is true, it is the first
+ * root command that may start with @p str.
+ */
+size_t z_shell_root_cmd_lower_bound(const char *str, bool prefix);
+
 static inline void z_transport_buffer_flush(const struct shell *sh)
 {
 	z_shell_fprintf_buffer_flush(sh->fprintf_ctx);
@@ -13,6 +13,8 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 #include <zephyr/types.h>
 #include <string.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 
 #include <zephyr/storage/stream_flash.h>
 
@@ -39,6 +41,9 @@ static int settings_direct_loader(const char *key, size_t len,
 		/* Check that loaded progress is not outdated. */
 		if (bytes_written >= ctx->bytes_written) {
 			ctx->bytes_written = bytes_written;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+			ctx->bytes_queued = bytes_written;
+#endif
 		} else {
 			LOG_WRN("Loaded outdated bytes_written %zu < %zu",
 				bytes_written, ctx->bytes_written);
@@ -184,7 +189,8 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+/* Write buf_bytes of buf to flash, right after the bytes already written */
+static int flash_program(struct stream_flash_ctx *ctx, uint8_t *buf, size_t buf_bytes)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
@@ -192,33 +198,28 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
-		rc = stream_flash_erase_to_append(ctx, ctx->buf_bytes);
+		rc = stream_flash_erase_to_append(ctx, buf_bytes);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_forward_erase %d range=0x%08zx",
-				rc, ctx->buf_bytes);
+				rc, buf_bytes);
 			return rc;
 		}
 	}
 
 	fill_length = ctx->write_block_size;
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = ctx->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -232,18 +233,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
@@ -252,12 +252,155 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 
 #endif
 
-	ctx->bytes_written += ctx->buf_bytes;
+	ctx->bytes_written += buf_bytes;
+
+	return rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = flash_program(ctx, ctx->buf, ctx->buf_bytes);
+	if (rc == 0) {
+		ctx->buf_bytes = 0U;
+	}
+
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+static K_THREAD_STACK_DEFINE(stream_flash_workq_stack, CONFIG_STREAM_FLASH_WORKQ_STACK_SIZE);
+static struct k_work_q stream_flash_workq;
+
+static void flash_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx, work);
+	int rc;
+
+	rc = flash_program(ctx, ctx->flash_buf, ctx->flash_buf_bytes);
+
+	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE) && (rc == 0)) {
+		/* Erase what the next buffer needs while it is being filled. On failure
+		 * the erase is retried, and reported, when the buffer is written.
+		 */
+		(void)stream_flash_erase_to_append(ctx, MIN(ctx->buf_len,
+							    ctx->available - ctx->bytes_written));
+	}
+
+	ctx->work_rc = rc;
+	k_sem_give(&ctx->idle);
+}
+
+/* Hand the full buffer over to the work queue and continue with the other one */
+static int flash_submit(struct stream_flash_ctx *ctx)
+{
+	uint8_t *buf;
+	int rc;
+
+	if (ctx->flash_buf == NULL) {
+		return flash_sync(ctx);
+	}
+
+	(void)k_sem_take(&ctx->idle, K_FOREVER);
+
+	/* A failed write is reported until the context is re-initialized */
+	rc = ctx->work_rc;
+	if (rc != 0) {
+		k_sem_give(&ctx->idle);
+		return rc;
+	}
+
+	buf = ctx->flash_buf;
+	ctx->flash_buf = ctx->buf;
+	ctx->flash_buf_bytes = ctx->buf_bytes;
+	ctx->bytes_queued += ctx->buf_bytes;
+	ctx->buf = buf;
 	ctx->buf_bytes = 0U;
 
+	(void)k_work_submit_to_queue(&stream_flash_workq, &ctx->work);
+
+	return 0;
+}
+
+static int flash_flush(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	if (ctx->flash_buf == NULL) {
+		return flash_sync(ctx);
+	}
+
+	(void)k_sem_take(&ctx->idle, K_FOREVER);
+
+	rc = ctx->work_rc;
+	if (rc == 0) {
+		rc = flash_sync(ctx);
+		ctx->bytes_queued = ctx->bytes_written;
+	}
+
+	k_sem_give(&ctx->idle);
+
 	return rc;
 }
 
+static inline size_t flash_bytes_queued(const struct stream_flash_ctx *ctx)
+{
+	return (ctx->flash_buf == NULL) ? ctx->bytes_written : ctx->bytes_queued;
+}
+
+int stream_flash_double_buffer_set(struct stream_flash_ctx *ctx, uint8_t *buf)
+{
+	if (!ctx || !buf) {
+		return -EFAULT;
+	}
+
+	if (ctx->flash_buf != NULL) {
+		return -EALREADY;
+	}
+
+	k_work_init(&ctx->work, flash_work_handler);
+	k_sem_init(&ctx->idle, 1, 1);
+	ctx->work_rc = 0;
+	ctx->bytes_queued = ctx->bytes_written;
+	ctx->flash_buf = buf;
+
+	return 0;
+}
+
+static int stream_flash_workq_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "stream_flash_workq"};
+
+	k_work_queue_start(&stream_flash_workq, stream_flash_workq_stack,
+			   K_THREAD_STACK_SIZEOF(stream_flash_workq_stack),
+			   CONFIG_STREAM_FLASH_WORKQ_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static inline int flash_submit(struct stream_flash_ctx *ctx)
+{
+	return flash_sync(ctx);
+}
+
+static inline int flash_flush(struct stream_flash_ctx *ctx)
+{
+	return flash_sync(ctx);
+}
+
+static inline size_t flash_bytes_queued(const struct stream_flash_ctx *ctx)
+{
+	return ctx->bytes_written;
+}
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
@@ -269,7 +412,7 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (flash_bytes_queued(ctx) + ctx->buf_bytes + len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -279,7 +422,7 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		       buf_empty_bytes);
 
 		ctx->buf_bytes = ctx->buf_len;
-		rc = flash_sync(ctx);
+		rc = flash_submit(ctx);
 
 		if (rc != 0) {
 			return rc;
@@ -295,8 +438,8 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		ctx->buf_bytes += len - processed;
 	}
 
-	if (flush && ctx->buf_bytes > 0) {
-		rc = flash_sync(ctx);
+	if (flush) {
+		rc = flash_flush(ctx);
 	}
 
 	return rc;
@@ -405,6 +548,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->erased_up_to = 0;
+#endif
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	ctx->flash_buf = NULL;
 #endif
 	ctx->erase_value = params->erase_value;
 
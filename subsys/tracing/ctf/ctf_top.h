@@ -49,10 +49,23 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));              \
 	}
 
+/*
+ * The timestamp is the low 32 bits of the time in nanoseconds, the trace
+ * reader extends it to 64 bits through the clock mapping of the metadata. This
+ * requires the 64-bit time to be continuous, so use the 64-bit cycle counter
+ * when available, the 32-bit one wraps at a value which is not a power of two
+ * once converted to nanoseconds.
+ */
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+#define CTF_TIMESTAMP() ((uint32_t)k_cyc_to_ns_floor64(k_cycle_get_64()))
+#else
+#define CTF_TIMESTAMP() ((uint32_t)k_cyc_to_ns_floor64(k_cycle_get_32()))
+#endif
+
 #ifdef CONFIG_TRACING_CTF_TIMESTAMP
 #define CTF_EVENT(...)                                                         \
 	{                                                                      \
-		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32()); \
+		const uint32_t tstamp = CTF_TIMESTAMP();                       \
 									       \
 		CTF_GATHER_FIELDS(tstamp, __VA_ARGS__)                         \
 	}
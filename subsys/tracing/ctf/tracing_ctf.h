@@ -266,6 +266,12 @@ extern "C" {
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)
 #define sys_port_trace_k_msgq_get_blocking(msgq, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_put_n_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_n_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_n_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_n_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_n_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_n_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
 
@@ -6,24 +6,121 @@
 
 #include <ctype.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/tracing/tracing_ram.h>
 #include <string.h>
 #include <tracing_core.h>
 #include <tracing_buffer.h>
 #include <tracing_backend.h>
 
-uint8_t ram_tracing[CONFIG_RAM_TRACING_BUFFER_SIZE];
+#define BUF_SIZE CONFIG_RAM_TRACING_BUFFER_SIZE
+
+uint8_t ram_tracing[BUF_SIZE];
 static uint32_t pos;
+static atomic_t frozen;
+
+#ifdef CONFIG_TRACING_BACKEND_RAM_CIRCULAR
+/*
+ * Each packet is stored with a 16-bit length prefix, so that the oldest
+ * packets can be dropped one at a time to make room for new ones, and the
+ * recorded data always starts on a packet boundary. pos is the write position
+ * and tail the position of the oldest packet, both wrap at the end of the
+ * buffer.
+ */
+#define HDR_SIZE sizeof(uint16_t)
+
+static uint32_t tail;
+static uint32_t used;
+
+static void ram_copy_in(uint32_t at, const uint8_t *data, uint32_t length)
+{
+	uint32_t first = MIN(length, BUF_SIZE - at);
+
+	memcpy(&ram_tracing[at], data, first);
+	memcpy(&ram_tracing[0], data + first, length - first);
+}
+
+static void ram_copy_out(uint32_t at, uint8_t *data, uint32_t length)
+{
+	uint32_t first = MIN(length, BUF_SIZE - at);
+
+	memcpy(data, &ram_tracing[at], first);
+	memcpy(data + first, &ram_tracing[0], length - first);
+}
+
+static uint16_t ram_packet_len(uint32_t at)
+{
+	uint16_t length;
+
+	ram_copy_out(at, (uint8_t *)&length, HDR_SIZE);
+
+	return length;
+}
+
+static void tracing_backend_ram_output(
+		const struct tracing_backend *backend,
+		uint8_t *data, uint32_t length)
+{
+	uint32_t needed = length + HDR_SIZE;
+	uint16_t hdr = length;
+
+	if (atomic_get(&frozen) || needed > BUF_SIZE || length > UINT16_MAX) {
+		return;
+	}
+
+	/* Drop the oldest packets until there is enough room */
+	while (BUF_SIZE - used < needed) {
+		uint32_t dropped = ram_packet_len(tail) + HDR_SIZE;
+
+		tail = (tail + dropped) % BUF_SIZE;
+		used -= dropped;
+	}
+
+	ram_copy_in(pos, (uint8_t *)&hdr, HDR_SIZE);
+	ram_copy_in((pos + HDR_SIZE) % BUF_SIZE, data, length);
+	pos = (pos + needed) % BUF_SIZE;
+	used += needed;
+}
+
+size_t tracing_ram_read(size_t offset, uint8_t *buf, size_t len)
+{
+	uint32_t at = tail;
+	uint32_t left = used;
+	size_t copied = 0;
+
+	while (left > 0U && copied < len) {
+		uint16_t length = ram_packet_len(at);
+		uint32_t start = (at + HDR_SIZE) % BUF_SIZE;
+
+		if (offset >= length) {
+			offset -= length;
+		} else {
+			uint32_t n = MIN(length - offset, len - copied);
+
+			ram_copy_out((start + offset) % BUF_SIZE, buf + copied, n);
+			copied += n;
+			offset = 0;
+		}
+
+		at = (start + length) % BUF_SIZE;
+		left -= length + HDR_SIZE;
+	}
+
+	return copied;
+}
+#else
 static bool buffer_full;
 
 static void tracing_backend_ram_output(
 		const struct tracing_backend *backend,
 		uint8_t *data, uint32_t length)
 {
-	if (buffer_full) {
+	if (buffer_full || atomic_get(&frozen)) {
 		return;
 	}
 
-	if ((pos + length) > CONFIG_RAM_TRACING_BUFFER_SIZE) {
+	if ((pos + length) > BUF_SIZE) {
 		buffer_full = true;
 		return;
 	}
@@ -32,11 +129,50 @@ static void tracing_backend_ram_output(
 	pos += length;
 }
 
+size_t tracing_ram_read(size_t offset, uint8_t *buf, size_t len)
+{
+	if (offset >= pos) {
+		return 0;
+	}
+
+	len = MIN(len, pos - offset);
+	memcpy(buf, &ram_tracing[offset], len);
+
+	return len;
+}
+#endif /* CONFIG_TRACING_BACKEND_RAM_CIRCULAR */
+
 static void tracing_backend_ram_init(void)
 {
-	memset(ram_tracing, 0, CONFIG_RAM_TRACING_BUFFER_SIZE);
+	memset(ram_tracing, 0, BUF_SIZE);
 	pos = 0;
+#ifdef CONFIG_TRACING_BACKEND_RAM_CIRCULAR
+	tail = 0;
+	used = 0;
+#else
 	buffer_full = false;
+#endif
+	atomic_clear(&frozen);
+}
+
+void tracing_ram_freeze(void)
+{
+	/* Wait for a packet being recorded on another CPU */
+	TRACING_LOCK();
+	atomic_set(&frozen, 1);
+	TRACING_UNLOCK();
+}
+
+void tracing_ram_unfreeze(void)
+{
+	TRACING_LOCK();
+	tracing_backend_ram_init();
+	TRACING_UNLOCK();
+}
+
+bool tracing_ram_is_frozen(void)
+{
+	return atomic_get(&frozen) != 0;
 }
 
 const struct tracing_backend_api tracing_backend_ram_api = {
@@ -46,6 +46,8 @@ LOG_MODULE_REGISTER(usbd_cdc_acm, CONFIG_USBD_CDC_ACM_LOG_LEVEL);
 #define CDC_ACM_IRQ_TX_ENABLED		3
 #define CDC_ACM_RX_FIFO_BUSY		4
 #define CDC_ACM_TX_FIFO_BUSY		5
+#define CDC_ACM_ASYNC_TX_BUSY		6
+#define CDC_ACM_ASYNC_TX_ABORT		7
 
 struct cdc_acm_uart_fifo {
 	struct ring_buf *rb;
@@ -123,10 +125,47 @@ struct cdc_acm_uart_data {
 	struct k_work rx_fifo_work;
 	atomic_t state;
 	struct k_sem notif_sem;
+#ifdef CONFIG_UART_ASYNC_API
+	/* UART API async callback */
+	uart_callback_t async_cb;
+	/* UART API async callback user data */
+	void *async_cb_data;
+	/* Buffer passed to uart_tx(), NULL when there is no transmission */
+	const uint8_t *async_tx_buf;
+	size_t async_tx_len;
+	/* Number of bytes already sent and number of bytes in transfer */
+	size_t async_tx_done;
+	size_t async_tx_inflight;
+	/* Set when the last transfer length was a multiple of the MPS */
+	bool async_tx_zlp;
+	/* USBD CDC ACM async TX work */
+	struct k_work_delayable async_tx_work;
+	/* USBD CDC ACM async TX timeout work */
+	struct k_work_delayable async_tx_timeout_work;
+#endif
 };
 
 static void cdc_acm_irq_rx_enable(const struct device *dev);
 
+#ifdef CONFIG_UART_ASYNC_API
+static bool cdc_acm_async_tx_complete(struct cdc_acm_uart_data *const data,
+				      const int err);
+
+/* Buffers referencing the uart_tx() data, one per instance */
+NET_BUF_POOL_FIXED_DEFINE(cdc_acm_tx_view_pool,
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT), 0,
+			  sizeof(struct udc_buf_info), NULL);
+#else
+static inline bool cdc_acm_async_tx_complete(struct cdc_acm_uart_data *const data,
+					     const int err)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(err);
+
+	return false;
+}
+#endif
+
 #if CONFIG_USBD_CDC_ACM_BUF_POOL
 UDC_BUF_POOL_DEFINE(cdc_acm_ep_pool,
 		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
@@ -291,7 +330,8 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 			atomic_clear_bit(&data->state, CDC_ACM_RX_FIFO_BUSY);
 		}
 
-		if (bi->ep == cdc_acm_get_bulk_in(c_data)) {
+		if (bi->ep == cdc_acm_get_bulk_in(c_data) &&
+		    !cdc_acm_async_tx_complete(data, err)) {
 			atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
 		}
 
@@ -316,7 +356,8 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 		cdc_acm_work_submit(&data->rx_fifo_work);
 	}
 
-	if (bi->ep == cdc_acm_get_bulk_in(c_data)) {
+	if (bi->ep == cdc_acm_get_bulk_in(c_data) &&
+	    !cdc_acm_async_tx_complete(data, 0)) {
 		/* TX transfer completion */
 		if (data->cb) {
 			cdc_acm_work_submit(&data->irq_cb_work);
@@ -329,6 +370,12 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 			cdc_acm_work_schedule(&data->tx_fifo_work, K_NO_WAIT);
 		}
 
+#ifdef CONFIG_UART_ASYNC_API
+		if (data->async_tx_buf != NULL) {
+			/* Continue with pending uart_tx() data */
+			cdc_acm_work_schedule(&data->async_tx_work, K_NO_WAIT);
+		}
+#endif
 	}
 
 	if (bi->ep == cdc_acm_get_int_in(c_data)) {
@@ -1013,7 +1060,8 @@ static void cdc_acm_poll_out(const struct device *dev, const unsigned char c)
 	 * one byte per USB transfer. The latency increase is negligible while
 	 * the increased throughput and reduced CPU usage is easily observable.
 	 */
-	cdc_acm_work_schedule(&data->tx_fifo_work, K_MSEC(1));
+	cdc_acm_work_schedule(&data->tx_fifo_work,
+			      K_USEC(CONFIG_USBD_CDC_ACM_TX_COALESCE_US));
 }
 
 #ifdef CONFIG_UART_LINE_CTRL
@@ -1113,6 +1161,229 @@ static int cdc_acm_config_get(const struct device *dev,
 }
 #endif /* CONFIG_UART_USE_RUNTIME_CONFIGURE */
 
+#ifdef CONFIG_UART_ASYNC_API
+static void cdc_acm_async_tx_finish(struct cdc_acm_uart_data *const data,
+				    const enum uart_event_type type)
+{
+	struct uart_event evt = {
+		.type = type,
+		.data.tx.buf = data->async_tx_buf,
+		.data.tx.len = data->async_tx_done,
+	};
+
+	(void)k_work_cancel_delayable(&data->async_tx_timeout_work);
+	atomic_clear_bit(&data->state, CDC_ACM_ASYNC_TX_ABORT);
+	data->async_tx_buf = NULL;
+
+	if (data->async_cb) {
+		data->async_cb(data->dev, &evt, data->async_cb_data);
+	}
+}
+
+/* Called on bulk IN transfer completion, returns true if the transfer was
+ * queued by the async TX handler.
+ */
+static bool cdc_acm_async_tx_complete(struct cdc_acm_uart_data *const data,
+				      const int err)
+{
+	if (!atomic_test_bit(&data->state, CDC_ACM_ASYNC_TX_BUSY)) {
+		return false;
+	}
+
+	if (err) {
+		atomic_set_bit(&data->state, CDC_ACM_ASYNC_TX_ABORT);
+	} else {
+		data->async_tx_done += data->async_tx_inflight;
+	}
+
+	data->async_tx_inflight = 0;
+	atomic_clear_bit(&data->state, CDC_ACM_ASYNC_TX_BUSY);
+	atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+	cdc_acm_work_schedule(&data->async_tx_work, K_NO_WAIT);
+
+	return true;
+}
+
+static struct net_buf *cdc_acm_async_tx_buf(struct cdc_acm_uart_data *const data,
+					    struct usbd_class_data *const c_data)
+{
+	const uint8_t *src = data->async_tx_buf + data->async_tx_done;
+	size_t len = data->async_tx_len - data->async_tx_done;
+	struct net_buf *buf;
+	struct udc_buf_info *bi;
+
+	if (len == 0) {
+		/* Zero-length packet terminating the transfer */
+		return cdc_acm_buf_alloc(c_data, cdc_acm_get_bulk_in(c_data));
+	}
+
+	if (IS_UDC_ALIGNED(src) && !IS_ENABLED(CONFIG_UDC_BUF_FORCE_NOCACHE)) {
+		/* Submit the remaining data directly, the UDC driver splits
+		 * it into packets.
+		 */
+		buf = net_buf_alloc_with_data(&cdc_acm_tx_view_pool, (void *)src,
+					      len, K_NO_WAIT);
+		if (buf == NULL) {
+			return NULL;
+		}
+
+		bi = udc_get_buf_info(buf);
+		memset(bi, 0, sizeof(struct udc_buf_info));
+		bi->ep = cdc_acm_get_bulk_in(c_data);
+
+		return buf;
+	}
+
+	/* The buffer is not suitable for the UDC driver, copy a chunk */
+	buf = cdc_acm_buf_alloc(c_data, cdc_acm_get_bulk_in(c_data));
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	net_buf_add_mem(buf, src, MIN(len, net_buf_tailroom(buf)));
+
+	return buf;
+}
+
+static void cdc_acm_async_tx_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct cdc_acm_uart_data *data;
+	const struct cdc_acm_uart_config *cfg;
+	struct usbd_class_data *c_data;
+	struct net_buf *buf;
+	int ret;
+
+	data = CONTAINER_OF(dwork, struct cdc_acm_uart_data, async_tx_work);
+	cfg = data->dev->config;
+	c_data = cfg->c_data;
+
+	if (data->async_tx_buf == NULL ||
+	    atomic_test_bit(&data->state, CDC_ACM_ASYNC_TX_BUSY)) {
+		/* Nothing to do or transfer completion will resubmit the work */
+		if (atomic_test_bit(&data->state, CDC_ACM_ASYNC_TX_ABORT) &&
+		    data->async_tx_buf != NULL) {
+			(void)usbd_ep_dequeue(usbd_class_get_ctx(c_data),
+					      cdc_acm_get_bulk_in(c_data));
+		}
+
+		return;
+	}
+
+	if (atomic_test_bit(&data->state, CDC_ACM_ASYNC_TX_ABORT)) {
+		cdc_acm_async_tx_finish(data, UART_TX_ABORTED);
+		return;
+	}
+
+	if (data->async_tx_done == data->async_tx_len && !data->async_tx_zlp) {
+		cdc_acm_async_tx_finish(data, UART_TX_DONE);
+		return;
+	}
+
+	if (!atomic_test_bit(&data->state, CDC_ACM_CLASS_ENABLED) ||
+	    atomic_test_bit(&data->state, CDC_ACM_CLASS_SUSPENDED)) {
+		/* As with poll out, the data is discarded if there is no host */
+		LOG_DBG("USB configuration is not enabled or suspended");
+		data->async_tx_done = data->async_tx_len;
+		cdc_acm_async_tx_finish(data, UART_TX_DONE);
+		return;
+	}
+
+	if (atomic_test_and_set_bit(&data->state, CDC_ACM_TX_FIFO_BUSY)) {
+		LOG_DBG("TX transfer already in progress");
+		return;
+	}
+
+	buf = cdc_acm_async_tx_buf(data, c_data);
+	if (buf == NULL) {
+		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+		cdc_acm_work_schedule(&data->async_tx_work, K_MSEC(1));
+		return;
+	}
+
+	data->async_tx_inflight = buf->len;
+	data->async_tx_zlp = buf->len != 0 &&
+			     buf->len % cdc_acm_get_bulk_mps(c_data) == 0 &&
+			     data->async_tx_done + buf->len == data->async_tx_len;
+	atomic_set_bit(&data->state, CDC_ACM_ASYNC_TX_BUSY);
+
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue");
+		net_buf_unref(buf);
+		data->async_tx_inflight = 0;
+		atomic_clear_bit(&data->state, CDC_ACM_ASYNC_TX_BUSY);
+		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+		cdc_acm_async_tx_finish(data, UART_TX_ABORTED);
+	}
+}
+
+static void cdc_acm_async_tx_timeout_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct cdc_acm_uart_data *data;
+
+	data = CONTAINER_OF(dwork, struct cdc_acm_uart_data, async_tx_timeout_work);
+
+	atomic_set_bit(&data->state, CDC_ACM_ASYNC_TX_ABORT);
+	cdc_acm_async_tx_handler(&data->async_tx_work.work);
+}
+
+static int cdc_acm_callback_set(const struct device *dev,
+				const uart_callback_t cb,
+				void *const user_data)
+{
+	struct cdc_acm_uart_data *const data = dev->data;
+
+	data->async_cb = cb;
+	data->async_cb_data = user_data;
+
+	return 0;
+}
+
+static int cdc_acm_tx(const struct device *dev, const uint8_t *const buf,
+		      const size_t len, const int32_t timeout)
+{
+	struct cdc_acm_uart_data *const data = dev->data;
+	unsigned int lock;
+
+	lock = irq_lock();
+	if (data->async_tx_buf != NULL) {
+		irq_unlock(lock);
+		return -EBUSY;
+	}
+
+	data->async_tx_buf = buf;
+	irq_unlock(lock);
+
+	data->async_tx_len = len;
+	data->async_tx_done = 0;
+	data->async_tx_zlp = false;
+
+	if (timeout != SYS_FOREVER_US) {
+		cdc_acm_work_schedule(&data->async_tx_timeout_work, K_USEC(timeout));
+	}
+
+	cdc_acm_work_schedule(&data->async_tx_work, K_NO_WAIT);
+
+	return 0;
+}
+
+static int cdc_acm_tx_abort(const struct device *dev)
+{
+	struct cdc_acm_uart_data *const data = dev->data;
+
+	if (data->async_tx_buf == NULL) {
+		return -EFAULT;
+	}
+
+	atomic_set_bit(&data->state, CDC_ACM_ASYNC_TX_ABORT);
+	cdc_acm_work_schedule(&data->async_tx_work, K_NO_WAIT);
+
+	return 0;
+}
+#endif /* CONFIG_UART_ASYNC_API */
+
 static int usbd_cdc_acm_preinit(const struct device *dev)
 {
 	struct cdc_acm_uart_data *const data = dev->data;
@@ -1123,6 +1394,11 @@ static int usbd_cdc_acm_preinit(const struct device *dev)
 	k_work_init_delayable(&data->tx_fifo_work, cdc_acm_tx_fifo_handler);
 	k_work_init(&data->rx_fifo_work, cdc_acm_rx_fifo_handler);
 	k_work_init(&data->irq_cb_work, cdc_acm_irq_cb_handler);
+#ifdef CONFIG_UART_ASYNC_API
+	k_work_init_delayable(&data->async_tx_work, cdc_acm_async_tx_handler);
+	k_work_init_delayable(&data->async_tx_timeout_work,
+			      cdc_acm_async_tx_timeout_handler);
+#endif
 
 	return 0;
 }
@@ -1149,6 +1425,11 @@ static DEVICE_API(uart, cdc_acm_uart_api) = {
 	.configure = cdc_acm_configure,
 	.config_get = cdc_acm_config_get,
 #endif
+#ifdef CONFIG_UART_ASYNC_API
+	.callback_set = cdc_acm_callback_set,
+	.tx = cdc_acm_tx,
+	.tx_abort = cdc_acm_tx_abort,
+#endif
 };
 
 struct usbd_class_api usbd_cdc_acm_api = {
@@ -35,15 +35,19 @@ enum {
 	CDC_NCM_IFACE_UP,
 	CDC_NCM_DATA_IFACE_ENABLED,
 	CDC_NCM_CLASS_SUSPENDED,
-	CDC_NCM_OUT_ENGAGED,
 };
 
 /* Chapter 6.2.7 table 6-4 */
 #define CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_MAX_DGRAM_PER_NTB
 #define CDC_NCM_RECV_NTB_MAX_SIZE 2048
 
-#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB 1
-#define CDC_NCM_SEND_NTB_MAX_SIZE 2048
+#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB
+#define CDC_NCM_SEND_NTB_MAX_SIZE CONFIG_USBD_CDC_NCM_TX_NTB_MAX_SIZE
+#define CDC_NCM_SEND_NTB_MIN_SIZE 2048
+
+#define CDC_NCM_RX_TRANSFERS CONFIG_USBD_CDC_NCM_RX_TRANSFERS
+#define CDC_NCM_RX_BUF_COUNT \
+	(CDC_NCM_RX_TRANSFERS * (IS_ENABLED(CONFIG_USBD_CDC_NCM_RX_ZERO_COPY) ? 2 : 1))
 
 /* Chapter 6.3 table 6-5 and 6-6 */
 struct cdc_ncm_notification {
@@ -170,15 +174,40 @@ union recv_ntb {
 	uint8_t data[CDC_NCM_RECV_NTB_MAX_SIZE];
 } __packed;
 
+/* The datagrams of a sent NTB follow its datagram pointer table */
+#define CDC_NCM_SEND_DGRAM_OFFSET \
+	ROUND_UP(offsetof(union send_ntb, ndp_datagram) + \
+		 (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) * sizeof(struct ndp16_datagram), \
+		 CDC_NCM_ALIGNMENT)
+
 /*
- * Transfers through two endpoints proceed in a synchronous manner,
- * with maximum block of CDC_NCM_SEND_NTB_MAX_SIZE.
+ * Each instance has one NTB being filled with datagrams to send and one in
+ * transfer on the bulk IN endpoint.
  */
 UDC_BUF_POOL_DEFINE(cdc_ncm_ep_pool,
 		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
-		    MAX(CDC_NCM_SEND_NTB_MAX_SIZE, CDC_NCM_RECV_NTB_MAX_SIZE),
+		    CDC_NCM_SEND_NTB_MAX_SIZE,
 		    sizeof(struct udc_buf_info), NULL);
 
+/*
+ * Each instance has CDC_NCM_RX_TRANSFERS NTBs queued on the bulk OUT
+ * endpoint, and as many held by the network stack with zero-copy reception.
+ */
+UDC_BUF_POOL_DEFINE(cdc_ncm_out_pool,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CDC_NCM_RX_BUF_COUNT,
+		    CDC_NCM_RECV_NTB_MAX_SIZE,
+		    sizeof(struct udc_buf_info), NULL);
+
+#if defined(CONFIG_USBD_CDC_NCM_RX_ZERO_COPY)
+static void cdc_ncm_rx_view_destroy(struct net_buf *view);
+
+/* Views of received datagrams, each holding a reference to its NTB buffer */
+NET_BUF_POOL_FIXED_DEFINE(cdc_ncm_rx_view_pool,
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CDC_NCM_RX_BUF_COUNT *
+			  MAX(CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB, 1),
+			  0, sizeof(struct net_buf *), cdc_ncm_rx_view_destroy);
+#endif
+
 /*
  * Collection of descriptors used to assemble specific function descriptors.
  * This structure is used by CDC NCM implementation to update and fetch
@@ -230,8 +259,21 @@ struct cdc_ncm_eth_data {
 	uint16_t tx_seq;
 	uint16_t rx_seq;
 
+	/* Protects the NTB being filled and the TX transfer state */
+	struct k_mutex tx_lock;
+	struct net_buf *tx_ntb;
+	uint16_t tx_dgrams;
+	bool tx_busy;
+	/* NTB limits, which the host may lower with SetNtbInputSize */
+	uint32_t tx_ntb_max_size;
+	uint16_t tx_ntb_max_dgrams;
+
+	/* Given when a TX transfer is done */
 	struct k_sem sync_sem;
 
+	atomic_t out_queued;
+	struct k_work_delayable out_work;
+
 	struct k_work_delayable notif_work;
 };
 
@@ -299,12 +341,13 @@ static uint8_t cdc_ncm_get_bulk_out(struct usbd_class_data *const c_data)
 	return desc->if1_1_out_ep.bEndpointAddress;
 }
 
-static struct net_buf *cdc_ncm_buf_alloc(const uint8_t ep)
+static struct net_buf *cdc_ncm_buf_alloc(struct net_buf_pool *const pool,
+					 const uint8_t ep)
 {
 	struct net_buf *buf = NULL;
 	struct udc_buf_info *bi;
 
-	buf = net_buf_alloc(&cdc_ncm_ep_pool, K_NO_WAIT);
+	buf = net_buf_alloc(pool, K_NO_WAIT);
 	if (!buf) {
 		return NULL;
 	}
@@ -315,6 +358,7 @@ static struct net_buf *cdc_ncm_buf_alloc(const uint8_t ep)
 	return buf;
 }
 
+/* Queue OUT transfers until CDC_NCM_RX_TRANSFERS are pending */
 static int cdc_ncm_out_start(struct usbd_class_data *const c_data)
 {
 	const struct device *dev = usbd_class_get_private(c_data);
@@ -323,25 +367,41 @@ static int cdc_ncm_out_start(struct usbd_class_data *const c_data)
 	uint8_t ep;
 	int ret;
 
-	if (atomic_test_and_set_bit(&data->state, CDC_NCM_OUT_ENGAGED)) {
-		return -EBUSY;
-	}
-
 	ep = cdc_ncm_get_bulk_out(c_data);
-	buf = cdc_ncm_buf_alloc(ep);
-	if (buf == NULL) {
-		return -ENOMEM;
-	}
 
-	ret = usbd_ep_enqueue(c_data, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
-		net_buf_unref(buf);
-	} else {
+	while (atomic_inc(&data->out_queued) < CDC_NCM_RX_TRANSFERS) {
+		buf = cdc_ncm_buf_alloc(&cdc_ncm_out_pool, ep);
+		if (buf == NULL) {
+			/* The network stack still holds the NTB buffers */
+			atomic_dec(&data->out_queued);
+			(void)k_work_reschedule(&data->out_work, K_MSEC(1));
+			return -ENOMEM;
+		}
+
+		ret = usbd_ep_enqueue(c_data, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			atomic_dec(&data->out_queued);
+			net_buf_unref(buf);
+			return ret;
+		}
+
 		LOG_DBG("enqueue out %u", buf->size);
 	}
 
-	return  ret;
+	atomic_dec(&data->out_queued);
+
+	return 0;
+}
+
+static void cdc_ncm_out_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct cdc_ncm_eth_data *data = CONTAINER_OF(dwork, struct cdc_ncm_eth_data, out_work);
+
+	if (atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+		(void)cdc_ncm_out_start(data->c_data);
+	}
 }
 
 static int verify_nth16(struct cdc_ncm_eth_data *const data,
@@ -503,6 +563,88 @@ static int check_frame(struct cdc_ncm_eth_data *data, struct net_buf *const buf)
 
 #define NET_PKT_ALLOC_TIMEOUT 100 /* ms */
 
+#if defined(CONFIG_USBD_CDC_NCM_RX_ZERO_COPY)
+static void cdc_ncm_rx_view_destroy(struct net_buf *view)
+{
+	struct net_buf *ntb = *(struct net_buf **)net_buf_user_data(view);
+
+	net_buf_destroy(view);
+	net_buf_unref(ntb);
+}
+
+/* Pass a datagram to the network stack as a view of the NTB buffer */
+static struct net_pkt *cdc_ncm_rx_view(struct cdc_ncm_eth_data *const data,
+				       struct net_buf *const buf,
+				       const uint16_t start, const uint16_t len)
+{
+	struct net_buf *view;
+	struct net_pkt *pkt;
+
+	view = net_buf_alloc_with_data(&cdc_ncm_rx_view_pool, buf->data + start, len,
+				       K_NO_WAIT);
+	if (view == NULL) {
+		return NULL;
+	}
+
+	*(struct net_buf **)net_buf_user_data(view) = net_buf_ref(buf);
+
+	pkt = net_pkt_rx_alloc_on_iface(data->iface, K_MSEC(NET_PKT_ALLOC_TIMEOUT));
+	if (pkt == NULL) {
+		net_buf_unref(view);
+		return NULL;
+	}
+
+	net_pkt_append_buffer(pkt, view);
+
+	return pkt;
+}
+#else
+static struct net_pkt *cdc_ncm_rx_view(struct cdc_ncm_eth_data *const data,
+				       struct net_buf *const buf,
+				       const uint16_t start, const uint16_t len)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(start);
+	ARG_UNUSED(len);
+
+	return NULL;
+}
+#endif
+
+/* Copy a datagram from the NTB buffer to a new packet */
+static struct net_pkt *cdc_ncm_rx_copy(struct cdc_ncm_eth_data *const data,
+				       struct net_pkt *const src,
+				       const uint16_t start, const uint16_t len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_rx_alloc_with_buffer(data->iface, len, AF_UNSPEC, 0, K_FOREVER);
+	if (!pkt) {
+		LOG_ERR("No memory for net_pkt");
+		return NULL;
+	}
+
+	net_pkt_cursor_init(src);
+
+	ret = net_pkt_skip(src, start);
+	if (ret < 0) {
+		LOG_ERR("Cannot advance pkt by %u bytes (%d)", start, ret);
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	ret = net_pkt_copy(pkt, src, len);
+	if (ret < 0) {
+		LOG_ERR("Cannot copy data (%d)", ret);
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	return pkt;
+}
+
 static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 			      struct net_buf *const buf, const int err)
 {
@@ -512,11 +654,13 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 	const struct ndp16_datagram *ndp_datagram;
 	const struct nth16 *nthdr16;
 	const struct ndp16 *ndp;
-	struct net_pkt *pkt, *src;
+	struct net_pkt *pkt, *src = NULL;
 	uint16_t start, len;
 	uint16_t count;
 	int ret;
 
+	atomic_dec(&data->out_queued);
+
 	if (err || buf->len == 0) {
 		if (err != -ECONNABORTED) {
 			LOG_ERR("Bulk OUT transfer error (%d) or zero length", err);
@@ -531,18 +675,6 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 		goto restart_out_transfer;
 	}
 
-	/* Temporary source pkt we use to copy one Ethernet frame from
-	 * the list of USB net_buf's.
-	 */
-	src = net_pkt_alloc(K_MSEC(NET_PKT_ALLOC_TIMEOUT));
-	if (src == NULL) {
-		LOG_ERR("src packet alloc fail");
-		goto restart_out_transfer;
-	}
-
-	net_pkt_append_buffer(src, buf);
-	net_pkt_set_overwrite(src, true);
-
 	nthdr16 = &ntb->nth;
 	LOG_DBG("NTH16: wSequence %u wBlockLength %u wNdpIndex %u",
 		nthdr16->wSequence, nthdr16->wBlockLength, nthdr16->wNdpIndex);
@@ -571,26 +703,26 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 			break;
 		}
 
-		pkt = net_pkt_rx_alloc_with_buffer(data->iface, len, AF_UNSPEC, 0, K_FOREVER);
-		if (!pkt) {
-			LOG_ERR("No memory for net_pkt");
-			goto unref_packet;
-		}
-
-		net_pkt_cursor_init(src);
-
-		ret = net_pkt_skip(src, start);
-		if (ret < 0) {
-			LOG_ERR("Cannot advance pkt by %u bytes (%d)", start, ret);
-			net_pkt_unref(pkt);
-			goto unref_packet;
-		}
-
-		ret = net_pkt_copy(pkt, src, len);
-		if (ret < 0) {
-			LOG_ERR("Cannot copy data (%d)", ret);
-			net_pkt_unref(pkt);
-			goto unref_packet;
+		pkt = cdc_ncm_rx_view(data, buf, start, len);
+		if (pkt == NULL) {
+			if (src == NULL) {
+				/* Temporary source pkt we use to copy one Ethernet
+				 * frame from the list of USB net_buf's.
+				 */
+				src = net_pkt_alloc(K_MSEC(NET_PKT_ALLOC_TIMEOUT));
+				if (src == NULL) {
+					LOG_ERR("src packet alloc fail");
+					goto restart_out_transfer;
+				}
+
+				net_pkt_append_buffer(src, buf);
+				net_pkt_set_overwrite(src, true);
+			}
+
+			pkt = cdc_ncm_rx_copy(data, src, start, len);
+			if (pkt == NULL) {
+				break;
+			}
 		}
 
 		LOG_DBG("Received packet len %zu", net_pkt_get_len(pkt));
@@ -601,14 +733,14 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 		}
 	}
 
-unref_packet:
-	src->buffer = NULL;
-	net_pkt_unref(src);
+	if (src != NULL) {
+		src->buffer = NULL;
+		net_pkt_unref(src);
+	}
 
 restart_out_transfer:
 	net_buf_unref(buf);
 
-	atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
 	if (atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
 		return cdc_ncm_out_start(c_data);
 	}
@@ -638,6 +770,63 @@ static void ncm_handle_notifications(const struct device *dev, const int err)
 	}
 }
 
+/* Must be called with the TX lock held */
+static int cdc_ncm_ntb_send(struct cdc_ncm_eth_data *const data)
+{
+	struct usbd_class_data *c_data = data->c_data;
+	struct net_buf *buf = data->tx_ntb;
+	union send_ntb *ntb = (union send_ntb *)buf->data;
+	int ret;
+
+	data->tx_ntb = NULL;
+
+	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
+	ntb->nth.wBlockLength = sys_cpu_to_le16(buf->len);
+
+	LOG_DBG("Sending NTB of %u datagrams, len %u", data->tx_dgrams, buf->len);
+
+	if (buf->len % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue NTB (%d)", ret);
+		net_buf_unref(buf);
+		return ret;
+	}
+
+	data->tx_busy = true;
+
+	return 0;
+}
+
+static void cdc_ncm_acl_in_cb(const struct device *dev,
+			      struct net_buf *const buf, const int err)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (err && err != -ECONNABORTED) {
+		LOG_ERR("Bulk IN transfer error (%d)", err);
+	}
+
+	net_buf_unref(buf);
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	data->tx_busy = false;
+
+	/* Send the datagrams aggregated while this NTB was in transfer */
+	if (data->tx_ntb != NULL && data->tx_dgrams > 0 &&
+	    atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+		(void)cdc_ncm_ntb_send(data);
+	}
+
+	k_mutex_unlock(&data->tx_lock);
+
+	k_sem_give(&data->sync_sem);
+}
+
 static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
 				struct net_buf *buf, int err)
 {
@@ -654,7 +843,7 @@ static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
 	}
 
 	if (bi->ep == cdc_ncm_get_bulk_in(c_data)) {
-		k_sem_give(&data->sync_sem);
+		cdc_ncm_acl_in_cb(dev, buf, err);
 		return 0;
 	}
 
@@ -840,7 +1029,21 @@ static void usbd_cdc_ncm_update(struct usbd_class_data *const c_data,
 
 	if (data_iface == iface && alternate == 0) {
 		atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+		(void)k_work_cancel_delayable(&data->out_work);
+
+		k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+		if (data->tx_ntb != NULL) {
+			net_buf_unref(data->tx_ntb);
+			data->tx_ntb = NULL;
+		}
+
 		data->tx_seq = 0;
+		data->tx_ntb_max_size = CDC_NCM_SEND_NTB_MAX_SIZE;
+		data->tx_ntb_max_dgrams = CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB;
+
+		k_mutex_unlock(&data->tx_lock);
+
 		data->rx_seq = 0;
 	}
 
@@ -886,6 +1089,42 @@ static void usbd_cdc_ncm_resumed(struct usbd_class_data *const c_data)
 	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
 }
 
+static void cdc_ncm_set_ntb_input_size(struct usbd_class_data *const c_data,
+				       const struct net_buf *const buf)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	uint32_t size;
+
+	if (buf == NULL || buf->len < sizeof(uint32_t)) {
+		errno = EINVAL;
+		return;
+	}
+
+	size = sys_get_le32(buf->data);
+	if (size < CDC_NCM_SEND_NTB_MIN_SIZE) {
+		LOG_DBG("SetNtbInputSize %u too small", size);
+		errno = EINVAL;
+		return;
+	}
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	data->tx_ntb_max_size = MIN(size, CDC_NCM_SEND_NTB_MAX_SIZE);
+
+	/* The 8 bytes form also limits the number of datagrams */
+	if (buf->len >= sizeof(struct ntb_input_size) &&
+	    sys_get_le16(&buf->data[sizeof(uint32_t)]) != 0) {
+		data->tx_ntb_max_dgrams = MIN(sys_get_le16(&buf->data[sizeof(uint32_t)]),
+					      CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB);
+	}
+
+	k_mutex_unlock(&data->tx_lock);
+
+	LOG_DBG("SetNtbInputSize %u, %u datagrams", data->tx_ntb_max_size,
+		data->tx_ntb_max_dgrams);
+}
+
 static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
 			    const struct usb_setup_packet *const setup,
 			    const struct net_buf *const buf)
@@ -898,8 +1137,7 @@ static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
 		}
 
 		if (setup->bRequest == SET_NTB_INPUT_SIZE) {
-			LOG_DBG("bRequest 0x%02x (%s) not implemented",
-				setup->bRequest, "SetNtbInputSize");
+			cdc_ncm_set_ntb_input_size(c_data, buf);
 			return 0;
 		}
 
@@ -952,14 +1190,16 @@ static int usbd_cdc_ncm_cth(struct usbd_class_data *const c_data,
 	}
 
 	case GET_NTB_INPUT_SIZE: {
+		const struct device *dev = usbd_class_get_private(c_data);
+		struct cdc_ncm_eth_data *data = dev->data;
 		struct ntb_input_size input_size = {
-			.dwNtbInMaxSize = sys_cpu_to_le32(CDC_NCM_SEND_NTB_MAX_SIZE),
-			.wNtbInMaxDatagrams = sys_cpu_to_le16(CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB),
+			.dwNtbInMaxSize = sys_cpu_to_le32(data->tx_ntb_max_size),
+			.wNtbInMaxDatagrams = sys_cpu_to_le16(data->tx_ntb_max_dgrams),
 			.wReserved = sys_cpu_to_le16(0),
 		};
 
 		LOG_DBG("GET_NTB_INPUT_SIZE");
-		net_buf_add_mem(buf, &input_size, sizeof(input_size));
+		net_buf_add_mem(buf, &input_size, MIN(setup->wLength, sizeof(input_size)));
 		break;
 	}
 
@@ -1020,13 +1260,69 @@ static void *usbd_cdc_ncm_get_desc(struct usbd_class_data *const c_data,
 	return data->fs_desc;
 }
 
+/* Must be called with the TX lock held */
+static struct net_buf *cdc_ncm_ntb_alloc(struct cdc_ncm_eth_data *const data)
+{
+	struct net_buf *buf;
+	union send_ntb *ntb;
+
+	buf = cdc_ncm_buf_alloc(&cdc_ncm_ep_pool, cdc_ncm_get_bulk_in(data->c_data));
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	ntb = (union send_ntb *)net_buf_add(buf, CDC_NCM_SEND_DGRAM_OFFSET);
+	memset(ntb, 0, CDC_NCM_SEND_DGRAM_OFFSET);
+
+	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
+	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
+	ntb->ndp.wLength = sys_cpu_to_le16(sizeof(struct ndp16) +
+					   (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) *
+					   sizeof(struct ndp16_datagram));
+	ntb->ndp.wNextNdpIndex = 0;
+
+	data->tx_dgrams = 0;
+
+	return buf;
+}
+
+/* Must be called with the TX lock held */
+static bool cdc_ncm_ntb_fits(struct cdc_ncm_eth_data *const data, const size_t len)
+{
+	return data->tx_dgrams < data->tx_ntb_max_dgrams &&
+	       ROUND_UP(data->tx_ntb->len, CDC_NCM_ALIGNMENT) + len <= data->tx_ntb_max_size;
+}
+
+/* Must be called with the TX lock held */
+static int cdc_ncm_ntb_add(struct cdc_ncm_eth_data *const data,
+			   struct net_pkt *const pkt, const size_t len)
+{
+	struct net_buf *buf = data->tx_ntb;
+	union send_ntb *ntb = (union send_ntb *)buf->data;
+	size_t offset = ROUND_UP(buf->len, CDC_NCM_ALIGNMENT);
+
+	if (net_pkt_read(pkt, buf->data + offset, len)) {
+		LOG_ERR("Failed copy net_pkt");
+		return -ENOBUFS;
+	}
+
+	memset(buf->data + buf->len, 0, offset - buf->len);
+	net_buf_add(buf, offset - buf->len + len);
+
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramIndex = sys_cpu_to_le16(offset);
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_dgrams++;
+
+	return 0;
+}
+
 static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 {
 	struct cdc_ncm_eth_data *const data = dev->data;
-	struct usbd_class_data *c_data = data->c_data;
 	size_t len = net_pkt_get_len(pkt);
-	struct net_buf *buf;
-	union send_ntb *ntb;
+	int ret;
 
 	if (len > NET_ETH_MAX_FRAME_SIZE) {
 		LOG_WRN("Trying to send too large packet, drop");
@@ -1041,53 +1337,40 @@ static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 		return -EACCES;
 	}
 
-	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(c_data));
-	if (buf == NULL) {
-		LOG_ERR("Failed to allocate buffer");
-		return -ENOMEM;
-	}
-
-	ntb = (union send_ntb *)buf->data;
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
 
-	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
-	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
-	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
-	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
-	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
-	ntb->ndp.wLength = sys_cpu_to_le16(sizeof(struct ndp16) +
-					   (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) *
-					   sizeof(struct ndp16_datagram));
-	ntb->ndp.wNextNdpIndex = 0;
-	ntb->ndp_datagram[0].wDatagramIndex =
-		sys_cpu_to_le16(sys_le16_to_cpu(ntb->nth.wHeaderLength) +
-				sys_le16_to_cpu(ntb->ndp.wLength));
-	ntb->ndp_datagram[0].wDatagramLength = sys_cpu_to_le16(len);
-	ntb->ndp_datagram[1].wDatagramIndex  = 0;
-	ntb->ndp_datagram[1].wDatagramLength = 0;
-	ntb->nth.wBlockLength = sys_cpu_to_le16(
-		sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex) + len);
-
-	net_buf_add(buf, sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex));
-
-	if (net_pkt_read(pkt, buf->data + buf->len, len)) {
-		LOG_ERR("Failed copy net_pkt");
-		net_buf_unref(buf);
+	/* The datagram is aggregated in the NTB being filled while the previous
+	 * one is in transfer. A full NTB is sent once the transfer is done.
+	 */
+	while (data->tx_ntb != NULL && !cdc_ncm_ntb_fits(data, len)) {
+		if (!data->tx_busy) {
+			(void)cdc_ncm_ntb_send(data);
+			continue;
+		}
 
-		return -ENOBUFS;
+		k_mutex_unlock(&data->tx_lock);
+		(void)k_sem_take(&data->sync_sem, K_FOREVER);
+		k_mutex_lock(&data->tx_lock, K_FOREVER);
 	}
 
-	net_buf_add(buf, len);
-
-	if (sys_le16_to_cpu(ntb->nth.wBlockLength) % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
-		udc_ep_buf_set_zlp(buf);
+	if (data->tx_ntb == NULL) {
+		data->tx_ntb = cdc_ncm_ntb_alloc(data);
+		if (data->tx_ntb == NULL) {
+			LOG_ERR("Failed to allocate buffer");
+			ret = -ENOMEM;
+			goto out;
+		}
 	}
 
-	usbd_ep_enqueue(c_data, buf);
-	k_sem_take(&data->sync_sem, K_FOREVER);
+	ret = cdc_ncm_ntb_add(data, pkt, len);
+	if (ret == 0 && !data->tx_busy) {
+		ret = cdc_ncm_ntb_send(data);
+	}
 
-	net_buf_unref(buf);
+out:
+	k_mutex_unlock(&data->tx_lock);
 
-	return 0;
+	return ret;
 }
 
 static int cdc_ncm_set_config(const struct device *dev,
@@ -1165,6 +1448,10 @@ static int usbd_cdc_ncm_preinit(const struct device *dev)
 	struct cdc_ncm_eth_data *data = dev->data;
 
 	k_work_init_delayable(&data->notif_work, send_notification_work);
+	k_work_init_delayable(&data->out_work, cdc_ncm_out_work);
+	k_mutex_init(&data->tx_lock);
+	data->tx_ntb_max_size = CDC_NCM_SEND_NTB_MAX_SIZE;
+	data->tx_ntb_max_dgrams = CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB;
 
 	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
 		gen_random_mac(data->mac_addr, 0, 0, 0);
@@ -67,6 +67,14 @@ UDC_BUF_POOL_DEFINE(msc_ep_pool,
 		    MSC_NUM_INSTANCES * 2, MSC_BUF_SIZE,
 		    sizeof(struct udc_buf_info), NULL);
 
+/* Data stage buffers, whole packets that can hold the SCSI buffer contents */
+#define MSC_DATA_BUF_SIZE ROUND_UP(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE, MSC_BUF_SIZE)
+#define MSC_DATA_BUFS CONFIG_USBD_MSC_DATA_BUFFERS
+
+UDC_BUF_POOL_DEFINE(msc_data_pool,
+		    MSC_NUM_INSTANCES * MSC_DATA_BUFS, MSC_DATA_BUF_SIZE,
+		    sizeof(struct udc_buf_info), NULL);
+
 struct msc_event {
 	struct usbd_class_data *c_data;
 	/* NULL to request Bulk-Only Mass Storage Reset
@@ -76,8 +84,11 @@ struct msc_event {
 	int err;
 };
 
-/* Each instance has 2 endpoints and can receive bulk only reset command */
-K_MSGQ_DEFINE(msc_msgq, sizeof(struct msc_event), MSC_NUM_INSTANCES * 3, 4);
+/* Each instance has up to MSC_DATA_BUFS data buffers queued per endpoint,
+ * CBW and CSW buffers, and can receive bulk only reset command.
+ */
+K_MSGQ_DEFINE(msc_msgq, sizeof(struct msc_event),
+	      MSC_NUM_INSTANCES * (2 * MSC_DATA_BUFS + 3), 4);
 
 /* Make supported vendor request visible for the device stack */
 static const struct usbd_cctx_vendor_req msc_bot_vregs =
@@ -94,8 +105,6 @@ struct msc_bot_desc {
 
 enum {
 	MSC_CLASS_ENABLED,
-	MSC_BULK_OUT_QUEUED,
-	MSC_BULK_IN_QUEUED,
 	MSC_BULK_IN_WEDGED,
 	MSC_BULK_OUT_WEDGED,
 };
@@ -123,16 +132,20 @@ struct msc_bot_ctx {
 	struct CSW csw;
 	uint8_t scsi_buf[CONFIG_USBD_MSC_SCSI_BUFFER_SIZE];
 	uint32_t transferred_data;
-	size_t scsi_offset;
 	size_t scsi_bytes;
+	/* Bytes the host can send to the queued OUT buffers */
+	size_t out_bytes;
+	uint8_t out_queued;
+	uint8_t in_queued;
 };
 
-static struct net_buf *msc_buf_alloc(const uint8_t ep)
+static struct net_buf *msc_buf_alloc(struct net_buf_pool *const pool,
+				     const uint8_t ep)
 {
 	struct net_buf *buf = NULL;
 	struct udc_buf_info *bi;
 
-	buf = net_buf_alloc(&msc_ep_pool, K_NO_WAIT);
+	buf = net_buf_alloc(pool, K_NO_WAIT);
 	if (!buf) {
 		return NULL;
 	}
@@ -171,32 +184,81 @@ static uint8_t msc_get_bulk_out(struct usbd_class_data *const c_data)
 	return desc->if0_out_ep.bEndpointAddress;
 }
 
+static int msc_enqueue_bulk_out(struct msc_bot_ctx *ctx, struct net_buf *buf)
+{
+	int ret;
+
+	ret = usbd_ep_enqueue(ctx->class_node, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x",
+			msc_get_bulk_out(ctx->class_node));
+		net_buf_unref(buf);
+		return ret;
+	}
+
+	ctx->out_queued++;
+	ctx->out_bytes += buf->size;
+
+	return 0;
+}
+
+/* Queue data buffers for all the data the host is still going to send, so
+ * that the host does not have to wait for the data to be written to disk.
+ */
+static void msc_queue_write_data(struct msc_bot_ctx *ctx)
+{
+	struct net_buf *buf;
+	size_t expected;
+
+	while (ctx->out_queued < MSC_DATA_BUFS) {
+		if (ctx->transferred_data + ctx->out_bytes >=
+		    ctx->cbw.dCBWDataTransferLength) {
+			break;
+		}
+
+		expected = ctx->cbw.dCBWDataTransferLength -
+			   ctx->transferred_data - ctx->out_bytes;
+
+		buf = msc_buf_alloc(&msc_data_pool, msc_get_bulk_out(ctx->class_node));
+		if (buf == NULL) {
+			/* Retried when one of the queued buffers completes */
+			break;
+		}
+
+		/* Transfer must not extend past the data stage */
+		buf->size = MIN(expected, MSC_DATA_BUF_SIZE);
+
+		if (msc_enqueue_bulk_out(ctx, buf)) {
+			break;
+		}
+	}
+}
+
 static void msc_queue_bulk_out_ep(struct usbd_class_data *const c_data)
 {
 	struct msc_bot_ctx *ctx = usbd_class_get_private(c_data);
 	struct net_buf *buf;
 	uint8_t ep;
-	int ret;
 
-	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_OUT_QUEUED)) {
+	if (ctx->state == MSC_BBB_PROCESS_WRITE) {
+		msc_queue_write_data(ctx);
+		return;
+	}
+
+	if (ctx->out_queued) {
 		/* Already queued */
 		return;
 	}
 
 	LOG_DBG("Queuing OUT");
 	ep = msc_get_bulk_out(c_data);
-	buf = msc_buf_alloc(ep);
+	buf = msc_buf_alloc(&msc_ep_pool, ep);
 	/* The pool is large enough to support all allocations. Failing alloc
 	 * indicates either a memory leak or logic error.
 	 */
 	__ASSERT_NO_MSG(buf);
 
-	ret = usbd_ep_enqueue(c_data, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
-		net_buf_unref(buf);
-		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
-	}
+	(void)msc_enqueue_bulk_out(ctx, buf);
 }
 
 static void msc_stall_bulk_out_ep(struct usbd_class_data *const c_data)
@@ -221,6 +283,18 @@ static void msc_reset_handler(struct usbd_class_data *c_data)
 	int i;
 
 	LOG_INF("Bulk-Only Mass Storage Reset");
+
+	/* Cancel data buffers queued for the interrupted command. Cancelled
+	 * buffers are accounted for when their completion is handled.
+	 */
+	if (ctx->out_queued) {
+		usbd_ep_dequeue(usbd_class_get_ctx(c_data), msc_get_bulk_out(c_data));
+	}
+
+	if (ctx->in_queued) {
+		usbd_ep_dequeue(usbd_class_get_ctx(c_data), msc_get_bulk_in(c_data));
+	}
+
 	ctx->state = MSC_BBB_EXPECT_CBW;
 	for (i = 0; i < ctx->registered_luns; i++) {
 		scsi_reset(&ctx->luns[i]);
@@ -250,62 +324,82 @@ static bool is_cbw_meaningful(struct msc_bot_ctx *const ctx)
 	return true;
 }
 
-static void msc_process_read(struct msc_bot_ctx *ctx)
+static void msc_data_in_done(struct msc_bot_ctx *ctx)
 {
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
-	int bytes_queued = 0;
-	struct net_buf *buf;
-	uint8_t ep;
-	size_t len;
-	int ret;
 
-	/* Fill SCSI Data IN buffer if there is no data available */
-	if (ctx->scsi_bytes == 0) {
-		ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
-		ctx->scsi_offset = 0;
+	if (ctx->csw.dCSWDataResidue > 0) {
+		/* Case (5) Hi > Di
+		 * While we may have sent short packet, device
+		 * shall STALL the Bulk-In pipe (if it does not
+		 * send padding data).
+		 */
+		msc_stall_bulk_in_ep(ctx->class_node);
 	}
 
-	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
-		__ASSERT_NO_MSG(false);
-		LOG_ERR("IN already queued");
-		return;
+	if (scsi_cmd_get_status(lun) == GOOD) {
+		ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_PASSED;
+	} else {
+		ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_FAILED;
 	}
 
+	ctx->state = MSC_BBB_SEND_CSW;
+}
+
+static bool msc_data_in_available(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+
+	return ctx->scsi_bytes > 0 || scsi_cmd_remaining_data_len(lun) > 0;
+}
+
+static void msc_process_read(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
 	ep = msc_get_bulk_in(ctx->class_node);
-	buf = msc_buf_alloc(ep);
-	/* The pool is large enough to support all allocations. Failing alloc
-	 * indicates either a memory leak or logic error.
-	 */
-	__ASSERT_NO_MSG(buf);
 
-	while (ctx->scsi_bytes - ctx->scsi_offset > 0) {
-		len = MIN(ctx->scsi_bytes - ctx->scsi_offset,
-			  MSC_BUF_SIZE - bytes_queued);
-		if (len == 0) {
-			/* Either queued as much as possible or there is no more
-			 * SCSI IN data available
-			 */
+	/* Read ahead into all free data buffers, the disk is accessed while
+	 * the host picks up the previously queued data.
+	 */
+	while (ctx->in_queued < MSC_DATA_BUFS && msc_data_in_available(ctx)) {
+		buf = msc_buf_alloc(&msc_data_pool, ep);
+		if (buf == NULL) {
+			/* Retried when one of the queued buffers completes */
 			break;
 		}
 
-		net_buf_add_mem(buf, &ctx->scsi_buf[ctx->scsi_offset], len);
-		bytes_queued += len;
-		ctx->scsi_offset += len;
+		if (ctx->scsi_bytes) {
+			/* Data returned by the SCSI command itself */
+			net_buf_add_mem(buf, ctx->scsi_buf, ctx->scsi_bytes);
+			ctx->scsi_bytes = 0;
+		} else {
+			net_buf_add(buf, scsi_read_data(lun, buf->data));
+		}
+
+		if (buf->len == 0) {
+			/* SCSI layer terminated the transfer */
+			net_buf_unref(buf);
+			break;
+		}
 
-		if (ctx->scsi_bytes == ctx->scsi_offset) {
-			/* SCSI buffer can be reused now */
-			ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
-			ctx->scsi_offset = 0;
+		ctx->csw.dCSWDataResidue -= buf->len;
+		ret = usbd_ep_enqueue(ctx->class_node, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			net_buf_unref(buf);
+			break;
 		}
+
+		ctx->in_queued++;
 	}
 
-	/* Either the net buf is full or there is no more SCSI data */
-	ctx->csw.dCSWDataResidue -= bytes_queued;
-	ret = usbd_ep_enqueue(ctx->class_node, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
-		net_buf_unref(buf);
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+	if (ctx->in_queued == 0 && !msc_data_in_available(ctx)) {
+		/* There is no data in transfer and no more data to send */
+		msc_data_in_done(ctx);
 	}
 }
 
@@ -319,7 +413,6 @@ static void msc_process_cbw(struct msc_bot_ctx *ctx)
 	cb_len = scsi_usb_boot_cmd_len(ctx->cbw.CBWCB, ctx->cbw.bCBWCBLength);
 	data_len = scsi_cmd(lun, ctx->cbw.CBWCB, cb_len, ctx->scsi_buf);
 	ctx->scsi_bytes = data_len;
-	ctx->scsi_offset = 0;
 	cmd_is_data_read = scsi_cmd_is_data_read(lun);
 	cmd_is_data_write = scsi_cmd_is_data_write(lun);
 	data_len += scsi_cmd_remaining_data_len(lun);
@@ -446,8 +539,14 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 		if (ctx->transferred_data < ctx->cbw.dCBWDataTransferLength) {
 			/* Case (11) Ho > Do and the transfer is still in
 			 * progress. We do not intend to process more data so
-			 * stall the Bulk-Out pipe.
+			 * cancel the buffers queued in advance and stall the
+			 * Bulk-Out pipe.
 			 */
+			if (ctx->out_queued) {
+				usbd_ep_dequeue(usbd_class_get_ctx(ctx->class_node),
+						msc_get_bulk_out(ctx->class_node));
+			}
+
 			msc_stall_bulk_out_ep(ctx->class_node);
 		}
 
@@ -511,24 +610,9 @@ static void msc_handle_bulk_in(struct msc_bot_ctx *ctx,
 		LOG_DBG("CSW sent");
 		ctx->state = MSC_BBB_EXPECT_CBW;
 	} else if (ctx->state == MSC_BBB_PROCESS_READ) {
-		struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
-
 		ctx->transferred_data += len;
-		if (ctx->scsi_bytes == 0) {
-			if (ctx->csw.dCSWDataResidue > 0) {
-				/* Case (5) Hi > Di
-				 * While we may have sent short packet, device
-				 * shall STALL the Bulk-In pipe (if it does not
-				 * send padding data).
-				 */
-				msc_stall_bulk_in_ep(ctx->class_node);
-			}
-			if (scsi_cmd_get_status(lun) == GOOD) {
-				ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_PASSED;
-			} else {
-				ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_FAILED;
-			}
-			ctx->state = MSC_BBB_SEND_CSW;
+		if (ctx->in_queued == 0 && !msc_data_in_available(ctx)) {
+			msc_data_in_done(ctx);
 		}
 	}
 }
@@ -539,7 +623,7 @@ static void msc_send_csw(struct msc_bot_ctx *ctx)
 	uint8_t ep;
 	int ret;
 
-	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
+	if (ctx->in_queued) {
 		__ASSERT_NO_MSG(false);
 		LOG_ERR("IN already queued");
 		return;
@@ -548,7 +632,7 @@ static void msc_send_csw(struct msc_bot_ctx *ctx)
 	/* Convert dCSWDataResidue to LE, other fields are already set */
 	ctx->csw.dCSWDataResidue = sys_cpu_to_le32(ctx->csw.dCSWDataResidue);
 	ep = msc_get_bulk_in(ctx->class_node);
-	buf = msc_buf_alloc(ep);
+	buf = msc_buf_alloc(&msc_ep_pool, ep);
 	/* The pool is large enough to support all allocations. Failing alloc
 	 * indicates either a memory leak or logic error.
 	 */
@@ -559,7 +643,8 @@ static void msc_send_csw(struct msc_bot_ctx *ctx)
 	if (ret) {
 		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
 		net_buf_unref(buf);
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+	} else {
+		ctx->in_queued++;
 	}
 	ctx->state = MSC_BBB_WAIT_FOR_CSW_SENT;
 }
@@ -572,6 +657,13 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	struct udc_buf_info *bi;
 
 	bi = udc_get_buf_info(buf);
+	if (bi->ep == msc_get_bulk_out(c_data)) {
+		ctx->out_queued--;
+		ctx->out_bytes -= buf->size;
+	} else if (bi->ep == msc_get_bulk_in(c_data)) {
+		ctx->in_queued--;
+	}
+
 	if (err) {
 		if (err == -ECONNABORTED) {
 			LOG_WRN("request ep 0x%02x, len %u cancelled",
@@ -591,11 +683,6 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	}
 
 ep_request_error:
-	if (bi->ep == msc_get_bulk_out(c_data)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
-	} else if (bi->ep == msc_get_bulk_in(c_data)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
-	}
 	usbd_ep_buf_free(uds_ctx, buf);
 }
 
@@ -632,9 +719,10 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 		}
 
 		/* Skip (potentially) response generating code if there is
-		 * IN data already available for the host to pick up.
+		 * IN data already available for the host to pick up. Data IN
+		 * buffers are refilled while the others are in transfer.
 		 */
-		if (atomic_test_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
+		if (ctx->in_queued && ctx->state != MSC_BBB_PROCESS_READ) {
 			continue;
 		}
 
@@ -646,7 +734,9 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 			msc_process_read(ctx);
 		} else if (ctx->state == MSC_BBB_PROCESS_WRITE) {
 			msc_queue_bulk_out_ep(evt.c_data);
-		} else if (ctx->state == MSC_BBB_SEND_CSW) {
+		}
+
+		if (ctx->state == MSC_BBB_SEND_CSW && !ctx->in_queued) {
 			msc_send_csw(ctx);
 		}
 	}
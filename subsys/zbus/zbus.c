@@ -5,6 +5,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
@@ -122,6 +123,70 @@ const struct zbus_channel *zbus_chan_from_id(uint32_t channel_id)
 
 #endif /* CONFIG_ZBUS_CHANNEL_ID */
 
+#if defined(CONFIG_ZBUS_BATCH_SUBSCRIBER)
+
+/* Must be called with the batch lock held */
+static void batch_wake(struct zbus_batch_subscriber *batch)
+{
+	batch->ready = true;
+
+	if (batch->timing) {
+		batch->timing = false;
+		k_timer_stop(&batch->timer);
+	}
+
+	k_sem_give(&batch->sem);
+}
+
+void z_zbus_batch_window_expired(struct k_timer *timer)
+{
+	struct zbus_batch_subscriber *batch =
+		CONTAINER_OF(timer, struct zbus_batch_subscriber, timer);
+
+	K_SPINLOCK(&batch->lock) {
+		batch->timing = false;
+
+		if (!batch->ready && batch->count > 0) {
+			batch_wake(batch);
+		}
+	}
+}
+
+static int _zbus_batch_put(const struct zbus_channel *chan, struct zbus_batch_subscriber *batch)
+{
+	int err = 0;
+
+	K_SPINLOCK(&batch->lock) {
+		if (ring_buf_space_get(batch->rb) < sizeof(chan) + zbus_chan_msg_size(chan)) {
+			/* Wake the subscriber up so it makes room for the next messages */
+			if (!batch->ready) {
+				batch_wake(batch);
+			}
+			err = -ENOBUFS;
+			K_SPINLOCK_BREAK;
+		}
+
+		ring_buf_put(batch->rb, (const uint8_t *)&chan, sizeof(chan));
+		ring_buf_put(batch->rb, zbus_chan_const_msg(chan), zbus_chan_msg_size(chan));
+		batch->count++;
+
+		if (batch->ready) {
+			K_SPINLOCK_BREAK;
+		}
+
+		if (batch->count >= batch->batch_count) {
+			batch_wake(batch);
+		} else if (batch->window_ms != 0U && !batch->timing) {
+			batch->timing = true;
+			k_timer_start(&batch->timer, K_MSEC(batch->window_ms), K_NO_WAIT);
+		}
+	}
+
+	return err;
+}
+
+#endif /* CONFIG_ZBUS_BATCH_SUBSCRIBER */
+
 static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 					const struct zbus_observer *obs, k_timepoint_t end_time,
 					struct net_buf *buf)
@@ -147,6 +212,11 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 		break;
 	}
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+#if defined(CONFIG_ZBUS_BATCH_SUBSCRIBER)
+	case ZBUS_OBSERVER_BATCH_SUBSCRIBER_TYPE: {
+		return _zbus_batch_put(chan, obs->batch);
+	}
+#endif /* CONFIG_ZBUS_BATCH_SUBSCRIBER */
 
 	default:
 		_ZBUS_ASSERT(false, "Unreachable");
@@ -374,6 +444,96 @@ static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+static inline bool chan_is_seqlock(const struct zbus_channel *chan)
+{
+	return chan->data->seqlock;
+}
+
+static int seqlock_chan_pub(const struct zbus_channel *chan, const void *msg,
+			    k_timepoint_t end_time)
+{
+	atomic_val_t seq = atomic_get(&chan->data->seq);
+
+	/* An odd sequence, or a failed exchange, means another writer is publishing */
+	if ((seq & 1) || !atomic_cas(&chan->data->seq, seq, seq + 1)) {
+		return -EBUSY;
+	}
+
+	barrier_dmem_fence_full();
+
+	memcpy(chan->message, msg, chan->message_size);
+
+	barrier_dmem_fence_full();
+
+	atomic_set(&chan->data->seq, seq + 2);
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+	chan->data->publish_timestamp = k_uptime_ticks();
+	chan->data->publish_count += 1;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+	/* The single writer is the only one changing the message, the observers can access it
+	 * while they are notified.
+	 */
+	return _zbus_vded_exec(chan, end_time);
+}
+
+static int seqlock_chan_read(const struct zbus_channel *chan, void *msg, k_timepoint_t end_time)
+{
+	atomic_val_t seq;
+
+	while (true) {
+		seq = atomic_get(&chan->data->seq);
+
+		if ((seq & 1) == 0) {
+			barrier_dmem_fence_full();
+
+			memcpy(msg, chan->message, chan->message_size);
+
+			barrier_dmem_fence_full();
+
+			if (atomic_get(&chan->data->seq) == seq) {
+				return 0;
+			}
+
+			/* The message was published during the copy, the writer is done with the
+			 * new one if the sequence is even, retry right away.
+			 */
+			continue;
+		}
+
+		if (sys_timepoint_expired(end_time)) {
+			return -EAGAIN;
+		}
+
+		/* The writer may have been preempted by this thread, let it finish */
+		k_sleep(K_TICKS(1));
+	}
+}
+
+#else
+
+static inline bool chan_is_seqlock(const struct zbus_channel *chan)
+{
+	return false;
+}
+
+static inline int seqlock_chan_pub(const struct zbus_channel *chan, const void *msg,
+				   k_timepoint_t end_time)
+{
+	return -ENOTSUP;
+}
+
+static inline int seqlock_chan_read(const struct zbus_channel *chan, void *msg,
+				    k_timepoint_t end_time)
+{
+	return -ENOTSUP;
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
@@ -393,6 +553,10 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 		return -ENOMSG;
 	}
 
+	if (chan_is_seqlock(chan)) {
+		return seqlock_chan_pub(chan, msg, end_time);
+	}
+
 	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
 
 	err = chan_lock(chan, timeout, &context_priority);
@@ -425,6 +589,10 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 		timeout = K_NO_WAIT;
 	}
 
+	if (chan_is_seqlock(chan)) {
+		return seqlock_chan_read(chan, msg, sys_timepoint_calc(timeout));
+	}
+
 	int err = k_sem_take(&chan->data->sem, timeout);
 	if (err) {
 		return err;
@@ -451,6 +619,11 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 
 	k_timepoint_t end_time = sys_timepoint_calc(timeout);
 
+	if (chan_is_seqlock(chan)) {
+		/* Notified by the single writer, which does not change the message meanwhile */
+		return _zbus_vded_exec(chan, end_time);
+	}
+
 	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
 
 	err = chan_lock(chan, timeout, &context_priority);
@@ -535,6 +708,73 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_BATCH_SUBSCRIBER)
+
+int zbus_sub_wait_batch(const struct zbus_observer *sub, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus_sub_wait_batch cannot be used inside ISRs");
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(sub->type == ZBUS_OBSERVER_BATCH_SUBSCRIBER_TYPE,
+		     "sub must be a BATCH_SUBSCRIBER");
+	_ZBUS_ASSERT(sub->batch != NULL, "sub batch is required");
+
+	struct zbus_batch_subscriber *batch = sub->batch;
+	int count;
+
+	/* The messages left from the previous batch start the next one */
+	K_SPINLOCK(&batch->lock) {
+		batch->ready = false;
+
+		if (batch->count >= batch->batch_count) {
+			batch_wake(batch);
+		} else if (batch->count > 0 && batch->window_ms != 0U && !batch->timing) {
+			batch->timing = true;
+			k_timer_start(&batch->timer, K_MSEC(batch->window_ms), K_NO_WAIT);
+		}
+	}
+
+	int err = k_sem_take(&batch->sem, timeout);
+
+	if (err) {
+		return (err == -EBUSY) ? -ENOMSG : err;
+	}
+
+	K_SPINLOCK(&batch->lock) {
+		count = batch->count;
+	}
+
+	return count;
+}
+
+int zbus_sub_batch_get(const struct zbus_observer *sub, const struct zbus_channel **chan,
+		       void *msg)
+{
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(sub->type == ZBUS_OBSERVER_BATCH_SUBSCRIBER_TYPE,
+		     "sub must be a BATCH_SUBSCRIBER");
+	_ZBUS_ASSERT(sub->batch != NULL, "sub batch is required");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	struct zbus_batch_subscriber *batch = sub->batch;
+	int err = 0;
+
+	K_SPINLOCK(&batch->lock) {
+		if (batch->count == 0) {
+			err = -ENOMSG;
+			K_SPINLOCK_BREAK;
+		}
+
+		ring_buf_get(batch->rb, (uint8_t *)chan, sizeof(*chan));
+		ring_buf_get(batch->rb, msg, zbus_chan_msg_size(*chan));
+		batch->count--;
+	}
+
+	return err;
+}
+
+#endif /* CONFIG_ZBUS_BATCH_SUBSCRIBER */
+
 int zbus_obs_set_chan_notification_mask(const struct zbus_observer *obs,
 					const struct zbus_channel *chan, bool masked)
 {
@@ -0,0 +1,272 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/zbus/zbus_proxy_agent_ipc.h>
+LOG_MODULE_DECLARE(zbus, CONFIG_ZBUS_LOG_LEVEL);
+
+#define HDR_SIZE sizeof(struct zbus_proxy_agent_ipc_hdr)
+#define REC_SIZE sizeof(struct zbus_proxy_agent_ipc_rec)
+
+static inline uint32_t rec_len(uint16_t msg_size)
+{
+	return REC_SIZE + ROUND_UP(msg_size, 4);
+}
+
+/* Must be called with the agent lock held */
+static void tx_buf_claim(struct zbus_proxy_agent_ipc *agent, uint32_t len)
+{
+	void *data;
+	uint32_t size = sizeof(agent->tx_copy);
+	int err;
+
+	err = ipc_service_get_tx_buffer(&agent->ept, &data, &size, K_NO_WAIT);
+	if (err == -ENOMEM && size >= HDR_SIZE + len) {
+		/* Smaller buffers than requested, size is their maximum */
+		err = ipc_service_get_tx_buffer(&agent->ept, &data, &size, K_NO_WAIT);
+	}
+
+	if (err == 0 && size < HDR_SIZE + len) {
+		(void)ipc_service_drop_tx_buffer(&agent->ept, data);
+		err = -ENOMEM;
+	}
+
+	if (err == 0) {
+		agent->tx_buf = data;
+		agent->tx_size = size;
+		agent->tx_nocopy = true;
+	} else {
+		/* No-copy sending is not supported, or no buffer is available */
+		agent->tx_buf = agent->tx_copy;
+		agent->tx_size = sizeof(agent->tx_copy);
+		agent->tx_nocopy = false;
+	}
+
+	agent->tx_len = HDR_SIZE;
+	agent->tx_count = 0U;
+}
+
+/* Must be called with the agent lock held */
+static int tx_buf_send(struct zbus_proxy_agent_ipc *agent)
+{
+	struct zbus_proxy_agent_ipc_hdr hdr = {
+		.count = agent->tx_count,
+	};
+	int err;
+
+	if (agent->tx_buf == NULL) {
+		return 0;
+	}
+
+	memcpy(agent->tx_buf, &hdr, sizeof(hdr));
+
+	if (agent->tx_nocopy) {
+		err = ipc_service_send_nocopy(&agent->ept, agent->tx_buf, agent->tx_len);
+		if (err < 0) {
+			(void)ipc_service_drop_tx_buffer(&agent->ept, agent->tx_buf);
+		}
+	} else {
+		err = ipc_service_send(&agent->ept, agent->tx_buf, agent->tx_len);
+	}
+
+	if (err < 0) {
+		LOG_ERR("could not send %u publications to the remote core. Error code %d",
+			agent->tx_count, err);
+		agent->stats.dropped += agent->tx_count;
+	} else {
+		agent->stats.sent += agent->tx_count;
+		err = 0;
+	}
+
+	agent->tx_buf = NULL;
+
+	return err;
+}
+
+static void flush_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct zbus_proxy_agent_ipc *agent =
+		CONTAINER_OF(dwork, struct zbus_proxy_agent_ipc, flush_work);
+
+	(void)zbus_proxy_agent_ipc_flush(agent);
+}
+
+void z_zbus_proxy_agent_ipc_forward(struct zbus_proxy_agent_ipc *agent,
+				    const struct zbus_channel *chan)
+{
+	struct zbus_proxy_agent_ipc_rec rec = {
+		.id = chan->id,
+		.size = zbus_chan_msg_size(chan),
+	};
+	uint32_t len = rec_len(rec.size);
+
+	/* Do not send back the publications received from the remote core */
+	if (agent->rx_chan == chan && agent->rx_thread == (k_is_in_isr() ? NULL : k_current_get())) {
+		return;
+	}
+
+	/* The agent lock cannot be taken by an ISR */
+	if (k_is_in_isr()) {
+		atomic_inc(&agent->isr_dropped);
+		return;
+	}
+
+	k_mutex_lock(&agent->lock, K_FOREVER);
+
+	if (!atomic_get(&agent->bound) || HDR_SIZE + len > sizeof(agent->tx_copy)) {
+		agent->stats.dropped++;
+		goto out;
+	}
+
+	if (agent->tx_buf != NULL && agent->tx_len + len > agent->tx_size) {
+		(void)tx_buf_send(agent);
+	}
+
+	if (agent->tx_buf == NULL) {
+		tx_buf_claim(agent, len);
+	}
+
+	rec.seq = agent->tx_seq++;
+	memcpy(&agent->tx_buf[agent->tx_len], &rec, sizeof(rec));
+	/* The channel is locked while its observers are notified */
+	memcpy(&agent->tx_buf[agent->tx_len + REC_SIZE], zbus_chan_const_msg(chan), rec.size);
+	memset(&agent->tx_buf[agent->tx_len + REC_SIZE + rec.size], 0, len - REC_SIZE - rec.size);
+	agent->tx_len += len;
+	agent->tx_count++;
+
+	if (agent->tx_count >= CONFIG_ZBUS_PROXY_AGENT_IPC_BATCH_MAX ||
+	    CONFIG_ZBUS_PROXY_AGENT_IPC_BATCH_WINDOW_MS == 0) {
+		(void)tx_buf_send(agent);
+		(void)k_work_cancel_delayable(&agent->flush_work);
+	} else if (agent->tx_count == 1U) {
+		k_work_schedule(&agent->flush_work,
+				K_MSEC(CONFIG_ZBUS_PROXY_AGENT_IPC_BATCH_WINDOW_MS));
+	}
+
+out:
+	k_mutex_unlock(&agent->lock);
+}
+
+static void ept_bound(void *priv)
+{
+	struct zbus_proxy_agent_ipc *agent = priv;
+
+	agent->rx_synced = false;
+	atomic_set(&agent->bound, 1);
+}
+
+static void ept_unbound(void *priv)
+{
+	struct zbus_proxy_agent_ipc *agent = priv;
+
+	atomic_set(&agent->bound, 0);
+}
+
+static void ept_received(const void *data, size_t len, void *priv)
+{
+	struct zbus_proxy_agent_ipc *agent = priv;
+	const uint8_t *buf = data;
+	struct zbus_proxy_agent_ipc_hdr hdr;
+	struct zbus_proxy_agent_ipc_rec rec;
+	size_t offset = HDR_SIZE;
+
+	if (len < HDR_SIZE) {
+		return;
+	}
+
+	memcpy(&hdr, buf, sizeof(hdr));
+
+	for (uint16_t i = 0; i < hdr.count; i++) {
+		const struct zbus_channel *chan;
+
+		if (len - offset < REC_SIZE) {
+			break;
+		}
+
+		memcpy(&rec, &buf[offset], sizeof(rec));
+
+		if (len - offset < rec_len(rec.size)) {
+			break;
+		}
+
+		if (agent->rx_synced && rec.seq != agent->rx_seq) {
+			agent->stats.lost += rec.seq - agent->rx_seq;
+		}
+		agent->rx_seq = rec.seq + 1U;
+		agent->rx_synced = true;
+
+		chan = zbus_chan_from_id(rec.id);
+		if (chan == NULL || zbus_chan_msg_size(chan) != rec.size) {
+			agent->stats.rejected++;
+		} else {
+			/* Published straight from the RX buffer */
+			agent->rx_chan = chan;
+			agent->rx_thread = k_is_in_isr() ? NULL : k_current_get();
+
+			if (zbus_chan_pub(chan, &buf[offset + REC_SIZE],
+					  K_MSEC(CONFIG_ZBUS_PROXY_AGENT_IPC_PUB_TIMEOUT_MS)) == 0) {
+				agent->stats.received++;
+			} else {
+				agent->stats.rejected++;
+			}
+
+			agent->rx_chan = NULL;
+		}
+
+		offset += rec_len(rec.size);
+	}
+}
+
+int zbus_proxy_agent_ipc_start(struct zbus_proxy_agent_ipc *agent)
+{
+	int err;
+
+	k_mutex_init(&agent->lock);
+	k_work_init_delayable(&agent->flush_work, flush_work_handler);
+
+	agent->ept_cfg.cb.bound = ept_bound;
+	agent->ept_cfg.cb.unbound = ept_unbound;
+	agent->ept_cfg.cb.received = ept_received;
+
+	err = ipc_service_open_instance(agent->instance);
+	if (err < 0 && err != -EALREADY) {
+		LOG_ERR("could not open the IPC instance. Error code %d", err);
+		return err;
+	}
+
+	err = ipc_service_register_endpoint(agent->instance, &agent->ept, &agent->ept_cfg);
+	if (err < 0) {
+		LOG_ERR("could not register the IPC endpoint. Error code %d", err);
+		return err;
+	}
+
+	return 0;
+}
+
+int zbus_proxy_agent_ipc_flush(struct zbus_proxy_agent_ipc *agent)
+{
+	int err;
+
+	k_mutex_lock(&agent->lock, K_FOREVER);
+	err = tx_buf_send(agent);
+	k_mutex_unlock(&agent->lock);
+
+	return err;
+}
+
+void zbus_proxy_agent_ipc_stats_get(struct zbus_proxy_agent_ipc *agent,
+				    struct zbus_proxy_agent_ipc_stats *stats)
+{
+	k_mutex_lock(&agent->lock, K_FOREVER);
+	*stats = agent->stats;
+	stats->dropped += atomic_get(&agent->isr_dropped);
+	k_mutex_unlock(&agent->lock);
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the throughput of the CRC implementations over buffers of various
+ * sizes, aligned and not.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/sys/crc.h>
+
+#define MAX_LEN    4096
+#define ITERATIONS 64
+
+struct crc_algo {
+	const char *name;
+	uint32_t (*run)(const uint8_t *data, size_t len);
+};
+
+static uint8_t __aligned(8) buf[MAX_LEN + 8];
+
+/* Keeps the compiler from dropping the computations */
+static volatile uint32_t sink;
+
+static uint32_t run_crc32_ieee(const uint8_t *data, size_t len)
+{
+	return crc32_ieee(data, len);
+}
+
+static uint32_t run_crc32_c(const uint8_t *data, size_t len)
+{
+	return crc32_c(0, data, len, true, true);
+}
+
+static uint32_t run_crc16_ccitt(const uint8_t *data, size_t len)
+{
+	return crc16_ccitt(0, data, len);
+}
+
+static uint32_t run_crc8_ccitt(const uint8_t *data, size_t len)
+{
+	return crc8_ccitt(0xff, data, len);
+}
+
+static const struct crc_algo algos[] = {
+	{ "crc32_ieee", run_crc32_ieee },
+	{ "crc32_c", run_crc32_c },
+	{ "crc16_ccitt", run_crc16_ccitt },
+	{ "crc8_ccitt", run_crc8_ccitt },
+};
+
+static const size_t lengths[] = { 16, 64, 256, 1024, MAX_LEN };
+
+static void measure(const struct crc_algo *algo, size_t len, size_t offset)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+	uint32_t ns;
+	uint32_t kib_s;
+	char metric[50];
+	char what[40];
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		sink = algo->run(&buf[offset], len);
+	}
+	finish = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &finish) / ITERATIONS;
+	ns = (uint32_t)timing_cycles_to_ns(cycles);
+	kib_s = (ns != 0U) ? (uint32_t)((uint64_t)len * NSEC_PER_SEC / ns / 1024U) : 0U;
+
+	snprintk(metric, sizeof(metric), "crc.%s.%s.%zu", algo->name,
+		 (offset == 0U) ? "aligned" : "unaligned", len);
+	snprintk(what, sizeof(what), "%zu bytes, %u KiB/s", len, kib_s);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-50s - %-40s: %7u cycles , %7u ns :\n", metric, what, (uint32_t)cycles, ns);
+#else
+	printk("%-50s - %-40s: %7u cycles (%7u nsec)\n", metric, what, (uint32_t)cycles, ns);
+#endif
+}
+
+int main(void)
+{
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 31U + 7U);
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("CRC measurements, %u iterations, clock frequency: %u MHz\n",
+	       ITERATIONS, timing_freq_get_mhz());
+
+	for (int i = 0; i < ARRAY_SIZE(algos); i++) {
+		for (int j = 0; j < ARRAY_SIZE(lengths); j++) {
+			measure(&algos[i], lengths[j], 0);
+			measure(&algos[i], lengths[j], 3);
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
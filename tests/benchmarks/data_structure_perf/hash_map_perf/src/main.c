@@ -0,0 +1,179 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compare the Hashmap implementations: fill them up to their load factor,
+ * look up present and absent keys, replace entries at random, which leaves
+ * tombstones in the Linear Probe Hashmap, and empty them.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/sys/hash_map.h>
+
+#define N_ENTRIES   CONFIG_BENCHMARK_HASH_MAP_ENTRIES
+#define LOAD_FACTOR CONFIG_BENCHMARK_HASH_MAP_LOAD_FACTOR
+#define N_CHURN     (8 * N_ENTRIES)
+
+#define HASHMAP_CONFIG SYS_HASHMAP_CONFIG(SIZE_MAX, LOAD_FACTOR)
+
+SYS_HASHMAP_SC_DEFINE_STATIC_ADVANCED(sc_map, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,
+				      HASHMAP_CONFIG);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC_ADVANCED(oa_lp_map, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,
+					 HASHMAP_CONFIG);
+SYS_HASHMAP_OA_RH_DEFINE_STATIC_ADVANCED(oa_rh_map, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,
+					 HASHMAP_CONFIG);
+#ifdef CONFIG_SYS_HASH_MAP_CXX
+SYS_HASHMAP_CXX_DEFINE_STATIC_ADVANCED(cxx_map, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,
+				       HASHMAP_CONFIG);
+#endif
+
+static const struct {
+	const char *name;
+	struct sys_hashmap *map;
+} maps[] = {
+	{ "sc", &sc_map },
+	{ "oa_lp", &oa_lp_map },
+	{ "oa_rh", &oa_rh_map },
+#ifdef CONFIG_SYS_HASH_MAP_CXX
+	{ "cxx", &cxx_map },
+#endif
+};
+
+/* Present keys, an absent one is made by setting the top bit */
+static uint64_t keys[N_ENTRIES];
+
+static uint32_t rand_state = 1;
+
+static uint32_t next_rand(void)
+{
+	/* xorshift32, the sequence is the same for all Hashmaps */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static void report(const char *map, const char *op, timing_t *start, timing_t *finish,
+		   uint32_t count, uint32_t errors)
+{
+	uint64_t cycles = timing_cycles_get(start, finish) / count;
+	uint32_t ns = (uint32_t)timing_cycles_to_ns(cycles);
+	char metric[50];
+	char what[40];
+
+	snprintk(metric, sizeof(metric), "hash_map.%s.%s", map, op);
+	snprintk(what, sizeof(what), "%u ops, load %u%%, %u errors", count, LOAD_FACTOR, errors);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-50s - %-40s: %7u cycles , %7u ns :\n", metric, what, (uint32_t)cycles, ns);
+#else
+	printk("%-50s - %-40s: %7u cycles (%7u nsec)\n", metric, what, (uint32_t)cycles, ns);
+#endif
+}
+
+static uint32_t run(const char *name, struct sys_hashmap *map)
+{
+	timing_t start;
+	timing_t finish;
+	uint32_t total = 0;
+	uint32_t errors;
+	uint64_t value;
+	uint32_t i;
+	uint32_t j;
+
+	rand_state = 1;
+
+	errors = 0;
+	start = timing_counter_get();
+	for (i = 0; i < N_ENTRIES; i++) {
+		errors += sys_hashmap_insert(map, keys[i], i, NULL) != 1;
+	}
+	finish = timing_counter_get();
+	report(name, "insert", &start, &finish, N_ENTRIES, errors);
+	total += errors;
+
+	errors = 0;
+	start = timing_counter_get();
+	for (i = 0; i < N_ENTRIES; i++) {
+		errors += !sys_hashmap_get(map, keys[i], &value) || value != i;
+	}
+	finish = timing_counter_get();
+	report(name, "get_hit", &start, &finish, N_ENTRIES, errors);
+	total += errors;
+
+	errors = 0;
+	start = timing_counter_get();
+	for (i = 0; i < N_ENTRIES; i++) {
+		errors += sys_hashmap_get(map, keys[i] | BIT64(63), NULL);
+	}
+	finish = timing_counter_get();
+	report(name, "get_miss", &start, &finish, N_ENTRIES, errors);
+	total += errors;
+
+	/* Remove a random entry and insert it back under a new key */
+	errors = 0;
+	start = timing_counter_get();
+	for (i = 0; i < N_CHURN; i++) {
+		j = next_rand() % N_ENTRIES;
+		errors += !sys_hashmap_remove(map, keys[j], NULL);
+		keys[j] += BIT64(32);
+		errors += sys_hashmap_insert(map, keys[j], j, NULL) != 1;
+	}
+	finish = timing_counter_get();
+	report(name, "churn", &start, &finish, N_CHURN, errors);
+	total += errors;
+
+	errors = 0;
+	start = timing_counter_get();
+	for (i = 0; i < N_ENTRIES; i++) {
+		errors += !sys_hashmap_get(map, keys[i], &value) || value != i;
+	}
+	finish = timing_counter_get();
+	report(name, "get_after_churn", &start, &finish, N_ENTRIES, errors);
+	total += errors;
+
+	errors = 0;
+	start = timing_counter_get();
+	for (i = 0; i < N_ENTRIES; i++) {
+		errors += !sys_hashmap_remove(map, keys[i], NULL);
+	}
+	finish = timing_counter_get();
+	report(name, "remove", &start, &finish, N_ENTRIES, errors);
+	total += errors;
+
+	sys_hashmap_clear(map, NULL, NULL);
+
+	return total;
+}
+
+int main(void)
+{
+	uint32_t errors = 0;
+
+	timing_init();
+	timing_start();
+
+	printk("Hashmap measurements, %u entries, clock frequency: %u MHz\n", N_ENTRIES,
+	       timing_freq_get_mhz());
+
+	for (int i = 0; i < ARRAY_SIZE(maps); i++) {
+		for (int j = 0; j < N_ENTRIES; j++) {
+			keys[j] = (uint64_t)j * 2654435761U;
+		}
+
+		errors += run(maps[i].name, maps[i].map);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(errors == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
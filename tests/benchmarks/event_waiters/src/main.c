@@ -0,0 +1,132 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the time taken by k_event_post() and k_event_clear() when many
+ * threads are waiting on the event object, each for its own event. The
+ * waiting threads have a lower priority than the main thread, so waking one
+ * of them does not switch context within the measurement.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_WAITERS CONFIG_BENCHMARK_EVENT_WAITERS
+#define SAMPLES     CONFIG_BENCHMARK_EVENT_SAMPLES
+
+/* The waiters use events 0 to 30, no thread waits for event 31 */
+#define WAITER_EVENT(i) BIT((i) % 31)
+#define UNUSED_EVENT    BIT(31)
+/* Only waited for by a single thread, with up to 61 waiters */
+#define WAKE_EVENT      WAITER_EVENT(MIN(NUM_WAITERS, 31) - 1)
+
+#define WAITER_STACK_SIZE 512
+#define WAITER_PRIORITY   K_PRIO_PREEMPT(10)
+
+BUILD_ASSERT(NUM_WAITERS > 0);
+
+static K_EVENT_DEFINE(event);
+static K_THREAD_STACK_ARRAY_DEFINE(waiter_stacks, NUM_WAITERS, WAITER_STACK_SIZE);
+static struct k_thread waiters[NUM_WAITERS];
+
+static void report(const char *metric, const char *what, uint64_t cycles)
+{
+	uint32_t ns = (uint32_t)timing_cycles_to_ns(cycles);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-50s - %-40s: %7u cycles , %7u ns :\n", metric, what, (uint32_t)cycles, ns);
+#else
+	printk("%-50s - %-40s: %7u cycles (%7u nsec)\n", metric, what, (uint32_t)cycles, ns);
+#endif
+}
+
+static void waiter(void *p1, void *p2, void *p3)
+{
+	uint32_t events = POINTER_TO_UINT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_event_wait(&event, events, false, K_FOREVER);
+		k_event_clear(&event, events);
+	}
+}
+
+/* Let the waiters run, so that they all wait on the event object again */
+static void waiters_settle(void)
+{
+	k_msleep(1);
+}
+
+static void measure_post(const char *metric, const char *what, uint32_t events)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t total = 0U;
+
+	for (int i = 0; i < SAMPLES; i++) {
+		waiters_settle();
+
+		start = timing_counter_get();
+		k_event_post(&event, events);
+		finish = timing_counter_get();
+
+		total += timing_cycles_get(&start, &finish);
+
+		k_event_clear(&event, UNUSED_EVENT);
+	}
+
+	report(metric, what, total / SAMPLES);
+}
+
+static void measure_clear(void)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t total = 0U;
+
+	waiters_settle();
+
+	for (int i = 0; i < SAMPLES; i++) {
+		k_event_post(&event, UNUSED_EVENT);
+
+		start = timing_counter_get();
+		k_event_clear(&event, UNUSED_EVENT);
+		finish = timing_counter_get();
+
+		total += timing_cycles_get(&start, &finish);
+	}
+
+	report("event.clear", "Clear an event", total / SAMPLES);
+}
+
+int main(void)
+{
+	for (int i = 0; i < NUM_WAITERS; i++) {
+		k_thread_create(&waiters[i], waiter_stacks[i], WAITER_STACK_SIZE, waiter,
+				UINT_TO_POINTER(WAITER_EVENT(i)), NULL, NULL, WAITER_PRIORITY, 0,
+				K_NO_WAIT);
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("Event post measurements, %u waiters, %u wait queues, clock frequency: %u MHz\n",
+	       NUM_WAITERS, CONFIG_EVENTS_WAIT_BUCKETS, timing_freq_get_mhz());
+
+	measure_post("event.post.no_waiter", "Post an event no thread waits for", UNUSED_EVENT);
+	measure_post("event.post.wake_one", "Post an event waking one thread", WAKE_EVENT);
+	measure_clear();
+
+	timing_stop();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,427 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Replay allocation traces against the sys_heap, multi_heap and
+ * shared_multi_heap allocators, and report for every trace:
+ *  1. Percentiles of the cycle counts of allocations, frees and reallocs
+ *  2. The external fragmentation of the heap at evenly spaced points
+ *  3. The share of reallocs resized in place
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/multi_heap.h>
+#include <zephyr/multi_heap/shared_multi_heap.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+
+#define HEAP_SIZE     CONFIG_BENCHMARK_HEAP_SIZE
+#define MAX_SAMPLES   CONFIG_BENCHMARK_HEAP_OPS
+#define FRAG_SAMPLES  CONFIG_BENCHMARK_HEAP_FRAG_SAMPLES
+#define NUM_REGIONS   2
+#define REGION_SIZE   (HEAP_SIZE / NUM_REGIONS)
+#define NUM_OP_TYPES  (HEAP_OP_REALLOC + 1)
+
+BUILD_ASSERT((REGION_SIZE % 8) == 0, "heap size must be a multiple of 16");
+
+struct allocator {
+	const char *name;
+	void (*reset)(void);
+	void *(*alloc)(size_t bytes);
+	void (*free)(void *mem);
+	void *(*realloc)(void *mem, size_t old_bytes, size_t bytes);
+};
+
+struct live_block {
+	void *ptr;
+	uint32_t size;
+};
+
+struct op_samples {
+	uint32_t cycles[MAX_SAMPLES];
+	size_t count;
+};
+
+struct run_result {
+	uint32_t failed_allocs;
+	uint32_t reallocs;
+	uint32_t reallocs_in_place;
+	uint32_t failed_reallocs;
+	uint8_t frag_pct[FRAG_SAMPLES];
+};
+
+static uint8_t __aligned(8) heap_mem[HEAP_SIZE];
+
+/* Shared multi-heap regions can't be removed, they get their own memory */
+static uint8_t __aligned(8) shared_mem[HEAP_SIZE];
+
+static struct heap_op ops_buf[CONFIG_BENCHMARK_HEAP_OPS];
+static struct live_block live[MAX_BLOCKS];
+static struct op_samples samples[NUM_OP_TYPES];
+static const char *const op_names[NUM_OP_TYPES] = { "alloc", "free", "realloc" };
+
+static struct sys_heap heap;
+
+static void sys_reset(void)
+{
+	sys_heap_init(&heap, heap_mem, HEAP_SIZE);
+}
+
+static void *sys_alloc(size_t bytes)
+{
+	return sys_heap_alloc(&heap, bytes);
+}
+
+static void sys_free(void *mem)
+{
+	sys_heap_free(&heap, mem);
+}
+
+static void *sys_realloc(void *mem, size_t old_bytes, size_t bytes)
+{
+	ARG_UNUSED(old_bytes);
+
+	return sys_heap_realloc(&heap, mem, bytes);
+}
+
+static struct sys_multi_heap mheap;
+static struct sys_heap mheap_heaps[NUM_REGIONS];
+
+/* First fit over the heaps, as the shared multi-heap does */
+static void *mheap_choice(struct sys_multi_heap *mh, void *cfg, size_t align, size_t size)
+{
+	ARG_UNUSED(mh);
+	ARG_UNUSED(cfg);
+
+	for (int i = 0; i < NUM_REGIONS; i++) {
+		void *block = sys_heap_aligned_alloc(&mheap_heaps[i], align, size);
+
+		if (block != NULL) {
+			return block;
+		}
+	}
+
+	return NULL;
+}
+
+static void mheap_reset(void)
+{
+	sys_multi_heap_init(&mheap, mheap_choice);
+
+	for (int i = 0; i < NUM_REGIONS; i++) {
+		sys_heap_init(&mheap_heaps[i], &heap_mem[i * REGION_SIZE], REGION_SIZE);
+		sys_multi_heap_add_heap(&mheap, &mheap_heaps[i], NULL);
+	}
+}
+
+static void *mheap_alloc(size_t bytes)
+{
+	return sys_multi_heap_alloc(&mheap, NULL, bytes);
+}
+
+static void mheap_free(void *mem)
+{
+	sys_multi_heap_free(&mheap, mem);
+}
+
+static void *mheap_realloc(void *mem, size_t old_bytes, size_t bytes)
+{
+	ARG_UNUSED(old_bytes);
+
+	return sys_multi_heap_realloc(&mheap, NULL, mem, bytes);
+}
+
+static void smh_reset(void)
+{
+	static bool regions_added;
+
+	/* Every trace ends with all its blocks freed: the pool is reused */
+	if (regions_added) {
+		return;
+	}
+
+	(void)shared_multi_heap_pool_init();
+
+	for (int i = 0; i < NUM_REGIONS; i++) {
+		struct shared_multi_heap_region region = {
+			.attr = SMH_REG_ATTR_CACHEABLE,
+			.addr = (uintptr_t)&shared_mem[i * REGION_SIZE],
+			.size = REGION_SIZE,
+		};
+
+		(void)shared_multi_heap_add(&region, NULL);
+	}
+
+	regions_added = true;
+}
+
+static void *smh_alloc(size_t bytes)
+{
+	return shared_multi_heap_alloc(SMH_REG_ATTR_CACHEABLE, bytes);
+}
+
+/* There is no shared multi-heap realloc: always move the block */
+static void *smh_realloc(void *mem, size_t old_bytes, size_t bytes)
+{
+	void *block = smh_alloc(bytes);
+
+	if (block != NULL) {
+		memcpy(block, mem, MIN(old_bytes, bytes));
+		shared_multi_heap_free(mem);
+	}
+
+	return block;
+}
+
+static const struct allocator allocators[] = {
+	{ "sys_heap", sys_reset, sys_alloc, sys_free, sys_realloc },
+	{ "multi_heap", mheap_reset, mheap_alloc, mheap_free, mheap_realloc },
+	{ "shared_multi_heap", smh_reset, smh_alloc, shared_multi_heap_free, smh_realloc },
+};
+
+static void sample_add(enum heap_op_type type, timing_t *start, timing_t *finish)
+{
+	struct op_samples *s = &samples[type];
+
+	if (s->count < MAX_SAMPLES) {
+		s->cycles[s->count++] = (uint32_t)timing_cycles_get(start, finish);
+	}
+}
+
+/*
+ * Percentage of the memory not requested by live blocks that can't be
+ * allocated as a single block.  The largest block is found by bisection,
+ * it accounts for the chunk headers so an empty heap isn't quite at 0%.
+ */
+static uint8_t fragmentation(const struct allocator *a, size_t free_bytes)
+{
+	size_t lo = 0;
+	size_t hi = free_bytes;
+
+	if (free_bytes == 0U) {
+		return 0;
+	}
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo + 1U) / 2U;
+		void *block = a->alloc(mid);
+
+		if (block != NULL) {
+			a->free(block);
+			lo = mid;
+		} else {
+			hi = mid - 1U;
+		}
+	}
+
+	return (uint8_t)(100U - (100U * lo) / free_bytes);
+}
+
+static void replay(const struct allocator *a, const struct heap_op *ops, size_t num_ops,
+		   struct run_result *res)
+{
+	size_t live_bytes = 0;
+	int frag_idx = 0;
+	timing_t start;
+	timing_t finish;
+	void *mem;
+
+	*res = (struct run_result) {};
+	memset(live, 0, sizeof(live));
+	for (int i = 0; i < NUM_OP_TYPES; i++) {
+		samples[i].count = 0;
+	}
+
+	a->reset();
+
+	for (size_t i = 0; i < num_ops; i++) {
+		const struct heap_op *op = &ops[i];
+		struct live_block *b;
+
+		/* Measured outside of the timed operations */
+		while ((frag_idx < FRAG_SAMPLES) &&
+		       (i >= (frag_idx + 1) * num_ops / (FRAG_SAMPLES + 1))) {
+			res->frag_pct[frag_idx++] = fragmentation(a, HEAP_SIZE - live_bytes);
+		}
+
+		if (op->id >= MAX_BLOCKS) {
+			continue;
+		}
+		b = &live[op->id];
+
+		/* Operations on blocks that failed to allocate are skipped */
+		switch (op->type) {
+		case HEAP_OP_ALLOC:
+			if (b->ptr != NULL) {
+				break;
+			}
+
+			start = timing_counter_get();
+			mem = a->alloc(op->size);
+			finish = timing_counter_get();
+			sample_add(HEAP_OP_ALLOC, &start, &finish);
+
+			if (mem == NULL) {
+				res->failed_allocs++;
+				break;
+			}
+			b->ptr = mem;
+			b->size = op->size;
+			live_bytes += op->size;
+			break;
+		case HEAP_OP_FREE:
+			if (b->ptr == NULL) {
+				break;
+			}
+
+			start = timing_counter_get();
+			a->free(b->ptr);
+			finish = timing_counter_get();
+			sample_add(HEAP_OP_FREE, &start, &finish);
+
+			live_bytes -= b->size;
+			b->ptr = NULL;
+			break;
+		case HEAP_OP_REALLOC:
+			if (b->ptr == NULL) {
+				break;
+			}
+
+			start = timing_counter_get();
+			mem = a->realloc(b->ptr, b->size, op->size);
+			finish = timing_counter_get();
+			sample_add(HEAP_OP_REALLOC, &start, &finish);
+
+			res->reallocs++;
+			if (mem == NULL) {
+				/* The original block is left untouched */
+				res->failed_reallocs++;
+				break;
+			}
+			if (mem == b->ptr) {
+				res->reallocs_in_place++;
+			}
+			live_bytes = live_bytes - b->size + op->size;
+			b->ptr = mem;
+			b->size = op->size;
+			break;
+		default:
+			break;
+		}
+	}
+
+	/* In case a recorded trace leaves blocks behind */
+	for (int i = 0; i < MAX_BLOCKS; i++) {
+		if (live[i].ptr != NULL) {
+			a->free(live[i].ptr);
+		}
+	}
+}
+
+static int cycles_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void report_cycles(const char *tag, const char *op, struct op_samples *s)
+{
+	static const struct {
+		const char *name;
+		uint32_t permille;
+	} percentiles[] = {
+		{ "p50", 500 }, { "p90", 900 }, { "p99", 990 }, { "max", 1000 },
+	};
+	char metric[60];
+	char what[40];
+
+	if (s->count == 0U) {
+		return;
+	}
+
+	qsort(s->cycles, s->count, sizeof(s->cycles[0]), cycles_cmp);
+
+	for (int i = 0; i < ARRAY_SIZE(percentiles); i++) {
+		size_t idx = MIN(s->count * percentiles[i].permille / 1000U, s->count - 1U);
+		uint32_t cycles = s->cycles[idx];
+		uint32_t ns = (uint32_t)timing_cycles_to_ns(cycles);
+
+		snprintk(metric, sizeof(metric), "%s.%s.%s", tag, op, percentiles[i].name);
+		snprintk(what, sizeof(what), "%s, %s of %u", op, percentiles[i].name,
+			 (uint32_t)s->count);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+		printk("REC: %-50s - %-40s: %7u cycles , %7u ns :\n", metric, what, cycles, ns);
+#else
+		printk("%-50s - %-40s: %7u cycles (%7u nsec)\n", metric, what, cycles, ns);
+#endif
+	}
+}
+
+static void report(const char *tag, const struct run_result *res)
+{
+	uint8_t frag_max = 0;
+
+	for (int i = 0; i < NUM_OP_TYPES; i++) {
+		report_cycles(tag, op_names[i], &samples[i]);
+	}
+
+	printk("%-50s - fragmentation %%:", tag);
+	for (int i = 0; i < FRAG_SAMPLES; i++) {
+		printk(" %u", res->frag_pct[i]);
+		frag_max = MAX(frag_max, res->frag_pct[i]);
+	}
+	printk(" (max %u)\n", frag_max);
+
+	printk("%-50s - realloc in place: %u of %u (%u%%), failed: %u allocs, %u reallocs\n",
+	       tag, res->reallocs_in_place, res->reallocs,
+	       (res->reallocs != 0U) ? (100U * res->reallocs_in_place / res->reallocs) : 0U,
+	       res->failed_allocs, res->failed_reallocs);
+}
+
+int main(void)
+{
+	const struct heap_trace *traces;
+	size_t num_traces = heap_traces_get(&traces);
+	struct run_result result;
+	char tag[50];
+
+	timing_init();
+	timing_start();
+
+	printk("Heap measurements, %u bytes per allocator, clock frequency: %u MHz\n",
+	       HEAP_SIZE, timing_freq_get_mhz());
+
+	for (int i = 0; i < ARRAY_SIZE(allocators); i++) {
+		for (size_t j = 0; j < num_traces; j++) {
+			const struct heap_op *ops = traces[j].ops;
+			size_t num_ops = traces[j].num_ops;
+
+			if (traces[j].generate != NULL) {
+				num_ops = traces[j].generate(ops_buf, ARRAY_SIZE(ops_buf));
+				ops = ops_buf;
+			}
+
+			replay(&allocators[i], ops, num_ops, &result);
+
+			snprintk(tag, sizeof(tag), "%s.%s", allocators[i].name, traces[j].name);
+			report(tag, &result);
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
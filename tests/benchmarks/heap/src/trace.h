@@ -0,0 +1,47 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_TESTS_BENCHMARKS_HEAP_TRACE_H_
+#define ZEPHYR_TESTS_BENCHMARKS_HEAP_TRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MAX_BLOCKS CONFIG_BENCHMARK_HEAP_MAX_BLOCKS
+
+enum heap_op_type {
+	HEAP_OP_ALLOC,
+	HEAP_OP_FREE,
+	HEAP_OP_REALLOC,
+};
+
+/*
+ * One operation of an allocation trace.  Blocks are identified by a
+ * number lower than MAX_BLOCKS that is reused once the block is freed.
+ */
+struct heap_op {
+	uint8_t type;
+	uint16_t id;
+	uint32_t size;
+};
+
+#define HEAP_ALLOC(_id, _size)   { .type = HEAP_OP_ALLOC, .id = (_id), .size = (_size) }
+#define HEAP_FREE(_id)           { .type = HEAP_OP_FREE, .id = (_id) }
+#define HEAP_REALLOC(_id, _size) { .type = HEAP_OP_REALLOC, .id = (_id), .size = (_size) }
+
+struct heap_trace {
+	const char *name;
+	/* Fills @a ops with at most @a max_ops operations, returns their number */
+	size_t (*generate)(struct heap_op *ops, size_t max_ops);
+	/* Operations of a recorded trace, used when there is no generator */
+	const struct heap_op *ops;
+	size_t num_ops;
+};
+
+/* Returns the traces to replay, and their number */
+size_t heap_traces_get(const struct heap_trace **traces);
+
+#endif /* ZEPHYR_TESTS_BENCHMARKS_HEAP_TRACE_H_ */
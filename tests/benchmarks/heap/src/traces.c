@@ -0,0 +1,270 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Allocation traces replayed by the benchmark.  The generated traces are
+ * modeled after common workloads and are fully deterministic, so that
+ * every allocator and every build replays the same operations.
+ */
+
+#include <stdbool.h>
+#include <zephyr/sys/util.h>
+#include "trace.h"
+
+struct trace_gen {
+	struct heap_op *ops;
+	size_t max_ops;
+	size_t num_ops;
+	uint64_t rand_state;
+	/* Size of every live block, 0 for unused identifiers */
+	uint32_t sizes[MAX_BLOCKS];
+	size_t num_live;
+	size_t live_bytes;
+	/* Live blocks in allocation order, for FIFO traces */
+	uint16_t fifo[MAX_BLOCKS];
+	size_t fifo_head;
+};
+
+BUILD_ASSERT(CONFIG_BENCHMARK_HEAP_OPS > 2 * MAX_BLOCKS,
+	     "traces too short for the number of blocks");
+
+/* The traces keep the requested bytes around this share of the heap */
+#define TARGET_BYTES (CONFIG_BENCHMARK_HEAP_SIZE * 3 / 4)
+
+static struct trace_gen gen;
+
+/* Same LCRNG as the sys_heap stress test, for cross-platform repeatability */
+static uint32_t rand32(void)
+{
+	gen.rand_state = gen.rand_state * 2862933555777941757ULL + 3037000493ULL;
+
+	return (uint32_t)(gen.rand_state >> 32);
+}
+
+static uint32_t rand_range(uint32_t min, uint32_t max)
+{
+	return min + rand32() % (max - min + 1U);
+}
+
+static void gen_start(struct heap_op *ops, size_t max_ops)
+{
+	gen = (struct trace_gen) {
+		.ops = ops,
+		.max_ops = max_ops,
+		.rand_state = 123456789ULL,
+	};
+}
+
+/* Room left for more operations, keeping enough to free every block */
+static bool gen_room(size_t ops)
+{
+	return gen.num_ops + ops + MAX_BLOCKS <= gen.max_ops;
+}
+
+static int gen_alloc(uint32_t size)
+{
+	for (uint16_t id = 0; id < MAX_BLOCKS; id++) {
+		if (gen.sizes[id] == 0U) {
+			gen.ops[gen.num_ops++] = (struct heap_op)HEAP_ALLOC(id, size);
+			gen.sizes[id] = size;
+			gen.fifo[(gen.fifo_head + gen.num_live) % MAX_BLOCKS] = id;
+			gen.num_live++;
+			gen.live_bytes += size;
+			return id;
+		}
+	}
+
+	return -1;
+}
+
+static void gen_free(uint16_t id)
+{
+	gen.ops[gen.num_ops++] = (struct heap_op)HEAP_FREE(id);
+	gen.live_bytes -= gen.sizes[id];
+	gen.sizes[id] = 0U;
+	gen.num_live--;
+}
+
+static void gen_realloc(uint16_t id, uint32_t size)
+{
+	gen.ops[gen.num_ops++] = (struct heap_op)HEAP_REALLOC(id, size);
+	gen.live_bytes = gen.live_bytes - gen.sizes[id] + size;
+	gen.sizes[id] = size;
+}
+
+/* Frees the oldest live block, only valid if blocks are freed in order */
+static void gen_free_oldest(void)
+{
+	gen_free(gen.fifo[gen.fifo_head]);
+	gen.fifo_head = (gen.fifo_head + 1U) % MAX_BLOCKS;
+}
+
+/* Returns a random live block, the trace must have one */
+static uint16_t gen_random_live(void)
+{
+	uint16_t id = rand32() % MAX_BLOCKS;
+
+	while (gen.sizes[id] == 0U) {
+		id = (id + 1U) % MAX_BLOCKS;
+	}
+
+	return id;
+}
+
+static size_t gen_end(void)
+{
+	for (uint16_t id = 0; id < MAX_BLOCKS; id++) {
+		if (gen.sizes[id] != 0U) {
+			gen_free(id);
+		}
+	}
+
+	return gen.num_ops;
+}
+
+/*
+ * Network stack: bursts of packets made of small headers and of buffers
+ * close to the MTU, released in the order they were allocated.
+ */
+static size_t gen_packets(struct heap_op *ops, size_t max_ops)
+{
+	gen_start(ops, max_ops);
+
+	while (gen_room(2 * 8 + 16)) {
+		uint32_t burst = rand_range(1, 8);
+		uint32_t in_flight = rand_range(4, 16);
+
+		for (uint32_t i = 0; i < burst; i++) {
+			uint32_t size = (rand32() % 10 < 6) ? rand_range(48, 128) :
+				rand_range(1280, 1536);
+
+			if (gen.live_bytes + size <= TARGET_BYTES) {
+				(void)gen_alloc(size);
+			}
+		}
+
+		while (gen.num_live > in_flight) {
+			gen_free_oldest();
+		}
+	}
+
+	return gen_end();
+}
+
+/*
+ * Parsing and serializing documents: many small nodes and strings, and
+ * an output buffer growing by doubling, all released with the document.
+ */
+static size_t gen_documents(struct heap_op *ops, size_t max_ops)
+{
+	gen_start(ops, max_ops);
+
+	while (gen_room(2 * MAX_BLOCKS)) {
+		uint32_t nodes = rand_range(8, MIN(48, MAX_BLOCKS / 2));
+		uint32_t cap = 64;
+		uint32_t len = 0;
+		int buf = gen_alloc(cap);
+
+		for (uint32_t i = 0; i < nodes; i++) {
+			(void)gen_alloc(rand_range(16, 48));
+			if (rand32() % 4 == 0U) {
+				(void)gen_alloc(rand_range(4, 120));
+			}
+
+			len += rand_range(8, 40);
+			if (len > cap) {
+				cap *= 2U;
+				gen_realloc(buf, cap);
+			}
+		}
+
+		/* Nodes and strings, then the buffer */
+		while (gen.num_live > 1U) {
+			uint16_t id = gen_random_live();
+
+			if (id != buf) {
+				gen_free(id);
+			}
+		}
+		gen_free(buf);
+		gen.fifo_head = 0U;
+	}
+
+	return gen_end();
+}
+
+/*
+ * General purpose mix: a population of long-lived blocks, short-lived
+ * ones of sizes favoring small blocks, and blocks growing or shrinking.
+ */
+static size_t gen_mixed(struct heap_op *ops, size_t max_ops)
+{
+	const uint16_t long_lived = MAX_BLOCKS / 8;
+
+	gen_start(ops, max_ops);
+
+	while (gen_room(1)) {
+		uint32_t choice = rand32() % 100;
+
+		if (gen.num_live == 0U) {
+			choice = 0U;
+		} else if (gen.live_bytes > TARGET_BYTES) {
+			choice = 99U;
+		}
+
+		if (choice < 45) {
+			/* Twice as large blocks are half as frequent */
+			uint32_t scale = MIN(4U + (uint32_t)__builtin_clz(rand32() | 1U), 10U);
+			uint32_t size = rand32() & BIT_MASK(scale);
+
+			if ((size != 0U) && (gen.live_bytes + size <= TARGET_BYTES)) {
+				(void)gen_alloc(size);
+			}
+		} else if (choice < 60) {
+			uint16_t id = gen_random_live();
+			uint32_t size = gen.sizes[id];
+			uint32_t grown = MIN(size + size / 2U + 1U, 2048U);
+
+			if ((rand32() & 1U) && (gen.live_bytes + grown - size <= TARGET_BYTES)) {
+				gen_realloc(id, grown);
+			} else {
+				gen_realloc(id, MAX(size / 2U, 1U));
+			}
+		} else {
+			uint16_t id = gen_random_live();
+
+			/* Long-lived blocks are rarely released */
+			if ((id >= long_lived) || (rand32() % 16 == 0U)) {
+				gen_free(id);
+			}
+		}
+	}
+
+	return gen_end();
+}
+
+#ifdef CONFIG_BENCHMARK_HEAP_TRACE
+static const struct heap_op recorded_ops[] = {
+#include CONFIG_BENCHMARK_HEAP_TRACE_FILE
+};
+#endif
+
+static const struct heap_trace traces[] = {
+	{ .name = "packets", .generate = gen_packets },
+	{ .name = "documents", .generate = gen_documents },
+	{ .name = "mixed", .generate = gen_mixed },
+#ifdef CONFIG_BENCHMARK_HEAP_TRACE
+	{ .name = "recorded", .ops = recorded_ops, .num_ops = ARRAY_SIZE(recorded_ops) },
+#endif
+};
+
+size_t heap_traces_get(const struct heap_trace **list)
+{
+	*list = traces;
+
+	return ARRAY_SIZE(traces);
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IPC_BENCH_H_
+#define IPC_BENCH_H_
+
+#include <stdint.h>
+
+#define IPC_BENCH_EPT_NAME "bench"
+
+enum ipc_bench_cmd {
+	/* Sent back as is by the remote. */
+	IPC_BENCH_CMD_ECHO = 1,
+	/* Counted by the remote, the first one of a stream starts measuring its load. */
+	IPC_BENCH_CMD_STREAM,
+	/* Ends a stream, the remote replies with IPC_BENCH_CMD_REPORT. */
+	IPC_BENCH_CMD_STREAM_END,
+	IPC_BENCH_CMD_REPORT,
+};
+
+/* Header of every message, followed by the payload up to the message size. */
+struct ipc_bench_hdr {
+	uint32_t cmd;
+	uint32_t seq;
+};
+
+struct ipc_bench_report {
+	struct ipc_bench_hdr hdr;
+	/* Stream messages received since the first one of the stream. */
+	uint32_t received;
+	uint32_t bytes;
+	/* CPU load of the remote during the stream, in per mille. */
+	uint32_t load_permille;
+};
+
+#endif /* IPC_BENCH_H_ */
@@ -0,0 +1,109 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+
+#include <ipc_bench.h>
+
+static struct ipc_ept ept;
+static K_SEM_DEFINE(bound_sem, 0, 1);
+
+static uint32_t stream_received;
+static uint32_t stream_bytes;
+static k_thread_runtime_stats_t stream_start;
+
+static void ept_bound(void *priv)
+{
+	k_sem_give(&bound_sem);
+}
+
+static uint32_t load_since(const k_thread_runtime_stats_t *start)
+{
+	k_thread_runtime_stats_t now;
+	uint64_t busy;
+	uint64_t all;
+
+	k_thread_runtime_stats_all_get(&now);
+
+	busy = now.total_cycles - start->total_cycles;
+	all = now.execution_cycles - start->execution_cycles;
+
+	return (all == 0) ? 0 : (uint32_t)((busy * 1000U) / all);
+}
+
+static void ept_recv(const void *data, size_t len, void *priv)
+{
+	struct ipc_bench_hdr hdr;
+	struct ipc_bench_report report = {
+		.hdr.cmd = IPC_BENCH_CMD_REPORT,
+	};
+
+	if (len < sizeof(hdr)) {
+		return;
+	}
+
+	memcpy(&hdr, data, sizeof(hdr));
+
+	switch (hdr.cmd) {
+	case IPC_BENCH_CMD_ECHO:
+		/* Replied from the callback, to measure the backend only. */
+		(void)ipc_service_send(&ept, data, len);
+		break;
+	case IPC_BENCH_CMD_STREAM:
+		if (hdr.seq == 0U) {
+			stream_received = 0U;
+			stream_bytes = 0U;
+			k_thread_runtime_stats_all_get(&stream_start);
+		}
+		stream_received++;
+		stream_bytes += len;
+		break;
+	case IPC_BENCH_CMD_STREAM_END:
+		report.hdr.seq = hdr.seq;
+		report.received = stream_received;
+		report.bytes = stream_bytes;
+		report.load_permille = load_since(&stream_start);
+		(void)ipc_service_send(&ept, &report, sizeof(report));
+		break;
+	default:
+		break;
+	}
+}
+
+static struct ipc_ept_cfg ept_cfg = {
+	.name = IPC_BENCH_EPT_NAME,
+	.cb = {
+		.bound = ept_bound,
+		.received = ept_recv,
+	},
+};
+
+int main(void)
+{
+	const struct device *ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+	int ret;
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		printk("ipc_service_open_instance() failure %d\n", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ept, &ept_cfg);
+	if (ret < 0) {
+		printk("ipc_service_register_endpoint() failure %d\n", ret);
+		return ret;
+	}
+
+	k_sem_take(&bound_sem, K_FOREVER);
+	printk("IPC benchmark remote bound\n");
+
+	return 0;
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the round-trip latency, the one-way throughput and the CPU load of
+ * both cores for the IPC service backend of the ipc0 instance.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/timing/timing.h>
+
+#include <ipc_bench.h>
+
+#define IPC_NODE DT_NODELABEL(ipc0)
+
+#if DT_NODE_HAS_COMPAT(IPC_NODE, zephyr_ipc_icmsg)
+#define BACKEND_NAME "icmsg"
+#elif DT_NODE_HAS_COMPAT(IPC_NODE, zephyr_ipc_icmsg_me_initiator)
+#define BACKEND_NAME "icmsg_me"
+#elif DT_NODE_HAS_COMPAT(IPC_NODE, zephyr_ipc_icbmsg)
+#define BACKEND_NAME "icbmsg"
+#elif DT_NODE_HAS_COMPAT(IPC_NODE, zephyr_ipc_openamp_static_vrings)
+#define BACKEND_NAME "rpmsg"
+#else
+#define BACKEND_NAME "unknown"
+#endif
+
+#define REPLY_TIMEOUT K_MSEC(CONFIG_IPC_BENCH_REPLY_TIMEOUT_MS)
+
+static struct ipc_ept ept;
+static K_SEM_DEFINE(bound_sem, 0, 1);
+static K_SEM_DEFINE(reply_sem, 0, 1);
+
+static uint32_t expected_seq;
+static struct ipc_bench_report report;
+
+static uint8_t tx_buf[CONFIG_IPC_BENCH_MAX_MSG_SIZE] __aligned(4);
+static uint32_t rtt_cycles[CONFIG_IPC_BENCH_RTT_SAMPLES];
+
+static void ept_bound(void *priv)
+{
+	k_sem_give(&bound_sem);
+}
+
+static void ept_recv(const void *data, size_t len, void *priv)
+{
+	struct ipc_bench_hdr hdr;
+
+	if (len < sizeof(hdr)) {
+		return;
+	}
+
+	memcpy(&hdr, data, sizeof(hdr));
+
+	if (hdr.seq != expected_seq) {
+		/* Late reply to a request that timed out. */
+		return;
+	}
+
+	if (hdr.cmd == IPC_BENCH_CMD_REPORT && len >= sizeof(report)) {
+		memcpy(&report, data, sizeof(report));
+	}
+
+	k_sem_give(&reply_sem);
+}
+
+static struct ipc_ept_cfg ept_cfg = {
+	.name = IPC_BENCH_EPT_NAME,
+	.cb = {
+		.bound = ept_bound,
+		.received = ept_recv,
+	},
+};
+
+static void record(const char *test, size_t size, const char *metric, uint32_t value,
+		   const char *unit)
+{
+	printk("IPC_BENCH: backend=%s test=%s size=%u metric=%s value=%u unit=%s\n",
+	       BACKEND_NAME, test, (uint32_t)size, metric, value, unit);
+}
+
+static int send_retry(const void *data, size_t len, uint32_t *retries)
+{
+	int ret;
+
+	do {
+		ret = ipc_service_send(&ept, data, len);
+		if (ret == -ENOMEM || ret == -ENOBUFS || ret == -EBUSY) {
+			/* TX buffers are full, let the remote catch up. */
+			(*retries)++;
+			k_yield();
+		}
+	} while (ret == -ENOMEM || ret == -ENOBUFS || ret == -EBUSY);
+
+	return ret;
+}
+
+static void prepare(uint32_t cmd, uint32_t seq, size_t size)
+{
+	struct ipc_bench_hdr hdr = {
+		.cmd = cmd,
+		.seq = seq,
+	};
+
+	memcpy(tx_buf, &hdr, sizeof(hdr));
+	memset(&tx_buf[sizeof(hdr)], (uint8_t)seq, size - sizeof(hdr));
+}
+
+static uint32_t load_since(const k_thread_runtime_stats_t *start)
+{
+	k_thread_runtime_stats_t now;
+	uint64_t busy;
+	uint64_t all;
+
+	k_thread_runtime_stats_all_get(&now);
+
+	busy = now.total_cycles - start->total_cycles;
+	all = now.execution_cycles - start->execution_cycles;
+
+	return (all == 0) ? 0 : (uint32_t)((busy * 1000U) / all);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t va = *(const uint32_t *)a;
+	uint32_t vb = *(const uint32_t *)b;
+
+	return (va > vb) - (va < vb);
+}
+
+static uint32_t percentile_ns(uint32_t count, uint32_t pct)
+{
+	uint32_t idx = ((count - 1U) * pct) / 100U;
+
+	return (uint32_t)timing_cycles_to_ns(rtt_cycles[idx]);
+}
+
+static void bench_rtt(size_t size)
+{
+	uint32_t count = 0U;
+	uint32_t lost = 0U;
+	uint32_t retries = 0U;
+	timing_t start;
+	timing_t end;
+	int ret;
+
+	for (uint32_t i = 0U; i < CONFIG_IPC_BENCH_RTT_SAMPLES; i++) {
+		expected_seq++;
+		prepare(IPC_BENCH_CMD_ECHO, expected_seq, size);
+		k_sem_reset(&reply_sem);
+
+		start = timing_counter_get();
+		ret = send_retry(tx_buf, size, &retries);
+		if (ret < 0) {
+			printk("send failed size %u: %d\n", (uint32_t)size, ret);
+			lost++;
+			continue;
+		}
+
+		if (k_sem_take(&reply_sem, REPLY_TIMEOUT) != 0) {
+			lost++;
+			continue;
+		}
+		end = timing_counter_get();
+
+		rtt_cycles[count++] = (uint32_t)timing_cycles_get(&start, &end);
+	}
+
+	record("rtt", size, "lost", lost, "msgs");
+
+	if (count == 0U) {
+		return;
+	}
+
+	qsort(rtt_cycles, count, sizeof(rtt_cycles[0]), cmp_u32);
+
+	record("rtt", size, "p50", percentile_ns(count, 50), "ns");
+	record("rtt", size, "p90", percentile_ns(count, 90), "ns");
+	record("rtt", size, "p99", percentile_ns(count, 99), "ns");
+	record("rtt", size, "max", percentile_ns(count, 100), "ns");
+}
+
+static void bench_throughput(size_t size)
+{
+	k_thread_runtime_stats_t load_start;
+	uint32_t retries = 0U;
+	uint32_t sent = 0U;
+	uint32_t load;
+	timing_t start;
+	timing_t end;
+	uint64_t ns;
+	int ret;
+
+	k_thread_runtime_stats_all_get(&load_start);
+	start = timing_counter_get();
+
+	for (uint32_t i = 0U; i < CONFIG_IPC_BENCH_STREAM_MSGS; i++) {
+		prepare(IPC_BENCH_CMD_STREAM, i, size);
+
+		ret = send_retry(tx_buf, size, &retries);
+		if (ret < 0) {
+			printk("send failed size %u: %d\n", (uint32_t)size, ret);
+			break;
+		}
+		sent++;
+	}
+
+	/* The report is sent once the remote processed all the messages. */
+	expected_seq++;
+	prepare(IPC_BENCH_CMD_STREAM_END, expected_seq, sizeof(struct ipc_bench_hdr));
+	k_sem_reset(&reply_sem);
+	ret = send_retry(tx_buf, sizeof(struct ipc_bench_hdr), &retries);
+	if (ret < 0 || k_sem_take(&reply_sem, REPLY_TIMEOUT) != 0) {
+		printk("no stream report size %u\n", (uint32_t)size);
+		return;
+	}
+
+	end = timing_counter_get();
+	load = load_since(&load_start);
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	record("throughput", size, "bytes_per_sec",
+	       (ns == 0) ? 0 : (uint32_t)(((uint64_t)report.bytes * NSEC_PER_SEC) / ns), "B/s");
+	record("throughput", size, "lost", sent - report.received, "msgs");
+	record("throughput", size, "retries", retries, "tries");
+	record("throughput", size, "load_local", load, "permille");
+	record("throughput", size, "load_remote", report.load_permille, "permille");
+}
+
+int main(void)
+{
+	const struct device *ipc0_instance = DEVICE_DT_GET(IPC_NODE);
+	int ret;
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		printk("ipc_service_open_instance() failure %d\n", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ept, &ept_cfg);
+	if (ret < 0) {
+		printk("ipc_service_register_endpoint() failure %d\n", ret);
+		return ret;
+	}
+
+	k_sem_take(&bound_sem, K_FOREVER);
+
+	timing_init();
+	timing_start();
+
+	printk("IPC service benchmark, backend %s, %u round trips, %u stream messages\n",
+	       BACKEND_NAME, CONFIG_IPC_BENCH_RTT_SAMPLES, CONFIG_IPC_BENCH_STREAM_MSGS);
+
+	for (size_t size = CONFIG_IPC_BENCH_MIN_MSG_SIZE; size <= CONFIG_IPC_BENCH_MAX_MSG_SIZE;
+	     size *= 2U) {
+		bench_rtt(size);
+		bench_throughput(size);
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+
+	return 0;
+}
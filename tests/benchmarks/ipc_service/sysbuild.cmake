@@ -0,0 +1,22 @@
+# Copyright The Zephyr Project Contributors
+# SPDX-License-Identifier: Apache-2.0
+
+if("${SB_CONFIG_REMOTE_BOARD}" STREQUAL "")
+	message(FATAL_ERROR "REMOTE_BOARD must be set to a valid board name")
+endif()
+
+set(REMOTE_APP remote)
+
+ExternalZephyrProject_Add(
+	APPLICATION ${REMOTE_APP}
+	SOURCE_DIR  ${APP_DIR}/${REMOTE_APP}
+	BOARD       ${SB_CONFIG_REMOTE_BOARD}
+)
+
+# Add dependencies so that the remote image will be built first
+# This is required because some primary cores need information from the
+# remote core's build, such as the output image's LMA
+add_dependencies(${DEFAULT_IMAGE} ${REMOTE_APP})
+sysbuild_add_dependencies(CONFIGURE ${DEFAULT_IMAGE} ${REMOTE_APP})
+# Add dependency so that the remote image is flashed first.
+sysbuild_add_dependencies(FLASH ${DEFAULT_IMAGE} ${REMOTE_APP})
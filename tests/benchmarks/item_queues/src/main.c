@@ -0,0 +1,241 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compare the cost of passing pointers through a FIFO, a message queue
+ * and a ring queue:
+ *  1. Adding then removing an item from a thread, without contention
+ *  2. Adding a batch of items from an ISR and draining it from a thread
+ *  3. Streaming items from a producer thread to a consumer thread
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+#define QUEUE_DEPTH    CONFIG_BENCHMARK_QUEUE_DEPTH
+#define STACK_SIZE     (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(QUEUE_DEPTH), "queue depth must be a power of two");
+
+struct item {
+	void *fifo_reserved;
+	uint32_t value;
+};
+
+/* One item per iteration: a FIFO item may only be queued once at a time */
+static struct item items[MAX(NUM_ITERATIONS, QUEUE_DEPTH)];
+
+static K_FIFO_DEFINE(fifo);
+K_MSGQ_DEFINE(msgq, sizeof(void *), QUEUE_DEPTH, sizeof(void *));
+K_RINGQ_DEFINE(ringq, QUEUE_DEPTH);
+
+static struct k_thread producer_thread;
+static struct k_thread consumer_thread;
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+
+struct queue_ops {
+	const char *name;
+	int (*put)(void *item, k_timeout_t timeout);
+	void *(*get)(k_timeout_t timeout);
+};
+
+static int fifo_put(void *item, k_timeout_t timeout)
+{
+	ARG_UNUSED(timeout);
+
+	k_fifo_put(&fifo, item);
+
+	return 0;
+}
+
+static void *fifo_get(k_timeout_t timeout)
+{
+	return k_fifo_get(&fifo, timeout);
+}
+
+static int msgq_put(void *item, k_timeout_t timeout)
+{
+	return k_msgq_put(&msgq, &item, timeout);
+}
+
+static void *msgq_get(k_timeout_t timeout)
+{
+	void *item;
+
+	return (k_msgq_get(&msgq, &item, timeout) == 0) ? item : NULL;
+}
+
+static int ringq_put(void *item, k_timeout_t timeout)
+{
+	return k_ringq_put(&ringq, item, timeout);
+}
+
+static void *ringq_get(k_timeout_t timeout)
+{
+	void *item;
+
+	return (k_ringq_get(&ringq, &item, timeout) == 0) ? item : NULL;
+}
+
+static const struct queue_ops queues[] = {
+	{ "fifo", fifo_put, fifo_get },
+	{ "msgq", msgq_put, msgq_get },
+	{ "ringq", ringq_put, ringq_get },
+};
+
+static void report(const char *name, const char *test, const char *what,
+		   uint64_t cycles, uint32_t count)
+{
+	char tag[50];
+	uint32_t avg = (uint32_t)(cycles / count);
+	uint32_t ns = (uint32_t)timing_cycles_to_ns_avg(cycles, count);
+
+	snprintk(tag, sizeof(tag), "%s.%s", name, test);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s: %7u cycles , %7u ns :\n", tag, what, avg, ns);
+#else
+	printk("%-40s - %-50s: %7u cycles (%7u nsec)\n", tag, what, avg, ns);
+#endif
+}
+
+static void test_immediate(const struct queue_ops *q)
+{
+	uint64_t put_sum = 0ULL;
+	uint64_t get_sum = 0ULL;
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+
+	for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		(void)q->put(&items[i], K_NO_WAIT);
+		mid = timing_counter_get();
+		(void)q->get(K_NO_WAIT);
+		finish = timing_counter_get();
+
+		put_sum += timing_cycles_get(&start, &mid);
+		get_sum += timing_cycles_get(&mid, &finish);
+	}
+
+	report(q->name, "put.immediate", "Add item (no contention)", put_sum, NUM_ITERATIONS);
+	report(q->name, "get.immediate", "Remove item (no contention)", get_sum, NUM_ITERATIONS);
+}
+
+static uint64_t isr_cycles;
+
+static void isr_put_batch(const void *arg)
+{
+	const struct queue_ops *q = arg;
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < QUEUE_DEPTH; i++) {
+		(void)q->put(&items[i], K_NO_WAIT);
+	}
+	finish = timing_counter_get();
+
+	isr_cycles += timing_cycles_get(&start, &finish);
+}
+
+static void test_isr_to_thread(const struct queue_ops *q)
+{
+	uint32_t batches = MAX(NUM_ITERATIONS / QUEUE_DEPTH, 1);
+	uint64_t get_sum = 0ULL;
+	timing_t start;
+	timing_t finish;
+
+	isr_cycles = 0ULL;
+
+	for (uint32_t i = 0; i < batches; i++) {
+		irq_offload(isr_put_batch, q);
+
+		start = timing_counter_get();
+		for (uint32_t j = 0; j < QUEUE_DEPTH; j++) {
+			(void)q->get(K_NO_WAIT);
+		}
+		finish = timing_counter_get();
+
+		get_sum += timing_cycles_get(&start, &finish);
+	}
+
+	report(q->name, "put.isr", "Add item from ISR", isr_cycles, batches * QUEUE_DEPTH);
+	report(q->name, "get.drain", "Remove item added from ISR", get_sum,
+	       batches * QUEUE_DEPTH);
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	const struct queue_ops *q = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+		(void)q->put(&items[i], K_FOREVER);
+	}
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	const struct queue_ops *q = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+		(void)q->get(K_FOREVER);
+	}
+}
+
+static void test_stream(const struct queue_ops *q)
+{
+	int prio = k_thread_priority_get(k_current_get()) - 1;
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE, consumer_entry,
+			(void *)q, NULL, NULL, prio, 0, K_NO_WAIT);
+	k_thread_create(&producer_thread, producer_stack, STACK_SIZE, producer_entry,
+			(void *)q, NULL, NULL, prio, 0, K_NO_WAIT);
+
+	k_thread_join(&producer_thread, K_FOREVER);
+	k_thread_join(&consumer_thread, K_FOREVER);
+
+	finish = timing_counter_get();
+
+	report(q->name, "stream", "Pass item from thread to thread",
+	       timing_cycles_get(&start, &finish), NUM_ITERATIONS);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("Item queue measurements, clock frequency: %u MHz\n",
+	       timing_freq_get_mhz());
+
+	for (int i = 0; i < ARRAY_SIZE(queues); i++) {
+		test_immediate(&queues[i]);
+		test_isr_to_thread(&queues[i]);
+		test_stream(&queues[i]);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -15,6 +15,13 @@
  *   2. User thread   -> User thread
  *   3. Kernel thread -> User thread
  *   4. User thread   -> Kernel thread
+ *
+ * When FPU sharing is enabled, the kernel thread case is also measured with
+ * threads that use the floating point registers between each switch, so that
+ * the cost of saving and restoring the FP context shows up. This is measured
+ * once with both threads using the FP registers, and once with only one of
+ * them doing so, which is the case where lazy FP context switching avoids
+ * any save or restore.
  */
 
 #include <zephyr/kernel.h>
@@ -25,17 +32,34 @@
 #include "utils.h"
 #include "timing_sc.h"
 
+#if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING)
+static volatile double fp_value;
+
+/* Dirty the FP registers, so that the FP context has to be switched */
+static inline void fp_touch(bool use_fp)
+{
+	if (use_fp) {
+		fp_value = fp_value * 0.5 + 1.0;
+	}
+}
+#else
+#define fp_touch(use_fp) ARG_UNUSED(use_fp)
+#endif
+
 static void alt_thread_entry(void *p1, void *p2, void *p3)
 {
 	uint32_t  num_iterations;
+	bool      use_fp;
 
-	ARG_UNUSED(p2);
-	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
 
 	num_iterations = (uint32_t)(uintptr_t)p1;
+	use_fp = (bool)(uintptr_t)p2;
 
 	for (uint32_t i = 0; i < num_iterations; i++) {
 
+		fp_touch(use_fp);
+
 		/* 3. Obtain the 'finish' timestamp */
 
 		timestamp.sample = timing_timestamp_get();
@@ -53,16 +77,19 @@ static void start_thread_entry(void *p1, void *p2, void *p3)
 	uint32_t  num_iterations;
 	timing_t  start;
 	timing_t  finish;
+	bool      use_fp;
 
-	ARG_UNUSED(p2);
-	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
 
 	num_iterations = (uint32_t)(uintptr_t)p1;
+	use_fp = (bool)(uintptr_t)p2;
 
 	k_thread_start(&alt_thread);
 
 	for (uint32_t i = 0; i < num_iterations; i++) {
 
+		fp_touch(use_fp);
+
 		/* 1. Get 'start' timestamp */
 
 		start = timing_timestamp_get();
@@ -104,13 +131,15 @@ static void thread_switch_yield_common(const char *description,
 	k_thread_create(&start_thread, start_stack,
 			K_THREAD_STACK_SIZEOF(start_stack),
 			start_thread_entry,
-			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)((start_options & K_FP_REGS) != 0), NULL,
 			priority - 1, start_options, K_FOREVER);
 
 	k_thread_create(&alt_thread, alt_stack,
 			K_THREAD_STACK_SIZEOF(alt_stack),
 			alt_thread_entry,
-			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)((alt_options & K_FP_REGS) != 0), NULL,
 			priority - 1, alt_options, K_FOREVER);
 
 	/* Grant access rights if necessary */
@@ -170,4 +199,20 @@ void thread_switch_yield(uint32_t num_iterations, bool is_cooperative)
 	thread_switch_yield_common(description, num_iterations, K_USER, 0,
 				   priority);
 #endif
+
+#if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING)
+	/* Kernel -> Kernel, both threads using the FP registers */
+	snprintf(description, sizeof(description),
+		 "thread.yield.%s.fp.ctx",
+		 is_cooperative ? "cooperative" : "preemptive");
+	thread_switch_yield_common(description, num_iterations, K_FP_REGS,
+				   K_FP_REGS, priority);
+
+	/* Kernel -> Kernel, only <alt_thread> using the FP registers */
+	snprintf(description, sizeof(description),
+		 "thread.yield.%s.fp1.ctx",
+		 is_cooperative ? "cooperative" : "preemptive");
+	thread_switch_yield_common(description, num_iterations, 0,
+				   K_FP_REGS, priority);
+#endif
 }
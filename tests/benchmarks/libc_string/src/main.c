@@ -0,0 +1,108 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure memcpy, memset and memcmp of the C library over areas from 8 bytes
+ * to 64 KiB, aligned and not.
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_LEN    (64 * 1024)
+#define ITERATIONS 16
+
+enum op {
+	OP_MEMCPY,
+	OP_MEMSET,
+	OP_MEMCMP,
+};
+
+static const char *const op_names[] = {
+	[OP_MEMCPY] = "memcpy",
+	[OP_MEMSET] = "memset",
+	[OP_MEMCMP] = "memcmp",
+};
+
+static uint8_t __aligned(16) src[MAX_LEN + 16];
+static uint8_t __aligned(16) dst[MAX_LEN + 16];
+
+/* Keeps the compiler from dropping the comparisons */
+static volatile int sink;
+
+static void measure(enum op op, size_t len, size_t offset)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+	uint32_t ns;
+	uint32_t kib_s;
+	char metric[50];
+	char what[40];
+
+	/* Both areas equal, for memcmp to go through all of them */
+	memcpy(&dst[offset], &src[0], len);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		switch (op) {
+		case OP_MEMCPY:
+			memcpy(&dst[offset], &src[0], len);
+			break;
+		case OP_MEMSET:
+			memset(&dst[offset], 0x5a, len);
+			break;
+		case OP_MEMCMP:
+			sink = memcmp(&dst[offset], &src[0], len);
+			break;
+		}
+	}
+	finish = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &finish) / ITERATIONS;
+	ns = (uint32_t)timing_cycles_to_ns(cycles);
+	kib_s = (ns != 0U) ? (uint32_t)((uint64_t)len * NSEC_PER_SEC / ns / 1024U) : 0U;
+
+	snprintk(metric, sizeof(metric), "libc.%s.%s.%zu", op_names[op],
+		 (offset == 0U) ? "aligned" : "unaligned", len);
+	snprintk(what, sizeof(what), "%zu bytes, %u KiB/s", len, kib_s);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-50s - %-40s: %7u cycles , %7u ns :\n", metric, what, (uint32_t)cycles, ns);
+#else
+	printk("%-50s - %-40s: %7u cycles (%7u nsec)\n", metric, what, (uint32_t)cycles, ns);
+#endif
+}
+
+int main(void)
+{
+	for (size_t i = 0; i < sizeof(src); i++) {
+		src[i] = (uint8_t)(i * 31U + 7U);
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("C library string measurements, %u iterations, clock frequency: %u MHz\n",
+	       ITERATIONS, timing_freq_get_mhz());
+
+	for (int op = OP_MEMCPY; op <= OP_MEMCMP; op++) {
+		for (size_t len = 8; len <= MAX_LEN; len *= 2) {
+			measure(op, len, 0);
+			measure(op, len, 3);
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,426 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the request/response latency and rate of UDP and TCP sockets, the
+ * TCP bulk throughput, and the number of net_pkt allocations per packet,
+ * through the loopback interface. This exercises the whole socket and IP
+ * stack, without any dependency on a real network.
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/net_pkt.h>
+
+#define SAMPLES    CONFIG_BENCHMARK_NET_SAMPLES
+#define BULK_SIZE  CONFIG_BENCHMARK_NET_BULK_SIZE
+#define MSG_LEN    64
+#define CHUNK_LEN  1024
+
+#define UDP_PORT   4242
+#define TCP_PORT   4243
+#define BULK_PORT  4244
+
+#define SERVER_STACK_SIZE 2048
+#define SERVER_PRIORITY   K_PRIO_PREEMPT(1)
+
+static K_SEM_DEFINE(server_ready, 0, 3);
+static K_SEM_DEFINE(bulk_done, 0, 1);
+
+static uint64_t samples[SAMPLES];
+static uint8_t tx_buf[CHUNK_LEN];
+
+static void report(const char *metric, const char *what, uint64_t cycles)
+{
+	uint32_t ns = (uint32_t)timing_cycles_to_ns(cycles);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-50s - %-40s: %7u cycles , %7u ns :\n", metric, what, (uint32_t)cycles, ns);
+#else
+	printk("%-50s - %-40s: %7u cycles (%7u nsec)\n", metric, what, (uint32_t)cycles, ns);
+#endif
+}
+
+static uint32_t pkt_alloc_count(void)
+{
+	uint32_t count = 0U;
+
+	STRUCT_SECTION_FOREACH(net_pkt_alloc_stats_slab, stats) {
+		count += stats->ok.count;
+	}
+
+	return count;
+}
+
+static void fill_addr(struct sockaddr_in *addr, uint16_t port)
+{
+	addr->sin_family = AF_INET;
+	addr->sin_port = htons(port);
+	zsock_inet_pton(AF_INET, "127.0.0.1", &addr->sin_addr);
+}
+
+static int bind_socket(int type, int proto, uint16_t port)
+{
+	struct sockaddr_in addr;
+	int sock;
+
+	sock = zsock_socket(AF_INET, type, proto);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	fill_addr(&addr, port);
+	if (zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		zsock_close(sock);
+		return -errno;
+	}
+
+	if (type == SOCK_STREAM && zsock_listen(sock, 1) < 0) {
+		zsock_close(sock);
+		return -errno;
+	}
+
+	return sock;
+}
+
+static int send_all(int sock, const uint8_t *buf, size_t len)
+{
+	while (len > 0) {
+		ssize_t ret = zsock_send(sock, buf, len, 0);
+
+		if (ret < 0) {
+			return -errno;
+		}
+
+		buf += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static int recv_all(int sock, uint8_t *buf, size_t len)
+{
+	while (len > 0) {
+		ssize_t ret = zsock_recv(sock, buf, len, 0);
+
+		if (ret <= 0) {
+			return (ret == 0) ? -ECONNRESET : -errno;
+		}
+
+		buf += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static void udp_echo_server(void *p1, void *p2, void *p3)
+{
+	uint8_t buf[MSG_LEN];
+	int sock;
+
+	sock = bind_socket(SOCK_DGRAM, IPPROTO_UDP, UDP_PORT);
+	k_sem_give(&server_ready);
+	if (sock < 0) {
+		return;
+	}
+
+	while (true) {
+		struct sockaddr addr;
+		socklen_t addrlen = sizeof(addr);
+		ssize_t len;
+
+		len = zsock_recvfrom(sock, buf, sizeof(buf), 0, &addr, &addrlen);
+		if (len > 0) {
+			(void)zsock_sendto(sock, buf, len, 0, &addr, addrlen);
+		}
+	}
+}
+
+static void tcp_echo_server(void *p1, void *p2, void *p3)
+{
+	uint8_t buf[MSG_LEN];
+	int sock;
+	int conn;
+
+	sock = bind_socket(SOCK_STREAM, IPPROTO_TCP, TCP_PORT);
+	k_sem_give(&server_ready);
+	if (sock < 0) {
+		return;
+	}
+
+	conn = zsock_accept(sock, NULL, NULL);
+	if (conn < 0) {
+		return;
+	}
+
+	while (recv_all(conn, buf, sizeof(buf)) == 0) {
+		if (send_all(conn, buf, sizeof(buf)) < 0) {
+			break;
+		}
+	}
+
+	zsock_close(conn);
+}
+
+static void tcp_bulk_server(void *p1, void *p2, void *p3)
+{
+	static uint8_t buf[CHUNK_LEN];
+	size_t total = 0;
+	int sock;
+	int conn;
+
+	sock = bind_socket(SOCK_STREAM, IPPROTO_TCP, BULK_PORT);
+	k_sem_give(&server_ready);
+	if (sock < 0) {
+		return;
+	}
+
+	conn = zsock_accept(sock, NULL, NULL);
+	if (conn < 0) {
+		return;
+	}
+
+	while (total < BULK_SIZE) {
+		ssize_t len = zsock_recv(conn, buf, sizeof(buf), 0);
+
+		if (len <= 0) {
+			break;
+		}
+
+		total += len;
+	}
+
+	k_sem_give(&bulk_done);
+	zsock_close(conn);
+}
+
+K_THREAD_DEFINE(udp_echo_tid, SERVER_STACK_SIZE, udp_echo_server, NULL, NULL, NULL,
+		SERVER_PRIORITY, 0, 0);
+K_THREAD_DEFINE(tcp_echo_tid, SERVER_STACK_SIZE, tcp_echo_server, NULL, NULL, NULL,
+		SERVER_PRIORITY, 0, 0);
+K_THREAD_DEFINE(tcp_bulk_tid, SERVER_STACK_SIZE, tcp_bulk_server, NULL, NULL, NULL,
+		SERVER_PRIORITY, 0, 0);
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Report the latency percentiles, the transaction rate and the allocations */
+static void report_rtt(const char *proto, uint64_t total_cycles, uint32_t allocs)
+{
+	static const struct {
+		const char *name;
+		uint32_t permille;
+	} percentiles[] = {
+		{ "min", 0 }, { "p50", 500 }, { "p90", 900 }, { "p99", 990 }, { "max", 1000 },
+	};
+	uint64_t total_ns = timing_cycles_to_ns(total_cycles);
+	char metric[50];
+	char what[40];
+
+	qsort(samples, SAMPLES, sizeof(samples[0]), compare_samples);
+
+	for (size_t i = 0; i < ARRAY_SIZE(percentiles); i++) {
+		size_t idx = MIN((SAMPLES * percentiles[i].permille) / 1000U, SAMPLES - 1);
+
+		snprintk(metric, sizeof(metric), "net.%s.rtt.%s", proto, percentiles[i].name);
+		snprintk(what, sizeof(what), "%u bytes round trip", MSG_LEN);
+		report(metric, what, samples[idx]);
+	}
+
+	snprintk(metric, sizeof(metric), "net.%s.transaction", proto);
+	snprintk(what, sizeof(what), "%u trans/s, %u.%02u allocs/pkt",
+		 (total_ns != 0U) ? (uint32_t)((uint64_t)SAMPLES * NSEC_PER_SEC / total_ns) : 0U,
+		 allocs / (2U * SAMPLES), ((allocs * 100U) / (2U * SAMPLES)) % 100U);
+	report(metric, what, total_cycles / SAMPLES);
+}
+
+static int measure_rtt(const char *proto, int sock)
+{
+	uint8_t rx_buf[MSG_LEN];
+	timing_t start;
+	timing_t finish;
+	uint64_t total = 0U;
+	uint32_t allocs;
+	int ret;
+
+	/* Warm up the connection before measuring */
+	ret = send_all(sock, tx_buf, MSG_LEN);
+	if (ret == 0) {
+		ret = recv_all(sock, rx_buf, MSG_LEN);
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	allocs = pkt_alloc_count();
+
+	for (int i = 0; i < SAMPLES; i++) {
+		start = timing_counter_get();
+
+		ret = send_all(sock, tx_buf, MSG_LEN);
+		if (ret == 0) {
+			ret = recv_all(sock, rx_buf, MSG_LEN);
+		}
+
+		finish = timing_counter_get();
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		samples[i] = timing_cycles_get(&start, &finish);
+		total += samples[i];
+	}
+
+	report_rtt(proto, total, pkt_alloc_count() - allocs);
+
+	return 0;
+}
+
+static int connect_socket(int type, int proto, uint16_t port)
+{
+	struct sockaddr_in addr;
+	int sock;
+
+	sock = zsock_socket(AF_INET, type, proto);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	fill_addr(&addr, port);
+	if (zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		zsock_close(sock);
+		return -errno;
+	}
+
+	return sock;
+}
+
+static int measure_udp(void)
+{
+	int sock;
+	int ret;
+
+	sock = connect_socket(SOCK_DGRAM, IPPROTO_UDP, UDP_PORT);
+	if (sock < 0) {
+		return sock;
+	}
+
+	ret = measure_rtt("udp", sock);
+	zsock_close(sock);
+
+	return ret;
+}
+
+static int measure_tcp(void)
+{
+	int sock;
+	int ret;
+
+	sock = connect_socket(SOCK_STREAM, IPPROTO_TCP, TCP_PORT);
+	if (sock < 0) {
+		return sock;
+	}
+
+	ret = measure_rtt("tcp", sock);
+	zsock_close(sock);
+
+	return ret;
+}
+
+static int measure_tcp_bulk(void)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+	uint64_t ns;
+	uint32_t allocs;
+	char what[40];
+	int sock;
+	int ret = 0;
+
+	sock = connect_socket(SOCK_STREAM, IPPROTO_TCP, BULK_PORT);
+	if (sock < 0) {
+		return sock;
+	}
+
+	allocs = pkt_alloc_count();
+	start = timing_counter_get();
+
+	for (size_t sent = 0; sent < BULK_SIZE && ret == 0; sent += CHUNK_LEN) {
+		ret = send_all(sock, tx_buf, MIN(CHUNK_LEN, BULK_SIZE - sent));
+	}
+
+	if (ret == 0 && k_sem_take(&bulk_done, K_SECONDS(10)) != 0) {
+		ret = -ETIMEDOUT;
+	}
+
+	finish = timing_counter_get();
+	allocs = pkt_alloc_count() - allocs;
+	zsock_close(sock);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	cycles = timing_cycles_get(&start, &finish);
+	ns = timing_cycles_to_ns(cycles);
+
+	snprintk(what, sizeof(what), "%u KiB/s, %u allocs/KiB",
+		 (ns != 0U) ? (uint32_t)((uint64_t)BULK_SIZE * NSEC_PER_SEC / ns / 1024U) : 0U,
+		 allocs / (BULK_SIZE / 1024U));
+	report("net.tcp.bulk", what, cycles / (BULK_SIZE / CHUNK_LEN));
+
+	return 0;
+}
+
+int main(void)
+{
+	int ret;
+
+	for (int i = 0; i < 3; i++) {
+		k_sem_take(&server_ready, K_FOREVER);
+	}
+
+	memset(tx_buf, 'z', sizeof(tx_buf));
+
+	timing_init();
+	timing_start();
+
+	printk("Network socket measurements over loopback, %u samples, clock frequency: %u MHz\n",
+	       SAMPLES, timing_freq_get_mhz());
+
+	ret = measure_udp();
+	if (ret == 0) {
+		ret = measure_tcp();
+	}
+
+	if (ret == 0) {
+		ret = measure_tcp_bulk();
+	}
+
+	timing_stop();
+
+	if (ret < 0) {
+		printk("Measurement failed (%d)\n", ret);
+	}
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
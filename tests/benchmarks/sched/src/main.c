@@ -98,6 +98,8 @@ static void partner_fn(void *arg1, void *arg2, void *arg3)
 }
 
 #if (CONFIG_MP_MAX_NUM_CPUS > 1)
+void spinlock_bench(void);
+
 static void busy_thread_entry(void *arg1, void *arg2, void *arg3)
 {
 	while (true) {
@@ -108,6 +110,9 @@ static void busy_thread_entry(void *arg1, void *arg2, void *arg3)
 int main(void)
 {
 #if (CONFIG_MP_MAX_NUM_CPUS > 1)
+	/* Measure spinlock contention while the other cores are free */
+	spinlock_bench();
+
 	/* Spawn busy threads that will execute on the other cores */
 	for (uint32_t i = 0; i < CONFIG_MP_MAX_NUM_CPUS - 1; i++) {
 		k_thread_create(&busy_thread[i], busy_thread_stack[i],
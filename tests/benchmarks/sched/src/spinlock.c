@@ -0,0 +1,100 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Spinlock contention microbenchmark: one thread per CPU takes and
+ * releases the same spinlock in a tight loop, until the main thread
+ * has taken it a given number of times. It reports the average cost
+ * of an acquisition under contention, and the spread of the number
+ * of acquisitions between CPUs, which shows the fairness of the
+ * spinlock implementation (see CONFIG_TICKET_SPINLOCKS and
+ * CONFIG_MCS_SPINLOCKS).
+ */
+
+#if (CONFIG_MP_MAX_NUM_CPUS > 1)
+
+#define N_LOCKS 10000
+#define CONTENDERS (CONFIG_MP_MAX_NUM_CPUS - 1)
+#define CONTENDER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(contender_stack, CONTENDERS, CONTENDER_STACK_SIZE);
+static struct k_thread contender_thread[CONTENDERS];
+
+static struct k_spinlock bench_lock;
+static atomic_t ready;
+static atomic_t stop;
+static volatile uint32_t shared_count;
+static uint32_t acquisitions[CONFIG_MP_MAX_NUM_CPUS];
+
+static void lock_once(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&bench_lock);
+
+	shared_count++;
+	k_spin_unlock(&bench_lock, key);
+}
+
+static void contender_fn(void *arg1, void *arg2, void *arg3)
+{
+	uint32_t *count = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	atomic_inc(&ready);
+	while (atomic_get(&ready) <= CONTENDERS) {
+		arch_spin_relax();
+	}
+
+	while (atomic_get(&stop) == 0) {
+		lock_once();
+		(*count)++;
+	}
+}
+
+void spinlock_bench(void)
+{
+	uint32_t start, cycles;
+	uint32_t min = UINT32_MAX, max = 0U, total = 0U;
+
+	for (int i = 0; i < CONTENDERS; i++) {
+		k_thread_create(&contender_thread[i], contender_stack[i],
+				CONTENDER_STACK_SIZE, contender_fn,
+				&acquisitions[i + 1], NULL, NULL,
+				K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+	}
+
+	while (atomic_get(&ready) < CONTENDERS) {
+		arch_spin_relax();
+	}
+
+	start = k_cycle_get_32();
+	atomic_inc(&ready);
+
+	for (int i = 0; i < N_LOCKS; i++) {
+		lock_once();
+	}
+
+	atomic_set(&stop, 1);
+	cycles = k_cycle_get_32() - start;
+	acquisitions[0] = N_LOCKS;
+
+	for (int i = 0; i < CONTENDERS; i++) {
+		k_thread_join(&contender_thread[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		min = MIN(min, acquisitions[i]);
+		max = MAX(max, acquisitions[i]);
+		total += acquisitions[i];
+	}
+
+	printk("spinlock %d cpus: %u locks, %u cycles/lock, per cpu min %u max %u\n",
+	       CONFIG_MP_MAX_NUM_CPUS, total, cycles / total, min, max);
+}
+#endif /* (CONFIG_MP_MAX_NUM_CPUS > 1) */
@@ -242,6 +242,8 @@ int main(void)
 	       IS_ENABLED(CONFIG_SCHED_SIMPLE) ? "simple" :
 	       IS_ENABLED(CONFIG_SCHED_SCALABLE) ? "scalable" : "multiq");
 	printk("Timing results: Clock frequency: %u MHz\n", freq);
+	printk("%u threads over %u preemptible priorities\n",
+	       CONFIG_BENCHMARK_NUM_THREADS, CONFIG_NUM_PREEMPT_PRIORITIES);
 
 	start_threads(CONFIG_BENCHMARK_NUM_THREADS);
 
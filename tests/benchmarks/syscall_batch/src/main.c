@@ -0,0 +1,96 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/syscall_batch.h>
+
+#define NB_CALLS (CONFIG_SYSCALL_BATCH_MAX * 256)
+#define STACK_SIZE 4096
+
+K_THREAD_STACK_DEFINE(user_stack, STACK_SIZE);
+static struct k_thread user_thread;
+K_SEM_DEFINE(bench_sem, 0, 1);
+/* Given by the user thread on failure */
+K_SEM_DEFINE(error_sem, 0, 1);
+
+enum bench_mode {
+	BENCH_EMPTY,
+	BENCH_DIRECT,
+	BENCH_BATCHED,
+};
+
+static void user_entry(void *p1, void *p2, void *p3)
+{
+	enum bench_mode mode = (enum bench_mode)(uintptr_t)p1;
+	struct k_syscall_batch_rec recs[CONFIG_SYSCALL_BATCH_MAX];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	switch (mode) {
+	case BENCH_DIRECT:
+		for (int i = 0; i < NB_CALLS; i++) {
+			k_sem_give(&bench_sem);
+		}
+		break;
+	case BENCH_BATCHED:
+		for (size_t i = 0; i < ARRAY_SIZE(recs); i++) {
+			recs[i] = (struct k_syscall_batch_rec){
+				.id = K_SYSCALL_K_SEM_GIVE,
+				.args = {(uintptr_t)&bench_sem},
+			};
+		}
+		for (size_t i = 0; i < NB_CALLS / ARRAY_SIZE(recs); i++) {
+			if (k_syscall_batch(recs, ARRAY_SIZE(recs)) != 0) {
+				k_sem_give(&error_sem);
+				return;
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static uint32_t run(enum bench_mode mode)
+{
+	uint32_t start, end;
+
+	start = k_cycle_get_32();
+	k_thread_create(&user_thread, user_stack, STACK_SIZE, user_entry,
+			(void *)(uintptr_t)mode, NULL, NULL,
+			k_thread_priority_get(k_current_get()), K_USER | K_INHERIT_PERMS,
+			K_NO_WAIT);
+	k_thread_join(&user_thread, K_FOREVER);
+	end = k_cycle_get_32();
+
+	return end - start;
+}
+
+int main(void)
+{
+	uint32_t empty, direct, batched;
+
+	k_object_access_grant(&bench_sem, k_current_get());
+	k_object_access_grant(&error_sem, k_current_get());
+
+	empty = run(BENCH_EMPTY);
+	direct = run(BENCH_DIRECT) - empty;
+	batched = run(BENCH_BATCHED) - empty;
+
+	if (k_sem_count_get(&error_sem) != 0) {
+		printk("k_syscall_batch() failed\n");
+		return 0;
+	}
+
+	printk("direct system call: %u cycles\n", direct / NB_CALLS);
+	printk("batched system call (batches of %u): %u cycles\n",
+	       CONFIG_SYSCALL_BATCH_MAX, batched / NB_CALLS);
+	printk("SUCCESS\n");
+
+	return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the cost of publishing to, and reading from, a channel protected
+ * by its semaphore and a single writer channel protected by a sequence lock.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/zbus/zbus.h>
+
+#define ITERATIONS 1000
+
+struct imu_msg {
+	int32_t accel[3];
+	int32_t gyro[3];
+	uint64_t timestamp;
+};
+
+/* Keeps the compiler from dropping the notifications */
+static volatile uint32_t sink;
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	const struct imu_msg *msg = zbus_chan_const_msg(chan);
+
+	sink = msg->accel[0];
+}
+
+ZBUS_LISTENER_DEFINE(lis, listener_cb);
+
+ZBUS_CHAN_DEFINE(locked_chan, struct imu_msg, NULL, NULL, ZBUS_OBSERVERS(lis),
+		 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE_SEQLOCK(seqlock_chan, struct imu_msg, NULL, NULL, ZBUS_OBSERVERS(lis),
+			 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(locked_empty_chan, struct imu_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE_SEQLOCK(seqlock_empty_chan, struct imu_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+			 ZBUS_MSG_INIT(0));
+
+static void report(const char *metric, const char *what, uint64_t cycles)
+{
+	uint32_t ns = (uint32_t)timing_cycles_to_ns(cycles);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-50s - %-40s: %7u cycles , %7u ns :\n", metric, what, (uint32_t)cycles, ns);
+#else
+	printk("%-50s - %-40s: %7u cycles (%7u nsec)\n", metric, what, (uint32_t)cycles, ns);
+#endif
+}
+
+static void measure(const struct zbus_channel *chan, const char *name)
+{
+	struct imu_msg msg = {0};
+	timing_t start;
+	timing_t finish;
+	char metric[50];
+	char what[40];
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		msg.timestamp = i;
+		(void)zbus_chan_pub(chan, &msg, K_NO_WAIT);
+	}
+	finish = timing_counter_get();
+
+	snprintk(metric, sizeof(metric), "zbus.%s.pub", name);
+	snprintk(what, sizeof(what), "publish %zu bytes", sizeof(msg));
+	report(metric, what, timing_cycles_get(&start, &finish) / ITERATIONS);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		(void)zbus_chan_read(chan, &msg, K_NO_WAIT);
+	}
+	finish = timing_counter_get();
+
+	snprintk(metric, sizeof(metric), "zbus.%s.read", name);
+	snprintk(what, sizeof(what), "read %zu bytes", sizeof(msg));
+	report(metric, what, timing_cycles_get(&start, &finish) / ITERATIONS);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("Zbus measurements, %u iterations, clock frequency: %u MHz\n", ITERATIONS,
+	       timing_freq_get_mhz());
+
+	measure(&locked_empty_chan, "locked.no_observer");
+	measure(&seqlock_empty_chan, "seqlock.no_observer");
+	measure(&locked_chan, "locked.listener");
+	measure(&seqlock_chan, "seqlock.listener");
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
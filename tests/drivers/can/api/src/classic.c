@@ -752,7 +752,36 @@ static void add_remove_max_filters(bool ide)
 
 	filter.id++;
 	filter_id = can_add_rx_filter_msgq(can_dev, &can_msgq, &filter);
+#ifdef CONFIG_CAN_SW_FILTER
+	if (max < CONFIG_CAN_SW_FILTER_MAX) {
+		struct can_frame frame = {
+			.flags = (ide ? CAN_FRAME_IDE : 0),
+			.id = filter.id,
+		};
+		struct can_frame rx_frame;
+		int err;
+
+		/* The filters that do not fit in hardware are matched in software */
+		zassert_true(filter_id >= 0, "failed to add filter in software (err %d)",
+			     filter_id);
+
+		send_test_frame(can_dev, &frame);
+		err = k_msgq_get(&can_msgq, &rx_frame, TEST_RECEIVE_TIMEOUT);
+		zassert_equal(err, 0, "receive timeout");
+		zassert_equal(rx_frame.id, frame.id, "received wrong frame");
+
+		/* The first filter was moved to software */
+		frame.id = 1;
+		send_test_frame(can_dev, &frame);
+		err = k_msgq_get(&can_msgq, &rx_frame, TEST_RECEIVE_TIMEOUT);
+		zassert_equal(err, 0, "receive timeout");
+		zassert_equal(rx_frame.id, frame.id, "received wrong frame");
+
+		can_remove_rx_filter(can_dev, filter_id);
+	}
+#else
 	zassert_equal(filter_id, -ENOSPC, "added more than max filters");
+#endif /* CONFIG_CAN_SW_FILTER */
 
 	for (i = 0; i < max; i++) {
 		can_remove_rx_filter(can_dev, filter_ids[i]);
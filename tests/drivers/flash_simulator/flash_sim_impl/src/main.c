@@ -556,6 +556,66 @@ ZTEST(flash_sim_api, test_flash_flatten)
 #endif
 }
 
+#if defined(CONFIG_FLASH_ASYNC)
+static K_SEM_DEFINE(async_done, 0, 3);
+static int async_results[3];
+static int async_count;
+
+static void async_cb(const struct device *dev, int result, void *user_data)
+{
+	zassert_equal(dev, flash_dev);
+	zassert_equal((uintptr_t)user_data, async_count, "Operations completed out of order");
+
+	async_results[async_count++] = result;
+	k_sem_give(&async_done);
+}
+
+ZTEST(flash_sim_api, test_async)
+{
+	struct flash_async_op ops[3];
+	uint8_t data[FLASH_SIMULATOR_PROG_UNIT * 4];
+	uint8_t read[sizeof(data)];
+	int rc;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+	memset(read, 0, sizeof(read));
+	async_count = 0;
+
+	/* Queue all operations at once, they must be executed in order */
+	rc = flash_erase_async(flash_dev, FLASH_SIMULATOR_BASE_OFFSET,
+			       FLASH_SIMULATOR_ERASE_UNIT, &ops[0], async_cb, (void *)0);
+	zassert_equal(0, rc, "flash_erase_async should succeed");
+
+	rc = flash_write_async(flash_dev, FLASH_SIMULATOR_BASE_OFFSET, data, sizeof(data),
+			       &ops[1], async_cb, (void *)1);
+	zassert_equal(0, rc, "flash_write_async should succeed");
+
+	rc = flash_read_async(flash_dev, FLASH_SIMULATOR_BASE_OFFSET, read, sizeof(read),
+			      &ops[2], async_cb, (void *)2);
+	zassert_equal(0, rc, "flash_read_async should succeed");
+
+	for (int i = 0; i < ARRAY_SIZE(ops); i++) {
+		zassert_equal(0, k_sem_take(&async_done, K_SECONDS(1)),
+			      "Operation %d not completed", i);
+		zassert_equal(0, async_results[i], "Operation %d failed (%d)", i,
+			      async_results[i]);
+	}
+
+	zassert_mem_equal(data, read, sizeof(data), "Read data does not match");
+
+	/* Errors are reported to the callback */
+	async_count = 0;
+	rc = flash_read_async(flash_dev, TEST_SIM_FLASH_END, read, sizeof(read),
+			      &ops[0], async_cb, (void *)0);
+	zassert_equal(0, rc, "flash_read_async should succeed");
+	zassert_equal(0, k_sem_take(&async_done, K_SECONDS(1)), "Operation not completed");
+	zassert_equal(-EINVAL, async_results[0], "Unexpected error code (%d)",
+		      async_results[0]);
+}
+#endif /* CONFIG_FLASH_ASYNC */
+
 #include <zephyr/drivers/flash/flash_simulator.h>
 
 ZTEST(flash_sim_api, test_get_mock)
@@ -9,9 +9,12 @@
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/gpio/gpio_emul.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/dt-bindings/sensor/icm42688.h>
 #include <zephyr/fff.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/ztest.h>
 
+#include "icm42688_decoder.h"
 #include "icm42688_emul.h"
 #include "icm42688_reg.h"
 
@@ -218,6 +221,80 @@ ZTEST_F(icm42688, test_fetch_gyro)
 	test_fetch_gyro_with_range(fixture, 15625, gyro_percent);
 }
 
+#define FIFO_TEST_PACKETS 3
+
+static const int16_t fifo_test_accel[FIFO_TEST_PACKETS][3] = {
+	{1000, -1000, INT16_MAX},
+	{INT16_MIN, 0, 1},
+	{-1, 2, -3},
+};
+
+static const int16_t fifo_test_gyro[FIFO_TEST_PACKETS][3] = {
+	{-2000, 2000, INT16_MIN},
+	{INT16_MAX, -1, 0},
+	{3, -2, 1},
+};
+
+static void test_fifo_decode_chan(const struct icm42688_fixture *fixture, const uint8_t *buffer,
+				  enum sensor_channel chan, int8_t shift, int32_t scale,
+				  const int16_t samples[FIFO_TEST_PACKETS][3])
+{
+	static uint8_t out_buf[256] __aligned(8);
+	const struct sensor_chan_spec chan_spec = {.chan_type = chan, .chan_idx = 0};
+	struct sensor_three_axis_data *out = (struct sensor_three_axis_data *)out_buf;
+	const struct sensor_decoder_api *decoder;
+	size_t base_size, frame_size;
+	uint32_t fit = 0;
+
+	zassert_ok(sensor_get_decoder(fixture->dev, &decoder));
+	zassert_ok(decoder->get_size_info(chan_spec, &base_size, &frame_size));
+	zassert_true(base_size + (FIFO_TEST_PACKETS - 1) * frame_size <= sizeof(out_buf));
+
+	zassert_equal(FIFO_TEST_PACKETS,
+		      decoder->decode(buffer, chan_spec, &fit, FIFO_TEST_PACKETS, out));
+	zassert_equal(shift, out->shift);
+
+	for (int i = 0; i < FIFO_TEST_PACKETS; i++) {
+		/* 1 kHz ODR */
+		zassert_equal(i * 1000000, out->readings[i].timestamp_delta);
+		for (int axis = 0; axis < 3; axis++) {
+			zassert_equal(samples[i][axis] * scale, out->readings[i].values[axis],
+				      "packet %d, axis %d", i, axis);
+		}
+	}
+
+	zassert_equal(0, decoder->decode(buffer, chan_spec, &fit, 1, out));
+}
+
+ZTEST_F(icm42688, test_fifo_decode_packets16)
+{
+	static uint8_t buffer[sizeof(struct icm42688_fifo_data) + FIFO_TEST_PACKETS * 16];
+	struct icm42688_fifo_data *edata = (struct icm42688_fifo_data *)buffer;
+
+	memset(buffer, 0, sizeof(buffer));
+	edata->header.is_fifo = 1;
+	edata->header.accel_fs = ICM42688_DT_ACCEL_FS_16;
+	edata->header.gyro_fs = ICM42688_DT_GYRO_FS_2000;
+	edata->accel_odr = ICM42688_DT_ACCEL_ODR_1000;
+	edata->gyro_odr = ICM42688_DT_GYRO_ODR_1000;
+	edata->fifo_count = FIFO_TEST_PACKETS * 16;
+	edata->rtc_freq = 32000;
+
+	for (int i = 0; i < FIFO_TEST_PACKETS; i++) {
+		uint8_t *pkt = &buffer[sizeof(struct icm42688_fifo_data) + i * 16];
+
+		pkt[0] = FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO;
+		for (int axis = 0; axis < 3; axis++) {
+			sys_put_be16(fifo_test_accel[i][axis], &pkt[1 + axis * 2]);
+			sys_put_be16(fifo_test_gyro[i][axis], &pkt[7 + axis * 2]);
+		}
+	}
+
+	/* Values of an LSB at the 16 g and 2000 dps full scales */
+	test_fifo_decode_chan(fixture, buffer, SENSOR_CHAN_ACCEL_XYZ, 8, 40168, fifo_test_accel);
+	test_fifo_decode_chan(fixture, buffer, SENSOR_CHAN_GYRO_XYZ, 6, 35744, fifo_test_gyro);
+}
+
 FAKE_VOID_FUNC(test_interrupt_trigger_handler, const struct device*, const struct sensor_trigger*);
 
 ZTEST_F(icm42688, test_interrupt)
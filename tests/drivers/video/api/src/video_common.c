@@ -5,7 +5,9 @@
  */
 
 #include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/drivers/video.h>
+#include <zephyr/drivers/video/convert.h>
 
 enum {
 	RGB565,
@@ -143,4 +145,64 @@ ZTEST(video_common, test_video_closest_frmival_stepwise)
 	zassert_equal(video_frmival_nsec(&match), video_frmival_nsec(&stepwise.max), "100 / 1");
 }
 
+ZTEST(video_common, test_video_convert)
+{
+	/* White and black, red and red in BT.601 limited range */
+	static const uint8_t yuyv[] = {235, 128, 16, 128, 81, 90, 81, 240};
+	static const uint8_t rgb24_expected[] = {
+		0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+	};
+	struct video_format yuyv_fmt = {
+		.pixelformat = VIDEO_PIX_FMT_YUYV, .width = 4, .height = 1, .pitch = 8,
+	};
+	struct video_format rgb24_fmt = {
+		.pixelformat = VIDEO_PIX_FMT_RGB24, .width = 4, .height = 1, .pitch = 12,
+	};
+	struct video_format rgb565_fmt = {
+		.pixelformat = VIDEO_PIX_FMT_RGB565, .width = 4, .height = 1, .pitch = 8,
+	};
+	uint8_t rgb24[12];
+	uint8_t rgb565[8];
+
+	zassert_ok(video_convert(&yuyv_fmt, yuyv, &rgb24_fmt, rgb24));
+	zassert_mem_equal(rgb24, rgb24_expected, sizeof(rgb24));
+
+	zassert_ok(video_convert(&rgb24_fmt, rgb24, &rgb565_fmt, rgb565));
+	zassert_equal(sys_get_le16(&rgb565[0]), 0xffff);
+	zassert_equal(sys_get_le16(&rgb565[2]), 0x0000);
+	zassert_equal(sys_get_le16(&rgb565[4]), 0xf800);
+
+	memset(rgb24, 0, sizeof(rgb24));
+	zassert_ok(video_convert(&rgb565_fmt, rgb565, &rgb24_fmt, rgb24));
+	zassert_mem_equal(rgb24, rgb24_expected, sizeof(rgb24));
+
+	/* Different sizes are only supported without format conversion */
+	rgb565_fmt.width = 2;
+	zassert_equal(video_convert(&rgb24_fmt, rgb24, &rgb565_fmt, rgb565), -ENOTSUP);
+
+	/* Pitch too small for the width */
+	rgb24_fmt.pitch = 6;
+	zassert_equal(video_convert(&yuyv_fmt, yuyv, &rgb24_fmt, rgb24), -EINVAL);
+}
+
+ZTEST(video_common, test_video_convert_scale)
+{
+	uint8_t in[4 * 4 * 3];
+	uint8_t out[2 * 2 * 3];
+	static const uint8_t expected[] = {0, 1, 2, 6, 7, 8, 24, 25, 26, 30, 31, 32};
+	struct video_format in_fmt = {
+		.pixelformat = VIDEO_PIX_FMT_RGB24, .width = 4, .height = 4, .pitch = 12,
+	};
+	struct video_format out_fmt = {
+		.pixelformat = VIDEO_PIX_FMT_RGB24, .width = 2, .height = 2, .pitch = 6,
+	};
+
+	for (int i = 0; i < sizeof(in); i++) {
+		in[i] = i;
+	}
+
+	zassert_ok(video_convert(&in_fmt, in, &out_fmt, out));
+	zassert_mem_equal(out, expected, sizeof(out));
+}
+
 ZTEST_SUITE(video_common, NULL, NULL, NULL, NULL, NULL);
@@ -196,4 +196,44 @@ ZTEST(video_common, test_video_vbuf)
 	video_buffer_release(vbuf);
 }
 
+static void test_release_cb(struct video_buffer *vbuf, void *user_data)
+{
+	struct video_buffer **released = user_data;
+
+	*released = vbuf;
+}
+
+ZTEST(video_common, test_video_vbuf_ref)
+{
+	struct video_buffer *released = NULL;
+	struct video_buffer *vbuf;
+
+	vbuf = video_buffer_alloc(64, K_NO_WAIT);
+	zassert_not_null(vbuf);
+
+	/* A second user keeps the buffer allocated */
+	zexpect_equal(video_buffer_ref(vbuf), vbuf);
+	video_buffer_release(vbuf);
+	zexpect_not_null(vbuf->buffer);
+	zexpect_is_null(video_buffer_alloc(64, K_NO_WAIT), "pool holds a single buffer");
+
+	/* The last release hands the buffer back to its owner */
+	video_buffer_set_release_cb(vbuf, test_release_cb, &released);
+	video_buffer_ref(vbuf);
+	video_buffer_release(vbuf);
+	zexpect_is_null(released);
+	video_buffer_release(vbuf);
+	zexpect_equal(released, vbuf);
+	zexpect_not_null(vbuf->buffer);
+
+	/* Without a callback, the last release frees the buffer */
+	video_buffer_set_release_cb(vbuf, NULL, NULL);
+	video_buffer_release(vbuf);
+	zexpect_is_null(vbuf->buffer);
+
+	vbuf = video_buffer_alloc(64, K_NO_WAIT);
+	zexpect_not_null(vbuf);
+	video_buffer_release(vbuf);
+}
+
 ZTEST_SUITE(video_emul, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,114 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define DT_DRV_COMPAT vnd_parallel_init_device
+
+struct init_record {
+	int64_t start;
+	int64_t end;
+};
+
+struct slow_init_config {
+	uint32_t delay_ms;
+};
+
+static int slow_init(const struct device *dev)
+{
+	const struct slow_init_config *config = dev->config;
+	struct init_record *record = dev->data;
+
+	record->start = k_uptime_get();
+	k_msleep(config->delay_ms);
+	record->end = k_uptime_get();
+
+	return 0;
+}
+
+#define SLOW_INIT_DEFINE(inst)                                                                     \
+	static const struct slow_init_config slow_init_config_##inst = {                          \
+		.delay_ms = DT_INST_PROP(inst, delay_ms),                                          \
+	};                                                                                         \
+	static struct init_record slow_init_record_##inst;                                        \
+	DEVICE_DT_INST_DEFINE(inst, slow_init, NULL, &slow_init_record_##inst,                     \
+			      &slow_init_config_##inst, POST_KERNEL,                               \
+			      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(SLOW_INIT_DEFINE)
+
+#define RECORD(label) ((const struct init_record *)DEVICE_DT_GET(DT_NODELABEL(label))->data)
+
+/** @brief Check that all the devices are initialized once the kernel level is done */
+ZTEST(device_init_parallel, test_all_initialized)
+{
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(slow_a))));
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(child_a))));
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(slow_b))));
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(fast))));
+}
+
+/** @brief Check that a device is only initialized after its dependencies */
+ZTEST(device_init_parallel, test_dependency_order)
+{
+	zassert_true(RECORD(child_a)->start >= RECORD(slow_a)->end,
+		     "child started at %lld before its parent ended at %lld",
+		     RECORD(child_a)->start, RECORD(slow_a)->end);
+}
+
+/** @brief Check that independent devices are initialized in parallel */
+ZTEST(device_init_parallel, test_overlap)
+{
+	/* slow_a and child_a keep two workers busy */
+	if (CONFIG_DEVICE_INIT_PARALLEL_THREADS < 3) {
+		ztest_test_skip();
+	}
+
+	zassert_true(RECORD(slow_b)->start < RECORD(slow_a)->end,
+		     "slow devices were initialized one after the other");
+	zassert_true(RECORD(fast)->end < RECORD(slow_a)->end,
+		     "sequential device waited for an unrelated parallel device");
+}
+
+struct stat_check {
+	uint32_t last_cycles;
+	uint32_t slow_a_cycles;
+	bool sorted;
+};
+
+static void stat_check_cb(const struct init_time_stat *stat, void *user_data)
+{
+	struct stat_check *check = user_data;
+
+	if (stat->cycles > check->last_cycles) {
+		check->sorted = false;
+	}
+
+	check->last_cycles = stat->cycles;
+
+	if (stat->entry->dev == DEVICE_DT_GET(DT_NODELABEL(slow_a))) {
+		check->slow_a_cycles = stat->cycles;
+	}
+}
+
+/** @brief Check the init time statistics of the parallel devices */
+ZTEST(device_init_parallel, test_init_time_stats)
+{
+	struct stat_check check = {
+		.last_cycles = UINT32_MAX,
+		.sorted = true,
+	};
+
+	sys_init_time_stats_foreach(stat_check_cb, &check);
+
+	zassert_true(check.sorted, "statistics are not sorted");
+	zassert_true(k_cyc_to_ms_floor32(check.slow_a_cycles) >= 200,
+		     "slow_a took %u ms", k_cyc_to_ms_floor32(check.slow_a_cycles));
+}
+
+ZTEST_SUITE(device_init_parallel, NULL, NULL, NULL, NULL, NULL);
@@ -71,9 +71,13 @@ ZTEST(events_api, test_k_event_init)
 	 */
 
 
-	thread = z_waitq_head(&event.wait_q);
+	for (unsigned int i = 0; i < ARRAY_SIZE(event.wait_q); i++) {
+		thread = z_waitq_head(&event.wait_q[i]);
+
+		zassert_is_null(thread, NULL);
+		zassert_true(event.wait_events[i] == 0);
+	}
 
-	zassert_is_null(thread, NULL);
 	zassert_true(event.events == 0);
 }
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include "test_kheap.h"
+
+#ifdef CONFIG_HEAP_MAGAZINE
+
+#define SMALL_SIZE  CONFIG_HEAP_MAGAZINE_MIN_SIZE
+#define LARGE_SIZE  1536
+#define MAX_BLOCKS  (HEAP_SIZE / SMALL_SIZE)
+
+K_HEAP_DEFINE(mag_heap, HEAP_SIZE);
+
+static void *blocks[MAX_BLOCKS];
+
+static void magazine_stats(struct k_heap_magazine_stats *stats)
+{
+	zassert_equal(k_heap_magazine_stats_get(&mag_heap, 0, stats), 0);
+	zassert_equal(stats->block_size, SMALL_SIZE);
+}
+
+/**
+ * @brief Verify that a freed small block is handed out again by the magazine
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @see k_heap_alloc(), k_heap_free(), k_heap_magazine_stats_get()
+ */
+ZTEST(k_heap_magazine, test_k_heap_magazine_reuse)
+{
+	struct k_heap_magazine_stats before, after;
+	void *p, *q;
+
+	zassert_equal(k_heap_magazine_stats_get(&mag_heap, CONFIG_HEAP_MAGAZINE_CLASSES,
+						&before), -EINVAL);
+
+	p = k_heap_alloc(&mag_heap, SMALL_SIZE - 1, K_NO_WAIT);
+	zassert_not_null(p, "k_heap_alloc operation failed");
+	k_heap_free(&mag_heap, p);
+
+	magazine_stats(&before);
+	zassert_true(before.cached_bytes >= SMALL_SIZE, "block not cached");
+
+	q = k_heap_alloc(&mag_heap, SMALL_SIZE, K_NO_WAIT);
+	zassert_equal(q, p, "cached block not reused");
+
+	magazine_stats(&after);
+	zassert_equal(after.hits, before.hits + 1);
+	zassert_equal(after.cached_bytes, before.cached_bytes - SMALL_SIZE);
+
+	k_heap_free(&mag_heap, q);
+}
+
+/**
+ * @brief Verify that memory cached by the magazines is given back to the
+ * heap when an allocation would fail otherwise
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @see k_heap_alloc(), k_heap_free(), k_heap_magazine_stats_get()
+ */
+ZTEST(k_heap_magazine, test_k_heap_magazine_reclaim)
+{
+	struct k_heap_magazine_stats stats;
+	int n;
+	void *p;
+
+	for (n = 0; n < MAX_BLOCKS; n++) {
+		blocks[n] = k_heap_alloc(&mag_heap, SMALL_SIZE, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > CONFIG_HEAP_MAGAZINE_DEPTH, "heap too small");
+
+	zassert_is_null(k_heap_alloc(&mag_heap, LARGE_SIZE, K_NO_WAIT));
+
+	while (n > 0) {
+		k_heap_free(&mag_heap, blocks[--n]);
+	}
+
+	/**TESTPOINT: full magazines flush batches back to the heap */
+	magazine_stats(&stats);
+	zassert_true(stats.flushes > 0U, "magazine never flushed");
+	zassert_true(stats.cached_bytes > 0U, "no block cached");
+
+	/**TESTPOINT: the cached blocks are reclaimed by a large allocation */
+	p = k_heap_alloc(&mag_heap, LARGE_SIZE, K_MSEC(10));
+	zassert_not_null(p, "cached memory not reclaimed");
+
+	magazine_stats(&stats);
+	zassert_equal(stats.cached_bytes, 0U);
+
+	k_heap_free(&mag_heap, p);
+}
+
+/* Single CPU so that consecutive calls use the same magazines */
+ZTEST_SUITE(k_heap_magazine, NULL, NULL, ztest_simple_1cpu_before,
+	    ztest_simple_1cpu_after, NULL);
+
+#endif /* CONFIG_HEAP_MAGAZINE */
@@ -0,0 +1,124 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define CLASS_16 0
+#define CLASS_32 1
+#define CLASS_64 2
+#define NUM_16   CONFIG_HEAP_MEM_SLAB_BLOCKS_16
+
+static struct k_malloc_slab_stats stats_get(unsigned int size_class)
+{
+	struct k_malloc_slab_stats stats;
+
+	zassert_equal(k_malloc_slab_stats_get(size_class, &stats), 0);
+
+	return stats;
+}
+
+/**
+ * @brief Verify that small requests go to the smallest fitting slab with
+ * blocks, and large ones to the heap
+ *
+ * @see k_malloc(), k_free(), k_malloc_slab_stats_get()
+ */
+ZTEST(k_malloc_slabs, test_slab_size_classes)
+{
+	struct k_malloc_slab_stats s16 = stats_get(CLASS_16);
+	struct k_malloc_slab_stats s64 = stats_get(CLASS_64);
+	struct k_malloc_slab_stats stats;
+	void *small, *medium, *large;
+
+	zassert_equal(k_malloc_slab_stats_get(5, &stats), -EINVAL);
+	zassert_equal(stats_get(CLASS_32).num_blocks, 0U);
+
+	small = k_malloc(10);
+	zassert_not_null(small);
+	zassert_true(IS_PTR_ALIGNED(small, void *), "misaligned block");
+	stats = stats_get(CLASS_16);
+	zassert_equal(stats.num_used, s16.num_used + 1);
+	zassert_equal(stats.allocs, s16.allocs + 1);
+	zassert_equal(stats.wasted_bytes, s16.wasted_bytes + 6);
+
+	/**TESTPOINT: the empty 32 byte class is skipped */
+	medium = k_malloc(20);
+	zassert_not_null(medium);
+	zassert_equal(stats_get(CLASS_64).num_used, s64.num_used + 1);
+
+	/**TESTPOINT: the heap serves what is larger than every class */
+	large = k_malloc(300);
+	zassert_not_null(large);
+
+	k_free(small);
+	k_free(medium);
+	k_free(large);
+	zassert_equal(stats_get(CLASS_16).num_used, s16.num_used);
+	zassert_equal(stats_get(CLASS_64).num_used, s64.num_used);
+}
+
+/**
+ * @brief Verify that the heap takes over when a slab is exhausted
+ *
+ * @see k_malloc(), k_free(), k_malloc_slab_stats_get()
+ */
+ZTEST(k_malloc_slabs, test_slab_fallback)
+{
+	struct k_malloc_slab_stats before = stats_get(CLASS_16);
+	void *blocks[NUM_16 + 1];
+
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		blocks[i] = k_malloc(16);
+		zassert_not_null(blocks[i], "allocation %d failed", i);
+	}
+
+	zassert_equal(stats_get(CLASS_16).num_used, NUM_16);
+	zassert_equal(stats_get(CLASS_16).fallbacks, before.fallbacks + 1);
+
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		k_free(blocks[i]);
+	}
+	zassert_equal(stats_get(CLASS_16).num_used, 0U);
+}
+
+/**
+ * @brief Verify resizing and zeroing slab blocks
+ *
+ * @see k_realloc(), k_calloc()
+ */
+ZTEST(k_malloc_slabs, test_slab_realloc_calloc)
+{
+	uint8_t *p, *q;
+
+	p = k_malloc(8);
+	zassert_not_null(p);
+	memset(p, 0xa5, 8);
+
+	/**TESTPOINT: the block is kept while the new size fits */
+	zassert_equal(k_realloc(p, 12), p);
+
+	/**TESTPOINT: the contents move to a larger block */
+	q = k_realloc(p, 200);
+	zassert_not_null(q);
+	zassert_not_equal(q, p);
+	for (int i = 0; i < 8; i++) {
+		zassert_equal(q[i], 0xa5);
+	}
+	zassert_equal(stats_get(CLASS_16).num_used, 0U);
+	k_free(q);
+
+	p = k_malloc(16);
+	memset(p, 0xff, 16);
+	k_free(p);
+	q = k_calloc(2, 8);
+	zassert_not_null(q);
+	for (int i = 0; i < 16; i++) {
+		zassert_equal(q[i], 0U);
+	}
+	k_free(q);
+}
+
+ZTEST_SUITE(k_malloc_slabs, NULL, NULL, NULL, NULL, NULL);
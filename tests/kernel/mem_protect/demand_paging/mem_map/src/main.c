@@ -234,7 +234,8 @@ ZTEST(demand_paging, test_unmap_anon_pages)
 
 static void test_k_mem_page_out(void)
 {
-	unsigned long faults;
+	struct k_mem_paging_stats_t stats;
+	unsigned long faults, prefetched;
 	int key, ret;
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
@@ -242,6 +243,8 @@ static void test_k_mem_page_out(void)
 	 */
 	key = irq_lock();
 	faults = k_mem_num_pagefaults_get();
+	k_mem_paging_stats_get(&stats);
+	prefetched = stats.prefetch.pages;
 	ret = k_mem_page_out(arena, HALF_BYTES);
 	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
 
@@ -250,11 +253,14 @@ static void test_k_mem_page_out(void)
 		arena[i] = nums[i % 10];
 	}
 	faults = k_mem_num_pagefaults_get() - faults;
+	k_mem_paging_stats_get(&stats);
+	prefetched = stats.prefetch.pages - prefetched;
 	irq_unlock(key);
 
-	zassert_equal(faults, HALF_PAGES,
-		      "unexpected num pagefaults expected %lu got %d",
-		      HALF_PAGES, faults);
+	/* Pages are either paged in by a page fault or prefetched */
+	zassert_equal(faults + prefetched, HALF_PAGES,
+		      "unexpected num pagefaults expected %lu got %lu (%lu prefetched)",
+		      HALF_PAGES, faults, prefetched);
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -0,0 +1,136 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern k_tid_t tids[2];
+extern struct k_msgq msgq;
+extern struct k_sem end_sema;
+static ZTEST_BMEM char __aligned(4) bbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_DMEM uint32_t tx[2 * BATCH_LEN] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+static ZTEST_BMEM uint32_t rx[2 * BATCH_LEN];
+
+static void check_rx(const uint32_t *expected, int num)
+{
+	for (int i = 0; i < num; i++) {
+		zassert_equal(rx[i], expected[i], "message %d is %u, expected %u",
+			      i, rx[i], expected[i]);
+	}
+}
+
+static void batch_put_get(struct k_msgq *q)
+{
+	/**TESTPOINT: nothing done for empty batches */
+	zassert_equal(k_msgq_put_n(q, tx, 0, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_n(q, rx, 0, K_NO_WAIT), 0);
+
+	zassert_equal(k_msgq_put_n(q, tx, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_get_n(q, rx, 2, K_NO_WAIT), 2);
+	check_rx(&tx[0], 2);
+
+	/**TESTPOINT: batch wrapping around the end of the ring buffer */
+	zassert_equal(k_msgq_put_n(q, &tx[3], 5, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN);
+	zassert_equal(k_msgq_put_n(q, tx, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_n(q, tx, 1, K_MSEC(10)), -EAGAIN);
+
+	zassert_equal(k_msgq_get_n(q, rx, ARRAY_SIZE(rx), K_NO_WAIT), BATCH_LEN);
+	check_rx(&tx[2], BATCH_LEN);
+
+	zassert_equal(k_msgq_get_n(q, rx, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_n(q, rx, 1, K_MSEC(10)), -EAGAIN);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending and receiving batches of messages
+ * @see k_msgq_put_n(), k_msgq_get_n()
+ */
+ZTEST(msgq_api, test_msgq_batch)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	batch_put_get(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test sending and receiving batches of messages from user mode
+ * @see k_msgq_put_n(), k_msgq_get_n()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_batch)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+
+	batch_put_get(q);
+}
+#endif /* CONFIG_USERSPACE */
+
+static void batch_reader(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_msgq_get_n(p1, rx, ARRAY_SIZE(rx), K_FOREVER), 1);
+	k_sem_give(&end_sema);
+}
+
+static void batch_writer(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_msgq_put_n(p1, &tx[BATCH_LEN], 2, K_FOREVER), 1);
+	k_sem_give(&end_sema);
+}
+
+/**
+ * @brief Test batches handing messages over to waiting threads
+ * @see k_msgq_put_n(), k_msgq_get_n()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch_pending)
+{
+	uint32_t out[BATCH_LEN];
+
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	/**TESTPOINT: first message goes to the waiting reader */
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE, batch_reader,
+				  &msgq, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_put_n(&msgq, tx, BATCH_LEN + 1, K_NO_WAIT), BATCH_LEN + 1);
+	k_sem_take(&end_sema, K_FOREVER);
+	zassert_equal(rx[0], tx[0]);
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+
+	/**TESTPOINT: freed space is refilled from the waiting writer */
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE, batch_writer,
+				  &msgq, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_get_n(&msgq, out, BATCH_LEN, K_NO_WAIT), BATCH_LEN);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(out[i], tx[i + 1]);
+	}
+	k_sem_take(&end_sema, K_FOREVER);
+
+	zassert_equal(k_msgq_get_n(&msgq, out, BATCH_LEN, K_NO_WAIT), 1);
+	zassert_equal(out[0], tx[BATCH_LEN]);
+
+	k_msgq_purge(&msgq);
+}
+
+/**
+ * @}
+ */
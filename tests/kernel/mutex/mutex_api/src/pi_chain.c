@@ -0,0 +1,96 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test transitive mutex priority inheritance
+ *
+ *  - thread_low takes mutex_b
+ *  - thread_mid takes mutex_a then waits on mutex_b
+ *  - thread_high waits on mutex_a, boosting thread_mid and, through
+ *    mutex_b, thread_low
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACKSIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#define PRIO_LOW  K_PRIO_PREEMPT(10)
+#define PRIO_MID  K_PRIO_PREEMPT(8)
+#define PRIO_HIGH K_PRIO_PREEMPT(4)
+#define PRIO_MAIN K_PRIO_PREEMPT(1)
+
+static K_MUTEX_DEFINE(mutex_a);
+static K_MUTEX_DEFINE(mutex_b);
+static K_SEM_DEFINE(release_low, 0, 1);
+
+static K_THREAD_STACK_DEFINE(low_stack, STACKSIZE);
+static K_THREAD_STACK_DEFINE(mid_stack, STACKSIZE);
+static K_THREAD_STACK_DEFINE(high_stack, STACKSIZE);
+static struct k_thread low_thread;
+static struct k_thread mid_thread;
+static struct k_thread high_thread;
+
+static void thread_low(void *p1, void *p2, void *p3)
+{
+	k_mutex_lock(&mutex_b, K_FOREVER);
+	k_sem_take(&release_low, K_FOREVER);
+	k_mutex_unlock(&mutex_b);
+}
+
+static void thread_mid(void *p1, void *p2, void *p3)
+{
+	k_mutex_lock(&mutex_a, K_FOREVER);
+	k_mutex_lock(&mutex_b, K_FOREVER);
+	k_mutex_unlock(&mutex_b);
+	k_mutex_unlock(&mutex_a);
+}
+
+static void thread_high(void *p1, void *p2, void *p3)
+{
+	k_mutex_lock(&mutex_a, K_FOREVER);
+	k_mutex_unlock(&mutex_a);
+}
+
+ZTEST(mutex_api_1cpu, test_mutex_priority_inheritance_chain)
+{
+	int main_prio = k_thread_priority_get(k_current_get());
+
+	if (CONFIG_MUTEX_PI_CHAIN_DEPTH == 0) {
+		ztest_test_skip();
+	}
+
+	k_thread_priority_set(k_current_get(), PRIO_MAIN);
+
+	k_thread_create(&low_thread, low_stack, STACKSIZE, thread_low, NULL, NULL, NULL,
+			PRIO_LOW, 0, K_NO_WAIT);
+	k_msleep(10);
+	zassert_equal(mutex_b.owner, &low_thread);
+
+	k_thread_create(&mid_thread, mid_stack, STACKSIZE, thread_mid, NULL, NULL, NULL,
+			PRIO_MID, 0, K_NO_WAIT);
+	k_msleep(10);
+	zassert_equal(mutex_a.owner, &mid_thread);
+	zassert_equal(k_thread_priority_get(&low_thread), PRIO_MID);
+
+	k_thread_create(&high_thread, high_stack, STACKSIZE, thread_high, NULL, NULL, NULL,
+			PRIO_HIGH, 0, K_NO_WAIT);
+	k_msleep(10);
+	zassert_equal(k_thread_priority_get(&mid_thread), PRIO_HIGH);
+	zassert_equal(k_thread_priority_get(&low_thread), PRIO_HIGH,
+		      "owner at the end of the chain not boosted");
+
+	k_sem_give(&release_low);
+
+	zassert_ok(k_thread_join(&high_thread, K_MSEC(100)));
+	zassert_ok(k_thread_join(&mid_thread, K_MSEC(100)));
+	zassert_ok(k_thread_join(&low_thread, K_MSEC(100)));
+	zassert_is_null(mutex_a.owner);
+	zassert_is_null(mutex_b.owner);
+
+	k_thread_priority_set(k_current_get(), main_prio);
+}
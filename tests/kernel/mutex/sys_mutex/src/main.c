@@ -66,6 +66,12 @@ ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_4);
 static SYS_MUTEX_DEFINE(no_access_mutex);
 #endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
+#if defined(CONFIG_SYS_MUTEX_FAST)
+static ZTEST_BMEM SYS_MUTEX_DEFINE(foreign_mutex);
+/* Never started, and no thread of the test is granted access to it */
+static K_THREAD_STACK_DEFINE(foreign_stack_area, STACKSIZE);
+static struct k_thread foreign_thread_data;
+#endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(bad_count_mutex);
 
 #ifdef CONFIG_USERSPACE
@@ -447,8 +453,8 @@ ZTEST(mutex_complex, test_supervisor_access)
 {
 	int rv;
 
-#ifdef CONFIG_USERSPACE
-	/* coverage for get_k_mutex checks */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST)
+	/* coverage for get_k_mutex checks, the fast path would fault instead */
 	rv = sys_mutex_lock((struct sys_mutex *)NULL, K_NO_WAIT);
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_lock((struct sys_mutex *)k_current_get(), K_NO_WAIT);
@@ -465,9 +471,31 @@ ZTEST(mutex_complex, test_supervisor_access)
 	zassert_true(rv == -EINVAL, "mutex wasn't locked");
 }
 
+/* A user thread must not make a thread it has no access to the owner of
+ * the kernel mutex, which would boost the priority of that thread.
+ */
+ZTEST_USER_OR_NOT(mutex_complex, test_user_foreign_owner)
+{
+#if defined(CONFIG_USERSPACE) && defined(CONFIG_SYS_MUTEX_FAST)
+	int rv;
+
+	/* Forge a lock by a thread outside of the permissions of the caller */
+	atomic_set(&foreign_mutex.val, (atomic_val_t)&foreign_thread_data);
+
+	rv = sys_mutex_lock(&foreign_mutex, K_NO_WAIT);
+	zassert_equal(rv, -EPERM, "adopted a thread without permission on it");
+	zassert_equal(atomic_get(&foreign_mutex.val), (atomic_val_t)&foreign_thread_data,
+		      "sys_mutex value changed");
+
+	atomic_clear(&foreign_mutex.val);
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 {
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST)
 	int rv;
 
 	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
@@ -497,6 +525,10 @@ static void *sys_mutex_tests_setup(void)
 				&thread_09_thread_data, &thread_09_stack_area,
 				&thread_11_thread_data, &thread_11_stack_area,
 				&thread_12_thread_data, &thread_12_stack_area);
+#endif
+#if defined(CONFIG_SYS_MUTEX_FAST)
+	k_thread_create(&foreign_thread_data, foreign_stack_area, STACKSIZE, thread_12, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(12), 0, K_FOREVER);
 #endif
 	rv = sys_mutex_lock(&not_my_mutex, K_NO_WAIT);
 	if (rv != 0) {
@@ -693,6 +693,70 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+static struct k_work_q_stats work_q_stats;
+static struct k_work_sync work_q_sync;
+static K_SEM_DEFINE(work_q_sem, 0, 1);
+
+static void test_work_handler(struct k_work *work)
+{
+	k_busy_wait(100);
+	k_sem_give(&work_q_sem);
+}
+
+static void test_work_handler2(struct k_work *work)
+{
+	k_sem_give(&work_q_sem);
+}
+
+ZTEST(obj_core_stats_work_q, test_obj_core_stats_work_q)
+{
+	static struct k_work work = Z_WORK_INITIALIZER(test_work_handler);
+	static struct k_work work2 = Z_WORK_INITIALIZER(test_work_handler2);
+	const struct k_work_handler_stats *stats = NULL;
+	uint32_t count = 0U;
+	int status;
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&k_sys_work_q));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(k_work_submit(&work), 1);
+		zassert_equal(k_sem_take(&work_q_sem, K_FOREVER), 0);
+	}
+	zassert_equal(k_work_submit(&work2), 1);
+	zassert_equal(k_sem_take(&work_q_sem, K_FOREVER), 0);
+	(void)k_work_flush(&work2, &work_q_sync);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&k_sys_work_q), &work_q_stats,
+				      sizeof(work_q_stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	/* Each handler has its own entry */
+	for (size_t i = 0; i < ARRAY_SIZE(work_q_stats.handlers); i++) {
+		if (work_q_stats.handlers[i].handler == test_work_handler) {
+			stats = &work_q_stats.handlers[i];
+		}
+	}
+
+	zassert_not_null(stats, "Handler not tracked\n");
+	zassert_equal(stats->count, 3, "Expected 3, got %u\n", stats->count);
+	zassert_true(stats->run_max_us >= 100, "Run time %u too short\n", stats->run_max_us);
+	zassert_true(stats->run_total_us >= 300, "Total run time too short\n");
+
+	for (size_t i = 0; i < CONFIG_OBJ_CORE_STATS_WORK_Q_BUCKETS; i++) {
+		count += stats->run_hist[i];
+	}
+	zassert_equal(count, 3, "Expected 3 run samples, got %u\n", count);
+	zassert_equal(stats->run_hist[0], 0, "Run time below 1 us\n");
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&k_sys_work_q));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&k_sys_work_q), &work_q_stats,
+				      sizeof(work_q_stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_is_null(work_q_stats.handlers[0].handler, "Stats not reset\n");
+}
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
@@ -704,3 +768,6 @@ ZTEST_SUITE(obj_core_stats_mem_block, NULL, NULL,
 
 ZTEST_SUITE(obj_core_stats_mem_slab, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+
+ZTEST_SUITE(obj_core_stats_work_q, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -0,0 +1,148 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_sem set_sem;
+static struct k_poll_signal set_signal;
+static struct k_fifo set_fifo;
+static struct k_poll_set set;
+static struct k_poll_event set_events[3];
+static struct k_thread set_thread;
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+
+static void set_setup(void)
+{
+	k_sem_init(&set_sem, 0, 1);
+	k_poll_signal_init(&set_signal);
+	k_fifo_init(&set_fifo);
+
+	k_poll_event_init(&set_events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_sem);
+	k_poll_event_init(&set_events[1], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	k_poll_event_init(&set_events[2], K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_fifo);
+
+	k_poll_set_init(&set);
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		k_poll_set_add(&set, &set_events[i]);
+	}
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		k_poll_set_remove(&set, &set_events[i]);
+	}
+}
+
+/**
+ * @brief Test that a poll set only returns the ready events
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready)
+{
+	struct k_poll_event *ready[ARRAY_SIZE(set_events)];
+	int ret;
+
+	set_setup();
+
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(ret, -EAGAIN, "ret %d", ret);
+
+	k_sem_give(&set_sem);
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(ret, 1, "ret %d", ret);
+	zassert_equal_ptr(ready[0], &set_events[0]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* The semaphore is still available, the event is ready again */
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(ret, 1, "ret %d", ret);
+	zassert_equal_ptr(ready[0], &set_events[0]);
+	zassert_ok(k_sem_take(&set_sem, K_NO_WAIT));
+
+	k_poll_signal_raise(&set_signal, 0);
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(ret, 1, "ret %d", ret);
+	zassert_equal_ptr(ready[0], &set_events[1]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+	k_poll_signal_reset(&set_signal);
+
+	/* Ready events that do not fit are returned by the next wait */
+	k_sem_give(&set_sem);
+	k_poll_signal_raise(&set_signal, 0);
+	ret = k_poll_set_wait(&set, ready, 1, K_NO_WAIT);
+	zassert_equal(ret, 1, "ret %d", ret);
+	zassert_equal_ptr(ready[0], &set_events[0]);
+	zassert_ok(k_sem_take(&set_sem, K_NO_WAIT));
+	ret = k_poll_set_wait(&set, ready, 1, K_NO_WAIT);
+	zassert_equal(ret, 1, "ret %d", ret);
+	zassert_equal_ptr(ready[0], &set_events[1]);
+	k_poll_signal_reset(&set_signal);
+
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(ret, -EAGAIN, "ret %d", ret);
+
+	/* A removed event is not returned anymore */
+	k_poll_set_remove(&set, &set_events[0]);
+	k_sem_give(&set_sem);
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(ret, -EAGAIN, "ret %d", ret);
+
+	set_teardown();
+}
+
+static void fifo_put_entry(void *p1, void *p2, void *p3)
+{
+	static struct {
+		void *fifo_reserved;
+	} entry;
+
+	k_msleep(10);
+	k_fifo_put(&set_fifo, &entry);
+}
+
+/**
+ * @brief Test waiting on a poll set for an event signaled by another thread
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[ARRAY_SIZE(set_events)];
+	int ret;
+
+	set_setup();
+
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "ret %d", ret);
+
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			fifo_put_entry, NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_FOREVER);
+	zassert_equal(ret, 1, "ret %d", ret);
+	zassert_equal_ptr(ready[0], &set_events[2]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_FIFO_DATA_AVAILABLE);
+	zassert_not_null(k_fifo_get(&set_fifo, K_NO_WAIT));
+
+	k_thread_join(&set_thread, K_FOREVER);
+
+	ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(ret, -EAGAIN, "ret %d", ret);
+
+	set_teardown();
+}
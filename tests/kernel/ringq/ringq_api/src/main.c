@@ -0,0 +1,284 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define NUM_SLOTS     8
+#define STACK_SIZE    (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WORKERS   2
+#define ITEMS_PER_PRODUCER 2000
+
+K_RINGQ_DEFINE(kringq, NUM_SLOTS);
+static struct k_ringq_slot slots[NUM_SLOTS];
+static struct k_ringq ringq;
+
+static struct k_thread tdata[2 * NUM_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(tstack, 2 * NUM_WORKERS, STACK_SIZE);
+
+static uint32_t consumed_sum[NUM_WORKERS];
+static atomic_t consumed;
+
+static void *entry(uintptr_t i)
+{
+	return (void *)i;
+}
+
+static void fill(struct k_ringq *q)
+{
+	for (uintptr_t i = 0; i < NUM_SLOTS; i++) {
+		zassert_equal(k_ringq_put(q, entry(i + 1), K_NO_WAIT), 0);
+	}
+}
+
+static void drain(struct k_ringq *q)
+{
+	void *data;
+
+	for (uintptr_t i = 0; i < NUM_SLOTS; i++) {
+		zassert_equal(k_ringq_get(q, &data, K_NO_WAIT), 0);
+		zassert_equal(data, entry(i + 1), "entries out of order");
+	}
+}
+
+static void *ringq_setup(void)
+{
+	k_thread_access_grant(k_current_get(), &kringq);
+
+	return NULL;
+}
+
+static void ringq_before(void *data)
+{
+	ARG_UNUSED(data);
+
+	zassert_equal(k_ringq_init(&ringq, slots, NUM_SLOTS), 0);
+}
+
+static void ringq_after(void *data)
+{
+	void *item;
+
+	ARG_UNUSED(data);
+
+	while (k_ringq_get(&kringq, &item, K_NO_WAIT) == 0) {
+	}
+}
+
+ZTEST_SUITE(ringq_api, NULL, ringq_setup, ringq_before, ringq_after, NULL);
+
+/**
+ * @brief Verify that only power of two sizes are accepted
+ */
+ZTEST(ringq_api, test_ringq_init_invalid)
+{
+	struct k_ringq q;
+
+	zassert_equal(k_ringq_init(&q, slots, 0), -EINVAL);
+	zassert_equal(k_ringq_init(&q, slots, 3), -EINVAL);
+	zassert_equal(k_ringq_init(&q, slots, 1), 0);
+}
+
+/**
+ * @brief Fill and drain a queue several times over, checking the order
+ * of the entries and the full and empty conditions
+ */
+ZTEST(ringq_api, test_ringq_put_get)
+{
+	void *data;
+
+	for (int lap = 0; lap < 5; lap++) {
+		fill(&ringq);
+		zassert_equal(k_ringq_num_used_get(&ringq), NUM_SLOTS);
+		zassert_equal(k_ringq_put(&ringq, entry(0), K_NO_WAIT), -ENOMSG);
+
+		drain(&ringq);
+		zassert_equal(k_ringq_num_used_get(&ringq), 0);
+		zassert_equal(k_ringq_get(&ringq, &data, K_NO_WAIT), -ENOMSG);
+	}
+}
+
+/**
+ * @brief Verify the statically defined queue from user mode
+ */
+ZTEST_USER(ringq_api, test_ringq_user)
+{
+	void *data;
+
+	fill(&kringq);
+	zassert_equal(k_ringq_put(&kringq, entry(0), K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_ringq_num_used_get(&kringq), NUM_SLOTS);
+	drain(&kringq);
+	zassert_equal(k_ringq_get(&kringq, &data, K_MSEC(10)), -EAGAIN);
+}
+
+/**
+ * @brief Verify that waiting for an entry or a free slot times out
+ */
+ZTEST(ringq_api, test_ringq_timeout)
+{
+	void *data;
+
+	zassert_equal(k_ringq_get(&ringq, &data, K_MSEC(10)), -EAGAIN);
+
+	fill(&ringq);
+	zassert_equal(k_ringq_put(&ringq, entry(0), K_MSEC(10)), -EAGAIN);
+	drain(&ringq);
+}
+
+static void delayed_put(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_msleep(10);
+	zassert_equal(k_ringq_put(p1, entry(42), K_NO_WAIT), 0);
+}
+
+static void delayed_get(void *p1, void *p2, void *p3)
+{
+	void *data;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_msleep(10);
+	zassert_equal(k_ringq_get(p1, &data, K_NO_WAIT), 0);
+	zassert_equal(data, entry(1));
+}
+
+/**
+ * @brief Verify that a waiting consumer is woken up by a producer
+ */
+ZTEST(ringq_api, test_ringq_get_wait)
+{
+	void *data;
+
+	k_thread_create(&tdata[0], tstack[0], STACK_SIZE, delayed_put,
+			&ringq, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_ringq_get(&ringq, &data, K_FOREVER), 0);
+	zassert_equal(data, entry(42));
+
+	k_thread_join(&tdata[0], K_FOREVER);
+}
+
+/**
+ * @brief Verify that a waiting producer is woken up by a consumer
+ */
+ZTEST(ringq_api, test_ringq_put_wait)
+{
+	fill(&ringq);
+
+	k_thread_create(&tdata[0], tstack[0], STACK_SIZE, delayed_get,
+			&ringq, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_ringq_put(&ringq, entry(NUM_SLOTS + 1), K_FOREVER), 0);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	for (uintptr_t i = 2; i <= NUM_SLOTS + 1; i++) {
+		void *data;
+
+		zassert_equal(k_ringq_get(&ringq, &data, K_NO_WAIT), 0);
+		zassert_equal(data, entry(i));
+	}
+}
+
+static void isr_put_get(const void *param)
+{
+	struct k_ringq *q = (struct k_ringq *)param;
+	void *data;
+
+	zassert_equal(k_ringq_put(q, entry(7), K_NO_WAIT), 0);
+	zassert_equal(k_ringq_get(q, &data, K_NO_WAIT), 0);
+	zassert_equal(data, entry(7));
+	zassert_equal(k_ringq_get(q, &data, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_ringq_put(q, entry(8), K_NO_WAIT), 0);
+}
+
+/**
+ * @brief Verify operations from ISR context
+ */
+ZTEST(ringq_api, test_ringq_isr)
+{
+	void *data;
+
+	irq_offload(isr_put_get, &ringq);
+
+	zassert_equal(k_ringq_get(&ringq, &data, K_NO_WAIT), 0);
+	zassert_equal(data, entry(8));
+}
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	uintptr_t id = POINTER_TO_UINT(p2);
+
+	ARG_UNUSED(p3);
+
+	for (uintptr_t i = 1; i <= ITEMS_PER_PRODUCER; i++) {
+		zassert_equal(k_ringq_put(p1, entry(i * NUM_WORKERS + id),
+					  K_FOREVER), 0);
+	}
+}
+
+static void consumer(void *p1, void *p2, void *p3)
+{
+	uintptr_t id = POINTER_TO_UINT(p2);
+	uintptr_t last[NUM_WORKERS] = { 0 };
+	void *data;
+
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&consumed) < NUM_WORKERS * ITEMS_PER_PRODUCER) {
+		if (k_ringq_get(p1, &data, K_MSEC(10)) != 0) {
+			continue;
+		}
+
+		uintptr_t v = POINTER_TO_UINT(data);
+		uintptr_t from = v % NUM_WORKERS;
+		uintptr_t seq = v / NUM_WORKERS;
+
+		/* Entries of one producer are seen in order by every consumer */
+		zassert_true(seq > last[from], "entries of a producer reordered");
+		last[from] = seq;
+
+		consumed_sum[id] += seq;
+		atomic_inc(&consumed);
+	}
+}
+
+/**
+ * @brief Run several producers and consumers concurrently and check that
+ * every entry is received exactly once
+ */
+ZTEST(ringq_api, test_ringq_mpmc)
+{
+	uint32_t total = 0;
+
+	atomic_set(&consumed, 0);
+	memset(consumed_sum, 0, sizeof(consumed_sum));
+
+	for (uintptr_t i = 0; i < NUM_WORKERS; i++) {
+		k_thread_create(&tdata[i], tstack[i], STACK_SIZE, consumer,
+				&ringq, UINT_TO_POINTER(i), NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+		k_thread_create(&tdata[NUM_WORKERS + i], tstack[NUM_WORKERS + i],
+				STACK_SIZE, producer, &ringq, UINT_TO_POINTER(i), NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(tdata); i++) {
+		k_thread_join(&tdata[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		total += consumed_sum[i];
+	}
+
+	zassert_equal(atomic_get(&consumed), NUM_WORKERS * ITEMS_PER_PRODUCER);
+	zassert_equal(total, NUM_WORKERS * (ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER + 1) / 2));
+	zassert_equal(k_ringq_num_used_get(&ringq), 0);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_THREADS 3
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Each thread keeps its CPU about 15% busy */
+#define BUSY_US  1500
+#define SLEEP_MS 8
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static void busy_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_busy_wait(BUSY_US);
+		k_msleep(SLEEP_MS);
+	}
+}
+
+static uint32_t used_cpus(void)
+{
+	uint32_t mask = 0U;
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		mask |= threads[i].base.cpu_mask;
+	}
+
+	return mask;
+}
+
+/**
+ * Verify that threads all pinned to the same CPU are spread over several
+ * CPUs by the balancer, and that they stay pinned to a single CPU.
+ */
+ZTEST(cpu_balance, test_spread)
+{
+	uint32_t all = BIT_MASK(arch_num_cpus());
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, busy_entry,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_FOREVER);
+
+		/* Pin them all to CPU 0, then let the balancer move them */
+		zassert_ok(k_thread_cpu_balance(&threads[i], all));
+		zassert_ok(k_thread_cpu_pin(&threads[i], 0));
+		k_thread_start(&threads[i]);
+	}
+
+	zassert_equal(used_cpus(), BIT(0));
+
+	k_msleep(10 * CONFIG_SCHED_CPU_MASK_BALANCE_PERIOD_MS);
+
+	zassert_not_equal(used_cpus(), BIT(0), "threads were not spread");
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		zassert_true(IS_POWER_OF_TWO(threads[i].base.cpu_mask),
+			     "thread %d not pinned to a single CPU", i);
+	}
+
+	for (int i = 0; i < arch_num_cpus(); i++) {
+		int load = k_sched_cpu_load_get(i);
+
+		zassert_true((load >= 0) && (load <= 1000), "CPU%d load %d", i, load);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_abort(&threads[i]);
+	}
+}
+
+ZTEST_SUITE(cpu_balance, NULL, NULL, NULL, NULL, NULL);
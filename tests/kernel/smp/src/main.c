@@ -1217,6 +1217,268 @@ ZTEST(smp, test_smp_affinity)
 }
 #endif
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+static struct k_thread runq_thread;
+static K_THREAD_STACK_DEFINE(runq_stack, STACK_SIZE);
+static K_SEM_DEFINE(runq_wake, 0, 1);
+static K_SEM_DEFINE(runq_woken, 0, 1);
+static volatile int runq_cpu;
+
+static volatile bool blocker_release[MAX_NUM_THREADS];
+static volatile int blocker_cpu[MAX_NUM_THREADS];
+static atomic_t blockers_running;
+
+static void runq_wake_fn(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	k_sem_give(&runq_wake);
+}
+
+static K_TIMER_DEFINE(runq_timer, runq_wake_fn, NULL);
+
+static void blocker_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	int i = POINTER_TO_INT(p1);
+
+	blocker_cpu[i] = curr_cpu();
+	atomic_inc(&blockers_running);
+
+	while (!blocker_release[i]) {
+		k_busy_wait(100);
+	}
+
+	atomic_dec(&blockers_running);
+}
+
+/* Keep a CPU busy with a thread of the test priority, which nothing
+ * started by the tests below can preempt.
+ */
+static void blocker_start(int i)
+{
+	int prio = k_thread_priority_get(k_current_get());
+	atomic_val_t running = atomic_get(&blockers_running);
+
+	blocker_release[i] = false;
+	k_thread_create(&tthread[i], tstack[i], STACK_SIZE, blocker_fn,
+			INT_TO_POINTER(i), NULL, NULL, prio, 0, K_NO_WAIT);
+
+	for (int t = 0; atomic_get(&blockers_running) == running; t++) {
+		zassert_true(t < TIMEOUT * 10, "Blocker %d did not start", i);
+		k_busy_wait(100);
+	}
+}
+
+/* Joined without blocking, so that the current CPU never goes idle */
+static void blocker_stop(int i)
+{
+	blocker_release[i] = true;
+
+	while (k_thread_join(&tthread[i], K_NO_WAIT) != 0) {
+		k_busy_wait(100);
+	}
+}
+
+/* Occupy every CPU but the current one */
+static void blockers_start(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus - 1; i++) {
+		blocker_start(i);
+	}
+}
+
+static void blockers_stop(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus - 1; i++) {
+		blocker_stop(i);
+	}
+}
+
+static void runq_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		runq_cpu = curr_cpu();
+		k_sem_give(&runq_woken);
+		k_sem_take(&runq_wake, K_FOREVER);
+	}
+}
+
+static void runq_thread_create(k_timeout_t delay)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	k_sem_reset(&runq_wake);
+	k_sem_reset(&runq_woken);
+
+	/* Lower priority than the blockers and the test thread */
+	k_thread_create(&runq_thread, runq_stack, STACK_SIZE, runq_thread_fn,
+			NULL, NULL, NULL, prio + 1, 0, delay);
+}
+
+/* Wait for the thread to run while keeping the current CPU busy,
+ * returns the CPU it ran on or -1.
+ */
+static int runq_wait_busy(int ms)
+{
+	for (int t = 0; t < ms * 10; t++) {
+		if (k_sem_take(&runq_woken, K_NO_WAIT) == 0) {
+			while (!z_is_thread_pending(&runq_thread)) {
+				k_busy_wait(100);
+			}
+
+			return runq_cpu;
+		}
+
+		k_busy_wait(100);
+	}
+
+	return -1;
+}
+
+/* Same, leaving the current CPU idle */
+static int runq_wait_idle(void)
+{
+	if (k_sem_take(&runq_woken, K_MSEC(TIMEOUT)) != 0) {
+		return -1;
+	}
+
+	while (!z_is_thread_pending(&runq_thread)) {
+		k_busy_wait(100);
+	}
+
+	return runq_cpu;
+}
+
+/**
+ * @brief Test the run queue a woken thread is placed on
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details With every CPU running a higher priority thread, a woken
+ * thread shall be queued on the CPU it last ran on and run there once
+ * that CPU is free. When that CPU stays busy, the thread shall run on
+ * the CPU that is idle.
+ */
+ZTEST(smp, test_per_cpu_runq_wakeup)
+{
+	int home;
+	int here;
+	int cpu;
+
+	blockers_start();
+	runq_thread_create(K_NO_WAIT);
+
+	/* Nothing can run it until a blocker is stopped */
+	blocker_release[0] = true;
+	home = runq_wait_busy(TIMEOUT);
+	zassert_equal(home, blocker_cpu[0], "Thread did not run on the freed CPU");
+
+	/* The only idle CPU is the one the thread ran on */
+	blocker_stop(0);
+	blocker_start(0);
+	zassert_equal(blocker_cpu[0], home, "Blocker did not start on the idle CPU");
+
+	k_sem_give(&runq_wake);
+	zassert_true(z_is_thread_queued(&runq_thread), "Woken thread is not queued");
+	zassert_equal(runq_thread.base.cpu, home,
+		      "Woken thread not queued on the CPU it last ran on");
+
+	blocker_release[0] = true;
+	cpu = runq_wait_busy(TIMEOUT);
+	zassert_equal(cpu, home, "Woken thread did not run on its CPU");
+
+	/* Its CPU is busy again, the wakeup goes to this CPU once idle */
+	blocker_stop(0);
+	blocker_start(0);
+
+	here = curr_cpu();
+	k_timer_start(&runq_timer, K_MSEC(10), K_NO_WAIT);
+	cpu = runq_wait_idle();
+	zassert_equal(cpu, here, "Woken thread did not run on the idle CPU");
+
+	k_thread_abort(&runq_thread);
+	blockers_stop();
+}
+
+/**
+ * @brief Test an idle CPU stealing a thread queued on another CPU
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details A thread queued on a busy CPU shall be taken by the CPU
+ * becoming idle.
+ */
+ZTEST(smp, test_per_cpu_runq_steal)
+{
+	int here = curr_cpu();
+	int expected;
+	int cpu;
+
+	blockers_start();
+	runq_thread_create(K_NO_WAIT);
+	zassert_true(z_is_thread_queued(&runq_thread), "Thread is not queued");
+
+	if (runq_thread.base.cpu == here) {
+		/* Another CPU steals it from the queue of this one */
+		expected = blocker_cpu[0];
+		blocker_release[0] = true;
+		cpu = runq_wait_busy(TIMEOUT);
+	} else {
+		/* This CPU steals it from the queue of a blocked CPU */
+		expected = here;
+		cpu = runq_wait_idle();
+	}
+
+	zassert_equal(cpu, expected, "Thread was not stolen by the idle CPU");
+
+	k_thread_abort(&runq_thread);
+	blockers_stop();
+}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+/**
+ * @brief Test that stealing honours the CPU mask
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details An idle CPU shall not steal a thread that is not allowed
+ * to run on it, and the thread shall run once its own CPU is free.
+ */
+ZTEST(smp, test_per_cpu_runq_steal_affinity)
+{
+	int here = curr_cpu();
+	int cpu;
+
+	blockers_start();
+	runq_thread_create(K_FOREVER);
+	k_thread_cpu_pin(&runq_thread, here);
+	k_thread_start(&runq_thread);
+	zassert_equal(runq_thread.base.cpu, here, "Thread not queued on its CPU");
+
+	blocker_release[0] = true;
+	cpu = runq_wait_busy(50);
+	zassert_equal(cpu, -1, "Thread ran on CPU %d outside its mask", cpu);
+
+	cpu = runq_wait_idle();
+	zassert_equal(cpu, here, "Thread did not run on its CPU");
+
+	k_thread_abort(&runq_thread);
+	blockers_stop();
+}
+#endif /* CONFIG_SCHED_CPU_MASK */
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static void *smp_tests_setup(void)
 {
 	/* Sleep a bit to guarantee that both CPUs enter an idle
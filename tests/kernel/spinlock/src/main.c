@@ -55,6 +55,34 @@ ZTEST(spinlock, test_spinlock_basic)
 	zassert_true(!z_spin_is_locked(&l), "Spinlock failed to unlock");
 }
 
+/**
+ * @brief Test spinlock contention statistics
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_spin_lock(), k_spin_trylock()
+ */
+ZTEST(spinlock, test_spinlock_stats)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SPIN_LOCK_STATS);
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	k_spinlock_key_t key;
+	static struct k_spinlock l;
+
+	for (int i = 0; i < 10; i++) {
+		key = k_spin_lock(&l);
+		k_spin_unlock(&l, key);
+	}
+
+	zassert_ok(k_spin_trylock(&l, &key));
+	k_spin_unlock(&l, key);
+
+	zassert_equal(l.lock_count, 11);
+	zassert_equal(l.contended_count, 0, "uncontended lock counted as contended");
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
 static void bounce_once(int id, bool trylock)
 {
 	int ret;
@@ -21,7 +21,8 @@
 
 K_HEAP_DEFINE(stack_heap, POOL_SIZE);
 
-ZTEST_DMEM bool tflag[MAX(CONFIG_DYNAMIC_THREAD_POOL_SIZE, MAX_HEAP_STACKS)];
+ZTEST_DMEM bool tflag[MAX(MAX(CONFIG_DYNAMIC_THREAD_POOL_SIZE, MAX_HEAP_STACKS),
+			   CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE)];
 
 static void func(void *arg1, void *arg2, void *arg3)
 {
@@ -122,6 +123,63 @@ ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_pool)
 	}
 }
 
+/** @brief Exercise the size classes of the pool-based thread stack allocator */
+ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_pool_small)
+{
+#if CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE > 0
+	static k_tid_t tid[CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE];
+	static struct k_thread th[CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE];
+	static k_thread_stack_t *stack[CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE];
+	k_thread_stack_t *large;
+
+	if (!IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_POOL)) {
+		ztest_test_skip();
+	}
+
+	/* allocate all small thread stacks from the pool */
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		stack[i] = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE,
+						IS_ENABLED(CONFIG_USERSPACE) ? K_USER : 0);
+
+		zassert_not_null(stack[i]);
+	}
+
+	/* once the small class is depleted, a small stack comes from the larger class */
+	large = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE,
+				     IS_ENABLED(CONFIG_USERSPACE) ? K_USER : 0);
+	zassert_not_null(large);
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		zassert_not_equal(large, stack[i]);
+	}
+
+	/* spawn our threads */
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		tflag[i] = false;
+		tid[i] = k_thread_create(&th[i], stack[i],
+				CONFIG_DYNAMIC_THREAD_SMALL_STACK_SIZE, func,
+				&tflag[i], NULL, NULL, 0,
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	/* join all threads and check that flags have been set */
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		zassert_ok(k_thread_join(tid[i], K_MSEC(TIMEOUT_MS)));
+		zassert_true(tflag[i]);
+	}
+
+	/* clean up stacks allocated from the pool */
+	zassert_ok(k_thread_stack_free(large));
+	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE; ++i) {
+		zassert_ok(k_thread_stack_free(stack[i]));
+	}
+
+	/* a freed stack is not accepted twice */
+	zassert_equal(k_thread_stack_free(stack[0]), -EINVAL);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_DYNAMIC_THREAD_SMALL_POOL_SIZE > 0 */
+}
+
 /** @brief Exercise the heap-based thread stack allocator */
 ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_alloc)
 {
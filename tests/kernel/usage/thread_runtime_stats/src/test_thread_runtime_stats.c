@@ -547,5 +547,53 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_WAKE_LATENCY
+static K_SEM_DEFINE(wake_sem, 0, 1);
+
+static void wake_helper(void *p1, void *p2, void *p3)
+{
+	while (1) {
+		k_sem_take(&wake_sem, K_FOREVER);
+	}
+}
+
+/**
+ * @brief Test the wake-to-run latency statistics
+ *
+ * Wake up a lower priority helper thread, then busy loop for two ticks
+ * before sleeping: the helper waits for at least two ticks in the ready
+ * queue.
+ */
+ZTEST(usage_api, test_thread_stats_wake_latency)
+{
+	k_thread_runtime_stats_t  stats;
+	k_tid_t  tid;
+	int  priority;
+
+	priority = k_thread_priority_get(k_current_get());
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      wake_helper, NULL, NULL, NULL,
+			      priority + 2, 0, K_NO_WAIT);
+
+	/* Let the helper block on the semaphore */
+	k_sleep(K_TICKS(1));
+
+	k_thread_runtime_stats_get(tid, &stats);
+	zassert_true(stats.wake_peak_cycles < k_ticks_to_cyc_floor64(2));
+
+	k_sem_give(&wake_sem);
+	busy_loop(2);
+	k_sleep(K_TICKS(1));
+
+	k_thread_runtime_stats_get(tid, &stats);
+	zassert_true(stats.wake_peak_cycles >= k_ticks_to_cyc_floor64(1));
+	zassert_true(stats.wake_average_cycles > 0);
+	zassert_true(stats.wake_average_cycles <= stats.wake_peak_cycles);
+
+	k_thread_abort(tid);
+}
+#endif /* CONFIG_SCHED_THREAD_WAKE_LATENCY */
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
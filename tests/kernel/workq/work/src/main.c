@@ -1462,6 +1462,94 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+#define POOL_THREADS 2
+
+static K_KERNEL_STACK_ARRAY_DEFINE(pool_stacks, POOL_THREADS, STACK_SIZE);
+static struct k_thread pool_threads[POOL_THREADS];
+static struct k_work_q pool_queue;
+static struct k_sem pool_sem;
+static atomic_t pool_running;
+static atomic_t pool_max_running;
+
+static void pool_timer_handler(struct k_timer *timer)
+{
+	k_sem_give(&pool_sem);
+}
+
+static K_TIMER_DEFINE(pool_timer, pool_timer_handler, NULL);
+
+static void pool_handler(struct k_work *work)
+{
+	atomic_val_t running = atomic_inc(&pool_running) + 1;
+
+	if (running > atomic_get(&pool_max_running)) {
+		atomic_set(&pool_max_running, running);
+	}
+
+	k_sem_take(&pool_sem, K_FOREVER);
+	atomic_dec(&pool_running);
+	k_sem_give(&sync_sem);
+}
+
+/* Check that a pool runs distinct items at the same time, never the same
+ * item twice at once, and that a flush waits for the resubmitted item.
+ */
+ZTEST(work_1cpu, test_1cpu_pool_queue)
+{
+	int rc;
+
+	k_sem_init(&pool_sem, 0, K_SEM_MAX_LIMIT);
+	k_sem_init(&sync_sem, 0, K_SEM_MAX_LIMIT);
+	atomic_clear(&pool_running);
+	atomic_clear(&pool_max_running);
+
+	if (!k_work_queue_thread_get(&pool_queue)) {
+		k_work_queue_start_pool(&pool_queue, pool_threads, &pool_stacks[0][0],
+					POOL_THREADS, STACK_SIZE, COOPHI_PRIORITY, NULL);
+	}
+
+	k_work_init(&common_work, pool_handler);
+	k_work_init(&common_work1, pool_handler);
+
+	/* Both items start at once */
+	rc = k_work_submit_to_queue(&pool_queue, &common_work);
+	zassert_equal(rc, 1);
+	rc = k_work_submit_to_queue(&pool_queue, &common_work1);
+	zassert_equal(rc, 1);
+	zassert_equal(k_work_busy_get(&common_work), K_WORK_RUNNING);
+	zassert_equal(k_work_busy_get(&common_work1), K_WORK_RUNNING);
+	zassert_equal(atomic_get(&pool_max_running), 2);
+
+	k_sem_give(&pool_sem);
+	k_sem_give(&pool_sem);
+	zassert_equal(k_sem_take(&sync_sem, K_FOREVER), 0);
+	zassert_equal(k_sem_take(&sync_sem, K_FOREVER), 0);
+
+	/* A running item resubmitted waits for its completion */
+	atomic_clear(&pool_max_running);
+	rc = k_work_submit_to_queue(&pool_queue, &common_work);
+	zassert_equal(rc, 1);
+	rc = k_work_submit_to_queue(&pool_queue, &common_work);
+	zassert_equal(rc, 2);
+	zassert_equal(atomic_get(&pool_max_running), 1);
+
+	/* The first run completes, the resubmission starts */
+	k_sem_give(&pool_sem);
+	zassert_equal(k_work_busy_get(&common_work), K_WORK_RUNNING);
+
+	/* The flush must wait for the resubmission, released by the timer */
+	k_timer_start(&pool_timer, K_MSEC(DELAY_MS), K_NO_WAIT);
+	zassert_true(k_work_flush(&common_work, &work_sync));
+	zassert_equal(k_work_busy_get(&common_work), 0);
+	zassert_equal(atomic_get(&pool_max_running), 1);
+	zassert_equal(k_sem_take(&sync_sem, K_NO_WAIT), 0);
+	zassert_equal(k_sem_take(&sync_sem, K_NO_WAIT), 0);
+
+	k_sem_init(&sync_sem, 0, 1);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
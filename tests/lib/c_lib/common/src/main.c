@@ -596,6 +596,52 @@ ZTEST(libc_common, test_memcpy)
 		0, "memcpy failed");
 }
 
+/**
+ * @brief Test memcpy, memset and memcmp over sizes and alignments
+ *
+ * @details Covers the word and vector sized loops of the implementations,
+ * along with the bytes before and after them.
+ */
+ZTEST(libc_common, test_mem_sizes)
+{
+	static uint8_t src[256 + 16];
+	static uint8_t dst[256 + 16];
+	static const size_t sizes[] = { 1, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 255 };
+
+	for (int i = 0; i < sizeof(src); i++) {
+		src[i] = (uint8_t)(i * 13 + 1);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(sizes); i++) {
+		size_t n = sizes[i];
+
+		for (int off = 0; off < 8; off++) {
+			memset(dst, 0, sizeof(dst));
+
+			zassert_equal(memcpy(dst + off + 1, src + off, n), dst + off + 1);
+			zassert_equal(memcmp(dst + off + 1, src + off, n), 0,
+				      "memcpy of %zu bytes at %d failed", n, off);
+			zassert_equal(dst[off], 0, "memcpy wrote before the area");
+			zassert_equal(dst[off + 1 + n], 0, "memcpy wrote after the area");
+
+			/**TESTPOINT: the sign comes from the first differing byte */
+			dst[off + n] ^= 0x80;
+			zassert_true((memcmp(dst + off + 1, src + off, n) > 0) ==
+				     (dst[off + n] > src[off + n - 1]),
+				     "memcmp of %zu bytes at %d failed", n, off);
+
+			memset(dst, 0, sizeof(dst));
+			zassert_equal(memset(dst + off + 1, 0xa5, n), dst + off + 1);
+			zassert_equal(dst[off], 0, "memset wrote before the area");
+			zassert_equal(dst[off + 1 + n], 0, "memset wrote after the area");
+			for (int j = 0; j < n; j++) {
+				zassert_equal(dst[off + 1 + j], 0xa5,
+					      "memset of %zu bytes at %d failed", n, off);
+			}
+		}
+	}
+}
+
 /**
  * @brief Test memmove operation
  *
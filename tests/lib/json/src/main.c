@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include <zephyr/ztest.h>
 #include <zephyr/data/json.h>
+#include <zephyr/net_buf.h>
 
 struct test_nested {
 	int nested_int;
@@ -2178,4 +2179,184 @@ ZTEST(lib_json_test, test_json_enums)
 		     "Enums not decoded correctly");
 }
 
+#if defined(CONFIG_NET_BUF)
+NET_BUF_POOL_DEFINE(json_net_buf_pool, 8, 16, 0, NULL);
+
+ZTEST(lib_json_test, test_json_encoding_net_buf)
+{
+	char encoded[] = "{\"i8\":-128,"
+			 "\"u8\":255,"
+			 "\"i16\":-32768,"
+			 "\"u16\":65535,"
+			 "\"i32\":-2147483648,"
+			 "\"u32\":4294967295"
+			 "}";
+	char buffer[sizeof(encoded)];
+	struct test_enums enums = {
+		.i8 = I8_MIN,
+		.u8 = U8_MAX,
+		.i16 = I16_MIN,
+		.u16 = U16_MAX,
+		.i32 = I32_MIN,
+		.u32 = U32_MAX,
+	};
+	struct net_buf *buf;
+	int ret;
+
+	buf = net_buf_alloc(&json_net_buf_pool, K_NO_WAIT);
+	zassert_not_null(buf, "Cannot allocate buffer");
+	net_buf_add_u8(buf, '[');
+
+	ret = json_obj_encode_net_buf(enums_descr, ARRAY_SIZE(enums_descr), &enums, buf,
+				      K_NO_WAIT);
+	zassert_equal(ret, 0, "Encoding function failed");
+	zassert_not_null(buf->frags, "Encoded in a single fragment");
+	zassert_equal(net_buf_frags_len(buf), strlen(encoded) + 1,
+		      "Encoded size mismatch");
+
+	net_buf_linearize(buffer, sizeof(buffer), buf, 1, strlen(encoded));
+	zassert_mem_equal(buffer, encoded, strlen(encoded),
+			  "Encoded contents not consistent");
+
+	/**TESTPOINT: running out of fragments */
+	while (net_buf_append_bytes(buf, sizeof(buffer), buffer, K_NO_WAIT, NULL, NULL) ==
+	       sizeof(buffer)) {
+	}
+
+	ret = json_obj_encode_net_buf(enums_descr, ARRAY_SIZE(enums_descr), &enums, buf,
+				      K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "Encoding not failed with no fragment left");
+
+	net_buf_unref(buf);
+}
+#endif /* CONFIG_NET_BUF */
+
+#if defined(CONFIG_JSON_LIBRARY_STREAM)
+struct test_stream_nested {
+	int nested_int;
+	char nested_string_buf[10];
+};
+
+struct test_stream {
+	char some_string_buf[16];
+	int some_int;
+	bool some_bool;
+	int64_t some_int64;
+	struct test_stream_nested some_nested;
+	int some_array[4];
+	size_t some_array_len;
+	struct test_stream_nested obj_array[2];
+	size_t obj_array_len;
+};
+
+static const struct json_obj_descr stream_nested_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_stream_nested, nested_int, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_stream_nested, nested_string_buf,
+			    JSON_TOK_STRING_BUF),
+};
+
+static const struct json_obj_descr stream_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_stream, some_string_buf, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, some_int, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, some_bool, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, some_int64, JSON_TOK_INT64),
+	JSON_OBJ_DESCR_OBJECT(struct test_stream, some_nested, stream_nested_descr),
+	JSON_OBJ_DESCR_ARRAY(struct test_stream, some_array, 4, some_array_len,
+			     JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct test_stream, obj_array, 2, obj_array_len,
+				 stream_nested_descr, ARRAY_SIZE(stream_nested_descr)),
+};
+
+static int64_t stream_parse(const char *json, size_t len, size_t chunk,
+			    const struct json_obj_descr *descr, size_t descr_len, void *val)
+{
+	struct json_stream stream;
+	int ret = 0;
+
+	json_stream_init(&stream, descr, descr_len, val);
+
+	for (size_t pos = 0; pos < len && ret == 0; pos += chunk) {
+		ret = json_stream_feed(&stream, json + pos, MIN(chunk, len - pos));
+	}
+
+	return json_stream_result(&stream);
+}
+
+ZTEST(lib_json_test, test_json_stream_decoding)
+{
+	char encoded[] = "{\"some_string_buf\":\"z\\\"ephyr\\u00e9\","
+		"\"some_int\":\t-42\n,"
+		"\"extra_struct\":{\"nested\":[{\"a\":\"}]\"},[1,2],null]},"
+		"\"some_bool\":true,"
+		"\"some_int64\":-4611686018427387904,"
+		"\"some_nested\":{\"nested_int\":1234,\"nested_string_buf\":\"nested\"},"
+		"\"some_array\":[11, 22,33],"
+		"\"obj_array\":[{\"nested_int\":1,\"nested_string_buf\":\"one\"},"
+		"{\"nested_string_buf\":\"two\",\"nested_int\":2}]"
+		"}";
+	struct test_stream expected;
+	struct test_stream ts;
+	int64_t ret;
+
+	memset(&expected, 0, sizeof(expected));
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, stream_descr,
+			     ARRAY_SIZE(stream_descr), &expected);
+	zassert_equal(ret, (1 << ARRAY_SIZE(stream_descr)) - 1,
+		      "Not all fields decoded correctly");
+
+	/* Whatever the chunk size, the result is the one of json_obj_parse() */
+	for (size_t chunk = 1; chunk < sizeof(encoded); chunk++) {
+		memset(&ts, 0, sizeof(ts));
+		ret = stream_parse(encoded, sizeof(encoded) - 1, chunk, stream_descr,
+				   ARRAY_SIZE(stream_descr), &ts);
+		zassert_equal(ret, (1 << ARRAY_SIZE(stream_descr)) - 1,
+			      "Not all fields decoded with chunks of %zu", chunk);
+		zassert_mem_equal(&ts, &expected, sizeof(ts),
+				  "Stream decoding differs with chunks of %zu", chunk);
+	}
+
+	zassert_str_equal(ts.some_string_buf, "z\\\"ephyr\\u00e9",
+			  "String (array) not decoded correctly");
+	zassert_equal(ts.obj_array_len, 2,
+		      "Array of objects does not have correct number of items");
+	zassert_str_equal(ts.obj_array[1].nested_string_buf, "two",
+			  "String in object array element not decoded correctly");
+}
+
+ZTEST(lib_json_test, test_json_stream_errors)
+{
+	static const struct {
+		const char *str;
+		int64_t result;
+	} encoded[] = {
+		{ "{\"some_int\":1", -EAGAIN },
+		{ "{\"some_int\":1,}", -EINVAL },
+		{ "{\"some_int\":tru}", -EINVAL },
+		{ "{\"some_bool\":1}", -EINVAL },
+		{ "{\"some_string_buf\":\"this string is too long\"}", -EINVAL },
+		{ "{\"some_array\":[1,2,3,4,5]}", -ENOSPC },
+		{ "[1]", -EINVAL },
+	};
+	struct test_stream ts;
+	struct json_stream stream;
+	int64_t ret;
+
+	for (int i = 0; i < ARRAY_SIZE(encoded); i++) {
+		ret = stream_parse(encoded[i].str, strlen(encoded[i].str), 1, stream_descr,
+				   ARRAY_SIZE(stream_descr), &ts);
+		zassert_equal(ret, encoded[i].result, "Decoding '%s' result %lld, expected %lld",
+			      encoded[i].str, ret, encoded[i].result);
+	}
+
+	/**TESTPOINT: errors are sticky */
+	json_stream_init(&stream, stream_descr, ARRAY_SIZE(stream_descr), &ts);
+	zassert_equal(json_stream_feed(&stream, "{\"some_int\":x,", 14), -EINVAL);
+	zassert_equal(json_stream_feed(&stream, "}", 1), -EINVAL);
+
+	/**TESTPOINT: fields pointing into the input are not supported */
+	json_stream_init(&stream, nested_descr, ARRAY_SIZE(nested_descr), &ts);
+	zassert_equal(json_stream_feed(&stream, "{\"nested_string\":\"x\"}", 20), -ENOTSUP);
+}
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,95 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/prio_queue.h>
+#include <zephyr/ztest.h>
+
+#define QUEUE_CAPACITY 4
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static int compare_int(const void *a, const void *b)
+{
+	return *(const int *)a - *(const int *)b;
+}
+
+SYS_PRIO_QUEUE_DEFINE(queue, QUEUE_CAPACITY, sizeof(int), __alignof__(int), compare_int);
+
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static struct k_thread producer_thread;
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	int item = POINTER_TO_INT(p1);
+
+	zassert_ok(sys_prio_queue_push(&queue, &item));
+}
+
+static void prio_queue_before(void *fixture)
+{
+	int item;
+
+	ARG_UNUSED(fixture);
+
+	while (sys_prio_queue_pop(&queue, &item, K_NO_WAIT) == 0) {
+	}
+}
+
+ZTEST(prio_queue, test_push_pop_order)
+{
+	static const int items[] = {30, 10, 40, 20};
+	int item = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(items); i++) {
+		zassert_ok(sys_prio_queue_push(&queue, &items[i]));
+	}
+
+	zassert_equal(sys_prio_queue_count(&queue), ARRAY_SIZE(items));
+	zassert_equal(sys_prio_queue_push(&queue, &items[0]), -ENOMEM);
+
+	zassert_ok(sys_prio_queue_peek(&queue, &item));
+	zassert_equal(item, 10);
+
+	for (int expected = 10; expected <= 40; expected += 10) {
+		zassert_ok(sys_prio_queue_pop(&queue, &item, K_NO_WAIT));
+		zassert_equal(item, expected);
+	}
+
+	zassert_equal(sys_prio_queue_peek(&queue, &item), -ENOENT);
+	zassert_equal(sys_prio_queue_pop(&queue, &item, K_NO_WAIT), -EBUSY);
+	zassert_equal(sys_prio_queue_pop(&queue, &item, K_MSEC(10)), -EAGAIN);
+}
+
+ZTEST(prio_queue, test_blocking_pop)
+{
+	int item = 0;
+
+	k_thread_create(&producer_thread, producer_stack, STACK_SIZE, producer,
+			INT_TO_POINTER(42), NULL, NULL, K_PRIO_PREEMPT(0), 0, K_MSEC(10));
+
+	zassert_ok(sys_prio_queue_pop(&queue, &item, K_MSEC(1000)));
+	zassert_equal(item, 42);
+
+	k_thread_join(&producer_thread, K_FOREVER);
+}
+
+ZTEST(prio_queue, test_init)
+{
+	struct sys_prio_queue runtime_queue;
+	int storage[2];
+	int item = 5;
+
+	zassert_equal(sys_prio_queue_init(&runtime_queue, storage, 0, sizeof(int), compare_int),
+		      -EINVAL);
+	zassert_ok(sys_prio_queue_init(&runtime_queue, storage, ARRAY_SIZE(storage), sizeof(int),
+				       compare_int));
+	zassert_ok(sys_prio_queue_push(&runtime_queue, &item));
+	item = 0;
+	zassert_ok(sys_prio_queue_pop(&runtime_queue, &item, K_NO_WAIT));
+	zassert_equal(item, 5);
+}
+
+ZTEST_SUITE(prio_queue, NULL, NULL, prio_queue_before, NULL, NULL);
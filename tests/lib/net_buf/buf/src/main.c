@@ -71,6 +71,7 @@ static void var_destroy(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_FIXED_DEFINE(bulk_pool, 4, FIXED_BUFFER_SIZE, USER_DATA_FIXED, NULL);
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -506,6 +507,85 @@ ZTEST(net_buf_tests, test_net_buf_fixed_pool)
 	zassert_equal(destroy_called, 1, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_alloc_bulk)
+{
+	struct net_buf *buf, *frag;
+	int i;
+
+	buf = net_buf_alloc_bulk(&bulk_pool, 20, 4, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffers");
+
+	for (frag = buf, i = 0; frag; frag = frag->frags, i++) {
+		zassert_equal(frag->ref, 1, "Invalid buffer ref count");
+		zassert_equal(frag->size, FIXED_BUFFER_SIZE, "Invalid buffer size");
+		zassert_equal(frag->len, 0, "Invalid buffer length");
+	}
+	zassert_equal(i, 4, "Invalid number of fragments");
+
+	zassert_is_null(net_buf_alloc_bulk(&bulk_pool, 20, 1, K_NO_WAIT),
+			"Got buffer from empty pool");
+
+	/* The whole chain goes back into the pool */
+	net_buf_unref(buf);
+
+	frag = net_buf_alloc_fixed(&bulk_pool, K_NO_WAIT);
+	zassert_not_null(frag, "Failed to get buffer");
+
+	/* A failed allocation puts back the buffers it took */
+	zassert_is_null(net_buf_alloc_bulk(&bulk_pool, 20, 4, K_NO_WAIT),
+			"Got more buffers than available");
+
+	buf = net_buf_alloc_bulk(&bulk_pool, 20, 3, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffers");
+
+	net_buf_unref(frag);
+	net_buf_unref(buf);
+}
+
+ZTEST(net_buf_tests, test_net_buf_iov_export)
+{
+	struct net_buf_iov iov[3];
+	struct net_buf *buf, *frag;
+	int ret;
+
+	buf = net_buf_alloc_bulk(&bulk_pool, 20, 3, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffers");
+
+	/* 10 bytes, an empty fragment, then 20 bytes */
+	net_buf_add(buf, 10);
+	frag = buf->frags->frags;
+	net_buf_add(frag, 20);
+
+	ret = net_buf_iov_export(buf, 0, 30, iov, ARRAY_SIZE(iov));
+	zassert_equal(ret, 2, "Invalid number of entries %d", ret);
+	zassert_equal_ptr(iov[0].base, buf->data, "Invalid entry data");
+	zassert_equal(iov[0].len, 10, "Invalid entry length");
+	zassert_equal_ptr(iov[1].base, frag->data, "Invalid entry data");
+	zassert_equal(iov[1].len, 20, "Invalid entry length");
+
+	ret = net_buf_iov_export(buf, 5, 10, iov, ARRAY_SIZE(iov));
+	zassert_equal(ret, 2, "Invalid number of entries %d", ret);
+	zassert_equal_ptr(iov[0].base, buf->data + 5, "Invalid entry data");
+	zassert_equal(iov[0].len, 5, "Invalid entry length");
+	zassert_equal_ptr(iov[1].base, frag->data, "Invalid entry data");
+	zassert_equal(iov[1].len, 5, "Invalid entry length");
+
+	ret = net_buf_iov_export(buf, 12, 8, iov, ARRAY_SIZE(iov));
+	zassert_equal(ret, 1, "Invalid number of entries %d", ret);
+	zassert_equal_ptr(iov[0].base, frag->data + 2, "Invalid entry data");
+
+	ret = net_buf_iov_export(buf, 0, 30, iov, 1);
+	zassert_equal(ret, -ENOBUFS, "Entries overflow not detected");
+
+	ret = net_buf_iov_export(buf, 0, 31, iov, ARRAY_SIZE(iov));
+	zassert_equal(ret, -EINVAL, "Chain overflow not detected");
+
+	zassert_equal(net_buf_iov_export(buf, 30, 0, iov, ARRAY_SIZE(iov)), 0,
+		      "Entries used for no data");
+
+	net_buf_unref(buf);
+}
+
 ZTEST(net_buf_tests, test_net_buf_var_pool)
 {
 	struct net_buf *buf1, *buf2, *buf3;
@@ -234,7 +234,7 @@ static void test_iface_setup(void)
 /*
  * Simulate a packet reception from the outside world
  */
-static void _recv_data(struct net_if *iface)
+static void _recv_data_to(struct net_if *iface, const struct net_eth_addr *dst)
 {
 	struct net_pkt *pkt;
 	struct net_eth_hdr eth_hdr;
@@ -259,6 +259,10 @@ static void _recv_data(struct net_if *iface)
 	eth_hdr.dst.addr[4] = net_if_get_by_iface(iface);
 	eth_hdr.dst.addr[5] = 0x55;
 
+	if (dst != NULL) {
+		memcpy(&eth_hdr.dst, dst, sizeof(eth_hdr.dst));
+	}
+
 	eth_hdr.src.addr[0] = 0xa2;
 	eth_hdr.src.addr[1] = 0x11;
 	eth_hdr.src.addr[2] = 0x22;
@@ -279,6 +283,11 @@ static void _recv_data(struct net_if *iface)
 	zassert_equal(ret, 0, "");
 }
 
+static void _recv_data(struct net_if *iface)
+{
+	_recv_data_to(iface, NULL);
+}
+
 static void test_recv_before_bridging(void)
 {
 	/* fake some packet reception */
@@ -364,6 +373,48 @@ static void test_recv_with_bridge(void)
 	check_free_packet_count();
 }
 
+static void test_recv_learned_unicast(void)
+{
+	/* Source address of the frames received from fake_iface[0] */
+	struct net_eth_addr dst = {
+		.addr = { 0xa2, 0x11, 0x22, net_if_get_by_iface(fake_iface[0]), 0x77, 0x88 },
+	};
+	struct eth_bridge_port_stats stats;
+	int ret;
+
+	/* The address was learned, so the frame is only sent to fake_iface[0] */
+	_recv_data_to(fake_iface[1], &dst);
+
+	k_sleep(K_MSEC(100));
+
+	for (int j = 0; j < 3; j++) {
+		struct net_pkt *pkt = eth_fake_data[j].sent_pkt;
+
+		if (eth_fake_data[j].iface != fake_iface[0]) {
+			zassert_is_null(pkt, "");
+			continue;
+		}
+
+		eth_fake_data[j].sent_pkt = NULL;
+		zassert_not_null(pkt, "");
+		zassert_mem_equal(&NET_ETH_HDR(pkt)->dst, &dst, sizeof(dst), "");
+
+		net_pkt_unref(pkt);
+	}
+
+	ret = eth_bridge_port_stats_get(bridge, fake_iface[1], &stats);
+	zassert_equal(ret, 0, "");
+	/* Other traffic of the stack may have been bridged as well */
+	zassert_true(stats.rx >= 2, "");
+	zassert_true(stats.flooded >= 1, "");
+
+	ret = eth_bridge_port_stats_get(bridge, fake_iface[0], &stats);
+	zassert_equal(ret, 0, "");
+	zassert_true(stats.tx >= 3, "");
+
+	check_free_packet_count();
+}
+
 static void test_recv_after_bridging(void)
 {
 	int ret;
@@ -407,6 +458,7 @@ ZTEST(net_eth_bridge, test_net_eth_bridge)
 	DBG("With bridging\n");
 	test_setup_bridge();
 	test_recv_with_bridge();
+	test_recv_learned_unicast();
 	DBG("After bridging\n");
 	test_recv_after_bridging();
 }
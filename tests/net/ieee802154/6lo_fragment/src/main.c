@@ -465,8 +465,9 @@ static struct net_buf frame_buf = {
 	.__buf = frame_buffer_data,
 };
 
-static bool test_fragment(struct net_fragment_data *data)
+static bool test_fragment_receive(struct net_fragment_data *data, bool duplicate)
 {
+	bool resent = false;
 	struct net_pkt *rxpkt = NULL;
 	struct net_pkt *f_pkt = NULL;
 	int result = false;
@@ -556,13 +557,29 @@ reassemble:
 
 		switch (ieee802154_6lo_reassemble(rxpkt)) {
 		case NET_OK:
+			if (duplicate && !resent) {
+				/* Receive the same fragment again */
+				resent = true;
+				break;
+			}
+
+			resent = false;
 			buf = buf->frags;
 			break;
 		case NET_CONTINUE:
 			goto compare;
 		case NET_DROP:
 			net_pkt_unref(rxpkt);
-			goto end;
+			rxpkt = NULL;
+
+			if (!resent) {
+				goto end;
+			}
+
+			/* The duplicate fragment is expected to be dropped */
+			resent = false;
+			buf = buf->frags;
+			break;
 		}
 	}
 
@@ -593,6 +610,11 @@ end:
 	return result;
 }
 
+static bool test_fragment(struct net_fragment_data *data)
+{
+	return test_fragment_receive(data, false);
+}
+
 ZTEST(ieee802154_6lo_fragment, test_fragment_sam00_dam00)
 {
 	bool ret = test_fragment(&test_data_1);
@@ -656,4 +678,11 @@ ZTEST(ieee802154_6lo_fragment, test_fragment_ipv6_no_fragmentation_after_iphc)
 	zassert_true(ret);
 }
 
+ZTEST(ieee802154_6lo_fragment, test_fragment_duplicates_dropped)
+{
+	bool ret = test_fragment_receive(&test_data_8, true);
+
+	zassert_true(ret);
+}
+
 ZTEST_SUITE(ieee802154_6lo_fragment, NULL, NULL, NULL, NULL, NULL);
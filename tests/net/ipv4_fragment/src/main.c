@@ -141,6 +141,7 @@ static uint16_t pkt_id;
 static uint16_t pkt_recv_size;
 static uint16_t pkt_recv_expected_size;
 static bool last_packet_received;
+static bool duplicate_fragments;
 static uint8_t active_test;
 static uint8_t lower_layer_packet_count;
 static uint8_t upper_layer_packet_count;
@@ -240,6 +241,8 @@ static void check_ipv4_fragment_header(struct net_pkt *pkt, const uint8_t *orig_
 static int sender_iface(const struct device *dev, struct net_pkt *pkt)
 {
 	struct net_pkt *recv_pkt;
+	struct net_pkt *dup_pkt;
+	bool more_fragments;
 	int ret;
 	uint8_t buf_ip_src[4];
 	uint8_t buf_ip_dst[4];
@@ -322,6 +325,7 @@ static int sender_iface(const struct device *dev, struct net_pkt *pkt)
 		net_pkt_cursor_init(recv_pkt);
 		net_pkt_skip(recv_pkt, 6);
 		net_pkt_read_be16(recv_pkt, &offset);
+		more_fragments = (offset & NET_IPV4_MORE_FRAG_MASK) != 0;
 		offset &= NET_IPV4_FRAGH_OFFSET_MASK;
 
 		if (offset == 0) {
@@ -341,6 +345,16 @@ static int sender_iface(const struct device *dev, struct net_pkt *pkt)
 		net_pkt_cursor_init(recv_pkt);
 		net_pkt_set_overwrite(recv_pkt, false);
 		net_pkt_set_iface(recv_pkt, iface1);
+
+		if (duplicate_fragments && more_fragments) {
+			/* Feed the fragment twice, the copy must be ignored */
+			dup_pkt = net_pkt_rx_clone(recv_pkt, K_NO_WAIT);
+			zassert_not_null(dup_pkt, "Cannot clone fragment");
+			net_pkt_set_iface(dup_pkt, iface1);
+			ret = net_recv_data(net_pkt_iface(dup_pkt), dup_pkt);
+			zassert_equal(ret, 0, "Cannot receive data (%d)", ret);
+		}
+
 		ret = net_recv_data(net_pkt_iface(recv_pkt), recv_pkt);
 		zassert_equal(ret, 0, "Cannot receive data (%d)", ret);
 		k_sleep(K_MSEC(10));
@@ -596,7 +610,7 @@ static void *test_setup(void)
 	return NULL;
 }
 
-ZTEST(net_ipv4_fragment, test_udp)
+static void send_udp_fragments(void)
 {
 	struct net_pkt *pkt;
 	int ret;
@@ -662,6 +676,17 @@ ZTEST(net_ipv4_fragment, test_udp)
 		      "Packet size mismatch");
 }
 
+ZTEST(net_ipv4_fragment, test_udp)
+{
+	send_udp_fragments();
+}
+
+ZTEST(net_ipv4_fragment, test_udp_duplicate_fragments)
+{
+	duplicate_fragments = true;
+	send_udp_fragments();
+}
+
 ZTEST(net_ipv4_fragment, test_tcp)
 {
 	struct net_pkt *pkt;
@@ -884,6 +909,7 @@ static void test_pre(void *ptr)
 	lower_layer_total_size = 0;
 	upper_layer_total_size = 0;
 	last_packet_received = false;
+	duplicate_fragments = false;
 	test_started = false;
 	pkt_id = 0;
 	pkt_recv_size = 0;
@@ -935,3 +935,125 @@ ZTEST(coap_client, test_non_confirmable)
 	/* No callbacks from non-confirmable */
 	zassert_not_ok(k_sem_take(&sem1, K_MSEC(MORE_THAN_EXCHANGE_LIFETIME_MS)));
 }
+
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+static struct {
+	uint16_t mid;
+	uint8_t tkl;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint32_t block_num;
+} block2_requests[CONFIG_COAP_CLIENT_MAX_REQUESTS];
+static int block2_num_requests;
+static int block2_max_requests;
+static uint8_t block2_received[sizeof(long_payload)];
+static size_t block2_received_len;
+
+static ssize_t z_impl_zsock_sendto_custom_fake_block2(int sock, void *buf, size_t len, int flags,
+						      const struct sockaddr *dest_addr,
+						      socklen_t addrlen)
+{
+	struct coap_packet request;
+	uint16_t mid;
+	int block;
+
+	zassert_ok(coap_packet_parse(&request, buf, len, NULL, 0));
+	zassert_equal(coap_header_get_type(&request), COAP_TYPE_CON);
+
+	mid = coap_header_get_id(&request);
+	for (int i = 0; i < block2_num_requests; i++) {
+		if (block2_requests[i].mid == mid) {
+			/* Retransmission */
+			return len;
+		}
+	}
+
+	zassert_true(block2_num_requests < ARRAY_SIZE(block2_requests));
+	block = coap_get_option_int(&request, COAP_OPTION_BLOCK2);
+	block2_requests[block2_num_requests].mid = mid;
+	block2_requests[block2_num_requests].tkl =
+		coap_header_get_token(&request, block2_requests[block2_num_requests].token);
+	block2_requests[block2_num_requests].block_num = block < 0 ? 0 : GET_BLOCK_NUM(block);
+	block2_num_requests++;
+	block2_max_requests = MAX(block2_max_requests, block2_num_requests);
+
+	set_socket_events(sock, ZSOCK_POLLIN);
+
+	return len;
+}
+
+static ssize_t z_impl_zsock_recvfrom_custom_fake_block2(int sock, void *buf, size_t max_len,
+							int flags, struct sockaddr *src_addr,
+							socklen_t *addrlen)
+{
+	struct coap_block_context ctx;
+	struct coap_packet response;
+	uint16_t block_len;
+	int i;
+
+	zassert_true(block2_num_requests > 0);
+
+	/* Answer the latest request first, so that the blocks come out of order */
+	i = --block2_num_requests;
+	if (block2_num_requests == 0) {
+		clear_socket_events(sock, ZSOCK_POLLIN);
+	}
+
+	coap_block_transfer_init(&ctx, COAP_BLOCK_64, sizeof(long_payload) - 1);
+	ctx.current = block2_requests[i].block_num * 64;
+	block_len = MIN(64, ctx.total_size - ctx.current);
+
+	zassert_ok(coap_packet_init(&response, buf, max_len, COAP_VERSION_1, COAP_TYPE_ACK,
+				    block2_requests[i].tkl, block2_requests[i].token,
+				    COAP_RESPONSE_CODE_CONTENT, block2_requests[i].mid));
+	zassert_ok(coap_append_block2_option(&response, &ctx));
+	zassert_ok(coap_append_size2_option(&response, &ctx));
+	zassert_ok(coap_packet_append_payload_marker(&response));
+	zassert_ok(coap_packet_append_payload(&response, long_payload + ctx.current, block_len));
+
+	return response.offset;
+}
+
+static void coap_callback_block2(int16_t code, size_t offset, const uint8_t *payload, size_t len,
+				 bool last_block, void *user_data)
+{
+	zassert_equal(code, COAP_RESPONSE_CODE_CONTENT, "Unexpected response %d", code);
+	zassert_equal(offset, block2_received_len, "Block out of order");
+	zassert_true(offset + len <= sizeof(block2_received));
+
+	memcpy(block2_received + offset, payload, len);
+	block2_received_len += len;
+
+	if (last_block) {
+		k_sem_give((struct k_sem *)user_data);
+	}
+}
+#endif
+
+ZTEST(coap_client, test_block2_window)
+{
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	struct coap_client_request req = {
+		.method = COAP_METHOD_GET,
+		.confirmable = true,
+		.path = test_path,
+		.cb = coap_callback_block2,
+		.user_data = &sem1,
+	};
+
+	block2_num_requests = 0;
+	block2_max_requests = 0;
+	block2_received_len = 0;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_custom_fake_block2;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_custom_fake_block2;
+
+	zassert_ok(coap_client_req(&client, 0, &dst_address, &req, NULL));
+	zassert_ok(k_sem_take(&sem1, K_MSEC(MORE_THAN_EXCHANGE_LIFETIME_MS)));
+
+	zassert_equal(block2_received_len, sizeof(long_payload) - 1);
+	zassert_mem_equal(block2_received, long_payload, block2_received_len);
+	zassert_equal(block2_max_requests, CONFIG_COAP_CLIENT_BLOCK2_WINDOW,
+		      "Blocks were not requested in parallel");
+#else
+	ztest_test_skip();
+#endif
+}
@@ -421,6 +421,52 @@ ZTEST(http_service, test_HTTP_RESOURCE_DEFAULT)
 	zassert_equal(res, RES(0), "Resource mismatch");
 }
 
+extern void http_server_etag_store(struct http_client_ctx *client, const char *value,
+				   size_t len);
+extern bool http_server_etag_match(struct http_client_ctx *client, const char *etag);
+
+ZTEST(http_service, test_HTTP_SERVER_ETAG)
+{
+	static struct http_client_ctx client;
+	const char *etag = "\"v1\"";
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_HTTP_SERVER_ETAG);
+
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+#define STORE(_value) http_server_etag_store(&client, _value, strlen(_value))
+
+	STORE("");
+	zassert_false(http_server_etag_match(&client, etag));
+
+	STORE("\"v1\"");
+	zassert_true(http_server_etag_match(&client, etag));
+	zassert_false(http_server_etag_match(&client, NULL));
+	zassert_false(http_server_etag_match(&client, "\"v11\""));
+
+	STORE("W/\"v1\"");
+	zassert_true(http_server_etag_match(&client, etag));
+	zassert_true(http_server_etag_match(&client, "W/\"v1\""));
+
+	STORE("\"v0\", \"a,b\" ,\"v1\"");
+	zassert_true(http_server_etag_match(&client, etag));
+	zassert_true(http_server_etag_match(&client, "\"a,b\""));
+	zassert_false(http_server_etag_match(&client, "\"v2\""));
+
+	STORE("\"v1");
+	zassert_false(http_server_etag_match(&client, etag));
+
+	STORE("*");
+	zassert_true(http_server_etag_match(&client, etag));
+
+	/* Too long values are dropped */
+	memset(client.if_none_match, 'a', sizeof(client.if_none_match));
+	http_server_etag_store(&client, client.if_none_match, sizeof(client.if_none_match));
+	zassert_equal(client.if_none_match[0], '\0');
+
+#undef STORE
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+}
+
 extern void http_server_get_content_type_from_extension(char *url, char *content_type,
 							size_t content_type_size);
 
@@ -480,4 +526,18 @@ ZTEST(http_service, test_HTTP_SERVER_CONTENT_TYPE)
 	zassert_str_equal(content_type, "video/mpeg");
 }
 
-ZTEST_SUITE(http_service, NULL, NULL, NULL, NULL, NULL);
+#if CONFIG_HTTP_SERVER_RESOURCE_INDEX_SIZE > 0
+extern void http_server_resource_index_build(void);
+
+static void *http_service_setup(void)
+{
+	/* Normally done when the server starts */
+	http_server_resource_index_build();
+
+	return NULL;
+}
+#else
+#define http_service_setup NULL
+#endif
+
+ZTEST_SUITE(http_service, NULL, http_service_setup, NULL, NULL, NULL);
@@ -722,6 +722,9 @@ static void expect_http2_window_update_frame(size_t *offset, int stream_id)
 
 ZTEST(server_function_tests, test_http2_get_concurrent_streams)
 {
+	/* The order of the frames of the two streams depends on the scheduling */
+	Z_TEST_SKIP_IFDEF(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL);
+
 	static const uint8_t request_get_2_streams[] = {
 		TEST_HTTP2_MAGIC,
 		TEST_HTTP2_SETTINGS,
@@ -777,6 +780,49 @@ ZTEST(server_function_tests, test_http2_static_get)
 				HTTP2_FLAG_END_STREAM);
 }
 
+ZTEST(server_function_tests, test_http2_static_get_flow_control)
+{
+	static const uint8_t request_get_static_small_window[] = {
+		TEST_HTTP2_MAGIC,
+		/* Initial window size of 5 bytes */
+		0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+		TEST_HTTP2_SETTINGS_ACK,
+		TEST_HTTP2_HEADERS_GET_ROOT_STREAM_1,
+	};
+	static const uint8_t request_window_update[] = {
+		0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, TEST_STREAM_ID_1,
+		0x00, 0x00, 0x00, 0x64,
+	};
+	static const uint8_t request_goaway[] = {
+		TEST_HTTP2_GOAWAY,
+	};
+	size_t offset = 0;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL);
+
+	ret = zsock_send(client_fd, request_get_static_small_window,
+			 sizeof(request_get_static_small_window), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	memset(buf, 0, sizeof(buf));
+
+	expect_http2_settings_frame(&offset, false);
+	expect_http2_settings_frame(&offset, true);
+	expect_http2_headers_frame(&offset, TEST_STREAM_ID_1, HTTP2_FLAG_END_HEADERS, NULL, 0);
+	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, TEST_STATIC_PAYLOAD, 5, 0);
+
+	ret = zsock_send(client_fd, request_window_update, sizeof(request_window_update), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, &TEST_STATIC_PAYLOAD[5],
+				strlen(TEST_STATIC_PAYLOAD) - 5, HTTP2_FLAG_END_STREAM);
+
+	ret = zsock_send(client_fd, request_goaway, sizeof(request_goaway), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+}
+
 ZTEST(server_function_tests, test_http1_static_upgrade_get)
 {
 	static const char http1_request[] =
@@ -494,4 +494,87 @@ ZTEST(http2_hpack, test_http2_hpack_literal_not_indexed_decode)
 				 ARRAY_SIZE(test_enc_literal_not_indexed_headers));
 }
 
+/* Requests of RFC7541 C.4, encoded on the same connection */
+static const struct example_headers test_enc_dynamic_headers[] = {
+	{ ":method", "GET", { 0x82 }, 1 },
+	{ ":scheme", "http", { 0x86 }, 1 },
+	{ ":path", "/", { 0x84 }, 1 },
+	{ ":authority", "www.example.com",
+	  { 0x41, 0x8c, 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a,
+	    0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff },
+	  14 },
+	{ ":method", "GET", { 0x82 }, 1 },
+	{ ":scheme", "http", { 0x86 }, 1 },
+	{ ":path", "/", { 0x84 }, 1 },
+	{ ":authority", "www.example.com", { 0xbe }, 1 },
+	{ "cache-control", "no-cache",
+	  { 0x58, 0x86, 0xa8, 0xeb, 0x10, 0x64, 0x9c, 0xbf },
+	  8 },
+	{ ":method", "GET", { 0x82 }, 1 },
+	{ ":scheme", "https", { 0x87 }, 1 },
+	{ ":path", "/index.html", { 0x85 }, 1 },
+	{ ":authority", "www.example.com", { 0xbf }, 1 },
+	{ "custom-key", "custom-value",
+	  { 0x40, 0x88, 0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xa9,
+	    0x7d, 0x7f, 0x89, 0x25, 0xa8, 0x49, 0xe9, 0x5b,
+	    0xb8, 0xe8, 0xb4, 0xbf },
+	  20 },
+};
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_encode)
+{
+#if HTTP_SERVER_HPACK_ENCODER_TABLE_SIZE >= 256
+	static struct http_hpack_encoder encoder;
+	const struct example_headers *example = test_enc_dynamic_headers;
+	struct http_hpack_header_buf hdr = {
+		.name = "custom-key",
+		.value = "custom-value",
+		.name_len = strlen("custom-key"),
+		.value_len = strlen("custom-value"),
+	};
+	int ret;
+
+	http_hpack_encoder_init(&encoder);
+
+	for (int i = 0; i < ARRAY_SIZE(test_enc_dynamic_headers); i++) {
+		struct http_hpack_header_buf example_hdr = {
+			.name = example[i].name,
+			.value = example[i].value,
+			.name_len = strlen(example[i].name),
+			.value_len = strlen(example[i].value)
+		};
+
+		ret = http_hpack_encoder_encode_header(&encoder, test_buf, sizeof(test_buf),
+						       &example_hdr);
+		zassert_equal(ret, example[i].encoded_len, "Wrong encoding length");
+		zassert_mem_equal(test_buf, example[i].encoded, ret,
+				  "Header wrongly encoded");
+	}
+
+	/* Newest entry */
+	ret = http_hpack_encoder_encode_header(&encoder, test_buf, sizeof(test_buf), &hdr);
+	zassert_equal(ret, 1, "Wrong encoding length");
+	zassert_equal(test_buf[0], 0xbe, "Header wrongly encoded");
+
+	/* Shrinking the table evicts the entries and is signaled once */
+	http_hpack_encoder_set_max_size(&encoder, 0);
+	ret = http_hpack_encoder_encode_header(&encoder, test_buf, sizeof(test_buf), &hdr);
+	zassert_equal(ret, 1 + example[ARRAY_SIZE(test_enc_dynamic_headers) - 1].encoded_len,
+		      "Wrong encoding length");
+	zassert_equal(test_buf[0], 0x20, "Missing dynamic table size update");
+	zassert_mem_equal(&test_buf[1], test_enc_literal_not_indexed_headers[0].encoded,
+			  ret - 1, "Header wrongly encoded");
+
+	/* Clearing the table is signaled with two size updates */
+	http_hpack_encoder_set_max_size(&encoder, 256);
+	http_hpack_encoder_reset(&encoder);
+	ret = http_hpack_encoder_encode_header(&encoder, test_buf, sizeof(test_buf), &hdr);
+	zassert_true(ret > 4, "Wrong encoding length");
+	zassert_mem_equal(test_buf, ((uint8_t []){ 0x20, 0x3f, 0xe1, 0x01, 0x40 }), 5,
+			  "Missing dynamic table size updates");
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(http2_hpack, NULL, NULL, NULL, NULL, NULL);
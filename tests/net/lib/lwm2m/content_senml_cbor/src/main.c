@@ -955,6 +955,24 @@ ZTEST(net_content_senml_cbor_nomem, test_put_time_nomem)
 	zassert_equal(ret, -ENOMEM, "Invalid error code returned");
 }
 
+ZTEST(net_content_senml_cbor, test_put_obj_inst)
+{
+	int ret;
+
+	/* One record per resource, streamed regardless of the decoder record limit */
+	test_msg.path.level = LWM2M_PATH_LEVEL_OBJECT_INST;
+
+	ret = do_read_op_senml_cbor(&test_msg);
+	zassert_true(ret >= 0, "Error reported");
+
+	zassert_equal(test_msg.msg_data[TEST_PAYLOAD_OFFSET], (0x04 << 5) | TEST_OBJ_RES_MAX_ID,
+		      "Invalid record count");
+	zassert_equal(test_msg.msg_data[TEST_PAYLOAD_OFFSET + 1], (0x05 << 5) | 3,
+		      "Invalid first record");
+	zassert_true(test_msg.cpkt.offset > TEST_PAYLOAD_OFFSET + TEST_OBJ_RES_MAX_ID,
+		     "Invalid packet offset");
+}
+
 ZTEST(net_content_senml_cbor, test_get_s32)
 {
 	int ret;
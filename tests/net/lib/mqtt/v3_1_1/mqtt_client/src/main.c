@@ -768,6 +768,59 @@ ZTEST(mqtt_client, test_mqtt_publish_qos2)
 	test_disconnect();
 }
 
+ZTEST(mqtt_client, test_mqtt_publish_inflight_window)
+{
+	struct mqtt_publish_param param = { 0 };
+	int ret;
+
+#if !defined(CONFIG_MQTT_INFLIGHT) || CONFIG_MQTT_INFLIGHT_WINDOW != 1
+	ztest_test_skip();
+#endif
+
+	test_ctx.payload = payload_short;
+	test_ctx.payload_left = strlen(test_ctx.payload);
+	test_ctx.msg_id = 1U;
+
+	param.message.topic.qos = MQTT_QOS_1_AT_LEAST_ONCE;
+	param.message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
+	param.message.topic.topic.size =
+			strlen(param.message.topic.topic.utf8);
+	param.message.payload.data = (uint8_t *)test_ctx.payload;
+	param.message.payload.len = test_ctx.payload_left;
+
+	test_connect();
+
+	/* The scenario limits the window to a single publication. */
+	param.message_id = test_ctx.msg_id;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	param.message_id = test_ctx.msg_id + 1U;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_equal(ret, -ENOBUFS, "In-flight window should be full (%d)", ret);
+
+	/* Once acknowledged, the publication leaves room in the window. */
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	client_wait(false);
+	ret = mqtt_input(&client_ctx);
+	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+
+	test_ctx.puback_handled = false;
+	test_ctx.msg_id = param.message_id;
+
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	client_wait(false);
+	ret = mqtt_input(&client_ctx);
+	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+
+	test_disconnect();
+}
+
 ZTEST(mqtt_client, test_mqtt_subscribe)
 {
 	test_connect();
@@ -12,8 +12,33 @@
 PROMETHEUS_COUNTER_DEFINE(test_counter_m, "Test counter",
 			  ({ .key = "test_counter", .value = "test" }), NULL);
 
+PROMETHEUS_COUNTER_DEFINE(walk_counter_a, "Walk counter A",
+			  ({ .key = "walk", .value = "a" }), NULL);
+
+PROMETHEUS_COUNTER_DEFINE(walk_counter_b, "Walk counter B",
+			  ({ .key = "walk", .value = "b" }), NULL);
+
 PROMETHEUS_COLLECTOR_DEFINE(test_custom_collector);
 
+PROMETHEUS_COLLECTOR_DEFINE(test_walk_collector);
+
+#define WALK_A_TEXT "# HELP walk_counter_a Walk counter A\n" \
+		    "# TYPE walk_counter_a counter\n" \
+		    "walk_counter_a{walk=\"a\"} 0\n"
+
+#define WALK_B_TEXT "# HELP walk_counter_b Walk counter B\n" \
+		    "# TYPE walk_counter_b counter\n" \
+		    "walk_counter_b{walk=\"b\"} 0\n"
+
+#define WALK_BUFFER_SIZE 256
+
+static void walk_register(void)
+{
+	/* Metrics are prepended, so b is walked first */
+	prometheus_collector_register_metric(&test_walk_collector, &walk_counter_a.base);
+	prometheus_collector_register_metric(&test_walk_collector, &walk_counter_b.base);
+}
+
 /**
  * @brief Test prometheus_counter_inc
  *
@@ -45,4 +70,88 @@ ZTEST(test_collector, test_prometheus_collector_register)
 	zassert_equal(counter->value, 1, "Counter value is not 1");
 }
 
+/**
+ * @brief Test packing metrics in one walk call
+ *
+ * @details The test shall walk a collector into a buffer large enough for
+ * all its metrics and check that a single call returns 0 together with all
+ * the metrics, starting with the first one.
+ */
+ZTEST(test_collector, test_prometheus_collector_walk_pack)
+{
+	struct prometheus_collector_walk_context ctx;
+	char buffer[WALK_BUFFER_SIZE];
+	int ret;
+
+	walk_register();
+
+	ret = prometheus_collector_walk_init(&ctx, &test_walk_collector);
+	zassert_ok(ret, "Error initializing walk context");
+
+	ret = prometheus_collector_walk_metrics(&ctx, (uint8_t *)buffer, sizeof(buffer));
+	zassert_ok(ret, "Expected the walk to end in one call (%d)", ret);
+
+	zassert_str_equal(buffer, WALK_B_TEXT WALK_A_TEXT,
+			  "Unexpected walk output \"%s\"", buffer);
+}
+
+/**
+ * @brief Test resuming the walk with a metric that does not fit
+ *
+ * @details The test shall walk a collector into a buffer with room for the
+ * first metric only and check that the second metric is kept for the next
+ * call instead of being truncated.
+ */
+ZTEST(test_collector, test_prometheus_collector_walk_resume)
+{
+	struct prometheus_collector_walk_context ctx;
+	char buffer[WALK_BUFFER_SIZE];
+	size_t buffer_size = sizeof(WALK_B_TEXT) + sizeof(WALK_A_TEXT) / 2;
+	int ret;
+
+	walk_register();
+
+	ret = prometheus_collector_walk_init(&ctx, &test_walk_collector);
+	zassert_ok(ret, "Error initializing walk context");
+
+	ret = prometheus_collector_walk_metrics(&ctx, (uint8_t *)buffer, buffer_size);
+	zassert_equal(ret, -EAGAIN, "Expected the walk to continue (%d)", ret);
+	zassert_str_equal(buffer, WALK_B_TEXT, "Unexpected walk output \"%s\"", buffer);
+
+	ret = prometheus_collector_walk_metrics(&ctx, (uint8_t *)buffer, buffer_size);
+	zassert_ok(ret, "Expected the walk to end (%d)", ret);
+	zassert_str_equal(buffer, WALK_A_TEXT, "Unexpected walk output \"%s\"", buffer);
+}
+
+/**
+ * @brief Test walking into a buffer smaller than a metric
+ *
+ * @details The test shall check that a metric which does not fit in an
+ * empty buffer is reported as an error and that the collector can be
+ * walked again afterwards.
+ */
+ZTEST(test_collector, test_prometheus_collector_walk_too_small)
+{
+	struct prometheus_collector_walk_context ctx;
+	char buffer[WALK_BUFFER_SIZE];
+	int ret;
+
+	walk_register();
+
+	ret = prometheus_collector_walk_init(&ctx, &test_walk_collector);
+	zassert_ok(ret, "Error initializing walk context");
+
+	ret = prometheus_collector_walk_metrics(&ctx, (uint8_t *)buffer, sizeof(WALK_B_TEXT) / 2);
+	zassert_equal(ret, -ENOMEM, "Expected the metric not to fit (%d)", ret);
+
+	/* The collector lock has been released */
+	ret = prometheus_collector_walk_init(&ctx, &test_walk_collector);
+	zassert_ok(ret, "Error initializing walk context");
+
+	ret = prometheus_collector_walk_metrics(&ctx, (uint8_t *)buffer, sizeof(buffer));
+	zassert_ok(ret, "Expected the walk to end in one call (%d)", ret);
+	zassert_str_equal(buffer, WALK_B_TEXT WALK_A_TEXT,
+			  "Unexpected walk output \"%s\"", buffer);
+}
+
 ZTEST_SUITE(test_collector, NULL, NULL, NULL, NULL, NULL);
@@ -1291,4 +1291,65 @@ ZTEST(net_pkt_test_suite, test_net_pkt_shallow_clone_append_buf_2)
 	test_net_pkt_shallow_clone_append_buf(2);
 }
 
+#if defined(CONFIG_NET_PKT_RX_CACHE)
+ZTEST(net_pkt_test_suite, test_net_pkt_rx_cache)
+{
+	struct net_pkt *pkts[CONFIG_NET_PKT_RX_CACHE_SIZE + 1];
+	struct k_mem_slab *rx;
+	uint32_t free_count;
+	struct net_pkt *pkt;
+	int count = 0;
+
+	net_pkt_get_info(&rx, NULL, NULL, NULL);
+
+	/* The cache of this thread is refilled in bulk once empty */
+	while (count < ARRAY_SIZE(pkts)) {
+		free_count = k_mem_slab_num_free_get(rx);
+
+		pkts[count] = net_pkt_rx_alloc_with_buffer(eth_if, 64, AF_UNSPEC,
+							   0, K_NO_WAIT);
+		zassert_not_null(pkts[count], "Pkt not allocated");
+
+		if (free_count - k_mem_slab_num_free_get(rx) ==
+		    CONFIG_NET_PKT_RX_CACHE_SIZE) {
+			count++;
+			break;
+		}
+
+		count++;
+	}
+
+	zassert_equal(free_count - k_mem_slab_num_free_get(rx),
+		      CONFIG_NET_PKT_RX_CACHE_SIZE, "Cache not refilled");
+
+	while (count > 0) {
+		net_pkt_unref(pkts[--count]);
+	}
+
+	/**TESTPOINT: allocations served by the cache */
+	free_count = k_mem_slab_num_free_get(rx);
+
+	pkt = net_pkt_rx_alloc_with_buffer(eth_if, 64, AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Pkt not allocated");
+	zassert_equal(k_mem_slab_num_free_get(rx), free_count,
+		      "Pkt not allocated from the cache");
+	zassert_equal(net_pkt_available_buffer(pkt), 64, "Wrong buffer size");
+	net_pkt_unref(pkt);
+
+	if (CONFIG_NET_PKT_RX_CACHE_SIZE > 2) {
+		size_t size = CONFIG_NET_BUF_DATA_SIZE * 2 + 10;
+
+		free_count = k_mem_slab_num_free_get(rx);
+
+		pkt = net_pkt_rx_alloc_with_buffer(eth_if, size, AF_UNSPEC, 0,
+						   K_NO_WAIT);
+		zassert_not_null(pkt, "Pkt not allocated");
+		zassert_equal(k_mem_slab_num_free_get(rx), free_count,
+			      "Pkt not allocated from the cache");
+		zassert_equal(net_pkt_available_buffer(pkt), size, "Wrong buffer size");
+		net_pkt_unref(pkt);
+	}
+}
+#endif /* CONFIG_NET_PKT_RX_CACHE */
+
 ZTEST_SUITE(net_pkt_test_suite, NULL, NULL, NULL, NULL, NULL);
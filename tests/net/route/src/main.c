@@ -544,6 +544,60 @@ static void test_route_preference(void)
 	net_route_del(route_entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct net_route_entry *entry_48, *entry_64, *entry_128;
+	struct in6_addr addr;
+
+	entry_48 = net_route_add(my_iface, &dest_addr, 48, &peer_addr,
+				 NET_IPV6_ND_INFINITE_LIFETIME,
+				 NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(entry_48, "Route /48 add failed");
+
+	entry_64 = net_route_add(my_iface, &dest_addr, 64, &peer_addr,
+				 NET_IPV6_ND_INFINITE_LIFETIME,
+				 NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(entry_64, "Route /64 add failed");
+	zassert_not_equal(entry_64, entry_48, "Route /64 replaced /48");
+
+	entry_128 = net_route_add(my_iface, &dest_addr, 128, &peer_addr,
+				  NET_IPV6_ND_INFINITE_LIFETIME,
+				  NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(entry_128, "Route /128 add failed");
+	zassert_not_equal(entry_128, entry_64, "Route /128 replaced /64");
+
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), entry_128,
+			  "Route /128 not found");
+
+	net_ipaddr_copy(&addr, &dest_addr);
+	addr.s6_addr[15] ^= 0x01;
+	zassert_equal_ptr(net_route_lookup(my_iface, &addr), entry_64,
+			  "Route /64 not found");
+	zassert_equal_ptr(net_route_lookup(NULL, &addr), entry_64,
+			  "Route /64 not found on any interface");
+
+	addr.s6_addr[7] ^= 0x01;
+	zassert_equal_ptr(net_route_lookup(my_iface, &addr), entry_48,
+			  "Route /48 not found");
+
+	addr.s6_addr[5] ^= 0x01;
+	zassert_is_null(net_route_lookup(my_iface, &addr),
+			"Route found outside of /48");
+
+	/* Removing a route makes the next shorter prefix to match */
+	zassert_false(net_route_del(entry_128), "Route /128 del failed");
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), entry_64,
+			  "Route /64 not found after /128 removal");
+
+	zassert_false(net_route_del(entry_64), "Route /64 del failed");
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), entry_48,
+			  "Route /48 not found after /64 removal");
+
+	zassert_false(net_route_del(entry_48), "Route /48 del failed");
+	zassert_is_null(net_route_lookup(my_iface, &dest_addr),
+			"Route found after removal");
+}
+
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +620,7 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 
 #include <zephyr/net/socket.h>
 #include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
 
 #include "../../socket_helpers.h"
 
@@ -248,4 +249,97 @@ ZTEST(net_socket_poll, test_pollout_tcp)
 	zassert_equal(res, 0, "close failed");
 }
 
+ZTEST(net_socket_poll, test_epoll)
+{
+	int res;
+	int epfd;
+	int c_sock;
+	int s_sock;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct zvfs_epoll_event event;
+	struct zvfs_epoll_event ready[2];
+	uint32_t tstamp;
+	ssize_t len;
+	char buf[10];
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = zsock_bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = zsock_connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	epfd = zvfs_epoll_create();
+	zassert_true(epfd >= 0, "epoll create failed");
+
+	event.events = ZSOCK_POLLIN;
+	event.data.fd = c_sock;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, c_sock, &event));
+	event.data.fd = s_sock;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, s_sock, &event));
+
+	res = zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, s_sock, &event);
+	zassert_equal(res, -1, "socket added twice");
+	zassert_equal(errno, EEXIST, "");
+
+	/* Wait for non-ready fd's with timeout of 30 */
+	tstamp = k_uptime_get_32();
+	res = zvfs_epoll_wait(epfd, ready, ARRAY_SIZE(ready), 30);
+	tstamp = k_uptime_get_32() - tstamp;
+	zassert_true(tstamp >= 30U && tstamp <= 30 + FUZZ * 2, "tstamp %d",
+		     tstamp);
+	zassert_equal(res, 0, "");
+
+	/* Only the ready fd is returned */
+	len = zsock_send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = zvfs_epoll_wait(epfd, ready, ARRAY_SIZE(ready), 30);
+	zassert_equal(res, 1, "");
+	zassert_equal(ready[0].events, ZSOCK_POLLIN, "");
+	zassert_equal(ready[0].data.fd, s_sock, "");
+
+	/* The data has not been read, the fd is reported again */
+	res = zvfs_epoll_wait(epfd, ready, ARRAY_SIZE(ready), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(ready[0].events, ZSOCK_POLLIN, "");
+	zassert_equal(ready[0].data.fd, s_sock, "");
+
+	/* A removed fd is not reported anymore */
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, s_sock, NULL));
+
+	res = zvfs_epoll_wait(epfd, ready, ARRAY_SIZE(ready), 0);
+	zassert_equal(res, 0, "");
+
+	len = zsock_recv(s_sock, BUF_AND_SIZE(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+
+	/* Modified events are taken into account, UDP POLLOUT is ready */
+	event.events = ZSOCK_POLLOUT;
+	event.data.fd = c_sock;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, c_sock, &event));
+
+	res = zvfs_epoll_wait(epfd, ready, ARRAY_SIZE(ready), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(ready[0].events, ZSOCK_POLLOUT, "");
+	zassert_equal(ready[0].data.fd, c_sock, "");
+
+	/* Close the remaining socket and ensure POLLNVAL happens */
+	res = zsock_close(c_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zvfs_epoll_wait(epfd, ready, ARRAY_SIZE(ready), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(ready[0].events, ZSOCK_POLLNVAL, "");
+
+	res = zsock_close(epfd);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_close(s_sock);
+	zassert_equal(res, 0, "close failed");
+}
+
 ZTEST_SUITE(net_socket_poll, NULL, NULL, NULL, NULL, NULL);
@@ -801,6 +801,98 @@ ZTEST(net_socket_tls, test_v6_dtls_sendmsg)
 	test_dtls_sendmsg(AF_INET6);
 }
 
+static void test_tls_sendmsg(sa_family_t family)
+{
+	int rv;
+	uint8_t buf[CONFIG_NET_SOCKETS_TLS_SENDMSG_BUF_SIZE + 1] = { 0 };
+	uint8_t rx_buf[sizeof(buf) + 1];
+	uint8_t last_byte = 'b';
+	static const char expected_str[] = "testtest";
+	struct iovec iov[3] = {
+		{
+			.iov_base = TEST_STR_SMALL,
+			.iov_len = sizeof(TEST_STR_SMALL) - 1,
+		},
+		{},
+		{
+			.iov_base = TEST_STR_SMALL,
+			.iov_len = sizeof(TEST_STR_SMALL) - 1,
+		},
+	};
+	struct msghdr msg = {};
+	struct test_sendmsg_data test_data = {
+		.msg = &msg,
+	};
+
+	test_prepare_tls_connection(family);
+
+	test_data.sock = c_sock;
+	k_work_init_delayable(&test_data.tx_work, test_sendmsg_tx_work_handler);
+
+	/* sendmsg() with multiple fragments and empty fragment inbetween, the
+	 * data shall be sent in a single record, i.e. received by a single
+	 * recv() call.
+	 */
+
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 3;
+
+	test_work_reschedule(&test_data.tx_work, K_NO_WAIT);
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	rv = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(rv, sizeof(expected_str) - 1, "recv failed");
+	zassert_mem_equal(rx_buf, expected_str, sizeof(expected_str) - 1, "invalid rx data");
+
+	test_work_wait(&test_data.tx_work);
+
+	/* sendmsg() exceeding intermediate buf size, the data is split into
+	 * several records.
+	 */
+
+	memset(buf, 'a', sizeof(buf));
+	iov[0].iov_base = buf;
+	iov[0].iov_len = sizeof(buf);
+	iov[1].iov_base = &last_byte;
+	iov[1].iov_len = sizeof(last_byte);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 2;
+
+	test_work_reschedule(&test_data.tx_work, K_NO_WAIT);
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	rv = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_WAITALL);
+	zassert_equal(rv, sizeof(rx_buf), "recv failed");
+	for (int i = 0; i < sizeof(buf); i++) {
+		zassert_equal(rx_buf[i], 'a', "invalid rx data");
+	}
+	zassert_equal(rx_buf[sizeof(buf)], last_byte, "invalid rx data");
+
+	test_work_wait(&test_data.tx_work);
+
+	test_sockets_close();
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+ZTEST(net_socket_tls, test_v4_tls_sendmsg)
+{
+	if (CONFIG_NET_SOCKETS_TLS_SENDMSG_BUF_SIZE == 0) {
+		ztest_test_skip();
+	}
+
+	test_tls_sendmsg(AF_INET);
+}
+
+ZTEST(net_socket_tls, test_v6_tls_sendmsg)
+{
+	if (CONFIG_NET_SOCKETS_TLS_SENDMSG_BUF_SIZE == 0) {
+		ztest_test_skip();
+	}
+
+	test_tls_sendmsg(AF_INET6);
+}
+
 struct close_data {
 	struct k_work_delayable work;
 	int *fd;
@@ -3106,6 +3106,172 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+#define MMSG_COUNT 3
+
+static ZTEST_BMEM char mmsg_rx_buf[MMSG_COUNT + 1][16];
+
+ZTEST_USER(net_socket_udp, test_41_v4_sendmmsg_recvmmsg)
+{
+	static const char *const tx_str[MMSG_COUNT] = { "one", "three", "seven" };
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct iovec tx_iov[MMSG_COUNT];
+	struct iovec rx_iov[MMSG_COUNT + 1];
+	struct mmsghdr tx_msg[MMSG_COUNT];
+	struct mmsghdr rx_msg[MMSG_COUNT + 1];
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	memset(tx_msg, 0, sizeof(tx_msg));
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		tx_iov[i].iov_base = (void *)tx_str[i];
+		tx_iov[i].iov_len = strlen(tx_str[i]);
+		tx_msg[i].msg_hdr.msg_iov = &tx_iov[i];
+		tx_msg[i].msg_hdr.msg_iovlen = 1;
+		tx_msg[i].msg_hdr.msg_name = &server_addr;
+		tx_msg[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = zsock_sendmmsg(client_sock, tx_msg, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed");
+
+	memset(rx_msg, 0, sizeof(rx_msg));
+	for (int i = 0; i < MMSG_COUNT + 1; i++) {
+		rx_iov[i].iov_base = mmsg_rx_buf[i];
+		rx_iov[i].iov_len = sizeof(mmsg_rx_buf[i]);
+		rx_msg[i].msg_hdr.msg_iov = &rx_iov[i];
+		rx_msg[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	/**TESTPOINT: only the queued datagrams are returned */
+	rv = zsock_recvmmsg(server_sock, rx_msg, MMSG_COUNT + 1, 0);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed");
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(rx_msg[i].msg_len, strlen(tx_str[i]), "wrong length");
+		zassert_mem_equal(mmsg_rx_buf[i], tx_str[i], strlen(tx_str[i]),
+				  "wrong data");
+	}
+
+	rv = zsock_recvmmsg(server_sock, rx_msg, MMSG_COUNT, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recvmmsg succeeded");
+	zassert_equal(errno, EAGAIN, "incorrect errno value");
+
+	/**TESTPOINT: a failure of the second message ends the batch */
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		tx_msg[i].msg_len = 0;
+	}
+
+	tx_msg[1].msg_hdr.msg_namelen = sizeof(server_addr) - 1;
+
+	rv = zsock_sendmmsg(client_sock, tx_msg, MMSG_COUNT, 0);
+	zassert_equal(rv, 1, "sendmmsg did not stop at the second message");
+	zassert_equal(tx_msg[0].msg_len, strlen(tx_str[0]), "wrong length");
+	zassert_equal(tx_msg[1].msg_len, 0, "failed message has a length");
+	zassert_equal(tx_msg[2].msg_len, 0, "message after the failure sent");
+
+	/* The error is returned when passing the messages left */
+	rv = zsock_sendmmsg(client_sock, &tx_msg[1], MMSG_COUNT - 1, 0);
+	zassert_equal(rv, -1, "sendmmsg succeeded");
+	zassert_equal(errno, EINVAL, "incorrect errno value");
+
+	rv = zsock_recvmmsg(server_sock, rx_msg, MMSG_COUNT, 0);
+	zassert_equal(rv, 1, "recvmmsg failed");
+	zassert_equal(rx_msg[0].msg_len, strlen(tx_str[0]), "wrong length");
+	zassert_mem_equal(mmsg_rx_buf[0], tx_str[0], strlen(tx_str[0]),
+			  "wrong data");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+static size_t zc_check_payload(const struct msghdr *msg, const char *expected)
+{
+	size_t off = 0;
+
+	for (size_t i = 0; i < msg->msg_iovlen; i++) {
+		zassert_mem_equal(msg->msg_iov[i].iov_base, expected + off,
+				  msg->msg_iov[i].iov_len, "wrong data");
+		off += msg->msg_iov[i].iov_len;
+	}
+
+	return off;
+}
+
+ZTEST(net_socket_udp, test_42_v4_recvmsg_zerocopy)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in peer_addr;
+	struct iovec io_vector[8];
+	struct msghdr msg;
+	void *ref;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_sendto(client_sock, BUF_AND_SIZE(TEST_STR2), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendto failed");
+
+	/* Peeking references the datagram, which stays queued */
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	msg.msg_name = &peer_addr;
+	msg.msg_namelen = sizeof(peer_addr);
+
+	rv = zsock_recvmsg_zc(server_sock, &msg, ZSOCK_MSG_PEEK, &ref);
+	zassert_equal(rv, STRLEN(TEST_STR2), "recvmsg_zc failed");
+	zassert_true(msg.msg_iovlen > 1, "payload in a single buffer");
+	zassert_equal(zc_check_payload(&msg, TEST_STR2), STRLEN(TEST_STR2));
+	zassert_equal(msg.msg_namelen, sizeof(struct sockaddr_in), "wrong address length");
+	zassert_equal(peer_addr.sin_family, AF_INET, "wrong address family");
+	zsock_recv_zc_release(ref);
+
+	/* Fewer vectors than buffers truncate the datagram */
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 1;
+
+	rv = zsock_recvmsg_zc(server_sock, &msg, 0, &ref);
+	zassert_true(rv > 0 && rv < STRLEN(TEST_STR2), "recvmsg_zc failed");
+	zassert_equal(msg.msg_iovlen, 1, "wrong number of vectors");
+	zassert_true(msg.msg_flags & ZSOCK_MSG_TRUNC, "datagram not truncated");
+	zassert_equal(zc_check_payload(&msg, TEST_STR2), rv);
+	zsock_recv_zc_release(ref);
+
+	/* The datagram was consumed */
+	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	rv = zsock_recvmsg_zc(server_sock, &msg, ZSOCK_MSG_DONTWAIT, &ref);
+	zassert_equal(rv, -1, "recvmsg_zc succeeded");
+	zassert_equal(errno, EAGAIN, "incorrect errno value");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZEROCOPY */
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
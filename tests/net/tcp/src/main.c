@@ -20,6 +20,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/linker/sections.h>
 #include <zephyr/tc_util.h>
 
@@ -115,6 +116,7 @@ static enum test_case_no {
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
 	TEST_CLIENT_SEQ_VALIDATION = 19,
+	TEST_SERVER_SACK = 20,
 } test_case_no;
 
 static enum test_state t_state;
@@ -140,6 +142,7 @@ static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *t
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_seq_validation_test(sa_family_t af, struct tcphdr *th);
+static void handle_server_sack(struct net_pkt *pkt, struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -237,6 +240,49 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+#define SACK_TEST_MSS 100
+#define SACK_TEST_WIN 1000
+#define SACK_TEST_SEGS 5
+
+static uint8_t sack_syn_options[8] = {
+	0x02, 0x04, 0x00, SACK_TEST_MSS, /* Max segment */
+	0x01, 0x01, /* NOP */
+	0x04, 0x02, /* SACK */ };
+
+/* The peer offers SACK along with a small MSS and a real window, and sends
+ * peer_sack[] in its ACKs, relative to the first data byte of the device.
+ */
+static bool sack_peer;
+static struct tcp_sack_block peer_sack[NET_TCP_SACK_MAX_BLOCKS];
+static int peer_sack_len;
+static uint32_t sack_data_seq;
+
+static size_t sack_peer_options(uint8_t flags, uint8_t *opts)
+{
+	if (flags & SYN) {
+		memcpy(opts, sack_syn_options, sizeof(sack_syn_options));
+		return sizeof(sack_syn_options);
+	}
+
+	if (!(flags & ACK) || (flags & RST) || peer_sack_len == 0) {
+		return 0;
+	}
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+	opts[2] = NET_TCP_SACK_OPT;
+	opts[3] = 2 + peer_sack_len * NET_TCP_SACK_BLOCK_SIZE;
+
+	for (int i = 0; i < peer_sack_len; i++) {
+		uint8_t *block = &opts[4 + i * NET_TCP_SACK_BLOCK_SIZE];
+
+		sys_put_be32(sack_data_seq + peer_sack[i].start, block);
+		sys_put_be32(sack_data_seq + peer_sack[i].end, block + 4);
+	}
+
+	return 2 * NET_TCP_NOP_SIZE + opts[3];
+}
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -245,13 +291,20 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      size_t len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	uint8_t sack_opts[2 * NET_TCP_NOP_SIZE + 2 +
+			  NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+	const uint8_t *opts = NULL;
 	struct net_pkt *pkt;
 	struct tcphdr *th;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (sack_peer) {
+		opts = sack_opts;
+		opts_len = sack_peer_options(flags, sack_opts);
 	}
 
 	/* Allocate buffer */
@@ -286,14 +339,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
-
+	th->th_off = 5U + opts_len / 4U;
 	th->th_flags = flags;
-	th->th_win = NET_IPV6_MTU;
+	th->th_win = sack_peer ? htons(SACK_TEST_WIN) : NET_IPV6_MTU;
 	th->th_seq = htonl(seq);
 
 	if (ACK & flags) {
@@ -305,9 +353,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -489,6 +537,9 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_SEQ_VALIDATION:
 		handle_client_seq_validation_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_SERVER_SACK:
+		handle_server_sack(pkt, &th);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -717,6 +768,13 @@ static void handle_server_test(sa_family_t af, struct tcphdr *th)
 		break;
 	case T_SYN_ACK:
 		test_verify_flags(th, SYN | ACK);
+		if (IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+			/* MSS option, followed by SACK permitted if offered */
+			zassert_equal(th->th_off,
+				      (test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4 ||
+				       sack_peer) ? 7U : 6U,
+				      "Invalid SYN-ACK options length");
+		}
 		seq++;
 		ack = ntohl(th->th_seq) + 1U;
 		reply = prepare_ack_packet(af, htons(MY_PORT),
@@ -2086,8 +2144,8 @@ static struct out_of_order_check_struct out_of_order_check_list[] = {
 	{ 30, 10, 0, 0}, /* First packet will be out-of-order */
 	{ 20, 12, 0, 0},
 	{ 10,  9, 0, 0}, /* Section with a gap */
-	{ 0,  10, 10, 0},
-	{ 10, 10, 40, 0}, /* First sequence complete */
+	{ 0,  10, 19, 0}, /* Data up to the gap */
+	{ 19,  1, 40, 0}, /* First sequence complete */
 	{ 32,  6, 40, 0}, /* Invalid seqnum (old) */
 	{ 30, 16, 40, 0}, /* Partial data valid (not supported yet) */
 	{ 50,  6, 40, 0},
@@ -2182,9 +2240,6 @@ struct out_of_order_check_struct reorder_timeout_list[] = {
  */
 static void test_server_timeout_out_of_order_data(void)
 {
-	struct net_pkt *rst;
-	int ret;
-
 	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
 		return;
 	}
@@ -2194,6 +2249,54 @@ static void test_server_timeout_out_of_order_data(void)
 	checklist_based_out_of_order_test(reorder_timeout_list,
 					  ARRAY_SIZE(reorder_timeout_list),
 					  OUT_OF_ORDER_SEQ_INIT + 1);
+}
+
+#define OUT_OF_ORDER_LIMIT_BASE 90
+#define OUT_OF_ORDER_LIMIT MIN(CONFIG_NET_TCP_RECV_QUEUE_CONN_BUFS, \
+			       CONFIG_NET_BUF_RX_COUNT * \
+			       CONFIG_NET_TCP_RECV_QUEUE_TOTAL_PERCENT / 100)
+
+/* This test expects that the system is in correct state after a call to
+ * test_server_timeout_out_of_order_data(), so this test must be run after that
+ * test.
+ */
+static void test_server_limit_out_of_order_data(void)
+{
+	struct out_of_order_check_struct check = { 0 };
+	int i;
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		return;
+	}
+
+	k_sem_reset(&test_sem);
+
+	/* Queue one byte out of two, one more than the queue can hold */
+	for (i = 0; i <= OUT_OF_ORDER_LIMIT; i++) {
+		check.seq_offset = OUT_OF_ORDER_LIMIT_BASE + 2 * i + 1;
+		check.length = 1;
+		check.ack_offset = OUT_OF_ORDER_LIMIT_BASE;
+
+		checklist_based_out_of_order_test(&check, 1, OUT_OF_ORDER_SEQ_INIT + 1);
+	}
+
+	/* Fill the holes, the last byte queued has been dropped */
+	for (i = 0; i <= OUT_OF_ORDER_LIMIT; i++) {
+		check.seq_offset = OUT_OF_ORDER_LIMIT_BASE + 2 * i;
+		check.ack_offset = check.seq_offset + (i < OUT_OF_ORDER_LIMIT ? 2 : 1);
+
+		checklist_based_out_of_order_test(&check, 1, OUT_OF_ORDER_SEQ_INIT + 1);
+	}
+}
+
+static void test_server_close_out_of_order_data(void)
+{
+	struct net_pkt *rst;
+	int ret;
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		return;
+	}
 
 	/* Just send a RST packet to abort the underlying connection, so that
 	 * the testcase does not need to implement full TCP closing handshake.
@@ -2215,6 +2318,8 @@ ZTEST(net_tcp, test_server_out_of_order_data)
 {
 	test_server_recv_out_of_order_data();
 	test_server_timeout_out_of_order_data();
+	test_server_limit_out_of_order_data();
+	test_server_close_out_of_order_data();
 }
 
 static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th)
@@ -2856,4 +2961,489 @@ ZTEST(net_tcp, test_client_seq_validation)
 	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 }
 
+/* Segment sent by the device to the SACK peer */
+struct sack_segment {
+	uint32_t seq;
+	uint32_t ack;
+	uint16_t len;
+	uint8_t flags;
+	uint8_t sack_blocks;
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+};
+
+K_MSGQ_DEFINE(sack_segments, sizeof(struct sack_segment), 16, 4);
+
+static void handle_server_sack(struct net_pkt *pkt, struct tcphdr *th)
+{
+	struct sack_segment seg = {
+		.seq = ntohl(th->th_seq),
+		.ack = ntohl(th->th_ack),
+		.flags = th->th_flags,
+	};
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	size_t opts_len = th->th_off * 4U - sizeof(struct tcphdr);
+	uint8_t opts[40];
+	size_t i = 0;
+
+	seg.len = net_pkt_get_len(pkt) - hdr_len - th->th_off * 4U;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, hdr_len + sizeof(struct tcphdr)) < 0 ||
+	    net_pkt_read(pkt, opts, opts_len) < 0) {
+		zassert_true(false, "%s failed", __func__);
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	while (i < opts_len && opts[i] != NET_TCP_END_OPT) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (opts[i] == NET_TCP_SACK_OPT) {
+			seg.sack_blocks = (opts[i + 1] - 2) / NET_TCP_SACK_BLOCK_SIZE;
+
+			for (int j = 0; j < seg.sack_blocks; j++) {
+				uint8_t *block = &opts[i + 2 + j * NET_TCP_SACK_BLOCK_SIZE];
+
+				seg.sack[j].start = sys_get_be32(block);
+				seg.sack[j].end = sys_get_be32(block + 4);
+			}
+		}
+
+		i += opts[i + 1];
+	}
+
+	zassert_ok(k_msgq_put(&sack_segments, &seg, K_NO_WAIT), "Too many segments sent");
+}
+
+#if defined(CONFIG_NET_TCP_SACK) || defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+/* Sequence number of the first data byte of the peer */
+static uint32_t peer_data_seq;
+
+static struct net_context *sack_connect(void)
+{
+	struct net_context *ctx;
+
+	k_sem_reset(&test_sem);
+	k_msgq_purge(&sack_segments);
+	sack_peer = true;
+	peer_sack_len = 0;
+
+	ctx = create_server_socket(0, 0);
+
+	/* Where the handshake left the sequence numbers */
+	peer_data_seq = seq;
+	sack_data_seq = ack;
+
+	test_case_no = TEST_SERVER_SACK;
+
+	return ctx;
+}
+
+static void sack_close(struct net_context *ctx)
+{
+	struct net_pkt *rst;
+	int ret;
+
+	/* Abort the connection, see test_server_close_out_of_order_data() */
+	rst = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(rst, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+
+	sack_peer = false;
+	peer_sack_len = 0;
+}
+
+/* Send an ACK of the data of the device up to @p acked, along with the
+ * given SACK blocks.
+ */
+static void sack_peer_ack(uint32_t acked, const struct tcp_sack_block *blocks, int count)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	for (int i = 0; i < count; i++) {
+		peer_sack[i] = blocks[i];
+	}
+
+	peer_sack_len = count;
+	ack = sack_data_seq + acked;
+
+	pkt = prepare_ack_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	peer_sack_len = 0;
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the IP stack process the packet */
+	k_msleep(10);
+}
+
+/* Have the device send @p len bytes of data, from @p offset */
+static void sack_device_send(uint32_t offset, size_t len)
+{
+	int ret;
+
+	ret = net_context_send(accepted_ctx, lorem_ipsum + offset, len, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, len, "Failed to send data to peer (%d)", ret);
+}
+
+static void sack_expect_segment(uint32_t offset, uint16_t len)
+{
+	struct sack_segment seg;
+
+	zassert_ok(k_msgq_get(&sack_segments, &seg, K_MSEC(100)), "No segment sent");
+	zassert_equal(seg.seq, sack_data_seq + offset, "Unexpected segment at %u",
+		      seg.seq - sack_data_seq);
+	zassert_equal(seg.len, len, "Unexpected segment length %u", seg.len);
+}
+
+static void sack_expect_no_segment(void)
+{
+	struct sack_segment seg;
+
+	zassert_not_ok(k_msgq_get(&sack_segments, &seg, K_NO_WAIT),
+		       "Unexpected segment at %u", seg.seq - sack_data_seq);
+}
+
+/* Let the device send all its data at once */
+static void sack_open_cwnd(struct tcp *conn)
+{
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	k_mutex_lock(&conn->lock, K_FOREVER);
+	conn->ca.cwnd = SACK_TEST_WIN;
+	k_mutex_unlock(&conn->lock);
+#endif
+}
+#endif /* CONFIG_NET_TCP_SACK || CONFIG_NET_TCP_CONGESTION_CUBIC */
+
+#if defined(CONFIG_NET_TCP_SACK)
+static void sack_peer_data(uint32_t offset, size_t len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	seq = peer_data_seq + offset;
+
+	pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+				  lorem_ipsum + offset, len);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+}
+
+static void sack_expect_blocks(uint32_t acked, const struct tcp_sack_block *blocks, int count)
+{
+	struct sack_segment seg;
+
+	zassert_ok(k_msgq_get(&sack_segments, &seg, K_MSEC(100)), "No ACK sent");
+	zassert_equal(seg.flags, ACK, "Unexpected flags 0x%02x", seg.flags);
+	zassert_equal(seg.ack, peer_data_seq + acked, "Unexpected ACK %u",
+		      seg.ack - peer_data_seq);
+	zassert_equal(seg.sack_blocks, count, "Unexpected number of SACK blocks %u",
+		      seg.sack_blocks);
+
+	for (int i = 0; i < count; i++) {
+		zassert_equal(seg.sack[i].start, peer_data_seq + blocks[i].start,
+			      "Unexpected start of block %d", i);
+		zassert_equal(seg.sack[i].end, peer_data_seq + blocks[i].end,
+			      "Unexpected end of block %d", i);
+	}
+}
+
+static void sack_check_board(struct tcp *conn, const struct tcp_sack_block *blocks, int count)
+{
+	zassert_equal(conn->sack_board_len, count, "Unexpected scoreboard length %u",
+		      conn->sack_board_len);
+
+	for (int i = 0; i < count; i++) {
+		zassert_equal(conn->sack_board[i].start, sack_data_seq + blocks[i].start,
+			      "Unexpected start of block %d", i);
+		zassert_equal(conn->sack_board[i].end, sack_data_seq + blocks[i].end,
+			      "Unexpected end of block %d", i);
+	}
+}
+
+/* Test case scenario IPv6, the peer offers SACK
+ *   send data with holes,
+ *   expect duplicate ACKs reporting each range of queued data,
+ *   send the missing data,
+ *   expect ACKs without the acknowledged ranges.
+ */
+ZTEST(net_tcp, test_server_sack_option)
+{
+	const struct tcp_sack_block one[] = { { 20, 30 } };
+	const struct tcp_sack_block two[] = { { 20, 30 }, { 40, 45 } };
+	const struct tcp_sack_block merged[] = { { 20, 35 }, { 40, 45 } };
+	const struct tcp_sack_block last[] = { { 40, 45 } };
+	struct net_context *ctx;
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	ctx = sack_connect();
+	zassert_true(accepted_ctx->tcp->sack_ok, "SACK not negotiated");
+
+	sack_peer_data(20, 10);
+	sack_expect_blocks(0, one, ARRAY_SIZE(one));
+
+	/* A second hole */
+	sack_peer_data(40, 5);
+	sack_expect_blocks(0, two, ARRAY_SIZE(two));
+
+	/* Data touching a queued range is reported along with it */
+	sack_peer_data(30, 5);
+	sack_expect_blocks(0, merged, ARRAY_SIZE(merged));
+
+	/* The first hole is filled, only the data after the second one is left */
+	sack_peer_data(0, 20);
+	sack_expect_blocks(35, last, ARRAY_SIZE(last));
+
+	sack_peer_data(35, 5);
+	sack_expect_blocks(45, NULL, 0);
+
+	seq = peer_data_seq + 45;
+	sack_close(ctx);
+}
+
+/* Test case scenario IPv6, the peer offers SACK
+ *   expect 5 segments of data,
+ *   send duplicate ACKs reporting all but the first and third segments,
+ *   expect the first segment,
+ *   send a duplicate ACK,
+ *   expect the third segment but not the second one,
+ *   send a duplicate ACK,
+ *   expect no segment as there is no hole left.
+ */
+ZTEST(net_tcp, test_server_sack_retransmit)
+{
+	const struct tcp_sack_block dup1[] = { { 100, 200 } };
+	const struct tcp_sack_block dup2[] = { { 300, 400 }, { 100, 200 } };
+	const struct tcp_sack_block dup3[] = { { 400, 500 }, { 100, 200 } };
+	const struct tcp_sack_block board[] = { { 100, 200 }, { 300, 500 } };
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	ctx = sack_connect();
+	conn = accepted_ctx->tcp;
+	zassert_true(conn->sack_ok, "SACK not negotiated");
+
+	sack_open_cwnd(conn);
+	sack_device_send(0, SACK_TEST_SEGS * SACK_TEST_MSS);
+
+	for (int i = 0; i < SACK_TEST_SEGS; i++) {
+		sack_expect_segment(i * SACK_TEST_MSS, SACK_TEST_MSS);
+	}
+
+	sack_peer_ack(0, dup1, ARRAY_SIZE(dup1));
+	sack_peer_ack(0, dup2, ARRAY_SIZE(dup2));
+	sack_expect_no_segment();
+
+	/* Fast retransmit of the first segment, up to the first block */
+	sack_peer_ack(0, dup3, ARRAY_SIZE(dup3));
+	sack_expect_segment(0, SACK_TEST_MSS);
+
+	/* The touching blocks are merged, the scoreboard is sorted */
+	sack_check_board(conn, board, ARRAY_SIZE(board));
+
+	/* The next hole is retransmitted, skipping the data the peer has */
+	sack_peer_ack(0, dup3, ARRAY_SIZE(dup3));
+	sack_expect_segment(2 * SACK_TEST_MSS, SACK_TEST_MSS);
+
+	/* No hole left below the highest data reported */
+	sack_peer_ack(0, dup3, ARRAY_SIZE(dup3));
+	sack_expect_no_segment();
+
+	/* Everything received, the scoreboard is emptied */
+	sack_peer_ack(SACK_TEST_SEGS * SACK_TEST_MSS, NULL, 0);
+	sack_expect_no_segment();
+	sack_check_board(conn, NULL, 0);
+
+	sack_close(ctx);
+}
+
+/* Test case scenario IPv6, the peer offers SACK
+ *   expect 5 segments of data,
+ *   send duplicate ACKs reporting the second, fourth and fifth segments,
+ *   expect the first segment,
+ *   send an ACK up to the third segment,
+ *   expect the third segment.
+ */
+ZTEST(net_tcp, test_server_sack_partial_ack)
+{
+	const struct tcp_sack_block dup1[] = { { 100, 200 } };
+	const struct tcp_sack_block dup2[] = { { 300, 500 }, { 100, 200 } };
+	/* Below the ACK, and beyond the data sent */
+	const struct tcp_sack_block partial[] = { { 300, 500 }, { 100, 200 }, { 500, 600 } };
+	const struct tcp_sack_block board[] = { { 300, 500 } };
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	ctx = sack_connect();
+	conn = accepted_ctx->tcp;
+	zassert_true(conn->sack_ok, "SACK not negotiated");
+
+	sack_open_cwnd(conn);
+	sack_device_send(0, SACK_TEST_SEGS * SACK_TEST_MSS);
+
+	for (int i = 0; i < SACK_TEST_SEGS; i++) {
+		sack_expect_segment(i * SACK_TEST_MSS, SACK_TEST_MSS);
+	}
+
+	sack_peer_ack(0, dup1, ARRAY_SIZE(dup1));
+	sack_peer_ack(0, dup2, ARRAY_SIZE(dup2));
+	sack_peer_ack(0, dup2, ARRAY_SIZE(dup2));
+	sack_expect_segment(0, SACK_TEST_MSS);
+
+	/* The partial ACK tells the third segment is lost too */
+	sack_peer_ack(2 * SACK_TEST_MSS, partial, ARRAY_SIZE(partial));
+	sack_expect_segment(2 * SACK_TEST_MSS, SACK_TEST_MSS);
+	sack_expect_no_segment();
+
+	/* The blocks are clipped to the data acknowledged and sent */
+	sack_check_board(conn, board, ARRAY_SIZE(board));
+	zassert_true(conn->sack_recovery, "Recovery ended early");
+
+	sack_peer_ack(SACK_TEST_SEGS * SACK_TEST_MSS, NULL, 0);
+	sack_expect_no_segment();
+	zassert_false(conn->sack_recovery, "Recovery not ended");
+
+	sack_close(ctx);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+/* Have the device send a segment and acknowledge it */
+static void sack_round(uint32_t *sent)
+{
+	sack_device_send(*sent, SACK_TEST_MSS);
+	sack_expect_segment(*sent, SACK_TEST_MSS);
+
+	*sent += SACK_TEST_MSS;
+	sack_peer_ack(*sent, NULL, 0);
+}
+
+/* Test case scenario IPv6
+ *   expect 5 segments of data,
+ *   send 3 duplicate ACKs,
+ *   expect the first segment and the window to be reduced by 30%,
+ *   acknowledge all the data,
+ *   expect the window to grow back towards the one before the loss.
+ */
+ZTEST(net_tcp, test_server_cubic_loss)
+{
+	struct net_context *ctx;
+	struct tcp *conn;
+	uint32_t sent = SACK_TEST_SEGS * SACK_TEST_MSS;
+	uint32_t w_max;
+	uint16_t cwnd;
+
+	ctx = sack_connect();
+	conn = accepted_ctx->tcp;
+
+	sack_open_cwnd(conn);
+	sack_device_send(0, sent);
+
+	for (int i = 0; i < SACK_TEST_SEGS; i++) {
+		sack_expect_segment(i * SACK_TEST_MSS, SACK_TEST_MSS);
+	}
+
+	sack_peer_ack(0, NULL, 0);
+	sack_peer_ack(0, NULL, 0);
+
+	/* Once grown by the third duplicate ACK */
+	w_max = conn->ca.cwnd + SACK_TEST_MSS;
+
+	sack_peer_ack(0, NULL, 0);
+	sack_expect_segment(0, SACK_TEST_MSS);
+
+	zassert_equal(conn->ca.cubic.w_max, w_max, "Unexpected w_max %u",
+		      conn->ca.cubic.w_max);
+	zassert_within(conn->ca.ssthresh, w_max * 7 / 10, w_max / 100,
+		       "Unexpected ssthresh %u for w_max %u", conn->ca.ssthresh, w_max);
+	zassert_equal(conn->ca.cwnd, conn->ca.ssthresh + 3 * SACK_TEST_MSS,
+		      "Unexpected cwnd %u", conn->ca.cwnd);
+
+	/* End of recovery */
+	sack_peer_ack(sent, NULL, 0);
+	zassert_equal(conn->ca.cwnd, conn->ca.ssthresh, "Unexpected cwnd %u", conn->ca.cwnd);
+
+	/* Concave region, growing towards the window before the loss */
+	for (int i = 0; i < 4; i++) {
+		cwnd = conn->ca.cwnd;
+		sack_round(&sent);
+
+		zassert_true(conn->ca.cwnd > cwnd, "cwnd %u did not grow", cwnd);
+		zassert_true(conn->ca.cwnd < w_max, "cwnd %u beyond w_max %u", conn->ca.cwnd,
+			     w_max);
+	}
+
+	zassert_true(conn->ca.cubic.k > 0, "Not in the concave region");
+	zassert_equal(conn->ca.cubic.origin, w_max, "Unexpected origin %u",
+		      conn->ca.cubic.origin);
+
+	sack_close(ctx);
+}
+
+/* Test case scenario IPv6
+ *   exchange data until the end of slow start,
+ *   expect the window to grow faster as the time since the end of slow
+ *   start increases.
+ */
+ZTEST(net_tcp, test_server_cubic_convex)
+{
+	struct net_context *ctx;
+	struct tcp *conn;
+	uint32_t sent = 0;
+	uint16_t early_inc;
+	uint16_t late_inc;
+	uint16_t cwnd;
+
+	ctx = sack_connect();
+	conn = accepted_ctx->tcp;
+
+	while (conn->ca.cwnd < conn->ca.ssthresh) {
+		sack_round(&sent);
+	}
+
+	/* Starts the epoch, there was no loss so the window is the origin */
+	cwnd = conn->ca.cwnd;
+	sack_round(&sent);
+	zassert_equal(conn->ca.cubic.k, 0, "Not in the convex region");
+	zassert_equal(conn->ca.cubic.origin, cwnd, "Unexpected origin %u",
+		      conn->ca.cubic.origin);
+
+	cwnd = conn->ca.cwnd;
+	sack_round(&sent);
+	early_inc = conn->ca.cwnd - cwnd;
+
+	/* The cubic function now dominates the NewReno estimate */
+	k_msleep(1500);
+
+	cwnd = conn->ca.cwnd;
+	sack_round(&sent);
+	late_inc = conn->ca.cwnd - cwnd;
+
+	zassert_true(late_inc > early_inc, "cwnd growth %u not above %u", late_inc, early_inc);
+
+	sack_close(ctx);
+}
+#endif /* CONFIG_NET_TCP_CONGESTION_CUBIC */
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
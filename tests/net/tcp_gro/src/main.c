@@ -0,0 +1,214 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "net_private.h"
+
+#define TCP_PSH 0x08
+#define TCP_ACK 0x10
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+#define HDR_LEN (sizeof(struct net_eth_hdr) + sizeof(struct net_ipv4_hdr) + \
+		 sizeof(struct net_tcp_hdr))
+
+struct eth_context {
+	uint8_t mac_addr[6];
+};
+
+static struct eth_context eth_context_offload;
+static struct eth_context eth_context_no_offload;
+
+static void eth_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_context *context = dev->data;
+
+	net_if_set_link_addr(iface, context->mac_addr, sizeof(context->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_offload_caps(const struct device *dev)
+{
+	return ETHERNET_HW_RX_CHKSUM_OFFLOAD;
+}
+
+static enum ethernet_hw_caps eth_no_offload_caps(const struct device *dev)
+{
+	return 0;
+}
+
+static struct ethernet_api api_funcs_offload = {
+	.iface_api.init = eth_iface_init,
+	.get_capabilities = eth_offload_caps,
+	.send = eth_tx,
+};
+
+static struct ethernet_api api_funcs_no_offload = {
+	.iface_api.init = eth_iface_init,
+	.get_capabilities = eth_no_offload_caps,
+	.send = eth_tx,
+};
+
+static int eth_init(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	context->mac_addr[0] = 0x00;
+	context->mac_addr[1] = 0x00;
+	context->mac_addr[2] = 0x5E;
+	context->mac_addr[3] = 0x00;
+	context->mac_addr[4] = 0x53;
+	context->mac_addr[5] = (context == &eth_context_offload) ? 0x01 : 0x02;
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_gro_offload, "eth_gro_offload", eth_init, NULL,
+		    &eth_context_offload, NULL, CONFIG_ETH_INIT_PRIORITY,
+		    &api_funcs_offload, NET_ETH_MTU);
+
+ETH_NET_DEVICE_INIT(eth_gro_no_offload, "eth_gro_no_offload", eth_init, NULL,
+		    &eth_context_no_offload, NULL, CONFIG_ETH_INIT_PRIORITY,
+		    &api_funcs_no_offload, NET_ETH_MTU);
+
+static struct net_pkt *segment(struct net_if *iface, uint16_t src_port,
+			       uint32_t seq, uint8_t flags, const char *payload)
+{
+	static uint8_t frame[NET_ETH_MTU];
+	struct net_eth_hdr *eth = (struct net_eth_hdr *)frame;
+	struct net_ipv4_hdr *ip = (struct net_ipv4_hdr *)(eth + 1);
+	struct net_tcp_hdr *tcp = (struct net_tcp_hdr *)(ip + 1);
+	size_t len = HDR_LEN + strlen(payload);
+	struct net_pkt *pkt;
+
+	memset(frame, 0, HDR_LEN);
+	memset(eth->dst.addr, 0xaa, sizeof(eth->dst.addr));
+	memset(eth->src.addr, 0xbb, sizeof(eth->src.addr));
+	eth->type = htons(NET_ETH_PTYPE_IP);
+
+	ip->vhl = 0x45;
+	ip->len = htons(len - sizeof(struct net_eth_hdr));
+	ip->ttl = 64;
+	ip->proto = IPPROTO_TCP;
+	ip->src[0] = 192;
+	ip->src[2] = 2;
+	ip->src[3] = 1;
+	ip->dst[0] = 192;
+	ip->dst[2] = 2;
+	ip->dst[3] = 2;
+
+	tcp->src_port = htons(src_port);
+	tcp->dst_port = htons(SERVER_PORT);
+	sys_put_be32(seq, tcp->seq);
+	sys_put_be32(1, tcp->ack);
+	tcp->offset = 5 << 4;
+	tcp->flags = flags;
+	sys_put_be16(1024, tcp->wnd);
+
+	memcpy(tcp + 1, payload, strlen(payload));
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, len, AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "cannot allocate packet");
+	zassert_ok(net_pkt_write(pkt, frame, len), "cannot write packet");
+
+	return pkt;
+}
+
+static struct net_if *offload_iface(void)
+{
+	return net_if_lookup_by_dev(DEVICE_GET(eth_gro_offload));
+}
+
+/**
+ * @brief Verify that consecutive segments are merged into the first one
+ */
+ZTEST(net_tcp_gro, test_gro_merge)
+{
+	struct net_if *iface = offload_iface();
+	struct net_pkt *head = segment(iface, CLIENT_PORT, 1000, TCP_ACK, "Hello ");
+	struct net_pkt *next = segment(iface, CLIENT_PORT, 1006, TCP_ACK | TCP_PSH, "world");
+	struct net_ipv4_hdr *ip;
+	struct net_tcp_hdr *tcp;
+	char data[sizeof("Hello world")];
+
+	zassert_true(net_gro_can_merge(head, next), "segments not mergeable");
+	net_gro_merge(head, next);
+
+	zassert_equal(net_pkt_get_len(head), HDR_LEN + strlen("Hello world"));
+
+	ip = (struct net_ipv4_hdr *)(head->buffer->data + sizeof(struct net_eth_hdr));
+	tcp = (struct net_tcp_hdr *)(ip + 1);
+	zassert_equal(ntohs(ip->len), net_pkt_get_len(head) - sizeof(struct net_eth_hdr));
+	zassert_equal(calc_chksum(0, (uint8_t *)ip, sizeof(*ip)), 0xffff,
+		      "invalid IPv4 header checksum");
+	zassert_equal(tcp->flags, TCP_ACK | TCP_PSH, "PSH flag not carried over");
+
+	net_pkt_cursor_init(head);
+	zassert_ok(net_pkt_skip(head, HDR_LEN));
+	zassert_ok(net_pkt_read(head, data, strlen("Hello world")));
+	zassert_mem_equal(data, "Hello world", strlen("Hello world"), "wrong payload");
+
+	/**TESTPOINT: a pushed segment ends the merge */
+	next = segment(iface, CLIENT_PORT, 1011, TCP_ACK, "!");
+	zassert_false(net_gro_can_merge(head, next), "merged after a pushed segment");
+
+	net_pkt_unref(next);
+	net_pkt_unref(head);
+}
+
+/**
+ * @brief Verify that segments which do not follow each other are kept apart
+ */
+ZTEST(net_tcp_gro, test_gro_no_merge)
+{
+	struct net_if *iface = offload_iface();
+	struct net_if *no_offload = net_if_lookup_by_dev(DEVICE_GET(eth_gro_no_offload));
+	struct net_pkt *head = segment(iface, CLIENT_PORT, 1000, TCP_ACK, "Hello ");
+	struct net_pkt *next;
+
+	/**TESTPOINT: sequence gap */
+	next = segment(iface, CLIENT_PORT, 1010, TCP_ACK, "world");
+	zassert_false(net_gro_can_merge(head, next), "merged out of order segment");
+	net_pkt_unref(next);
+
+	/**TESTPOINT: other connection */
+	next = segment(iface, CLIENT_PORT + 1, 1006, TCP_ACK, "world");
+	zassert_false(net_gro_can_merge(head, next), "merged other connection");
+	net_pkt_unref(next);
+
+	/**TESTPOINT: control flags */
+	next = segment(iface, CLIENT_PORT, 1006, TCP_ACK | 0x01, "world");
+	zassert_false(net_gro_can_merge(head, next), "merged FIN segment");
+	net_pkt_unref(next);
+
+	net_pkt_unref(head);
+
+	/**TESTPOINT: checksums verified in software */
+	head = segment(no_offload, CLIENT_PORT, 1000, TCP_ACK, "Hello ");
+	next = segment(no_offload, CLIENT_PORT, 1006, TCP_ACK, "world");
+	zassert_false(net_gro_can_merge(head, next), "merged without checksum offload");
+	net_pkt_unref(next);
+	net_pkt_unref(head);
+}
+
+ZTEST_SUITE(net_tcp_gro, NULL, NULL, NULL, NULL, NULL);
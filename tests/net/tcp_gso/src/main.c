@@ -0,0 +1,205 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+
+#define TCP_PSH 0x08
+#define TCP_ACK 0x10
+
+#define MSS 500
+#define PAYLOAD_LEN (3 * MSS + 100)
+#define FIRST_SEQ 1000
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+static uint8_t mac_addr[6] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+static int segments;
+static size_t received;
+static bool seg_error;
+
+static void check_segment(struct net_pkt *pkt)
+{
+	struct net_ipv4_hdr ip;
+	struct net_tcp_hdr tcp;
+	bool last;
+	uint8_t byte;
+	size_t len;
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_read(pkt, &ip, sizeof(ip)) < 0 ||
+	    net_pkt_read(pkt, &tcp, sizeof(tcp)) < 0) {
+		seg_error = true;
+		return;
+	}
+
+	len = net_pkt_get_len(pkt) - NET_IPV4TCPH_LEN;
+	last = received + len == PAYLOAD_LEN;
+
+	if (ntohs(ip.len) != net_pkt_get_len(pkt) ||
+	    len != (last ? PAYLOAD_LEN % MSS : MSS) ||
+	    sys_get_be32(tcp.seq) != FIRST_SEQ + received ||
+	    tcp.flags != (last ? TCP_ACK | TCP_PSH : TCP_ACK) ||
+	    net_calc_chksum_tcp(pkt) != 0U ||
+	    net_pkt_gso_size(pkt) != 0U) {
+		seg_error = true;
+		return;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, NET_IPV4TCPH_LEN);
+
+	while (len-- > 0) {
+		if (net_pkt_read_u8(pkt, &byte) < 0 || byte != (uint8_t)received) {
+			seg_error = true;
+			return;
+		}
+
+		received++;
+	}
+
+	segments++;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr), NET_LINK_ETHERNET);
+}
+
+static int dummy_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+
+	check_segment(pkt);
+
+	return 0;
+}
+
+static struct dummy_api dummy_api_funcs = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_tx,
+};
+
+NET_DEVICE_INIT(tcp_gso_dummy, "tcp_gso_dummy", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api_funcs, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), NET_IPV4_MTU);
+
+static void eth_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr), NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_tso_caps(const struct device *dev)
+{
+	return ETHERNET_HW_TX_CHKSUM_OFFLOAD | ETHERNET_HW_TSO;
+}
+
+static struct ethernet_api eth_api_funcs = {
+	.iface_api.init = eth_iface_init,
+	.get_capabilities = eth_tso_caps,
+	.send = eth_tx,
+};
+
+ETH_NET_DEVICE_INIT(tcp_gso_eth, "tcp_gso_eth", NULL, NULL, NULL, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &eth_api_funcs, NET_ETH_MTU);
+
+static struct net_pkt *tcp_data(struct net_if *iface)
+{
+	struct net_tcp_hdr tcp = { 0 };
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(iface, sizeof(tcp) + PAYLOAD_LEN,
+					AF_INET, IPPROTO_TCP, K_NO_WAIT);
+	zassert_not_null(pkt, "cannot allocate packet");
+
+	net_pkt_set_gso_size(pkt, MSS);
+
+	zassert_ok(net_ipv4_create(pkt, &my_addr, &peer_addr), "cannot add IPv4 header");
+
+	tcp.src_port = htons(4242);
+	tcp.dst_port = htons(9898);
+	sys_put_be32(FIRST_SEQ, tcp.seq);
+	sys_put_be32(1, tcp.ack);
+	tcp.offset = 5 << 4;
+	tcp.flags = TCP_ACK | TCP_PSH;
+	sys_put_be16(8192, tcp.wnd);
+	zassert_ok(net_pkt_write(pkt, &tcp, sizeof(tcp)), "cannot add TCP header");
+
+	for (int i = 0; i < PAYLOAD_LEN; i++) {
+		zassert_ok(net_pkt_write_u8(pkt, (uint8_t)i), "cannot add payload");
+	}
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP), "cannot finalize packet");
+
+	return pkt;
+}
+
+static void *tcp_gso_setup(void)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+
+	zassert_not_null(iface, "no dummy interface");
+	zassert_not_null(net_if_ipv4_addr_add(iface, &my_addr, NET_ADDR_MANUAL, 0),
+			 "cannot add address");
+
+	return NULL;
+}
+
+/**
+ * @brief Verify that a packet is split into segments in software
+ */
+ZTEST(net_tcp_gso, test_gso_software)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	struct net_pkt *pkt = tcp_data(iface);
+
+	zassert_true(net_gso_needed(pkt), "packet not to be segmented");
+	zassert_ok(net_try_send_data(pkt, K_NO_WAIT), "cannot send packet");
+
+	zassert_false(seg_error, "invalid segment");
+	zassert_equal(segments, DIV_ROUND_UP(PAYLOAD_LEN, MSS), "wrong number of segments");
+	zassert_equal(received, PAYLOAD_LEN, "payload not fully sent");
+}
+
+/**
+ * @brief Verify that a packet is left whole for a device supporting TSO
+ */
+ZTEST(net_tcp_gso, test_gso_offload)
+{
+	struct net_if *iface = net_if_lookup_by_dev(DEVICE_GET(tcp_gso_eth));
+	struct net_pkt *pkt = tcp_data(iface);
+
+	zassert_false(net_gso_needed(pkt), "packet to be segmented in software");
+
+	/**TESTPOINT: no segmentation without a GSO size */
+	net_pkt_set_iface(pkt, net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY)));
+	net_pkt_set_gso_size(pkt, 0U);
+	zassert_false(net_gso_needed(pkt), "packet to be segmented");
+
+	net_pkt_unref(pkt);
+}
+
+ZTEST_SUITE(net_tcp_gso, NULL, tcp_gso_setup, NULL, NULL, NULL);
@@ -241,9 +241,35 @@ fail:
 	return 0;
 }
 
+#if defined(CONFIG_NET_TC_RX_QUEUES) && CONFIG_NET_TC_RX_QUEUES > 1
+static bool rx_queue_test;
+static k_tid_t rx_queue_thread;
+static K_SEM_DEFINE(rx_queue_sem, 0, 1);
+
+/* Runs in the RX thread the packet was queued to */
+static enum net_verdict eth_recv(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+
+	if (!rx_queue_test) {
+		return NET_CONTINUE;
+	}
+
+	rx_queue_thread = k_current_get();
+	k_sem_give(&rx_queue_sem);
+
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+#endif /* CONFIG_NET_TC_RX_QUEUES > 1 */
+
 static struct dummy_api api_funcs = {
 	.iface_api.init	= eth_iface_init,
 	.send	= eth_tx,
+#if defined(CONFIG_NET_TC_RX_QUEUES) && CONFIG_NET_TC_RX_QUEUES > 1
+	.recv	= eth_recv,
+#endif
 };
 
 static void generate_mac(uint8_t *mac_addr)
@@ -1051,6 +1077,168 @@ ZTEST(net_traffic_class, test_mix_all_2)
 	test_traffic_class_recv_data_mix_all_2();
 }
 
+#if defined(CONFIG_NET_TC_TX_SHAPER)
+#define SHAPER_RATE 20000
+
+ZTEST(net_traffic_class, test_tx_shaper)
+{
+	struct net_tc_tx_shaper_stats before, after;
+	int tc = net_tx_priority2tc(NET_PRIORITY_BK);
+	int64_t start;
+	int i;
+
+	zassert_equal(net_tc_tx_shaper_set(NET_TC_TX_COUNT, SHAPER_RATE, 0),
+		      -EINVAL, "Invalid traffic class accepted");
+
+	(void)memset(send_priorities, 0, sizeof(send_priorities));
+
+	zassert_ok(net_tc_tx_shaper_stats_get(tc, &before));
+	zassert_ok(net_tc_tx_shaper_set(tc, SHAPER_RATE, 0));
+
+	start = k_uptime_get();
+
+	traffic_class_send_priority(NET_PRIORITY_BK, MAX_PKT_TO_SEND, false);
+
+	for (i = 0; i < 100; i++) {
+		zassert_ok(net_tc_tx_shaper_stats_get(tc, &after));
+		if (after.pkts - before.pkts == MAX_PKT_TO_SEND) {
+			break;
+		}
+
+		k_sleep(K_MSEC(10));
+	}
+
+	zassert_ok(net_tc_tx_shaper_set(tc, 0, 0));
+
+	/* Only the first packet goes out without waiting for credit */
+	zassert_equal(after.pkts - before.pkts, MAX_PKT_TO_SEND,
+		      "Packets not sent");
+	zassert_equal(after.delayed - before.delayed, MAX_PKT_TO_SEND - 1,
+		      "Packets not delayed");
+	zassert_true(k_uptime_get() - start >=
+		     (after.bytes - before.bytes) * MSEC_PER_SEC / SHAPER_RATE / 2,
+		     "Rate not enforced");
+	zassert_false(test_failed, "Traffic class verification failed.");
+}
+#endif /* CONFIG_NET_TC_TX_SHAPER */
+
+#if defined(CONFIG_NET_TC_RX_QUEUES) && CONFIG_NET_TC_RX_QUEUES > 1
+#define RX_QUEUE_FLOWS 16
+#define RX_QUEUE_PORT 4242
+
+/* Receive a UDP packet of the flow from the given port, optionally
+ * tagged with a hardware RX queue, and return the RX thread that
+ * processed it.
+ */
+static k_tid_t rx_queue_recv(uint16_t src_port, int hw_queue)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	struct net_ipv6_hdr ipv6 = {
+		.vtc = 0x60,
+		.len = htons(sizeof(struct net_udp_hdr)),
+		.nexthdr = IPPROTO_UDP,
+		.hop_limit = 64,
+	};
+	struct net_udp_hdr udp = {
+		.src_port = htons(src_port),
+		.dst_port = htons(TEST_PORT),
+		.len = htons(sizeof(struct net_udp_hdr)),
+	};
+	struct net_pkt *pkt;
+	int ret;
+
+	net_ipv6_addr_copy_raw(ipv6.src, (uint8_t *)&dst_addr);
+	net_ipv6_addr_copy_raw(ipv6.dst, (uint8_t *)&my_addr1);
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, sizeof(ipv6) + sizeof(udp),
+					   AF_INET6, IPPROTO_UDP, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate packet");
+
+	zassert_ok(net_pkt_write(pkt, &ipv6, sizeof(ipv6)), "Cannot write IPv6 header");
+	zassert_ok(net_pkt_write(pkt, &udp, sizeof(udp)), "Cannot write UDP header");
+
+	if (hw_queue >= 0) {
+		net_pkt_set_rx_queue(pkt, hw_queue);
+	}
+
+	rx_queue_thread = NULL;
+	rx_queue_test = true;
+
+	ret = net_recv_data(iface, pkt);
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+		zassert_ok(ret, "Packet receive failed (%d)", ret);
+	}
+
+	zassert_ok(k_sem_take(&rx_queue_sem, WAIT_TIME), "Packet not received");
+	rx_queue_test = false;
+
+	return rx_queue_thread;
+}
+
+ZTEST(net_traffic_class, test_rx_queue_flow_hash)
+{
+	k_tid_t threads[CONFIG_NET_TC_RX_QUEUES];
+	int count = 0;
+
+	for (int i = 0; i < RX_QUEUE_FLOWS; i++) {
+		k_tid_t thread = rx_queue_recv(RX_QUEUE_PORT + i, -1);
+		int j;
+
+		/* The packets of a flow always go to the same queue */
+		for (int k = 0; k < 3; k++) {
+			zassert_equal_ptr(rx_queue_recv(RX_QUEUE_PORT + i, -1), thread,
+					  "Flow %d moved to another queue", i);
+		}
+
+		for (j = 0; j < count; j++) {
+			if (threads[j] == thread) {
+				break;
+			}
+		}
+
+		if (j == count) {
+			zassert_true(count < ARRAY_SIZE(threads), "Too many RX threads");
+			threads[count++] = thread;
+		}
+	}
+
+	/* The flows are spread over all the queues of the traffic class */
+	zassert_equal(count, CONFIG_NET_TC_RX_QUEUES,
+		      "Flows spread over %d queues, expecting %d",
+		      count, CONFIG_NET_TC_RX_QUEUES);
+}
+
+ZTEST(net_traffic_class, test_rx_queue_hw)
+{
+	k_tid_t threads[CONFIG_NET_TC_RX_QUEUES];
+
+	for (int q = 0; q < CONFIG_NET_TC_RX_QUEUES; q++) {
+		threads[q] = rx_queue_recv(RX_QUEUE_PORT, q);
+
+		for (int j = 0; j < q; j++) {
+			zassert_not_equal(threads[q], threads[j],
+					  "RX queues %d and %d share a thread", q, j);
+		}
+	}
+
+	/* A tagged packet goes to the queue of its ring whatever its flow,
+	 * and rings beyond the number of queues wrap around.
+	 */
+	for (int i = 0; i < RX_QUEUE_FLOWS; i++) {
+		int q = i % CONFIG_NET_TC_RX_QUEUES;
+
+		zassert_equal_ptr(rx_queue_recv(RX_QUEUE_PORT + i, q), threads[q],
+				  "Flow %d not processed with RX queue %d", i, q);
+		zassert_equal_ptr(rx_queue_recv(RX_QUEUE_PORT + i,
+						q + CONFIG_NET_TC_RX_QUEUES),
+				  threads[q],
+				  "Flow %d not processed with RX queue %d", i,
+				  q + CONFIG_NET_TC_RX_QUEUES);
+	}
+}
+#endif /* CONFIG_NET_TC_RX_QUEUES > 1 */
+
 static void run_before(void *dummy)
 {
 	ARG_UNUSED(dummy);
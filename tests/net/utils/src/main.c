@@ -1354,8 +1354,8 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 
 	/* Work across all possible combination so offset and length */
-	for (int offset = 0; offset < 7; offset++) {
-		for (int length = 1; length < 32; length++) {
+	for (int offset = 0; offset < 16; offset++) {
+		for (int length = 1; length < 64; length++) {
 			sum_got = calc_chksum_ref(offset ^ 0x8e72, testdata + offset, length);
 			sum_exp = calc_chksum(offset ^ 0x8e72, testdata + offset, length);
 
@@ -1365,6 +1365,43 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+ZTEST(test_utils_fn, test_ip_checksum_update)
+{
+	uint16_t words[10];
+	uint16_t chksum;
+
+	for (int i = 0; i < ARRAY_SIZE(words); i++) {
+		words[i] = (uint16_t)(i * 0x1357 + 0xfedc);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(words); i++) {
+		uint16_t old_val = words[i];
+
+		words[0] = 0U;
+		chksum = htons((uint16_t)~calc_chksum(0, (uint8_t *)words, sizeof(words)));
+		words[0] = chksum;
+
+		if (i == 0) {
+			continue;
+		}
+
+		words[i] = old_val ^ 0xa5a5;
+		chksum = net_chksum_update_u16(chksum, old_val, words[i]);
+
+		words[0] = chksum;
+		zassert_equal((uint16_t)~calc_chksum(0, (uint8_t *)words, sizeof(words)), 0U,
+			      "Checksum not valid after 16-bit update %d", i);
+
+		chksum = net_chksum_update_u32(chksum, UNALIGNED_GET((uint32_t *)&words[2]),
+					       0x12345678);
+		UNALIGNED_PUT(0x12345678, (uint32_t *)&words[2]);
+
+		words[0] = chksum;
+		zassert_equal((uint16_t)~calc_chksum(0, (uint8_t *)words, sizeof(words)), 0U,
+			      "Checksum not valid after 32-bit update %d", i);
+	}
+}
+
 /* Verify that the net_pkt pointer to the received link layer address
  * is correct.
  */
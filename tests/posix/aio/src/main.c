@@ -0,0 +1,231 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <aio.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+static int efd = -1;
+static uint64_t rval;
+static uint64_t wval;
+static K_SEM_DEFINE(notified, 0, 1);
+
+static void setup_cb(struct aiocb *cb, int op, uint64_t *val)
+{
+	*cb = (struct aiocb){
+		.aio_fildes = efd,
+		.aio_buf = val,
+		.aio_nbytes = sizeof(*val),
+		.aio_lio_opcode = op,
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+}
+
+static void wait_for(const struct aiocb *cb)
+{
+	const struct aiocb *const list[] = {cb};
+
+	while (aio_error(cb) == EINPROGRESS) {
+		zassert_ok(aio_suspend(list, ARRAY_SIZE(list), NULL));
+	}
+}
+
+static void notify(union sigval val)
+{
+	ARG_UNUSED(val);
+
+	k_sem_give(&notified);
+}
+
+ZTEST(posix_aio, test_aio_read_write)
+{
+	struct aiocb rcb;
+	struct aiocb wcb;
+
+	setup_cb(&rcb, LIO_READ, &rval);
+	zassert_ok(aio_read(&rcb));
+
+	/* Nothing to read from the eventfd yet */
+	k_msleep(10);
+	zassert_equal(aio_error(&rcb), EINPROGRESS);
+
+	wval = 5;
+	setup_cb(&wcb, LIO_WRITE, &wval);
+	zassert_ok(aio_write(&wcb));
+
+	wait_for(&wcb);
+	wait_for(&rcb);
+
+	zassert_ok(aio_error(&wcb));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+	zassert_ok(aio_error(&rcb));
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(rval, 5);
+
+	/* The results were collected */
+	zassert_equal(aio_return(&rcb), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+ZTEST(posix_aio, test_aio_suspend_timeout)
+{
+	const struct timespec timeout = {.tv_nsec = 10 * NSEC_PER_MSEC};
+	const struct aiocb *list[1];
+	struct aiocb rcb;
+	struct aiocb wcb;
+
+	setup_cb(&rcb, LIO_READ, &rval);
+	list[0] = &rcb;
+	zassert_ok(aio_read(&rcb));
+
+	zassert_equal(aio_suspend(list, ARRAY_SIZE(list), &timeout), -1);
+	zassert_equal(errno, EAGAIN);
+
+	wval = 1;
+	setup_cb(&wcb, LIO_WRITE, &wval);
+	zassert_ok(aio_write(&wcb));
+
+	wait_for(&rcb);
+	wait_for(&wcb);
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+}
+
+ZTEST(posix_aio, test_aio_cancel)
+{
+	struct aiocb rcb[CONFIG_POSIX_AIO_THREADS + 1];
+	struct aiocb *list[CONFIG_POSIX_AIO_THREADS];
+	struct aiocb wcb;
+
+	/* Keep all the worker threads busy, so that the last request stays queued */
+	for (size_t i = 0; i < ARRAY_SIZE(rcb); i++) {
+		setup_cb(&rcb[i], LIO_READ, &rval);
+		zassert_ok(aio_read(&rcb[i]));
+	}
+
+	for (size_t i = 0; i < CONFIG_POSIX_AIO_THREADS; i++) {
+		list[i] = &rcb[i];
+	}
+
+	k_msleep(10);
+	zassert_equal(aio_cancel(efd, &rcb[CONFIG_POSIX_AIO_THREADS]), AIO_CANCELED);
+	zassert_equal(aio_error(&rcb[CONFIG_POSIX_AIO_THREADS]), ECANCELED);
+	zassert_equal(aio_return(&rcb[CONFIG_POSIX_AIO_THREADS]), -1);
+	zassert_equal(errno, ECANCELED);
+
+	/* Blocked in eventfd_read() */
+	zassert_equal(aio_cancel(efd, &rcb[0]), AIO_NOTCANCELED);
+
+	/* Each write wakes up one of the reads, which resets the eventfd */
+	for (size_t done = 0; done < CONFIG_POSIX_AIO_THREADS; done++) {
+		wval = 1;
+		setup_cb(&wcb, LIO_WRITE, &wval);
+		zassert_ok(aio_write(&wcb));
+		wait_for(&wcb);
+		zassert_equal(aio_return(&wcb), sizeof(wval));
+
+		zassert_ok(aio_suspend((const struct aiocb *const *)list, CONFIG_POSIX_AIO_THREADS,
+				       NULL));
+		for (size_t i = 0; i < CONFIG_POSIX_AIO_THREADS; i++) {
+			if (list[i] != NULL && aio_error(list[i]) != EINPROGRESS) {
+				zassert_equal(aio_return(list[i]), sizeof(rval));
+				list[i] = NULL;
+			}
+		}
+	}
+
+	zassert_equal(aio_cancel(efd, NULL), AIO_ALLDONE);
+}
+
+ZTEST(posix_aio, test_lio_listio)
+{
+	struct aiocb rcb;
+	struct aiocb wcb;
+	struct aiocb *const list[] = {&rcb, NULL, &wcb};
+	struct sigevent sig = {
+		.sigev_notify = SIGEV_THREAD,
+		.sigev_notify_function = notify,
+	};
+
+	wval = 7;
+	setup_cb(&rcb, LIO_READ, &rval);
+	setup_cb(&wcb, LIO_WRITE, &wval);
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL));
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+	zassert_equal(rval, 7);
+
+	wval = 3;
+	setup_cb(&rcb, LIO_READ, &rval);
+	setup_cb(&wcb, LIO_WRITE, &wval);
+	zassert_ok(lio_listio(LIO_NOWAIT, list, ARRAY_SIZE(list), &sig));
+	zassert_ok(k_sem_take(&notified, K_SECONDS(1)));
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+	zassert_equal(rval, 3);
+}
+
+ZTEST(posix_aio, test_aio_sigev_thread)
+{
+	struct aiocb wcb;
+
+	wval = 1;
+	setup_cb(&wcb, LIO_WRITE, &wval);
+	wcb.aio_sigevent.sigev_notify = SIGEV_THREAD;
+	wcb.aio_sigevent.sigev_notify_function = notify;
+	zassert_ok(aio_write(&wcb));
+
+	zassert_ok(k_sem_take(&notified, K_SECONDS(1)));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+
+	/* Drain the eventfd */
+	zassert_equal(read(efd, &rval, sizeof(rval)), sizeof(rval));
+}
+
+ZTEST(posix_aio, test_aio_invalid)
+{
+	struct aiocb rcb;
+
+	zassert_equal(aio_read(NULL), -1);
+	zassert_equal(errno, EINVAL);
+
+	setup_cb(&rcb, LIO_READ, &rval);
+	rcb.aio_offset = -1;
+	zassert_equal(aio_read(&rcb), -1);
+	zassert_equal(errno, EINVAL);
+
+	setup_cb(&rcb, LIO_READ, &rval);
+	zassert_equal(aio_error(&rcb), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(lio_listio(-1, NULL, 0, NULL), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	efd = eventfd(0, 0);
+	zassert_true(efd >= 0, "eventfd() failed: %d", errno);
+}
+
+static void after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	zassert_ok(close(efd));
+	efd = -1;
+}
+
+ZTEST_SUITE(posix_aio, NULL, NULL, before, after, NULL);
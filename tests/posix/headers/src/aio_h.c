@@ -22,6 +22,16 @@ ZTEST(posix_headers, test_aio_h)
 	zassert_not_equal(offsetof(struct aiocb, aio_sigevent), -1);
 	zassert_not_equal(offsetof(struct aiocb, aio_lio_opcode), -1);
 
+	zassert_not_equal(-1, AIO_ALLDONE);
+	zassert_not_equal(-1, AIO_CANCELED);
+	zassert_not_equal(-1, AIO_NOTCANCELED);
+
+	zassert_not_equal(-1, LIO_NOP);
+	zassert_not_equal(-1, LIO_NOWAIT);
+	zassert_not_equal(-1, LIO_READ);
+	zassert_not_equal(-1, LIO_WAIT);
+	zassert_not_equal(-1, LIO_WRITE);
+
 	if (IS_ENABLED(CONFIG_POSIX_API)) {
 		zassert_not_null(aio_cancel);
 		zassert_not_null(aio_error);
@@ -5,9 +5,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
 #include <fcntl.h>
 #include <mqueue.h>
 #include <pthread.h>
+#include <string.h>
 
 #include <zephyr/sys/util.h>
 #include <zephyr/ztest.h>
@@ -272,6 +274,45 @@ ZTEST(xsi_realtime, test_mqueue_notify_errors)
 	zassert_ok(mq_unlink(queue), "Unable to unlink queue");
 }
 
+ZTEST(xsi_realtime, test_mqueue_priority)
+{
+	static const struct {
+		const char *msg;
+		unsigned int prio;
+	} sent[] = {
+		{"low 1", 1}, {"high 1", 3}, {"low 2", 1}, {"high 2", 3},
+	};
+	static const int order[] = {1, 3, 0, 2};
+	struct mq_attr attrs = {
+		.mq_msgsize = MESSAGE_SIZE,
+		.mq_maxmsg = MESG_COUNT_PERMQ,
+	};
+	unsigned int prio;
+	mqd_t mqd;
+
+	mqd = mq_open(queue, O_RDWR | O_CREAT, 0777, &attrs);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sent); i++) {
+		zassert_ok(mq_send(mqd, sent[i].msg, strlen(sent[i].msg) + 1, sent[i].prio));
+	}
+
+	zassert_not_ok(mq_send(mqd, send_data, MESSAGE_SIZE, CONFIG_POSIX_MQ_PRIO_MAX));
+	zassert_equal(errno, EINVAL);
+
+	/* Highest priority first, in the order they were sent for the same priority */
+	for (size_t i = 0; i < ARRAY_SIZE(order); i++) {
+		const char *exp = sent[order[i]].msg;
+
+		memset(rec_data, 0, MESSAGE_SIZE);
+		zassert_equal(mq_receive(mqd, rec_data, MESSAGE_SIZE, &prio), strlen(exp) + 1);
+		zassert_str_equal(rec_data, exp);
+		zassert_equal(prio, sent[order[i]].prio);
+	}
+
+	zassert_ok(mq_close(mqd), "Unable to close message queue descriptor.");
+	zassert_ok(mq_unlink(queue), "Unable to unlink queue");
+}
+
 ZTEST(xsi_realtime, test_mqueue_open_and_unlink_multiple)
 {
 	const char *q1 = "q1";
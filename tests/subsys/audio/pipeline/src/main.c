@@ -0,0 +1,223 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/audio/pipeline.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define BLOCK_SIZE 16
+#define NUM_BLOCKS 8
+
+K_MEM_SLAB_DEFINE_STATIC(test_slab, BLOCK_SIZE, 4, 4);
+K_MEM_SLAB_DEFINE_STATIC(other_slab, BLOCK_SIZE, 1, 4);
+K_THREAD_STACK_DEFINE(pipeline_stack, 1024);
+
+static struct i2s_config rx_cfg = {
+	.mem_slab = &test_slab,
+	.block_size = BLOCK_SIZE,
+};
+static struct i2s_config tx_cfg = {
+	.mem_slab = &test_slab,
+	.block_size = BLOCK_SIZE,
+};
+
+static uint32_t rx_count;
+static uint32_t tx_count;
+static uint32_t tx_starts;
+static uint8_t tx_values[NUM_BLOCKS];
+static size_t tx_sizes[NUM_BLOCKS];
+
+static int fake_i2s_configure(const struct device *dev, enum i2s_dir dir,
+			      const struct i2s_config *cfg)
+{
+	return 0;
+}
+
+static const struct i2s_config *fake_i2s_config_get(const struct device *dev, enum i2s_dir dir)
+{
+	return dir == I2S_DIR_RX ? &rx_cfg : &tx_cfg;
+}
+
+static int fake_i2s_read(const struct device *dev, void **mem_block, size_t *size)
+{
+	if (rx_count == NUM_BLOCKS ||
+	    k_mem_slab_alloc(&test_slab, mem_block, K_NO_WAIT) != 0) {
+		k_sleep(K_MSEC(1));
+		return -EAGAIN;
+	}
+
+	memset(*mem_block, rx_count, BLOCK_SIZE);
+	*size = BLOCK_SIZE;
+	rx_count++;
+
+	return 0;
+}
+
+static int fake_i2s_write(const struct device *dev, void *mem_block, size_t size)
+{
+	tx_values[tx_count] = ((uint8_t *)mem_block)[0];
+	tx_sizes[tx_count] = size;
+	tx_count++;
+
+	/* Sent right away */
+	k_mem_slab_free(&test_slab, mem_block);
+
+	return 0;
+}
+
+static int fake_i2s_trigger(const struct device *dev, enum i2s_dir dir,
+			    enum i2s_trigger_cmd cmd)
+{
+	if (dir == I2S_DIR_TX && cmd == I2S_TRIGGER_START) {
+		tx_starts++;
+	}
+
+	return 0;
+}
+
+static DEVICE_API(i2s, fake_i2s_api) = {
+	.configure = fake_i2s_configure,
+	.config_get = fake_i2s_config_get,
+	.read = fake_i2s_read,
+	.write = fake_i2s_write,
+	.trigger = fake_i2s_trigger,
+};
+
+DEVICE_DEFINE(fake_i2s, "fake_i2s", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_i2s_api);
+
+static int add_one(struct audio_pipeline_stage *stage, void *block, size_t *size,
+		   size_t capacity)
+{
+	uint8_t *samples = block;
+
+	zassert_equal(capacity, BLOCK_SIZE);
+
+	for (size_t i = 0; i < *size; i++) {
+		samples[i]++;
+	}
+
+	return 0;
+}
+
+static int drop_even(struct audio_pipeline_stage *stage, void *block, size_t *size,
+		     size_t capacity)
+{
+	if (((uint8_t *)block)[0] % 2 == 0) {
+		return 1;
+	}
+
+	*size /= 2;
+
+	return 0;
+}
+
+static struct audio_pipeline_stage stages[] = {
+	{ .name = "add_one", .process = add_one },
+	{ .name = "drop_even", .process = drop_even },
+};
+
+static struct audio_pipeline pipe;
+
+static void before(void *fixture)
+{
+	rx_count = 0;
+	tx_count = 0;
+	tx_starts = 0;
+	tx_cfg.mem_slab = &test_slab;
+}
+
+ZTEST_SUITE(audio_pipeline, NULL, NULL, before, NULL, NULL);
+
+ZTEST(audio_pipeline, test_pipeline)
+{
+	const struct device *dev = DEVICE_GET(fake_i2s);
+	struct audio_pipeline_stage_stats stage_stats;
+	struct audio_pipeline_stats stats;
+
+	zassert_ok(audio_pipeline_init(&pipe, dev, dev, stages, ARRAY_SIZE(stages)));
+	zassert_ok(audio_pipeline_start(&pipe, pipeline_stack,
+					K_THREAD_STACK_SIZEOF(pipeline_stack), K_PRIO_COOP(1)));
+	zassert_equal(audio_pipeline_start(&pipe, pipeline_stack,
+					   K_THREAD_STACK_SIZEOF(pipeline_stack), K_PRIO_COOP(1)),
+		      -EBUSY);
+
+	for (int i = 0; i < 100; i++) {
+		audio_pipeline_stats_get(&pipe, &stats);
+		if (stats.blocks == NUM_BLOCKS) {
+			break;
+		}
+		k_sleep(K_MSEC(1));
+	}
+
+	zassert_ok(audio_pipeline_stop(&pipe));
+	zassert_ok(audio_pipeline_status(&pipe));
+
+	audio_pipeline_stats_get(&pipe, &stats);
+	zassert_equal(stats.blocks, NUM_BLOCKS);
+	zassert_equal(stats.dropped, NUM_BLOCKS / 2);
+
+	zassert_equal(tx_starts, 1);
+	zassert_equal(tx_count, NUM_BLOCKS / 2);
+	for (uint32_t i = 0; i < tx_count; i++) {
+		zassert_equal(tx_values[i], 2 * i + 1);
+		zassert_equal(tx_sizes[i], BLOCK_SIZE / 2);
+	}
+
+	zassert_ok(audio_pipeline_stage_stats_get(&pipe, 0, &stage_stats));
+	zassert_equal(stage_stats.blocks, NUM_BLOCKS);
+	zassert_equal(stage_stats.dropped, 0);
+	zassert_ok(audio_pipeline_stage_stats_get(&pipe, 1, &stage_stats));
+	zassert_equal(stage_stats.blocks, NUM_BLOCKS);
+	zassert_equal(stage_stats.dropped, NUM_BLOCKS / 2);
+	zassert_equal(stage_stats.errors, 0);
+	zassert_equal(audio_pipeline_stage_stats_get(&pipe, 2, &stage_stats), -EINVAL);
+
+	zassert_equal(k_mem_slab_num_free_get(&test_slab), 4, "blocks leaked");
+
+	audio_pipeline_stats_reset(&pipe);
+	audio_pipeline_stats_get(&pipe, &stats);
+	zassert_equal(stats.blocks, 0);
+	zassert_ok(audio_pipeline_stage_stats_get(&pipe, 1, &stage_stats));
+	zassert_equal(stage_stats.blocks, 0);
+}
+
+ZTEST(audio_pipeline, test_no_sink)
+{
+	const struct device *dev = DEVICE_GET(fake_i2s);
+	struct audio_pipeline_stats stats;
+
+	zassert_ok(audio_pipeline_init(&pipe, dev, NULL, stages, 1));
+	zassert_ok(audio_pipeline_stop(&pipe), "stop before start");
+	zassert_ok(audio_pipeline_start(&pipe, pipeline_stack,
+					K_THREAD_STACK_SIZEOF(pipeline_stack), K_PRIO_COOP(1)));
+
+	for (int i = 0; i < 100 && rx_count < NUM_BLOCKS; i++) {
+		k_sleep(K_MSEC(1));
+	}
+
+	zassert_ok(audio_pipeline_stop(&pipe));
+
+	audio_pipeline_stats_get(&pipe, &stats);
+	zassert_equal(stats.blocks, NUM_BLOCKS);
+	zassert_equal(stats.dropped, 0);
+	zassert_equal(tx_count, 0);
+	zassert_equal(tx_starts, 0);
+	zassert_equal(k_mem_slab_num_free_get(&test_slab), 4, "blocks leaked");
+}
+
+ZTEST(audio_pipeline, test_slab_mismatch)
+{
+	const struct device *dev = DEVICE_GET(fake_i2s);
+
+	tx_cfg.mem_slab = &other_slab;
+
+	zassert_equal(audio_pipeline_init(&pipe, dev, dev, stages, ARRAY_SIZE(stages)),
+		      -EINVAL);
+}
@@ -16,6 +16,8 @@
 
 #define SLOT1_PARTITION_ID	FIXED_PARTITION_ID(SLOT1_PARTITION)
 
+#define STORAGE_PARTITION_ID	FIXED_PARTITION_ID(storage_partition)
+
 ZTEST(img_util, test_init_id)
 {
 	struct flash_img_context ctx_no_id;
@@ -165,4 +167,95 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_DELTA
+#define DELTA_BASE_SIZE		2048U
+#define DELTA_INSERT_OFF	1000U
+
+static const uint8_t delta_insert[] = "delta image test";
+
+/* Base image of base_byte() values, with bytes 100 to 163 incremented and
+ * delta_insert inserted at DELTA_INSERT_OFF:
+ * python3 scripts/dfu/img_delta.py create --window-bits 8 old.bin new.bin patch.bin
+ */
+static const uint8_t delta_patch[] = {
+	0x5a, 0x44, 0x4c, 0x54, 0x10, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x64, 0x00, 0x01, 0x00, 0x51, 0x3f, 0x91, 0x01,
+	0x40, 0x26, 0x00, 0x10, 0x0f, 0x01, 0x00, 0x0b, 0x4f, 0x92, 0x01, 0xc4,
+	0x06, 0x27, 0x00, 0x10, 0x0f, 0x01, 0x00, 0xff, 0xff, 0xff, 0x11, 0xff,
+	0x05, 0x10, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x20, 0x69, 0x6d, 0x61, 0x67,
+	0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x00, 0x98, 0x08, 0x37, 0x00, 0x10,
+	0x0f, 0x01, 0x00, 0xff, 0xff, 0xff, 0xe7, 0x00,
+};
+
+static uint8_t base_byte(uint32_t off)
+{
+	return (uint8_t)(off * 7U + (off >> 8));
+}
+
+static uint8_t delta_image_byte(uint32_t off)
+{
+	if (off >= DELTA_INSERT_OFF + sizeof(delta_insert) - 1) {
+		off -= sizeof(delta_insert) - 1;
+	} else if (off >= DELTA_INSERT_OFF) {
+		return delta_insert[off - DELTA_INSERT_OFF];
+	}
+
+	return base_byte(off) + ((off >= 100U && off < 164U) ? 1U : 0U);
+}
+
+ZTEST(img_util, test_delta)
+{
+	static struct flash_img_context ctx;
+	const struct flash_area *fa;
+	uint8_t data[16];
+	uint32_t i, j;
+	int ret;
+
+	ret = flash_area_open(STORAGE_PARTITION_ID, &fa);
+	zassert_true(ret == 0, "Flash area open failure (%d)", ret);
+	ret = flash_area_flatten(fa, 0, fa->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+	for (i = 0U; i < DELTA_BASE_SIZE; i += sizeof(data)) {
+		for (j = 0U; j < sizeof(data); j++) {
+			data[j] = base_byte(i + j);
+		}
+		ret = flash_area_write(fa, i, data, sizeof(data));
+		zassert_true(ret == 0, "Flash write failure (%d)", ret);
+	}
+
+	ret = flash_img_delta_init_id(&ctx, SLOT1_PARTITION_ID, SLOT1_PARTITION_ID);
+	zassert_equal(ret, -EINVAL, "Same base and image partitions accepted");
+
+	ret = flash_img_delta_init_id(&ctx, SLOT1_PARTITION_ID, STORAGE_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init (%d)", ret);
+	ret = flash_area_flatten(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	/* Feed the patch in pieces that do not match its sequences */
+	for (i = 0U; i < sizeof(delta_patch); i += 7U) {
+		ret = flash_img_buffered_write(&ctx, &delta_patch[i],
+					       MIN(7U, sizeof(delta_patch) - i),
+					       i + 7U >= sizeof(delta_patch));
+		zassert_true(ret == 0, "Delta patch write failure (%d)", ret);
+	}
+
+	zassert_equal(flash_img_bytes_written(&ctx),
+		      DELTA_BASE_SIZE + sizeof(delta_insert) - 1,
+		      "Wrong image size");
+
+	ret = flash_area_open(SLOT1_PARTITION_ID, &fa);
+	zassert_true(ret == 0, "Flash area open failure (%d)", ret);
+	for (i = 0U; i < DELTA_BASE_SIZE + sizeof(delta_insert) - 1; i++) {
+		zassert_true(flash_area_read(fa, i, data, 1) == 0, "Flash read failure");
+		zassert_equal(data[0], delta_image_byte(i), "Wrong image byte at %u", i);
+	}
+
+	/* A truncated patch is rejected */
+	ret = flash_img_delta_init_id(&ctx, SLOT1_PARTITION_ID, STORAGE_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init (%d)", ret);
+	ret = flash_img_buffered_write(&ctx, delta_patch, sizeof(delta_patch) / 2, true);
+	zassert_equal(ret, -EINVAL, "Truncated patch accepted (%d)", ret);
+}
+#endif
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,141 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/display/damage_fb.h>
+
+#define WIDTH  64
+#define HEIGHT 32
+#define BPP    4
+
+static const struct device *dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+static uint8_t fb_mem[WIDTH * HEIGHT * BPP];
+static uint8_t stage_mem[WIDTH * 4 * BPP];
+static struct damage_fb fb;
+
+static void flush_and_check(uint32_t writes, uint64_t pixels)
+{
+	struct damage_fb_stats stats;
+
+	zassert_ok(damage_fb_flush(&fb), "Flush failed");
+	damage_fb_stats_get(&fb, &stats);
+	zassert_equal(stats.writes, writes, "Unexpected number of writes %u",
+		      stats.writes);
+	zassert_equal(stats.pixels, pixels, "Unexpected number of pixels %llu",
+		      stats.pixels);
+}
+
+ZTEST(damage_fb, test_nothing_damaged)
+{
+	flush_and_check(0, 0);
+	zassert_equal(fb.stats.frames, 0, "Empty flush counted as a frame");
+}
+
+ZTEST(damage_fb, test_overlapping_areas_merged)
+{
+	damage_fb_damage(&fb, 0, 0, 64, 8);
+	damage_fb_damage(&fb, 0, 4, 64, 8);
+
+	/* Full width area, written directly with a single write */
+	flush_and_check(1, 64 * 12);
+}
+
+ZTEST(damage_fb, test_adjacent_areas_merged)
+{
+	damage_fb_damage(&fb, 0, 0, 64, 4);
+	damage_fb_damage(&fb, 0, 4, 64, 4);
+	damage_fb_damage(&fb, 0, 8, 64, 4);
+
+	flush_and_check(1, 64 * 12);
+}
+
+ZTEST(damage_fb, test_disjoint_areas_kept)
+{
+	damage_fb_damage(&fb, 0, 0, 4, 4);
+	damage_fb_damage(&fb, 32, 16, 4, 4);
+
+	flush_and_check(2, 2 * 16);
+}
+
+ZTEST(damage_fb, test_clipping)
+{
+	damage_fb_damage(&fb, -4, -4, 8, 8);
+	damage_fb_damage(&fb, 60, 28, 8, 8);
+	damage_fb_damage(&fb, 64, 0, 8, 8);
+	damage_fb_damage(&fb, -8, 0, 8, 8);
+
+	flush_and_check(2, 2 * 16);
+}
+
+ZTEST(damage_fb, test_limit_reached)
+{
+	/* One more area than CONFIG_DAMAGE_FRAMEBUFFER_MAX_RECTS */
+	damage_fb_damage(&fb, 0, 0, 2, 2);
+	damage_fb_damage(&fb, 20, 0, 2, 2);
+	damage_fb_damage(&fb, 40, 0, 2, 2);
+	damage_fb_damage(&fb, 0, 20, 2, 2);
+	damage_fb_damage(&fb, 2, 22, 2, 2);
+
+	/* The last area is merged with its closest neighbour into 4x4 */
+	flush_and_check(4, 3 * 4 + 16);
+}
+
+ZTEST(damage_fb, test_staged_write)
+{
+	/* 8 lines of 8 pixels, the staging buffer holds 32 such lines */
+	damage_fb_damage(&fb, 8, 8, 8, 8);
+	flush_and_check(1, 64);
+
+	damage_fb_stats_reset(&fb);
+
+	/* 32 lines of 32 pixels, the staging buffer holds 8 such lines */
+	damage_fb_damage(&fb, 16, 0, 32, 32);
+	flush_and_check(4, 32 * 32);
+}
+
+ZTEST(damage_fb, test_write)
+{
+	static const uint32_t pixels[2 * 3] = {
+		1, 2, 0xff,
+		3, 4, 0xff,
+	};
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 2,
+		.height = 2,
+		.pitch = 3,
+	};
+	uint32_t *mem = damage_fb_get_buffer(&fb, NULL);
+
+	zassert_ok(damage_fb_write(&fb, 10, 20, &desc, pixels));
+	zassert_equal(mem[20 * WIDTH + 10], 1);
+	zassert_equal(mem[20 * WIDTH + 11], 2);
+	zassert_equal(mem[21 * WIDTH + 10], 3);
+	zassert_equal(mem[21 * WIDTH + 11], 4);
+	zassert_equal(mem[20 * WIDTH + 12], 0);
+
+	zassert_equal(damage_fb_write(&fb, 63, 0, &desc, pixels), -EINVAL);
+
+	flush_and_check(1, 4);
+}
+
+static void damage_fb_before(void *f)
+{
+	ARG_UNUSED(f);
+
+	memset(fb_mem, 0, sizeof(fb_mem));
+	zassert_ok(damage_fb_init(&fb, dev, fb_mem, sizeof(fb_mem),
+				  stage_mem, sizeof(stage_mem)));
+}
+
+static void *damage_fb_setup(void)
+{
+	zassert_true(device_is_ready(dev), "Display device is not ready");
+
+	return NULL;
+}
+
+ZTEST_SUITE(damage_fb, NULL, damage_fb_setup, damage_fb_before, NULL, NULL);
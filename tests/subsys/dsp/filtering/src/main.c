@@ -0,0 +1,132 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/dsp/filtering.h>
+#include <zephyr/ztest.h>
+
+/* Fixed-point results may differ by a few LSB between the backend variants */
+#define ABS_ERROR_THRESH_Q15 2
+#define ABS_ERROR_THRESH_Q31 16
+
+#define BLOCK_SIZE 3
+
+/*
+ * b[0] = 0.5 and b[1] = 0.25, split across two calls to check that the state
+ * is carried over.
+ */
+ZTEST(zdsp_filtering, test_zdsp_fir_f32)
+{
+	static const float32_t coeffs[] = {0.25f, 0.5f};
+	static const float32_t in1[BLOCK_SIZE] = {1.0f, 0.0f, 0.0f};
+	static const float32_t in2[] = {-1.0f, 0.0f};
+	static const float32_t ref1[BLOCK_SIZE] = {0.5f, 0.25f, 0.0f};
+	static const float32_t ref2[] = {-0.5f, -0.25f};
+	float32_t state[ARRAY_SIZE(coeffs) + BLOCK_SIZE - 1];
+	struct zdsp_fir_instance_f32 inst;
+	float32_t out[BLOCK_SIZE];
+
+	zdsp_fir_init_f32(&inst, ARRAY_SIZE(coeffs), coeffs, state, BLOCK_SIZE);
+
+	zdsp_fir_f32(&inst, in1, out, ARRAY_SIZE(in1));
+	for (size_t i = 0; i < ARRAY_SIZE(ref1); i++) {
+		zassert_within(out[i], ref1[i], 1e-6f, "sample %zu", i);
+	}
+
+	zdsp_fir_f32(&inst, in2, out, ARRAY_SIZE(in2));
+	for (size_t i = 0; i < ARRAY_SIZE(ref2); i++) {
+		zassert_within(out[i], ref2[i], 1e-6f, "sample %zu", i);
+	}
+}
+
+ZTEST(zdsp_filtering, test_zdsp_fir_q15)
+{
+	static const q15_t coeffs[] = {0x2000, 0x4000};
+	static const q15_t in1[BLOCK_SIZE] = {0x4000, 0, 0};
+	static const q15_t in2[] = {0x2000, 0};
+	static const q15_t ref1[BLOCK_SIZE] = {0x2000, 0x1000, 0};
+	static const q15_t ref2[] = {0x1000, 0x0800};
+	q15_t state[ARRAY_SIZE(coeffs) + BLOCK_SIZE - 1];
+	struct zdsp_fir_instance_q15 inst;
+	q15_t out[BLOCK_SIZE];
+
+	zdsp_fir_init_q15(&inst, ARRAY_SIZE(coeffs), coeffs, state, BLOCK_SIZE);
+
+	zdsp_fir_q15(&inst, in1, out, ARRAY_SIZE(in1));
+	for (size_t i = 0; i < ARRAY_SIZE(ref1); i++) {
+		zassert_within(out[i], ref1[i], ABS_ERROR_THRESH_Q15, "sample %zu", i);
+	}
+
+	zdsp_fir_q15(&inst, in2, out, ARRAY_SIZE(in2));
+	for (size_t i = 0; i < ARRAY_SIZE(ref2); i++) {
+		zassert_within(out[i], ref2[i], ABS_ERROR_THRESH_Q15, "sample %zu", i);
+	}
+}
+
+ZTEST(zdsp_filtering, test_zdsp_fir_q31)
+{
+	static const q31_t coeffs[] = {0x20000000, 0x40000000};
+	static const q31_t in1[BLOCK_SIZE] = {0x40000000, 0, 0};
+	static const q31_t in2[] = {0x20000000, 0};
+	static const q31_t ref1[BLOCK_SIZE] = {0x20000000, 0x10000000, 0};
+	static const q31_t ref2[] = {0x10000000, 0x08000000};
+	q31_t state[ARRAY_SIZE(coeffs) + BLOCK_SIZE - 1];
+	struct zdsp_fir_instance_q31 inst;
+	q31_t out[BLOCK_SIZE];
+
+	zdsp_fir_init_q31(&inst, ARRAY_SIZE(coeffs), coeffs, state, BLOCK_SIZE);
+
+	zdsp_fir_q31(&inst, in1, out, ARRAY_SIZE(in1));
+	for (size_t i = 0; i < ARRAY_SIZE(ref1); i++) {
+		zassert_within(out[i], ref1[i], ABS_ERROR_THRESH_Q31, "sample %zu", i);
+	}
+
+	zdsp_fir_q31(&inst, in2, out, ARRAY_SIZE(in2));
+	for (size_t i = 0; i < ARRAY_SIZE(ref2); i++) {
+		zassert_within(out[i], ref2[i], ABS_ERROR_THRESH_Q31, "sample %zu", i);
+	}
+}
+
+/* y[n] = 0.5 * x[n] + 0.25 * y[n-1] */
+ZTEST(zdsp_filtering, test_zdsp_biquad_cascade_df1_q15)
+{
+	static const q15_t coeffs[] = {0x4000, 0, 0, 0, 0x2000, 0};
+	static const q15_t in[] = {0x4000, 0, 0, 0};
+	static const q15_t ref[] = {0x2000, 0x0800, 0x0200, 0x0080};
+	q15_t state[4];
+	struct zdsp_biquad_casd_df1_instance_q15 inst;
+	q15_t out[ARRAY_SIZE(in)];
+
+	zdsp_biquad_cascade_df1_init_q15(&inst, 1, coeffs, state, 0);
+
+	/* Two calls, to check that the state is carried over */
+	zdsp_biquad_cascade_df1_q15(&inst, in, out, 2);
+	zdsp_biquad_cascade_df1_q15(&inst, &in[2], &out[2], 2);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ref); i++) {
+		zassert_within(out[i], ref[i], ABS_ERROR_THRESH_Q15, "sample %zu", i);
+	}
+}
+
+ZTEST(zdsp_filtering, test_zdsp_biquad_cascade_df1_q31)
+{
+	static const q31_t coeffs[] = {0x40000000, 0, 0, 0x20000000, 0};
+	static const q31_t in[] = {0x40000000, 0, 0, 0};
+	static const q31_t ref[] = {0x20000000, 0x08000000, 0x02000000, 0x00800000};
+	q31_t state[4];
+	struct zdsp_biquad_casd_df1_instance_q31 inst;
+	q31_t out[ARRAY_SIZE(in)];
+
+	zdsp_biquad_cascade_df1_init_q31(&inst, 1, coeffs, state, 0);
+
+	zdsp_biquad_cascade_df1_q31(&inst, in, out, 2);
+	zdsp_biquad_cascade_df1_q31(&inst, &in[2], &out[2], 2);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ref); i++) {
+		zassert_within(out[i], ref[i], ABS_ERROR_THRESH_Q31, "sample %zu", i);
+	}
+}
+
+ZTEST_SUITE(zdsp_filtering, NULL, NULL, NULL, NULL, NULL);
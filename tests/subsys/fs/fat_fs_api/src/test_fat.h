@@ -50,3 +50,6 @@ void test_fat_rename(void);
 #ifdef CONFIG_FS_FATFS_REENTRANT
 void test_fat_file_reentrant(void);
 #endif /* CONFIG_FS_FATFS_REENTRANT */
+#ifdef CONFIG_FILE_SYSTEM_RTIO
+void test_fat_file_rtio(void);
+#endif /* CONFIG_FILE_SYSTEM_RTIO */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Zephyr contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/fs/fs_rtio.h>
+
+#include "test_fat.h"
+
+#ifdef CONFIG_FILE_SYSTEM_RTIO
+
+#define TEST_FILE_RTIO FATFS_MNTP"/tfrtio.txt"
+
+static struct fs_file_t rtio_filep;
+
+FS_RTIO_IODEV_DEFINE(fat_rtio_iodev, &rtio_filep);
+RTIO_DEFINE(fat_rtio, 3, 3);
+
+/* Submit the prepared chain of n submissions and check their results */
+static void test_rtio_complete(int n, const int *results)
+{
+	struct rtio_cqe *cqe;
+
+	zassert_ok(rtio_submit(&fat_rtio, n));
+
+	for (int i = 0; i < n; i++) {
+		cqe = rtio_cqe_consume_block(&fat_rtio);
+		zassert_equal(cqe->result, results[i], "Submission %d completed with %d", i,
+			      cqe->result);
+		zassert_equal((intptr_t)cqe->userdata, i);
+		rtio_cqe_release(&fat_rtio, cqe);
+	}
+}
+
+static void test_rtio_write_read(void)
+{
+	static const uint8_t tiny_str[] = "tiny";
+	size_t sz = strlen(test_str);
+	char read_buff[80];
+	struct rtio_sqe *sqe;
+	int res;
+
+	TC_PRINT("\nRTIO tests:\n");
+
+	fs_file_t_init(&rtio_filep);
+	res = fs_open(&rtio_filep, TEST_FILE_RTIO, FS_O_CREATE | FS_O_RDWR);
+	zassert_ok(res, "Err: File could not be opened [%d]\n", res);
+
+	TC_PRINT("Write and sync file\n");
+	sqe = rtio_sqe_acquire(&fat_rtio);
+	rtio_sqe_prep_write(sqe, &fat_rtio_iodev, RTIO_PRIO_NORM, (const uint8_t *)test_str, sz,
+			    (void *)0);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&fat_rtio);
+	rtio_sqe_prep_tiny_write(sqe, &fat_rtio_iodev, RTIO_PRIO_NORM, tiny_str,
+				 sizeof(tiny_str) - 1, (void *)1);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&fat_rtio);
+	fs_rtio_sqe_prep_sync(sqe, &fat_rtio_iodev, RTIO_PRIO_NORM, (void *)2);
+	test_rtio_complete(3, (const int[]){sz, sizeof(tiny_str) - 1, 0});
+
+	TC_PRINT("Read file\n");
+	zassert_ok(fs_seek(&rtio_filep, 0, FS_SEEK_SET));
+	memset(read_buff, 0, sizeof(read_buff));
+	sqe = rtio_sqe_acquire(&fat_rtio);
+	rtio_sqe_prep_read(sqe, &fat_rtio_iodev, RTIO_PRIO_NORM, (uint8_t *)read_buff, sz,
+			   (void *)0);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&fat_rtio);
+	rtio_sqe_prep_read(sqe, &fat_rtio_iodev, RTIO_PRIO_NORM, (uint8_t *)&read_buff[sz],
+			   sizeof(read_buff) - sz, (void *)1);
+	test_rtio_complete(2, (const int[]){sz, sizeof(tiny_str) - 1});
+	zassert_mem_equal(read_buff, test_str, sz);
+	zassert_mem_equal(&read_buff[sz], tiny_str, sizeof(tiny_str) - 1);
+
+	TC_PRINT("Read closed file\n");
+	res = fs_close(&rtio_filep);
+	zassert_ok(res, "Error closing file [%d]\n", res);
+	sqe = rtio_sqe_acquire(&fat_rtio);
+	rtio_sqe_prep_read(sqe, &fat_rtio_iodev, RTIO_PRIO_NORM, (uint8_t *)read_buff, sz,
+			   (void *)0);
+	test_rtio_complete(1, (const int[]){-EBADF});
+
+	res = fs_unlink(TEST_FILE_RTIO);
+	zassert_ok(res, "Error deleting file [%d]\n", res);
+}
+
+void test_fat_file_rtio(void)
+{
+	test_rtio_write_read();
+}
+#endif /* CONFIG_FILE_SYSTEM_RTIO */
@@ -422,6 +422,60 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 	check_content(max_id, &fixture->fs);
 }
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+/**
+ * GC done in the background while writes go on, and resumed on mount
+ */
+ZTEST_F(nvs, test_nvs_gc_incremental)
+{
+	int err;
+
+	const uint16_t max_id = 10;
+	/* 75th write will trigger the 1st GC of a closed sector. */
+	const uint16_t max_writes = 51 + 25;
+	const uint16_t max_writes_2 = max_writes + 5;
+	const uint16_t max_writes_3 = max_writes_2 + 50;
+
+	fixture->fs.sector_count = 3;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	write_content(max_id, 0, max_writes, &fixture->fs);
+
+	/* The test thread is cooperative, the GC thread did not run yet */
+	zassert_true(fixture->fs.gc_pending, "GC should be pending");
+	check_content(max_id, &fixture->fs);
+
+	/* Writes done while the GC did not copy anything yet */
+	write_content(max_id, max_writes, max_writes_2, &fixture->fs);
+	zassert_true(fixture->fs.gc_pending, "GC should be pending");
+	check_content(max_id, &fixture->fs);
+
+	/* Mounting resumes the GC */
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+	zassert_false(fixture->fs.gc_pending, "GC should be done");
+	check_content(max_id, &fixture->fs);
+
+	/* Let the GC run in the background between writes */
+	for (uint16_t i = max_writes_2; i < max_writes_3; i++) {
+		write_content(max_id, i, i + 1, &fixture->fs);
+		k_msleep(1);
+	}
+
+	for (int i = 0; (i < 100) && fixture->fs.gc_pending; i++) {
+		k_msleep(1);
+	}
+	zassert_false(fixture->fs.gc_pending, "GC should be done");
+	check_content(max_id, &fixture->fs);
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+	check_content(max_id, &fixture->fs);
+}
+#endif /* CONFIG_NVS_GC_INCREMENTAL */
+
 static int flash_sim_erase_calls_find(struct stats_hdr *hdr, void *arg,
 				      const char *name, uint16_t off)
 {
@@ -520,6 +574,112 @@ ZTEST_F(nvs, test_nvs_corrupted_sector_close_operation)
 	/* Ensure that the NVS is able to store new content. */
 	execute_long_pattern_write(max_id, &fixture->fs);
 }
+
+/*
+ * Test that a delete ate written at the last position of a sector is not lost
+ * when the sector closing operation is interrupted by a power down. The last
+ * ate of the sector then has to be recovered, and the garbage collection
+ * restarted by the mount must not copy the deleted entry back.
+ */
+ZTEST_F(nvs, test_nvs_corrupted_sector_close_delete)
+{
+	int err;
+	ssize_t len;
+	uint8_t buf[96];
+	uint32_t free_space;
+	uint8_t fill = 0U;
+	uint32_t *flash_write_stat;
+	uint32_t *flash_erase_stat;
+	uint32_t *flash_max_write_calls;
+	uint32_t *flash_max_erase_calls;
+	uint32_t *flash_max_len;
+	const size_t ate_size = sizeof(struct nvs_ate);
+
+	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find,
+		   &flash_max_write_calls);
+	stats_walk(fixture->sim_thresholds, flash_sim_max_erase_calls_find,
+		   &flash_max_erase_calls);
+	stats_walk(fixture->sim_thresholds, flash_sim_max_len_find,
+		   &flash_max_len);
+	stats_walk(fixture->sim_stats, flash_sim_write_calls_find, &flash_write_stat);
+	stats_walk(fixture->sim_stats, flash_sim_erase_calls_find, &flash_erase_stat);
+
+	fixture->fs.sector_count = 3;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	/* Entry to be deleted, in sector 0 */
+	memset(buf, TEST_DATA_ID, sizeof(buf));
+	len = nvs_write(&fixture->fs, TEST_DATA_ID, buf, 32);
+	zassert_true(len == 32, "nvs_write failed: %d", len);
+
+	/* Fill sector 0 until it gets closed */
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) == 0U) {
+		memset(buf, fill++, sizeof(buf));
+		len = nvs_write(&fixture->fs, TEST_DATA_ID + 1, buf, 32);
+		zassert_true(len == 32, "nvs_write failed: %d", len);
+	}
+
+	/* Complete the garbage collection, if it is done in the background */
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 1,
+		      "unexpected write sector");
+
+	/* Fill sector 1 so that only the last position is left for an ate */
+	while (true) {
+		free_space = fixture->fs.ate_wra - fixture->fs.data_wra;
+		if (free_space <= ate_size + NVS_DATA_CRC_SIZE + 64) {
+			break;
+		}
+
+		memset(buf, fill++, sizeof(buf));
+		len = nvs_write(&fixture->fs, TEST_DATA_ID + 1, buf, 32);
+		zassert_true(len == 32, "nvs_write failed: %d", len);
+	}
+
+	memset(buf, fill++, sizeof(buf));
+	len = nvs_write(&fixture->fs, TEST_DATA_ID + 1, buf,
+			free_space - ate_size - NVS_DATA_CRC_SIZE);
+	zassert_true(len > 0, "nvs_write failed: %d", len);
+	zassert_equal(fixture->fs.ate_wra, fixture->fs.data_wra,
+		      "sector 1 should be full");
+
+	/* The delete ate takes the last position of sector 1 */
+	err = nvs_delete(&fixture->fs, TEST_DATA_ID);
+	zassert_true(err == 0,  "nvs_delete call failure: %d", err);
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 1,
+		      "unexpected write sector");
+
+	/* Simulate a power down while closing sector 1, so only a part of the
+	 * closing ate is written.
+	 */
+	*flash_write_stat = 0;
+	*flash_erase_stat = 0;
+	*flash_max_write_calls = 1;
+	*flash_max_erase_calls = 1;
+	*flash_max_len = 4;
+
+	(void)nvs_write(&fixture->fs, TEST_DATA_ID + 2, buf, 32);
+
+	/* Make the flash simulator functional again. */
+	*flash_max_write_calls = 0;
+	*flash_max_erase_calls = 0;
+	*flash_max_len = 0;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	len = nvs_read(&fixture->fs, TEST_DATA_ID, buf, sizeof(buf));
+	zassert_true(len == -ENOENT, "deleted entry should not be found: %d", len);
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	len = nvs_read(&fixture->fs, TEST_DATA_ID, buf, sizeof(buf));
+	zassert_true(len == -ENOENT, "deleted entry should not be found: %d", len);
+}
 #endif /* CONFIG_TEST_NVS_SIMULATOR */
 
 /**
@@ -904,6 +1064,66 @@ ZTEST_F(nvs, test_nvs_cache_gc)
 #endif
 }
 
+/*
+ * Test that the full ID lookup cache holds one entry per NVS ID, pointing to
+ * the most recent ATE of that ID.
+ */
+ZTEST_F(nvs, test_nvs_cache_full_id)
+{
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL_ID
+	const uint16_t max_id = CONFIG_NVS_LOOKUP_CACHE_SIZE / 2;
+	int err;
+	size_t num;
+	uint16_t id;
+	uint16_t data;
+	uint32_t addr;
+	struct nvs_ate ate;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (uint16_t i = 0; i < 2 * max_id; i++) {
+		id = i % max_id;
+		data = i;
+
+		err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+
+	for (int pass = 0; pass < 2; pass++) {
+		num = num_occupied_cache_entries(&fixture->fs);
+		zassert_equal(num, max_id, "not one cache entry per ID");
+
+		for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+			addr = fixture->fs.lookup_cache[i];
+			if (addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+				continue;
+			}
+
+			err = flash_read(fixture->fs.flash_device,
+					 fixture->fs.offset +
+						 fixture->fs.sector_size * (addr >> ADDR_SECT_SHIFT) +
+						 (addr & ADDR_OFFS_MASK),
+					 &ate, sizeof(ate));
+			zassert_true(err == 0, "flash_read call failure: %d", err);
+			zassert_equal(ate.id, fixture->fs.lookup_cache_id[i],
+				      "cache entry not pointing to an ATE of its ID");
+		}
+
+		for (id = 0; id < max_id; id++) {
+			err = nvs_read(&fixture->fs, id, &data, sizeof(data));
+			zassert_equal(err, sizeof(data), "nvs_read call failure: %d", err);
+			zassert_equal(data, id + max_id, "incorrect data read");
+		}
+
+		/* Test cache initialization when the store is non-empty */
+		err = nvs_mount(&fixture->fs);
+		zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	}
+#endif
+}
+
 /*
  * Test NVS lookup cache hash quality.
  */
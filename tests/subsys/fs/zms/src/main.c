@@ -686,6 +686,105 @@ ZTEST_F(zms, test_zms_gc_corrupt_ate)
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 }
 
+/*
+ * Test that the mount recovers the first ATE of the write sector. Here the
+ * garbage collection copies a single entry with data to the first position
+ * of the sector, the data write address must be recovered from it.
+ */
+ZTEST_F(zms, test_zms_recover_first_ate)
+{
+	int err;
+	ssize_t len;
+	uint32_t small_data = 0;
+	uint8_t buf[32];
+	uint8_t rd_buf[32];
+
+	fixture->fs.sector_count = 3;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	memset(buf, 0xaa, sizeof(buf));
+	len = zms_write(&fixture->fs, TEST_DATA_ID, buf, sizeof(buf));
+	zassert_true(len == sizeof(buf), "zms_write failed: %d", len);
+
+	/* Small data are stored in their ATE. When the write sector moves to
+	 * sector 2, sector 0 is garbage collected and only TEST_DATA_ID is
+	 * copied, as the latest entry of the other ID is in sector 1.
+	 */
+	while (SECTOR_NUM(fixture->fs.ate_wra) != 2U) {
+		small_data++;
+		len = zms_write(&fixture->fs, TEST_DATA_ID + 1, &small_data, sizeof(small_data));
+		zassert_true(len == sizeof(small_data), "zms_write failed: %d", len);
+	}
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	/* The data of a new entry must not overwrite the data of TEST_DATA_ID */
+	memset(buf, 0x55, sizeof(buf));
+	len = zms_write(&fixture->fs, TEST_DATA_ID + 2, buf, sizeof(buf));
+	zassert_true(len == sizeof(buf), "zms_write failed: %d", len);
+
+	memset(buf, 0xaa, sizeof(buf));
+	len = zms_read(&fixture->fs, TEST_DATA_ID, rd_buf, sizeof(rd_buf));
+	zassert_true(len == sizeof(rd_buf), "zms_read unexpected failure: %d", len);
+	zassert_mem_equal(rd_buf, buf, sizeof(rd_buf), "incorrect data read");
+}
+
+/*
+ * Test the mount when power was lost after a sector was closed but before the
+ * next sector was started, i.e. before its empty ATE was written.
+ */
+ZTEST_F(zms, test_zms_open_sector_not_started)
+{
+	int err;
+	ssize_t len;
+	uint32_t small_data = 0;
+	uint32_t rd_data;
+	const uint32_t data = 0xaa55aa55;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	while (SECTOR_NUM(fixture->fs.ate_wra) != 1U) {
+		small_data++;
+		len = zms_write(&fixture->fs, TEST_DATA_ID, &small_data, sizeof(small_data));
+		zassert_true(len == sizeof(small_data), "zms_write failed: %d", len);
+	}
+
+	/* Sector 0 is closed, bring sector 1 back to its state before it was started */
+	err = flash_flatten(fixture->fs.flash_device, fixture->fs.offset + fixture->fs.sector_size,
+			    fixture->fs.sector_size);
+	zassert_true(err == 0, "flash_flatten failed: %d", err);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_equal(SECTOR_NUM(fixture->fs.ate_wra), 1U, "unexpected write sector");
+
+	/* Fill sector 1, the last value of TEST_DATA_ID goes to sector 2 */
+	while (SECTOR_NUM(fixture->fs.ate_wra) != 2U) {
+		small_data++;
+		len = zms_write(&fixture->fs, TEST_DATA_ID + 1, &small_data, sizeof(small_data));
+		zassert_true(len == sizeof(small_data), "zms_write failed: %d", len);
+	}
+
+	len = zms_write(&fixture->fs, TEST_DATA_ID, &data, sizeof(data));
+	zassert_true(len == sizeof(data), "zms_write failed: %d", len);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_equal(SECTOR_NUM(fixture->fs.ate_wra), 2U, "unexpected write sector");
+
+	len = zms_read(&fixture->fs, TEST_DATA_ID, &rd_data, sizeof(rd_data));
+	zassert_true(len == sizeof(rd_data), "zms_read unexpected failure: %d", len);
+	zassert_equal(rd_data, data, "unexpected value %x", rd_data);
+
+	len = zms_read(&fixture->fs, TEST_DATA_ID + 1, &rd_data, sizeof(rd_data));
+	zassert_true(len == sizeof(rd_data), "zms_read unexpected failure: %d", len);
+	zassert_equal(rd_data, small_data, "unexpected value %x", rd_data);
+}
+
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 static size_t num_matching_cache_entries(uint64_t addr, bool compare_sector_only, struct zms_fs *fs)
 {
@@ -889,3 +988,141 @@ ZTEST_F(zms, test_zms_cache_hash_quality)
 
 #endif
 }
+
+#ifdef CONFIG_ZMS_WRITE_BATCH
+#define TEST_BATCH_COUNT    4
+#define TEST_BATCH_DATA_LEN 32
+
+static void write_batch(struct zms_fs *fs, uint8_t pattern,
+			uint8_t data[TEST_BATCH_COUNT][TEST_BATCH_DATA_LEN])
+{
+	int err;
+	struct zms_batch_entry entries[TEST_BATCH_COUNT];
+
+	for (int i = 0; i < TEST_BATCH_COUNT; i++) {
+		memset(data[i], pattern + i, TEST_BATCH_DATA_LEN);
+		entries[i].id = TEST_DATA_ID + i;
+		entries[i].data = data[i];
+		/* The first entry is small enough to be stored in its ATE */
+		entries[i].len = (i == 0) ? sizeof(uint32_t) : TEST_BATCH_DATA_LEN;
+	}
+
+	err = zms_write_batch(fs, entries, ARRAY_SIZE(entries));
+	zassert_true(err == 0, "zms_write_batch call failure: %d", err);
+}
+
+static void check_batch(struct zms_fs *fs, uint8_t data[TEST_BATCH_COUNT][TEST_BATCH_DATA_LEN])
+{
+	ssize_t len;
+	size_t exp_len;
+	uint8_t rd_buf[TEST_BATCH_DATA_LEN];
+
+	for (int i = 0; i < TEST_BATCH_COUNT; i++) {
+		exp_len = (i == 0) ? sizeof(uint32_t) : TEST_BATCH_DATA_LEN;
+		len = zms_read(fs, TEST_DATA_ID + i, rd_buf, sizeof(rd_buf));
+		zassert_true(len == exp_len, "zms_read unexpected failure: %d", len);
+		zassert_mem_equal(rd_buf, data[i], exp_len, "incorrect data read");
+	}
+}
+#endif
+
+/*
+ * Test that the entries of a batch write can be read, also after a remount, and that an
+ * invalid batch is rejected.
+ */
+ZTEST_F(zms, test_zms_write_batch)
+{
+#ifdef CONFIG_ZMS_WRITE_BATCH
+	int err;
+	ssize_t len;
+	uint8_t rd_buf[TEST_BATCH_DATA_LEN];
+	uint8_t data[TEST_BATCH_COUNT][TEST_BATCH_DATA_LEN];
+	struct zms_batch_entry entry = {.id = TEST_DATA_ID, .data = NULL, .len = 1};
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	err = zms_write_batch(&fixture->fs, &entry, 0);
+	zassert_true(err == -EINVAL, "zms_write_batch unexpected result: %d", err);
+	err = zms_write_batch(&fixture->fs, &entry, 1);
+	zassert_true(err == -EINVAL, "zms_write_batch unexpected result: %d", err);
+
+	write_batch(&fixture->fs, 0x10, data);
+	check_batch(&fixture->fs, data);
+
+	/* Overwrite the batch and delete its last entry */
+	write_batch(&fixture->fs, 0x20, data);
+	entry.id = TEST_DATA_ID + TEST_BATCH_COUNT - 1;
+	entry.len = 0;
+	err = zms_write_batch(&fixture->fs, &entry, 1);
+	zassert_true(err == 0, "zms_write_batch call failure: %d", err);
+
+	/* Reinitialize the ZMS. */
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	len = zms_read(&fixture->fs, entry.id, rd_buf, sizeof(rd_buf));
+	zassert_true(len == -ENOENT, "zms_read unexpected failure: %d", len);
+
+	/* Check the other entries */
+	for (int i = 0; i < TEST_BATCH_COUNT - 1; i++) {
+		size_t exp_len = (i == 0) ? sizeof(uint32_t) : TEST_BATCH_DATA_LEN;
+
+		len = zms_read(&fixture->fs, TEST_DATA_ID + i, rd_buf, sizeof(rd_buf));
+		zassert_true(len == exp_len, "zms_read unexpected failure: %d", len);
+		zassert_mem_equal(rd_buf, data[i], exp_len, "incorrect data read");
+	}
+#endif
+}
+
+/*
+ * Test that a batch write interrupted by a power loss is rolled back at mount.
+ */
+ZTEST_F(zms, test_zms_write_batch_corrupted)
+{
+#if defined(CONFIG_ZMS_WRITE_BATCH) && defined(CONFIG_TEST_ZMS_SIMULATOR)
+	int err;
+	uint8_t data[TEST_BATCH_COUNT][TEST_BATCH_DATA_LEN];
+	uint8_t new_data[TEST_BATCH_COUNT][TEST_BATCH_DATA_LEN];
+	uint32_t *flash_write_stat;
+	uint32_t *flash_max_write_calls;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	write_batch(&fixture->fs, 0x10, data);
+
+	/* Let the flash simulator execute the write of the begin ATE and of the data of
+	 * the second entry only. This should simulate power down during the batch write.
+	 */
+	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find, &flash_max_write_calls);
+	stats_walk(fixture->sim_stats, flash_sim_write_calls_find, &flash_write_stat);
+
+	*flash_write_stat = 0;
+	*flash_max_write_calls = 2;
+
+	write_batch(&fixture->fs, 0x20, new_data);
+
+	*flash_max_write_calls = 0;
+
+	/* Reinitialize the ZMS, which rolls the batch back. */
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_batch(&fixture->fs, data);
+
+	/* The rollback is done only once */
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_batch(&fixture->fs, data);
+
+	/* Writes go on after the rolled back batch */
+	write_batch(&fixture->fs, 0x30, new_data);
+	check_batch(&fixture->fs, new_data);
+#endif
+}
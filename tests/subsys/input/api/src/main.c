@@ -84,6 +84,77 @@ ZTEST(input_api, test_sequence_thread)
 	zassert_equal(message_count_unfiltered, CONFIG_INPUT_QUEUE_MAX_MSGS + 1);
 }
 
+#ifdef CONFIG_INPUT_COALESCE
+
+static const struct device coalesce_dev;
+static struct input_event abs_events[8];
+static int abs_count;
+static struct input_event rel_events[8];
+static int rel_count;
+
+static void input_cb_abs(struct input_event *evt, void *user_data)
+{
+	if (abs_count < ARRAY_SIZE(abs_events)) {
+		abs_events[abs_count] = *evt;
+	}
+	abs_count++;
+}
+INPUT_CALLBACK_DEFINE_TYPES(&coalesce_dev, INPUT_EV_BIT(INPUT_EV_ABS), input_cb_abs, NULL);
+
+static void input_cb_rel(struct input_event *evt, void *user_data)
+{
+	if (rel_count < ARRAY_SIZE(rel_events)) {
+		rel_events[rel_count] = *evt;
+	}
+	rel_count++;
+}
+INPUT_CALLBACK_DEFINE_TYPES(&coalesce_dev, INPUT_EV_BIT(INPUT_EV_REL), input_cb_rel, NULL);
+
+static void check_event(struct input_event *evt, uint16_t code, int32_t value, bool sync)
+{
+	zassert_equal(evt->dev, &coalesce_dev);
+	zassert_equal(evt->code, code);
+	zassert_equal(evt->value, value);
+	zassert_equal(evt->sync, sync);
+}
+
+ZTEST(input_api, test_coalesce)
+{
+	abs_count = 0;
+	rel_count = 0;
+
+	/* The input thread has a lower priority, all the frames get queued */
+	input_report_abs(&coalesce_dev, INPUT_ABS_X, 1, false, K_NO_WAIT);
+	input_report_abs(&coalesce_dev, INPUT_ABS_Y, 1, false, K_NO_WAIT);
+	input_report_key(&coalesce_dev, INPUT_BTN_TOUCH, 1, true, K_NO_WAIT);
+	input_report_abs(&coalesce_dev, INPUT_ABS_X, 2, false, K_NO_WAIT);
+	input_report_abs(&coalesce_dev, INPUT_ABS_Y, 2, true, K_NO_WAIT);
+	input_report_abs(&coalesce_dev, INPUT_ABS_X, 3, false, K_NO_WAIT);
+	input_report_abs(&coalesce_dev, INPUT_ABS_Y, 3, true, K_NO_WAIT);
+	input_report_abs(&coalesce_dev, INPUT_ABS_X, 4, false, K_NO_WAIT);
+	input_report_key(&coalesce_dev, INPUT_BTN_TOUCH, 0, true, K_NO_WAIT);
+
+	k_msleep(10);
+
+	/* The key events are filtered out, their sync flag is kept */
+	zassert_equal(abs_count, 4);
+	check_event(&abs_events[0], INPUT_ABS_X, 1, false);
+	check_event(&abs_events[1], INPUT_ABS_Y, 1, true);
+	check_event(&abs_events[2], INPUT_ABS_X, 4, false);
+	check_event(&abs_events[3], INPUT_ABS_Y, 3, true);
+
+	input_report_rel(&coalesce_dev, INPUT_REL_X, 1, true, K_NO_WAIT);
+	input_report_rel(&coalesce_dev, INPUT_REL_X, 2, true, K_NO_WAIT);
+	input_report_rel(&coalesce_dev, INPUT_REL_X, -5, true, K_NO_WAIT);
+
+	k_msleep(10);
+
+	zassert_equal(rel_count, 1);
+	check_event(&rel_events[0], INPUT_REL_X, -2, true);
+}
+
+#endif /* CONFIG_INPUT_COALESCE */
+
 #else /* CONFIG_INPUT_MODE_THREAD */
 
 static void input_cb_filtered(struct input_event *evt, void *user_data)
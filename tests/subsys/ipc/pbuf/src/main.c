@@ -106,6 +106,65 @@ ZTEST(test_pbuf, test_rw)
 	zassert_mem_equal(write_buf, read_buf, MPS);
 }
 
+/* Deferred write and in-place read tests. */
+ZTEST(test_pbuf, test_defer_inplace)
+{
+	uint8_t read_buf[MEM_AREA_SZ] = {0};
+	uint8_t write_buf[MEM_AREA_SZ];
+	volatile char *buf;
+	uint16_t len;
+	int ret;
+
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+
+	/* Deferred packets are not visible until committed. */
+	ret = pbuf_write_defer(&pb, write_buf, MSGA_SZ);
+	zassert_equal(ret, MSGA_SZ);
+	ret = pbuf_write_defer(&pb, write_buf+MSGA_SZ, MSGB_SZ);
+	zassert_equal(ret, MSGB_SZ);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+	zassert_equal(pbuf_read_inplace(&pb, &buf, &len), 0);
+
+	pbuf_write_commit(&pb);
+
+	/* The packet stays in the buffer until released. */
+	ret = pbuf_read_inplace(&pb, &buf, &len);
+	zassert_equal(ret, MSGA_SZ);
+	zassert_equal(len, MSGA_SZ);
+	zassert_mem_equal((const void *)buf, write_buf, MSGA_SZ);
+	zassert_equal(pbuf_read(&pb, NULL, 0), MSGA_SZ);
+	zassert_equal(pbuf_read_inplace_release(&pb, len), 0);
+
+	ret = pbuf_read_inplace(&pb, &buf, &len);
+	zassert_equal(ret, MSGB_SZ);
+	zassert_mem_equal((const void *)buf, write_buf+MSGA_SZ, MSGB_SZ);
+	zassert_equal(pbuf_read_inplace_release(&pb, len), 0);
+
+	zassert_equal(pbuf_read_inplace(&pb, &buf, &len), 0);
+
+	/* Wrapped packet must be copied. */
+	ret = pbuf_write(&pb, write_buf, MPS);
+	zassert_equal(ret, MPS);
+	zassert_equal(pbuf_read_inplace(&pb, &buf, &len), -EFBIG);
+	ret = pbuf_read(&pb, read_buf, sizeof(read_buf));
+	zassert_equal(ret, MPS);
+	zassert_mem_equal(read_buf, write_buf, MPS);
+
+	zassert_equal(pbuf_read_inplace(NULL, &buf, &len), -EINVAL);
+	zassert_equal(pbuf_read_inplace(&pb, NULL, &len), -EINVAL);
+	zassert_equal(pbuf_read_inplace_release(NULL, 0), -EINVAL);
+}
+
 /* API ret codes tests. */
 ZTEST(test_pbuf, test_retcodes)
 {
@@ -196,6 +196,18 @@ static void process(const struct log_backend *const backend,
 			str, exp->str);
 }
 
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+static void process_batch(const struct log_backend *const backend,
+			  union log_msg_generic **msgs, size_t cnt)
+{
+	zassert_true(cnt > 0 && cnt <= CONFIG_LOG_PROCESS_BATCH_SIZE, "Unexpected batch: %zu", cnt);
+
+	for (size_t i = 0; i < cnt; i++) {
+		process(backend, msgs[i]);
+	}
+}
+#endif
+
 static void mock_init(struct log_backend const *const backend)
 {
 
@@ -230,6 +242,9 @@ static void notify(const struct log_backend *const backend,
 
 const struct log_backend_api mock_log_backend_api = {
 	.process = process,
+#if CONFIG_LOG_PROCESS_BATCH_SIZE > 1
+	.process_batch = process_batch,
+#endif
 	.panic = panic,
 	.init = mock_init,
 	.dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? NULL : dropped,
@@ -0,0 +1,260 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+#include <zephyr/mgmt/mcumgr/transport/smp_dummy.h>
+#include <zephyr/mgmt/mcumgr/mgmt/callbacks.h>
+#include <zephyr/mgmt/mcumgr/grp/img_mgmt/img_mgmt.h>
+#include <zephyr/mgmt/mcumgr/grp/img_mgmt/img_mgmt_callbacks.h>
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+#include <mgmt/mcumgr/util/zcbor_bulk.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <smp_internal.h>
+#include "smp_test_util.h"
+
+#define SMP_RESPONSE_WAIT_TIME 3
+#define ZCBOR_BUFFER_SIZE 256
+#define OUTPUT_BUFFER_SIZE 512
+#define ZCBOR_HISTORY_ARRAY_SIZE 10
+
+#define CHUNK_SIZE 64
+#define CHUNK_COUNT 3
+#define IMAGE_SIZE (CHUNK_SIZE * CHUNK_COUNT)
+#define NO_REJECT SIZE_MAX
+#define REJECT_RET IMG_MGMT_ERR_INVALID_IMAGE_DATA_OVERRUN
+
+static struct net_buf *nb;
+static uint8_t image_data[IMAGE_SIZE];
+static size_t chunk_offs[CHUNK_COUNT * 2];
+static uint8_t chunk_count;
+static uint8_t write_complete_count;
+static bool pending_got;
+static size_t reject_off = NO_REJECT;
+
+struct upload_rsp_t {
+	size_t off;
+	bool off_received;
+	uint32_t err_group;
+	uint32_t err_rc;
+	bool err_received;
+};
+
+static enum mgmt_cb_return upload_callback(uint32_t event, enum mgmt_cb_return prev_status,
+					   int32_t *rc, uint16_t *group, bool *abort_more,
+					   void *data, size_t data_size)
+{
+	if (event == MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK) {
+		struct img_mgmt_upload_check *check = (struct img_mgmt_upload_check *)data;
+
+		if (chunk_count < ARRAY_SIZE(chunk_offs)) {
+			chunk_offs[chunk_count] = check->req->off;
+		}
+
+		++chunk_count;
+
+		if (check->req->off == reject_off) {
+			*group = MGMT_GROUP_ID_IMAGE;
+			*rc = REJECT_RET;
+			return MGMT_CB_ERROR_ERR;
+		}
+	} else if (event == MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK_WRITE_COMPLETE) {
+		++write_complete_count;
+	} else if (event == MGMT_EVT_OP_IMG_MGMT_DFU_PENDING) {
+		pending_got = true;
+	}
+
+	return MGMT_CB_OK;
+}
+
+static struct mgmt_callback upload_callback_struct = {
+	.callback = upload_callback,
+	.event_id = (MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK | MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK_WRITE_COMPLETE |
+		     MGMT_EVT_OP_IMG_MGMT_DFU_PENDING),
+};
+
+static bool parse_err(zcbor_state_t *state, void *user_data)
+{
+	struct upload_rsp_t *rsp = (struct upload_rsp_t *)user_data;
+	size_t decoded = 0;
+	struct zcbor_map_decode_key_val err_decode[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("group", zcbor_uint32_decode, &rsp->err_group),
+		ZCBOR_MAP_DECODE_KEY_DECODER("rc", zcbor_uint32_decode, &rsp->err_rc),
+	};
+
+	return zcbor_map_decode_bulk(state, err_decode, ARRAY_SIZE(err_decode), &decoded) == 0 &&
+	       decoded == 2;
+}
+
+static void send_chunk(uint8_t chunk, struct upload_rsp_t *rsp)
+{
+	uint8_t buffer[ZCBOR_BUFFER_SIZE];
+	uint8_t buffer_out[OUTPUT_BUFFER_SIZE];
+	bool ok;
+	uint16_t buffer_size = 0;
+	zcbor_state_t zse[ZCBOR_HISTORY_ARRAY_SIZE] = { 0 };
+	zcbor_state_t zsd[ZCBOR_HISTORY_ARRAY_SIZE] = { 0 };
+	bool received;
+	struct smp_hdr *header;
+	size_t decoded = 0;
+	size_t off = chunk * CHUNK_SIZE;
+
+	struct zcbor_map_decode_key_val output_decode[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_size_decode, &rsp->off),
+		ZCBOR_MAP_DECODE_KEY_DECODER("err", parse_err, rsp),
+	};
+
+	memset(rsp, 0, sizeof(*rsp));
+	zcbor_new_encode_state(zse, 2, buffer, ARRAY_SIZE(buffer), 0);
+
+	ok = create_img_mgmt_upload_packet(zse, buffer, buffer_out, &buffer_size, off,
+					   &image_data[off], CHUNK_SIZE, IMAGE_SIZE);
+	zassert_true(ok, "Expected packet creation to be successful");
+
+	/* Enable dummy SMP backend and ready for usage */
+	smp_dummy_enable();
+	smp_dummy_clear_state();
+
+	/* Send upload command to dummy SMP backend */
+	(void)smp_dummy_tx_pkt(buffer_out, buffer_size);
+	smp_dummy_add_data();
+
+	/* Wait for a short duration to see if response has been received */
+	received = smp_dummy_wait_for_data(SMP_RESPONSE_WAIT_TIME);
+	zassert_true(received, "Expected to receive data but timed out");
+
+	/* Retrieve response buffer */
+	nb = smp_dummy_get_outgoing();
+	smp_dummy_disable();
+
+	header = net_buf_pull_mem(nb, sizeof(struct smp_hdr));
+	zassert_equal(header->nh_op, MGMT_OP_WRITE_RSP, "SMP header operation mismatch");
+	zassert_equal(header->nh_id, IMG_MGMT_ID_UPLOAD, "SMP header command ID mismatch");
+
+	zcbor_new_decode_state(zsd, 8, nb->data, nb->len, 1, NULL, 0);
+	ok = zcbor_map_decode_bulk(zsd, output_decode, ARRAY_SIZE(output_decode), &decoded) == 0;
+	zassert_true(ok, "Expected decode to be successful");
+
+	rsp->off_received = zcbor_map_decode_bulk_key_found(output_decode,
+							    ARRAY_SIZE(output_decode), "off");
+	rsp->err_received = zcbor_map_decode_bulk_key_found(output_decode,
+							    ARRAY_SIZE(output_decode), "err");
+
+	net_buf_unref(nb);
+	nb = NULL;
+}
+
+static void *setup_test(void)
+{
+	for (size_t i = 0; i < sizeof(image_data); i++) {
+		image_data[i] = (uint8_t)(i * 7U + 1U);
+	}
+
+	/* The first chunk has to start with an image header */
+	sys_put_le32(IMAGE_MAGIC, image_data);
+
+	mgmt_callback_register(&upload_callback_struct);
+
+	return NULL;
+}
+
+static void cleanup_test(void *p)
+{
+	if (nb != NULL) {
+		net_buf_unref(nb);
+		nb = NULL;
+	}
+
+	memset(chunk_offs, 0, sizeof(chunk_offs));
+	chunk_count = 0;
+	write_complete_count = 0;
+	pending_got = false;
+	reject_off = NO_REJECT;
+}
+
+ZTEST(img_mgmt_upload_window, test_out_of_order)
+{
+	struct upload_rsp_t rsp;
+	const struct flash_area *fa;
+	uint8_t read_back[IMAGE_SIZE];
+	int rc;
+
+	send_chunk(0, &rsp);
+	zassert_false(rsp.err_received, "Did not expect an error");
+	zassert_true(rsp.off_received, "Expected offset in response");
+	zassert_equal(rsp.off, CHUNK_SIZE, "Expected data mismatch");
+	zassert_equal(write_complete_count, 1, "Expected write complete callback");
+
+	/* Kept, the response still reports the contiguous offset written */
+	send_chunk(2, &rsp);
+	zassert_false(rsp.err_received, "Did not expect an error");
+	zassert_equal(rsp.off, CHUNK_SIZE, "Expected data mismatch");
+	zassert_equal(chunk_count, 2, "Expected the chunk to be checked before being kept");
+	zassert_equal(chunk_offs[1], 2 * CHUNK_SIZE, "Expected data mismatch");
+	zassert_equal(write_complete_count, 1, "Did not expect kept chunk to be written");
+
+	/* Writes the missing chunk and the one kept */
+	send_chunk(1, &rsp);
+	zassert_false(rsp.err_received, "Did not expect an error");
+	zassert_equal(rsp.off, IMAGE_SIZE, "Expected data mismatch");
+	zassert_equal(chunk_count, 3, "Did not expect kept chunk to be checked again");
+	zassert_equal(chunk_offs[2], CHUNK_SIZE, "Expected data mismatch");
+	zassert_equal(write_complete_count, 2, "Expected write complete callback");
+	zassert_true(pending_got, "Expected pending callback");
+
+	rc = flash_area_open(FIXED_PARTITION_ID(slot1_partition), &fa);
+	zassert_ok(rc, "Expected flash area open to be successful");
+	rc = flash_area_read(fa, 0, read_back, sizeof(read_back));
+	flash_area_close(fa);
+	zassert_ok(rc, "Expected flash area read to be successful");
+	zassert_mem_equal(read_back, image_data, sizeof(image_data), "Expected data mismatch");
+}
+
+ZTEST(img_mgmt_upload_window, test_out_of_order_rejected)
+{
+	struct upload_rsp_t rsp;
+
+	send_chunk(0, &rsp);
+	zassert_false(rsp.err_received, "Did not expect an error");
+	zassert_equal(rsp.off, CHUNK_SIZE, "Expected data mismatch");
+
+	reject_off = 2 * CHUNK_SIZE;
+
+	/* Rejected by the application before being kept */
+	send_chunk(2, &rsp);
+	zassert_true(rsp.err_received, "Expected an error");
+	zassert_equal(rsp.err_group, MGMT_GROUP_ID_IMAGE, "Expected data mismatch");
+	zassert_equal(rsp.err_rc, REJECT_RET, "Expected data mismatch");
+	zassert_equal(chunk_count, 2, "Expected the chunk to be checked");
+	zassert_equal(chunk_offs[1], 2 * CHUNK_SIZE, "Expected data mismatch");
+
+	/* The rejected chunk was not kept, so it is not written after the missing one */
+	send_chunk(1, &rsp);
+	zassert_false(rsp.err_received, "Did not expect an error");
+	zassert_equal(rsp.off, 2 * CHUNK_SIZE, "Expected data mismatch");
+	zassert_equal(write_complete_count, 2, "Expected write complete callbacks");
+	zassert_false(pending_got, "Did not expect pending callback");
+
+	/* Sent again in order, the application rejects it once more */
+	send_chunk(2, &rsp);
+	zassert_true(rsp.err_received, "Expected an error");
+	zassert_equal(chunk_count, 4, "Expected the chunk to be checked");
+	zassert_false(pending_got, "Did not expect pending callback");
+
+	reject_off = NO_REJECT;
+
+	send_chunk(2, &rsp);
+	zassert_false(rsp.err_received, "Did not expect an error");
+	zassert_equal(rsp.off, IMAGE_SIZE, "Expected data mismatch");
+	zassert_true(pending_got, "Expected pending callback");
+}
+
+ZTEST_SUITE(img_mgmt_upload_window, NULL, setup_test, NULL, cleanup_test, NULL);
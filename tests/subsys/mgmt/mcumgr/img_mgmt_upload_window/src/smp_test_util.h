@@ -0,0 +1,22 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef H_SMP_TEST_UTIL_
+#define H_SMP_TEST_UTIL_
+
+#include <zephyr/ztest.h>
+#include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+#include <zcbor_common.h>
+#include <smp_internal.h>
+
+/* Function for creating an img_mgmt upload command, the image size is only sent with the
+ * first chunk
+ */
+bool create_img_mgmt_upload_packet(zcbor_state_t *zse, uint8_t *buffer, uint8_t *output_buffer,
+				   uint16_t *buffer_size, size_t off, const uint8_t *data,
+				   size_t data_len, size_t image_size);
+
+#endif
@@ -875,15 +875,18 @@ ZTEST(modem_cmux, test_modem_cmux_split_large_data)
 
 	ret = modem_pipe_transmit(dlci2_pipe, cmux_frame_data_large,
 				  sizeof(cmux_frame_data_large));
-	zassert_true(ret == CONFIG_MODEM_CMUX_MTU, "Failed to split large data %d", ret);
+	zassert_true(ret == sizeof(cmux_frame_data_large), "Failed to split large data %d", ret);
 
 	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI2_TRANSMIT_IDLE, false, K_MSEC(200));
 	zassert_equal(events, EVENT_CMUX_DLCI2_TRANSMIT_IDLE,
 		      "Transmit idle event not received for DLCI2 pipe");
 
+	/* Split in one frame of MTU bytes and one frame of the remaining bytes */
 	ret = modem_backend_mock_get(&bus_mock, buffer2, sizeof(buffer2));
-	zassert_true(ret == CONFIG_MODEM_CMUX_MTU + CMUX_BASIC_HRD_SMALL_SIZE,
+	zassert_true(ret == sizeof(cmux_frame_data_large) + 2 * CMUX_BASIC_HRD_SMALL_SIZE,
 		     "Incorrect number of bytes transmitted %d", ret);
+	zassert_equal(buffer2[CONFIG_MODEM_CMUX_MTU + CMUX_BASIC_HRD_SMALL_SIZE], 0xF9,
+		      "Second frame not found");
 }
 
 ZTEST_SUITE(modem_cmux, NULL, test_modem_cmux_setup, test_modem_cmux_before, NULL, NULL);
@@ -314,6 +314,51 @@ ZTEST(device_runtime_api, test_pm_device_runtime_auto)
 	zassert_equal(pm_device_runtime_put(dev), 0, "");
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+static size_t delay_dev_suspends;
+
+static int delay_dev_pm_control(const struct device *dev, enum pm_device_action action)
+{
+	ARG_UNUSED(dev);
+
+	if (action == PM_DEVICE_ACTION_SUSPEND) {
+		delay_dev_suspends++;
+	}
+
+	return 0;
+}
+
+PM_DEVICE_DT_DEFINE(DT_NODELABEL(test_dev_delay), delay_dev_pm_control);
+DEVICE_DT_DEFINE(DT_NODELABEL(test_dev_delay), NULL,
+		 PM_DEVICE_DT_GET(DT_NODELABEL(test_dev_delay)), NULL, NULL, POST_KERNEL, 80,
+		 NULL);
+
+ZTEST(device_runtime_api, test_pm_device_runtime_suspend_delay)
+{
+	const struct device *const dev = DEVICE_DT_GET(DT_NODELABEL(test_dev_delay));
+	enum pm_device_state state;
+
+	delay_dev_suspends = 0;
+
+	/* burst of get/put calls, the suspend is deferred and coalesced */
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(pm_device_runtime_get(dev), 0, "");
+		zassert_equal(pm_device_runtime_put(dev), 0, "");
+
+		(void)pm_device_state_get(dev, &state);
+		zassert_equal(state, PM_DEVICE_STATE_SUSPENDING, "");
+	}
+
+	zassert_equal(delay_dev_suspends, 0, "");
+
+	k_sleep(K_MSEC(20));
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED, "");
+	zassert_equal(delay_dev_suspends, 1, "");
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+
 void *device_runtime_api_setup(void)
 {
 	test_dev = device_get_binding("test_driver");
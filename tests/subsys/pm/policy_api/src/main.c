@@ -275,6 +275,61 @@ ZTEST(policy_api, test_pm_policy_next_state_default_latency)
 }
 #endif /* CONFIG_PM_POLICY_DEFAULT */
 
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+static void idle_history_fill(const uint32_t *idle_us, size_t count)
+{
+	for (size_t i = 0; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+		pm_policy_idle_exit(0U, idle_us[i % count]);
+	}
+}
+
+/**
+ * @brief Test the idle duration prediction when
+ * CONFIG_PM_POLICY_PREDICTIVE=y.
+ *
+ * The test does not block, so that the idle thread does not record idle
+ * periods in between.
+ */
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	static const uint32_t regular[] = {2000};
+	static const uint32_t outlier[] = {2000, 2000, 2000, 2000, 2000, 2000, 2000, 1000000};
+	static const uint32_t irregular[] = {1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000};
+	const struct pm_state_info *next;
+
+	BUILD_ASSERT(CONFIG_PM_POLICY_PREDICTIVE_HISTORY == ARRAY_SIZE(outlier));
+
+	/* Short regular idle periods, shallower than the kernel timeout allows */
+	idle_history_fill(regular, ARRAY_SIZE(regular));
+	zassert_equal(pm_policy_predicted_ticks(0U, K_TICKS_FOREVER),
+		      k_us_to_ticks_floor32(2000));
+	zassert_equal(pm_policy_predicted_ticks(0U, 1), 1);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_is_null(next);
+
+	/* A single long period is discarded */
+	idle_history_fill(outlier, ARRAY_SIZE(outlier));
+	zassert_equal(pm_policy_predicted_ticks(0U, K_TICKS_FOREVER),
+		      k_us_to_ticks_floor32(2000));
+
+	/* No prediction, the kernel timeout is used */
+	idle_history_fill(irregular, ARRAY_SIZE(irregular));
+	zassert_equal(pm_policy_predicted_ticks(0U, K_TICKS_FOREVER), K_TICKS_FOREVER);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* Long regular idle periods */
+	idle_history_fill((const uint32_t[]){1200000}, 1);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+}
+#else
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
 #ifdef CONFIG_PM_POLICY_CUSTOM
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 {
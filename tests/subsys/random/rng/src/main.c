@@ -16,6 +16,7 @@
 #include <zephyr/ztest.h>
 #include <kernel_internal.h>
 #include <zephyr/random/random.h>
+#include <zephyr/irq_offload.h>
 
 #define N_VALUES 10
 
@@ -121,4 +122,33 @@ ZTEST(rng_common, test_rand32)
 #endif /* CONFIG_CSPRNG_ENABLED */
 }
 
+#if defined(CONFIG_CS_CTR_DRBG_ENTROPY_POOL_SIZE) && (CONFIG_CS_CTR_DRBG_ENTROPY_POOL_SIZE > 0)
+static uint32_t isr_buf[N_VALUES];
+static int isr_err;
+
+static void csrand_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	isr_err = sys_csrand_get(isr_buf, sizeof(isr_buf));
+}
+
+ZTEST(rng_common, test_csrand_isr)
+{
+	uint32_t zero[N_VALUES] = {0};
+
+	/* The entropy pool is refilled in the background, give it some time */
+	for (int i = 0; i < 100; i++) {
+		irq_offload(csrand_isr, NULL);
+		if (isr_err != -EAGAIN) {
+			break;
+		}
+		k_msleep(10);
+	}
+
+	zassert_equal(isr_err, 0, "sys_csrand_get from ISR returned %d", isr_err);
+	zassert_true(memcmp(isr_buf, zero, sizeof(zero)) != 0, "no random data from ISR");
+}
+#endif
+
 ZTEST_SUITE(rng_common, NULL, NULL, NULL, NULL, NULL);
@@ -235,6 +235,82 @@ ZTEST(rtio_api, test_rtio_multiple_chains)
 	test_rtio_multiple_chains_(&r_multi_chain);
 }
 
+#ifdef CONFIG_RTIO_MULTI_PRODUCER
+RTIO_DEFINE(r_producers, SQE_POOL_SIZE, CQE_POOL_SIZE);
+
+RTIO_IODEV_TEST_DEFINE(iodev_test_producer0);
+RTIO_IODEV_TEST_DEFINE(iodev_test_producer1);
+
+static K_THREAD_STACK_DEFINE(producer_stack, 1024);
+static struct k_thread producer_thread;
+static K_SEM_DEFINE(producer_sem0, 0, 1);
+static K_SEM_DEFINE(producer_sem1, 0, 1);
+
+static void producer_chain(struct rtio *r, struct rtio_iodev *iodev, uintptr_t userdata,
+			   struct k_sem *give, struct k_sem *take)
+{
+	struct rtio_sqe *sqe;
+
+	for (int j = 0; j < 2; j++) {
+		sqe = rtio_sqe_acquire(r);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, iodev, (void *)(userdata + j));
+		if (j == 0) {
+			sqe->flags |= RTIO_SQE_CHAINED;
+		}
+
+		/* Interleave the acquisitions of both producers */
+		k_sem_give(give);
+		k_sem_take(take, K_FOREVER);
+	}
+
+	zassert_ok(rtio_submit(r, 0));
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	producer_chain(p1, (struct rtio_iodev *)&iodev_test_producer1, 2,
+		       &producer_sem1, &producer_sem0);
+	k_sem_give(&producer_sem1);
+}
+
+/**
+ * @brief Test chains acquired at the same time by two threads sharing a context
+ */
+ZTEST(rtio_api, test_rtio_multi_producer)
+{
+	struct rtio *r = &r_producers;
+	struct rtio_cqe *cqe;
+	bool seen[4] = { 0 };
+
+	rtio_iodev_test_init(&iodev_test_producer0);
+	rtio_iodev_test_init(&iodev_test_producer1);
+
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer_entry, r, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_sem_take(&producer_sem1, K_FOREVER);
+	producer_chain(r, (struct rtio_iodev *)&iodev_test_producer0, 0,
+		       &producer_sem0, &producer_sem1);
+	k_thread_join(&producer_thread, K_FOREVER);
+
+	for (int i = 0; i < 4; i++) {
+		cqe = rtio_cqe_consume_block(r);
+		zassert_ok(cqe->result, "Result should be ok");
+		seen[(uintptr_t)cqe->userdata] = true;
+		if (seen[1]) {
+			zassert_true(seen[0], "Should see 0 before 1");
+		}
+		if (seen[3]) {
+			zassert_true(seen[2], "Should see 2 before 3");
+		}
+		rtio_cqe_release(r, cqe);
+	}
+
+	zassert_equal(rtio_sqe_acquirable(r), SQE_POOL_SIZE, "Expected all sqes released");
+}
+#endif /* CONFIG_RTIO_MULTI_PRODUCER */
+
 #ifdef CONFIG_USERSPACE
 struct k_mem_domain rtio_domain;
 #endif
@@ -324,6 +400,118 @@ ZTEST_USER(rtio_api, test_rtio_simple_mempool)
 	}
 }
 
+RTIO_DEFINE_WITH_RING_MEMPOOL(r_ring, SQE_POOL_SIZE, CQE_POOL_SIZE, MEM_BLK_COUNT,
+			      MEM_BLK_SIZE, MEM_BLK_ALIGN);
+
+/* Read a mempool buffer from the test iodev, leaving it lent */
+static uint8_t *test_rtio_mempool_read(struct rtio *r)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint8_t *buffer = NULL;
+	uint32_t buffer_len = 0;
+
+	sqe = rtio_sqe_acquire(r);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_read_with_pool(sqe, (struct rtio_iodev *)&iodev_test_simple, 0,
+				     mempool_data);
+	zassert_ok(rtio_submit(r, 1));
+
+	cqe = rtio_cqe_consume(r);
+	zassert_not_null(cqe, "Expected a valid cqe");
+	zassert_ok(cqe->result, "Result should be ok");
+	zassert_ok(rtio_cqe_get_mempool_buffer(r, cqe, &buffer, &buffer_len));
+	zassert_equal(buffer_len, MEM_BLK_SIZE);
+	rtio_cqe_release(r, cqe);
+
+	return buffer;
+}
+
+/**
+ * @brief Test that a ring mempool lends consecutive blocks, wrapping around
+ */
+ZTEST(rtio_api, test_rtio_ring_mempool)
+{
+	uint8_t *buffers[MEM_BLK_COUNT];
+	uint8_t *buffer;
+
+	rtio_iodev_test_init(&iodev_test_simple);
+
+	for (int i = 0; i < MEM_BLK_COUNT - 1; i++) {
+		buffers[i] = test_rtio_mempool_read(&r_ring);
+		if (i > 0) {
+			zassert_equal_ptr(buffers[i], buffers[i - 1] + MEM_BLK_SIZE,
+					  "Expected the block following the previous buffer");
+		}
+	}
+
+	/* Released first, the first block is not reused before the end of the ring */
+	rtio_release_buffer(&r_ring, buffers[0], MEM_BLK_SIZE);
+	buffers[MEM_BLK_COUNT - 1] = test_rtio_mempool_read(&r_ring);
+	zassert_equal_ptr(buffers[MEM_BLK_COUNT - 1], buffers[MEM_BLK_COUNT - 2] + MEM_BLK_SIZE,
+			  "Expected the last block of the ring");
+
+	buffer = test_rtio_mempool_read(&r_ring);
+	zassert_equal_ptr(buffer, buffers[0], "Expected the ring to wrap around");
+
+	rtio_release_buffer(&r_ring, buffer, MEM_BLK_SIZE);
+	for (int i = 1; i < MEM_BLK_COUNT; i++) {
+		rtio_release_buffer(&r_ring, buffers[i], MEM_BLK_SIZE);
+	}
+}
+
+#ifdef CONFIG_RTIO_MEMPOOL_STATS
+/**
+ * @brief Test the accounting of the buffers lent by a mempool
+ *
+ * Each read of the test iodev takes two blocks of r_simple.
+ */
+ZTEST(rtio_api, test_rtio_mempool_stats)
+{
+	struct rtio_mempool_stats stats;
+	uint32_t lent_blocks;
+	uint8_t *buffers[2];
+
+	rtio_iodev_test_init(&iodev_test_simple);
+	rtio_mempool_stats_reset(&r_simple);
+	zassert_ok(rtio_mempool_stats_get(&r_simple, &stats));
+	lent_blocks = stats.blocks;
+
+	buffers[0] = test_rtio_mempool_read(&r_simple);
+	buffers[1] = test_rtio_mempool_read(&r_simple);
+
+	zassert_ok(rtio_mempool_stats_get(&r_simple, &stats));
+	zassert_equal(stats.blocks, lent_blocks + 4);
+	zassert_equal(stats.blocks_max, lent_blocks + 4);
+	zassert_equal(stats.released, 0);
+	zassert_equal_ptr(stats.iodevs[0].iodev, &iodev_test_simple);
+	zassert_equal(stats.iodevs[0].blocks, lent_blocks + 4);
+	zassert_equal(stats.iodevs[0].lent, 2);
+	zassert_is_null(stats.iodevs[1].iodev);
+
+	k_sleep(K_MSEC(1));
+	rtio_release_buffer(&r_simple, buffers[0], MEM_BLK_SIZE);
+	rtio_release_buffer(&r_simple, buffers[1], MEM_BLK_SIZE);
+
+	zassert_ok(rtio_mempool_stats_get(&r_simple, &stats));
+	zassert_equal(stats.blocks, lent_blocks);
+	zassert_equal(stats.blocks_max, lent_blocks + 4);
+	zassert_equal(stats.released, 2);
+	zassert_equal(stats.iodevs[0].blocks, lent_blocks);
+	zassert_equal(stats.iodevs[0].blocks_max, lent_blocks + 4);
+	zassert_true(stats.release_latency_max_us > 0, "Expected a release latency");
+	zassert_true(stats.release_latency_total_us >= stats.release_latency_max_us);
+
+	rtio_mempool_stats_reset(&r_simple);
+	zassert_ok(rtio_mempool_stats_get(&r_simple, &stats));
+	zassert_equal(stats.blocks_max, lent_blocks);
+	zassert_equal(stats.released, 0);
+	zassert_equal(stats.iodevs[0].lent, 0);
+
+	zassert_equal(rtio_mempool_stats_get(&r_chain, &stats), -EINVAL);
+}
+#endif /* CONFIG_RTIO_MEMPOOL_STATS */
+
 static void test_rtio_simple_cancel_(struct rtio *r)
 {
 	struct rtio_sqe sqe[SQE_POOL_SIZE];
@@ -23,6 +23,7 @@ static struct k_work_delayable pending_store;
 #define TEST_STORE_ITR           (5)
 #define TEST_TIMEOUT_SEC         (60)
 #define TEST_SETTINGS_WORKQ_PRIO (1)
+#define TEST_LOAD_COUNT          (16)
 
 static void bt_scan_cb([[maybe_unused]] const bt_addr_le_t *addr, [[maybe_unused]] int8_t rssi,
 		       [[maybe_unused]] uint8_t adv_type, struct net_buf_simple *buf)
@@ -132,3 +133,136 @@ ZTEST(settings_perf, test_performance)
 		zassert_equal(err, 0, "Scanning failed to stop (err %d)\n", err);
 	}
 }
+
+static int load_direct_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			  void *param)
+{
+	uint32_t *val = param;
+	const char *next;
+
+	if (settings_name_next(key, &next) != 0) {
+		return 0;
+	}
+
+	return (read_cb(cb_arg, val, sizeof(*val)) == sizeof(*val)) ? 0 : -EIO;
+}
+
+/* Compares the time taken to load a few settings by replaying the stored
+ * settings through a subtree load, as done at boot, with the time taken to
+ * look them up directly by name.
+ */
+ZTEST(settings_perf, test_load_performance)
+{
+	char path[20];
+	uint32_t val;
+	int64_t ts;
+	uint32_t replay_ms, load_one_ms, load_all_ms;
+	int err;
+
+	err = settings_subsys_init();
+	zassert_equal(err, 0, "settings_backend_init failed %d", err);
+
+	for (int i = 0; i < TEST_SETTINGS_COUNT; i++) {
+		val = i;
+		snprintk(path, sizeof(path), "ld/%04x", i);
+		err = settings_save_one(path, &val, sizeof(val));
+		zassert_equal(err, 0, "settings_save_one failed %d", err);
+	}
+
+	ts = k_uptime_get();
+	err = settings_load();
+	load_all_ms = k_uptime_delta(&ts);
+	zassert_equal(err, 0, "settings_load failed %d", err);
+
+	ts = k_uptime_get();
+	for (int i = 0; i < TEST_LOAD_COUNT; i++) {
+		val = UINT32_MAX;
+		snprintk(path, sizeof(path), "ld/%04x", i);
+		err = settings_load_subtree_direct(path, load_direct_cb, &val);
+		zassert_equal(err, 0, "settings_load_subtree_direct failed %d", err);
+		zassert_equal(val, i, "wrong value loaded");
+	}
+	replay_ms = k_uptime_delta(&ts);
+
+	ts = k_uptime_get();
+	for (int i = 0; i < TEST_LOAD_COUNT; i++) {
+		val = UINT32_MAX;
+		snprintk(path, sizeof(path), "ld/%04x", i);
+		err = settings_load_one(path, &val, sizeof(val));
+		zassert_equal(err, sizeof(val), "settings_load_one failed %d", err);
+		zassert_equal(val, i, "wrong value loaded");
+	}
+	load_one_ms = k_uptime_delta(&ts);
+
+	printk("*** loading of %u entries completed ***\n", TEST_LOAD_COUNT);
+	printk("full load: %u, replay: %u, direct lookup: %u\n", load_all_ms, replay_ms,
+	       load_one_ms);
+}
+
+#ifdef CONFIG_SETTINGS_SNAPSHOT
+struct snapshot_check {
+	uint32_t count;
+	uint32_t sum;
+};
+
+static int snapshot_check_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			     void *param)
+{
+	struct snapshot_check *check = param;
+	uint32_t val;
+
+	if (read_cb(cb_arg, &val, sizeof(val)) != sizeof(val)) {
+		return -EIO;
+	}
+
+	check->count++;
+	check->sum += val;
+
+	return 0;
+}
+
+/* Compares the time taken to load a subtree from the backend with the time
+ * taken to load it from the snapshot, which must give the same settings.
+ */
+ZTEST(settings_perf, test_snapshot_load_performance)
+{
+	struct snapshot_check backend = {0};
+	struct snapshot_check snapshot = {0};
+	uint32_t backend_ms, snapshot_ms;
+	char path[20];
+	uint32_t val;
+	int64_t ts;
+	int err;
+
+	err = settings_subsys_init();
+	zassert_equal(err, 0, "settings_backend_init failed %d", err);
+
+	for (int i = 0; i < TEST_SETTINGS_COUNT; i++) {
+		val = i;
+		snprintk(path, sizeof(path), "sn/%04x", i);
+		err = settings_save_one(path, &val, sizeof(val));
+		zassert_equal(err, 0, "settings_save_one failed %d", err);
+	}
+
+	/* Saving invalidated the snapshot, so this loads from the backend */
+	ts = k_uptime_get();
+	err = settings_load_subtree_direct("sn", snapshot_check_cb, &backend);
+	backend_ms = k_uptime_delta(&ts);
+	zassert_equal(err, 0, "settings_load_subtree_direct failed %d", err);
+
+	err = settings_snapshot_save();
+	zassert_equal(err, 0, "settings_snapshot_save failed %d", err);
+
+	ts = k_uptime_get();
+	err = settings_load_subtree_direct("sn", snapshot_check_cb, &snapshot);
+	snapshot_ms = k_uptime_delta(&ts);
+	zassert_equal(err, 0, "settings_load_subtree_direct failed %d", err);
+
+	zassert_equal(backend.count, TEST_SETTINGS_COUNT, "wrong number of settings loaded");
+	zassert_equal(snapshot.count, backend.count, "snapshot lost settings");
+	zassert_equal(snapshot.sum, backend.sum, "snapshot values differ");
+
+	printk("*** loading of %u entries completed ***\n", TEST_SETTINGS_COUNT);
+	printk("backend: %u, snapshot: %u\n", backend_ms, snapshot_ms);
+}
+#endif /* CONFIG_SETTINGS_SNAPSHOT */
@@ -489,6 +489,30 @@ ZTEST(sh, test_section_cmd)
 	test_shell_execute_cmd("section_cmd cmd1 sub_cmd2", -EINVAL);
 }
 
+static int cmd_root_order(const struct shell *sh, size_t argc, char **argv)
+{
+	return (int)strlen(argv[0]);
+}
+
+/* Root commands whose linker order differs from the strcmp() order. */
+SHELL_CMD_REGISTER(root_order, NULL, NULL, cmd_root_order);
+SHELL_CMD_REGISTER(root_order1, NULL, NULL, cmd_root_order);
+SHELL_CMD_REGISTER(root_orderB, NULL, NULL, cmd_root_order);
+SHELL_CMD_REGISTER(root_order_c, NULL, NULL, cmd_root_order);
+SHELL_CMD_REGISTER(root_orderd, NULL, NULL, cmd_root_order);
+
+ZTEST(sh, test_root_cmd_lookup)
+{
+	test_shell_execute_cmd("root_order", 10);
+	test_shell_execute_cmd("root_order1", 11);
+	test_shell_execute_cmd("root_orderB", 11);
+	test_shell_execute_cmd("root_order_c", 12);
+	test_shell_execute_cmd("root_orderd", 11);
+	test_shell_execute_cmd("root_orde", -ENOEXEC);
+	test_shell_execute_cmd("root_order_", -ENOEXEC);
+	test_shell_execute_cmd("root_ordere", -ENOEXEC);
+}
+
 static void *shell_setup(void)
 {
 	const struct shell *sh = shell_backend_dummy_get_ptr();
@@ -394,6 +394,47 @@ ZTEST(lib_stream_flash, test_stream_flash_flush)
 	zassert_equal(rc, 0, "expected success");
 }
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+ZTEST(lib_stream_flash, test_stream_flash_double_buffer)
+{
+	static uint8_t second_buf[BUF_LEN];
+	int num_pages = MAX_NUM_PAGES - 1;
+	int rc;
+
+	init_target();
+
+	rc = stream_flash_double_buffer_set(NULL, second_buf);
+	zassert_equal(rc, -EFAULT, "should fail as ctx is NULL");
+
+	rc = stream_flash_double_buffer_set(&ctx, NULL);
+	zassert_equal(rc, -EFAULT, "should fail as buffer is NULL");
+
+	rc = stream_flash_double_buffer_set(&ctx, second_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_double_buffer_set(&ctx, second_buf);
+	zassert_equal(rc, -EALREADY, "should fail as buffer is already set");
+
+	/* Buffers are written to flash in the background */
+	rc = stream_flash_buffered_write(&ctx, write_buf,
+					 (page_size * num_pages) + 128, false);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Writing more than available is detected before the data is written */
+	rc = stream_flash_buffered_write(&ctx, write_buf,
+					 FLASH_AVAILABLE - (page_size * num_pages), false);
+	zassert_equal(rc, -ENOMEM, "expected failure");
+
+	/* Flush waits for all the data to be written */
+	rc = stream_flash_buffered_write(&ctx, write_buf, page_size - 128, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), page_size * (num_pages + 1),
+		      "expected all the data to be written");
+
+	VERIFY_WRITTEN(0, page_size * (num_pages + 1));
+}
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
 #ifdef CONFIG_STREAM_FLASH_ERASE
 ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 {
@@ -0,0 +1,134 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+struct msg {
+	uint32_t seq;
+};
+
+struct big_msg {
+	uint32_t seq;
+	uint8_t payload[12];
+};
+
+#define RECORD_SIZE (sizeof(struct zbus_channel *) + sizeof(struct msg))
+
+/* Room for 8 messages of chan */
+ZBUS_BATCH_SUBSCRIBER_DEFINE(count_sub, 8 * RECORD_SIZE, 4, 0);
+ZBUS_BATCH_SUBSCRIBER_DEFINE(window_sub, 8 * RECORD_SIZE, 100, 50);
+
+ZBUS_CHAN_DEFINE(chan, struct msg, NULL, NULL, ZBUS_OBSERVERS(count_sub), ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(window_chan, struct msg, NULL, NULL, ZBUS_OBSERVERS(window_sub),
+		 ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(big_chan, struct big_msg, NULL, NULL, ZBUS_OBSERVERS(count_sub),
+		 ZBUS_MSG_INIT(0));
+
+static void drain(const struct zbus_observer *sub)
+{
+	const struct zbus_channel *c;
+	struct big_msg m;
+
+	while (zbus_sub_batch_get(sub, &c, &m) == 0) {
+	}
+
+	(void)zbus_sub_wait_batch(sub, K_NO_WAIT);
+}
+
+static void before(void *fixture)
+{
+	drain(&count_sub);
+	drain(&window_sub);
+}
+
+ZTEST_SUITE(batch_subscriber, NULL, NULL, before, NULL, NULL);
+
+ZTEST(batch_subscriber, test_wake_on_count)
+{
+	const struct zbus_channel *c;
+	struct msg m;
+
+	for (uint32_t i = 0; i < 3; i++) {
+		m.seq = i;
+		zassert_equal(0, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	}
+
+	/* The batch is not complete yet */
+	zassert_equal(-ENOMSG, zbus_sub_wait_batch(&count_sub, K_NO_WAIT));
+
+	m.seq = 3;
+	zassert_equal(0, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	zassert_equal(4, zbus_sub_wait_batch(&count_sub, K_NO_WAIT));
+
+	/* The messages are retrieved in publication order */
+	for (uint32_t i = 0; i < 4; i++) {
+		zassert_equal(0, zbus_sub_batch_get(&count_sub, &c, &m));
+		zassert_equal_ptr(&chan, c);
+		zassert_equal(i, m.seq);
+	}
+
+	zassert_equal(-ENOMSG, zbus_sub_batch_get(&count_sub, &c, &m));
+	zassert_equal(-ENOMSG, zbus_sub_wait_batch(&count_sub, K_NO_WAIT));
+}
+
+ZTEST(batch_subscriber, test_several_channels)
+{
+	const struct zbus_channel *c;
+	struct big_msg big = {.seq = 20, .payload = {1, 2, 3}};
+	struct big_msg out;
+	struct msg m = {.seq = 10};
+
+	zassert_equal(0, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_pub(&big_chan, &big, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	zassert_equal(-ENOMSG, zbus_sub_wait_batch(&count_sub, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_pub(&big_chan, &big, K_NO_WAIT));
+
+	zassert_equal(4, zbus_sub_wait_batch(&count_sub, K_NO_WAIT));
+
+	zassert_equal(0, zbus_sub_batch_get(&count_sub, &c, &out));
+	zassert_equal_ptr(&chan, c);
+	zassert_equal(10, out.seq);
+
+	zassert_equal(0, zbus_sub_batch_get(&count_sub, &c, &out));
+	zassert_equal_ptr(&big_chan, c);
+	zassert_mem_equal(&big, &out, sizeof(big));
+}
+
+ZTEST(batch_subscriber, test_wake_on_window)
+{
+	const struct zbus_channel *c;
+	struct msg m = {.seq = 1};
+	int64_t start = k_uptime_get();
+
+	zassert_equal(0, zbus_chan_pub(&window_chan, &m, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_pub(&window_chan, &m, K_NO_WAIT));
+
+	zassert_equal(-ENOMSG, zbus_sub_wait_batch(&window_sub, K_NO_WAIT));
+	zassert_equal(2, zbus_sub_wait_batch(&window_sub, K_MSEC(500)));
+	zassert_true(k_uptime_get() - start >= 50, "woken up before the time window");
+
+	zassert_equal(0, zbus_sub_batch_get(&window_sub, &c, &m));
+	zassert_equal_ptr(&window_chan, c);
+
+	/* The message left starts the next window */
+	zassert_equal(1, zbus_sub_wait_batch(&window_sub, K_MSEC(500)));
+}
+
+ZTEST(batch_subscriber, test_full)
+{
+	struct msg m = {0};
+
+	/* The subscriber is woken up as soon as the ring buffer is full */
+	for (int i = 0; i < 8; i++) {
+		zassert_equal(0, zbus_chan_pub(&window_chan, &m, K_NO_WAIT));
+	}
+
+	zassert_equal(-ENOBUFS, zbus_chan_pub(&window_chan, &m, K_NO_WAIT));
+	zassert_equal(8, zbus_sub_wait_batch(&window_sub, K_NO_WAIT));
+}
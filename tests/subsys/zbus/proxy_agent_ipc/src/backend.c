@@ -0,0 +1,62 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend keeping the last message sent, and delivering the messages injected by the test to
+ * the endpoint as if they came from the remote core.
+ */
+
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service_backend.h>
+#include <zephyr/kernel.h>
+
+#include "backend.h"
+
+#define DT_DRV_COMPAT zbus_test_ipc_backend
+
+static const struct ipc_ept_cfg *ept_cfg;
+
+uint8_t backend_sent[CONFIG_ZBUS_PROXY_AGENT_IPC_TX_BUF_SIZE];
+size_t backend_sent_len;
+int backend_sent_count;
+
+static int send(const struct device *instance, void *token, const void *data, size_t len)
+{
+	memcpy(backend_sent, data, MIN(len, sizeof(backend_sent)));
+	backend_sent_len = len;
+	backend_sent_count++;
+
+	return len;
+}
+
+static int register_ept(const struct device *instance, void **token,
+			const struct ipc_ept_cfg *cfg)
+{
+	ept_cfg = cfg;
+	cfg->cb.bound(cfg->priv);
+
+	return 0;
+}
+
+static int deregister_ept(const struct device *instance, void *token)
+{
+	ept_cfg = NULL;
+
+	return 0;
+}
+
+void backend_receive(const void *data, size_t len)
+{
+	ept_cfg->cb.received(data, len, ept_cfg->priv);
+}
+
+static const struct ipc_service_backend backend_ops = {
+	.send = send,
+	.register_endpoint = register_ept,
+	.deregister_endpoint = deregister_ept,
+};
+
+DEVICE_DT_INST_DEFINE(0, NULL, NULL, NULL, NULL, POST_KERNEL,
+		      CONFIG_IPC_SERVICE_REG_BACKEND_PRIORITY, &backend_ops);
@@ -0,0 +1,18 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZBUS_TEST_IPC_BACKEND_H_
+#define ZBUS_TEST_IPC_BACKEND_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+extern uint8_t backend_sent[];
+extern size_t backend_sent_len;
+extern int backend_sent_count;
+
+void backend_receive(const void *data, size_t len);
+
+#endif /* ZBUS_TEST_IPC_BACKEND_H_ */
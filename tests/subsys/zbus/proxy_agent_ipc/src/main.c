@@ -0,0 +1,183 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/zbus/zbus_proxy_agent_ipc.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+#include "backend.h"
+
+#define HDR_SIZE sizeof(struct zbus_proxy_agent_ipc_hdr)
+#define REC_SIZE sizeof(struct zbus_proxy_agent_ipc_rec)
+
+struct msg {
+	uint32_t value;
+	uint32_t tag;
+};
+
+struct small_msg {
+	uint8_t a;
+	uint8_t b;
+};
+
+ZBUS_CHAN_DEFINE_WITH_ID(msg_chan, 0x10, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+			 ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE_WITH_ID(small_chan, 0x11, struct small_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+			 ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE_WITH_ID(local_chan, 0x12, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+			 ZBUS_MSG_INIT(0));
+
+ZBUS_PROXY_AGENT_IPC_DEFINE(agent, DEVICE_DT_GET(DT_NODELABEL(ipc_test)), "zbus");
+ZBUS_PROXY_AGENT_IPC_MIRROR(agent, msg_chan);
+ZBUS_PROXY_AGENT_IPC_MIRROR(agent, small_chan);
+
+static uint8_t frame[128];
+static size_t frame_len;
+
+static void frame_start(void)
+{
+	memset(frame, 0, sizeof(frame));
+	frame_len = HDR_SIZE;
+}
+
+static void frame_add(uint32_t id, uint32_t seq, const void *msg, uint16_t size)
+{
+	struct zbus_proxy_agent_ipc_hdr *hdr = (void *)frame;
+	struct zbus_proxy_agent_ipc_rec rec = {.id = id, .seq = seq, .size = size};
+
+	memcpy(&frame[frame_len], &rec, sizeof(rec));
+	memcpy(&frame[frame_len + REC_SIZE], msg, size);
+	frame_len += REC_SIZE + ROUND_UP(size, 4);
+	hdr->count++;
+}
+
+static const struct zbus_proxy_agent_ipc_rec *sent_rec(size_t offset)
+{
+	return (const void *)&backend_sent[offset];
+}
+
+static void *setup(void)
+{
+	zassert_ok(zbus_proxy_agent_ipc_start(&agent));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	zassert_ok(zbus_proxy_agent_ipc_flush(&agent));
+	backend_sent_count = 0;
+}
+
+ZTEST_SUITE(proxy_agent_ipc, NULL, setup, before, NULL, NULL);
+
+ZTEST(proxy_agent_ipc, test_batch)
+{
+	struct msg m = {.value = 1, .tag = 0xa5};
+	struct small_msg s = {.a = 7, .b = 8};
+	const struct zbus_proxy_agent_ipc_hdr *hdr = (const void *)backend_sent;
+	const struct zbus_proxy_agent_ipc_rec *rec;
+	uint32_t seq;
+
+	zassert_ok(zbus_chan_pub(&msg_chan, &m, K_NO_WAIT));
+	zassert_ok(zbus_chan_pub(&small_chan, &s, K_NO_WAIT));
+	m.value = 2;
+	zassert_ok(zbus_chan_pub(&msg_chan, &m, K_NO_WAIT));
+
+	/* Not mirrored */
+	zassert_ok(zbus_chan_pub(&local_chan, &m, K_NO_WAIT));
+
+	/* Held until the time window expires, or the agent is flushed */
+	zassert_equal(0, backend_sent_count);
+	zassert_ok(zbus_proxy_agent_ipc_flush(&agent));
+	zassert_equal(1, backend_sent_count);
+
+	zassert_equal(3, hdr->count);
+	zassert_equal(HDR_SIZE + 3 * REC_SIZE + 8 + 4 + 8, backend_sent_len);
+
+	rec = sent_rec(HDR_SIZE);
+	zassert_equal(0x10, rec->id);
+	zassert_equal(sizeof(struct msg), rec->size);
+	m.value = 1;
+	zassert_mem_equal(&backend_sent[HDR_SIZE + REC_SIZE], &m, sizeof(m));
+	seq = rec->seq;
+
+	rec = sent_rec(HDR_SIZE + REC_SIZE + 8);
+	zassert_equal(0x11, rec->id);
+	zassert_equal(seq + 1, rec->seq);
+	zassert_equal(sizeof(struct small_msg), rec->size);
+	zassert_mem_equal(&backend_sent[HDR_SIZE + 2 * REC_SIZE + 8], &s, sizeof(s));
+
+	rec = sent_rec(HDR_SIZE + 2 * REC_SIZE + 8 + 4);
+	zassert_equal(0x10, rec->id);
+	zassert_equal(seq + 2, rec->seq);
+}
+
+ZTEST(proxy_agent_ipc, test_batch_max)
+{
+	const struct zbus_proxy_agent_ipc_hdr *hdr = (const void *)backend_sent;
+	struct msg m = {0};
+
+	for (int i = 0; i < CONFIG_ZBUS_PROXY_AGENT_IPC_BATCH_MAX - 1; i++) {
+		zassert_ok(zbus_chan_pub(&msg_chan, &m, K_NO_WAIT));
+	}
+	zassert_equal(0, backend_sent_count);
+
+	zassert_ok(zbus_chan_pub(&msg_chan, &m, K_NO_WAIT));
+	zassert_equal(1, backend_sent_count);
+	zassert_equal(CONFIG_ZBUS_PROXY_AGENT_IPC_BATCH_MAX, hdr->count);
+}
+
+ZTEST(proxy_agent_ipc, test_window)
+{
+	struct msg m = {0};
+
+	zassert_ok(zbus_chan_pub(&msg_chan, &m, K_NO_WAIT));
+	k_sleep(K_MSEC(CONFIG_ZBUS_PROXY_AGENT_IPC_BATCH_WINDOW_MS + 100));
+	zassert_equal(1, backend_sent_count);
+}
+
+ZTEST(proxy_agent_ipc, test_receive)
+{
+	struct zbus_proxy_agent_ipc_stats before_stats, stats;
+	struct msg m1 = {.value = 10, .tag = 1};
+	struct msg m2 = {.value = 11, .tag = 2};
+	struct small_msg s = {.a = 1, .b = 2};
+	struct msg r;
+	struct small_msg sr;
+
+	zbus_proxy_agent_ipc_stats_get(&agent, &before_stats);
+
+	frame_start();
+	frame_add(0x10, 100, &m1, sizeof(m1));
+	frame_add(0x11, 101, &s, sizeof(s));
+	frame_add(0x10, 102, &m2, sizeof(m2));
+	backend_receive(frame, frame_len);
+
+	zassert_ok(zbus_chan_read(&msg_chan, &r, K_NO_WAIT));
+	zassert_mem_equal(&m2, &r, sizeof(r));
+	zassert_ok(zbus_chan_read(&small_chan, &sr, K_NO_WAIT));
+	zassert_mem_equal(&s, &sr, sizeof(s));
+
+	/* The received publications are not sent back */
+	zassert_ok(zbus_proxy_agent_ipc_flush(&agent));
+	zassert_equal(0, backend_sent_count);
+
+	/* Two records lost, an unknown channel and a size mismatch */
+	frame_start();
+	frame_add(0x10, 105, &m1, sizeof(m1));
+	frame_add(0x99, 106, &m1, sizeof(m1));
+	frame_add(0x11, 107, &m1, sizeof(m1));
+	backend_receive(frame, frame_len);
+
+	zbus_proxy_agent_ipc_stats_get(&agent, &stats);
+	zassert_equal(before_stats.received + 4, stats.received);
+	zassert_equal(before_stats.lost + 2, stats.lost);
+	zassert_equal(before_stats.rejected + 2, stats.rejected);
+}
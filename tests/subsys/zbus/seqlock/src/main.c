@@ -0,0 +1,140 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+#define WRITES      2000
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct msg {
+	uint32_t a;
+	uint32_t b;
+	uint32_t c;
+	uint32_t d;
+};
+
+static bool validator(const void *msg, size_t msg_size)
+{
+	const struct msg *m = msg;
+
+	return m->a != UINT32_MAX;
+}
+
+static int notified;
+static struct msg notified_msg;
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	notified++;
+	notified_msg = *(const struct msg *)zbus_chan_const_msg(chan);
+}
+
+ZBUS_LISTENER_DEFINE(lis, listener_cb);
+
+ZBUS_CHAN_DEFINE_SEQLOCK(chan, struct msg, validator, NULL, ZBUS_OBSERVERS(lis),
+			 ZBUS_MSG_INIT(.a = 1, .b = 1, .c = 1, .d = 1));
+
+static K_THREAD_STACK_DEFINE(writer_stack, STACK_SIZE);
+static struct k_thread writer_thread;
+static int writer_errors;
+
+static void writer(void *p1, void *p2, void *p3)
+{
+	for (uint32_t i = 0; i < WRITES; i++) {
+		struct msg m = {.a = i, .b = i, .c = i, .d = i};
+
+		if (zbus_chan_pub(&chan, &m, K_NO_WAIT) != 0) {
+			writer_errors++;
+		}
+
+		if ((i % 16) == 0) {
+			k_yield();
+		}
+	}
+}
+
+static void before(void *fixture)
+{
+	notified = 0;
+	writer_errors = 0;
+}
+
+ZTEST_SUITE(seqlock, NULL, NULL, before, NULL, NULL);
+
+ZTEST(seqlock, test_pub_read)
+{
+	struct msg m = {.a = 2, .b = 3, .c = 4, .d = 5};
+	struct msg r = {0};
+
+	zassert_equal(0, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	zassert_equal(1, notified);
+	zassert_mem_equal(&m, &notified_msg, sizeof(m));
+
+	zassert_equal(0, zbus_chan_read(&chan, &r, K_NO_WAIT));
+	zassert_mem_equal(&m, &r, sizeof(m));
+	zassert_true(zbus_chan_pub_stats_count(&chan) > 0);
+
+	/* The validator still applies */
+	m.a = UINT32_MAX;
+	zassert_equal(-ENOMSG, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	zassert_equal(1, notified);
+
+	zassert_equal(0, zbus_chan_notify(&chan, K_NO_WAIT));
+	zassert_equal(2, notified);
+}
+
+ZTEST(seqlock, test_pub_without_sem)
+{
+	struct msg m = {.a = 7, .b = 7, .c = 7, .d = 7};
+	struct msg r = {0};
+
+	/* Publishing does not wait for the channel semaphore */
+	zassert_equal(0, zbus_chan_claim(&chan, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_read(&chan, &r, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_finish(&chan));
+
+	zassert_mem_equal(&m, &r, sizeof(m));
+}
+
+ZTEST(seqlock, test_concurrent_writer)
+{
+	struct msg m = {.a = 9};
+
+	/* Simulate a writer in the middle of a publication */
+	atomic_inc(&chan.data->seq);
+
+	zassert_equal(-EBUSY, zbus_chan_pub(&chan, &m, K_NO_WAIT));
+	zassert_equal(-EAGAIN, zbus_chan_read(&chan, &m, K_NO_WAIT));
+	zassert_equal(-EAGAIN, zbus_chan_read(&chan, &m, K_MSEC(10)));
+
+	atomic_inc(&chan.data->seq);
+
+	zassert_equal(0, zbus_chan_read(&chan, &m, K_NO_WAIT));
+}
+
+ZTEST(seqlock, test_consistent_reads)
+{
+	struct msg r;
+
+	k_thread_create(&writer_thread, writer_stack, K_THREAD_STACK_SIZEOF(writer_stack), writer,
+			NULL, NULL, NULL, k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	/* The message is never read while it is partially written */
+	while (k_thread_join(&writer_thread, K_NO_WAIT) != 0) {
+		zassert_equal(0, zbus_chan_read(&chan, &r, K_FOREVER));
+		zassert_true(r.a == r.b && r.b == r.c && r.c == r.d, "torn read");
+
+		k_yield();
+	}
+
+	zassert_equal(0, zbus_chan_read(&chan, &r, K_NO_WAIT));
+	zassert_equal(WRITES - 1, r.a);
+	zassert_equal(0, writer_errors);
+	zassert_equal(WRITES, notified);
+}
@@ -10,6 +10,12 @@
 #include "../../../lib/crc/crc16_sw.c"
 #include "../../../lib/crc/crc32_sw.c"
 #include "../../../lib/crc/crc32c_sw.c"
+#if defined(CONFIG_CRC16_CCITT_SLICING_BY_4)
+#include "../../../lib/crc/crc16_ccitt_slicing_by_4.c"
+#endif
+#if defined(CONFIG_CRC32_SLICING_BY_8)
+#include "../../../lib/crc/crc32_slicing_by_8.c"
+#endif
 #include "../../../lib/crc/crc7_sw.c"
 #include "../../../lib/crc/crc24_sw.c"
 #include "../../../lib/crc/crc4_sw.c"
@@ -74,6 +80,22 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+ZTEST(crc, test_crc32_long)
+{
+	uint8_t data[256];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	zassert_equal(crc32_ieee(data, sizeof(data)), 0x29058C73);
+	zassert_equal(crc32_c(0, data, sizeof(data), true, true), 0x9C44184B);
+
+	/* Unaligned start and length not a multiple of the word size */
+	zassert_equal(crc32_ieee(&data[3], 100), 0x443E0918);
+	zassert_equal(crc32_c(0, &data[3], 100, true, true), 0x1718FD1B);
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };
@@ -174,6 +196,20 @@ ZTEST(crc, test_crc16_ccitt_for_ppp)
 		      0x906e);
 }
 
+ZTEST(crc, test_crc16_ccitt_long)
+{
+	uint8_t data[256];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	zassert_equal(crc16_ccitt(0xffff, data, sizeof(data)) ^ 0xffff, 0x303c);
+
+	/* Unaligned start and length not a multiple of the slice size */
+	zassert_equal(crc16_ccitt(0xffff, &data[3], 100) ^ 0xffff, 0xde13);
+}
+
 ZTEST(crc, test_crc16_itu_t)
 {
 	uint8_t test2[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
@@ -26,6 +26,11 @@ static struct rbnode *walked_nodes[MAX_NODES];
 /* Node currently being inserted, for testing lessthan() argument order */
 static struct rbnode *current_insertee;
 
+#ifdef CONFIG_RB_AUGMENT
+/* Number of nodes in the subtree of each node, maintained by augment() */
+static int subtree_size[MAX_NODES];
+#endif
+
 void set_node_mask(int node, int val)
 {
 	unsigned int *p = &node_mask[node / 32];
@@ -59,6 +64,19 @@ bool node_lessthan(struct rbnode *a, struct rbnode *b)
 	return a < b;
 }
 
+#ifdef CONFIG_RB_AUGMENT
+static int get_subtree_size(struct rbnode *n)
+{
+	return n ? subtree_size[node_index(n)] : 0;
+}
+
+void augment(struct rbnode *node)
+{
+	subtree_size[node_index(node)] = 1 + get_subtree_size(rb_get_left(node)) +
+					 get_subtree_size(rb_get_right(node));
+}
+#endif
+
 /* Simple LCRNG (modulus is 2^64!) cribbed from:
  * https://nuclear.llnl.gov/CNP/rng/rngman/node4.html
  *
@@ -89,9 +107,11 @@ void visit_node(struct rbnode *node, void *cookie)
  */
 static int last_black_height;
 
-void check_rbnode(struct rbnode *node, int blacks_above)
+/* Returns the number of nodes in the subtree */
+int check_rbnode(struct rbnode *node, int blacks_above)
 {
 	int side, bheight = blacks_above + z_rb_is_black(node);
+	int size = 1;
 
 	for (side = 0; side < 2; side++) {
 		struct rbnode *ch = z_rb_child(node, side);
@@ -108,7 +128,7 @@ void check_rbnode(struct rbnode *node, int blacks_above)
 			_CHECK(z_rb_is_black(node) || z_rb_is_black(ch));
 
 			/* Recurse */
-			check_rbnode(ch, bheight);
+			size += check_rbnode(ch, bheight);
 		} else {
 			/* All leaf nodes must be at the same black height */
 			if (last_black_height) {
@@ -117,6 +137,13 @@ void check_rbnode(struct rbnode *node, int blacks_above)
 			last_black_height = bheight;
 		}
 	}
+
+#ifdef CONFIG_RB_AUGMENT
+	/* The augmented data must be up to date everywhere */
+	_CHECK(get_subtree_size(node) == size);
+#endif
+
+	return size;
 }
 
 void check_rb(void)
@@ -174,6 +201,10 @@ void _check_tree(int size, int use_foreach)
 
 	_CHECK(ni == nwalked);
 
+	/* The extremes must match the walk, cached or not */
+	_CHECK(rb_get_min(&test_rbtree) == (nwalked ? walked_nodes[0] : NULL));
+	_CHECK(rb_get_max(&test_rbtree) == (nwalked ? walked_nodes[nwalked - 1] : NULL));
+
 	if (test_rbtree.root) {
 		check_rb();
 	}
@@ -202,6 +233,9 @@ void test_tree(int size)
 
 	(void)memset(&test_rbtree, 0, sizeof(test_rbtree));
 	test_rbtree.lessthan_fn = node_lessthan;
+#ifdef CONFIG_RB_AUGMENT
+	test_rbtree.augment_fn = augment;
+#endif
 	(void)memset(nodes, 0, sizeof(nodes));
 	(void)memset(node_mask, 0, sizeof(node_mask));
 